@@ -30,6 +30,9 @@
 #include <chrono>
 #include <condition_variable>
 #include <future>
+#include <mutex>
+#include <thread>
+#include <atomic>
 
 #include "common/format.h"
 
@@ -225,9 +228,13 @@ typedef uint8													GameMode;
 typedef uint64													GameID;
 #define GAME_ID_INVALID											0
 
-// 包最大长度
+// 包最大长度(版本1的包头)
 #define PACKET_LENGTH_MAX										65535
 
+// 版本2的包头允许的最大长度， 超过FRAME_CHUNK_SIZE的包分成多帧发送
+#define FRAME_LENGTH_MAX										(16 * 1024 * 1024)
+#define FRAME_CHUNK_SIZE										(64 * 1024)
+
 // 服务器类型
 enum class ServerType
 {
@@ -445,12 +452,15 @@ inline wchar_t* char2wchar(const char* cs, size_t* outlen = NULL)
 	return ccattr;
 };
 
-inline uint64 uuid()
+// workid占10位， 网络层用它标记session所属的事件循环
+inline uint64 uuid(int workid = 1)
 {
-	static int workid = 1;
+	static std::mutex mutex;
 	static int seqid = 0;
 	static uint64_t last_stamp = getTimeStamp();
 
+	std::lock_guard<std::mutex> lock(mutex);
+
 	uint64_t uniqueId = 0;
 	uint64_t nowtime = getTimeStamp();
 	uniqueId = nowtime << 22;
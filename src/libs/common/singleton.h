@@ -1,9 +1,9 @@
 /*
-	÷:
+	用法:
 		class A:public Singleton<A>
 		{
 		};
-		cppļ:
+		在cpp文件中:
 		template<> A* Singleton<A>::singleton_ = 0;
 */
 #ifndef X_SINGLETON_H
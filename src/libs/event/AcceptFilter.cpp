@@ -0,0 +1,522 @@
+#include "AcceptFilter.h"
+#include "log/XLog.h"
+#include "resmgr/ResMgr.h"
+
+namespace XServer {
+
+//-------------------------------------------------------------------------------------
+static uint64 nowMS()
+{
+	return std::chrono::duration_cast<std::chrono::milliseconds>(
+		std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+//-------------------------------------------------------------------------------------
+static bool parseNumber(const std::string& str, uint32 max, uint32& value)
+{
+	if (str.empty() || str.size() > 3)
+		return false;
+
+	value = 0;
+	for (auto c : str)
+	{
+		if (c < '0' || c > '9')
+			return false;
+
+		value = value * 10 + (c - '0');
+	}
+
+	return value <= max;
+}
+
+//-------------------------------------------------------------------------------------
+bool IPPrefix::parse(const std::string& text, IPPrefix& prefix)
+{
+	prefix = IPPrefix();
+
+	std::string str = text;
+	x_replace(str, " ", "");
+	x_replace(str, "\t", "");
+
+	// 旧写法"192.168.1.*"， '*'之前的部分作为前缀
+	if (str.find('*') != std::string::npos)
+	{
+		std::vector<std::string> parts;
+		x_split(str, '.', parts);
+
+		uint32 count = 0;
+		for (auto& part : parts)
+		{
+			if (part == "*")
+				break;
+
+			uint32 value = 0;
+			if (count >= 3 || !parseNumber(part, 255, value))
+				return false;
+
+			prefix.addr[count++] = (uint8)value;
+		}
+
+		prefix.len = count * 8;
+		return true;
+	}
+
+	size_t pos = str.find('/');
+	std::string host = str.substr(0, pos);
+
+	if (evutil_inet_pton(AF_INET, host.c_str(), prefix.addr) == 1)
+	{
+		prefix.v6 = false;
+	}
+	else if (evutil_inet_pton(AF_INET6, host.c_str(), prefix.addr) == 1)
+	{
+		prefix.v6 = true;
+	}
+	else
+	{
+		return false;
+	}
+
+	prefix.len = prefix.bits();
+
+	if (pos != std::string::npos && !parseNumber(str.substr(pos + 1), prefix.bits(), prefix.len))
+		return false;
+
+	prefix = prefix.masked(prefix.len);
+	return true;
+}
+
+//-------------------------------------------------------------------------------------
+bool IPPrefix::fromSockaddr(const struct sockaddr* pAddr, IPPrefix& prefix)
+{
+	prefix = IPPrefix();
+
+	if (pAddr->sa_family == AF_INET)
+	{
+		memcpy(prefix.addr, &((const struct sockaddr_in*)pAddr)->sin_addr, 4);
+	}
+	else if (pAddr->sa_family == AF_INET6)
+	{
+		const struct in6_addr* pAddr6 = &((const struct sockaddr_in6*)pAddr)->sin6_addr;
+
+		// 双栈监听时IPv4的客户端
+		if (IN6_IS_ADDR_V4MAPPED(pAddr6))
+		{
+			memcpy(prefix.addr, (const uint8*)pAddr6 + 12, 4);
+		}
+		else
+		{
+			memcpy(prefix.addr, pAddr6, 16);
+			prefix.v6 = true;
+		}
+	}
+	else
+	{
+		return false;
+	}
+
+	prefix.len = prefix.bits();
+	return true;
+}
+
+//-------------------------------------------------------------------------------------
+IPPrefix IPPrefix::masked(uint32 len) const
+{
+	IPPrefix prefix = *this;
+	prefix.len = std::min(len, bits());
+
+	for (uint32 i = 0; i < 16; ++i)
+	{
+		uint32 start = i * 8;
+		if (start + 8 <= prefix.len)
+			continue;
+
+		prefix.addr[i] = (start >= prefix.len) ? 0 : (uint8)(addr[i] & (0xff << (8 - (prefix.len - start))));
+	}
+
+	return prefix;
+}
+
+//-------------------------------------------------------------------------------------
+bool IPPrefix::operator<(const IPPrefix& other) const
+{
+	if (v6 != other.v6)
+		return v6 < other.v6;
+
+	int ret = memcmp(addr, other.addr, sizeof(addr));
+	if (ret != 0)
+		return ret < 0;
+
+	return len < other.len;
+}
+
+//-------------------------------------------------------------------------------------
+std::string IPPrefix::str() const
+{
+	char buf[64] = { 0 };
+	evutil_inet_ntop(v6 ? AF_INET6 : AF_INET, addr, buf, sizeof(buf));
+
+	if (len < bits())
+		return fmt::format("{}/{}", buf, len);
+
+	return buf;
+}
+
+//-------------------------------------------------------------------------------------
+AddressTrie::AddressTrie():
+nodes_(),
+prefixes_(0)
+{
+	clear();
+}
+
+//-------------------------------------------------------------------------------------
+void AddressTrie::clear()
+{
+	nodes_.clear();
+	prefixes_ = 0;
+
+	newNode();
+	newNode();
+}
+
+//-------------------------------------------------------------------------------------
+int32 AddressTrie::newNode()
+{
+	Node node;
+	node.child[0] = -1;
+	node.child[1] = -1;
+	node.terminal = false;
+
+	nodes_.push_back(node);
+	return (int32)nodes_.size() - 1;
+}
+
+//-------------------------------------------------------------------------------------
+bool AddressTrie::add(const std::string& text)
+{
+	IPPrefix prefix;
+	if (IPPrefix::parse(text, prefix))
+	{
+		add(prefix);
+		return true;
+	}
+
+	// 主机名， 例如localhost
+	struct evutil_addrinfo hints;
+	memset(&hints, 0, sizeof(hints));
+	hints.ai_family = AF_UNSPEC;
+	hints.ai_socktype = SOCK_STREAM;
+
+	struct evutil_addrinfo* pResult = NULL;
+	if (evutil_getaddrinfo(text.c_str(), NULL, &hints, &pResult) != 0 || !pResult)
+		return false;
+
+	bool added = false;
+	for (struct evutil_addrinfo* pInfo = pResult; pInfo; pInfo = pInfo->ai_next)
+	{
+		if (IPPrefix::fromSockaddr(pInfo->ai_addr, prefix))
+		{
+			add(prefix);
+			added = true;
+		}
+	}
+
+	evutil_freeaddrinfo(pResult);
+	return added;
+}
+
+//-------------------------------------------------------------------------------------
+void AddressTrie::add(const IPPrefix& prefix)
+{
+	int32 node = prefix.v6 ? 1 : 0;
+
+	for (uint32 i = 0; i < prefix.len; ++i)
+	{
+		// 已经被更短的前缀包含
+		if (nodes_[node].terminal)
+			break;
+
+		int b = prefix.bit(i);
+		if (nodes_[node].child[b] < 0)
+		{
+			int32 child = newNode();
+			nodes_[node].child[b] = child;
+		}
+
+		node = nodes_[node].child[b];
+	}
+
+	nodes_[node].terminal = true;
+	++prefixes_;
+}
+
+//-------------------------------------------------------------------------------------
+bool AddressTrie::match(const IPPrefix& addr) const
+{
+	int32 node = addr.v6 ? 1 : 0;
+	uint32 bits = addr.bits();
+
+	for (uint32 i = 0; ; ++i)
+	{
+		const Node& n = nodes_[node];
+		if (n.terminal)
+			return true;
+
+		if (i == bits)
+			return false;
+
+		node = n.child[addr.bit(i)];
+		if (node < 0)
+			return false;
+	}
+}
+
+//-------------------------------------------------------------------------------------
+AcceptLimiter::AcceptLimiter():
+name_(),
+rate_(0),
+burst_(0),
+prefixV4_(32),
+prefixV6_(128),
+mutex_(),
+buckets_(),
+throttled_(0),
+lastSweepMS_(0)
+{
+}
+
+//-------------------------------------------------------------------------------------
+void AcceptLimiter::setup(const std::string& name, uint32 rate, uint32 burst, uint32 prefixV4, uint32 prefixV6)
+{
+	std::lock_guard<std::mutex> lock(mutex_);
+
+	name_ = name;
+	rate_ = rate;
+	burst_ = std::max(burst, rate);
+	prefixV4_ = std::min(prefixV4, (uint32)32);
+	prefixV6_ = std::min(prefixV6, (uint32)128);
+
+	buckets_.clear();
+	throttled_ = 0;
+}
+
+//-------------------------------------------------------------------------------------
+bool AcceptLimiter::acquire(const IPPrefix& addr, uint64 nowMS)
+{
+	IPPrefix prefix = addr.masked(addr.v6 ? prefixV6_ : prefixV4_);
+
+	std::lock_guard<std::mutex> lock(mutex_);
+
+	// 定期清理已经攒满令牌的前缀； 前缀太多时最多每秒清理一次
+	if (nowMS >= lastSweepMS_ + 10000 || (buckets_.size() >= MAX_BUCKETS && nowMS >= lastSweepMS_ + 1000))
+		sweep(nowMS);
+
+	auto iter = buckets_.find(prefix);
+	if (iter == buckets_.end())
+	{
+		if (buckets_.size() >= MAX_BUCKETS)
+			return true;
+
+		Bucket& bucket = buckets_[prefix];
+		bucket.tokens = burst_ - 1;
+		bucket.lastMS = nowMS;
+		bucket.dropped = 0;
+		return true;
+	}
+
+	Bucket& bucket = iter->second;
+	bucket.tokens = std::min((double)burst_, bucket.tokens + (nowMS - bucket.lastMS) * rate_ / 1000.0);
+	bucket.lastMS = nowMS;
+
+	if (bucket.tokens >= 1)
+	{
+		bucket.tokens -= 1;
+
+		if (bucket.dropped > 0)
+		{
+			INFO_MSG(fmt::format("AcceptLimiter::acquire(): {}: {} is no longer throttled, dropped={}\n",
+				name_, prefix.str(), bucket.dropped));
+
+			bucket.dropped = 0;
+			--throttled_;
+		}
+
+		return true;
+	}
+
+	if (bucket.dropped++ == 0)
+	{
+		WARNING_MSG(fmt::format("AcceptLimiter::acquire(): {}: {} exceeds {} connections/s, throttling!\n",
+			name_, prefix.str(), rate_));
+
+		++throttled_;
+	}
+
+	return false;
+}
+
+//-------------------------------------------------------------------------------------
+void AcceptLimiter::sweep(uint64 nowMS)
+{
+	lastSweepMS_ = nowMS;
+
+	for (auto iter = buckets_.begin(); iter != buckets_.end(); )
+	{
+		Bucket& bucket = iter->second;
+		if (bucket.tokens + (nowMS - bucket.lastMS) * rate_ / 1000.0 < burst_)
+		{
+			++iter;
+			continue;
+		}
+
+		if (bucket.dropped > 0)
+		{
+			INFO_MSG(fmt::format("AcceptLimiter::sweep(): {}: {} is no longer throttled, dropped={}\n",
+				name_, iter->first.str(), bucket.dropped));
+
+			--throttled_;
+		}
+
+		iter = buckets_.erase(iter);
+	}
+}
+
+//-------------------------------------------------------------------------------------
+size_t AcceptLimiter::throttled() const
+{
+	std::lock_guard<std::mutex> lock(mutex_);
+	return throttled_;
+}
+
+//-------------------------------------------------------------------------------------
+std::string AcceptLimiter::info() const
+{
+	if (!enabled())
+		return "off";
+
+	return fmt::format("{}/s, burst={}, per /{} and /{}", rate_, burst_, prefixV4_, prefixV6_);
+}
+
+//-------------------------------------------------------------------------------------
+AcceptFilter::AcceptFilter():
+isInternalNetwork_(false),
+allowlistRequired_(false),
+allowlist_(),
+limiter_(),
+accepted_(0),
+denied_(0),
+throttled_(0),
+lastLogMS_(0),
+suppressed_(0)
+{
+}
+
+//-------------------------------------------------------------------------------------
+void AcceptFilter::setup(bool isInternalNetwork)
+{
+	const ResMgr::ServerConfig& cfg = ResMgr::getSingleton().serverConfig();
+
+	isInternalNetwork_ = isInternalNetwork;
+
+	// 只有服务器之间的连接需要检查地址
+	allowlistRequired_ = isInternalNetwork;
+	allowlist_.clear();
+
+	if (allowlistRequired_)
+	{
+		for (auto& item : cfg.server_addresses)
+		{
+			if (!allowlist_.add(item))
+				ERROR_MSG(fmt::format("AcceptFilter::setup(): invalid server address: {}!\n", item));
+		}
+
+		if (allowlist_.empty())
+			WARNING_MSG(fmt::format("AcceptFilter::setup(): server_addresses is empty, all internal connections will be rejected!\n"));
+	}
+
+	if (isInternalNetwork)
+		limiter_.setup("Internal", cfg.internal_ACCEPT_RATE, cfg.internal_ACCEPT_BURST, cfg.acceptPrefixV4, cfg.acceptPrefixV6);
+	else
+		limiter_.setup("External", cfg.external_ACCEPT_RATE, cfg.external_ACCEPT_BURST, cfg.acceptPrefixV4, cfg.acceptPrefixV6);
+}
+
+//-------------------------------------------------------------------------------------
+AcceptFilter::Verdict AcceptFilter::check(socket_t sock, const struct sockaddr* pAddr)
+{
+	if (!allowlistRequired_ && !limiter_.enabled())
+	{
+		++accepted_;
+		return ACCEPT_OK;
+	}
+
+	// io_uring的multishot accept不返回对端地址
+	struct sockaddr_storage peer;
+	if (!pAddr)
+	{
+		socklen_t len = sizeof(peer);
+		if (getpeername(sock, (struct sockaddr*)&peer, &len) != 0)
+		{
+			++denied_;
+			return ACCEPT_DENIED;
+		}
+
+		pAddr = (const struct sockaddr*)&peer;
+	}
+
+	IPPrefix addr;
+	if (!IPPrefix::fromSockaddr(pAddr, addr))
+	{
+		if (allowlistRequired_)
+		{
+			++denied_;
+			return ACCEPT_DENIED;
+		}
+
+		++accepted_;
+		return ACCEPT_OK;
+	}
+
+	uint64 now = nowMS();
+
+	if (allowlistRequired_ && !allowlist_.match(addr))
+	{
+		++denied_;
+		logRejected(ACCEPT_DENIED, addr, now);
+		return ACCEPT_DENIED;
+	}
+
+	// 限流的开始和结束由AcceptLimiter输出
+	if (limiter_.enabled() && !limiter_.acquire(addr, now))
+	{
+		++throttled_;
+		return ACCEPT_THROTTLED;
+	}
+
+	++accepted_;
+	return ACCEPT_OK;
+}
+
+//-------------------------------------------------------------------------------------
+void AcceptFilter::logRejected(Verdict verdict, const IPPrefix& addr, uint64 nowMS)
+{
+	uint64 last = lastLogMS_;
+	if ((last != 0 && nowMS < last + 1000) || !lastLogMS_.compare_exchange_strong(last, nowMS))
+	{
+		++suppressed_;
+		return;
+	}
+
+	ERROR_MSG(fmt::format("AcceptFilter::check(): Illegal {} address: {}! suppressed={}\n",
+		(isInternalNetwork_ ? "internal" : "external"), addr.str(), suppressed_.exchange(0)));
+}
+
+//-------------------------------------------------------------------------------------
+std::string AcceptFilter::info() const
+{
+	std::string allowlist = allowlistRequired_ ? fmt::format("{} prefixes", allowlist_.size()) : "any";
+	return fmt::format("allow={}, rate={}", allowlist, limiter_.info());
+}
+
+//-------------------------------------------------------------------------------------
+}
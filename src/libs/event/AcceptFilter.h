@@ -0,0 +1,204 @@
+#ifndef X_ACCEPT_FILTER_H
+#define X_ACCEPT_FILTER_H
+
+#include "common/common.h"
+
+namespace XServer {
+
+// 一个IPv4或IPv6地址前缀， len为前缀位数
+struct IPPrefix
+{
+	IPPrefix():
+	v6(false),
+	len(0)
+	{
+		memset(addr, 0, sizeof(addr));
+	}
+
+	// "10.0.0.0/8"、"fe80::/10"、"192.168.1.5"， 兼容旧的"192.168.1.*"写法
+	static bool parse(const std::string& text, IPPrefix& prefix);
+
+	// IPv4映射的IPv6地址(::ffff:a.b.c.d)按IPv4处理
+	static bool fromSockaddr(const struct sockaddr* pAddr, IPPrefix& prefix);
+
+	uint32 bits() const {
+		return v6 ? 128 : 32;
+	}
+
+	bool bit(uint32 i) const {
+		return (addr[i >> 3] >> (7 - (i & 7))) & 1;
+	}
+
+	// 截取前len位， 其余位清零
+	IPPrefix masked(uint32 len) const;
+
+	bool operator<(const IPPrefix& other) const;
+
+	std::string str() const;
+
+	bool v6;
+	uint8 addr[16];
+	uint32 len;
+};
+
+/*
+	CIDR前缀树， IPv4和IPv6各一个根节点
+	节点放在连续数组中， 匹配时沿地址的位逐个向下， 遇到任何一个已登记的前缀就命中， 不分配内存
+	建好之后只读， 多个循环线程可以同时匹配
+*/
+class AddressTrie
+{
+public:
+	AddressTrie();
+
+	// 不是地址时按主机名解析， 加入解析出的所有地址
+	bool add(const std::string& text);
+	void add(const IPPrefix& prefix);
+
+	bool match(const IPPrefix& addr) const;
+
+	void clear();
+
+	size_t size() const {
+		return prefixes_;
+	}
+
+	bool empty() const {
+		return prefixes_ == 0;
+	}
+
+private:
+	struct Node
+	{
+		int32 child[2];
+		bool terminal;
+	};
+
+	int32 newNode();
+
+protected:
+	// nodes_[0]为IPv4的根， nodes_[1]为IPv6的根
+	std::vector<Node> nodes_;
+	size_t prefixes_;
+};
+
+/*
+	按来源前缀的令牌桶， 每个前缀每秒补充rate个令牌， 最多攒burst个， 每个连接消耗一个
+	只有开始限流和恢复时输出日志， 被拒绝的连接只计数
+*/
+class AcceptLimiter
+{
+public:
+	enum
+	{
+		// 同时跟踪的前缀数上限， 超过后新的前缀不限流
+		MAX_BUCKETS = 65536
+	};
+
+	AcceptLimiter();
+
+	// name只用于日志， burst小于rate时按rate
+	void setup(const std::string& name, uint32 rate, uint32 burst, uint32 prefixV4, uint32 prefixV6);
+
+	bool enabled() const {
+		return rate_ > 0;
+	}
+
+	// 返回false时拒绝这个连接
+	bool acquire(const IPPrefix& addr, uint64 nowMS);
+
+	// 当前被限流的前缀数
+	size_t throttled() const;
+
+	std::string info() const;
+
+private:
+	struct Bucket
+	{
+		double tokens;
+		uint64 lastMS;
+		uint64 dropped;
+	};
+
+	void sweep(uint64 nowMS);
+
+protected:
+	std::string name_;
+
+	uint32 rate_;
+	uint32 burst_;
+	uint32 prefixV4_;
+	uint32 prefixV6_;
+
+	mutable std::mutex mutex_;
+	std::map<IPPrefix, Bucket> buckets_;
+	size_t throttled_;
+	uint64 lastSweepMS_;
+};
+
+/*
+	accept之后、创建session之前对连接的检查： 地址白名单和按来源前缀的速率限制
+	被拒绝的连接直接RST关闭， 不分配session， 拒绝的日志每秒最多一条
+*/
+class AcceptFilter
+{
+public:
+	enum Verdict
+	{
+		ACCEPT_OK = 0,
+		ACCEPT_DENIED = 1,			// 不在白名单中
+		ACCEPT_THROTTLED = 2		// 超过来源前缀的速率
+	};
+
+	AcceptFilter();
+
+	// 内部网络只接受server_addresses中的地址， 速率见ACCEPT_RATE/ACCEPT_BURST
+	void setup(bool isInternalNetwork);
+
+	// addr为NULL时通过getpeername读取
+	Verdict check(socket_t sock, const struct sockaddr* pAddr);
+
+	const AddressTrie& allowlist() const {
+		return allowlist_;
+	}
+
+	uint64 accepted() const {
+		return accepted_;
+	}
+
+	uint64 denied() const {
+		return denied_;
+	}
+
+	uint64 throttled() const {
+		return throttled_;
+	}
+
+	size_t throttledPrefixes() const {
+		return limiter_.throttled();
+	}
+
+	std::string info() const;
+
+private:
+	void logRejected(Verdict verdict, const IPPrefix& addr, uint64 nowMS);
+
+protected:
+	bool isInternalNetwork_;
+	bool allowlistRequired_;
+
+	AddressTrie allowlist_;
+	AcceptLimiter limiter_;
+
+	std::atomic<uint64> accepted_;
+	std::atomic<uint64> denied_;
+	std::atomic<uint64> throttled_;
+
+	// 上次输出拒绝日志的时间和之后省略的条数
+	std::atomic<uint64> lastLogMS_;
+	std::atomic<uint64> suppressed_;
+};
+
+}
+
+#endif // X_ACCEPT_FILTER_H
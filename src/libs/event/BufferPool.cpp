@@ -0,0 +1,242 @@
+#include "BufferPool.h"
+#include "log/XLog.h"
+
+namespace XServer {
+
+uint32 BufferPool::chunkSize_ = 0;
+
+//-------------------------------------------------------------------------------------
+namespace {
+
+	struct GlobalPool
+	{
+		GlobalPool():
+		maxChunks(0),
+		allocated(0),
+		inUse(0),
+		highWater(0),
+		acquires(0),
+		exhausted(0)
+		{
+		}
+
+		std::mutex mutex;
+		std::vector<uint8*> chunks;
+		uint32 maxChunks;
+
+		std::atomic<uint64> allocated;
+		std::atomic<uint64> inUse;
+		std::atomic<uint64> highWater;
+		std::atomic<uint64> acquires;
+		std::atomic<uint64> exhausted;
+	};
+
+	GlobalPool& globalPool()
+	{
+		static GlobalPool pool;
+		return pool;
+	}
+
+	// 线程退出时缓存的块放回全局链表
+	struct ThreadCache
+	{
+		~ThreadCache()
+		{
+			if (chunks.empty())
+				return;
+
+			GlobalPool& pool = globalPool();
+			std::lock_guard<std::mutex> lock(pool.mutex);
+			pool.chunks.insert(pool.chunks.end(), chunks.begin(), chunks.end());
+		}
+
+		std::vector<uint8*> chunks;
+	};
+
+	ThreadCache& threadCache()
+	{
+		static thread_local ThreadCache cache;
+		return cache;
+	}
+
+}
+
+//-------------------------------------------------------------------------------------
+void BufferPool::setup(uint32 chunkSize, uint32 maxChunks)
+{
+	// 块的大小取对齐的整数倍
+	chunkSize_ = (chunkSize + CHUNK_ALIGN - 1) / CHUNK_ALIGN * CHUNK_ALIGN;
+	globalPool().maxChunks = maxChunks;
+
+	if (chunkSize_ > 0)
+	{
+		INFO_MSG(fmt::format("BufferPool::setup(): chunkSize={}, maxChunks={}, copyThreshold={}\n",
+			chunkSize_, maxChunks, copyThreshold()));
+	}
+}
+
+//-------------------------------------------------------------------------------------
+uint8* BufferPool::acquire()
+{
+	if (chunkSize_ == 0)
+		return NULL;
+
+	GlobalPool& pool = globalPool();
+	std::vector<uint8*>& cache = threadCache().chunks;
+
+	if (cache.empty())
+	{
+		std::lock_guard<std::mutex> lock(pool.mutex);
+
+		size_t n = std::min<size_t>(pool.chunks.size(), THREAD_CACHE_MAX / 2);
+		cache.insert(cache.end(), pool.chunks.end() - n, pool.chunks.end());
+		pool.chunks.resize(pool.chunks.size() - n);
+	}
+
+	uint8* pChunk = NULL;
+
+	if (!cache.empty())
+	{
+		pChunk = cache.back();
+		cache.pop_back();
+	}
+	else
+	{
+		// 多个循环可能同时申请， 先占住一个名额再分配， 保证总数不超过maxChunks
+		uint64 allocated = pool.allocated;
+		do
+		{
+			if (pool.maxChunks > 0 && allocated >= pool.maxChunks)
+			{
+				++pool.exhausted;
+				return NULL;
+			}
+		} while (!pool.allocated.compare_exchange_weak(allocated, allocated + 1));
+
+		pChunk = (uint8*)::operator new(chunkSize_ + CHUNK_ALIGN);
+		pChunk = (uint8*)(((uintptr_t)pChunk + CHUNK_ALIGN - 1) & ~(uintptr_t)(CHUNK_ALIGN - 1));
+	}
+
+	++pool.acquires;
+
+	uint64 inUse = ++pool.inUse;
+	uint64 highWater = pool.highWater;
+	while (inUse > highWater && !pool.highWater.compare_exchange_weak(highWater, inUse))
+		;
+
+	return pChunk;
+}
+
+//-------------------------------------------------------------------------------------
+void BufferPool::release(uint8* pChunk)
+{
+	if (!pChunk)
+		return;
+
+	GlobalPool& pool = globalPool();
+	--pool.inUse;
+
+	// 可能在别的线程释放(例如evbuffer在循环之间移动)， 放入当前线程的缓存
+	std::vector<uint8*>& cache = threadCache().chunks;
+	cache.push_back(pChunk);
+
+	if (cache.size() > THREAD_CACHE_MAX)
+	{
+		std::lock_guard<std::mutex> lock(pool.mutex);
+
+		size_t n = THREAD_CACHE_MAX / 2;
+		pool.chunks.insert(pool.chunks.end(), cache.end() - n, cache.end());
+		cache.resize(cache.size() - n);
+	}
+}
+
+//-------------------------------------------------------------------------------------
+void BufferPool::releaseCallback(const void* data, size_t datalen, void* extra)
+{
+	release((uint8*)extra);
+}
+
+//-------------------------------------------------------------------------------------
+bool BufferPool::addChunk(struct evbuffer* pBuffer, uint8* pChunk, uint32 size)
+{
+	// 失败时evbuffer不会回调cleanup
+	if (evbuffer_add_reference(pBuffer, pChunk, size, releaseCallback, pChunk) != 0)
+	{
+		release(pChunk);
+		return false;
+	}
+
+	return true;
+}
+
+//-------------------------------------------------------------------------------------
+bool BufferPool::add(struct evbuffer* pBuffer, const uint8* data, uint32 size)
+{
+	while (size >= copyThreshold() && chunkSize_ > 0)
+	{
+		uint8* pChunk = acquire();
+		if (!pChunk)
+			break;
+
+		uint32 n = std::min(size, chunkSize_);
+		memcpy(pChunk, data, n);
+
+		if (!addChunk(pBuffer, pChunk, n))
+			return false;
+
+		data += n;
+		size -= n;
+	}
+
+	if (size == 0)
+		return true;
+
+	// evbuffer_add在引用的块之后会按前一块的两倍申请， 预留空间只按需要的长度申请
+	struct evbuffer_iovec vec;
+	if (evbuffer_reserve_space(pBuffer, size, &vec, 1) != 1)
+		return false;
+
+	memcpy(vec.iov_base, data, size);
+	vec.iov_len = size;
+	return evbuffer_commit_space(pBuffer, &vec, 1) == 0;
+}
+
+//-------------------------------------------------------------------------------------
+uint64 BufferPool::allocated()
+{
+	return globalPool().allocated;
+}
+
+//-------------------------------------------------------------------------------------
+uint64 BufferPool::inUse()
+{
+	return globalPool().inUse;
+}
+
+//-------------------------------------------------------------------------------------
+uint64 BufferPool::highWater()
+{
+	return globalPool().highWater;
+}
+
+//-------------------------------------------------------------------------------------
+uint64 BufferPool::acquires()
+{
+	return globalPool().acquires;
+}
+
+//-------------------------------------------------------------------------------------
+uint64 BufferPool::exhausted()
+{
+	return globalPool().exhausted;
+}
+
+//-------------------------------------------------------------------------------------
+std::string BufferPool::info()
+{
+	return fmt::format("chunkSize={}, allocated={}({}KB), inUse={}, highWater={}, acquires={}, exhausted={}",
+		chunkSize_, allocated(), allocated() * chunkSize_ / 1024, inUse(), highWater(), acquires(), exhausted());
+}
+
+//-------------------------------------------------------------------------------------
+}
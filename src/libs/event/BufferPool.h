@@ -0,0 +1,70 @@
+#ifndef X_BUFFER_POOL_H
+#define X_BUFFER_POOL_H
+
+#include "common/common.h"
+
+namespace XServer {
+
+/*
+	socket收发缓冲区使用的固定大小内存块， 整个进程共用一个池
+	块按64字节对齐， 每个线程缓存一部分空闲块， 多出的放回全局链表； 内存块只在池中复用， 不会归还给系统
+	数据写入块之后通过evbuffer_add_reference交给evbuffer， evbuffer释放这段数据时回调放回池中
+	很短的数据仍然复制到evbuffer自己的内存中， 不为几十个字节占用一整块
+*/
+class BufferPool
+{
+public:
+	enum
+	{
+		CHUNK_ALIGN = 64,
+
+		// 每个线程最多缓存的空闲块数， 一次从全局链表取回或放回一半
+		THREAD_CACHE_MAX = 64,
+	};
+
+	// 创建事件循环之前调用， chunkSize为0时不使用内存池， maxChunks为最多向系统申请的块数
+	static void setup(uint32 chunkSize, uint32 maxChunks);
+
+	static bool enabled() {
+		return chunkSize_ > 0;
+	}
+
+	static uint32 chunkSize() {
+		return chunkSize_;
+	}
+
+	// 短于这个长度的数据直接复制到evbuffer中
+	static uint32 copyThreshold() {
+		return chunkSize_ / 8;
+	}
+
+	// 池已满时返回NULL， 调用者改用evbuffer自己的内存
+	static uint8* acquire();
+	static void release(uint8* pChunk);
+
+	// 按引用把块中的size字节追加到pBuffer， 之后块归evbuffer所有； 失败时块已放回池中
+	static bool addChunk(struct evbuffer* pBuffer, uint8* pChunk, uint32 size);
+
+	// 把data追加到pBuffer， 足够长时复制到池中的块里按引用追加
+	static bool add(struct evbuffer* pBuffer, const uint8* data, uint32 size);
+
+	// 向系统申请的块数， 正在使用的块数和它的历史最大值
+	static uint64 allocated();
+	static uint64 inUse();
+	static uint64 highWater();
+
+	// 从池中取到块的次数， 池已满而改用evbuffer内存的次数
+	static uint64 acquires();
+	static uint64 exhausted();
+
+	static std::string info();
+
+private:
+	static void releaseCallback(const void* data, size_t datalen, void* extra);
+
+	static uint32 chunkSize_;
+};
+
+}
+
+#endif // X_BUFFER_POOL_H
@@ -0,0 +1,178 @@
+#include "EvbufferStream.h"
+
+namespace XServer {
+
+//-------------------------------------------------------------------------------------
+EvbufferInputStream::EvbufferInputStream(struct evbuffer* pBuffer, size_t offset, size_t size):
+moreVecs_(),
+pVecs_(vecs_),
+numVecs_(0),
+currVec_(0),
+currOffset_(0),
+remaining_(size),
+byteCount_(0)
+{
+	struct evbuffer_ptr pos;
+	if (!pBuffer || evbuffer_ptr_set(pBuffer, &pos, offset, EVBUFFER_PTR_SET) != 0)
+	{
+		remaining_ = 0;
+		return;
+	}
+
+	numVecs_ = evbuffer_peek(pBuffer, size, &pos, vecs_, VECS_MAX);
+
+	// 大包跨越的内存块较多时才使用堆上的数组
+	if (numVecs_ > VECS_MAX)
+	{
+		moreVecs_.resize(numVecs_);
+		pVecs_ = &moreVecs_[0];
+		numVecs_ = evbuffer_peek(pBuffer, size, &pos, pVecs_, numVecs_);
+	}
+
+	if (numVecs_ < 0)
+	{
+		numVecs_ = 0;
+		remaining_ = 0;
+	}
+}
+
+//-------------------------------------------------------------------------------------
+EvbufferInputStream::~EvbufferInputStream()
+{
+}
+
+//-------------------------------------------------------------------------------------
+bool EvbufferInputStream::Next(const void** data, int* size)
+{
+	while (remaining_ > 0 && currVec_ < numVecs_)
+	{
+		struct evbuffer_iovec& vec = pVecs_[currVec_];
+
+		size_t avail = vec.iov_len - currOffset_;
+		if (avail == 0)
+		{
+			++currVec_;
+			currOffset_ = 0;
+			continue;
+		}
+
+		// 最后一个内存块可能超出了包的范围
+		if (avail > remaining_)
+			avail = remaining_;
+
+		*data = (const uint8*)vec.iov_base + currOffset_;
+		*size = (int)avail;
+
+		currOffset_ += avail;
+		remaining_ -= avail;
+		byteCount_ += avail;
+		return true;
+	}
+
+	return false;
+}
+
+//-------------------------------------------------------------------------------------
+void EvbufferInputStream::BackUp(int count)
+{
+	assert(count >= 0 && (size_t)count <= currOffset_);
+
+	currOffset_ -= count;
+	remaining_ += count;
+	byteCount_ -= count;
+}
+
+//-------------------------------------------------------------------------------------
+bool EvbufferInputStream::Skip(int count)
+{
+	const void* data = NULL;
+	int size = 0;
+
+	while (count > 0)
+	{
+		if (!Next(&data, &size))
+			return false;
+
+		if (size > count)
+		{
+			BackUp(size - count);
+			return true;
+		}
+
+		count -= size;
+	}
+
+	return true;
+}
+
+//-------------------------------------------------------------------------------------
+::google::protobuf::int64 EvbufferInputStream::ByteCount() const
+{
+	return byteCount_;
+}
+
+//-------------------------------------------------------------------------------------
+EvbufferOutputStream::EvbufferOutputStream(struct evbuffer* pBuffer, size_t blockSize):
+pBuffer_(pBuffer),
+blockSize_(blockSize),
+vec_(),
+reserved_(false),
+byteCount_(0)
+{
+}
+
+//-------------------------------------------------------------------------------------
+EvbufferOutputStream::~EvbufferOutputStream()
+{
+	Flush();
+}
+
+//-------------------------------------------------------------------------------------
+bool EvbufferOutputStream::Flush()
+{
+	if (!reserved_)
+		return true;
+
+	reserved_ = false;
+	return evbuffer_commit_space(pBuffer_, &vec_, 1) == 0;
+}
+
+//-------------------------------------------------------------------------------------
+bool EvbufferOutputStream::Next(void** data, int* size)
+{
+	if (!Flush())
+		return false;
+
+	if (evbuffer_reserve_space(pBuffer_, blockSize_, &vec_, 1) != 1)
+		return false;
+
+	// 预留的空间可能比要求的大， 全部交给调用者
+	if (vec_.iov_len > (size_t)std::numeric_limits<int>::max())
+		vec_.iov_len = std::numeric_limits<int>::max();
+
+	reserved_ = true;
+
+	*data = vec_.iov_base;
+	*size = (int)vec_.iov_len;
+	byteCount_ += vec_.iov_len;
+	return true;
+}
+
+//-------------------------------------------------------------------------------------
+void EvbufferOutputStream::BackUp(int count)
+{
+	if (!reserved_)
+		return;
+
+	vec_.iov_len -= count;
+	byteCount_ -= count;
+}
+
+//-------------------------------------------------------------------------------------
+::google::protobuf::int64 EvbufferOutputStream::ByteCount() const
+{
+	return byteCount_;
+}
+
+//-------------------------------------------------------------------------------------
+}
@@ -0,0 +1,67 @@
+#ifndef X_EVBUFFER_STREAM_H
+#define X_EVBUFFER_STREAM_H
+
+#include "common/common.h"
+#include <google/protobuf/io/zero_copy_stream.h>
+
+namespace XServer {
+
+/*
+	直接在evbuffer的内存块上读取一段数据， 供protobuf解析使用， 不做任何拷贝
+	数据必须在流的生命周期内保持在evbuffer中(不能drain)
+*/
+class EvbufferInputStream : public ::google::protobuf::io::ZeroCopyInputStream
+{
+public:
+	EvbufferInputStream(struct evbuffer* pBuffer, size_t offset, size_t size);
+	virtual ~EvbufferInputStream();
+
+	virtual bool Next(const void** data, int* size) override;
+	virtual void BackUp(int count) override;
+	virtual bool Skip(int count) override;
+	virtual ::google::protobuf::int64 ByteCount() const override;
+
+private:
+	enum { VECS_MAX = 16 };
+
+	struct evbuffer_iovec vecs_[VECS_MAX];
+	std::vector<struct evbuffer_iovec> moreVecs_;
+	struct evbuffer_iovec* pVecs_;
+
+	int numVecs_;
+	int currVec_;
+	size_t currOffset_;
+
+	size_t remaining_;
+	int64 byteCount_;
+};
+
+/*
+	直接序列化到evbuffer预留的内存块中， 每次预留blockSize大小， 不需要整块的连续内存
+	析构或Flush()时提交最后一块
+*/
+class EvbufferOutputStream : public ::google::protobuf::io::ZeroCopyOutputStream
+{
+public:
+	EvbufferOutputStream(struct evbuffer* pBuffer, size_t blockSize);
+	virtual ~EvbufferOutputStream();
+
+	virtual bool Next(void** data, int* size) override;
+	virtual void BackUp(int count) override;
+	virtual ::google::protobuf::int64 ByteCount() const override;
+
+	bool Flush();
+
+private:
+	struct evbuffer* pBuffer_;
+	size_t blockSize_;
+
+	struct evbuffer_iovec vec_;
+	bool reserved_;
+
+	int64 byteCount_;
+};
+
+}
+
+#endif // X_EVBUFFER_STREAM_H
@@ -1,11 +1,27 @@
 #include "EventDispatcher.h"
+#include "IoUring.h"
 #include "log/XLog.h"
 
+#include <event2/thread.h>
+
 namespace XServer {
 
+bool EventDispatcher::threadsEnabled_ = false;
+
 //-------------------------------------------------------------------------------------
 EventDispatcher::EventDispatcher():
-	base_(NULL)
+	base_(NULL),
+	threadID_(std::this_thread::get_id()),
+	tasksMutex_(),
+	tasks_(),
+	pTaskEvent_(NULL),
+	pIoUring_(NULL),
+	priorities_(false),
+	edgeTriggered_(false),
+	pProbeTimer_(NULL),
+	pProbes_(),
+	probeTimeUs_(),
+	priorityWaits_()
 {
 }
 
@@ -21,27 +37,145 @@ EventDispatcher::~EventDispatcher()
 	}
 }
 
+//-------------------------------------------------------------------------------------
+bool EventDispatcher::enableThreads()
+{
+	if (threadsEnabled_)
+		return true;
+
+#if X_PLATFORM == PLATFORM_WIN32
+	threadsEnabled_ = evthread_use_windows_threads() == 0;
+#else
+	threadsEnabled_ = evthread_use_pthreads() == 0;
+#endif
+
+	if (!threadsEnabled_)
+		ERROR_MSG(fmt::format("EventDispatcher::enableThreads(): libevent threading support is not available!\n"));
+
+	return threadsEnabled_;
+}
+
 //-------------------------------------------------------------------------------------		
-bool EventDispatcher::initialize()
+bool EventDispatcher::initialize(const LoopConfig& config)
 {
-	base_ = event_base_new();
+	if (config.noLock && threadsEnabled_)
+		WARNING_MSG(fmt::format("EventDispatcher::initialize(): eventNoLock is ignored, the event loops post tasks to each other!\n"));
+
+	struct event_config* pConfig = config.build(threadsEnabled_);
+	if (pConfig)
+	{
+		base_ = event_base_new_with_config(pConfig);
+		event_config_free(pConfig);
+	}
+
+	if (!base_) {
+		WARNING_MSG(fmt::format("EventDispatcher::initialize(): Could not create event_base with config({}), using the default!\n",
+			config.info()));
+
+		base_ = event_base_new();
+	}
+
 	if (!base_) {
 		ERROR_MSG(fmt::format("EventDispatcher::initialize(): Could not initialize libevent!\n"));
 		return false;
 	}
 
+	edgeTriggered_ = config.edgeTriggered && (event_base_get_features(base_) & EV_FEATURE_ET) != 0;
+
+	// 必须在添加任何事件之前设置
+	priorities_ = event_base_priority_init(base_, EVENT_PRIORITY_MAX) == 0;
+	if (!priorities_)
+		WARNING_MSG(fmt::format("EventDispatcher::initialize(): event priorities are not available, all events share one queue!\n"));
+
+	pTaskEvent_ = event_new(base_, -1, 0, taskCallback, this);
+	if (!pTaskEvent_) {
+		ERROR_MSG(fmt::format("EventDispatcher::initialize(): Could not create the task event!\n"));
+		return false;
+	}
+
+	// 跨循环的任务大多是服务器之间的转发， 和服务器的连接同级
+	setPriority(pTaskEvent_, EVENT_PRIORITY_INTERNAL);
+
+	if (!priorities_)
+		return true;
+
+	for (int i = 0; i < EVENT_PRIORITY_MAX; ++i)
+	{
+		pProbes_[i] = event_new(base_, -1, 0, probeCallback, this);
+		if (!pProbes_[i] || !setPriority(pProbes_[i], i))
+		{
+			ERROR_MSG(fmt::format("EventDispatcher::initialize(): Could not create the probe event!\n"));
+			return false;
+		}
+	}
+
+	pProbeTimer_ = event_new(base_, -1, EV_PERSIST, probeTimerCallback, this);
+	setPriority(pProbeTimer_, EVENT_PRIORITY_INTERNAL);
+
+	struct timeval tv;
+	tv.tv_sec = PROBE_INTERVAL_MS / 1000;
+	tv.tv_usec = PROBE_INTERVAL_MS % 1000 * 1000;
+
+	if (!pProbeTimer_ || event_add(pProbeTimer_, &tv) != 0) {
+		ERROR_MSG(fmt::format("EventDispatcher::initialize(): Could not create the probe timer!\n"));
+		return false;
+	}
+
 	return true;
 }
 
 //-------------------------------------------------------------------------------------
 void EventDispatcher::finalise(void)
 {
+	SAFE_RELEASE(pIoUring_);
+
+	if (pTaskEvent_)
+	{
+		event_free(pTaskEvent_);
+		pTaskEvent_ = NULL;
+	}
+
+	if (pProbeTimer_)
+	{
+		event_free(pProbeTimer_);
+		pProbeTimer_ = NULL;
+	}
+
+	for (int i = 0; i < EVENT_PRIORITY_MAX; ++i)
+	{
+		if (pProbes_[i])
+		{
+			event_free(pProbes_[i]);
+			pProbes_[i] = NULL;
+		}
+	}
+
+	std::lock_guard<std::mutex> lock(tasksMutex_);
+	tasks_.clear();
 }
 
 //-------------------------------------------------------------------------------------
-bool EventDispatcher::dispatch()
+bool EventDispatcher::enableIoUring(uint32 entries, uint32 bufferCount, uint32 bufferSize)
 {
-	return event_base_dispatch(base_) == 0;
+	// 内部和外部网络共用主循环时只创建一次
+	if (pIoUring_)
+		return true;
+
+	pIoUring_ = new IoUring(this);
+	if (!pIoUring_->initialize(entries, bufferCount, bufferSize))
+	{
+		SAFE_RELEASE(pIoUring_);
+		return false;
+	}
+
+	return true;
+}
+
+//-------------------------------------------------------------------------------------
+bool EventDispatcher::dispatch(int flags)
+{
+	threadID_ = std::this_thread::get_id();
+	return event_base_loop(base_, flags) == 0;
 }
 
 //-------------------------------------------------------------------------------------
@@ -61,6 +195,173 @@ bool EventDispatcher::exitDispatch(float secs)
 	return event_base_loopexit(base_, &ten_sec) == 0;
 }
 
+//-------------------------------------------------------------------------------------
+void EventDispatcher::post(const Task& task)
+{
+	bool wakeup = false;
+
+	{
+		std::lock_guard<std::mutex> lock(tasksMutex_);
+		wakeup = tasks_.empty();
+		tasks_.push_back(task);
+	}
+
+	// 队列由空变为非空时才需要唤醒， 其他情况唤醒已经在路上了
+	if (wakeup && pTaskEvent_)
+		event_active(pTaskEvent_, EV_READ, 0);
+}
+
+//-------------------------------------------------------------------------------------
+void EventDispatcher::runInLoop(const Task& task)
+{
+	if (isInLoopThread())
+	{
+		task();
+		return;
+	}
+
+	post(task);
+}
+
+//-------------------------------------------------------------------------------------
+void EventDispatcher::taskCallback(evutil_socket_t fd, short events, void *ctx)
+{
+	EventDispatcher* pEventDispatcher = (EventDispatcher*)ctx;
+	pEventDispatcher->onTasks();
+}
+
+//-------------------------------------------------------------------------------------
+void EventDispatcher::onTasks()
+{
+	std::vector<Task> tasks;
+
+	{
+		std::lock_guard<std::mutex> lock(tasksMutex_);
+		tasks.swap(tasks_);
+	}
+
+	for (auto& task : tasks)
+		task();
+}
+
+//-------------------------------------------------------------------------------------
+bool EventDispatcher::setPriority(struct event* ev, int priority)
+{
+	if (!ev || !priorities_)
+		return false;
+
+	return event_priority_set(ev, std::min<int>(std::max<int>(priority, 0), EVENT_PRIORITY_MAX - 1)) == 0;
+}
+
+//-------------------------------------------------------------------------------------
+int EventDispatcher::runningPriority(int defaultPriority)
+{
+	struct event* pRunning = event_base_get_running_event(base_);
+	return pRunning ? event_get_priority(pRunning) : defaultPriority;
+}
+
+//-------------------------------------------------------------------------------------
+uint64 EventDispatcher::monotonicUs()
+{
+	return (uint64)std::chrono::duration_cast<std::chrono::microseconds>(
+		std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+//-------------------------------------------------------------------------------------
+void EventDispatcher::probeTimerCallback(evutil_socket_t fd, short events, void *ctx)
+{
+	EventDispatcher* pEventDispatcher = (EventDispatcher*)ctx;
+	uint64 now = monotonicUs();
+
+	// 上一次的探测还没有被处理时不重新计时， 等待时间从它被激活时算起
+	for (int i = 0; i < EVENT_PRIORITY_MAX; ++i)
+	{
+		struct event* pProbe = pEventDispatcher->pProbes_[i];
+		if (event_pending(pProbe, EV_TIMEOUT | EV_READ | EV_WRITE | EV_SIGNAL, NULL))
+			continue;
+
+		pEventDispatcher->probeTimeUs_[i] = now;
+		event_active(pProbe, EV_READ, 0);
+	}
+}
+
+//-------------------------------------------------------------------------------------
+void EventDispatcher::probeCallback(evutil_socket_t fd, short events, void *ctx)
+{
+	EventDispatcher* pEventDispatcher = (EventDispatcher*)ctx;
+	pEventDispatcher->onProbe(pEventDispatcher->runningPriority(EVENT_PRIORITY_INTERNAL));
+}
+
+//-------------------------------------------------------------------------------------
+void EventDispatcher::onProbe(int priority)
+{
+	uint64 now = monotonicUs();
+	uint64 waitUs = now - probeTimeUs_[priority];
+
+	PriorityWait& wait = priorityWaits_[priority];
+	++wait.samples;
+	wait.totalUs += waitUs;
+
+	// 只在所属循环中写入
+	if (waitUs > wait.maxUs)
+		wait.maxUs = waitUs;
+
+	if (waitUs >= PROBE_WARNING_MS * 1000 && now / 1000 >= wait.lastWarningMs + 10000)
+	{
+		wait.lastWarningMs = now / 1000;
+
+		WARNING_MSG(fmt::format("EventDispatcher::onProbe(): events of priority {} waited {}ms to run, the loop is overloaded! {}\n",
+			priority, waitUs / 1000, priorityWaitInfo()));
+	}
+}
+
+//-------------------------------------------------------------------------------------
+std::string EventDispatcher::backendInfo() const
+{
+	if (!base_)
+		return "none";
+
+	int features = event_base_get_features(base_);
+
+	std::string info;
+	if (features & EV_FEATURE_ET)
+		info += "|ET";
+	if (features & EV_FEATURE_O1)
+		info += "|O1";
+	if (features & EV_FEATURE_FDS)
+		info += "|FDS";
+	if (features & EV_FEATURE_EARLY_CLOSE)
+		info += "|EARLY_CLOSE";
+
+	return fmt::format("{}(features={}, edgeTriggered={})", event_base_get_method(base_),
+		info.size() > 0 ? info.substr(1) : "none", edgeTriggered_);
+}
+
+//-------------------------------------------------------------------------------------
+std::string EventDispatcher::priorityWaitInfo() const
+{
+	static const char* names[EVENT_PRIORITY_MAX] = { "internal", "timer", "external" };
+
+	if (!priorities_)
+		return "disabled";
+
+	std::string info;
+
+	for (int i = 0; i < EVENT_PRIORITY_MAX; ++i)
+	{
+		const PriorityWait& wait = priorityWaits_[i];
+		uint64 samples = wait.samples;
+
+		if (i > 0)
+			info += ", ";
+
+		info += fmt::format("{}(samples={}, avg={}us, max={}us)", names[i], samples,
+			samples > 0 ? wait.totalUs / samples : 0, (uint64)wait.maxUs);
+	}
+
+	return info;
+}
+
 //-------------------------------------------------------------------------------------
 struct event * EventDispatcher::add_watch_signal(int signal, event_callback_fn signal_cb, void* cbargs)
 {
@@ -2,19 +2,65 @@
 #define X_EVENT_DISPATCHER_H
 
 #include "common/common.h"
+#include "LoopConfig.h"
 
 namespace XServer {
 
+class IoUring;
+
+/*
+	事件的优先级， 数值小的先处理
+	libevent每轮只处理已就绪的最高一级， 低一级的事件要等到某一轮没有更高级的事件就绪时才处理
+	没有指定优先级的事件(listener、 信号)为EVENT_PRIORITY_TIMER
+*/
+enum EventPriority
+{
+	EVENT_PRIORITY_INTERNAL = 0,	// 服务器之间的连接、 共享内存、 跨循环的任务、 服务器连接的时间轮
+	EVENT_PRIORITY_TIMER = 1,		// 逻辑定时器
+	EVENT_PRIORITY_EXTERNAL = 2,	// 客户端的连接和它们的时间轮
+	EVENT_PRIORITY_MAX = 3
+};
+
 class EventDispatcher
 {
+public:
+	typedef std::function<void()> Task;
+
+	enum
+	{
+		// 每隔这么久在各优先级上激活一个探测事件， 记录它等了多久才被处理
+		PROBE_INTERVAL_MS = 100,
+
+		// 等待超过该值时输出警告， 每个优先级每10秒最多一条
+		PROBE_WARNING_MS = 200
+	};
+
+	// 一个优先级上事件从就绪到被处理的等待时间
+	struct PriorityWait
+	{
+		PriorityWait():
+		samples(0),
+		totalUs(0),
+		maxUs(0),
+		lastWarningMs(0)
+		{
+		}
+
+		std::atomic<uint64> samples;
+		std::atomic<uint64> totalUs;
+		std::atomic<uint64> maxUs;
+		uint64 lastWarningMs;
+	};
+
 public:
 	EventDispatcher();
 	virtual ~EventDispatcher();
 
-	bool initialize();
+	// 要求的后端或特性不可用时退回event_base_new()
+	bool initialize(const LoopConfig& config = LoopConfig());
 	void finalise();
 
-	bool dispatch();
+	bool dispatch(int flags = 0);
 	bool breakDispatch();
 
 	bool exitDispatch(float secs = 1.0f);
@@ -26,8 +72,83 @@ public:
 	struct event * add_watch_signal(int signal, event_callback_fn signal_cb, void* cbargs);
 	bool del_watch_signal(struct event * ev);
 
+	// 在该循环上创建io_uring， 之后创建的TcpSocket都由它收发， 必须在循环线程开始之前调用
+	bool enableIoUring(uint32 entries, uint32 bufferCount, uint32 bufferSize);
+
+	IoUring* pIoUring() {
+		return pIoUring_;
+	}
+
+	// 给已经创建、 尚未激活的事件设置优先级
+	bool setPriority(struct event* ev, int priority);
+
+	// 当前正在执行的事件的优先级， 不在事件回调中时返回defaultPriority
+	int runningPriority(int defaultPriority);
+
+	const PriorityWait& priorityWait(int priority) const {
+		return priorityWaits_[priority];
+	}
+
+	// 读事件可以使用边缘触发
+	bool edgeTriggered() const {
+		return edgeTriggered_;
+	}
+
+	// 实际使用的后端和它支持的特性
+	std::string backendInfo() const;
+
+	// 各优先级的平均和最大等待时间
+	std::string priorityWaitInfo() const;
+
+	// 多个事件循环跨线程投递任务之前必须先开启libevent的锁支持，且要在创建任何event_base之前调用
+	static bool enableThreads();
+
+	static bool threadsEnabled() {
+		return threadsEnabled_;
+	}
+
+	bool isInLoopThread() const {
+		return threadID_ == std::this_thread::get_id();
+	}
+
+	// 将任务投递到该循环所在线程执行， 可在任意线程调用
+	void post(const Task& task);
+
+	// 如果当前就在该循环的线程中则直接执行， 否则投递
+	void runInLoop(const Task& task);
+
+private:
+	static void taskCallback(evutil_socket_t fd, short events, void *ctx);
+	void onTasks();
+
+	static void probeTimerCallback(evutil_socket_t fd, short events, void *ctx);
+	static void probeCallback(evutil_socket_t fd, short events, void *ctx);
+	void onProbe(int priority);
+
+	static uint64 monotonicUs();
+
 protected:
 	struct event_base *base_;
+
+	std::thread::id threadID_;
+
+	std::mutex tasksMutex_;
+	std::vector<Task> tasks_;
+	struct event * pTaskEvent_;
+
+	IoUring* pIoUring_;
+
+	bool priorities_;
+
+	bool edgeTriggered_;
+
+	static bool threadsEnabled_;
+
+	// 定时在各优先级上激活探测事件， probeTimeUs_为各自激活的时间
+	struct event * pProbeTimer_;
+	struct event * pProbes_[EVENT_PRIORITY_MAX];
+	uint64 probeTimeUs_[EVENT_PRIORITY_MAX];
+	PriorityWait priorityWaits_[EVENT_PRIORITY_MAX];
 };
 
 }
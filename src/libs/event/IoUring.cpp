@@ -0,0 +1,964 @@
+#include "IoUring.h"
+#include "EventDispatcher.h"
+#include "BufferPool.h"
+#include "log/XLog.h"
+
+#ifdef __linux__
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <sys/uio.h>
+#include <sys/utsname.h>
+#endif
+
+namespace XServer {
+
+#ifdef __linux__
+
+namespace {
+
+	// 一次sendmsg最多带的缓冲区块数和字节数， 剩下的等这次完成后再提交
+	const int SEND_IOV_MAX = 64;
+	const uint32 SEND_BYTES_MAX = 1024 * 1024;
+
+	const uint16 BUFFER_GROUP = 0;
+	const uint32 BUFFER_COUNT_MAX = 32768;
+
+	int uringSetup(uint32 entries, struct io_uring_params* pParams)
+	{
+		return (int)syscall(__NR_io_uring_setup, entries, pParams);
+	}
+
+	int uringEnter(int fd, uint32 toSubmit, uint32 minComplete, uint32 flags)
+	{
+		return (int)syscall(__NR_io_uring_enter, fd, toSubmit, minComplete, flags, NULL, 0);
+	}
+
+	int uringRegister(int fd, uint32 opcode, void* arg, uint32 nr)
+	{
+		return (int)syscall(__NR_io_uring_register, fd, opcode, arg, nr);
+	}
+
+	// multishot recv从6.0开始支持， 之前的内核会直接返回EINVAL
+	bool kernelSupported(std::string& release)
+	{
+		struct utsname name;
+		if (uname(&name) != 0)
+			return false;
+
+		release = name.release;
+
+		int major = 0, minor = 0;
+		if (sscanf(name.release, "%d.%d", &major, &minor) != 2)
+			return false;
+
+		return major >= 6;
+	}
+
+}
+
+// 发送中的数据从bufferevent的发送缓冲区移到这里， 内核返回之前不会被改动
+struct UringSocket::SendOp : public IoUring::Op
+{
+	SendOp(void* arg):
+	Op(&UringSocket::sendCallback, arg),
+	pData(evbuffer_new()),
+	msg()
+	{
+	}
+
+	virtual ~SendOp()
+	{
+		evbuffer_free(pData);
+	}
+
+	struct evbuffer* pData;
+	struct evbuffer_iovec iov[SEND_IOV_MAX];
+	struct msghdr msg;
+};
+
+struct UringSocket::ConnectOp : public IoUring::Op
+{
+	ConnectOp(void* arg):
+	Op(&UringSocket::connectCallback, arg),
+	addr(),
+	len(0)
+	{
+	}
+
+	struct sockaddr_storage addr;
+	socklen_t len;
+};
+
+//-------------------------------------------------------------------------------------
+IoUring::IoUring(EventDispatcher* pEventDispatcher):
+pEventDispatcher_(pEventDispatcher),
+fd_(-1),
+pRing_(NULL),
+ringSize_(0),
+pSqes_(NULL),
+sqesSize_(0),
+pSqHead_(NULL),
+pSqTail_(NULL),
+pSqFlags_(NULL),
+sqMask_(0),
+sqEntries_(0),
+sqTail_(0),
+pCqHead_(NULL),
+pCqTail_(NULL),
+cqMask_(0),
+pCqes_(NULL),
+pBufRing_(NULL),
+bufRingSize_(0),
+pBuffers_(NULL),
+bufferCount_(0),
+bufferSize_(0),
+bufTail_(0),
+pCompletionEvent_(NULL),
+pSubmitEvent_(NULL),
+submitActive_(false),
+sendSockets_(),
+orphans_(),
+stats_()
+{
+}
+
+//-------------------------------------------------------------------------------------
+IoUring::~IoUring()
+{
+	finalise();
+}
+
+//-------------------------------------------------------------------------------------
+bool IoUring::initialize(uint32 entries, uint32 bufferCount, uint32 bufferSize)
+{
+	std::string release;
+	if (!kernelSupported(release))
+	{
+		ERROR_MSG(fmt::format("IoUring::initialize(): multishot accept/recv need linux 6.0 or later, kernel={}\n", release));
+		return false;
+	}
+
+	struct io_uring_params params;
+	memset(&params, 0, sizeof(params));
+
+	// 前面的请求出错时也继续提交后面的， 各自在完成事件中报告
+	params.flags = IORING_SETUP_SUBMIT_ALL;
+
+	fd_ = uringSetup(entries, &params);
+	if (fd_ < 0)
+	{
+		ERROR_MSG(fmt::format("IoUring::initialize(): io_uring_setup({}) error: {}\n", entries, strerror(errno)));
+		return false;
+	}
+
+	if (!(params.features & IORING_FEAT_SINGLE_MMAP) || !(params.features & IORING_FEAT_NODROP))
+	{
+		ERROR_MSG(fmt::format("IoUring::initialize(): unsupported features({:#x})!\n", params.features));
+		finalise();
+		return false;
+	}
+
+	ringSize_ = std::max<size_t>(params.sq_off.array + params.sq_entries * sizeof(uint32),
+		params.cq_off.cqes + params.cq_entries * sizeof(struct io_uring_cqe));
+
+	void* pRing = mmap(NULL, ringSize_, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd_, IORING_OFF_SQ_RING);
+	if (pRing == MAP_FAILED)
+	{
+		ERROR_MSG(fmt::format("IoUring::initialize(): mmap rings error: {}\n", strerror(errno)));
+		finalise();
+		return false;
+	}
+
+	pRing_ = (uint8*)pRing;
+
+	sqesSize_ = params.sq_entries * sizeof(struct io_uring_sqe);
+	void* pSqes = mmap(NULL, sqesSize_, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd_, IORING_OFF_SQES);
+	if (pSqes == MAP_FAILED)
+	{
+		ERROR_MSG(fmt::format("IoUring::initialize(): mmap sqes error: {}\n", strerror(errno)));
+		finalise();
+		return false;
+	}
+
+	pSqes_ = (struct io_uring_sqe*)pSqes;
+
+	pSqHead_ = (uint32*)(pRing_ + params.sq_off.head);
+	pSqTail_ = (uint32*)(pRing_ + params.sq_off.tail);
+	pSqFlags_ = (uint32*)(pRing_ + params.sq_off.flags);
+	sqMask_ = *(uint32*)(pRing_ + params.sq_off.ring_mask);
+	sqEntries_ = params.sq_entries;
+	sqTail_ = *pSqTail_;
+
+	pCqHead_ = (uint32*)(pRing_ + params.cq_off.head);
+	pCqTail_ = (uint32*)(pRing_ + params.cq_off.tail);
+	cqMask_ = *(uint32*)(pRing_ + params.cq_off.ring_mask);
+	pCqes_ = (struct io_uring_cqe*)(pRing_ + params.cq_off.cqes);
+
+	// 提交队列的每个位置固定对应同下标的sqe
+	uint32* pArray = (uint32*)(pRing_ + params.sq_off.array);
+	for (uint32 i = 0; i < sqEntries_; ++i)
+		pArray[i] = i;
+
+	// 缓冲区环的长度必须是2的幂
+	bufferCount_ = 1;
+	while (bufferCount_ < bufferCount && bufferCount_ < BUFFER_COUNT_MAX)
+		bufferCount_ <<= 1;
+
+	bufferSize_ = std::max<uint32>(bufferSize, 512);
+	bufRingSize_ = bufferCount_ * sizeof(struct io_uring_buf);
+
+	void* pBufRing = mmap(NULL, bufRingSize_, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+	void* pBuffers = mmap(NULL, (size_t)bufferCount_ * bufferSize_, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+	pBufRing_ = (pBufRing == MAP_FAILED) ? NULL : (struct io_uring_buf_ring*)pBufRing;
+	pBuffers_ = (pBuffers == MAP_FAILED) ? NULL : (uint8*)pBuffers;
+
+	if (!pBufRing_ || !pBuffers_)
+	{
+		ERROR_MSG(fmt::format("IoUring::initialize(): alloc {}x{} buffers error: {}\n", bufferCount_, bufferSize_, strerror(errno)));
+		finalise();
+		return false;
+	}
+
+	// 注册之前填好， 内核固定的是已经分配的物理页
+	memset(pBufRing_, 0, bufRingSize_);
+	for (uint32 i = 0; i < bufferCount_; ++i)
+		recycle(i << IORING_CQE_BUFFER_SHIFT);
+
+	struct io_uring_buf_reg reg;
+	memset(&reg, 0, sizeof(reg));
+	reg.ring_addr = (uint64)(uintptr_t)pBufRing_;
+	reg.ring_entries = bufferCount_;
+	reg.bgid = BUFFER_GROUP;
+
+	if (uringRegister(fd_, IORING_REGISTER_PBUF_RING, &reg, 1) != 0)
+	{
+		ERROR_MSG(fmt::format("IoUring::initialize(): register buffer ring error: {}\n", strerror(errno)));
+		finalise();
+		return false;
+	}
+
+	// 完成队列不为空时ring的fd可读
+	pCompletionEvent_ = event_new(pEventDispatcher_->base(), fd_, EV_READ | EV_PERSIST, completionCallback, this);
+	pSubmitEvent_ = event_new(pEventDispatcher_->base(), -1, 0, submitCallback, this);
+
+	// 所有socket的完成事件在同一个事件中收割， 无法再按连接区分优先级
+	pEventDispatcher_->setPriority(pCompletionEvent_, EVENT_PRIORITY_INTERNAL);
+
+	if (!pCompletionEvent_ || !pSubmitEvent_ || event_add(pCompletionEvent_, NULL) != 0)
+	{
+		ERROR_MSG(fmt::format("IoUring::initialize(): Could not create events!\n"));
+		finalise();
+		return false;
+	}
+
+	return true;
+}
+
+//-------------------------------------------------------------------------------------
+void IoUring::finalise()
+{
+	if (pCompletionEvent_)
+	{
+		event_free(pCompletionEvent_);
+		pCompletionEvent_ = NULL;
+	}
+
+	if (pSubmitEvent_)
+	{
+		event_free(pSubmitEvent_);
+		pSubmitEvent_ = NULL;
+		submitActive_ = false;
+	}
+
+	// 关闭ring时内核会取消所有还没完成的请求
+	if (fd_ >= 0)
+	{
+		::close(fd_);
+		fd_ = -1;
+	}
+
+	if (pSqes_)
+		munmap(pSqes_, sqesSize_);
+
+	if (pRing_)
+		munmap(pRing_, ringSize_);
+
+	if (pBufRing_)
+		munmap(pBufRing_, bufRingSize_);
+
+	if (pBuffers_)
+		munmap(pBuffers_, (size_t)bufferCount_ * bufferSize_);
+
+	pSqes_ = NULL;
+	pRing_ = NULL;
+	pBufRing_ = NULL;
+	pBuffers_ = NULL;
+
+	for (auto& item : orphans_)
+		delete item;
+
+	orphans_.clear();
+	sendSockets_.clear();
+}
+
+//-------------------------------------------------------------------------------------
+std::string IoUring::info() const
+{
+	return fmt::format("io_uring(entries={}, buffers={}x{})", sqEntries_, bufferCount_, bufferSize_);
+}
+
+//-------------------------------------------------------------------------------------
+struct io_uring_sqe* IoUring::getSqe(Op* pOp)
+{
+	if (fd_ < 0)
+		return NULL;
+
+	// 队列满时先把已有的提交掉
+	if (sqTail_ - __atomic_load_n(pSqHead_, __ATOMIC_ACQUIRE) >= sqEntries_)
+	{
+		submit();
+
+		if (sqTail_ - __atomic_load_n(pSqHead_, __ATOMIC_ACQUIRE) >= sqEntries_)
+		{
+			ERROR_MSG(fmt::format("IoUring::getSqe(): submission queue is full!\n"));
+			return NULL;
+		}
+	}
+
+	struct io_uring_sqe* pSqe = &pSqes_[sqTail_ & sqMask_];
+	memset(pSqe, 0, sizeof(*pSqe));
+	pSqe->user_data = (uint64)(uintptr_t)pOp;
+
+	++sqTail_;
+	++stats_.sqes;
+
+	if (pOp)
+		pOp->inflight = true;
+
+	activateSubmit();
+	return pSqe;
+}
+
+//-------------------------------------------------------------------------------------
+bool IoUring::accept(Op* pOp, int fd)
+{
+	struct io_uring_sqe* pSqe = getSqe(pOp);
+	if (!pSqe)
+		return false;
+
+	pSqe->opcode = IORING_OP_ACCEPT;
+	pSqe->fd = fd;
+	pSqe->ioprio = IORING_ACCEPT_MULTISHOT;
+	pSqe->accept_flags = SOCK_NONBLOCK | SOCK_CLOEXEC;
+	return true;
+}
+
+//-------------------------------------------------------------------------------------
+bool IoUring::recv(Op* pOp, int fd)
+{
+	struct io_uring_sqe* pSqe = getSqe(pOp);
+	if (!pSqe)
+		return false;
+
+	// 不指定缓冲区， 每次有数据时由内核从缓冲区环中取一个
+	pSqe->opcode = IORING_OP_RECV;
+	pSqe->fd = fd;
+	pSqe->ioprio = IORING_RECV_MULTISHOT;
+	pSqe->flags = IOSQE_BUFFER_SELECT;
+	pSqe->buf_group = BUFFER_GROUP;
+	return true;
+}
+
+//-------------------------------------------------------------------------------------
+bool IoUring::sendmsg(Op* pOp, int fd, const struct msghdr* pMsg)
+{
+	struct io_uring_sqe* pSqe = getSqe(pOp);
+	if (!pSqe)
+		return false;
+
+	pSqe->opcode = IORING_OP_SENDMSG;
+	pSqe->fd = fd;
+	pSqe->addr = (uint64)(uintptr_t)pMsg;
+	pSqe->len = 1;
+	pSqe->msg_flags = MSG_NOSIGNAL;
+	return true;
+}
+
+//-------------------------------------------------------------------------------------
+bool IoUring::connect(Op* pOp, int fd, const struct sockaddr* pAddr, socklen_t len)
+{
+	struct io_uring_sqe* pSqe = getSqe(pOp);
+	if (!pSqe)
+		return false;
+
+	pSqe->opcode = IORING_OP_CONNECT;
+	pSqe->fd = fd;
+	pSqe->addr = (uint64)(uintptr_t)pAddr;
+	pSqe->off = len;
+	return true;
+}
+
+//-------------------------------------------------------------------------------------
+bool IoUring::cancel(Op* pOp)
+{
+	// 取消请求自己的完成事件不需要处理
+	struct io_uring_sqe* pSqe = getSqe(NULL);
+	if (!pSqe)
+		return false;
+
+	pSqe->opcode = IORING_OP_ASYNC_CANCEL;
+	pSqe->fd = -1;
+	pSqe->addr = (uint64)(uintptr_t)pOp;
+	return true;
+}
+
+//-------------------------------------------------------------------------------------
+void IoUring::release(Op* pOp)
+{
+	if (!pOp)
+		return;
+
+	if (!pOp->inflight || fd_ < 0)
+	{
+		delete pOp;
+		return;
+	}
+
+	pOp->callback = NULL;
+	pOp->arg = NULL;
+	orphans_.insert(pOp);
+	cancel(pOp);
+}
+
+//-------------------------------------------------------------------------------------
+bool IoUring::hasMore(uint32 flags)
+{
+	return (flags & IORING_CQE_F_MORE) != 0;
+}
+
+//-------------------------------------------------------------------------------------
+const uint8* IoUring::buffer(uint32 flags) const
+{
+	if (!(flags & IORING_CQE_F_BUFFER))
+		return NULL;
+
+	return pBuffers_ + (size_t)(flags >> IORING_CQE_BUFFER_SHIFT) * bufferSize_;
+}
+
+//-------------------------------------------------------------------------------------
+void IoUring::recycle(uint32 flags)
+{
+	uint16 bid = (uint16)(flags >> IORING_CQE_BUFFER_SHIFT);
+
+	// 只写addr/len/bid， 第一项的resv字段同时是环的tail
+	// 头文件中的bufs在C++下前面多了一个空结构体的长度， 直接按数组访问
+	struct io_uring_buf* pBuf = (struct io_uring_buf*)pBufRing_ + (bufTail_ & (bufferCount_ - 1));
+	pBuf->addr = (uint64)(uintptr_t)(pBuffers_ + (size_t)bid * bufferSize_);
+	pBuf->len = bufferSize_;
+	pBuf->bid = bid;
+
+	++bufTail_;
+	__atomic_store_n(&pBufRing_->tail, bufTail_, __ATOMIC_RELEASE);
+}
+
+//-------------------------------------------------------------------------------------
+void IoUring::scheduleSend(UringSocket* pSocket)
+{
+	if (pSocket->sendScheduled())
+		return;
+
+	pSocket->sendScheduled(true);
+	sendSockets_.push_back(pSocket);
+	activateSubmit();
+}
+
+//-------------------------------------------------------------------------------------
+void IoUring::cancelSend(UringSocket* pSocket)
+{
+	if (!pSocket->sendScheduled())
+		return;
+
+	pSocket->sendScheduled(false);
+
+	auto iter = std::find(sendSockets_.begin(), sendSockets_.end(), pSocket);
+	if (iter != sendSockets_.end())
+		sendSockets_.erase(iter);
+}
+
+//-------------------------------------------------------------------------------------
+void IoUring::activateSubmit()
+{
+	if (submitActive_ || !pSubmitEvent_)
+		return;
+
+	submitActive_ = true;
+
+	// 和当前事件同级， 排在本级已就绪的事件之后， 不打断它们
+	pEventDispatcher_->setPriority(pSubmitEvent_, pEventDispatcher_->runningPriority(EVENT_PRIORITY_INTERNAL));
+	event_active(pSubmitEvent_, EV_READ, 0);
+}
+
+//-------------------------------------------------------------------------------------
+void IoUring::submit()
+{
+	if (fd_ < 0)
+		return;
+
+	uint32 pending = sqTail_ - __atomic_load_n(pSqHead_, __ATOMIC_ACQUIRE);
+	if (pending == 0)
+		return;
+
+	__atomic_store_n(pSqTail_, sqTail_, __ATOMIC_RELEASE);
+
+	// 完成队列溢出时内核暂存的完成事件要在enter中取回
+	uint32 flags = 0;
+	if (__atomic_load_n(pSqFlags_, __ATOMIC_RELAXED) & IORING_SQ_CQ_OVERFLOW)
+		flags |= IORING_ENTER_GETEVENTS;
+
+	int ret = 0;
+	do
+	{
+		ret = uringEnter(fd_, pending, 0, flags);
+	} while (ret < 0 && errno == EINTR);
+
+	++stats_.enters;
+
+	// 没提交的留在队列中， 下次完成事件之后再提交
+	if (ret < 0)
+		WARNING_MSG(fmt::format("IoUring::submit(): io_uring_enter({}) error: {}\n", pending, strerror(errno)));
+}
+
+//-------------------------------------------------------------------------------------
+void IoUring::reap()
+{
+	uint32 head = *pCqHead_;
+
+	for (;;)
+	{
+		uint32 tail = __atomic_load_n(pCqTail_, __ATOMIC_ACQUIRE);
+		if (head == tail)
+		{
+			if (!(__atomic_load_n(pSqFlags_, __ATOMIC_RELAXED) & IORING_SQ_CQ_OVERFLOW))
+				break;
+
+			// 取回溢出的完成事件
+			uringEnter(fd_, 0, 0, IORING_ENTER_GETEVENTS);
+			++stats_.enters;
+
+			if (head == __atomic_load_n(pCqTail_, __ATOMIC_ACQUIRE))
+				break;
+
+			continue;
+		}
+
+		// 回调中可能再次提交甚至释放socket， 先取出内容并归还这一项
+		struct io_uring_cqe* pCqe = &pCqes_[head & cqMask_];
+		Op* pOp = (Op*)(uintptr_t)pCqe->user_data;
+		int res = pCqe->res;
+		uint32 flags = pCqe->flags;
+
+		++head;
+		__atomic_store_n(pCqHead_, head, __ATOMIC_RELEASE);
+		++stats_.cqes;
+
+		if (!pOp)
+			continue;
+
+		if (!hasMore(flags))
+			pOp->inflight = false;
+
+		if (!pOp->callback)
+		{
+			if (flags & IORING_CQE_F_BUFFER)
+				recycle(flags);
+
+			if (!pOp->inflight)
+			{
+				orphans_.erase(pOp);
+				delete pOp;
+			}
+
+			continue;
+		}
+
+		pOp->callback(pOp, res, flags);
+	}
+}
+
+//-------------------------------------------------------------------------------------
+void IoUring::completionCallback(evutil_socket_t fd, short events, void* arg)
+{
+	IoUring* pIoUring = (IoUring*)arg;
+	pIoUring->reap();
+
+	// 上次提交失败留下的请求
+	if (pIoUring->sqTail_ != __atomic_load_n(pIoUring->pSqHead_, __ATOMIC_ACQUIRE))
+		pIoUring->activateSubmit();
+}
+
+//-------------------------------------------------------------------------------------
+void IoUring::submitCallback(evutil_socket_t fd, short events, void* arg)
+{
+	IoUring* pIoUring = (IoUring*)arg;
+	pIoUring->onSubmit();
+}
+
+//-------------------------------------------------------------------------------------
+void IoUring::onSubmit()
+{
+	// 本轮循环中写过数据的socket各生成一个sendmsg， 和其他请求一起提交
+	for (size_t i = 0; i < sendSockets_.size(); ++i)
+	{
+		sendSockets_[i]->sendScheduled(false);
+		sendSockets_[i]->prepareSend();
+	}
+
+	sendSockets_.clear();
+	submit();
+
+	submitActive_ = false;
+}
+
+//-------------------------------------------------------------------------------------
+UringSocket::UringSocket(IoUring* pIoUring, socket_t sock, struct bufferevent* bufEvt):
+pIoUring_(pIoUring),
+sock_(sock),
+bufEvt_(bufEvt),
+pOutputCb_(NULL),
+pRecvOp_(new IoUring::Op(&UringSocket::recvCallback, this)),
+pSendOp_(new SendOp(this)),
+pConnectOp_(NULL),
+recvEnabled_(false),
+connected_(false),
+sendScheduled_(false)
+{
+	struct sockaddr_storage addr;
+	socklen_t len = sizeof(addr);
+	connected_ = getpeername(sock_, (struct sockaddr*)&addr, &len) == 0;
+
+	// bufferevent_socket冻结了接收缓冲区的尾部和发送缓冲区的头部， 只在自己读写socket时解冻
+	evbuffer_unfreeze(bufferevent_get_input(bufEvt_), 0);
+	evbuffer_unfreeze(bufferevent_get_output(bufEvt_), 1);
+
+	// 上层写入发送缓冲区时登记到本轮末尾提交
+	pOutputCb_ = evbuffer_add_cb(bufferevent_get_output(bufEvt_), outputCallback, this);
+}
+
+//-------------------------------------------------------------------------------------
+UringSocket::~UringSocket()
+{
+	close();
+}
+
+//-------------------------------------------------------------------------------------
+void UringSocket::close()
+{
+	if (sock_ == SOCKET_T_INVALID)
+		return;
+
+	struct evbuffer* pOutput = bufferevent_get_output(bufEvt_);
+
+	pIoUring_->cancelSend(this);
+
+	if (pOutputCb_)
+	{
+		evbuffer_remove_cb_entry(pOutput, pOutputCb_);
+		pOutputCb_ = NULL;
+	}
+
+	// 和bufferevent释放时一样不等待没发完的数据， 只在没有发送中的请求时顺手写一次
+	if (connected_ && !pSendOp_->inflight && evbuffer_get_length(pOutput) > 0)
+		evbuffer_write(pOutput, sock_);
+
+	pIoUring_->release(pRecvOp_);
+	pIoUring_->release(pSendOp_);
+	pIoUring_->release(pConnectOp_);
+	pRecvOp_ = NULL;
+	pSendOp_ = NULL;
+	pConnectOp_ = NULL;
+
+	// 内核中的请求持有自己的引用， 取消完成后才真正关闭
+	evutil_closesocket(sock_);
+	sock_ = SOCKET_T_INVALID;
+}
+
+//-------------------------------------------------------------------------------------
+bool UringSocket::connect(const struct sockaddr* pAddr, socklen_t len)
+{
+	if (sock_ == SOCKET_T_INVALID || connected_ || len > sizeof(struct sockaddr_storage))
+		return false;
+
+	if (!pConnectOp_)
+		pConnectOp_ = new ConnectOp(this);
+
+	if (pConnectOp_->inflight)
+		return false;
+
+	memcpy(&pConnectOp_->addr, pAddr, len);
+	pConnectOp_->len = len;
+
+	return pIoUring_->connect(pConnectOp_, sock_, (struct sockaddr*)&pConnectOp_->addr, pConnectOp_->len);
+}
+
+//-------------------------------------------------------------------------------------
+void UringSocket::enableRecv(bool v)
+{
+	if (sock_ == SOCKET_T_INVALID || recvEnabled_ == v)
+		return;
+
+	recvEnabled_ = v;
+
+	if (!v)
+	{
+		// 取消之前已经收到的数据留在接收缓冲区中
+		if (pRecvOp_->inflight)
+			pIoUring_->cancel(pRecvOp_);
+
+		return;
+	}
+
+	armRecv();
+
+	// 暂停期间收到的数据不会再有新的完成事件， 放到下一轮回调， 不在调用者中重入
+	if (evbuffer_get_length(bufferevent_get_input(bufEvt_)) > 0)
+		bufferevent_trigger(bufEvt_, EV_READ, BEV_TRIG_DEFER_CALLBACKS);
+}
+
+//-------------------------------------------------------------------------------------
+uint32 UringSocket::sending() const
+{
+	return pSendOp_ ? (uint32)evbuffer_get_length(pSendOp_->pData) : 0;
+}
+
+//-------------------------------------------------------------------------------------
+void UringSocket::armRecv()
+{
+	if (!recvEnabled_ || !connected_ || pRecvOp_->inflight)
+		return;
+
+	pIoUring_->recv(pRecvOp_, sock_);
+}
+
+//-------------------------------------------------------------------------------------
+void UringSocket::scheduleSend()
+{
+	// 发送中的请求完成后会再登记
+	if (sock_ == SOCKET_T_INVALID || !connected_ || pSendOp_->inflight)
+		return;
+
+	pIoUring_->scheduleSend(this);
+}
+
+//-------------------------------------------------------------------------------------
+void UringSocket::prepareSend()
+{
+	if (sock_ == SOCKET_T_INVALID || !connected_ || pSendOp_->inflight)
+		return;
+
+	struct evbuffer* pOutput = bufferevent_get_output(bufEvt_);
+	struct evbuffer* pData = pSendOp_->pData;
+
+	// 上次没发完的部分在前， 本轮写入的数据接在后面一起发
+	size_t length = evbuffer_get_length(pData);
+	if (length < SEND_BYTES_MAX && evbuffer_get_length(pOutput) > 0)
+		evbuffer_remove_buffer(pOutput, pData, SEND_BYTES_MAX - length);
+
+	if (evbuffer_get_length(pData) == 0)
+		return;
+
+	// evbuffer_iovec和iovec的内存布局相同
+	int count = evbuffer_peek(pData, -1, NULL, pSendOp_->iov, SEND_IOV_MAX);
+	if (count > SEND_IOV_MAX)
+		count = SEND_IOV_MAX;
+
+	memset(&pSendOp_->msg, 0, sizeof(pSendOp_->msg));
+	pSendOp_->msg.msg_iov = (struct iovec*)pSendOp_->iov;
+	pSendOp_->msg.msg_iovlen = count;
+
+	pIoUring_->sendmsg(pSendOp_, sock_, &pSendOp_->msg);
+}
+
+//-------------------------------------------------------------------------------------
+void UringSocket::recvCallback(IoUring::Op* pOp, int res, uint32 flags)
+{
+	UringSocket* pSocket = (UringSocket*)pOp->arg;
+	pSocket->onRecv(res, flags);
+}
+
+//-------------------------------------------------------------------------------------
+void UringSocket::sendCallback(IoUring::Op* pOp, int res, uint32 flags)
+{
+	UringSocket* pSocket = (UringSocket*)pOp->arg;
+	pSocket->onSent(res);
+}
+
+//-------------------------------------------------------------------------------------
+void UringSocket::connectCallback(IoUring::Op* pOp, int res, uint32 flags)
+{
+	UringSocket* pSocket = (UringSocket*)pOp->arg;
+	pSocket->onConnected(res);
+}
+
+//-------------------------------------------------------------------------------------
+void UringSocket::outputCallback(struct evbuffer* buffer, const struct evbuffer_cb_info* info, void* arg)
+{
+	if (info->n_added > 0)
+		((UringSocket*)arg)->scheduleSend();
+}
+
+//-------------------------------------------------------------------------------------
+void UringSocket::onRecv(int res, uint32 flags)
+{
+	// 以下的bufferevent回调中上层可能释放自己， 之后不能再访问成员
+	if (res > 0)
+	{
+		// 内核的缓冲区要尽快归还， 数据复制到池中的块里
+		BufferPool::add(bufferevent_get_input(bufEvt_), pIoUring_->buffer(flags), res);
+		pIoUring_->recycle(flags);
+		pIoUring_->stats_.recvBytes += res;
+	}
+	else if (flags & IORING_CQE_F_BUFFER)
+	{
+		pIoUring_->recycle(flags);
+	}
+
+	if (res == 0)
+	{
+		bufferevent_trigger_event(bufEvt_, BEV_EVENT_EOF | BEV_EVENT_READING, 0);
+		return;
+	}
+
+	if (res < 0 && res != -ENOBUFS && res != -ECANCELED)
+	{
+		errno = -res;
+		bufferevent_trigger_event(bufEvt_, BEV_EVENT_ERROR | BEV_EVENT_READING, 0);
+		return;
+	}
+
+	// 缓冲区暂时用完或者被暂停取消时内核结束了multishot， 需要时重新提交
+	if (res == -ENOBUFS)
+		++pIoUring_->stats_.noBuffers;
+
+	if (!IoUring::hasMore(flags))
+		armRecv();
+
+	if (res > 0 && recvEnabled_)
+		bufferevent_trigger(bufEvt_, EV_READ, 0);
+}
+
+//-------------------------------------------------------------------------------------
+void UringSocket::onSent(int res)
+{
+	if (res < 0)
+	{
+		errno = -res;
+		bufferevent_trigger_event(bufEvt_, BEV_EVENT_ERROR | BEV_EVENT_WRITING, 0);
+		return;
+	}
+
+	pIoUring_->stats_.sendBytes += res;
+	evbuffer_drain(pSendOp_->pData, res);
+
+	bool drained = evbuffer_get_length(pSendOp_->pData) == 0;
+	if (!drained || evbuffer_get_length(bufferevent_get_output(bufEvt_)) > 0)
+		scheduleSend();
+
+	// 和bufferevent一样在发送缓冲区降到低水位以下时回调
+	if (drained)
+		bufferevent_trigger(bufEvt_, EV_WRITE, 0);
+}
+
+//-------------------------------------------------------------------------------------
+void UringSocket::onConnected(int res)
+{
+	if (res < 0)
+	{
+		errno = -res;
+		bufferevent_trigger_event(bufEvt_, BEV_EVENT_ERROR, 0);
+		return;
+	}
+
+	connected_ = true;
+	armRecv();
+
+	// 连接之前写入的数据
+	if (evbuffer_get_length(bufferevent_get_output(bufEvt_)) > 0)
+		scheduleSend();
+
+	bufferevent_trigger_event(bufEvt_, BEV_EVENT_CONNECTED, 0);
+}
+
+#else
+
+//-------------------------------------------------------------------------------------
+IoUring::IoUring(EventDispatcher* pEventDispatcher):
+pEventDispatcher_(pEventDispatcher),
+fd_(-1),
+pRing_(NULL),
+ringSize_(0),
+pSqes_(NULL),
+sqesSize_(0),
+pSqHead_(NULL),
+pSqTail_(NULL),
+pSqFlags_(NULL),
+sqMask_(0),
+sqEntries_(0),
+sqTail_(0),
+pCqHead_(NULL),
+pCqTail_(NULL),
+cqMask_(0),
+pCqes_(NULL),
+pBufRing_(NULL),
+bufRingSize_(0),
+pBuffers_(NULL),
+bufferCount_(0),
+bufferSize_(0),
+bufTail_(0),
+pCompletionEvent_(NULL),
+pSubmitEvent_(NULL),
+submitActive_(false),
+sendSockets_(),
+orphans_(),
+stats_()
+{
+}
+
+IoUring::~IoUring() {}
+
+bool IoUring::initialize(uint32 entries, uint32 bufferCount, uint32 bufferSize)
+{
+	ERROR_MSG(fmt::format("IoUring::initialize(): io_uring is only available on linux!\n"));
+	return false;
+}
+
+void IoUring::finalise() {}
+std::string IoUring::info() const { return "io_uring(unsupported)"; }
+bool IoUring::accept(Op* pOp, int fd) { return false; }
+bool IoUring::recv(Op* pOp, int fd) { return false; }
+bool IoUring::sendmsg(Op* pOp, int fd, const struct msghdr* pMsg) { return false; }
+bool IoUring::connect(Op* pOp, int fd, const struct sockaddr* pAddr, socklen_t len) { return false; }
+bool IoUring::cancel(Op* pOp) { return false; }
+void IoUring::release(Op* pOp) { delete pOp; }
+bool IoUring::hasMore(uint32 flags) { return false; }
+const uint8* IoUring::buffer(uint32 flags) const { return NULL; }
+void IoUring::recycle(uint32 flags) {}
+void IoUring::scheduleSend(UringSocket* pSocket) {}
+void IoUring::cancelSend(UringSocket* pSocket) {}
+void IoUring::submit() {}
+
+// 不会创建， 只需要能链接
+UringSocket::UringSocket(IoUring* pIoUring, socket_t sock, struct bufferevent* bufEvt):
+pIoUring_(pIoUring), sock_(sock), bufEvt_(bufEvt), pOutputCb_(NULL), pRecvOp_(NULL), pSendOp_(NULL), pConnectOp_(NULL),
+recvEnabled_(false), connected_(false), sendScheduled_(false) {}
+UringSocket::~UringSocket() {}
+void UringSocket::close() {}
+bool UringSocket::connect(const struct sockaddr* pAddr, socklen_t len) { return false; }
+void UringSocket::enableRecv(bool v) {}
+uint32 UringSocket::sending() const { return 0; }
+void UringSocket::prepareSend() {}
+
+#endif
+
+//-------------------------------------------------------------------------------------
+}
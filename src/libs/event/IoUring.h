@@ -0,0 +1,239 @@
+#ifndef X_IO_URING_H
+#define X_IO_URING_H
+
+#include "common/common.h"
+
+struct io_uring_sqe;
+struct io_uring_cqe;
+struct io_uring_buf_ring;
+
+namespace XServer {
+
+class EventDispatcher;
+class UringSocket;
+
+/*
+	每个事件循环一个io_uring， 代替epoll + read/write承载socket的收发
+	ring的fd注册在libevent中， 有完成事件时可读； 本轮循环中提交的请求在循环末尾一次io_uring_enter提交
+	accept和recv都是multishot， 一次提交之后持续产生完成事件， recv的数据放在注册的缓冲区环中由内核挑选
+	需要linux 6.0以上， 其他平台initialize总是失败， 继续使用libevent
+*/
+class IoUring
+{
+	friend class UringSocket;
+
+public:
+	struct Op;
+
+	// flags为cqe的flags， IORING_CQE_F_MORE表示之后还有完成事件
+	typedef void(*Callback)(Op* pOp, int res, uint32 flags);
+
+	// 一个提交到内核中的请求， 内核返回之前不能释放
+	struct Op
+	{
+		Op(Callback cb, void* a):
+		callback(cb),
+		arg(a),
+		inflight(false)
+		{
+		}
+
+		virtual ~Op()
+		{
+		}
+
+		Callback callback;
+		void* arg;
+		bool inflight;
+	};
+
+	// 完成事件统计， 只在所属循环中写入
+	struct Stats
+	{
+		Stats():
+		enters(0),
+		sqes(0),
+		cqes(0),
+		recvBytes(0),
+		sendBytes(0),
+		noBuffers(0)
+		{
+		}
+
+		uint64 enters;
+		uint64 sqes;
+		uint64 cqes;
+		uint64 recvBytes;
+		uint64 sendBytes;
+		uint64 noBuffers;
+	};
+
+public:
+	IoUring(EventDispatcher* pEventDispatcher);
+	~IoUring();
+
+	// entries为提交队列长度， 接收缓冲区共bufferCount个， 每个bufferSize字节
+	bool initialize(uint32 entries, uint32 bufferCount, uint32 bufferSize);
+	void finalise();
+
+	EventDispatcher* pEventDispatcher() {
+		return pEventDispatcher_;
+	}
+
+	uint32 bufferSize() const {
+		return bufferSize_;
+	}
+
+	const Stats& stats() const {
+		return stats_;
+	}
+
+	std::string info() const;
+
+	// 以下请求都在本轮循环末尾提交
+	bool accept(Op* pOp, int fd);
+	bool recv(Op* pOp, int fd);
+	bool sendmsg(Op* pOp, int fd, const struct msghdr* pMsg);
+	bool connect(Op* pOp, int fd, const struct sockaddr* pAddr, socklen_t len);
+	bool cancel(Op* pOp);
+
+	// 释放op， 还在内核中时先取消， 等最后一个完成事件再释放
+	void release(Op* pOp);
+
+	static bool hasMore(uint32 flags);
+
+	// recv完成事件中内核选中的缓冲区， 用完之后必须recycle
+	const uint8* buffer(uint32 flags) const;
+	void recycle(uint32 flags);
+
+	// 登记到本轮末尾发送的socket， 提交之前由prepareSend生成请求
+	void scheduleSend(UringSocket* pSocket);
+	void cancelSend(UringSocket* pSocket);
+
+	// 立即提交已经生成的请求
+	void submit();
+
+private:
+	struct io_uring_sqe* getSqe(Op* pOp);
+	void activateSubmit();
+	void reap();
+
+	static void completionCallback(evutil_socket_t fd, short events, void* arg);
+	static void submitCallback(evutil_socket_t fd, short events, void* arg);
+	void onSubmit();
+
+protected:
+	EventDispatcher* pEventDispatcher_;
+
+	int fd_;
+
+	// 提交队列和完成队列在同一块映射中(IORING_FEAT_SINGLE_MMAP)
+	uint8* pRing_;
+	size_t ringSize_;
+	struct io_uring_sqe* pSqes_;
+	size_t sqesSize_;
+
+	uint32* pSqHead_;
+	uint32* pSqTail_;
+	uint32* pSqFlags_;
+	uint32 sqMask_;
+	uint32 sqEntries_;
+	uint32 sqTail_;
+
+	uint32* pCqHead_;
+	uint32* pCqTail_;
+	uint32 cqMask_;
+	struct io_uring_cqe* pCqes_;
+
+	// 接收缓冲区环
+	struct io_uring_buf_ring* pBufRing_;
+	size_t bufRingSize_;
+	uint8* pBuffers_;
+	uint32 bufferCount_;
+	uint32 bufferSize_;
+	uint16 bufTail_;
+
+	struct event* pCompletionEvent_;
+	struct event* pSubmitEvent_;
+	bool submitActive_;
+
+	std::vector<UringSocket*> sendSockets_;
+
+	// 所有者已经释放， 等待内核返回的请求
+	std::set<Op*> orphans_;
+
+	Stats stats_;
+};
+
+/*
+	使用io_uring收发的socket， 收发数据仍然放在bufferevent的缓冲区中， 通过bufferevent_trigger回调上层
+	bufferevent本身不关联fd， 只作为缓冲区和回调的容器
+*/
+class UringSocket
+{
+public:
+	UringSocket(IoUring* pIoUring, socket_t sock, struct bufferevent* bufEvt);
+	~UringSocket();
+
+	socket_t socket() const {
+		return sock_;
+	}
+
+	// 连接完成后以BEV_EVENT_CONNECTED或BEV_EVENT_ERROR通知
+	bool connect(const struct sockaddr* pAddr, socklen_t len);
+
+	// 对应bufferevent_enable/disable(EV_READ)
+	void enableRecv(bool v);
+
+	// 已经交给内核还没发送完的字节数
+	uint32 sending() const;
+
+	// 由IoUring在提交之前调用
+	void prepareSend();
+
+	bool sendScheduled() const {
+		return sendScheduled_;
+	}
+
+	void sendScheduled(bool v) {
+		sendScheduled_ = v;
+	}
+
+	void close();
+
+private:
+	struct SendOp;
+	struct ConnectOp;
+
+	void armRecv();
+	void scheduleSend();
+
+	static void recvCallback(IoUring::Op* pOp, int res, uint32 flags);
+	static void sendCallback(IoUring::Op* pOp, int res, uint32 flags);
+	static void connectCallback(IoUring::Op* pOp, int res, uint32 flags);
+	static void outputCallback(struct evbuffer* buffer, const struct evbuffer_cb_info* info, void* arg);
+
+	void onRecv(int res, uint32 flags);
+	void onSent(int res);
+	void onConnected(int res);
+
+protected:
+	IoUring* pIoUring_;
+	socket_t sock_;
+	struct bufferevent* bufEvt_;
+	struct evbuffer_cb_entry* pOutputCb_;
+
+	IoUring::Op* pRecvOp_;
+	SendOp* pSendOp_;
+	ConnectOp* pConnectOp_;
+
+	bool recvEnabled_;
+
+	// 接受的连接一开始就是连通的， 自己发起的连接要等connect完成
+	bool connected_;
+	bool sendScheduled_;
+};
+
+}
+
+#endif // X_IO_URING_H
@@ -0,0 +1,92 @@
+#include "LoopConfig.h"
+#include "EventDispatcher.h"
+#include "log/XLog.h"
+#include "resmgr/ResMgr.h"
+
+namespace XServer {
+
+//-------------------------------------------------------------------------------------
+LoopConfig::LoopConfig():
+backend(),
+edgeTriggered(false),
+changelist(false),
+noLock(false),
+preciseTimer(false),
+maxDispatch(0),
+dispatchIntervalUs(0)
+{
+}
+
+//-------------------------------------------------------------------------------------
+LoopConfig LoopConfig::fromConfig()
+{
+	const ResMgr::ServerConfig& cfg = ResMgr::getSingleton().serverConfig();
+
+	LoopConfig config;
+	config.backend = cfg.eventBackend;
+	config.edgeTriggered = cfg.eventEdgeTriggered;
+	config.changelist = cfg.eventChangelist;
+	config.noLock = cfg.eventNoLock;
+	config.preciseTimer = cfg.eventPreciseTimer;
+	config.maxDispatch = cfg.eventMaxDispatch;
+	config.dispatchIntervalUs = cfg.eventDispatchIntervalUs;
+	return config;
+}
+
+//-------------------------------------------------------------------------------------
+struct event_config* LoopConfig::build(bool threaded) const
+{
+	struct event_config* pConfig = event_config_new();
+	if (!pConfig)
+		return NULL;
+
+	// 指定后端时屏蔽其余所有后端， 不可用时创建失败而不是悄悄换成别的
+	if (backend.size() > 0)
+	{
+		const char** methods = event_get_supported_methods();
+		for (int i = 0; methods && methods[i]; ++i)
+		{
+			if (backend != methods[i])
+				event_config_avoid_method(pConfig, methods[i]);
+		}
+	}
+
+	if (edgeTriggered)
+		event_config_require_features(pConfig, EV_FEATURE_ET);
+
+	int flags = 0;
+
+	if (changelist)
+		flags |= EVENT_BASE_FLAG_EPOLL_USE_CHANGELIST;
+
+	if (preciseTimer)
+		flags |= EVENT_BASE_FLAG_PRECISE_TIMER;
+
+	// 循环之间通过EventDispatcher::post互相唤醒， 开启了多线程时必须保留锁
+	if (noLock && !threaded)
+		flags |= EVENT_BASE_FLAG_NOLOCK;
+
+	event_config_set_flag(pConfig, flags);
+
+	if (maxDispatch > 0 || dispatchIntervalUs > 0)
+	{
+		struct timeval tv;
+		tv.tv_sec = dispatchIntervalUs / 1000000;
+		tv.tv_usec = dispatchIntervalUs % 1000000;
+
+		event_config_set_max_dispatch_interval(pConfig, dispatchIntervalUs > 0 ? &tv : NULL,
+			maxDispatch > 0 ? maxDispatch : -1, EVENT_PRIORITY_TIMER);
+	}
+
+	return pConfig;
+}
+
+//-------------------------------------------------------------------------------------
+std::string LoopConfig::info() const
+{
+	return fmt::format("backend={}, edgeTriggered={}, changelist={}, noLock={}, preciseTimer={}, maxDispatch={}, dispatchIntervalUs={}",
+		backend.size() > 0 ? backend : "auto", edgeTriggered, changelist, noLock, preciseTimer, maxDispatch, dispatchIntervalUs);
+}
+
+//-------------------------------------------------------------------------------------
+}
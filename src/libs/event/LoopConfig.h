@@ -0,0 +1,49 @@
+#ifndef X_LOOP_CONFIG_H
+#define X_LOOP_CONFIG_H
+
+#include "common/common.h"
+
+namespace XServer {
+
+/*
+	创建event_base的参数， 进程中所有事件循环使用同一份
+	默认值和event_base_new()相同， 各服务器在server.ini中按需要打开
+*/
+class LoopConfig
+{
+public:
+	LoopConfig();
+
+	// 从ResMgr的服务器配置中读取
+	static LoopConfig fromConfig();
+
+	// 生成event_config， 由调用者释放； threaded为true时不设置NOLOCK
+	struct event_config* build(bool threaded) const;
+
+	std::string info() const;
+
+public:
+	// 指定后端(epoll、 poll、 select)， 为空时由libevent选择
+	std::string backend;
+
+	// 要求后端支持边缘触发， 读到内存池块中的socket改用边缘触发的读事件
+	bool edgeTriggered;
+
+	// epoll在一轮中把对同一个fd的多次修改合并为一次epoll_ctl
+	bool changelist;
+
+	// 不给event_base加锁， 只对没有跨线程投递的单循环服务器生效
+	bool noLock;
+
+	// 使用精确的时钟， 否则epoll后端使用CLOCK_MONOTONIC_COARSE
+	bool preciseTimer;
+
+	// 每处理这么多个回调或经过这么多微秒之后重新检查定时器和更高优先级的事件， 0为不限制
+	// 只限制逻辑定时器和客户端连接， 服务器之间的连接不受限制
+	int maxDispatch;
+	int dispatchIntervalUs;
+};
+
+}
+
+#endif // X_LOOP_CONFIG_H
@@ -3,6 +3,7 @@
 #include "Session.h"
 #include "TcpSocket.h"
 #include "log/XLog.h"
+#include "Timer.h"
 #include "resmgr/ResMgr.h"
 
 namespace XServer {
@@ -10,9 +11,14 @@ namespace XServer {
 //-------------------------------------------------------------------------------------
 NetworkInterface::NetworkInterface(EventDispatcher* pEventDispatcher, bool isInternalNetwork):
 pEventDispatcher_(pEventDispatcher),
-pEventListener_(NULL),
-sessions_(),
-isInternalNetwork_(isInternalNetwork)
+loops_(),
+nextLoop_(0),
+sessionNum_(0),
+isInternalNetwork_(isInternalNetwork),
+corking_(false),
+socketProfile_(),
+socketProfileReported_(false),
+acceptFilter_()
 {
 #ifdef _WIN32
 	static bool installed = false;
@@ -22,16 +28,29 @@ isInternalNetwork_(isInternalNetwork)
 		WSAStartup(0x0201, &wsa_data);
 	}
 #endif
+
+	Loop* pLoop = new Loop();
+	pLoop->index = 0;
+	pLoop->pNetworkInterface = this;
+	pLoop->pEventDispatcher = pEventDispatcher_;
+	pLoop->pTimer = new Timer(pEventDispatcher_, 10, eventPriority());
+	pLoop->sessions.prefix(isInternalNetwork_, 0);
+	loops_.push_back(pLoop);
 }
 
 //-------------------------------------------------------------------------------------
 NetworkInterface::~NetworkInterface()
 {
 	finalise();
+
+	for (auto& item : loops_)
+		delete item;
+
+	loops_.clear();
 }
 
 //-------------------------------------------------------------------------------------		
-bool NetworkInterface::initialize(const std::string& addr, uint16 port)
+bool NetworkInterface::initialize(const std::string& addr, uint16 port, int workerLoops)
 {
 	struct sockaddr_in serverAddr;
 	memset(&serverAddr, 0, sizeof(serverAddr));
@@ -39,22 +58,55 @@ bool NetworkInterface::initialize(const std::string& addr, uint16 port)
 	evutil_inet_pton(AF_INET, addr.c_str(), &serverAddr.sin_addr);
 	serverAddr.sin_port = htons(port);
 
-	pEventListener_ = evconnlistener_new_bind(pEventDispatcher_->base(),
-		listenEventCallback, this,
-		LEV_OPT_CLOSE_ON_FREE | LEV_OPT_REUSEABLE | LEV_OPT_THREADSAFE, -1,
-		(struct sockaddr *)&serverAddr, sizeof(serverAddr));
+	socketProfile_ = SocketProfile::fromConfig(isInternalNetwork_);
+	acceptFilter_.setup(isInternalNetwork_);
 
-	if (!pEventListener_)
+	if (workerLoops > 0 && !startLoops(workerLoops))
 	{
-		ERROR_MSG(fmt::format("NetworkInterface::initialize(): Could not create a listener! addr={}:{}\n", addr, port));
+		ERROR_MSG(fmt::format("NetworkInterface::initialize(): Could not start {} event loops! addr={}:{}\n", workerLoops, addr, port));
 		return false;
 	}
 
-	evutil_make_socket_nonblocking(evconnlistener_get_fd(pEventListener_));
-	evconnlistener_set_error_cb(pEventListener_, listenErrorCallback);
+	setupIOBackend();
+
+#if defined(SO_REUSEPORT)
+	// 每个工作循环各自监听同一端口， 由内核分配新连接
+	if (loops_.size() > 1)
+	{
+		for (size_t i = 1; i < loops_.size(); ++i)
+		{
+			if (!createListener(loops_[i], serverAddr, LEV_OPT_REUSEABLE_PORT))
+			{
+				ERROR_MSG(fmt::format("NetworkInterface::initialize(): Could not create a listener! addr={}:{}, loop={}\n", addr, port, i));
+				return false;
+			}
+
+			// 端口为0时由系统分配， 后续循环必须绑定到同一个端口上
+			if (serverAddr.sin_port == 0)
+				serverAddr.sin_port = htons(getListenerPort());
+		}
+	}
+	else
+#endif
+	{
+		// 不支持SO_REUSEPORT时由主循环accept， 再轮流分配给工作循环
+		if (!createListener(loops_[0], serverAddr, 0))
+		{
+			ERROR_MSG(fmt::format("NetworkInterface::initialize(): Could not create a listener! addr={}:{}\n", addr, port));
+			return false;
+		}
+	}
+
+	for (size_t i = 1; i < loops_.size(); ++i)
+	{
+		Loop* pLoop = loops_[i];
+		pLoop->pThread = new std::thread([pLoop]() {
+			pLoop->pEventDispatcher->dispatch(EVLOOP_NO_EXIT_ON_EMPTY);
+		});
+	}
 
-	std::string info = fmt::format("NetworkInterface::initialize(): Server socket({}) created on IP: {}:{}!\n", 
-		(isInternalNetwork_ ? "Internal" : "External"), getListenerIP(), getListenerPort());
+	std::string info = fmt::format("NetworkInterface::initialize(): Server socket({}) created on IP: {}:{}, loops={}!\n", 
+		(isInternalNetwork_ ? "Internal" : "External"), getListenerIP(), getListenerPort(), loops_.size());
 
 	INFO_MSG(info);
 
@@ -62,20 +114,141 @@ bool NetworkInterface::initialize(const std::string& addr, uint16 port)
 	printf(info.c_str());
 #endif
 
+	INFO_MSG(fmt::format("NetworkInterface::initialize(): socket profile({}): listener[{}]\n",
+		(isInternalNetwork_ ? "Internal" : "External"), socketProfile_.listenerEffective(evconnlistener_get_fd(listener()))));
+
+	INFO_MSG(fmt::format("NetworkInterface::initialize(): io backend({}): {}\n",
+		(isInternalNetwork_ ? "Internal" : "External"), ioBackendInfo()));
+
+	INFO_MSG(fmt::format("NetworkInterface::initialize(): accept filter({}): {}\n",
+		(isInternalNetwork_ ? "Internal" : "External"), acceptFilter_.info()));
+
 	return true;
 }
 
+//-------------------------------------------------------------------------------------
+struct evconnlistener* NetworkInterface::createListener(Loop* pLoop, struct sockaddr_in& serverAddr, unsigned flags)
+{
+	pLoop->pEventListener = evconnlistener_new_bind(pLoop->pEventDispatcher->base(),
+		listenEventCallback, pLoop,
+		LEV_OPT_CLOSE_ON_FREE | LEV_OPT_REUSEABLE | flags, -1,
+		(struct sockaddr *)&serverAddr, sizeof(serverAddr));
+
+	if (!pLoop->pEventListener)
+		return NULL;
+
+	evutil_make_socket_nonblocking(evconnlistener_get_fd(pLoop->pEventListener));
+	socketProfile_.applyListener(evconnlistener_get_fd(pLoop->pEventListener));
+	evconnlistener_set_error_cb(pLoop->pEventListener, listenErrorCallback);
+
+	IoUring* pIoUring = pLoop->pEventDispatcher->pIoUring();
+	if (pIoUring)
+	{
+		evconnlistener_disable(pLoop->pEventListener);
+
+		pLoop->pAcceptOp = new IoUring::Op(acceptCallback, pLoop);
+		if (!pIoUring->accept(pLoop->pAcceptOp, evconnlistener_get_fd(pLoop->pEventListener)))
+		{
+			pIoUring->release(pLoop->pAcceptOp);
+			pLoop->pAcceptOp = NULL;
+			evconnlistener_enable(pLoop->pEventListener);
+		}
+	}
+
+	return pLoop->pEventListener;
+}
+
+//-------------------------------------------------------------------------------------
+void NetworkInterface::setupIOBackend()
+{
+	const ResMgr::ServerConfig& cfg = ResMgr::getSingleton().serverConfig();
+	if (cfg.ioBackend != IO_BACKEND_URING)
+		return;
+
+	for (auto& pLoop : loops_)
+	{
+		if (!pLoop->pEventDispatcher->enableIoUring(cfg.uringEntries, cfg.uringBuffers, cfg.uringBufferSize))
+		{
+			WARNING_MSG(fmt::format("NetworkInterface::setupIOBackend(): io_uring is not available, loop {} falls back to libevent!\n",
+				pLoop->index));
+		}
+	}
+}
+
+//-------------------------------------------------------------------------------------
+std::string NetworkInterface::ioBackendInfo()
+{
+	IoUring* pIoUring = loops_[0]->pEventDispatcher->pIoUring();
+	if (pIoUring)
+		return pIoUring->info();
+
+	return fmt::format("libevent({})", loops_[0]->pEventDispatcher->backendInfo());
+}
+
+//-------------------------------------------------------------------------------------
+bool NetworkInterface::startLoops(int workerLoops)
+{
+	// session ID中只有7位用来记录所属循环
+	if (workerLoops >= SessionSlab::MAX_LOOPS)
+		workerLoops = SessionSlab::MAX_LOOPS - 1;
+
+	for (int i = 0; i < workerLoops; ++i)
+	{
+		Loop* pLoop = new Loop();
+		pLoop->index = (int)loops_.size();
+		pLoop->pNetworkInterface = this;
+		pLoop->sessions.prefix(isInternalNetwork_, pLoop->index);
+		loops_.push_back(pLoop);
+
+		pLoop->pEventDispatcher = new EventDispatcher();
+		if (!pLoop->pEventDispatcher->initialize(LoopConfig::fromConfig()))
+			return false;
+
+		pLoop->pTimer = new Timer(pLoop->pEventDispatcher, 10, eventPriority());
+	}
+
+	return true;
+}
+
+//-------------------------------------------------------------------------------------
+void NetworkInterface::stopLoops()
+{
+	for (size_t i = 1; i < loops_.size(); ++i)
+	{
+		Loop* pLoop = loops_[i];
+		if (!pLoop->pThread)
+			continue;
+
+		pLoop->pEventDispatcher->breakDispatch();
+		pLoop->pThread->join();
+		SAFE_RELEASE(pLoop->pThread);
+	}
+}
+
+//-------------------------------------------------------------------------------------
+struct evconnlistener* NetworkInterface::listener()
+{
+	for (auto& item : loops_)
+	{
+		if (item->pEventListener)
+			return item->pEventListener;
+	}
+
+	return NULL;
+}
+
 //-------------------------------------------------------------------------------------
 uint16 NetworkInterface::getListenerPort()
 {
-	if (!pEventListener_)
+	struct evconnlistener* pEventListener = listener();
+	if (!pEventListener)
 		return 0;
 
 	struct sockaddr_in serverAddr;
 	memset(&serverAddr, 0, sizeof(serverAddr));
 
 	socklen_t len = sizeof(serverAddr);
-	getsockname(evconnlistener_get_fd(pEventListener_),
+	getsockname(evconnlistener_get_fd(pEventListener),
 		(struct sockaddr*)&serverAddr, &len);
 
 	return ntohs(serverAddr.sin_port);
@@ -84,14 +257,15 @@ uint16 NetworkInterface::getListenerPort()
 //-------------------------------------------------------------------------------------
 std::string NetworkInterface::getListenerIP()
 {
-	if (!pEventListener_)
+	struct evconnlistener* pEventListener = listener();
+	if (!pEventListener)
 		return "";
 
 	struct sockaddr_in serverAddr;
 	memset(&serverAddr, 0, sizeof(serverAddr));
 
 	socklen_t len = sizeof(serverAddr);
-	getsockname(evconnlistener_get_fd(pEventListener_),
+	getsockname(evconnlistener_get_fd(pEventListener),
 		(struct sockaddr*)&serverAddr, &len);
 
 	std::string addr = inet_ntoa(serverAddr.sin_addr);
@@ -106,30 +280,137 @@ void NetworkInterface::finalise(void)
 {
 	INFO_MSG(fmt::format("NetworkInterface::finalise()\n"));
 
-	for (auto& item : sessions_)
-		delete(item.second);
+	// 先停掉工作线程， 之后所有分片都只会在当前线程访问
+	stopLoops();
+
+	if (corking_)
+	{
+		INFO_MSG(fmt::format("NetworkInterface::finalise(): corking: isInternal={}, packets={}, flushes={}, packetsPerFlush={:.2f}\n",
+			isInternalNetwork_, corkedPackets(), corkFlushes(), corkPacketsPerFlush()));
+	}
+
+	for (int i = 0; i < 2; ++i)
+	{
+		uint64 packets = 0, rawBytes = 0, wireBytes = 0;
+		compressionStats(i == 0, packets, rawBytes, wireBytes);
+		if (packets == 0)
+			continue;
 
-	sessions_.clear();
+		INFO_MSG(fmt::format("NetworkInterface::finalise(): compression: isInternal={}, {}: packets={}, rawBytes={}, wireBytes={}, ratio={:.3f}\n",
+			isInternalNetwork_, i == 0 ? "sent" : "received", packets, rawBytes, wireBytes, (double)wireBytes / rawBytes));
+	}
 
-	if (pEventListener_)
+	for (int i = 0; i < 2; ++i)
 	{
-		evconnlistener_free(pEventListener_);
-		pEventListener_ = NULL;
+		uint64 frames = 0, packets = 0, bytes = 0;
+		uint32 maxPackets = 0;
+		batchStats(i == 0, frames, packets, bytes, maxPackets);
+		if (frames == 0)
+			continue;
+
+		INFO_MSG(fmt::format("NetworkInterface::finalise(): batching: isInternal={}, {}: frames={}, packets={}, bytes={}, packetsPerFrame={:.2f}, maxPackets={}\n",
+			isInternalNetwork_, i == 0 ? "sent" : "received", frames, packets, bytes, (double)packets / frames, maxPackets));
+	}
+
+	if (recvYields() > 0)
+	{
+		INFO_MSG(fmt::format("NetworkInterface::finalise(): receive budget: isInternal={}, yields={}\n",
+			isInternalNetwork_, recvYields()));
+	}
+
+	// 主循环由XServerBase输出； 析构时会再次调用finalise， 工作循环已经释放
+	for (size_t i = 1; i < loops_.size(); ++i)
+	{
+		if (!loops_[i]->pEventDispatcher)
+			continue;
+
+		INFO_MSG(fmt::format("NetworkInterface::finalise(): event priority wait: isInternal={}, loop={}, {}\n",
+			isInternalNetwork_, i, loops_[i]->pEventDispatcher->priorityWaitInfo()));
+	}
+
+	if (acceptFilter_.denied() > 0 || acceptFilter_.throttled() > 0)
+	{
+		INFO_MSG(fmt::format("NetworkInterface::finalise(): accept filter: isInternal={}, accepted={}, denied={}, throttled={}\n",
+			isInternalNetwork_, acceptFilter_.accepted(), acceptFilter_.denied(), acceptFilter_.throttled()));
+	}
+
+	for (auto& pLoop : loops_)
+	{
+		pLoop->sessions.clear();
+
+		if (pLoop->pAcceptOp)
+		{
+			pLoop->pEventDispatcher->pIoUring()->release(pLoop->pAcceptOp);
+			pLoop->pAcceptOp = NULL;
+		}
+
+		if (pLoop->pEventListener)
+		{
+			evconnlistener_free(pLoop->pEventListener);
+			pLoop->pEventListener = NULL;
+		}
+
+		SAFE_RELEASE(pLoop->pTimer);
+
+		pLoop->flushSessions.clear();
+		pLoop->closeSessions.clear();
+
+		pLoop->recvSessions.clear();
+		pLoop->recvScheduled = false;
+
+		if (pLoop->pRecvEvent)
+		{
+			event_free(pLoop->pRecvEvent);
+			pLoop->pRecvEvent = NULL;
+		}
+
+		if (pLoop->pDeferredEvent)
+		{
+			event_free(pLoop->pDeferredEvent);
+			pLoop->pDeferredEvent = NULL;
+			pLoop->deferredActive = false;
+		}
+
+		if (pLoop->index > 0)
+			SAFE_RELEASE(pLoop->pEventDispatcher);
 	}
 
+	sessionNum_ = 0;
 	pEventDispatcher_ = NULL;
 }
 
 //-------------------------------------------------------------------------------------
-Session* NetworkInterface::createSession(evutil_socket_t sock)
+Session* NetworkInterface::createSession(evutil_socket_t sock, int loop)
 {
-	return createSession_(uuid(), sock);
+	// SessionID中记录了session所属的循环和句柄表中的位置， 见SessionSlab
+	SessionSlab& sessions = loops_[loop]->sessions;
+
+	SessionID id = sessions.reserve();
+	if (id == SESSION_ID_INVALID)
+		return NULL;
+
+	Session* pSession = createSession_(id, sock, loops_[loop]->pEventDispatcher);
+	sessions.attach(id, pSession);
+	++sessionNum_;
+	return pSession;
 }
 
 //-------------------------------------------------------------------------------------
-Session* NetworkInterface::createSession_(SessionID sessionID, evutil_socket_t sock)
+Session* NetworkInterface::createSession_(SessionID sessionID, evutil_socket_t sock, EventDispatcher* pEventDispatcher)
 {
-	return new Session(sessionID, sock, this, this->pEventDispatcher());
+	return new Session(sessionID, sock, this, pEventDispatcher);
+}
+
+//-------------------------------------------------------------------------------------
+void NetworkInterface::runInSessionLoop(SessionID id, const SessionTask& task)
+{
+	Loop* pLoop = loops_[loopIndex(id)];
+	if (!pLoop->pEventDispatcher)
+		return;
+
+	pLoop->pEventDispatcher->runInLoop([this, id, task]() {
+		task(findSession(id));
+	});
 }
 
 //-------------------------------------------------------------------------------------
@@ -140,56 +421,92 @@ void NetworkInterface::listenEventCallback(
 	int len,
 	void *ctx)
 {
-	// ǷǷip
-	std::string sockIP = TcpSocket::getSocketIP(sock);
+	Loop* pLoop = (Loop *)ctx;
+	evutil_make_socket_nonblocking(sock);
+	pLoop->pNetworkInterface->dispatchAccepted(pLoop, sock, addr);
+}
 
-	bool isServer = false;
+//-------------------------------------------------------------------------------------
+void NetworkInterface::acceptCallback(IoUring::Op* pOp, int res, uint32 flags)
+{
+	Loop* pLoop = (Loop *)pOp->arg;
+	NetworkInterface *pNetworkInterface = pLoop->pNetworkInterface;
 
-	for (auto& item : ResMgr::getSingleton().serverConfig().server_addresses)
+	// 接受的socket已经是非阻塞的
+	if (res >= 0)
 	{
-		if (item[item.size() - 1] == '*')
-		{
-			size_t npos = sockIP.rfind('.', 10);
+		pNetworkInterface->dispatchAccepted(pLoop, res, NULL);
+	}
+	else if (res != -ECANCELED)
+	{
+		errno = -res;
+		pNetworkInterface->onListenError();
+	}
 
-			if(item.size() >= npos)
-			{
-				for (int i = 0; i < npos; i++)
-					if (item[i] != sockIP[i])
-						continue;
+	// 内核出错时结束multishot， 重新提交
+	if (!IoUring::hasMore(flags) && pLoop->pAcceptOp == pOp)
+		pLoop->pEventDispatcher->pIoUring()->accept(pOp, evconnlistener_get_fd(pLoop->pEventListener));
+}
 
-				isServer = true;
-				break;
-			}
-		}
-		else
-		{
-			if (item == sockIP)
-			{
-				isServer = true;
-				break;
-			}
-		}
+//-------------------------------------------------------------------------------------
+void NetworkInterface::dispatchAccepted(Loop* pLoop, evutil_socket_t sock, const struct sockaddr* addr)
+{
+	// 在创建session和分配到工作循环之前拒绝， 不输出逐个连接的日志
+	if (acceptFilter_.check(sock, addr) != AcceptFilter::ACCEPT_OK)
+	{
+		rejectAccepted(sock);
+		return;
 	}
 
-	NetworkInterface *pNetworkInterface = (NetworkInterface *)ctx;
-	evutil_make_socket_nonblocking(sock);
+	// 主循环负责accept时， 将连接轮流交给工作循环
+	if (pLoop->index == 0 && loops_.size() > 1)
+	{
+		size_t index = 1 + (nextLoop_++ % (loops_.size() - 1));
+		Loop* pWorkerLoop = loops_[index];
 
-	Session* pSession = pNetworkInterface->createSession(sock);
-	pSession->isServer(pNetworkInterface->isInternalNetwork());
-	pSession->connected(true);
-	pNetworkInterface->addSession(pSession->id(), pSession);
+		pWorkerLoop->pEventDispatcher->post([this, pWorkerLoop, sock]() {
+			onAccepted(pWorkerLoop, sock);
+		});
 
-	if (!pSession->initialize())
+		return;
+	}
+
+	onAccepted(pLoop, sock);
+}
+
+//-------------------------------------------------------------------------------------
+void NetworkInterface::rejectAccepted(evutil_socket_t sock)
+{
+	// 直接RST， 不在本端留下TIME_WAIT
+	struct linger lingerOpt;
+	lingerOpt.l_onoff = 1;
+	lingerOpt.l_linger = 0;
+	setsockopt(sock, SOL_SOCKET, SO_LINGER, (const char*)&lingerOpt, sizeof(lingerOpt));
+
+	evutil_closesocket(sock);
+}
+
+//-------------------------------------------------------------------------------------
+void NetworkInterface::onAccepted(Loop* pLoop, evutil_socket_t sock)
+{
+	socketProfile_.apply(sock);
+	reportSocketProfile(sock);
+
+	Session* pSession = createSession(sock, pLoop->index);
+	if (!pSession)
 	{
-		pNetworkInterface->removeSession(pSession->id());
-		// delete pSession; in removeSession
+		ERROR_MSG(fmt::format("NetworkInterface::onAccepted(): create session failed! {}\n", TcpSocket::getSocketIP(sock)));
+		evutil_closesocket(sock);
 		return;
 	}
 
-	if (pSession->isServer() && !isServer)
+	// 内部网络的地址已经由AcceptFilter检查过
+	pSession->isServer(isInternalNetwork());
+	pSession->connected(true);
+
+	if (!pSession->initialize())
 	{
-		ERROR_MSG(fmt::format("NetworkInterface::listenEventCallback(): Illegal internal address: {}!\n", sockIP));
-		pNetworkInterface->removeSession(pSession->id());
+		removeSession(pSession->id());
 		// delete pSession; in removeSession
 		return;
 	}
@@ -198,10 +515,10 @@ void NetworkInterface::listenEventCallback(
 //-------------------------------------------------------------------------------------
 void NetworkInterface::listenErrorCallback(struct evconnlistener *listener, void *ctx)
 {
-	NetworkInterface *pNetworkInterface = (NetworkInterface *)ctx;
+	Loop* pLoop = (Loop *)ctx;
 
-	if (pNetworkInterface)
-		pNetworkInterface->onListenError();
+	if (pLoop && pLoop->pNetworkInterface)
+		pLoop->pNetworkInterface->onListenError();
 }
 
 //-------------------------------------------------------------------------------------
@@ -211,53 +528,292 @@ void NetworkInterface::onListenError()
 }
 
 //-------------------------------------------------------------------------------------
-bool NetworkInterface::addSession(SessionID id, Session* pSession)
+void NetworkInterface::reportSocketProfile(evutil_socket_t sock)
 {
-	sessions_[id] = pSession;
-	//DEBUG_MSG(fmt::format("NetworkInterface::addSession(): id={}, pSession={:p}!\n", id, (void*)pSession));
-	return true;
+	// 连接级别的参数只能在第一个socket上读回
+	if (socketProfileReported_.exchange(true))
+		return;
+
+	INFO_MSG(fmt::format("NetworkInterface::reportSocketProfile(): socket profile({}): connection[{}]\n",
+		(isInternalNetwork_ ? "Internal" : "External"), socketProfile_.effective(sock)));
 }
 
 //-------------------------------------------------------------------------------------
 bool NetworkInterface::removeSession(SessionID id)
 {
-	SessionMap::iterator iter = sessions_.find(id);
-	if (iter == sessions_.end())
+	Session* pSession = loops_[loopIndex(id)]->sessions.release(id);
+	if (!pSession)
 	{
 		ERROR_MSG(fmt::format("NetworkInterface::removeSession(): id({}) not found!\n", id));
 		return false;
 	}
 
-	delete iter->second;
-	sessions_.erase(iter);
+	delete pSession;
+	--sessionNum_;
 	//DEBUG_MSG(fmt::format("NetworkInterface::removeSession(): id={}!\n", id));
 	return true;
 }
 
 //-------------------------------------------------------------------------------------
-void NetworkInterface::checkSessions()
+bool NetworkInterface::activateDeferred(Loop* pLoop)
+{
+	if (!pLoop->pDeferredEvent)
+	{
+		pLoop->pDeferredEvent = event_new(pLoop->pEventDispatcher->base(), -1, 0, deferredCallback, pLoop);
+		if (!pLoop->pDeferredEvent)
+		{
+			ERROR_MSG(fmt::format("NetworkInterface::activateDeferred(): create deferred event failed! loop={}\n", pLoop->index));
+			return false;
+		}
+	}
+
+	// 激活的事件排在本轮已就绪事件之后执行
+	// 和当前事件同级： 更高级会打断本级剩下的事件， 更低级要等更高级的事件都处理完
+	if (!pLoop->deferredActive)
+	{
+		pLoop->deferredActive = true;
+		pLoop->pEventDispatcher->setPriority(pLoop->pDeferredEvent, pLoop->pEventDispatcher->runningPriority(eventPriority()));
+		event_active(pLoop->pDeferredEvent, EV_WRITE, 0);
+	}
+
+	return true;
+}
+
+//-------------------------------------------------------------------------------------
+void NetworkInterface::deferClose(Session* pSession)
+{
+	Loop* pLoop = loops_[loopIndex(pSession->id())];
+
+	// 无法延迟时只能立即关闭
+	if (!activateDeferred(pLoop))
+	{
+		pSession->close();
+		return;
+	}
+
+	pLoop->closeSessions.push_back(pSession->id());
+}
+
+//-------------------------------------------------------------------------------------
+void NetworkInterface::onPacketCorked(Session* pSession)
+{
+	Loop* pLoop = loops_[loopIndex(pSession->id())];
+	++pLoop->corkedPackets;
+
+	scheduleFlush(pLoop, pSession);
+}
+
+//-------------------------------------------------------------------------------------
+void NetworkInterface::onPacketBatched(Session* pSession)
+{
+	scheduleFlush(loops_[loopIndex(pSession->id())], pSession);
+}
+
+//-------------------------------------------------------------------------------------
+void NetworkInterface::scheduleFlush(Loop* pLoop, Session* pSession)
+{
+	if (pSession->flushPending())
+		return;
+
+	// 本轮所有回调写入的数据会在本轮末尾被一起写出
+	if (!activateDeferred(pLoop))
+	{
+		pSession->flush();
+		return;
+	}
+
+	pSession->flushPending(true);
+	pLoop->flushSessions.push_back(pSession);
+}
+
+//-------------------------------------------------------------------------------------
+void NetworkInterface::cancelFlush(Session* pSession)
+{
+	std::vector<Session*>& flushSessions = loops_[loopIndex(pSession->id())]->flushSessions;
+
+	std::vector<Session*>::iterator iter = std::find(flushSessions.begin(), flushSessions.end(), pSession);
+	if (iter != flushSessions.end())
+		flushSessions.erase(iter);
+
+	pSession->flushPending(false);
+}
+
+//-------------------------------------------------------------------------------------
+void NetworkInterface::deferredCallback(evutil_socket_t fd, short events, void *ctx)
+{
+	Loop* pLoop = (Loop*)ctx;
+	pLoop->pNetworkInterface->onDeferred(pLoop);
+}
+
+//-------------------------------------------------------------------------------------
+void NetworkInterface::onDeferred(Loop* pLoop)
+{
+	pLoop->deferredActive = false;
+
+	// flush不会回调到上层逻辑， 遍历过程中列表不会被修改
+	for (auto& pSession : pLoop->flushSessions)
+	{
+		if (pSession->flush())
+			++pLoop->corkFlushes;
+	}
+
+	pLoop->flushSessions.clear();
+
+	// 关闭时的回调可能继续destroy别的session， 新加入的也在这里一并处理
+	for (size_t i = 0; i < pLoop->closeSessions.size(); ++i)
+	{
+		Session* pSession = pLoop->sessions.find(pLoop->closeSessions[i]);
+		if (pSession)
+			pSession->close();
+	}
+
+	pLoop->closeSessions.clear();
+}
+
+//-------------------------------------------------------------------------------------
+bool NetworkInterface::onRecvBacklog(Session* pSession)
 {
-	std::vector<SessionID> dels;
+	Loop* pLoop = loops_[loopIndex(pSession->id())];
 
-	for (auto& item : sessions_)
+	if (!pLoop->recvScheduled)
 	{
-		if (item.second->isTimeout())
+		if (!pLoop->pRecvEvent)
 		{
-			dels.push_back(item.first);
+			pLoop->pRecvEvent = evtimer_new(pLoop->pEventDispatcher->base(), recvQueueCallback, pLoop);
+			if (!pLoop->pRecvEvent)
+			{
+				ERROR_MSG(fmt::format("NetworkInterface::onRecvBacklog(): create receive event failed! loop={}\n", pLoop->index));
+				return false;
+			}
+
+			pLoop->pEventDispatcher->setPriority(pLoop->pRecvEvent, eventPriority());
 		}
+
+		// 定时0秒而不是直接激活： 等下一轮poll之后再处理， 本轮新就绪的连接排在积压的前面
+		struct timeval tv;
+		tv.tv_sec = 0;
+		tv.tv_usec = 0;
+
+		if (evtimer_add(pLoop->pRecvEvent, &tv) != 0)
+			return false;
+
+		pLoop->recvScheduled = true;
 	}
 
-	for (auto& item : dels)
+	++pLoop->recvYields;
+	pLoop->recvSessions.push_back(pSession->id());
+	return true;
+}
+
+//-------------------------------------------------------------------------------------
+void NetworkInterface::recvQueueCallback(evutil_socket_t fd, short events, void *ctx)
+{
+	Loop* pLoop = (Loop*)ctx;
+	pLoop->pNetworkInterface->onRecvQueue(pLoop);
+}
+
+//-------------------------------------------------------------------------------------
+void NetworkInterface::onRecvQueue(Loop* pLoop)
+{
+	pLoop->recvScheduled = false;
+
+	// 每个session本轮只处理一次预算， 仍有积压的会重新排到队尾
+	size_t count = pLoop->recvSessions.size();
+	for (size_t i = 0; i < count; ++i)
 	{
-		Session* pSession = findSession(item);
+		SessionID id = pLoop->recvSessions.front();
+		pLoop->recvSessions.pop_front();
 
-		if (!pSession)
-			continue;
+		Session* pSession = pLoop->sessions.find(id);
+		if (pSession)
+			pSession->resumeRecv();
+	}
+}
+
+//-------------------------------------------------------------------------------------
+uint64 NetworkInterface::recvYields() const
+{
+	uint64 count = 0;
+
+	for (auto& pLoop : loops_)
+		count += pLoop->recvYields;
+
+	return count;
+}
+
+//-------------------------------------------------------------------------------------
+uint64 NetworkInterface::corkedPackets() const
+{
+	uint64 count = 0;
+
+	for (auto& pLoop : loops_)
+		count += pLoop->corkedPackets;
+
+	return count;
+}
 
-		DEBUG_MSG(fmt::format("NetworkInterface::checkSessions(): session timeout! sessionID={}, addr={}!\n",
-			pSession->id(), pSession->addr()));
+//-------------------------------------------------------------------------------------
+uint64 NetworkInterface::corkFlushes() const
+{
+	uint64 count = 0;
+
+	for (auto& pLoop : loops_)
+		count += pLoop->corkFlushes;
+
+	return count;
+}
 
-		pSession->destroy();
+//-------------------------------------------------------------------------------------
+void NetworkInterface::onPacketCompressed(Session* pSession, uint32 rawSize, uint32 wireSize)
+{
+	loops_[loopIndex(pSession->id())]->compressed.add(rawSize, wireSize);
+}
+
+//-------------------------------------------------------------------------------------
+void NetworkInterface::onPacketDecompressed(Session* pSession, uint32 rawSize, uint32 wireSize)
+{
+	loops_[loopIndex(pSession->id())]->decompressed.add(rawSize, wireSize);
+}
+
+//-------------------------------------------------------------------------------------
+void NetworkInterface::compressionStats(bool sent, uint64& packets, uint64& rawBytes, uint64& wireBytes) const
+{
+	packets = rawBytes = wireBytes = 0;
+
+	for (auto& pLoop : loops_)
+	{
+		const CompressionStats& stats = sent ? pLoop->compressed : pLoop->decompressed;
+		packets += stats.packets;
+		rawBytes += stats.rawBytes;
+		wireBytes += stats.wireBytes;
+	}
+}
+
+//-------------------------------------------------------------------------------------
+void NetworkInterface::onBatchSent(Session* pSession, uint32 packets, uint32 size)
+{
+	loops_[loopIndex(pSession->id())]->batchSent.add(packets, size);
+}
+
+//-------------------------------------------------------------------------------------
+void NetworkInterface::onBatchReceived(Session* pSession, uint32 packets, uint32 size)
+{
+	loops_[loopIndex(pSession->id())]->batchReceived.add(packets, size);
+}
+
+//-------------------------------------------------------------------------------------
+void NetworkInterface::batchStats(bool sent, uint64& frames, uint64& packets, uint64& bytes, uint32& maxPackets) const
+{
+	frames = packets = bytes = 0;
+	maxPackets = 0;
+
+	for (auto& pLoop : loops_)
+	{
+		const BatchStats& stats = sent ? pLoop->batchSent : pLoop->batchReceived;
+		frames += stats.frames;
+		packets += stats.packets;
+		bytes += stats.bytes;
+		maxPackets = std::max<uint32>(maxPackets, stats.maxPackets);
 	}
 }
 
@@ -2,48 +2,164 @@
 #define X_NETWORKINTERFACE_H
 
 #include "common/common.h"
+#include "event/SocketProfile.h"
+#include "event/AcceptFilter.h"
+#include "event/SessionPool.h"
+#include "event/PacketCompressor.h"
+#include "event/IoUring.h"
+#include "event/EventDispatcher.h"
 
 namespace XServer {
 
+// 合并帧统计， packets为帧中包含的包数
+struct BatchStats
+{
+	BatchStats():
+	frames(0),
+	packets(0),
+	bytes(0),
+	maxPackets(0)
+	{
+	}
+
+	void add(uint32 count, uint32 size)
+	{
+		++frames;
+		packets += count;
+		bytes += size;
+
+		// 只在所属循环中写入
+		if (count > maxPackets)
+			maxPackets = count;
+	}
+
+	std::atomic<uint64> frames;
+	std::atomic<uint64> packets;
+	std::atomic<uint64> bytes;
+	std::atomic<uint32> maxPackets;
+};
+
 class EventDispatcher;
 class TcpSocket;
 class Session;
+class Timer;
 
-class NetworkInterface 
+class NetworkInterface
 {
+public:
+	// 一个事件循环及其拥有的session分片
+	// loops_[0]是主循环(pEventDispatcher_)， 其余为工作线程循环
+	struct Loop
+	{
+		Loop() :
+		index(0),
+		pNetworkInterface(NULL),
+		pEventDispatcher(NULL),
+		pEventListener(NULL),
+		pAcceptOp(NULL),
+		pTimer(NULL),
+		sessions(),
+		pThread(NULL),
+		pDeferredEvent(NULL),
+		deferredActive(false),
+		flushSessions(),
+		closeSessions(),
+		pRecvEvent(NULL),
+		recvScheduled(false),
+		recvSessions(),
+		recvYields(0),
+		corkedPackets(0),
+		corkFlushes(0),
+		compressed(),
+		decompressed(),
+		batchSent(),
+		batchReceived()
+		{
+		}
+
+		int index;
+		NetworkInterface* pNetworkInterface;
+		EventDispatcher* pEventDispatcher;
+		struct evconnlistener* pEventListener;
+
+		// 开启io_uring时由multishot accept接收连接， listener只负责绑定端口
+		IoUring::Op* pAcceptOp;
+
+		Timer* pTimer;
+		SessionSlab sessions;
+		std::thread* pThread;
+
+		// 在本轮事件循环末尾执行： 先写出合并的数据， 再关闭本轮destroy的session
+		struct event* pDeferredEvent;
+		bool deferredActive;
+		std::vector<Session*> flushSessions;
+		std::vector<SessionID> closeSessions;
+
+		// 超出接收预算还有积压的session， 每轮依次各处理一次预算
+		struct event* pRecvEvent;
+		bool recvScheduled;
+		std::deque<SessionID> recvSessions;
+		std::atomic<uint64> recvYields;
+
+		std::atomic<uint64> corkedPackets;
+		std::atomic<uint64> corkFlushes;
+
+		CompressionStats compressed;
+		CompressionStats decompressed;
+
+		BatchStats batchSent;
+		BatchStats batchReceived;
+	};
+
+	typedef std::function<void(Session*)> SessionTask;
+
 public:
 	NetworkInterface(EventDispatcher* pEventDispatcher, bool isInternalNetwork);
 	virtual ~NetworkInterface();
 
-	bool initialize(const std::string& addr, uint16 port);
+	bool initialize(const std::string& addr, uint16 port, int workerLoops = 0);
 	void finalise();
 
 	bool isInternalNetwork() const {
 		return isInternalNetwork_;
 	}
 
+	// 该网络的连接和时间轮的事件优先级， 服务器之间的连接优先于客户端
+	int eventPriority() const {
+		return isInternalNetwork_ ? EVENT_PRIORITY_INTERNAL : EVENT_PRIORITY_EXTERNAL;
+	}
+
 	EventDispatcher* pEventDispatcher() {
 		return pEventDispatcher_;
 	}
 
 	virtual void onListenError();
 
-	typedef std::map<SessionID, Session*> SessionMap;
-	SessionMap& sessions() {
-		return sessions_;
+	size_t sessionNum() const {
+		return sessionNum_;
 	}
 
-	size_t sessionNum() const {
-		return sessions_.size();
+	size_t numLoops() const {
+		return loops_.size();
+	}
+
+	int loopIndex(SessionID id) const {
+		int index = SessionSlab::loopIndex(id);
+		return (index >= (int)loops_.size()) ? 0 : index;
 	}
 
+	EventDispatcher* pEventDispatcher(SessionID id) {
+		return loops_[loopIndex(id)]->pEventDispatcher;
+	}
+
+	Timer* pTimer(SessionID id) {
+		return loops_[loopIndex(id)]->pTimer;
+	}
+
+	// 只能在session所属的循环线程中调用， 跨循环请使用runInSessionLoop
 	Session* findSession(SessionID id)
 	{
-		SessionMap::iterator iter = sessions_.find(id);
-		if (iter != sessions_.end())
-			return iter->second;
-
-		return NULL;
+		return loops_[loopIndex(id)]->sessions.find(id);
 	}
 
 	bool hasSession(SessionID id)
@@ -51,12 +167,73 @@ public:
 		return findSession(id) != NULL;
 	}
 
-	Session* createSession(evutil_socket_t sock);
-	virtual Session* createSession_(SessionID sessionID, evutil_socket_t sock);
-	bool addSession(SessionID id, Session* pSession);
+	// 在session所属的循环中执行task， 找不到session时task收到NULL
+	void runInSessionLoop(SessionID id, const SessionTask& task);
+
+	// 创建的session已经登记在所属循环的句柄表中， 失败时返回NULL
+	Session* createSession(evutil_socket_t sock, int loop = 0);
+	virtual Session* createSession_(SessionID sessionID, evutil_socket_t sock, EventDispatcher* pEventDispatcher);
 	bool removeSession(SessionID id);
 
-	void checkSessions();
+	// 在session所属循环的本轮末尾关闭session， 只能在该循环线程中调用
+	void deferClose(Session* pSession);
+
+	// 第一次应用到连接socket上时输出实际生效的参数
+	void reportSocketProfile(evutil_socket_t sock);
+
+	const SocketProfile& socketProfile() const {
+		return socketProfile_;
+	}
+
+	// 地址白名单和速率限制， 以及接受和拒绝的连接数
+	const AcceptFilter& acceptFilter() const {
+		return acceptFilter_;
+	}
+
+	// 开启后session的写入会被合并， 在事件循环的每轮末尾用一次writev写出
+	void corking(bool v) {
+		corking_ = v;
+	}
+
+	bool corking() const {
+		return corking_;
+	}
+
+	// 只能在session所属的循环线程中调用
+	void onPacketCorked(Session* pSession);
+	void cancelFlush(Session* pSession);
+
+	// 合并的包数量， 以及本轮末尾直接用一次writev写出的次数
+	// 没写完或发送缓冲区非空时剩下的交给bufferevent， 不计入flushes
+	uint64 corkedPackets() const;
+	uint64 corkFlushes() const;
+
+	// 平均每次直接写出合并了多少个包， 不等于节省的系统调用次数
+	double corkPacketsPerFlush() const {
+		uint64 flushes = corkFlushes();
+		return flushes > 0 ? double(corkedPackets()) / flushes : 0.0;
+	}
+
+	// 只能在session所属的循环线程中调用
+	void onPacketCompressed(Session* pSession, uint32 rawSize, uint32 wireSize);
+	void onPacketDecompressed(Session* pSession, uint32 rawSize, uint32 wireSize);
+
+	// sent为true时是发出的包， 否则是收到的包
+	void compressionStats(bool sent, uint64& packets, uint64& rawBytes, uint64& wireBytes) const;
+
+	// 第一个包进入合并缓冲区时调用， 本轮末尾由flush写出； 只能在session所属的循环线程中调用
+	void onPacketBatched(Session* pSession);
+
+	// 接收预算用完时还有完整的包， 排到所属循环的接收队列， 从下一轮开始轮流处理
+	bool onRecvBacklog(Session* pSession);
+
+	// 因为超出接收预算而让出的次数
+	uint64 recvYields() const;
+
+	void onBatchSent(Session* pSession, uint32 packets, uint32 size);
+	void onBatchReceived(Session* pSession, uint32 packets, uint32 size);
+
+	void batchStats(bool sent, uint64& frames, uint64& packets, uint64& bytes, uint32& maxPackets) const;
 
 	uint16 getListenerPort();
 	std::string getListenerIP();
@@ -70,13 +247,44 @@ private:
 		void *ctx);
 
 	static void listenErrorCallback(struct evconnlistener *listener, void *ctx);
+	static void acceptCallback(IoUring::Op* pOp, int res, uint32 flags);
+	static void deferredCallback(evutil_socket_t fd, short events, void *ctx);
+	static void recvQueueCallback(evutil_socket_t fd, short events, void *ctx);
+
+	struct evconnlistener* listener();
+	struct evconnlistener* createListener(Loop* pLoop, struct sockaddr_in& serverAddr, unsigned flags);
+	bool startLoops(int workerLoops);
+	void stopLoops();
+
+	// 按ioBackend配置在每个循环上开启io_uring
+	void setupIOBackend();
+	std::string ioBackendInfo();
+
+	// addr为NULL时由AcceptFilter读取对端地址
+	void dispatchAccepted(Loop* pLoop, evutil_socket_t sock, const struct sockaddr* addr);
+	void rejectAccepted(evutil_socket_t sock);
+	void onAccepted(Loop* pLoop, evutil_socket_t sock);
+	bool activateDeferred(Loop* pLoop);
+	void onDeferred(Loop* pLoop);
+	void onRecvQueue(Loop* pLoop);
+
+	// 登记到本轮末尾写出的列表
+	void scheduleFlush(Loop* pLoop, Session* pSession);
 
 protected:
 	EventDispatcher* pEventDispatcher_;
-	struct evconnlistener *pEventListener_;
 
-	SessionMap sessions_;
+	std::vector<Loop*> loops_;
+	size_t nextLoop_;
+
+	std::atomic<size_t> sessionNum_;
 	bool isInternalNetwork_;
+	bool corking_;
+
+	SocketProfile socketProfile_;
+	std::atomic<bool> socketProfileReported_;
+
+	AcceptFilter acceptFilter_;
 };
 
 }
@@ -0,0 +1,76 @@
+#include "PacketArena.h"
+
+namespace XServer {
+
+namespace {
+
+	struct ArenaState
+	{
+		ArenaState():
+		pBlock(new char[PacketArena::INITIAL_BLOCK_SIZE]),
+		pArena(NULL),
+		depth(0),
+		used(false)
+		{
+			google::protobuf::ArenaOptions options;
+			options.initial_block = pBlock;
+			options.initial_block_size = PacketArena::INITIAL_BLOCK_SIZE;
+			options.start_block_size = PacketArena::INITIAL_BLOCK_SIZE;
+			options.max_block_size = PacketArena::MAX_BLOCK_SIZE;
+
+			pArena = new google::protobuf::Arena(options);
+		}
+
+		~ArenaState()
+		{
+			delete pArena;
+			delete[] pBlock;
+		}
+
+		char* pBlock;
+		google::protobuf::Arena* pArena;
+
+		int depth;
+		bool used;
+	};
+
+	ArenaState& arenaState()
+	{
+		static thread_local ArenaState state;
+		return state;
+	}
+
+}
+
+//-------------------------------------------------------------------------------------
+PacketArena::Batch::Batch()
+{
+	++arenaState().depth;
+}
+
+//-------------------------------------------------------------------------------------
+PacketArena::Batch::~Batch()
+{
+	ArenaState& state = arenaState();
+
+	// 嵌套的批次由最外层统一释放
+	if (--state.depth > 0 || !state.used)
+		return;
+
+	state.used = false;
+	state.pArena->Reset();
+}
+
+//-------------------------------------------------------------------------------------
+google::protobuf::Arena* PacketArena::current()
+{
+	ArenaState& state = arenaState();
+	if (state.depth <= 0)
+		return NULL;
+
+	state.used = true;
+	return state.pArena;
+}
+
+//-------------------------------------------------------------------------------------
+}
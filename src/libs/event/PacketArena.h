@@ -0,0 +1,36 @@
+#ifndef X_PACKET_ARENA_H
+#define X_PACKET_ARENA_H
+
+#include "common/common.h"
+#include <google/protobuf/arena.h>
+
+namespace XServer {
+
+/*
+	收包时解析协议使用的Arena， 每个线程(即每个事件循环)一个
+	Session::onRecv中一次处理的所有包共用一个批次， 批次结束时统一Reset， 处理函数不能保存收到的协议的指针
+*/
+class PacketArena
+{
+public:
+	enum
+	{
+		// 第一块内存在Reset后保留， 普通批次不需要再向系统申请内存
+		INITIAL_BLOCK_SIZE = 64 * 1024,
+		MAX_BLOCK_SIZE = 1024 * 1024,
+	};
+
+	class Batch
+	{
+	public:
+		Batch();
+		~Batch();
+	};
+
+	// 不在批次中时返回NULL， 调用者在栈上构造协议
+	static google::protobuf::Arena* current();
+};
+
+}
+
+#endif // X_PACKET_ARENA_H
@@ -0,0 +1,504 @@
+#include "PacketCompressor.h"
+#include "protos/Commands.pb.h"
+#include "log/XLog.h"
+#include "resmgr/ResMgr.h"
+
+namespace XServer {
+
+namespace {
+
+	inline uint32 read32(const uint8* p)
+	{
+		uint32 v;
+		memcpy(&v, p, sizeof(v));
+		return v;
+	}
+
+	inline uint32 hash32(uint32 v)
+	{
+		return (v * 2654435761U) >> (32 - LzCodec::HASH_LOG);
+	}
+
+	inline void writeLength(uint8*& op, uint32 length)
+	{
+		while (length >= 255)
+		{
+			*op++ = 255;
+			length -= 255;
+		}
+
+		*op++ = (uint8)length;
+	}
+
+	inline bool readLength(const uint8* src, uint32 size, uint32& ip, uint32& length)
+	{
+		uint8 b = 0;
+
+		do
+		{
+			if (ip >= size || length > FRAME_LENGTH_MAX)
+				return false;
+
+			b = src[ip++];
+			length += b;
+		} while (b == 255);
+
+		return true;
+	}
+
+	// matchLength为0时是最后一段， 只有字面量
+	bool writeSequence(uint8*& op, const uint8* opEnd, const uint8* literals, uint32 literalLength, uint32 offset, uint32 matchLength)
+	{
+		size_t need = 1 + literalLength / 255 + 1 + literalLength + 2 + matchLength / 255 + 1;
+		if ((size_t)(opEnd - op) < need)
+			return false;
+
+		uint8* token = op++;
+		*token = (uint8)((literalLength >= 15 ? 15 : literalLength) << 4);
+
+		if (literalLength >= 15)
+			writeLength(op, literalLength - 15);
+
+		memcpy(op, literals, literalLength);
+		op += literalLength;
+
+		if (matchLength == 0)
+			return true;
+
+		*op++ = (uint8)(offset & 0xff);
+		*op++ = (uint8)(offset >> 8);
+
+		uint32 length = matchLength - LzCodec::MIN_MATCH;
+		*token |= (uint8)(length >= 15 ? 15 : length);
+
+		if (length >= 15)
+			writeLength(op, length - 15);
+
+		return true;
+	}
+
+}
+
+//-------------------------------------------------------------------------------------
+LzCodec::LzCodec():
+window_(),
+dictSize_(0),
+dictTable_(),
+table_(HASH_SIZE, 0)
+{
+}
+
+//-------------------------------------------------------------------------------------
+LzCodec::~LzCodec()
+{
+}
+
+//-------------------------------------------------------------------------------------
+void LzCodec::dictionary(const std::string& dict)
+{
+	dictTable_.clear();
+	dictSize_ = 0;
+
+	if (dict.size() < MIN_MATCH)
+		return;
+
+	size_t size = std::min<size_t>(dict.size(), DICT_SIZE_MAX);
+	window_.assign(dict.end() - size, dict.end());
+	dictSize_ = (uint32)size;
+
+	dictTable_.assign(HASH_SIZE, 0);
+	for (uint32 i = 0; i + MIN_MATCH <= dictSize_; ++i)
+		dictTable_[hash32(read32(&window_[i]))] = i;
+}
+
+//-------------------------------------------------------------------------------------
+uint32 LzCodec::compress(const uint8* src, uint32 size, uint8* dst, uint32 capacity)
+{
+	const uint8* base = src;
+	uint32 start = 0;
+
+	if (dictSize_ > 0)
+	{
+		if (window_.size() < dictSize_ + size)
+			window_.resize(dictSize_ + size);
+
+		memcpy(&window_[dictSize_], src, size);
+		memcpy(&table_[0], &dictTable_[0], HASH_SIZE * sizeof(uint32));
+
+		base = &window_[0];
+		start = dictSize_;
+	}
+
+	// 没有字典时hash表不清空， 旧的位置在下面比较内容时会被过滤掉
+	uint8* op = dst;
+	const uint8* opEnd = dst + capacity;
+
+	uint32 end = start + size;
+	uint32 anchor = start;
+	uint32 ip = start;
+
+	if (size > MATCH_LIMIT)
+	{
+		uint32 limit = end - MATCH_LIMIT;
+		uint32 matchEnd = end - LAST_LITERALS;
+
+		while (ip < limit)
+		{
+			uint32 sequence = read32(base + ip);
+			uint32 h = hash32(sequence);
+			uint32 ref = table_[h];
+			table_[h] = ip;
+
+			if (ref >= ip || ip - ref > MAX_OFFSET || read32(base + ref) != sequence)
+			{
+				// 长时间找不到匹配时加大步长， 不可压缩的数据很快跳过
+				ip += 1 + ((ip - anchor) >> 6);
+				continue;
+			}
+
+			while (ip > anchor && ref > 0 && base[ip - 1] == base[ref - 1])
+			{
+				--ip;
+				--ref;
+			}
+
+			uint32 length = MIN_MATCH;
+			while (ip + length < matchEnd && base[ref + length] == base[ip + length])
+				++length;
+
+			if (!writeSequence(op, opEnd, base + anchor, ip - anchor, ip - ref, length))
+				return 0;
+
+			ip += length;
+			anchor = ip;
+
+			if (ip - 2 < limit)
+				table_[hash32(read32(base + ip - 2))] = ip - 2;
+		}
+	}
+
+	if (!writeSequence(op, opEnd, base + anchor, end - anchor, 0, 0))
+		return 0;
+
+	return (uint32)(op - dst);
+}
+
+//-------------------------------------------------------------------------------------
+const uint8* LzCodec::decompress(const uint8* src, uint32 size, uint32 originalSize)
+{
+	if (size == 0 || originalSize == 0)
+		return NULL;
+
+	if (window_.size() < dictSize_ + originalSize)
+		window_.resize(dictSize_ + originalSize);
+
+	uint8* base = &window_[0];
+	uint32 op = dictSize_;
+	uint32 end = dictSize_ + originalSize;
+	uint32 ip = 0;
+
+	while (true)
+	{
+		if (ip >= size)
+			return NULL;
+
+		uint8 token = src[ip++];
+
+		uint32 literalLength = token >> 4;
+		if (literalLength == 15 && !readLength(src, size, ip, literalLength))
+			return NULL;
+
+		if (literalLength > end - op || literalLength > size - ip)
+			return NULL;
+
+		memcpy(base + op, src + ip, literalLength);
+		op += literalLength;
+		ip += literalLength;
+
+		if (ip == size)
+			break;
+
+		if (size - ip < 2)
+			return NULL;
+
+		uint32 offset = src[ip] | ((uint32)src[ip + 1] << 8);
+		ip += 2;
+
+		// 可以引用到字典中的内容， 但不能超出窗口
+		if (offset == 0 || offset > op)
+			return NULL;
+
+		uint32 length = token & 15;
+		if (length == 15 && !readLength(src, size, ip, length))
+			return NULL;
+
+		length += MIN_MATCH;
+		if (length > end - op)
+			return NULL;
+
+		uint8* d = base + op;
+		const uint8* s = d - offset;
+
+		// 重叠时必须逐字节复制， 重复的内容由此展开
+		if (offset >= length)
+		{
+			memcpy(d, s, length);
+		}
+		else
+		{
+			for (uint32 i = 0; i < length; ++i)
+				d[i] = s[i];
+		}
+
+		op += length;
+	}
+
+	if (op != end)
+		return NULL;
+
+	return base + dictSize_;
+}
+
+//-------------------------------------------------------------------------------------
+namespace {
+
+	struct DictionaryState
+	{
+		DictionaryState():
+		id(0),
+		data(),
+		training(false)
+		{
+			for (int32 i = 0; i <= CMD_MAX; ++i)
+			{
+				counts[i] = 0;
+				sampled[i] = false;
+			}
+		}
+
+		uint32 id;
+		std::string data;
+
+		// 主线程在initialize和finalise中修改， 工作线程的循环在收发包时读取
+		std::atomic<bool> training;
+		std::atomic<uint64> counts[CMD_MAX + 1];
+		std::atomic<bool> sampled[CMD_MAX + 1];
+		std::string samples[CMD_MAX + 1];
+		std::mutex mutex;
+	};
+
+	DictionaryState& dictionaryState()
+	{
+		static DictionaryState state;
+		return state;
+	}
+
+	struct Codecs
+	{
+		Codecs()
+		{
+			const std::string& dict = dictionaryState().data;
+			dictCompressor.dictionary(dict);
+			dictDecompressor.dictionary(dict);
+		}
+
+		LzCodec compressor;
+		LzCodec decompressor;
+		LzCodec dictCompressor;
+		LzCodec dictDecompressor;
+	};
+
+	// 第一次使用在initialize之后， 此时字典已经加载
+	Codecs& codecs()
+	{
+		static thread_local Codecs codecs;
+		return codecs;
+	}
+
+	uint32 dictionaryHash(const std::string& data)
+	{
+		// FNV-1a
+		uint32 h = 2166136261U;
+		for (auto c : data)
+		{
+			h ^= (uint8)c;
+			h *= 16777619U;
+		}
+
+		return h == 0 ? 1 : h;
+	}
+
+}
+
+//-------------------------------------------------------------------------------------
+bool PacketCompressor::initialize()
+{
+	const ResMgr::ServerConfig& cfg = ResMgr::getSingleton().serverConfig();
+	DictionaryState& state = dictionaryState();
+
+	state.training.store(cfg.compressDictTrain && cfg.compressDict.size() > 0, std::memory_order_release);
+
+	if (cfg.compressDict.size() == 0)
+		return true;
+
+	FILE* f = ResMgr::getSingleton().openRes(cfg.compressDict, "rb");
+	if (!f)
+	{
+		// 训练时字典文件还不存在
+		if (!training())
+		{
+			ERROR_MSG(fmt::format("PacketCompressor::initialize(): not found dictionary: {}\n", cfg.compressDict));
+		}
+
+		return training();
+	}
+
+	char buffer[4096];
+	size_t n = 0;
+	while ((n = fread(buffer, 1, sizeof(buffer), f)) > 0)
+		state.data.append(buffer, n);
+
+	fclose(f);
+
+	if (state.data.size() > LzCodec::DICT_SIZE_MAX)
+		state.data.erase(0, state.data.size() - LzCodec::DICT_SIZE_MAX);
+
+	state.id = state.data.size() >= LzCodec::MIN_MATCH ? dictionaryHash(state.data) : 0;
+
+	INFO_MSG(fmt::format("PacketCompressor::initialize(): dictionary={}, size={}, id={}, training={}\n",
+		cfg.compressDict, state.data.size(), state.id, training()));
+
+	return true;
+}
+
+//-------------------------------------------------------------------------------------
+void PacketCompressor::finalise()
+{
+	DictionaryState& state = dictionaryState();
+	// 之后工作线程不再采样， 已经进入sample的会在下面的锁上等待
+	if (!state.training.exchange(false, std::memory_order_acq_rel))
+		return;
+
+	std::lock_guard<std::mutex> lock(state.mutex);
+
+	std::vector<int32> cmds;
+	for (int32 i = 0; i <= CMD_MAX; ++i)
+	{
+		if (state.samples[i].size() > 0)
+			cmds.push_back(i);
+	}
+
+	if (cmds.empty())
+		return;
+
+	// 发送次数越多的协议越靠近字典末尾， offset短， 字典被截断时也最后被丢弃
+	std::sort(cmds.begin(), cmds.end(), [&state](int32 a, int32 b) {
+		return state.counts[a] > state.counts[b];
+	});
+
+	std::vector<int32> selected;
+	size_t size = 0;
+	for (auto cmd : cmds)
+	{
+		if (size + state.samples[cmd].size() > LzCodec::DICT_SIZE_MAX)
+			break;
+
+		size += state.samples[cmd].size();
+		selected.push_back(cmd);
+	}
+
+	std::string dict;
+	dict.reserve(size);
+	for (auto iter = selected.rbegin(); iter != selected.rend(); ++iter)
+		dict.append(state.samples[*iter]);
+
+	std::string path = ResMgr::getSingleton().env().res_path + ResMgr::getSingleton().serverConfig().compressDict;
+	FILE* f = fopen(path.c_str(), "wb");
+	if (!f)
+	{
+		ERROR_MSG(fmt::format("PacketCompressor::finalise(): can't write dictionary: {}\n", path));
+		return;
+	}
+
+	fwrite(dict.data(), 1, dict.size(), f);
+	fclose(f);
+
+	INFO_MSG(fmt::format("PacketCompressor::finalise(): trained dictionary: {}, size={}, cmds={}/{}\n",
+		path, dict.size(), selected.size(), cmds.size()));
+}
+
+//-------------------------------------------------------------------------------------
+uint32 PacketCompressor::dictionaryID()
+{
+	return dictionaryState().id;
+}
+
+//-------------------------------------------------------------------------------------
+bool PacketCompressor::training()
+{
+	return dictionaryState().training.load(std::memory_order_acquire);
+}
+
+//-------------------------------------------------------------------------------------
+void PacketCompressor::sample(int32 cmd, const uint8* data, uint32 size)
+{
+	if (cmd < 0 || cmd > CMD_MAX || size == 0)
+		return;
+
+	DictionaryState& state = dictionaryState();
+	++state.counts[cmd];
+
+	if (state.sampled[cmd])
+		return;
+
+	std::lock_guard<std::mutex> lock(state.mutex);
+	if (state.sampled[cmd])
+		return;
+
+	state.samples[cmd].assign((const char*)data, std::min<uint32>(size, SAMPLE_SIZE_MAX));
+	state.sampled[cmd] = true;
+}
+
+//-------------------------------------------------------------------------------------
+uint32 PacketCompressor::compress(bool useDictionary, const uint8* src, uint32 size, uint8* dst, uint32 capacity)
+{
+	if (capacity <= PREFIX_SIZE || size <= PREFIX_SIZE)
+		return 0;
+
+	Codecs& c = codecs();
+	LzCodec& codec = useDictionary ? c.dictCompressor : c.compressor;
+
+	uint32 compressed = codec.compress(src, size, dst + PREFIX_SIZE, std::min<uint32>(capacity, size) - PREFIX_SIZE);
+	if (compressed == 0)
+		return 0;
+
+	uint32 originalSize = htonl(size);
+	memcpy(dst, &originalSize, PREFIX_SIZE);
+	return PREFIX_SIZE + compressed;
+}
+
+//-------------------------------------------------------------------------------------
+const uint8* PacketCompressor::decompress(bool useDictionary, const uint8* src, uint32 size, uint32* pOriginalSize)
+{
+	if (size <= PREFIX_SIZE)
+		return NULL;
+
+	uint32 originalSize = 0;
+	memcpy(&originalSize, src, PREFIX_SIZE);
+	originalSize = ntohl(originalSize);
+
+	if (originalSize == 0 || originalSize > FRAME_LENGTH_MAX)
+		return NULL;
+
+	Codecs& c = codecs();
+	LzCodec& codec = useDictionary ? c.dictDecompressor : c.decompressor;
+
+	const uint8* data = codec.decompress(src + PREFIX_SIZE, size - PREFIX_SIZE, originalSize);
+	if (data)
+		*pOriginalSize = originalSize;
+
+	return data;
+}
+
+//-------------------------------------------------------------------------------------
+}
@@ -0,0 +1,120 @@
+#ifndef X_PACKET_COMPRESSOR_H
+#define X_PACKET_COMPRESSOR_H
+
+#include "common/common.h"
+
+namespace XServer {
+
+/*
+	LZ77类的块压缩， 输出格式与LZ4的block格式相同:
+	token(高4位字面量长度， 低4位匹配长度-4) | 字面量长度扩展 | 字面量 | offset(2字节小端) | 匹配长度扩展
+	字典放在窗口的最前面， 匹配可以引用字典中的内容， 对短小的协议效果明显
+	压缩和解压使用各自的实例， 不是线程安全的
+*/
+class LzCodec
+{
+public:
+	enum
+	{
+		HASH_LOG = 12,
+		HASH_SIZE = 1 << HASH_LOG,
+		MAX_OFFSET = 65535,
+		MIN_MATCH = 4,
+
+		// 最后5个字节总是字面量， 最后一个匹配至少在结尾前12个字节开始
+		LAST_LITERALS = 5,
+		MATCH_LIMIT = 12,
+
+		// 只保留字典最后这么多字节， 保证字典中的内容都能被引用到
+		DICT_SIZE_MAX = 32 * 1024,
+	};
+
+	LzCodec();
+	~LzCodec();
+
+	void dictionary(const std::string& dict);
+
+	uint32 dictionarySize() const {
+		return dictSize_;
+	}
+
+	// 返回压缩后的长度， 输出超过capacity时返回0
+	uint32 compress(const uint8* src, uint32 size, uint8* dst, uint32 capacity);
+
+	// 解压后的数据在内部窗口中， 下次调用前有效， 失败返回NULL
+	const uint8* decompress(const uint8* src, uint32 size, uint32 originalSize);
+
+	static uint32 compressBound(uint32 size) {
+		return size + size / 255 + 16;
+	}
+
+private:
+	// 窗口: [字典][数据]
+	std::vector<uint8> window_;
+	uint32 dictSize_;
+
+	// 字典各位置的hash表， 每次压缩前复制到table_
+	std::vector<uint32> dictTable_;
+	std::vector<uint32> table_;
+};
+
+// 压缩统计， raw为压缩前的字节数， wire为实际收发的包体字节数
+struct CompressionStats
+{
+	CompressionStats():
+	packets(0),
+	rawBytes(0),
+	wireBytes(0)
+	{
+	}
+
+	void add(uint32 rawSize, uint32 wireSize)
+	{
+		++packets;
+		rawBytes += rawSize;
+		wireBytes += wireSize;
+	}
+
+	std::atomic<uint64> packets;
+	std::atomic<uint64> rawBytes;
+	std::atomic<uint64> wireBytes;
+};
+
+/*
+	包体压缩， 压缩后的包体前4字节(网络字节序)是原始长度
+	compressDict配置的字典文件两端ID相同时才使用， 否则不带字典压缩
+	compressDictTrain开启时采样发送的各协议包体， 退出时按出现次数写成字典文件
+*/
+class PacketCompressor
+{
+public:
+	enum
+	{
+		PREFIX_SIZE = 4,
+
+		// 每个协议只采样第一个包的前这么多字节
+		SAMPLE_SIZE_MAX = 1024,
+	};
+
+	// 根据配置加载字典， 在创建网络接口之前调用
+	static bool initialize();
+	static void finalise();
+
+	// 0表示没有字典
+	static uint32 dictionaryID();
+
+	static bool training();
+	static void sample(int32 cmd, const uint8* data, uint32 size);
+
+	// 使用当前线程的压缩器， 压缩后比原来大时返回0
+	static uint32 compress(bool useDictionary, const uint8* src, uint32 size, uint8* dst, uint32 capacity);
+	static const uint8* decompress(bool useDictionary, const uint8* src, uint32 size, uint32* pOriginalSize);
+
+	static uint32 compressBound(uint32 size) {
+		return PREFIX_SIZE + LzCodec::compressBound(size);
+	}
+};
+
+}
+
+#endif // X_PACKET_COMPRESSOR_H
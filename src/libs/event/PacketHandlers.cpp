@@ -0,0 +1,91 @@
+#include "PacketHandlers.h"
+#include "log/XLog.h"
+
+namespace XServer {
+
+static std::mutex& tablesMutex()
+{
+	static std::mutex mutex;
+	return mutex;
+}
+
+static std::vector<PacketHandlers*>& tables()
+{
+	static std::vector<PacketHandlers*> tables;
+	return tables;
+}
+
+//-------------------------------------------------------------------------------------
+PacketHandlers::PacketHandlers(const char* name, Registrar registrar):
+name_(name),
+entries_(new Entry[CMD_MAX + 1])
+{
+	for (int32 i = 0; i <= CMD_MAX; ++i)
+	{
+		Entry& entry = entries_[i];
+		entry.invoke = NULL;
+		entry.method = NULL;
+		entry.kinds = 0;
+		entry.packets = 0;
+		entry.bytes = 0;
+		entry.parseErrors = 0;
+		entry.rejected = 0;
+	}
+
+	registrar(*this);
+
+	std::lock_guard<std::mutex> lock(tablesMutex());
+	tables().push_back(this);
+}
+
+//-------------------------------------------------------------------------------------
+PacketHandlers::~PacketHandlers()
+{
+	{
+		std::lock_guard<std::mutex> lock(tablesMutex());
+		std::vector<PacketHandlers*>& items = tables();
+		items.erase(std::remove(items.begin(), items.end(), this), items.end());
+	}
+
+	delete[] entries_;
+	entries_ = NULL;
+}
+
+//-------------------------------------------------------------------------------------
+void PacketHandlers::add(int32 cmd, Invoker invoker, Method method, uint8 kinds)
+{
+	Entry& entry = entries_[cmd];
+
+	// 子类重新注册时覆盖基类的处理函数
+	if (entry.invoke)
+	{
+		DEBUG_MSG(fmt::format("PacketHandlers::add(): {} override handler of {}!\n", name_, CMD_Name((CMD)cmd)));
+	}
+
+	entry.invoke = invoker;
+	entry.method = method;
+	entry.kinds = kinds;
+}
+
+//-------------------------------------------------------------------------------------
+void PacketHandlers::dumpStats()
+{
+	std::lock_guard<std::mutex> lock(tablesMutex());
+
+	for (auto& pHandlers : tables())
+	{
+		for (int32 i = 0; i <= CMD_MAX; ++i)
+		{
+			const Entry& entry = pHandlers->entries_[i];
+			if (!entry.invoke || (entry.packets == 0 && entry.rejected == 0))
+				continue;
+
+			INFO_MSG(fmt::format("PacketHandlers::dumpStats(): {}: {}, packets={}, bytes={}, parseErrors={}, rejected={}\n",
+				pHandlers->name(), CMD_Name((CMD)i), entry.packets.load(), entry.bytes.load(),
+				entry.parseErrors.load(), entry.rejected.load()));
+		}
+	}
+}
+
+//-------------------------------------------------------------------------------------
+}
@@ -0,0 +1,150 @@
+#ifndef X_PACKET_HANDLERS_H
+#define X_PACKET_HANDLERS_H
+
+#include "common/common.h"
+#include "protos/Commands.pb.h"
+#include "event/PacketArena.h"
+
+namespace XServer {
+
+class Session;
+
+// 允许发送某个协议的session类型
+enum SessionKind
+{
+	SESSION_KIND_CLIENT = 0x01,		// 外部网络的客户端
+	SESSION_KIND_SERVER = 0x02,		// 服务器之间的连接
+	SESSION_KIND_ANY = SESSION_KIND_CLIENT | SESSION_KIND_SERVER,
+};
+
+/*
+	协议处理表， 以CMD为下标， 每种session类型一张， 启动后第一次使用时建立
+	registerHandler<CMD::Halls_StartMatch, CMD_Halls_StartMatch>(&XSession::onStartMatch, SESSION_KIND_SERVER);
+	处理函数可以是 void/bool (S::*)(const T&) 或 void/bool (S::*)(SessionID requestorSessionID, const T&)
+*/
+class PacketHandlers
+{
+public:
+	enum Result
+	{
+		RESULT_OK = 0,
+		RESULT_FAILED = 1,			// 处理函数返回false
+		RESULT_PARSE_ERROR = 2,
+	};
+
+	typedef void (Session::*Method)();
+	typedef Result (*Invoker)(Session* pSession, Method method, SessionID requestorSessionID, const uint8* data, uint32 size);
+
+	struct Entry
+	{
+		Invoker invoke;
+		Method method;
+		uint8 kinds;
+
+		// 同一张表被所有循环上的session共用
+		std::atomic<uint64> packets;
+		std::atomic<uint64> bytes;
+		std::atomic<uint64> parseErrors;
+		std::atomic<uint64> rejected;
+	};
+
+	typedef void (*Registrar)(PacketHandlers& handlers);
+
+public:
+	PacketHandlers(const char* name, Registrar registrar);
+	~PacketHandlers();
+
+	const char* name() const {
+		return name_;
+	}
+
+	Entry* find(int32 cmd) {
+		if (cmd < 0 || cmd > CMD_MAX || !entries_[cmd].invoke)
+			return NULL;
+
+		return &entries_[cmd];
+	}
+
+	template<CMD cmd, typename T, typename S>
+	void registerHandler(void (S::*method)(const T&), uint8 kinds = SESSION_KIND_ANY) {
+		add<cmd>(&invoke<S, T, void (S::*)(const T&)>, reinterpret_cast<Method>(method), kinds);
+	}
+
+	template<CMD cmd, typename T, typename S>
+	void registerHandler(bool (S::*method)(const T&), uint8 kinds = SESSION_KIND_ANY) {
+		add<cmd>(&invoke<S, T, bool (S::*)(const T&)>, reinterpret_cast<Method>(method), kinds);
+	}
+
+	template<CMD cmd, typename T, typename S>
+	void registerHandler(void (S::*method)(SessionID, const T&), uint8 kinds = SESSION_KIND_ANY) {
+		add<cmd>(&invoke<S, T, void (S::*)(SessionID, const T&)>, reinterpret_cast<Method>(method), kinds);
+	}
+
+	template<CMD cmd, typename T, typename S>
+	void registerHandler(bool (S::*method)(SessionID, const T&), uint8 kinds = SESSION_KIND_ANY) {
+		add<cmd>(&invoke<S, T, bool (S::*)(SessionID, const T&)>, reinterpret_cast<Method>(method), kinds);
+	}
+
+	// 输出所有表中收到过的协议的统计
+	static void dumpStats();
+
+private:
+	template<CMD cmd>
+	void add(Invoker invoker, Method method, uint8 kinds) {
+		static_assert(cmd > 0 && cmd <= CMD_MAX, "invalid cmd");
+		add((int32)cmd, invoker, method, kinds);
+	}
+
+	void add(int32 cmd, Invoker invoker, Method method, uint8 kinds);
+
+	template<typename S, typename T>
+	static bool call(S* pSession, void (S::*method)(const T&), SessionID requestorSessionID, const T& packet) {
+		(pSession->*method)(packet);
+		return true;
+	}
+
+	template<typename S, typename T>
+	static bool call(S* pSession, bool (S::*method)(const T&), SessionID requestorSessionID, const T& packet) {
+		return (pSession->*method)(packet);
+	}
+
+	template<typename S, typename T>
+	static bool call(S* pSession, void (S::*method)(SessionID, const T&), SessionID requestorSessionID, const T& packet) {
+		(pSession->*method)(requestorSessionID, packet);
+		return true;
+	}
+
+	template<typename S, typename T>
+	static bool call(S* pSession, bool (S::*method)(SessionID, const T&), SessionID requestorSessionID, const T& packet) {
+		return (pSession->*method)(requestorSessionID, packet);
+	}
+
+	template<typename S, typename T, typename M>
+	static Result handle(S* pSession, Method method, SessionID requestorSessionID, T& packet, const uint8* data, uint32 size) {
+		if (!pSession->parsePacket(packet, data, size))
+			return RESULT_PARSE_ERROR;
+
+		return call(pSession, reinterpret_cast<M>(method), requestorSessionID, packet) ? RESULT_OK : RESULT_FAILED;
+	}
+
+	template<typename S, typename T, typename M>
+	static Result invoke(Session* pSession, Method method, SessionID requestorSessionID, const uint8* data, uint32 size) {
+		S* pS = static_cast<S*>(pSession);
+
+		// 在批次中时协议及其所有字段都分配在Arena上
+		google::protobuf::Arena* pArena = PacketArena::current();
+		if (pArena)
+			return handle<S, T, M>(pS, method, requestorSessionID, *google::protobuf::Arena::CreateMessage<T>(pArena), data, size);
+
+		T packet;
+		return handle<S, T, M>(pS, method, requestorSessionID, packet, data, size);
+	}
+
+private:
+	const char* name_;
+	Entry* entries_;
+};
+
+}
+
+#endif // X_PACKET_HANDLERS_H
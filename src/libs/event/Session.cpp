@@ -2,28 +2,94 @@
 #include "EventDispatcher.h"
 #include "NetworkInterface.h"
 #include "TcpSocket.h"
+#include "EvbufferStream.h"
+#include "PacketCompressor.h"
+#include "SessionCipher.h"
+#include "ShmChannel.h"
+#include "BufferPool.h"
 #include "log/XLog.h"
 #include "server/XServerBase.h"
 #include "resmgr/ResMgr.h"
 #include "event/Timer.h"
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/descriptor.h>
 
 namespace XServer {
 
+// 在作用域内指定写入的包的优先级， 离开时恢复
+class SendPriorityScope
+{
+public:
+	SendPriorityScope(int8& priority, int8 v):
+	priority_(priority),
+	saved_(priority)
+	{
+		priority_ = v;
+	}
+
+	~SendPriorityScope()
+	{
+		priority_ = saved_;
+	}
+
+private:
+	int8& priority_;
+	int8 saved_;
+};
+
 //-------------------------------------------------------------------------------------
 Session::Session(SessionID sessionID, socket_t sock, NetworkInterface* pNetworkInterface, EventDispatcher* pEventDispatcher):
 id_(sessionID),
 pNetworkInterface_(pNetworkInterface),
 pEventDispatcher_(pEventDispatcher),
 pTcpSocket_(new TcpSocket(pEventDispatcher, sock)),
-headerRcved_(false),
 header_(),
+recvPacketLength_(0),
+pRecvBody_(NULL),
+recvBodyOffset_(0),
+pChunkBuffer_(NULL),
+chunkCmd_(0),
+sendFrameVersion_(FRAME_VERSION_1),
+recvFrameVersion_(FRAME_VERSION_1),
+compression_(PACKET_COMPRESSION_NONE),
+compressDict_(false),
+compressThreshold_(0),
+pBatchBuffer_(NULL),
+batchMax_(0),
+batchPackets_(0),
+batchPriority_(SEND_PRIORITY_BULK),
+pSendQueues_(),
+priorityQueued_(0),
+priorityLowat_(0),
+priorityFrames_(),
+sendPriority_(-1),
+chunkPriority_(-1),
+pCipher_(NULL),
+sendEncrypted_(false),
+recvEncrypted_(false),
+dispatching_(false),
+closePending_(false),
+flushPending_(false),
+pReservedChunk_(NULL),
+recvBudget_(0),
+recvBudgetBytes_(0),
+recvQueued_(false),
+sendQueueMax_(0),
+sendQueuePolicy_(SENDQUEUE_POLICY_DROP_SESSION),
+sendQueueFull_(false),
+recvPauses_(0),
+sendQueuePeak_(0),
+sendQueueOverflows_(0),
+droppedPackets_(0),
+droppedBytes_(0),
 isServer_(false),
 connected_(false),
 lastReceivedTime_(0),
 appID_(0),
 appType_(ServerType::SERVER_TYPE_UNKNOWN),
 rtt_(-1),
-destroyTimerEvent_(NULL)
+destroyed_(false),
+livenessTimerEvent_(TIMER_HANDLE_INVALID)
 {
 }
 
@@ -60,8 +126,28 @@ bool Session::initialize()
 		return false;
 	}
 
+	if (pNetworkInterface_->corking())
+		pTcpSocket_->cork(true);
+
+	pTcpSocket_->setPriority(pNetworkInterface_->eventPriority());
+
+	const ResMgr::ServerConfig& cfg = ResMgr::getSingleton().serverConfig();
+	sendQueueMax_ = pNetworkInterface_->isInternalNetwork() ? cfg.internal_SNDQUEUE_MAX : cfg.external_SNDQUEUE_MAX;
+	sendQueuePolicy_ = pNetworkInterface_->isInternalNetwork() ? cfg.internal_SNDQUEUE_POLICY : cfg.external_SNDQUEUE_POLICY;
+	compressThreshold_ = std::max<uint32>(cfg.compressThreshold, PacketCompressor::PREFIX_SIZE + 1);
+	recvBudget_ = pNetworkInterface_->isInternalNetwork() ? cfg.internal_RECV_BUDGET : cfg.external_RECV_BUDGET;
+	recvBudgetBytes_ = pNetworkInterface_->isInternalNetwork() ? cfg.internal_RECV_BUDGET_BYTES : cfg.external_RECV_BUDGET_BYTES;
+
+	// 发送队列降到上限的一半时回调onSent， 解除满的状态
+	if (sendQueueMax_ > 0)
+		pTcpSocket_->setSendLowWatermark(sendQueueMax_ / 2);
+
 	lastReceivedTime_ = getTimeStamp();
 
+	time_t timeout_time = (ResMgr::getSingleton().serverConfig().heartbeatInterval * 2);
+	if (timeout_time > 0)
+		addLivenessTimer((uint32)timeout_time);
+
 	appID_ = 0;
 	appType_ = ServerType::SERVER_TYPE_UNKNOWN;
 
@@ -71,361 +157,2273 @@ bool Session::initialize()
 //-------------------------------------------------------------------------------------
 void Session::finalise(void)
 {
+	if (livenessTimerEvent_)
+	{
+		pNetworkInterface_->pTimer(id_)->delTimer(livenessTimerEvent_);
+		livenessTimerEvent_ = TIMER_HANDLE_INVALID;
+	}
+
+	if (flushPending_)
+		pNetworkInterface_->cancelFlush(this);
+
+	if (pChunkBuffer_)
+	{
+		evbuffer_free(pChunkBuffer_);
+		pChunkBuffer_ = NULL;
+	}
+
+	BufferPool::release(pReservedChunk_);
+	pReservedChunk_ = NULL;
+
+	if (pBatchBuffer_)
+	{
+		evbuffer_free(pBatchBuffer_);
+		pBatchBuffer_ = NULL;
+	}
+
+	batchMax_ = batchPackets_ = 0;
+
+	for (int i = 0; i < SEND_PRIORITY_MAX; ++i)
+	{
+		if (pSendQueues_[i])
+		{
+			evbuffer_free(pSendQueues_[i]);
+			pSendQueues_[i] = NULL;
+		}
+	}
+
+	priorityQueued_ = priorityLowat_ = 0;
+	chunkPriority_ = -1;
+
+	SAFE_RELEASE(pCipher_);
+	sendEncrypted_ = recvEncrypted_ = false;
+
 	id_ = SESSION_ID_INVALID;
 	pNetworkInterface_ = NULL;
 	pEventDispatcher_ = NULL;
 
 	SAFE_RELEASE(pTcpSocket_);
+}
+
+//-------------------------------------------------------------------------------------
+std::string Session::getIP()
+{
+	if (!pTcpSocket_)
+		return "";
+
+	return pTcpSocket_->getIP();
+}
+
+//-------------------------------------------------------------------------------------
+uint16 Session::getPort()
+{
+	if (!pTcpSocket_)
+		return 0;
+
+	return pTcpSocket_->getPort();
+}
+
+//-------------------------------------------------------------------------------------
+void Session::addLivenessTimer(uint32 delay)
+{
+	livenessTimerEvent_ = pNetworkInterface_->pTimer(id_)->addTimer(delay, 1,
+		std::bind(&Session::onLivenessTimer, this, std::placeholders::_1), NULL);
+}
 
-	if (destroyTimerEvent_)
+//-------------------------------------------------------------------------------------
+void Session::onLivenessTimer(void* userargs)
+{
+	livenessTimerEvent_ = TIMER_HANDLE_INVALID;
+
+	// 期间收到过数据， 按最后一次收到数据的时间重新计时
+	time_t timeout_time = (ResMgr::getSingleton().serverConfig().heartbeatInterval * 2);
+	time_t diff = getTimeStamp() - lastReceivedTime_;
+	if (diff < timeout_time)
 	{
-		XServerBase::getSingleton().pTimer()->delTimer(destroyTimerEvent_);
-		destroyTimerEvent_ = NULL;
+		addLivenessTimer((uint32)(timeout_time - diff));
+		return;
 	}
+
+	DEBUG_MSG(fmt::format("Session::onLivenessTimer(): session timeout! sessionID={}, addr={}!\n",
+		id(), addr()));
+
+	destroy();
 }
 
 //-------------------------------------------------------------------------------------
-std::string Session::getIP()
+void Session::destroy()
+{
+	if (destroyed_)
+		return;
+
+	// 在session所属循环本轮事件处理完之后关闭， 当前回调中仍可安全使用this
+	destroyed_ = true;
+	pNetworkInterface_->deferClose(this);
+}
+
+//-------------------------------------------------------------------------------------
+bool Session::send(const uint8 *data, uint32 size)
 {
 	if (!pTcpSocket_)
-		return "";
+		return false;
+
+	// 合并中的包先写入， 保证顺序
+	if (batchPackets_ > 0)
+		flushBatch();
+
+	// 不带包头的数据无法排队， 先把队列中的帧全部交给socket
+	if (priorityQueued_ > 0 && !pumpSendQueues(true))
+		return false;
+
+	if (!checkSendQueue(CMD::Unkown, size))
+		return false;
+
+	if (!pTcpSocket_->send(data, size))
+		return false;
+
+	onPacketQueued();
+	return true;
+}
+
+//-------------------------------------------------------------------------------------
+void Session::onPacketQueued()
+{
+	// 写入队列的帧在这里计入
+	if (pSendQueues_[0])
+	{
+		priorityQueued_ = 0;
+		for (int i = 0; i < SEND_PRIORITY_MAX; ++i)
+			priorityQueued_ += (uint32)evbuffer_get_length(pSendQueues_[i]);
+	}
+
+	uint32 length = sendQueueLength();
+	if (length > sendQueuePeak_)
+		sendQueuePeak_ = length;
+
+	// 按socket的积压情况从队列补充
+	if (priorityQueued_ > 0)
+		pumpSendQueues(false);
+
+	if (pTcpSocket_->corked())
+		pNetworkInterface_->onPacketCorked(this);
+}
+
+//-------------------------------------------------------------------------------------
+uint32 Session::sendQueueLength() const
+{
+	return (pTcpSocket_) ? pTcpSocket_->getSendBufferLength() + priorityQueued_ : 0;
+}
+
+//-------------------------------------------------------------------------------------
+bool Session::checkSendQueue(int32 cmd, uint32 size)
+{
+	if (sendQueueMax_ == 0)
+		return true;
+
+	uint64 length = (uint64)sendQueueLength() + size;
+	if (length <= sendQueueMax_)
+		return true;
+
+	if (!sendQueueFull_)
+	{
+		sendQueueFull_ = true;
+		++sendQueueOverflows_;
+
+		WARNING_MSG(fmt::format("Session::checkSendQueue(): send queue is full! length={}, max={}, policy={}, type={}, sessionID={}, {}\n",
+			length, sendQueueMax_, sendQueuePolicy_, typeName(), id(), addr()));
+
+		onSendQueueFull(true);
+	}
+
+	bool dropSession = false;
+
+	switch (sendQueuePolicy_)
+	{
+	case SENDQUEUE_POLICY_DROP_DROPPABLE:
+		if (isDroppable(cmd))
+		{
+			++droppedPackets_;
+			droppedBytes_ += size;
+			return false;
+		}
+		break;
+	case SENDQUEUE_POLICY_PAUSE_UPSTREAM:
+		break;
+	default:
+		dropSession = true;
+		break;
+	};
+
+	// 超过两倍上限说明对端基本不再读取， 继续堆积只会耗尽内存
+	if (dropSession || length > (uint64)sendQueueMax_ * 2)
+	{
+		++droppedPackets_;
+		droppedBytes_ += size;
+
+		if (!isDestroyed())
+		{
+			ERROR_MSG(fmt::format("Session::checkSendQueue(): slow consumer, destroy session! length={}, max={}, type={}, sessionID={}, {}\n",
+				length, sendQueueMax_, typeName(), id(), addr()));
+
+			destroy();
+		}
+
+		return false;
+	}
+
+	return true;
+}
+
+//-------------------------------------------------------------------------------------
+void Session::checkSendQueueDrained()
+{
+	if (sendQueueFull_ && sendQueueLength() <= sendQueueMax_ / 2)
+	{
+		sendQueueFull_ = false;
+		onSendQueueFull(false);
+	}
+}
+
+//-------------------------------------------------------------------------------------
+bool Session::isDroppable(int32 cmd) const
+{
+	switch (cmd)
+	{
+	case CMD::Ping:
+	case CMD::Pong:
+	case CMD::Client_OnMatchingUpdate:
+		return true;
+	default:
+		break;
+	};
+
+	return false;
+}
+
+//-------------------------------------------------------------------------------------
+// [send_priority]中的键是小写的协议名， 按协议的枚举值建立索引
+static std::map<int32, uint8> configuredSendPriorities()
+{
+	std::map<int32, uint8> priorities;
+
+	const std::map<std::string, int>& configured = ResMgr::getSingleton().serverConfig().send_priority;
+	if (configured.size() == 0)
+		return priorities;
+
+	const ::google::protobuf::EnumDescriptor* pDescriptor = CMD_descriptor();
+	for (int i = 0; i < pDescriptor->value_count(); ++i)
+	{
+		const ::google::protobuf::EnumValueDescriptor* pValue = pDescriptor->value(i);
+
+		std::string name = pValue->name();
+		std::transform(name.begin(), name.end(), name.begin(), ::tolower);
+
+		std::map<std::string, int>::const_iterator iter = configured.find(name);
+		if (iter != configured.end())
+			priorities[pValue->number()] = (uint8)std::min<int>(std::max<int>(iter->second, SEND_PRIORITY_CONTROL), SEND_PRIORITY_BULK);
+	}
+
+	return priorities;
+}
+
+//-------------------------------------------------------------------------------------
+uint8 Session::sendPriority(int32 cmd, bool forwarded) const
+{
+	static const std::map<int32, uint8> priorities = configuredSendPriorities();
+
+	std::map<int32, uint8>::const_iterator iter = priorities.find(cmd);
+	if (iter != priorities.end())
+		return iter->second;
+
+	switch (cmd)
+	{
+	case CMD::Hello:
+	case CMD::HelloCB:
+	case CMD::Heartbeat:
+	case CMD::HeartbeatCB:
+	case CMD::Version_Not_Match:
+	case CMD::UpdateServerInfos:
+	case CMD::QueryServerInfos:
+	case CMD::QueryServerInfosCB:
+	case CMD::Ping:
+	case CMD::Pong:
+	case CMD::RemoteDisconnected:
+	case CMD::FrameUpgrade:
+	case CMD::ShmAttach:
+		return SEND_PRIORITY_CONTROL;
+	// 匹配和开房间的流程不能排在大量的转发包之后
+	case CMD::Halls_StartMatch:
+	case CMD::Halls_CancelMatch:
+	case CMD::Halls_OnRequestCreateRoomCB:
+	case CMD::Roommgr_RequestCreateRoom:
+	case CMD::Roommgr_OnRequestCreateRoomCB:
+	case CMD::Machine_RequestCreateRoom:
+	case CMD::Machine_RoomSrvReportAddr:
+	case CMD::Client_OnEndMatch:
+	case CMD::Client_OnCancelMatch:
+		return SEND_PRIORITY_INTERACTIVE;
+	default:
+		break;
+	};
+
+	return forwarded ? SEND_PRIORITY_BULK : SEND_PRIORITY_INTERACTIVE;
+}
+
+//-------------------------------------------------------------------------------------
+void Session::onSendQueueFull(bool full)
+{
+	if (sendQueuePolicy_ != SENDQUEUE_POLICY_PAUSE_UPSTREAM)
+		return;
+
+	// 数据来自别的session时(例如connector上转发到后端的客户端)由应用暂停它们
+	if (XServerBase::getSingleton().onSessionSendQueueFull(this, full))
+		return;
+
+	// 否则写入的都是对端请求的回应， 对端不读取回应时也暂停读取它的请求
+	pauseRecv(full);
+}
+
+//-------------------------------------------------------------------------------------
+void Session::pauseRecv(bool pause)
+{
+	if (pause)
+	{
+		if (recvPauses_++ == 0 && pTcpSocket_)
+			pTcpSocket_->disable(EV_READ);
+
+		return;
+	}
+
+	if (recvPauses_ == 0)
+		return;
+
+	if (--recvPauses_ == 0 && pTcpSocket_)
+		pTcpSocket_->enable(EV_READ);
+}
+
+//-------------------------------------------------------------------------------------
+bool Session::flush()
+{
+	// 合并的转发包在这里作为一帧写入， 此时flushPending_仍为true， 不会被重复登记
+	if (pTcpSocket_ && batchPackets_ > 0)
+		flushBatch();
+
+	flushPending_ = false;
+
+	if (!pTcpSocket_)
+		return false;
+
+	// 连接建立之前不能直接写socket， 交给bufferevent
+	bool written = pTcpSocket_->flush(connected_);
+
+	// 写出之后socket还有空间， 继续按优先级从队列补充， 直到写不下为止
+	if (written && priorityQueued_ > 0)
+	{
+		while (pumpSendQueues(false) && pTcpSocket_->flush(connected_))
+			;
+	}
+
+	// 直接写出的数据不会触发onSent
+	if (written)
+		checkSendQueueDrained();
+
+	return written;
+}
+
+//-------------------------------------------------------------------------------------
+uint8* Session::reservePacket(int32 cmd, uint32 size, struct evbuffer_iovec& vec)
+{
+	if (!pTcpSocket_ || !pTcpSocket_->isGood())
+		return NULL;
+
+	uint32 trailerSize = frameTrailerSize();
+	if (size + trailerSize > PacketHeader::lengthMax(sendFrameVersion_))
+	{
+		ERROR_MSG(fmt::format("Session::reservePacket(): packet is too large! cmd={}, size={}, frameVersion={}, sessionID={}, {}\n",
+			cmd, size, sendFrameVersion_, id(), addr()));
+
+		return NULL;
+	}
+
+	if (batchPackets_ > 0)
+		flushBatch();
+
+	uint32 headerSize = PacketHeader::size(sendFrameVersion_);
+	uint32 totalSize = headerSize + size + trailerSize;
+	if (!checkSendQueue(cmd, totalSize))
+		return NULL;
+
+	// 预留之后没有提交的块
+	BufferPool::release(pReservedChunk_);
+	pReservedChunk_ = NULL;
+
+	// 放得进一块的较长的包直接写在池中的块里， 不让evbuffer为它单独申请内存
+	if (totalSize >= BufferPool::chunkSize() / 2 && totalSize <= BufferPool::chunkSize())
+		pReservedChunk_ = BufferPool::acquire();
+
+	if (pReservedChunk_)
+	{
+		vec.iov_base = pReservedChunk_;
+	}
+	else if (evbuffer_reserve_space(sendBuffer(cmd), totalSize, &vec, 1) != 1)
+	{
+		ERROR_MSG(fmt::format("Session::reservePacket(): evbuffer_reserve_space error! cmd={}, size={}, sessionID={}, {}\n",
+			cmd, size, id(), addr()));
+
+		return NULL;
+	}
+
+	vec.iov_len = totalSize;
+
+	PacketHeader header;
+	header.msglen = size + trailerSize;
+	header.msgcmd = (uint16)cmd;
+	header.flags = 0;
+	header.encode(sendFrameVersion_, (uint8*)vec.iov_base);
+
+	return (uint8*)vec.iov_base + headerSize;
+}
+
+//-------------------------------------------------------------------------------------
+bool Session::commitPacket(struct evbuffer_iovec& vec)
+{
+	uint32 headerSize = PacketHeader::size(sendFrameVersion_);
+	uint8* pHeader = (uint8*)vec.iov_base;
+
+	// 预留和提交之间没有其他写入， 按包头中的cmd得到的是预留时的同一个缓冲区
+	PacketHeader header;
+	header.decode(sendFrameVersion_, pHeader);
+	struct evbuffer* pSendBuffer = sendBuffer(header.msgcmd);
+
+	// 包体在预留的空间中原地加密， tag写在包体之后； 进入队列的帧在取出时再加密
+	if (sealOnWrite(pSendBuffer))
+	{
+		uint32 size = (uint32)vec.iov_len - headerSize - SessionCipher::TAG_SIZE;
+
+		if (!pCipher_->seal(pHeader, headerSize, pHeader + headerSize, size, pHeader + headerSize + size))
+		{
+			ERROR_MSG(fmt::format("Session::commitPacket(): encrypt error! sessionID={}, {}\n", id(), addr()));
+
+			// 帧序号已经前进， 之后的帧对端都无法解密
+			destroy();
+			return false;
+		}
+	}
+
+	if (pReservedChunk_)
+	{
+		uint8* pChunk = pReservedChunk_;
+		pReservedChunk_ = NULL;
+
+		if (!BufferPool::addChunk(pSendBuffer, pChunk, (uint32)vec.iov_len))
+			return false;
+	}
+	else if (evbuffer_commit_space(pSendBuffer, &vec, 1) != 0)
+	{
+		return false;
+	}
+
+	onPacketQueued();
+	return true;
+}
+
+//-------------------------------------------------------------------------------------
+bool Session::sendPacket(int32 cmd, const uint8 *data, uint32 size)
+{
+	if (sendFrameVersion_ >= FRAME_VERSION_2 && size > FRAME_CHUNK_SIZE)
+		return sendChunked(cmd, data, size);
+
+	if (shouldCompress(size))
+		return sendCompressed(cmd, data, size);
+
+	struct evbuffer_iovec vec;
+	uint8* pBody = reservePacket(cmd, size, vec);
+	if (!pBody)
+		return false;
+
+	memcpy(pBody, data, size);
+	return commitPacket(vec);
+}
+
+//-------------------------------------------------------------------------------------
+bool Session::sendPacket(int32 cmd, const ::google::protobuf::Message& packet)
+{
+	// ByteSizeLong会缓存各字段的长度， 之后直接序列化到发送缓冲区中
+	uint32 size = (uint32)packet.ByteSizeLong();
+
+	if (ResMgr::getSingleton().serverConfig().debugPacket)
+	{
+		std::string cmdName = CMD_Name((CMD)cmd);
+
+		DEBUG_MSG(fmt::format("Session::sendPacket(): appType={}, cmd={} to :{}, size={}.\ndatas={}\n",
+			typeName(), cmdName, addr(), size, packet.DebugString()));
+	}
+
+	if (sendFrameVersion_ >= FRAME_VERSION_2 && size > FRAME_CHUNK_SIZE)
+		return sendChunked(cmd, packet, size);
+
+	if (shouldCompress(size))
+	{
+		// 先序列化到线程的临时缓冲区， 再压缩进发送缓冲区
+		static thread_local std::vector<uint8> buffer;
+		if (buffer.size() < size)
+			buffer.resize(size);
+
+		packet.SerializeWithCachedSizesToArray(&buffer[0]);
+		return sendCompressed(cmd, &buffer[0], size);
+	}
+
+	struct evbuffer_iovec vec;
+	uint8* pBody = reservePacket(cmd, size, vec);
+	if (!pBody)
+		return false;
+
+	packet.SerializeWithCachedSizesToArray(pBody);
+
+	if (PacketCompressor::training())
+		PacketCompressor::sample(cmd, pBody, size);
+
+	return commitPacket(vec);
+}
+
+//-------------------------------------------------------------------------------------
+bool Session::sendCompressed(int32 cmd, const uint8 *data, uint32 size, uint8 flags)
+{
+	if (PacketCompressor::training())
+		PacketCompressor::sample(cmd, data, size);
+
+	uint32 capacity = PacketCompressor::compressBound(size);
+
+	struct evbuffer_iovec vec;
+	uint8* pBody = reservePacket(cmd, capacity, vec);
+	if (!pBody)
+		return false;
+
+	PacketHeader header;
+	header.msgcmd = (uint16)cmd;
+	header.msglen = PacketCompressor::compress(compressDict_, data, size, pBody, capacity);
+	header.flags = FRAME_FLAG_COMPRESSED | flags;
+
+	if (header.msglen > 0)
+	{
+		pNetworkInterface_->onPacketCompressed(this, size, header.msglen);
+	}
+	else
+	{
+		memcpy(pBody, data, size);
+		header.msglen = size;
+		header.flags = flags;
+	}
+
+	// 预留时按最大长度写的包头， 改为实际长度
+	header.msglen += frameTrailerSize();
+	header.encode(sendFrameVersion_, (uint8*)vec.iov_base);
+	vec.iov_len = PacketHeader::size(sendFrameVersion_) + header.msglen;
+	return commitPacket(vec);
+}
+
+//-------------------------------------------------------------------------------------
+bool Session::sendChunked(int32 cmd, const uint8 *data, uint32 size)
+{
+	struct evbuffer* pBody = evbuffer_new();
+	if (!pBody)
+		return false;
+
+	bool ret = evbuffer_add(pBody, data, size) == 0 && sendChunks(cmd, pBody);
+	evbuffer_free(pBody);
+	return ret;
+}
+
+//-------------------------------------------------------------------------------------
+bool Session::sendChunked(int32 cmd, const ::google::protobuf::Message& packet, uint32 size)
+{
+	struct evbuffer* pBody = evbuffer_new();
+	if (!pBody)
+		return false;
+
+	bool ret = false;
+
+	// 按块大小预留内存序列化， 之后每一帧基本上只是移动一个内存块
+	{
+		EvbufferOutputStream stream(pBody, FRAME_CHUNK_SIZE);
+		::google::protobuf::io::CodedOutputStream output(&stream);
+		packet.SerializeWithCachedSizes(&output);
+		ret = !output.HadError();
+	}
+
+	if (ret && evbuffer_get_length(pBody) == size)
+		ret = sendChunks(cmd, pBody);
+	else
+		ERROR_MSG(fmt::format("Session::sendChunked(): serialize error! cmd={}, size={}, sessionID={}, {}\n",
+			cmd, size, id(), addr()));
+
+	evbuffer_free(pBody);
+	return ret;
+}
+
+//-------------------------------------------------------------------------------------
+bool Session::sendChunks(int32 cmd, struct evbuffer* pBody)
+{
+	if (!pTcpSocket_ || !pTcpSocket_->isGood())
+		return false;
+
+	uint32 size = (uint32)evbuffer_get_length(pBody);
+	if (size > FRAME_LENGTH_MAX)
+	{
+		ERROR_MSG(fmt::format("Session::sendChunks(): packet is too large! cmd={}, size={}, sessionID={}, {}\n",
+			cmd, size, id(), addr()));
+
+		return false;
+	}
+
+	if (batchPackets_ > 0)
+		flushBatch();
+
+	uint32 headerSize = PacketHeader::size(sendFrameVersion_);
+	uint32 trailerSize = frameTrailerSize();
+	uint32 chunks = (size + FRAME_CHUNK_SIZE - 1) / FRAME_CHUNK_SIZE;
+	if (!checkSendQueue(cmd, size + chunks * (headerSize + trailerSize)))
+		return false;
+
+	struct evbuffer* pSendBuffer = sendBuffer(cmd);
+	bool seal = sealOnWrite(pSendBuffer);
+
+	while (size > 0)
+	{
+		uint32 chunkSize = std::min<uint32>(size, FRAME_CHUNK_SIZE);
+
+		PacketHeader header;
+		header.msglen = chunkSize + trailerSize;
+		header.msgcmd = (uint16)cmd;
+		header.flags = chunkSize < size ? FRAME_FLAG_MORE : 0;
+
+		uint8 headerData[PACKET_HEADER_SIZE_MAX];
+		header.encode(sendFrameVersion_, headerData);
+
+		// 每一帧单独加密， 在pBody的内存块上原地进行， 之后整块移动到发送缓冲区
+		// 进入队列时先写入占位的tag， 取出时再加密
+		uint8 tag[SessionCipher::TAG_SIZE] = { 0 };
+		if (seal && !pCipher_->seal(headerData, headerSize, pBody, 0, chunkSize, tag))
+		{
+			ERROR_MSG(fmt::format("Session::sendChunks(): encrypt error! cmd={}, sessionID={}, {}\n",
+				cmd, id(), addr()));
+
+			destroy();
+			return false;
+		}
+
+		if (evbuffer_add(pSendBuffer, headerData, headerSize) != 0 ||
+			evbuffer_remove_buffer(pBody, pSendBuffer, chunkSize) != (int)chunkSize ||
+			(sendEncrypted_ && evbuffer_add(pSendBuffer, tag, trailerSize) != 0))
+		{
+			ERROR_MSG(fmt::format("Session::sendChunks(): write error! cmd={}, sessionID={}, {}\n",
+				cmd, id(), addr()));
+
+			// 已经写入了一部分， 对端无法再正确解析， 只能断开
+			destroy();
+			return false;
+		}
+
+		size -= chunkSize;
+	}
+
+	onPacketQueued();
+	return true;
+}
+
+//-------------------------------------------------------------------------------------
+bool Session::sendPacket(int32 cmd, struct evbuffer* pBody, uint32 size)
+{
+	if (evbuffer_get_length(pBody) < size)
+		return false;
+
+	if (sendFrameVersion_ >= FRAME_VERSION_2 && size > FRAME_CHUNK_SIZE)
+	{
+		struct evbuffer* pChunks = evbuffer_new();
+		if (!pChunks)
+			return false;
+
+		bool ret = evbuffer_remove_buffer(pBody, pChunks, size) == (int)size && sendChunks(cmd, pChunks);
+		evbuffer_free(pChunks);
+		return ret;
+	}
+
+	if (shouldCompress(size))
+	{
+		const uint8* data = evbuffer_pullup(pBody, size);
+		bool ret = data && sendCompressed(cmd, data, size);
+		evbuffer_drain(pBody, size);
+		return ret;
+	}
+
+	return sendFrame(cmd, NULL, 0, pBody, size);
+}
+
+//-------------------------------------------------------------------------------------
+bool Session::sendFrame(int32 cmd, const uint8* prefix, uint32 prefixSize, struct evbuffer* pBody, uint32 size, uint8 flags)
+{
+	if (!pTcpSocket_ || !pTcpSocket_->isGood())
+		return false;
+
+	if (batchPackets_ > 0)
+		flushBatch();
+
+	uint32 trailerSize = frameTrailerSize();
+	if (prefixSize + size + trailerSize > PacketHeader::lengthMax(sendFrameVersion_))
+	{
+		ERROR_MSG(fmt::format("Session::sendFrame(): packet is too large! cmd={}, size={}, frameVersion={}, sessionID={}, {}\n",
+			cmd, prefixSize + size, sendFrameVersion_, id(), addr()));
+
+		return false;
+	}
+
+	uint32 headerSize = PacketHeader::size(sendFrameVersion_);
+	if (!checkSendQueue(cmd, headerSize + prefixSize + size + trailerSize))
+		return false;
+
+	PacketHeader header;
+	header.msglen = prefixSize + size + trailerSize;
+	header.msgcmd = (uint16)cmd;
+	header.flags = flags;
+
+	// 包头和前缀一起写入
+	uint8 headerData[PACKET_HEADER_SIZE_MAX + ForwardEnvelope::SIZE];
+	assert(prefixSize <= ForwardEnvelope::SIZE);
+
+	header.encode(sendFrameVersion_, headerData);
+	if (prefixSize > 0)
+		memcpy(headerData + headerSize, prefix, prefixSize);
+
+	struct evbuffer* pSendBuffer = sendBuffer(cmd);
+	uint32 offset = (uint32)evbuffer_get_length(pSendBuffer);
+
+	if (evbuffer_add(pSendBuffer, headerData, headerSize + prefixSize) != 0 ||
+		evbuffer_remove_buffer(pBody, pSendBuffer, size) != (int)size)
+	{
+		ERROR_MSG(fmt::format("Session::sendFrame(): write error! cmd={}, sessionID={}, {}\n",
+			cmd, id(), addr()));
+
+		destroy();
+		return false;
+	}
+
+	if (sendEncrypted_)
+	{
+		// 移动过来的内存块还没有写出， 直接在发送缓冲区中加密； 进入队列的帧只写入占位的tag
+		uint8 tag[SessionCipher::TAG_SIZE] = { 0 };
+		if ((sealOnWrite(pSendBuffer) && !pCipher_->seal(headerData, headerSize, pSendBuffer, offset + headerSize, prefixSize + size, tag)) ||
+			evbuffer_add(pSendBuffer, tag, trailerSize) != 0)
+		{
+			ERROR_MSG(fmt::format("Session::sendFrame(): encrypt error! cmd={}, sessionID={}, {}\n",
+				cmd, id(), addr()));
+
+			destroy();
+			return false;
+		}
+	}
+
+	onPacketQueued();
+	return true;
+}
+
+//-------------------------------------------------------------------------------------
+bool Session::forwardPacket(SessionID requestorSessionID, int32 cmd, const ::google::protobuf::Message& packet)
+{
+	uint32 size = (uint32)packet.ByteSizeLong();
+
+	// 转发和组播的包按包体的cmd决定优先级
+	SendPriorityScope priorityScope(sendPriority_, pSendQueues_[0] ? (int8)sendPriority(cmd, true) : -1);
+
+	if (ResMgr::getSingleton().serverConfig().debugPacket)
+	{
+		DEBUG_MSG(fmt::format("Session::forwardPacket(): appType={}, cmd={} to :{}, requestor={}, size={}.\ndatas={}\n",
+			typeName(), CMD_Name((CMD)cmd), addr(), requestorSessionID, size, packet.DebugString()));
+	}
+
+	ForwardEnvelope envelope;
+	envelope.requestorID = requestorSessionID;
+	envelope.msgcmd = (uint16)cmd;
+
+	uint32 totalSize = ForwardEnvelope::SIZE + size;
+	bool batched = canBatch(totalSize);
+
+	// 需要分帧或压缩时先序列化到线程的临时缓冲区， 合并的包在整批发出时才压缩
+	if (!batched && ((sendFrameVersion_ >= FRAME_VERSION_2 && totalSize > FRAME_CHUNK_SIZE) || shouldCompress(totalSize)))
+	{
+		static thread_local std::vector<uint8> buffer;
+		if (buffer.size() < totalSize)
+			buffer.resize(totalSize);
+
+		envelope.encode(&buffer[0]);
+		packet.SerializeWithCachedSizesToArray(&buffer[ForwardEnvelope::SIZE]);
+		return sendPacket(CMD::ForwardFrame, &buffer[0], totalSize);
+	}
+
+	struct evbuffer_iovec vec;
+	uint8* pBody = batched ? reserveBatch(CMD::ForwardFrame, totalSize, vec) : reservePacket(CMD::ForwardFrame, totalSize, vec);
+	if (!pBody)
+		return false;
+
+	envelope.encode(pBody);
+	packet.SerializeWithCachedSizesToArray(pBody + ForwardEnvelope::SIZE);
+
+	if (PacketCompressor::training())
+		PacketCompressor::sample(cmd, pBody + ForwardEnvelope::SIZE, size);
+
+	return batched ? commitBatch(vec) : commitPacket(vec);
+}
+
+//-------------------------------------------------------------------------------------
+bool Session::forwardPacket(SessionID requestorSessionID, int32 cmd, const uint8 *data, uint32 size)
+{
+	SendPriorityScope priorityScope(sendPriority_, pSendQueues_[0] ? (int8)sendPriority(cmd, true) : -1);
+
+	ForwardEnvelope envelope;
+	envelope.requestorID = requestorSessionID;
+	envelope.msgcmd = (uint16)cmd;
+
+	uint32 totalSize = ForwardEnvelope::SIZE + size;
+	bool batched = canBatch(totalSize);
+
+	if (!batched && ((sendFrameVersion_ >= FRAME_VERSION_2 && totalSize > FRAME_CHUNK_SIZE) || shouldCompress(totalSize)))
+	{
+		static thread_local std::vector<uint8> buffer;
+		if (buffer.size() < totalSize)
+			buffer.resize(totalSize);
+
+		envelope.encode(&buffer[0]);
+		memcpy(&buffer[ForwardEnvelope::SIZE], data, size);
+		return sendPacket(CMD::ForwardFrame, &buffer[0], totalSize);
+	}
+
+	struct evbuffer_iovec vec;
+	uint8* pBody = batched ? reserveBatch(CMD::ForwardFrame, totalSize, vec) : reservePacket(CMD::ForwardFrame, totalSize, vec);
+	if (!pBody)
+		return false;
+
+	envelope.encode(pBody);
+	memcpy(pBody + ForwardEnvelope::SIZE, data, size);
+	return batched ? commitBatch(vec) : commitPacket(vec);
+}
+
+//-------------------------------------------------------------------------------------
+bool Session::forwardPacket(SessionID requestorSessionID, int32 cmd, struct evbuffer* pBody, uint32 size)
+{
+	if (evbuffer_get_length(pBody) < size)
+		return false;
+
+	SendPriorityScope priorityScope(sendPriority_, pSendQueues_[0] ? (int8)sendPriority(cmd, true) : -1);
+
+	ForwardEnvelope envelope;
+	envelope.requestorID = requestorSessionID;
+	envelope.msgcmd = (uint16)cmd;
+
+	uint8 envelopeData[ForwardEnvelope::SIZE];
+	envelope.encode(envelopeData);
+
+	uint32 totalSize = ForwardEnvelope::SIZE + size;
+
+	if (sendFrameVersion_ >= FRAME_VERSION_2 && totalSize > FRAME_CHUNK_SIZE)
+	{
+		struct evbuffer* pChunks = evbuffer_new();
+		if (!pChunks)
+			return false;
+
+		bool ret = evbuffer_add(pChunks, envelopeData, sizeof(envelopeData)) == 0 &&
+			evbuffer_remove_buffer(pBody, pChunks, size) == (int)size && sendChunks(CMD::ForwardFrame, pChunks);
+
+		evbuffer_free(pChunks);
+		return ret;
+	}
+
+	if (canBatch(totalSize))
+		return batchFrame(CMD::ForwardFrame, envelopeData, sizeof(envelopeData), pBody, size);
+
+	if (shouldCompress(totalSize))
+	{
+		const uint8* data = evbuffer_pullup(pBody, size);
+		bool ret = data && forwardPacket(requestorSessionID, cmd, data, size);
+		evbuffer_drain(pBody, size);
+		return ret;
+	}
+
+	// 包体的内存块直接移动过去， 不经过protobuf
+	return sendFrame(CMD::ForwardFrame, envelopeData, sizeof(envelopeData), pBody, size);
+}
+
+//-------------------------------------------------------------------------------------
+bool Session::multicastPacket(uint64 groupID, const std::vector<SessionID>& requestors, int32 cmd, const uint8 *data, uint32 size)
+{
+	if (requestors.size() > MulticastEnvelope::REQUESTORS_MAX)
+	{
+		ERROR_MSG(fmt::format("Session::multicastPacket(): too many requestors! cmd={}, requestors={}, sessionID={}, {}\n",
+			cmd, requestors.size(), id(), addr()));
+
+		return false;
+	}
+
+	SendPriorityScope priorityScope(sendPriority_, pSendQueues_[0] ? (int8)sendPriority(cmd, true) : -1);
+
+	MulticastEnvelope envelope;
+	envelope.groupID = groupID;
+	envelope.msgcmd = (uint16)cmd;
+	envelope.count = (uint16)requestors.size();
+
+	uint32 envelopeSize = MulticastEnvelope::HEADER_SIZE + envelope.count * 8;
+	uint32 totalSize = envelopeSize + size;
+
+	// 组播帧本身已经是合并后的结果， 不再进入合并缓冲区
+	uint8* pBody = NULL;
+	struct evbuffer_iovec vec;
+	bool copied = (sendFrameVersion_ >= FRAME_VERSION_2 && totalSize > FRAME_CHUNK_SIZE) || shouldCompress(totalSize);
+
+	if (copied)
+	{
+		static thread_local std::vector<uint8> buffer;
+		if (buffer.size() < totalSize)
+			buffer.resize(totalSize);
+
+		pBody = &buffer[0];
+	}
+	else
+	{
+		pBody = reservePacket(CMD::MulticastFrame, totalSize, vec);
+		if (!pBody)
+			return false;
+	}
+
+	envelope.encode(pBody);
+
+	uint8* pRequestors = pBody + MulticastEnvelope::HEADER_SIZE;
+	for (uint16 i = 0; i < envelope.count; ++i)
+		MulticastEnvelope::encodeID(requestors[i], pRequestors + i * 8);
+
+	memcpy(pBody + envelopeSize, data, size);
+
+	if (copied)
+		return sendPacket(CMD::MulticastFrame, pBody, totalSize);
+
+	return commitPacket(vec);
+}
+
+//-------------------------------------------------------------------------------------
+bool Session::multicastPacket(uint64 groupID, const std::vector<SessionID>& requestors, int32 cmd, const ::google::protobuf::Message& packet)
+{
+	if (ResMgr::getSingleton().serverConfig().debugPacket)
+	{
+		DEBUG_MSG(fmt::format("Session::multicastPacket(): appType={}, cmd={} to :{}, groupID={}, requestors={}.\ndatas={}\n",
+			typeName(), CMD_Name((CMD)cmd), addr(), groupID, requestors.size(), packet.DebugString()));
+	}
+
+	static thread_local std::string datas;
+	datas.clear();
+	packet.SerializeToString(&datas);
+
+	return multicastPacket(groupID, requestors, cmd, (const uint8*)datas.data(), (uint32)datas.size());
+}
+
+//-------------------------------------------------------------------------------------
+void Session::releaseSharedPacket(const void* data, size_t size, void* extra)
+{
+	delete (SharedPacketData*)extra;
+}
+
+//-------------------------------------------------------------------------------------
+bool Session::sendSharedPacket(int32 cmd, const SharedPacketData& pData)
+{
+	uint32 size = (uint32)pData->size();
+
+	// 加密、 压缩和分帧都要改写包体， 只能拷贝
+	if (sendEncrypted_ || shouldCompress(size) || (sendFrameVersion_ >= FRAME_VERSION_2 && size > FRAME_CHUNK_SIZE))
+		return sendPacket(cmd, (const uint8*)pData->data(), size);
+
+	if (!pTcpSocket_ || !pTcpSocket_->isGood())
+		return false;
+
+	if (size > PacketHeader::lengthMax(sendFrameVersion_))
+	{
+		ERROR_MSG(fmt::format("Session::sendSharedPacket(): packet is too large! cmd={}, size={}, frameVersion={}, sessionID={}, {}\n",
+			cmd, size, sendFrameVersion_, id(), addr()));
+
+		return false;
+	}
+
+	if (batchPackets_ > 0)
+		flushBatch();
+
+	uint32 headerSize = PacketHeader::size(sendFrameVersion_);
+	if (!checkSendQueue(cmd, headerSize + size))
+		return false;
+
+	uint8 headerData[PACKET_HEADER_SIZE_MAX];
+	PacketHeader header;
+	header.msglen = size;
+	header.msgcmd = (uint16)cmd;
+	header.flags = 0;
+	header.encode(sendFrameVersion_, headerData);
+
+	struct evbuffer* pSendBuffer = sendBuffer(cmd);
+	if (evbuffer_add(pSendBuffer, headerData, headerSize) != 0)
+		return false;
+
+	if (size > 0)
+	{
+		// 引用计数跟随内存块， 数据写出后由libevent释放
+		SharedPacketData* pRef = new SharedPacketData(pData);
+		if (evbuffer_add_reference(pSendBuffer, pData->data(), size, &Session::releaseSharedPacket, pRef) != 0)
+		{
+			delete pRef;
+
+			// 包头已经写入， 流已经无法对齐
+			destroy();
+			return false;
+		}
+	}
+
+	onPacketQueued();
+	return true;
+}
+
+//-------------------------------------------------------------------------------------
+uint8* Session::reserveBatch(int32 cmd, uint32 size, struct evbuffer_iovec& vec)
+{
+	if (!pBatchBuffer_)
+	{
+		pBatchBuffer_ = evbuffer_new();
+		if (!pBatchBuffer_)
+			return NULL;
+	}
+
+	uint32 totalSize = BATCH_ENTRY_HEADER_SIZE + size;
+	if (evbuffer_reserve_space(pBatchBuffer_, totalSize, &vec, 1) != 1)
+		return NULL;
+
+	vec.iov_len = totalSize;
+
+	uint32 len = htonl(size);
+	uint16 msgcmd = htons((uint16)cmd);
+	memcpy(vec.iov_base, &len, 4);
+	memcpy((uint8*)vec.iov_base + 4, &msgcmd, 2);
+
+	return (uint8*)vec.iov_base + BATCH_ENTRY_HEADER_SIZE;
+}
+
+//-------------------------------------------------------------------------------------
+bool Session::commitBatch(struct evbuffer_iovec& vec)
+{
+	if (evbuffer_commit_space(pBatchBuffer_, &vec, 1) != 0)
+		return false;
+
+	return onPacketBatched();
+}
+
+//-------------------------------------------------------------------------------------
+bool Session::batchFrame(int32 cmd, const uint8* prefix, uint32 prefixSize, struct evbuffer* pBody, uint32 size)
+{
+	if (!pBatchBuffer_)
+	{
+		pBatchBuffer_ = evbuffer_new();
+		if (!pBatchBuffer_)
+			return false;
+	}
+
+	uint8 entry[BATCH_ENTRY_HEADER_SIZE + ForwardEnvelope::SIZE];
+	assert(prefixSize <= ForwardEnvelope::SIZE);
+
+	uint32 len = htonl(prefixSize + size);
+	uint16 msgcmd = htons((uint16)cmd);
+	memcpy(entry, &len, 4);
+	memcpy(entry + 4, &msgcmd, 2);
+
+	if (prefixSize > 0)
+		memcpy(entry + BATCH_ENTRY_HEADER_SIZE, prefix, prefixSize);
+
+	if (evbuffer_add(pBatchBuffer_, entry, BATCH_ENTRY_HEADER_SIZE + prefixSize) != 0 ||
+		evbuffer_remove_buffer(pBody, pBatchBuffer_, size) != (int)size)
+	{
+		ERROR_MSG(fmt::format("Session::batchFrame(): write error! cmd={}, sessionID={}, {}\n",
+			cmd, id(), addr()));
+
+		// 合并缓冲区中已经写入了一部分
+		destroy();
+		return false;
+	}
+
+	return onPacketBatched();
+}
+
+//-------------------------------------------------------------------------------------
+bool Session::onPacketBatched()
+{
+	// 第一个包进来时登记， 本轮末尾flush时整体发出
+	if (++batchPackets_ == 1)
+		pNetworkInterface_->onPacketBatched(this);
+
+	if (sendPriority_ >= 0 && sendPriority_ < batchPriority_)
+		batchPriority_ = (uint8)sendPriority_;
+
+	if (evbuffer_get_length(pBatchBuffer_) >= batchMax_)
+		return flushBatch();
+
+	return true;
+}
+
+//-------------------------------------------------------------------------------------
+bool Session::flushBatch()
+{
+	if (batchPackets_ == 0)
+		return true;
+
+	// 先清零， 下面的发送不会再次触发flushBatch
+	uint32 packets = batchPackets_;
+	batchPackets_ = 0;
+
+	SendPriorityScope priorityScope(sendPriority_, (int8)batchPriority_);
+	batchPriority_ = SEND_PRIORITY_BULK;
+
+	uint32 size = (uint32)evbuffer_get_length(pBatchBuffer_);
+	bool ret = false;
+
+	if (shouldCompress(size))
+	{
+		const uint8* data = evbuffer_pullup(pBatchBuffer_, size);
+		ret = data && sendCompressed(CMD::ForwardFrame, data, size, FRAME_FLAG_BATCH);
+	}
+	else
+	{
+		ret = sendFrame(CMD::ForwardFrame, NULL, 0, pBatchBuffer_, size, FRAME_FLAG_BATCH);
+	}
+
+	// 发送失败时(发送队列满等)整批丢弃
+	evbuffer_drain(pBatchBuffer_, evbuffer_get_length(pBatchBuffer_));
+
+	if (ret)
+		pNetworkInterface_->onBatchSent(this, packets, size);
+
+	return ret;
+}
+
+//-------------------------------------------------------------------------------------
+void Session::enableBatching()
+{
+	const ResMgr::ServerConfig& cfg = ResMgr::getSingleton().serverConfig();
+	uint32 batchMax = pNetworkInterface_->isInternalNetwork() ? cfg.internal_BATCH_MAX : cfg.external_BATCH_MAX;
+
+	// 合并帧不分帧， 可以整体压缩
+	batchMax_ = std::min<uint32>(batchMax, FRAME_CHUNK_SIZE);
+}
+
+//-------------------------------------------------------------------------------------
+uint8 Session::cipher() const
+{
+	return pCipher_ ? (uint8)pCipher_->type() : (uint8)CIPHER_NONE;
+}
+
+//-------------------------------------------------------------------------------------
+uint32 Session::frameTrailerSize() const
+{
+	return sendEncrypted_ ? SessionCipher::TAG_SIZE : 0;
+}
+
+//-------------------------------------------------------------------------------------
+struct evbuffer* Session::sendBuffer(int32 cmd)
+{
+	struct evbuffer* pSendBuffer = pTcpSocket_->getSendEvbuffer();
+	if (!pSendQueues_[0])
+		return pSendBuffer;
+
+	// 队列都为空并且socket没有积压时直接写入， 不经过队列
+	if (priorityQueued_ == 0 && pTcpSocket_->getSendBufferLength() < priorityLowat_)
+		return pSendBuffer;
+
+	return pSendQueues_[sendPriority_ >= 0 ? sendPriority_ : sendPriority(cmd, false)];
+}
+
+//-------------------------------------------------------------------------------------
+bool Session::sealOnWrite(struct evbuffer* pSendBuffer) const
+{
+	return sendEncrypted_ && pSendBuffer == pTcpSocket_->getSendEvbuffer();
+}
+
+//-------------------------------------------------------------------------------------
+void Session::enablePriority()
+{
+	if (pSendQueues_[0] || !pTcpSocket_ || isDestroyed())
+		return;
+
+	const ResMgr::ServerConfig& cfg = ResMgr::getSingleton().serverConfig();
+	uint32 lowat = pNetworkInterface_->isInternalNetwork() ? cfg.internal_PRIORITY_LOWAT : cfg.external_PRIORITY_LOWAT;
+	if (lowat == 0)
+		return;
+
+	for (int i = 0; i < SEND_PRIORITY_MAX; ++i)
+	{
+		pSendQueues_[i] = evbuffer_new();
+		if (pSendQueues_[i])
+			continue;
+
+		ERROR_MSG(fmt::format("Session::enablePriority(): evbuffer_new error! sessionID={}, {}\n", id(), addr()));
+
+		for (int j = 0; j < i; ++j)
+		{
+			evbuffer_free(pSendQueues_[j]);
+			pSendQueues_[j] = NULL;
+		}
+
+		return;
+	}
+
+	priorityLowat_ = lowat;
+
+	// socket中的数据降到低水位时回调onSent， 从队列补充
+	uint32 sendLowat = priorityLowat_;
+	if (sendQueueMax_ > 0)
+		sendLowat = std::min<uint32>(sendLowat, sendQueueMax_ / 2);
+
+	pTcpSocket_->setSendLowWatermark(sendLowat);
+}
+
+//-------------------------------------------------------------------------------------
+bool Session::pumpSendQueues(bool all)
+{
+	if (!pSendQueues_[0] || !pTcpSocket_)
+		return false;
+
+	struct evbuffer* pSendBuffer = pTcpSocket_->getSendEvbuffer();
+	uint32 headerSize = PacketHeader::size(sendFrameVersion_);
+	bool pumped = false;
+
+	while (priorityQueued_ > 0)
+	{
+		uint32 length = pTcpSocket_->getSendBufferLength();
+		if (!all && length >= priorityLowat_)
+			break;
+
+		// 分帧的大包没有写完之前只能继续取它所在的队列， 对端不能交错接收
+		int priority = chunkPriority_;
+		if (priority < 0 || evbuffer_get_length(pSendQueues_[priority]) == 0)
+		{
+			priority = 0;
+			while (priority < SEND_PRIORITY_MAX && evbuffer_get_length(pSendQueues_[priority]) == 0)
+				++priority;
+
+			if (priority == SEND_PRIORITY_MAX)
+			{
+				priorityQueued_ = 0;
+				break;
+			}
+		}
+
+		struct evbuffer* pQueue = pSendQueues_[priority];
+		uint32 queued = (uint32)evbuffer_get_length(pQueue);
+		uint32 budget = all ? queued : priorityLowat_ - length;
+
+		// 从队首取出连续的整帧， 一次移动到socket的发送缓冲区
+		uint32 offset = 0;
+		uint32 frames = 0;
+		while (offset < queued && (offset < budget || frames == 0))
+		{
+			uint8 headerData[PACKET_HEADER_SIZE_MAX];
+			struct evbuffer_ptr ptr;
+			if (evbuffer_ptr_set(pQueue, &ptr, offset, EVBUFFER_PTR_SET) != 0 ||
+				evbuffer_copyout_from(pQueue, &ptr, headerData, headerSize) != (ev_ssize_t)headerSize)
+			{
+				break;
+			}
+
+			PacketHeader header;
+			header.decode(sendFrameVersion_, headerData);
+
+			if (sendEncrypted_ && !sealQueuedFrame(pQueue, offset, headerData, headerSize, header.msglen))
+			{
+				ERROR_MSG(fmt::format("Session::pumpSendQueues(): encrypt error! cmd={}, sessionID={}, {}\n",
+					header.msgcmd, id(), addr()));
+
+				destroy();
+				return pumped;
+			}
+
+			offset += headerSize + header.msglen;
+			++frames;
+
+			chunkPriority_ = (header.flags & FRAME_FLAG_MORE) ? priority : -1;
+		}
+
+		if (frames == 0 || evbuffer_remove_buffer(pQueue, pSendBuffer, offset) != (int)offset)
+		{
+			ERROR_MSG(fmt::format("Session::pumpSendQueues(): write error! priority={}, queued={}, sessionID={}, {}\n",
+				priority, queued, id(), addr()));
+
+			// 已经加密的帧序号前进了， 之后的帧对端都无法解析
+			destroy();
+			return pumped;
+		}
+
+		priorityQueued_ -= offset;
+		priorityFrames_[priority] += frames;
+		pumped = true;
+	}
+
+	return pumped;
+}
+
+//-------------------------------------------------------------------------------------
+bool Session::sealQueuedFrame(struct evbuffer* pQueue, uint32 offset, const uint8* headerData, uint32 headerSize, uint32 msglen)
+{
+	if (msglen < SessionCipher::TAG_SIZE)
+		return false;
+
+	uint32 size = msglen - SessionCipher::TAG_SIZE;
+
+	uint8 tag[SessionCipher::TAG_SIZE];
+	if (!pCipher_->seal(headerData, headerSize, pQueue, offset + headerSize, size, tag))
+		return false;
+
+	// tag写入排队时预留的位置， 可能跨越多个内存块
+	struct evbuffer_ptr ptr;
+	if (evbuffer_ptr_set(pQueue, &ptr, offset + headerSize + size, EVBUFFER_PTR_SET) != 0)
+		return false;
+
+	struct evbuffer_iovec vecs[SessionCipher::TAG_SIZE];
+	int n = evbuffer_peek(pQueue, SessionCipher::TAG_SIZE, &ptr, vecs, SessionCipher::TAG_SIZE);
+
+	uint32 copied = 0;
+	for (int i = 0; i < n && copied < SessionCipher::TAG_SIZE; ++i)
+	{
+		uint32 len = std::min<uint32>((uint32)vecs[i].iov_len, SessionCipher::TAG_SIZE - copied);
+		memcpy(vecs[i].iov_base, tag + copied, len);
+		copied += len;
+	}
+
+	return copied == SessionCipher::TAG_SIZE;
+}
+
+//-------------------------------------------------------------------------------------
+bool Session::decryptFrame(const uint8* headerData, uint32 headerSize)
+{
+	if (header_.msglen < SessionCipher::TAG_SIZE)
+	{
+		ERROR_MSG(fmt::format("Session::decryptFrame(): frame is too short! msglen={}, sessionID={}, {}\n",
+			header_.msglen, id(), pTcpSocket_->addr()));
+
+		return false;
+	}
+
+	uint32 size = header_.msglen - SessionCipher::TAG_SIZE;
+	struct evbuffer* pRecvBuffer = pTcpSocket_->getRecvEvbuffer();
+
+	uint8 tag[SessionCipher::TAG_SIZE];
+	struct evbuffer_ptr ptr;
+	if (evbuffer_ptr_set(pRecvBuffer, &ptr, headerSize + size, EVBUFFER_PTR_SET) != 0 ||
+		evbuffer_copyout_from(pRecvBuffer, &ptr, tag, sizeof(tag)) != (ev_ssize_t)sizeof(tag))
+	{
+		return false;
+	}
+
+	// 包体在接收缓冲区中原地解密， 之后的解析和分发不需要知道加密的存在
+	if (!pCipher_->open(headerData, headerSize, pRecvBuffer, headerSize, size, tag))
+	{
+		ERROR_MSG(fmt::format("Session::decryptFrame(): authentication failed! msgcmd={}, msglen={}, sessionID={}, {}\n",
+			header_.msgcmd, header_.msglen, id(), pTcpSocket_->addr()));
+
+		return false;
+	}
+
+	header_.msglen = size;
+	return true;
+}
+
+//-------------------------------------------------------------------------------------
+void Session::onRecv()
+{
+	//INFO_MSG(fmt::format("Session::onRecv()\n"));
+
+	// 本次收到的所有包解析时共用Arena， 处理完后统一释放
+	PacketArena::Batch arenaBatch;
+
+	dispatching_ = true;
+
+	uint32 frames = 0;
+	uint32 bytes = 0;
+	bool backlog = false;
+
+	// 一次处理缓冲区中所有完整的包， 直到用完本次的预算
+	while (!closePending_)
+	{
+		if (isDestroyed())
+		{
+			closePending_ = true;
+			break;
+		}
+
+		// 只偷看包头， 整包到齐之前不从缓冲区取走任何数据
+		// 包头版本可能在上一个包的处理中被切换， 每次重新计算
+		uint32 headerSize = PacketHeader::size(recvFrameVersion_);
+		uint8 headerData[PACKET_HEADER_SIZE_MAX];
+		if (!pTcpSocket_->peek(headerData, headerSize))
+			break;
+
+		header_.decode(recvFrameVersion_, headerData);
+
+		if (header_.msglen > PacketHeader::lengthMax(recvFrameVersion_))
+		{
+			ERROR_MSG(fmt::format("Session::onRecv(): invalid packet length: {}, msgcmd={}, isServer={}, sessionID={}, {}\n",
+				header_.msglen, header_.msgcmd, isServer(), id(), pTcpSocket_->addr()));
+
+			closePending_ = true;
+			break;
+		}
+
+		// 不认识的标记可能改变包体的格式， 不能当作没有设置
+		if (header_.flags & ~FRAME_FLAGS_KNOWN)
+		{
+			ERROR_MSG(fmt::format("Session::onRecv(): unknown frame flags: {:#x}, msgcmd={}, isServer={}, sessionID={}, {}\n",
+				(uint32)header_.flags, header_.msgcmd, isServer(), id(), pTcpSocket_->addr()));
+
+			closePending_ = true;
+			break;
+		}
+
+		// 等待接收到足够长度
+		uint32 frameLength = headerSize + header_.msglen;
+		if (frameLength > pTcpSocket_->getRecvBufferLength())
+			break;
+
+		// 预算用完时剩下的完整帧留给接收队列， 让同一循环的其他session先处理
+		if (frames > 0 && ((recvBudget_ > 0 && frames >= recvBudget_) || (recvBudgetBytes_ > 0 && bytes >= recvBudgetBytes_)))
+		{
+			backlog = true;
+			break;
+		}
+
+		++frames;
+		bytes += frameLength;
+
+		if (recvEncrypted_ && !decryptFrame(headerData, headerSize))
+		{
+			closePending_ = true;
+			break;
+		}
+
+		if (header_.flags & FRAME_FLAG_COMPRESSED)
+		{
+			lastReceivedTime_ = getTimeStamp();
+
+			const uint8* data = decompressPacket(headerSize);
+			if (!data)
+			{
+				closePending_ = true;
+				break;
+			}
+
+			// 解压后的包体不在接收缓冲区中， header_.msglen已经是原始长度
+			bool batch = (header_.flags & FRAME_FLAG_BATCH) != 0;
+			bool ret = batch ? onRecvBatch(data, header_.msglen) : onProcessPacket_(id(), (uint8*)data, header_.msglen);
+
+			pTcpSocket_->drain(frameLength);
+
+			if (!ret && (batch || !isServer()))
+				closePending_ = true;
+
+			continue;
+		}
+
+		if (header_.flags & FRAME_FLAG_BATCH)
+		{
+			lastReceivedTime_ = getTimeStamp();
+
+			if (!onRecvBatch(headerSize, frameLength))
+			{
+				closePending_ = true;
+				break;
+			}
+
+			continue;
+		}
+
+		if (pChunkBuffer_ || (header_.flags & FRAME_FLAG_MORE))
+		{
+			lastReceivedTime_ = getTimeStamp();
+
+			if (!onRecvChunk(headerSize, frameLength))
+			{
+				closePending_ = true;
+				break;
+			}
+
+			if (header_.flags & FRAME_FLAG_MORE)
+				continue;
+
+			// 最后一帧已到， 从收集缓冲区中分发整个包
+			header_.msglen = (uint32)evbuffer_get_length(pChunkBuffer_);
+			pRecvBody_ = pChunkBuffer_;
+			recvBodyOffset_ = 0;
+			recvPacketLength_ = header_.msglen;
+
+			bool ret = onProcessPacket_(id(), NULL, header_.msglen);
+
+			evbuffer_free(pChunkBuffer_);
+			pChunkBuffer_ = NULL;
+			pRecvBody_ = NULL;
+			recvPacketLength_ = 0;
+
+			if (!ret && !isServer())
+				closePending_ = true;
+
+			continue;
+		}
+
+		//DEBUG_MSG(fmt::format("Session::onRecv(): length={}, cmd={}, isServer={}, sessionID={}, {}\n", 
+		//	header_.msglen, header_.msgcmd, isServer(), id(), pTcpSocket_->addr()));
+
+		lastReceivedTime_ = getTimeStamp();
+		pRecvBody_ = pTcpSocket_->getRecvEvbuffer();
+		recvBodyOffset_ = headerSize;
+		recvPacketLength_ = header_.msglen;
+
+		// 将包解开，并分发执行， 包体直接在接收缓冲区中解析
+		uint32 bufferLength = pTcpSocket_->getRecvBufferLength();
+		bool ret = onProcessPacket_(id(), NULL, header_.msglen);
+
+		// 分发完成后才将整包从缓冲区中移除， 处理时可能已经移走了一部分(packetBodyBuffer)
+		pTcpSocket_->drain(frameLength - (bufferLength - pTcpSocket_->getRecvBufferLength()));
+		pRecvBody_ = NULL;
+		recvPacketLength_ = 0;
+
+		if (!ret && !isServer())
+			closePending_ = true;
+	}
+
+	dispatching_ = false;
+
+	if (closePending_)
+	{
+		close();
+		return;
+	}
+
+	// 排队期间暂停读取socket， 缓冲区不会继续增长， 压力传回对端
+	if (backlog)
+	{
+		if (!recvQueued_)
+		{
+			// 无法排队时取消预算， 剩下的一次处理完
+			if (!pNetworkInterface_->onRecvBacklog(this))
+			{
+				recvBudget_ = 0;
+				recvBudgetBytes_ = 0;
+				onRecv();
+				return;
+			}
+
+			recvQueued_ = true;
+		}
+
+		pTcpSocket_->suspendRecv(true);
+	}
+	else
+	{
+		// 剩下的是还没收完的包
+		pTcpSocket_->compactRecvBuffer();
+
+		if (!recvQueued_)
+			pTcpSocket_->suspendRecv(false);
+	}
+}
+
+//-------------------------------------------------------------------------------------
+void Session::resumeRecv()
+{
+	recvQueued_ = false;
+
+	if (isDestroyed() || !pTcpSocket_)
+		return;
+
+	onRecv();
+}
+
+//-------------------------------------------------------------------------------------
+bool Session::onRecvBatch(uint32 headerSize, uint32 frameLength)
+{
+	if (pChunkBuffer_ || (header_.flags & FRAME_FLAG_MORE))
+	{
+		ERROR_MSG(fmt::format("Session::onRecvBatch(): unexpected batch frame! msgcmd={}, flags={}, sessionID={}, {}\n",
+			header_.msgcmd, header_.flags, id(), pTcpSocket_->addr()));
+
+		return false;
+	}
+
+	struct evbuffer* pRecvBuffer = pTcpSocket_->getRecvEvbuffer();
+	uint32 bufferLength = (uint32)evbuffer_get_length(pRecvBuffer);
+	uint32 size = header_.msglen;
+	uint32 end = headerSize + size;
+	uint32 pos = headerSize;
+	uint32 packets = 0;
+	bool ret = true;
+	bool failed = false;
+
+	// 每个包都直接在接收缓冲区中解析， 处理函数可能用packetBodyBuffer移走了前面的数据， 偏移要减去移走的部分
+	while (pos < end && !isDestroyed())
+	{
+		uint32 removed = bufferLength - (uint32)evbuffer_get_length(pRecvBuffer);
+
+		uint8 entry[BATCH_ENTRY_HEADER_SIZE];
+		struct evbuffer_ptr ptr;
+		if (pos + BATCH_ENTRY_HEADER_SIZE > end ||
+			evbuffer_ptr_set(pRecvBuffer, &ptr, pos - removed, EVBUFFER_PTR_SET) != 0 ||
+			evbuffer_copyout_from(pRecvBuffer, &ptr, entry, sizeof(entry)) != (ev_ssize_t)sizeof(entry))
+		{
+			ret = false;
+			break;
+		}
+
+		uint32 len;
+		uint16 msgcmd;
+		memcpy(&len, entry, 4);
+		memcpy(&msgcmd, entry + 4, 2);
+
+		header_.msglen = ntohl(len);
+		header_.msgcmd = ntohs(msgcmd);
+		header_.flags = 0;
+
+		if (header_.msglen > end - pos - BATCH_ENTRY_HEADER_SIZE)
+		{
+			ret = false;
+			break;
+		}
+
+		pRecvBody_ = pRecvBuffer;
+		recvBodyOffset_ = pos + BATCH_ENTRY_HEADER_SIZE - removed;
+		recvPacketLength_ = header_.msglen;
+		pos += BATCH_ENTRY_HEADER_SIZE + header_.msglen;
+		++packets;
+
+		if (!onProcessPacket_(id(), NULL, header_.msglen) && !isServer())
+		{
+			failed = true;
+			break;
+		}
+	}
+
+	pRecvBody_ = NULL;
+	recvPacketLength_ = 0;
+
+	if (!ret)
+	{
+		ERROR_MSG(fmt::format("Session::onRecvBatch(): invalid batch frame! length={}, offset={}, sessionID={}, {}\n",
+			size, pos - headerSize, id(), pTcpSocket_->addr()));
+
+		return false;
+	}
+
+	pTcpSocket_->drain(frameLength - (bufferLength - (uint32)evbuffer_get_length(pRecvBuffer)));
+	pNetworkInterface_->onBatchReceived(this, packets, size);
+
+	// 客户端的包处理失败时断开
+	return !failed;
+}
+
+//-------------------------------------------------------------------------------------
+bool Session::onRecvBatch(const uint8* data, uint32 size)
+{
+	uint32 pos = 0;
+	uint32 packets = 0;
+
+	while (pos < size && !isDestroyed())
+	{
+		if (pos + BATCH_ENTRY_HEADER_SIZE > size)
+			break;
+
+		uint32 len;
+		uint16 msgcmd;
+		memcpy(&len, data + pos, 4);
+		memcpy(&msgcmd, data + pos + 4, 2);
+
+		header_.msglen = ntohl(len);
+		header_.msgcmd = ntohs(msgcmd);
+		header_.flags = 0;
+
+		if (header_.msglen > size - pos - BATCH_ENTRY_HEADER_SIZE)
+			break;
+
+		const uint8* body = data + pos + BATCH_ENTRY_HEADER_SIZE;
+		pos += BATCH_ENTRY_HEADER_SIZE + header_.msglen;
+		++packets;
+
+		if (!onProcessPacket_(id(), (uint8*)body, header_.msglen) && !isServer())
+			return false;
+	}
+
+	pNetworkInterface_->onBatchReceived(this, packets, size);
+
+	if (pos < size && !isDestroyed())
+	{
+		ERROR_MSG(fmt::format("Session::onRecvBatch(): invalid batch frame! length={}, offset={}, sessionID={}, {}\n",
+			size, pos, id(), pTcpSocket_->addr()));
+
+		return false;
+	}
+
+	return true;
+}
+
+//-------------------------------------------------------------------------------------
+const uint8* Session::recvPacketData()
+{
+	if (!pRecvBody_)
+		return NULL;
+
+	// 包体跨越多个内存块时才会发生拷贝
+	const uint8* data = evbuffer_pullup(pRecvBody_, recvBodyOffset_ + recvPacketLength_);
+	if (!data)
+		return NULL;
+
+	return data + recvBodyOffset_;
+}
+
+//-------------------------------------------------------------------------------------
+struct evbuffer* Session::packetBodyBuffer()
+{
+	if (!pRecvBody_)
+		return NULL;
+
+	if (recvBodyOffset_ > 0)
+	{
+		evbuffer_drain(pRecvBody_, recvBodyOffset_);
+		recvBodyOffset_ = 0;
+	}
+
+	return pRecvBody_;
+}
+
+//-------------------------------------------------------------------------------------
+const uint8* Session::decompressPacket(uint32 headerSize)
+{
+	// 大包的分帧不会被压缩
+	if (compression_ == PACKET_COMPRESSION_NONE || pChunkBuffer_ || (header_.flags & FRAME_FLAG_MORE))
+	{
+		ERROR_MSG(fmt::format("Session::decompressPacket(): unexpected compressed frame! msgcmd={}, compression={}, sessionID={}, {}\n",
+			header_.msgcmd, compression_, id(), pTcpSocket_->addr()));
+
+		return NULL;
+	}
+
+	const uint8* frame = evbuffer_pullup(pTcpSocket_->getRecvEvbuffer(), headerSize + header_.msglen);
+	if (!frame)
+		return NULL;
+
+	uint32 originalSize = 0;
+	const uint8* data = PacketCompressor::decompress(compressDict_, frame + headerSize, header_.msglen, &originalSize);
+	if (!data)
+	{
+		ERROR_MSG(fmt::format("Session::decompressPacket(): decompress error! msgcmd={}, length={}, sessionID={}, {}\n",
+			header_.msgcmd, header_.msglen, id(), pTcpSocket_->addr()));
+
+		return NULL;
+	}
+
+	pNetworkInterface_->onPacketDecompressed(this, originalSize, header_.msglen);
+
+	header_.msglen = originalSize;
+	return data;
+}
+
+//-------------------------------------------------------------------------------------
+bool Session::onRecvChunk(uint32 headerSize, uint32 frameLength)
+{
+	if (!pChunkBuffer_)
+	{
+		pChunkBuffer_ = evbuffer_new();
+		if (!pChunkBuffer_)
+			return false;
+
+		chunkCmd_ = header_.msgcmd;
+	}
+	else if (header_.msgcmd != chunkCmd_)
+	{
+		ERROR_MSG(fmt::format("Session::onRecvChunk(): chunk cmd mismatch! msgcmd={}, expected={}, sessionID={}, {}\n",
+			header_.msgcmd, chunkCmd_, id(), pTcpSocket_->addr()));
+
+		return false;
+	}
+
+	if (evbuffer_get_length(pChunkBuffer_) + header_.msglen > FRAME_LENGTH_MAX)
+	{
+		ERROR_MSG(fmt::format("Session::onRecvChunk(): packet is too large! msgcmd={}, length={}, sessionID={}, {}\n",
+			header_.msgcmd, evbuffer_get_length(pChunkBuffer_) + header_.msglen, id(), pTcpSocket_->addr()));
+
+		return false;
+	}
+
+	// 整块的内存直接移动过去， 不会拷贝， 加密帧末尾的tag直接丢弃
+	pTcpSocket_->drain(headerSize);
+	if (evbuffer_remove_buffer(pTcpSocket_->getRecvEvbuffer(), pChunkBuffer_, header_.msglen) != (int)header_.msglen)
+		return false;
+
+	pTcpSocket_->drain(frameLength - headerSize - header_.msglen);
+	return true;
+}
+
+//-------------------------------------------------------------------------------------
+bool Session::parsePacket(::google::protobuf::Message& packet, const uint8* data, uint32 size)
+{
+	if (data)
+		return packet.ParseFromArray(data, size);
+
+	EvbufferInputStream stream(pRecvBody_, recvBodyOffset_, size);
+	return packet.ParseFromZeroCopyStream(&stream);
+}
+
+//-------------------------------------------------------------------------------------
+bool Session::onProcessPacket_(SessionID requestorSessionID, uint8 * data, uint32_t size)
+{
+	if (header_.msgcmd > CMD_MAX)
+	{
+		ERROR_MSG(fmt::format("Session::onProcessPacket_(): cmd error! msgcmd={}, sessionID={}, {}\n",
+			packetHeader().msgcmd, id(), pTcpSocket()->addr()));
+
+		return true;
+	}
+
+	if (ResMgr::getSingleton().serverConfig().debugPacket)
+	{
+		DEBUG_MSG(fmt::format("Session::onProcessPacket_(): {}, size={}, sessionID={}, {}\n",
+			CMD_Name((CMD)header_.msgcmd), header_.msglen, id(), pTcpSocket()->addr()));
+	}
+
+	if (header_.msgcmd == CMD::ForwardFrame)
+		return onForwardFrame_(data);
+
+	if (header_.msgcmd == CMD::MulticastFrame)
+		return onMulticastFrame_(data);
+
+	PacketHandlers::Entry* pEntry = packetHandlers().find(header_.msgcmd);
+	if (pEntry)
+		return dispatchPacket(*pEntry, requestorSessionID, data);
+
+	if (!data)
+		data = (uint8*)recvPacketData();
+
+	return onProcessPacket(requestorSessionID, (const uint8*)data, header_.msglen);
+}
+
+//-------------------------------------------------------------------------------------
+bool Session::onForwardFrame_(const uint8* data)
+{
+	if (!isServer() || header_.msglen < ForwardEnvelope::SIZE)
+	{
+		ERROR_MSG(fmt::format("Session::onForwardFrame_(): invalid forward frame! msglen={}, isServer={}, sessionID={}, {}\n",
+			header_.msglen, isServer(), id(), pTcpSocket()->addr()));
+
+		return false;
+	}
+
+	uint8 envelopeData[ForwardEnvelope::SIZE];
+
+	if (data)
+	{
+		memcpy(envelopeData, data, sizeof(envelopeData));
+		data += ForwardEnvelope::SIZE;
+	}
+	else
+	{
+		struct evbuffer_ptr ptr;
+		if (evbuffer_ptr_set(pRecvBody_, &ptr, recvBodyOffset_, EVBUFFER_PTR_SET) != 0 ||
+			evbuffer_copyout_from(pRecvBody_, &ptr, envelopeData, sizeof(envelopeData)) != (ev_ssize_t)sizeof(envelopeData))
+		{
+			return false;
+		}
+
+		recvBodyOffset_ += ForwardEnvelope::SIZE;
+		recvPacketLength_ = header_.msglen - ForwardEnvelope::SIZE;
+	}
+
+	ForwardEnvelope envelope;
+	envelope.decode(envelopeData);
 
-	return pTcpSocket_->getIP();
+	if (envelope.msgcmd == CMD::ForwardFrame)
+		return false;
+
+	return onForwardFrame((SessionID)envelope.requestorID, envelope.msgcmd, data, header_.msglen - ForwardEnvelope::SIZE);
 }
 
 //-------------------------------------------------------------------------------------
-uint16 Session::getPort()
+bool Session::onMulticastFrame_(const uint8* data)
 {
-	if (!pTcpSocket_)
-		return 0;
+	if (!data)
+		data = recvPacketData();
 
-	return pTcpSocket_->getPort();
-}
+	if (!isServer() || !data || header_.msglen < MulticastEnvelope::HEADER_SIZE)
+	{
+		ERROR_MSG(fmt::format("Session::onMulticastFrame_(): invalid multicast frame! msglen={}, isServer={}, sessionID={}, {}\n",
+			header_.msglen, isServer(), id(), pTcpSocket()->addr()));
 
-//-------------------------------------------------------------------------------------
-void Session::onDestroyTimer(void* userargs)
-{
-	XServerBase::getSingleton().pTimer()->delTimer(destroyTimerEvent_);
-	destroyTimerEvent_ = NULL;
+		return false;
+	}
 
-	close();
+	MulticastEnvelope envelope;
+	envelope.decode(data);
+
+	uint32 envelopeSize = MulticastEnvelope::HEADER_SIZE + envelope.count * 8;
+	if (header_.msglen < envelopeSize || envelope.msgcmd == CMD::ForwardFrame || envelope.msgcmd == CMD::MulticastFrame)
+		return false;
+
+	static thread_local std::vector<SessionID> requestors;
+	requestors.resize(envelope.count);
+
+	const uint8* pRequestors = data + MulticastEnvelope::HEADER_SIZE;
+	for (uint16 i = 0; i < envelope.count; ++i)
+		requestors[i] = (SessionID)MulticastEnvelope::decodeID(pRequestors + i * 8);
+
+	return onMulticastFrame(envelope.groupID, requestors, envelope.msgcmd, data + envelopeSize, header_.msglen - envelopeSize);
 }
 
 //-------------------------------------------------------------------------------------
-void Session::destroy()
+bool Session::onMulticastFrame(uint64 groupID, const std::vector<SessionID>& requestors, int32 cmd, const uint8* data, uint32 size)
 {
-	if (destroyTimerEvent_)
-		return;
+	ERROR_MSG(fmt::format("Session::onMulticastFrame(): not supported! appType={}, cmd={}, groupID={}, sessionID={}, {}\n",
+		typeName(), cmd, groupID, id(), pTcpSocket()->addr()));
 
-	destroyTimerEvent_ = XServerBase::getSingleton().pTimer()->addTimer(TIME_SECONDS * 0.1f, -1, 
-		std::bind(&Session::onDestroyTimer, this, std::placeholders::_1), NULL);
+	return true;
 }
 
 //-------------------------------------------------------------------------------------
-bool Session::send(const uint8 *data, uint32 size)
+bool Session::onForwardFrame(SessionID requestorSessionID, int32 cmd, const uint8* data, uint32 size)
 {
-	if (!pTcpSocket_)
-		return false;
+	// 之后的分发看到的就是客户端原来的包
+	header_.msgcmd = (uint16)cmd;
+	header_.msglen = size;
 
-	return pTcpSocket_->send(data, size);
+	return onProcessPacket_(requestorSessionID, (uint8*)data, size);
 }
 
 //-------------------------------------------------------------------------------------
-bool Session::sendPacket(int32 cmd, const uint8 *data, uint32 size)
+bool Session::dispatchPacket(PacketHandlers::Entry& entry, SessionID requestorSessionID, const uint8* data)
 {
-	assert(size <= PACKET_LENGTH_MAX);
-
-	if (ResMgr::getSingleton().serverConfig().netEncrypted)
+	if (!(entry.kinds & (isServer() ? SESSION_KIND_SERVER : SESSION_KIND_CLIENT)))
 	{
-		return encryptSend(cmd, data, size);
-	}
+		++entry.rejected;
 
-	PacketHeader header;
-	header.msglen = (uint16)size;
-	header.msgcmd = cmd;
-	header.encode();
+		ERROR_MSG(fmt::format("Session::dispatchPacket(): {} is not allowed, isServer={}, sessionID={}, {}\n",
+			CMD_Name((CMD)header_.msgcmd), isServer(), id(), pTcpSocket()->addr()));
 
-	if (!send((const uint8*)&header, sizeof(header)))
 		return false;
+	}
 
-	return send(data, size);
-}
-
-//-------------------------------------------------------------------------------------
-bool Session::sendPacket(int32 cmd, const ::google::protobuf::Message& packet)
-{
-	std::string datas;
-	packet.SerializeToString(&datas);
+	++entry.packets;
+	entry.bytes += header_.msglen;
 
-	if (ResMgr::getSingleton().serverConfig().debugPacket)
+	PacketHandlers::Result ret = entry.invoke(this, entry.method, requestorSessionID, data, header_.msglen);
+	if (ret == PacketHandlers::RESULT_PARSE_ERROR)
 	{
-		std::string cmdName = CMD_Name((CMD)cmd);
+		++entry.parseErrors;
 
-		DEBUG_MSG(fmt::format("Session::sendPacket(): appType={}, cmd={} to :{}, size={}.\ndatas={}\n",
-			typeName(), cmdName, pTcpSocket()->addr(), datas.size(), packet.DebugString()));
+		ERROR_MSG(fmt::format("Session::dispatchPacket(): packet parsing error! {}, size={}, sessionID={}, {}\n",
+			CMD_Name((CMD)header_.msgcmd), header_.msglen, id(), pTcpSocket()->addr()));
+
+		return false;
 	}
 
-	return sendPacket(cmd, (uint8*)datas.data(), datas.size());
+	return ret == PacketHandlers::RESULT_OK;
 }
 
 //-------------------------------------------------------------------------------------
-bool Session::forwardPacket(SessionID requestorSessionID, int32 cmd, const ::google::protobuf::Message& packet)
+bool Session::onProcessPacket(SessionID requestorSessionID, const uint8* data, int32 size)
 {
-	std::string datas;
-	packet.SerializeToString(&datas);
+	ERROR_MSG(fmt::format("Session::onProcessPacket(): unknown packet cmd: {}, msglen={}, sessionID={}, {}\n",
+		CMD_Name((CMD)header_.msgcmd), header_.msglen, id(), pTcpSocket()->addr()));
 
-	CMD_ForwardPacket forwardPacket;
-	forwardPacket.set_requestorid(requestorSessionID);
-	forwardPacket.set_datas(datas);
-	forwardPacket.set_msgcmd(cmd);
-	return sendPacket(CMD::ForwardPacket, forwardPacket);
+	return false;
 }
 
 //-------------------------------------------------------------------------------------
-bool Session::encryptSend(int32 cmd, const uint8 *data, uint32 size)
+PacketHandlers& Session::packetHandlers() const
 {
-	uint8 buf[PACKET_LENGTH_MAX + 1];
-
-	PacketHeader header;
-	header.msglen = size;
-	header.msgcmd = cmd;
-	header.encode();
-
-	int offset = sizeof(header);
-	memcpy(buf, (const uint8*)&header, offset);
-	memcpy(buf + offset, data, size);
-
-	return send(buf, offset + size);
+	static PacketHandlers handlers("Session", &Session::registerHandlers);
+	return handlers;
 }
 
 //-------------------------------------------------------------------------------------
-bool Session::decryptSend(const uint8 *data, uint32 size)
+void Session::registerHandlers(PacketHandlers& handlers)
 {
-	return true;
+	handlers.registerHandler<CMD::Hello, CMD_Hello>(&Session::onHello);
+	handlers.registerHandler<CMD::HelloCB, CMD_HelloCB>(&Session::onHelloCB);
+	handlers.registerHandler<CMD::Heartbeat, CMD_Heartbeat>(&Session::onHeartbeat);
+	handlers.registerHandler<CMD::HeartbeatCB, CMD_HeartbeatCB>(&Session::onHeartbeatCB);
+	handlers.registerHandler<CMD::Version_Not_Match, CMD_Version_Not_Match>(&Session::onVersionNotMatch);
+	handlers.registerHandler<CMD::Ping, CMD_Ping>(&Session::onPing);
+	handlers.registerHandler<CMD::Pong, CMD_Pong>(&Session::onPong);
+	handlers.registerHandler<CMD::FrameUpgrade, CMD_FrameUpgrade>(&Session::onFrameUpgrade);
+
+	// 只有服务器之间才会发送的协议
+	handlers.registerHandler<CMD::ShmAttach, CMD_ShmAttach>(&Session::onShmAttach, SESSION_KIND_SERVER);
+	handlers.registerHandler<CMD::UpdateServerInfos, CMD_UpdateServerInfos>(&Session::onUpdateServerInfos, SESSION_KIND_SERVER);
+	handlers.registerHandler<CMD::QueryServerInfos, CMD_QueryServerInfos>(&Session::onQueryServerInfos, SESSION_KIND_SERVER);
+	handlers.registerHandler<CMD::QueryServerInfosCB, CMD_QueryServerInfosCB>(&Session::onQueryServerInfosCB, SESSION_KIND_SERVER);
+	handlers.registerHandler<CMD::ForwardPacket, CMD_ForwardPacket>(&Session::onForwardPacket, SESSION_KIND_SERVER);
 }
 
 //-------------------------------------------------------------------------------------
-void Session::onRecv()
+void Session::onHello(const CMD_Hello& packet)
 {
-	//INFO_MSG(fmt::format("Session::onRecv()\n"));
-
-	while (true)
+	if (packet.version() != XPLATFORMSERVER_VERSION)
 	{
-		if (isDestroyed())
-		{
-			close();
-			return;
-		}
+		CMD_Version_Not_Match res_packet;
+		res_packet.set_appid(XServerBase::getSingleton().id());
+		res_packet.set_apptype((int32)XServerBase::getSingleton().type());
+		res_packet.set_version(XPLATFORMSERVER_VERSION);
+		sendPacket(CMD::Version_Not_Match, res_packet);
 
-		if (!headerRcved_)
-		{
-			if (sizeof(headerRcved_) > pTcpSocket_->getRecvBufferLength())
-				return;
+		close();
+	}
 
-			pTcpSocket_->recv((uint8*)&header_, sizeof(header_));
+	// 旧的对端不带frameVersion， 继续使用版本1
+	uint8 frameVersion = (uint8)std::max<uint32>(FRAME_VERSION_1, std::min<uint32>(packet.frameversion(), FRAME_VERSION_MAX));
 
-			header_.decode();
+	CMD_HelloCB res_packet;
+	res_packet.set_appid(XServerBase::getSingleton().id());
+	res_packet.set_apptype((int32)XServerBase::getSingleton().type());
+	res_packet.set_version(XPLATFORMSERVER_VERSION);
+	res_packet.set_frameversion(frameVersion);
 
-			if (header_.msglen > PACKET_LENGTH_MAX)
-			{
-				ERROR_MSG(fmt::format("Session::onRecv(): invalid packet length: {}, msgcmd={}, isServer={}, sessionID={}, {}\n",
-					header_.msglen, header_.msgcmd, isServer(), id(), pTcpSocket_->addr()));
+	// 压缩标志在版本2的包头中， 两端都支持时才开启
+	const ResMgr::ServerConfig& cfg = ResMgr::getSingleton().serverConfig();
+	int compression = pNetworkInterface_->isInternalNetwork() ? cfg.internal_COMPRESS : cfg.external_COMPRESS;
+	if (frameVersion >= FRAME_VERSION_2 && compression == PACKET_COMPRESSION_LZ && packet.compression() == PACKET_COMPRESSION_LZ)
+	{
+		res_packet.set_compression(PACKET_COMPRESSION_LZ);
 
-				close();
-				return;
-			}
+		if (packet.compressdict() != 0 && packet.compressdict() == PacketCompressor::dictionaryID())
+			res_packet.set_compressdict(packet.compressdict());
+	}
 
-			headerRcved_ = true;
-		}
+	if (frameVersion >= FRAME_VERSION_2 && !acceptCipher(packet, res_packet))
+	{
+		ERROR_MSG(fmt::format("Session::onHello(): key exchange failed! sessionID={}, {}\n", id(), addr()));
 
-		// ȴյ㹻
-		if (header_.msglen > pTcpSocket_->getRecvBufferLength())
-			return;
+		destroy();
+		return;
+	}
 
-		//DEBUG_MSG(fmt::format("Session::onRecv(): length={}, cmd={}, isServer={}, sessionID={}, {}\n", 
-		//	header_.msglen, header_.msgcmd, isServer(), id(), pTcpSocket_->addr()));
+	// 合并帧的标志也在版本2的包头中
+	res_packet.set_batch(frameVersion >= FRAME_VERSION_2);
 
-		lastReceivedTime_ = getTimeStamp();
+	// 对端在同一台机器上时先建好共享内存， 等对端attach后发来ShmAttach再切换
+	std::string shmName;
+	if (offerShm(packet.hostid(), shmName))
+		res_packet.set_shmname(shmName);
 
-		uint8 data[PACKET_LENGTH_MAX + 1];
-		if (!pTcpSocket()->recv(data, header_.msglen))
-		{
-			ERROR_MSG(fmt::format("Session::onRecv(): recv error! msglen={}, msgcmd={}, sessionID={}, {}\n",
-				packetHeader().msglen, packetHeader().msgcmd, id(), pTcpSocket()->addr()));
+	sendPacket(CMD::HelloCB, res_packet);
 
-			return;
-		}
+	if (frameVersion >= FRAME_VERSION_2 && packet.batch())
+		enableBatching();
 
-		// ⿪ִַ
-		if (!onProcessPacket_(id(), data, header_.msglen))
-		{
-			if(!isServer())
-				close();
-				
-			return;
-		}
+	// HelloCB仍使用旧包头， 之后发出的包使用新版本， 对端发来FrameUpgrade之后才切换接收
+	sendFrameVersion_ = frameVersion;
+	compression_ = (uint8)res_packet.compression();
+	compressDict_ = res_packet.compressdict() != 0;
+	sendEncrypted_ = res_packet.cipher() != CIPHER_NONE;
 
-		headerRcved_ = false;
-	}
+	appType((ServerType)packet.apptype());
+
+	if(!isServer() && (appType() != ServerType::SERVER_TYPE_CLIENT || appType() != ServerType::SERVER_TYPE_ROBOT))
+		appType(ServerType::SERVER_TYPE_CLIENT);
+
+	enablePriority();
+
+	XServerBase::getSingleton().onSessionHello(this, packet);
 }
 
 //-------------------------------------------------------------------------------------
-bool Session::onProcessPacket_(SessionID requestorSessionID, uint8 * data, uint32_t size)
-{
-	if (ResMgr::getSingleton().serverConfig().netEncrypted)
-	{
-		decryptSend((const uint8*)data, header_.msglen);
-	}
+void Session::onHelloCB(const CMD_HelloCB& packet)
+{	
+	appID(packet.appid());
+	appType((ServerType)packet.apptype());
 
-	if (header_.msgcmd > CMD_MAX)
+	// 对端在HelloCB之后已经使用新版本发送， 通知对端后自己也切换
+	if (packet.frameversion() > recvFrameVersion_ && packet.frameversion() <= FRAME_VERSION_MAX)
 	{
-		ERROR_MSG(fmt::format("Session::onProcessPacket_(): cmd error! msgcmd={}, sessionID={}, {}\n",
-			packetHeader().msgcmd, id(), pTcpSocket()->addr()));
+		recvFrameVersion_ = (uint8)packet.frameversion();
 
-		return true;
+		CMD_FrameUpgrade req_packet;
+		req_packet.set_version(recvFrameVersion_);
+		sendPacket(CMD::FrameUpgrade, req_packet);
+
+		sendFrameVersion_ = recvFrameVersion_;
 	}
 
-	if (ResMgr::getSingleton().serverConfig().debugPacket)
+	if (recvFrameVersion_ >= FRAME_VERSION_2 && packet.batch())
+		enableBatching();
+
+	if (recvFrameVersion_ >= FRAME_VERSION_2 && packet.compression() == PACKET_COMPRESSION_LZ)
 	{
-		DEBUG_MSG(fmt::format("Session::onProcessPacket_(): {}, size={}, sessionID={}, {}\n",
-			CMD_Name((CMD)header_.msgcmd), header_.msglen, id(), pTcpSocket()->addr()));
+		compression_ = PACKET_COMPRESSION_LZ;
+		compressDict_ = packet.compressdict() != 0 && packet.compressdict() == PacketCompressor::dictionaryID();
 	}
 
-	switch (header_.msgcmd)
+	// FrameUpgrade以明文发出， 之后两个方向都加密； 对端不支持时按明文继续
+	if (pCipher_ && pCipher_->type() == CIPHER_NONE)
 	{
-		case CMD::Hello:
+		if (recvFrameVersion_ >= FRAME_VERSION_2 && packet.cipher() != CIPHER_NONE)
 		{
-			CMD_Hello packet;
-			PARSE_PACKET();
+			if (!pCipher_->deriveKeys((CipherType)packet.cipher(), packet.cipherkey(), true))
+			{
+				ERROR_MSG(fmt::format("Session::onHelloCB(): key exchange failed! cipher={}, sessionID={}, {}\n",
+					packet.cipher(), id(), addr()));
 
-			onHello(packet);
-			break;
-		}
-		case CMD::HelloCB:
-		{
-			CMD_HelloCB packet;
-			PARSE_PACKET();
+				destroy();
+				return;
+			}
 
-			onHelloCB(packet);
-			break;
+			sendEncrypted_ = recvEncrypted_ = true;
 		}
-		case CMD::Heartbeat:
+		else
 		{
-			CMD_Heartbeat packet;
-			PARSE_PACKET();
-
-			onHeartbeat(packet);
-			break;
+			SAFE_RELEASE(pCipher_);
 		}
-		case CMD::HeartbeatCB:
-		{
-			CMD_HeartbeatCB packet;
-			PARSE_PACKET();
+	}
 
-			onHeartbeatCB(packet);
-			break;
-		}
-		case CMD::Version_Not_Match:
-		{
-			CMD_Version_Not_Match packet;
-			PARSE_PACKET();
+	// eventfd的交接在循环中异步完成， 在此之前链路一直使用TCP
+	if (packet.shmname().size() > 0)
+	{
+		std::string name = packet.shmname();
 
-			onVersionNotMatch(packet);
-			break;
-		}
-		case CMD::UpdateServerInfos:
-		{
-			CMD_UpdateServerInfos packet;
-			PARSE_PACKET();
+		if (!pTcpSocket_->attachShm(pEventDispatcher_, name, std::bind(&Session::onShmAttached, this, name, std::placeholders::_1)))
+			onShmAttached(name, false);
+	}
 
-			onUpdateServerInfos(packet);
-			break;
-		}
-		case CMD::QueryServerInfos:
-		{
-			CMD_QueryServerInfos packet;
-			PARSE_PACKET();
+	enablePriority();
 
-			onQueryServerInfos(packet);
-			break;
-		}
-		case CMD::QueryServerInfosCB:
-		{
-			CMD_QueryServerInfosCB packet;
-			PARSE_PACKET();
+	XServerBase::getSingleton().onSessionHelloCB(this, packet);
+}
 
-			onQueryServerInfosCB(packet);
-			break;
-		}
-		case CMD::Ping:
-		{
-			CMD_Ping packet;
-			PARSE_PACKET();
+//-------------------------------------------------------------------------------------
+void Session::prepareHello(CMD_Hello& packet)
+{
+	packet.set_frameversion(FRAME_VERSION_MAX);
+	packet.set_batch(true);
 
-			onPing(packet);
-			break;
-		}
-		case CMD::Pong:
-		{
-			CMD_Pong packet;
-			PARSE_PACKET();
+	const ResMgr::ServerConfig& cfg = ResMgr::getSingleton().serverConfig();
 
-			onPong(packet);
-			break;
-		}
-		case CMD::ForwardPacket:
-		{
-			CMD_ForwardPacket packet;
-			PARSE_PACKET();
+	if (pNetworkInterface_->isInternalNetwork() && cfg.internal_SHM_RING > 0)
+		packet.set_hostid(ShmChannel::hostID());
 
-			return onForwardPacket(packet);
-			break;
-		}
-		default:
-		{
-			return onProcessPacket(requestorSessionID, (const uint8*)&data[0], header_.msglen);
-			break;
-		}
-	};
+	int compression = pNetworkInterface_->isInternalNetwork() ? cfg.internal_COMPRESS : cfg.external_COMPRESS;
+	if (compression == PACKET_COMPRESSION_LZ)
+	{
+		packet.set_compression(PACKET_COMPRESSION_LZ);
+		packet.set_compressdict(PacketCompressor::dictionaryID());
+	}
 
-	return true;
+	// 两种算法都支持， 由接受连接的一方按自己的配置选择
+	int cipher = pNetworkInterface_->isInternalNetwork() ? cfg.internal_ENCRYPT : cfg.external_ENCRYPT;
+	if (!cfg.netEncrypted || cipher == CIPHER_NONE)
+		return;
+
+	if (!pCipher_)
+		pCipher_ = new SessionCipher();
+
+	std::string publicKey;
+	if (!pCipher_->generateKey(publicKey))
+	{
+		SAFE_RELEASE(pCipher_);
+		return;
+	}
+
+	packet.set_ciphers((1 << CIPHER_AES_128_GCM) | (1 << CIPHER_CHACHA20_POLY1305));
+	packet.set_cipherkey(publicKey);
 }
 
 //-------------------------------------------------------------------------------------
-void Session::onHello(const CMD_Hello& packet)
+bool Session::acceptCipher(const CMD_Hello& packet, CMD_HelloCB& res_packet)
 {
-	if (packet.version() != XPLATFORMSERVER_VERSION)
+	const ResMgr::ServerConfig& cfg = ResMgr::getSingleton().serverConfig();
+
+	// 对端没有提供密钥时按明文继续， 兼容旧的客户端
+	int cipher = pNetworkInterface_->isInternalNetwork() ? cfg.internal_ENCRYPT : cfg.external_ENCRYPT;
+	if (!cfg.netEncrypted || cipher <= CIPHER_NONE || cipher > CIPHER_MAX ||
+		!(packet.ciphers() & (1 << cipher)) || packet.cipherkey().size() == 0)
 	{
-		CMD_Version_Not_Match res_packet;
-		res_packet.set_appid(XServerBase::getSingleton().id());
-		res_packet.set_apptype((int32)XServerBase::getSingleton().type());
-		res_packet.set_version(XPLATFORMSERVER_VERSION);
-		sendPacket(CMD::Version_Not_Match, res_packet);
+		return true;
+	}
 
-		close();
+	SAFE_RELEASE(pCipher_);
+	pCipher_ = new SessionCipher();
+
+	std::string publicKey;
+	if (!pCipher_->generateKey(publicKey) || !pCipher_->deriveKeys((CipherType)cipher, packet.cipherkey(), false))
+	{
+		SAFE_RELEASE(pCipher_);
+		return false;
 	}
 
-	CMD_HelloCB res_packet;
-	res_packet.set_appid(XServerBase::getSingleton().id());
-	res_packet.set_apptype((int32)XServerBase::getSingleton().type());
-	res_packet.set_version(XPLATFORMSERVER_VERSION);
-	sendPacket(CMD::HelloCB, res_packet);
+	res_packet.set_cipher(cipher);
+	res_packet.set_cipherkey(publicKey);
+	return true;
+}
 
-	appType((ServerType)packet.apptype());
+//-------------------------------------------------------------------------------------
+void Session::onShmAttached(const std::string& name, bool ok)
+{
+	if (isDestroyed())
+		return;
 
-	if(!isServer() && (appType() != ServerType::SERVER_TYPE_CLIENT || appType() != ServerType::SERVER_TYPE_ROBOT))
-		appType(ServerType::SERVER_TYPE_CLIENT);
+	// ShmAttach是最后一个经过TCP发出的包
+	CMD_ShmAttach req_packet;
+	req_packet.set_ok(ok);
+	sendPacket(CMD::ShmAttach, req_packet);
 
-	XServerBase::getSingleton().onSessionHello(this, packet);
+	if (ok)
+		pTcpSocket_->startShmSend();
+	else
+		WARNING_MSG(fmt::format("Session::onShmAttached(): attach shared memory {} failed, using TCP. sessionID={}, {}\n",
+			name, id(), addr()));
 }
 
 //-------------------------------------------------------------------------------------
-void Session::onHelloCB(const CMD_HelloCB& packet)
-{	
-	appID(packet.appid());
-	appType((ServerType)packet.apptype());
+bool Session::offerShm(const std::string& hostID, std::string& name)
+{
+	const ResMgr::ServerConfig& cfg = ResMgr::getSingleton().serverConfig();
 
-	XServerBase::getSingleton().onSessionHelloCB(this, packet);
+	if (!isServer() || !pNetworkInterface_->isInternalNetwork() || cfg.internal_SHM_RING == 0 ||
+		hostID.size() == 0 || hostID != ShmChannel::hostID())
+	{
+		return false;
+	}
+
+	return pTcpSocket_->listenShm(pEventDispatcher_, cfg.internal_SHM_RING, name);
+}
+
+//-------------------------------------------------------------------------------------
+void Session::onShmAttach(const CMD_ShmAttach& packet)
+{
+	if (!pTcpSocket_->hasShm())
+		return;
+
+	if (!packet.ok())
+	{
+		WARNING_MSG(fmt::format("Session::onShmAttach(): peer failed to attach shared memory, using TCP. sessionID={}, {}\n",
+			id(), addr()));
+
+		pTcpSocket_->closeShm();
+		return;
+	}
+
+	// 对端在这个包之后只写共享内存
+	pTcpSocket_->startShmRecv();
+
+	// 接受连接的一方回复之后也切换发送
+	if (!pTcpSocket_->shmSending())
+	{
+		CMD_ShmAttach res_packet;
+		res_packet.set_ok(true);
+		sendPacket(CMD::ShmAttach, res_packet);
+
+		pTcpSocket_->startShmSend();
+
+		INFO_MSG(fmt::format("Session::onShmAttach(): {} switched to shared memory. sessionID={}, {}\n",
+			typeName(), id(), addr()));
+	}
 }
 
 //-------------------------------------------------------------------------------------
@@ -435,10 +2433,29 @@ void Session::onVersionNotMatch(const CMD_Version_Not_Match& packet)
 		XPLATFORMSERVER_VERSION, ServerType2Name[(int)packet.apptype()], packet.version(), packet.appid()));
 }
 
+//-------------------------------------------------------------------------------------
+void Session::onFrameUpgrade(const CMD_FrameUpgrade& packet)
+{
+	// 只能切换到在onHello中协商好的版本
+	if (packet.version() != sendFrameVersion_)
+	{
+		ERROR_MSG(fmt::format("Session::onFrameUpgrade(): invalid frame version {}, negotiated={}, sessionID={}, {}\n",
+			packet.version(), sendFrameVersion_, id(), addr()));
+
+		destroy();
+		return;
+	}
+
+	recvFrameVersion_ = (uint8)packet.version();
+
+	// 对端在FrameUpgrade之后的帧都已加密
+	recvEncrypted_ = pCipher_ != NULL && pCipher_->type() != CIPHER_NONE;
+}
+
 //-------------------------------------------------------------------------------------
 void Session::onHeartbeat(const CMD_Heartbeat& packet)
 {
-	CMD_HeartbeatCB res_packet;
+	static thread_local CMD_HeartbeatCB res_packet;
 	res_packet.set_appid(XServerBase::getSingleton().id());
 	sendPacket(CMD::HeartbeatCB, res_packet);
 }
@@ -470,11 +2487,24 @@ void Session::onQueryServerInfosCB(const CMD_QueryServerInfosCB& packet)
 void Session::onSent()
 {
 	//INFO_MSG(fmt::format("Session::onSent()\n"));
+
+	// socket中的数据降到低水位， 从优先级队列补充
+	if (priorityQueued_ > 0 && pumpSendQueues(false) && pTcpSocket_->corked())
+		pNetworkInterface_->onPacketCorked(this);
+
+	checkSendQueueDrained();
 }
 
 //-------------------------------------------------------------------------------------
 void Session::close()
 {
+	// 分发过程中不能销毁自己， 等onRecv处理完当前的包再关闭
+	if (dispatching_)
+	{
+		closePending_ = true;
+		return;
+	}
+
 	DEBUG_MSG(fmt::format("Session::close(): type={}, isServer={}, sessionID={}, {}\n",
 		ServerType2Name[(int)appType_], isServer(), id(), pTcpSocket_->addr()));
 
@@ -482,6 +2512,24 @@ void Session::close()
 	onDisconnected();
 	XServerBase::getSingleton().onSessionDisconnected(this);
 
+	if (sendQueueOverflows_ > 0)
+	{
+		INFO_MSG(fmt::format("Session::close(): send queue stats: peak={}, overflows={}, droppedPackets={}, droppedBytes={}, sessionID={}\n",
+			sendQueuePeak_, sendQueueOverflows_, droppedPackets_, droppedBytes_, id()));
+	}
+
+	// 关闭前尽量写出本轮已合并的数据， 队列中的帧也一起交给socket
+	bool needFlush = priorityQueued_ > 0 && pumpSendQueues(true);
+
+	if (flushPending_)
+	{
+		pNetworkInterface_->cancelFlush(this);
+		needFlush = true;
+	}
+
+	if (needFlush)
+		pTcpSocket_->flush(true);
+
 	pTcpSocket_->close();
 	pNetworkInterface_->removeSession(id());
 }
@@ -499,6 +2547,18 @@ void Session::onDisconnected()
 //-------------------------------------------------------------------------------------
 void Session::handleEvent(short events)
 {
+	// 对端退出前写入共享内存的数据可能还没取， onRecv中可能已经关闭了自己
+	if ((events & (BEV_EVENT_EOF | BEV_EVENT_ERROR)) && pTcpSocket_->pollShm())
+	{
+		SessionID sessionID = id_;
+		NetworkInterface* pNetworkInterface = pNetworkInterface_;
+
+		onRecv();
+
+		if (pNetworkInterface->findSession(sessionID) != this)
+			return;
+	}
+
 	if (events & BEV_EVENT_EOF) {
 		INFO_MSG(fmt::format("Session::handleEvent(): Connection closed. type={}, isServer={}, sessionID={}, {}\n", 
 			ServerType2Name[(int)appType_], isServer(), id(), pTcpSocket_->addr()));
@@ -594,10 +2654,11 @@ void Session::onPong(const CMD_Pong& packet)
 //-------------------------------------------------------------------------------------
 bool Session::onForwardPacket(const CMD_ForwardPacket& packet)
 {
-	ERROR_MSG(fmt::format("XSession::onForwardPacket(): Not implemented!, id={}, {}, datasize={}\n",
-		id(), addr(), header_.msglen));
+	// 未升级的对端仍然发送旧的转发协议， 包体在datas中而不在接收缓冲区
+	pRecvBody_ = NULL;
 
-	return true;
+	const std::string& datas = packet.datas();
+	return onForwardFrame((SessionID)packet.requestorid(), packet.msgcmd(), (const uint8*)datas.data(), (uint32)datas.size());
 }
 
 //-------------------------------------------------------------------------------------
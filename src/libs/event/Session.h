@@ -3,29 +3,37 @@
 
 #include "event/common.h"
 #include "protos/Commands.pb.h"
+#include "event/Timer.h"
+#include "event/SessionPool.h"
+#include "event/PacketHandlers.h"
 
 namespace XServer {
 
 class NetworkInterface;
 class EventDispatcher;
 class TcpSocket;
+class SessionCipher;
 
-#define PARSE_PACKET() \
-	if (!packet.ParseFromArray(data, header_.msglen))\
-	{ \
-		ERROR_MSG(fmt::format("Session::onProcessPacket_(): packet parsing error! {}, size={}, sessionID={}, {}\n", \
-			CMD_Name((CMD)header_.msgcmd), header_.msglen, id(), pTcpSocket()->addr())); \
-	\
-		return false; \
-	} \
-
+// 多个session共享的包体， 发送缓冲区直接引用其内存
+typedef std::shared_ptr<const std::string> SharedPacketData;
 
 class Session
 {
+	friend class NetworkInterface;
+
 public:
 	Session(SessionID sessionID, socket_t sock, NetworkInterface* pNetworkInterface, EventDispatcher* pEventDispatcher);
 	virtual ~Session();
 
+	// 各服务器的session子类都从池中分配
+	static void* operator new(size_t size) {
+		return SessionAllocator::allocate(size);
+	}
+
+	static void operator delete(void* p, size_t size) {
+		SessionAllocator::deallocate(p, size);
+	}
+
 	NetworkInterface* pNetworkInterface() {
 		return pNetworkInterface_;
 	}
@@ -77,11 +85,101 @@ public:
 		return header_;
 	}
 
+	// 与对端协商后的收发包头版本
+	uint8 sendFrameVersion() const {
+		return sendFrameVersion_;
+	}
+
+	uint8 recvFrameVersion() const {
+		return recvFrameVersion_;
+	}
+
+	// 与对端协商后的包体压缩算法(PacketCompression)
+	uint8 compression() const {
+		return compression_;
+	}
+
+	// 与对端协商后合并转发包的上限， 0表示不合并
+	uint32 batchMax() const {
+		return batchMax_;
+	}
+
+	// 链路加密算法(CipherType)， 握手完成前为CIPHER_NONE
+	uint8 cipher() const;
+
+	// 发起连接的一方在Hello中带上本端支持的包头版本、 压缩算法和加密密钥
+	void prepareHello(CMD_Hello& packet);
+
 	bool send(const uint8 *data, uint32 size);
-	bool encryptSend(int32 cmd, const uint8 *data, uint32 size);
 	bool sendPacket(int32 cmd, const uint8 *data, uint32 size);
 	bool sendPacket(int32 cmd, const ::google::protobuf::Message& packet);
+
+	// 从pBody的开头取走size字节作为包体， 整块的内存直接移动到发送缓冲区
+	bool sendPacket(int32 cmd, struct evbuffer* pBody, uint32 size);
+
+	// 以ForwardFrame转发给对端， 对端按requestorSessionID和cmd分发包体
 	bool forwardPacket(SessionID requestorSessionID, int32 cmd, const ::google::protobuf::Message& packet);
+	bool forwardPacket(SessionID requestorSessionID, int32 cmd, const uint8 *data, uint32 size);
+	bool forwardPacket(SessionID requestorSessionID, int32 cmd, struct evbuffer* pBody, uint32 size);
+
+	// 发给connector， 由它转发给groupID中以及requestors列出的所有客户端， 包体只写一次
+	bool multicastPacket(uint64 groupID, const std::vector<SessionID>& requestors, int32 cmd, const uint8 *data, uint32 size);
+	bool multicastPacket(uint64 groupID, const std::vector<SessionID>& requestors, int32 cmd, const ::google::protobuf::Message& packet);
+
+	// 包体不拷贝， 发送缓冲区引用pData直到写出； 链路加密或需要压缩时退化为拷贝
+	bool sendSharedPacket(int32 cmd, const SharedPacketData& pData);
+
+	// corking模式下由NetworkInterface在事件循环的每轮末尾调用
+	bool flush();
+
+	bool flushPending() const {
+		return flushPending_;
+	}
+
+	void flushPending(bool v) {
+		flushPending_ = v;
+	}
+
+	// 发送队列统计
+	uint32 sendQueueLength() const;
+
+	uint32 sendQueuePeak() const {
+		return sendQueuePeak_;
+	}
+
+	uint32 sendQueueOverflows() const {
+		return sendQueueOverflows_;
+	}
+
+	uint64 droppedPackets() const {
+		return droppedPackets_;
+	}
+
+	uint64 droppedBytes() const {
+		return droppedBytes_;
+	}
+
+	bool isSendQueueFull() const {
+		return sendQueueFull_;
+	}
+
+	int sendQueuePolicy() const {
+		return sendQueuePolicy_;
+	}
+
+	// 暂停/恢复读取对端的数据， 只能在所属的循环中调用
+	// 可以因为多个原因叠加暂停， 恢复的次数和暂停相同时才重新读取
+	void pauseRecv(bool pause);
+
+	// 开启优先级队列后， 还在各优先级队列中没有交给socket的字节数
+	uint32 priorityQueued() const {
+		return priorityQueued_;
+	}
+
+	// 每个优先级交给socket的帧数
+	uint64 priorityFrames(uint8 priority) const {
+		return priority < SEND_PRIORITY_MAX ? priorityFrames_[priority] : 0;
+	}
 
 	bool connected() const {
 		return connected_;
@@ -103,18 +201,26 @@ public:
 
 	time_t ping();
 
+	// data为NULL时表示包体还在接收缓冲区中， 由parsePacket直接从缓冲区解析
 	bool onProcessPacket_(SessionID requestorSessionID, uint8 * data, uint32_t size);
 
-	virtual bool onProcessPacket(SessionID requestorSessionID, const uint8* data, int32 size) {
-		return true;
-	}
+	bool parsePacket(::google::protobuf::Message& packet, const uint8* data, uint32 size);
+
+	// 协议表中没有处理函数的包， 默认视为未知协议
+	virtual bool onProcessPacket(SessionID requestorSessionID, const uint8* data, int32 size);
+
+	// 本类型session的协议表， 子类覆盖时在自己的registerHandlers中先注册基类的协议
+	virtual PacketHandlers& packetHandlers() const;
 
 	bool isDestroyed() const {
-		return destroyTimerEvent_ != NULL;
+		return destroyed_;
 	}
 
 	void destroy();
 
+	// 轮到所属循环接收队列中的这个session， 继续处理上次超出预算留下的包
+	void resumeRecv();
+
 protected:
 	void close();
 
@@ -128,6 +234,8 @@ protected:
 	virtual void onHeartbeatCB(const CMD_HeartbeatCB& packet);
 
 	virtual void onVersionNotMatch(const CMD_Version_Not_Match& packet);
+	virtual void onFrameUpgrade(const CMD_FrameUpgrade& packet);
+	virtual void onShmAttach(const CMD_ShmAttach& packet);
 
 	virtual void onUpdateServerInfos(const CMD_UpdateServerInfos& packet);
 
@@ -139,13 +247,120 @@ protected:
 
 	virtual bool onForwardPacket(const CMD_ForwardPacket& packet);
 
+	// 收到转发的包， data为NULL时包体还在接收缓冲区中， 默认按包体的cmd分发
+	virtual bool onForwardFrame(SessionID requestorSessionID, int32 cmd, const uint8* data, uint32 size);
+
+	// 收到组播帧， 只有connector处理
+	virtual bool onMulticastFrame(uint64 groupID, const std::vector<SessionID>& requestors, int32 cmd, const uint8* data, uint32 size);
+
 	virtual void onConnected();
 	virtual void onDisconnected();
 
-	void onDestroyTimer(void* userargs);
+	// 发送队列超过上限/降回低水位时回调， 默认在PAUSE_UPSTREAM策略下先交给应用暂停写入这里的session，
+	// 应用没有处理时暂停/恢复读取对端的数据
+	virtual void onSendQueueFull(bool full);
+
+	// 发送队列满时可以丢弃的包
+	virtual bool isDroppable(int32 cmd) const;
+
+	// 包的发送优先级(SendPriority)， forwarded为true时cmd是转发或组播的包体的cmd
+	// 配置[send_priority]中列出的cmd以配置为准
+	virtual uint8 sendPriority(int32 cmd, bool forwarded) const;
+
+	// 超过心跳间隔的两倍没有收到任何数据视为超时， 由时间轮检查， 不需要遍历所有session
+	void addLivenessTimer(uint32 delay);
+	void onLivenessTimer(void* userargs);
+
+	const uint8* recvPacketData();
+
+	// 正在分发的包体还在接收缓冲区中时， 移除它前面的数据并返回该缓冲区， 包体就在缓冲区的开头
+	// 之后可以用evbuffer_remove_buffer把包体移走， 没有取走的部分在分发结束后丢弃
+	// 包体已解压或来自旧的ForwardPacket时返回NULL， 此时使用data
+	struct evbuffer* packetBodyBuffer();
+
+	static void registerHandlers(PacketHandlers& handlers);
+
+	bool dispatchPacket(PacketHandlers::Entry& entry, SessionID requestorSessionID, const uint8* data);
 	
 private:
-	bool decryptSend(const uint8 *data, uint32 size);
+	// 在发送缓冲区中直接预留整个包的空间， 返回包体的写入位置
+	uint8* reservePacket(int32 cmd, uint32 size, struct evbuffer_iovec& vec);
+	bool commitPacket(struct evbuffer_iovec& vec);
+
+	// 包头和前缀写入发送缓冲区后， 从pBody移入size字节， 加密时在发送缓冲区中原地进行
+	bool sendFrame(int32 cmd, const uint8* prefix, uint32 prefixSize, struct evbuffer* pBody, uint32 size, uint8 flags = 0);
+
+	// 转发的包先追加到合并缓冲区， 达到batchMax_或本轮事件循环结束时作为一帧发出
+	bool canBatch(uint32 size) const {
+		return batchMax_ > 0 && BATCH_ENTRY_HEADER_SIZE + size < batchMax_;
+	}
+
+	uint8* reserveBatch(int32 cmd, uint32 size, struct evbuffer_iovec& vec);
+	bool commitBatch(struct evbuffer_iovec& vec);
+	bool batchFrame(int32 cmd, const uint8* prefix, uint32 prefixSize, struct evbuffer* pBody, uint32 size);
+	bool onPacketBatched();
+	bool flushBatch();
+	void enableBatching();
+
+	// 逐个分发合并帧中的包， 包体在接收缓冲区中或已解压到data
+	bool onRecvBatch(uint32 headerSize, uint32 frameLength);
+	bool onRecvBatch(const uint8* data, uint32 size);
+
+	// 解开ForwardFrame的信封后分发
+	bool onForwardFrame_(const uint8* data);
+	bool onMulticastFrame_(const uint8* data);
+
+	static void releaseSharedPacket(const void* data, size_t size, void* extra);
+
+	// 超过FRAME_CHUNK_SIZE的包分成多帧写入发送缓冲区
+	bool sendChunked(int32 cmd, const uint8 *data, uint32 size);
+	bool sendChunked(int32 cmd, const ::google::protobuf::Message& packet, uint32 size);
+	bool sendChunks(int32 cmd, struct evbuffer* pBody);
+
+	bool shouldCompress(uint32 size) const {
+		return compression_ != PACKET_COMPRESSION_NONE && size >= compressThreshold_ && size <= FRAME_CHUNK_SIZE;
+	}
+
+	// 压缩后写入发送缓冲区， 压缩后没有变小时按原样发送
+	bool sendCompressed(int32 cmd, const uint8 *data, uint32 size, uint8 flags = 0);
+
+	// 解压当前收到的包， 返回的数据在下一次解压前有效
+	const uint8* decompressPacket(uint32 headerSize);
+
+	// 收集大包的一帧， 所有帧到齐后整体分发
+	bool onRecvChunk(uint32 headerSize, uint32 frameLength);
+	void onPacketQueued();
+	bool checkSendQueue(int32 cmd, uint32 size);
+	void checkSendQueueDrained();
+
+	// 加密时每帧末尾的tag长度
+	uint32 frameTrailerSize() const;
+
+	// 帧写入的缓冲区， 开启优先级队列并且socket有积压时是该包优先级的队列
+	struct evbuffer* sendBuffer(int32 cmd);
+
+	// 直接写入socket的帧在写入时加密， 进入队列的帧在取出时按实际发送的顺序加密
+	bool sealOnWrite(struct evbuffer* pSendBuffer) const;
+
+	// 握手完成、 包头版本和加密都确定之后开启
+	void enablePriority();
+
+	// socket中未发送的数据少于priorityLowat_时按优先级从队列中补充， all为true时全部取出
+	bool pumpSendQueues(bool all);
+
+	// 在队列中原地加密offset处的帧， tag写入排队时预留的位置
+	bool sealQueuedFrame(struct evbuffer* pQueue, uint32 offset, const uint8* headerData, uint32 headerSize, uint32 msglen);
+
+	// 原地解密接收缓冲区中的当前帧， 成功后header_.msglen不再包含tag
+	bool decryptFrame(const uint8* headerData, uint32 headerSize);
+
+	bool acceptCipher(const CMD_Hello& packet, CMD_HelloCB& res_packet);
+
+	// 对端与本机相同时创建共享内存通道并开始监听
+	bool offerShm(const std::string& hostID, std::string& name);
+
+	// 发起连接的一方attach完成后通知对端， 失败时继续使用TCP
+	void onShmAttached(const std::string& name, bool ok);
 	void handleEvent(short events);
 
 	static void recvCallback(struct bufferevent *bev, void *data);
@@ -163,8 +378,70 @@ protected:
 
 	TcpSocket* pTcpSocket_;
 
-	bool headerRcved_;
 	PacketHeader header_;
+	uint32 recvPacketLength_;
+
+	// 正在分发的包体所在的缓冲区及偏移， parsePacket直接从这里解析
+	struct evbuffer* pRecvBody_;
+	uint32 recvBodyOffset_;
+
+	// 分成多帧的大包先收集到这里
+	struct evbuffer* pChunkBuffer_;
+	uint16 chunkCmd_;
+
+	uint8 sendFrameVersion_;
+	uint8 recvFrameVersion_;
+
+	uint8 compression_;
+	bool compressDict_;
+	uint32 compressThreshold_;
+
+	// 合并中的转发包， 整批按其中最高的优先级发送
+	struct evbuffer* pBatchBuffer_;
+	uint32 batchMax_;
+	uint32 batchPackets_;
+	uint8 batchPriority_;
+
+	// 各优先级的帧， 开启后才创建
+	struct evbuffer* pSendQueues_[SEND_PRIORITY_MAX];
+	uint32 priorityQueued_;
+	uint32 priorityLowat_;
+	uint64 priorityFrames_[SEND_PRIORITY_MAX];
+
+	// 正在写入的转发包的优先级， -1表示按cmd决定
+	int8 sendPriority_;
+
+	// 分帧发送的大包写到一半时所在的队列， 写完之前不能切换
+	int8 chunkPriority_;
+
+	// 握手后创建， 发送和接收分别在协商好的位置开启
+	SessionCipher* pCipher_;
+	bool sendEncrypted_;
+	bool recvEncrypted_;
+
+	// 正在分发接收到的包， 此时close会延迟到分发结束
+	bool dispatching_;
+	bool closePending_;
+
+	// 已登记到所属循环的待写出列表
+	bool flushPending_;
+
+	// reservePacket从内存池中取的块， 提交时按引用追加到发送缓冲区
+	uint8* pReservedChunk_;
+
+	// 每次接收回调最多处理的帧数和字节数， 0为不限制； 超出后排到所属循环的接收队列
+	uint32 recvBudget_;
+	uint32 recvBudgetBytes_;
+	bool recvQueued_;
+
+	uint32 sendQueueMax_;
+	int sendQueuePolicy_;
+	bool sendQueueFull_;
+	uint32 recvPauses_;
+	uint32 sendQueuePeak_;
+	uint32 sendQueueOverflows_;
+	uint64 droppedPackets_;
+	uint64 droppedBytes_;
 
 	bool isServer_;
 	bool connected_;
@@ -173,7 +450,10 @@ protected:
 
 	int64 rtt_;
 
-	struct event * destroyTimerEvent_;
+	// 已经请求关闭， 在本轮事件循环末尾真正关闭
+	bool destroyed_;
+
+	TimerHandle livenessTimerEvent_;
 };
 
 }
@@ -0,0 +1,316 @@
+#include "SessionCipher.h"
+#include "log/XLog.h"
+#include <openssl/evp.h>
+#include <openssl/kdf.h>
+#include <event2/buffer.h>
+
+namespace XServer {
+
+static const char HKDF_INFO[] = "XServer frame keys v1";
+
+//-------------------------------------------------------------------------------------
+SessionCipher::Direction::Direction():
+pCtx(NULL),
+sequence(0)
+{
+	memset(salt, 0, sizeof(salt));
+}
+
+//-------------------------------------------------------------------------------------
+SessionCipher::SessionCipher():
+type_(CIPHER_NONE),
+pKey_(NULL),
+publicKey_(),
+send_(),
+recv_()
+{
+}
+
+//-------------------------------------------------------------------------------------
+SessionCipher::~SessionCipher()
+{
+	if (pKey_)
+	{
+		EVP_PKEY_free(pKey_);
+		pKey_ = NULL;
+	}
+
+	if (send_.pCtx)
+	{
+		EVP_CIPHER_CTX_free(send_.pCtx);
+		send_.pCtx = NULL;
+	}
+
+	if (recv_.pCtx)
+	{
+		EVP_CIPHER_CTX_free(recv_.pCtx);
+		recv_.pCtx = NULL;
+	}
+}
+
+//-------------------------------------------------------------------------------------
+const char* SessionCipher::typeName(CipherType type)
+{
+	switch (type)
+	{
+	case CIPHER_AES_128_GCM:
+		return "AES-128-GCM";
+	case CIPHER_CHACHA20_POLY1305:
+		return "ChaCha20-Poly1305";
+	default:
+		break;
+	};
+
+	return "none";
+}
+
+//-------------------------------------------------------------------------------------
+bool SessionCipher::generateKey(std::string& publicKey)
+{
+	if (!pKey_)
+	{
+		EVP_PKEY_CTX* pCtx = EVP_PKEY_CTX_new_id(NID_X25519, NULL);
+		if (!pCtx)
+			return false;
+
+		bool ret = EVP_PKEY_keygen_init(pCtx) == 1 && EVP_PKEY_keygen(pCtx, &pKey_) == 1;
+		EVP_PKEY_CTX_free(pCtx);
+
+		if (!ret)
+		{
+			ERROR_MSG(fmt::format("SessionCipher::generateKey(): X25519 keygen error!\n"));
+			return false;
+		}
+
+		unsigned char* pt = NULL;
+		size_t len = EVP_PKEY_get1_tls_encodedpoint(pKey_, &pt);
+		if (len != PUBLIC_KEY_SIZE)
+		{
+			OPENSSL_free(pt);
+			return false;
+		}
+
+		publicKey_.assign((const char*)pt, len);
+		OPENSSL_free(pt);
+	}
+
+	publicKey = publicKey_;
+	return true;
+}
+
+//-------------------------------------------------------------------------------------
+bool SessionCipher::deriveKeys(CipherType type, const std::string& peerPublicKey, bool isInitiator)
+{
+	if (!pKey_ || type == CIPHER_NONE || type > CIPHER_MAX || peerPublicKey.size() != PUBLIC_KEY_SIZE)
+		return false;
+
+	// 共享密钥
+	uint8 secret[PUBLIC_KEY_SIZE];
+	size_t secretSize = sizeof(secret);
+
+	EVP_PKEY* pPeerKey = EVP_PKEY_new();
+	if (!pPeerKey)
+		return false;
+
+	bool ret = EVP_PKEY_set_type(pPeerKey, NID_X25519) == 1 &&
+		EVP_PKEY_set1_tls_encodedpoint(pPeerKey, (const unsigned char*)peerPublicKey.data(), peerPublicKey.size()) == 1;
+
+	if (ret)
+	{
+		EVP_PKEY_CTX* pCtx = EVP_PKEY_CTX_new(pKey_, NULL);
+		ret = pCtx && EVP_PKEY_derive_init(pCtx) == 1 && EVP_PKEY_derive_set_peer(pCtx, pPeerKey) == 1 &&
+			EVP_PKEY_derive(pCtx, secret, &secretSize) == 1 && secretSize == sizeof(secret);
+
+		EVP_PKEY_CTX_free(pCtx);
+	}
+
+	EVP_PKEY_free(pPeerKey);
+
+	if (!ret)
+	{
+		ERROR_MSG(fmt::format("SessionCipher::deriveKeys(): X25519 derive error!\n"));
+		return false;
+	}
+
+	// 两端的公钥按发起方在前的顺序作为salt， 派生出: 发起方->接受方的密钥和salt | 接受方->发起方的密钥和salt
+	std::string salt = isInitiator ? publicKey_ + peerPublicKey : peerPublicKey + publicKey_;
+
+	uint8 material[(KEY_SIZE + SALT_SIZE) * 2];
+	size_t materialSize = sizeof(material);
+
+	EVP_PKEY_CTX* pCtx = EVP_PKEY_CTX_new_id(EVP_PKEY_HKDF, NULL);
+	ret = pCtx && EVP_PKEY_derive_init(pCtx) == 1 &&
+		EVP_PKEY_CTX_set_hkdf_md(pCtx, EVP_sha256()) == 1 &&
+		EVP_PKEY_CTX_set1_hkdf_salt(pCtx, (const unsigned char*)salt.data(), (int)salt.size()) == 1 &&
+		EVP_PKEY_CTX_set1_hkdf_key(pCtx, secret, (int)secretSize) == 1 &&
+		EVP_PKEY_CTX_add1_hkdf_info(pCtx, (const unsigned char*)HKDF_INFO, (int)(sizeof(HKDF_INFO) - 1)) == 1 &&
+		EVP_PKEY_derive(pCtx, material, &materialSize) == 1 && materialSize == sizeof(material);
+
+	EVP_PKEY_CTX_free(pCtx);
+	OPENSSL_cleanse(secret, sizeof(secret));
+
+	if (!ret)
+	{
+		ERROR_MSG(fmt::format("SessionCipher::deriveKeys(): HKDF error!\n"));
+		return false;
+	}
+
+	type_ = type;
+
+	const uint8* outbound = material;
+	const uint8* inbound = material + KEY_SIZE + SALT_SIZE;
+	if (!isInitiator)
+		std::swap(outbound, inbound);
+
+	ret = initDirection(send_, true, outbound, outbound + KEY_SIZE) &&
+		initDirection(recv_, false, inbound, inbound + KEY_SIZE);
+
+	OPENSSL_cleanse(material, sizeof(material));
+
+	// 临时私钥用完即丢弃
+	EVP_PKEY_free(pKey_);
+	pKey_ = NULL;
+
+	return ret;
+}
+
+//-------------------------------------------------------------------------------------
+bool SessionCipher::initDirection(Direction& direction, bool encrypt, const uint8* key, const uint8* salt)
+{
+	const EVP_CIPHER* pCipher = (type_ == CIPHER_AES_128_GCM) ? EVP_aes_128_gcm() : EVP_chacha20_poly1305();
+
+	if (!direction.pCtx)
+		direction.pCtx = EVP_CIPHER_CTX_new();
+
+	if (!direction.pCtx)
+		return false;
+
+	// 密钥只设置一次， 之后每帧只更换nonce， AES-GCM的密钥扩展不会重复计算
+	if (EVP_CipherInit_ex(direction.pCtx, pCipher, NULL, NULL, NULL, encrypt ? 1 : 0) != 1 ||
+		EVP_CIPHER_CTX_ctrl(direction.pCtx, EVP_CTRL_AEAD_SET_IVLEN, NONCE_SIZE, NULL) != 1 ||
+		EVP_CipherInit_ex(direction.pCtx, NULL, NULL, key, NULL, encrypt ? 1 : 0) != 1)
+	{
+		ERROR_MSG(fmt::format("SessionCipher::initDirection(): {} init error!\n", typeName(type_)));
+		return false;
+	}
+
+	memcpy(direction.salt, salt, SALT_SIZE);
+	direction.sequence = 0;
+	return true;
+}
+
+//-------------------------------------------------------------------------------------
+bool SessionCipher::begin(Direction& direction, bool encrypt, const uint8* header, uint32 headerSize)
+{
+	if (!direction.pCtx)
+		return false;
+
+	uint8 nonce[NONCE_SIZE];
+	memcpy(nonce, direction.salt, SALT_SIZE);
+
+	uint64 sequence = direction.sequence++;
+	for (int i = NONCE_SIZE - 1; i >= SALT_SIZE; --i)
+	{
+		nonce[i] = (uint8)(sequence & 0xff);
+		sequence >>= 8;
+	}
+
+	int len = 0;
+	return EVP_CipherInit_ex(direction.pCtx, NULL, NULL, NULL, nonce, encrypt ? 1 : 0) == 1 &&
+		EVP_CipherUpdate(direction.pCtx, NULL, &len, header, (int)headerSize) == 1;
+}
+
+//-------------------------------------------------------------------------------------
+bool SessionCipher::update(Direction& direction, bool encrypt, uint8* data, uint32 size)
+{
+	// AEAD都是流模式， 输出长度等于输入长度， 可以原地处理
+	int len = 0;
+	return size == 0 || (EVP_CipherUpdate(direction.pCtx, data, &len, data, (int)size) == 1 && len == (int)size);
+}
+
+//-------------------------------------------------------------------------------------
+bool SessionCipher::sealEnd(uint8* tag)
+{
+	int len = 0;
+	return EVP_CipherFinal_ex(send_.pCtx, tag, &len) == 1 &&
+		EVP_CIPHER_CTX_ctrl(send_.pCtx, EVP_CTRL_AEAD_GET_TAG, TAG_SIZE, tag) == 1;
+}
+
+//-------------------------------------------------------------------------------------
+bool SessionCipher::openEnd(const uint8* tag)
+{
+	uint8 buffer[TAG_SIZE];
+	memcpy(buffer, tag, TAG_SIZE);
+
+	int len = 0;
+	return EVP_CIPHER_CTX_ctrl(recv_.pCtx, EVP_CTRL_AEAD_SET_TAG, TAG_SIZE, buffer) == 1 &&
+		EVP_CipherFinal_ex(recv_.pCtx, buffer, &len) == 1;
+}
+
+//-------------------------------------------------------------------------------------
+bool SessionCipher::seal(const uint8* header, uint32 headerSize, uint8* data, uint32 size, uint8* tag)
+{
+	return begin(send_, true, header, headerSize) && update(send_, true, data, size) && sealEnd(tag);
+}
+
+//-------------------------------------------------------------------------------------
+bool SessionCipher::open(const uint8* header, uint32 headerSize, uint8* data, uint32 size, const uint8* tag)
+{
+	return begin(recv_, false, header, headerSize) && update(recv_, false, data, size) && openEnd(tag);
+}
+
+//-------------------------------------------------------------------------------------
+bool SessionCipher::process(Direction& direction, bool encrypt, const uint8* header, uint32 headerSize,
+	struct evbuffer* pBuffer, uint32 offset, uint32 size)
+{
+	if (!begin(direction, encrypt, header, headerSize))
+		return false;
+
+	if (size == 0)
+		return true;
+
+	struct evbuffer_ptr ptr;
+	if (evbuffer_ptr_set(pBuffer, &ptr, offset, EVBUFFER_PTR_SET) != 0)
+		return false;
+
+	// 一帧最多跨越少量内存块， 先用栈上的数组， 不够时再分配
+	struct evbuffer_iovec vecs[8];
+	struct evbuffer_iovec* pVecs = vecs;
+
+	int n = evbuffer_peek(pBuffer, size, &ptr, vecs, 8);
+	if (n > 8)
+	{
+		pVecs = new struct evbuffer_iovec[n];
+		evbuffer_peek(pBuffer, size, &ptr, pVecs, n);
+	}
+
+	bool ret = n > 0;
+	uint32 remain = size;
+
+	for (int i = 0; ret && i < n && remain > 0; ++i)
+	{
+		uint32 len = std::min<uint32>((uint32)pVecs[i].iov_len, remain);
+		ret = update(direction, encrypt, (uint8*)pVecs[i].iov_base, len);
+		remain -= len;
+	}
+
+	if (pVecs != vecs)
+		delete[] pVecs;
+
+	return ret && remain == 0;
+}
+
+//-------------------------------------------------------------------------------------
+bool SessionCipher::seal(const uint8* header, uint32 headerSize, struct evbuffer* pBuffer, uint32 offset, uint32 size, uint8* tag)
+{
+	return process(send_, true, header, headerSize, pBuffer, offset, size) && sealEnd(tag);
+}
+
+//-------------------------------------------------------------------------------------
+bool SessionCipher::open(const uint8* header, uint32 headerSize, struct evbuffer* pBuffer, uint32 offset, uint32 size, const uint8* tag)
+{
+	return process(recv_, false, header, headerSize, pBuffer, offset, size) && openEnd(tag);
+}
+
+//-------------------------------------------------------------------------------------
+}
@@ -0,0 +1,86 @@
+#ifndef X_SESSION_CIPHER_H
+#define X_SESSION_CIPHER_H
+
+#include "event/common.h"
+
+struct evp_cipher_ctx_st;
+struct evp_pkey_st;
+struct evbuffer;
+
+namespace XServer {
+
+/*
+	链路加密， 握手时在Hello/HelloCB中交换X25519临时公钥， 用HKDF-SHA256从共享密钥派生两个方向的密钥
+	每一帧: 包头(明文， 作为附加认证数据) | 密文 | tag(16)， 包头中的长度包含tag
+	nonce = 派生出的4字节salt | 8字节帧序号， 不在线上传输， 丢帧或乱序都会认证失败
+	加解密都在原来的内存上进行， evbuffer中的数据逐块处理， 不额外拷贝
+*/
+class SessionCipher
+{
+public:
+	enum
+	{
+		TAG_SIZE = 16,
+		NONCE_SIZE = 12,
+		SALT_SIZE = 4,
+		KEY_SIZE = 32,
+		PUBLIC_KEY_SIZE = 32,
+	};
+
+	SessionCipher();
+	~SessionCipher();
+
+	CipherType type() const {
+		return type_;
+	}
+
+	// 生成本端的临时密钥， 公钥放入Hello/HelloCB
+	bool generateKey(std::string& publicKey);
+
+	// 用对端公钥派生密钥， 发起连接的一方用第一组密钥发送， 另一方用它接收
+	bool deriveKeys(CipherType type, const std::string& peerPublicKey, bool isInitiator);
+
+	// 连续的一块内存， tag写在data + size处
+	bool seal(const uint8* header, uint32 headerSize, uint8* data, uint32 size, uint8* tag);
+	bool open(const uint8* header, uint32 headerSize, uint8* data, uint32 size, const uint8* tag);
+
+	// 从buffer的offset处开始的size字节， 可以跨越多个内存块
+	bool seal(const uint8* header, uint32 headerSize, struct evbuffer* pBuffer, uint32 offset, uint32 size, uint8* tag);
+	bool open(const uint8* header, uint32 headerSize, struct evbuffer* pBuffer, uint32 offset, uint32 size, const uint8* tag);
+
+	static const char* typeName(CipherType type);
+
+private:
+	struct Direction
+	{
+		Direction();
+
+		struct evp_cipher_ctx_st* pCtx;
+		uint8 salt[SALT_SIZE];
+		uint64 sequence;
+	};
+
+	bool initDirection(Direction& direction, bool encrypt, const uint8* key, const uint8* salt);
+
+	// 每一帧开始时设置nonce和附加认证数据
+	bool begin(Direction& direction, bool encrypt, const uint8* header, uint32 headerSize);
+	bool update(Direction& direction, bool encrypt, uint8* data, uint32 size);
+	bool sealEnd(uint8* tag);
+	bool openEnd(const uint8* tag);
+
+	bool process(Direction& direction, bool encrypt, const uint8* header, uint32 headerSize,
+		struct evbuffer* pBuffer, uint32 offset, uint32 size);
+
+private:
+	CipherType type_;
+
+	struct evp_pkey_st* pKey_;
+	std::string publicKey_;
+
+	Direction send_;
+	Direction recv_;
+};
+
+}
+
+#endif // X_SESSION_CIPHER_H
@@ -0,0 +1,195 @@
+#include "SessionPool.h"
+#include "Session.h"
+#include "log/XLog.h"
+
+namespace XServer {
+
+// 每个进程的代数从一个随机值开始， 不同进程产生的SessionID基本不会重复
+static uint32 initialGeneration()
+{
+	static uint32 generation = 0;
+	static std::once_flag flag;
+
+	std::call_once(flag, []() {
+		std::random_device r_device;
+		generation = (uint32)r_device() | 1;
+	});
+
+	return generation;
+}
+
+//-------------------------------------------------------------------------------------
+SessionSlab::SessionSlab():
+slots_(),
+freeSlots_(),
+prefix_(0),
+count_(0)
+{
+}
+
+//-------------------------------------------------------------------------------------
+SessionSlab::~SessionSlab()
+{
+}
+
+//-------------------------------------------------------------------------------------
+void SessionSlab::prefix(bool isInternalNetwork, int loopIndex)
+{
+	prefix_ = ((isInternalNetwork ? 0 : 1) << LOOP_BITS) | ((uint32)loopIndex & (MAX_LOOPS - 1));
+}
+
+//-------------------------------------------------------------------------------------
+SessionID SessionSlab::reserve()
+{
+	uint32 index = 0;
+
+	if (freeSlots_.empty())
+	{
+		if (slots_.size() >= MAX_SLOTS)
+		{
+			ERROR_MSG(fmt::format("SessionSlab::reserve(): too many sessions! max={}\n", (uint32)MAX_SLOTS));
+			return SESSION_ID_INVALID;
+		}
+
+		index = (uint32)slots_.size();
+
+		Slot slot;
+		slot.pSession = NULL;
+		slot.generation = initialGeneration();
+		slot.inUse = false;
+		slots_.push_back(slot);
+	}
+	else
+	{
+		index = freeSlots_.back();
+		freeSlots_.pop_back();
+	}
+
+	Slot& slot = slots_[index];
+	slot.pSession = NULL;
+	slot.inUse = true;
+	++count_;
+
+	return ((SessionID)slot.generation << 32) | (SessionID)((prefix_ << SLOT_BITS) | index);
+}
+
+//-------------------------------------------------------------------------------------
+bool SessionSlab::attach(SessionID id, Session* pSession)
+{
+	uint32 index = (uint32)(id & (MAX_SLOTS - 1));
+	if (index >= slots_.size())
+		return false;
+
+	Slot& slot = slots_[index];
+	if (!slot.inUse || slot.generation != (uint32)(id >> 32))
+		return false;
+
+	slot.pSession = pSession;
+	return true;
+}
+
+//-------------------------------------------------------------------------------------
+Session* SessionSlab::release(SessionID id)
+{
+	uint32 index = (uint32)(id & (MAX_SLOTS - 1));
+	if (index >= slots_.size())
+		return NULL;
+
+	Slot& slot = slots_[index];
+	if (!slot.inUse || slot.generation != (uint32)(id >> 32))
+		return NULL;
+
+	Session* pSession = slot.pSession;
+
+	slot.pSession = NULL;
+	slot.inUse = false;
+
+	// 代数为0时SessionID可能等于SESSION_ID_INVALID
+	if (++slot.generation == 0)
+		slot.generation = 1;
+
+	freeSlots_.push_back(index);
+	--count_;
+
+	return pSession;
+}
+
+//-------------------------------------------------------------------------------------
+void SessionSlab::clear()
+{
+	for (auto& slot : slots_)
+	{
+		if (slot.inUse && slot.pSession)
+			delete slot.pSession;
+	}
+
+	slots_.clear();
+	freeSlots_.clear();
+	count_ = 0;
+}
+
+//-------------------------------------------------------------------------------------
+namespace {
+
+	const size_t ALLOC_ALIGN = 64;
+	const size_t ALLOC_CLASSES = 64;
+	const size_t ALLOC_CHUNK_OBJECTS = 32;
+
+	struct FreeLists
+	{
+		std::vector<void*> lists[ALLOC_CLASSES + 1];
+	};
+
+	FreeLists& freeLists()
+	{
+		static thread_local FreeLists lists;
+		return lists;
+	}
+
+}
+
+//-------------------------------------------------------------------------------------
+void* SessionAllocator::allocate(size_t size)
+{
+	size_t sizeClass = (size + ALLOC_ALIGN - 1) / ALLOC_ALIGN;
+	if (sizeClass == 0 || sizeClass > ALLOC_CLASSES)
+		return ::operator new(size);
+
+	std::vector<void*>& list = freeLists().lists[sizeClass];
+
+	// 一次分配一整块， 切成同样大小的对象
+	if (list.empty())
+	{
+		size_t objectSize = sizeClass * ALLOC_ALIGN;
+		uint8* chunk = (uint8*)::operator new(objectSize * ALLOC_CHUNK_OBJECTS + ALLOC_ALIGN);
+		uint8* aligned = (uint8*)(((uintptr_t)chunk + ALLOC_ALIGN - 1) & ~(uintptr_t)(ALLOC_ALIGN - 1));
+
+		list.reserve(list.size() + ALLOC_CHUNK_OBJECTS);
+		for (size_t i = ALLOC_CHUNK_OBJECTS; i > 0; --i)
+			list.push_back(aligned + (i - 1) * objectSize);
+	}
+
+	void* p = list.back();
+	list.pop_back();
+	return p;
+}
+
+//-------------------------------------------------------------------------------------
+void SessionAllocator::deallocate(void* p, size_t size)
+{
+	if (!p)
+		return;
+
+	size_t sizeClass = (size + ALLOC_ALIGN - 1) / ALLOC_ALIGN;
+	if (sizeClass == 0 || sizeClass > ALLOC_CLASSES)
+	{
+		::operator delete(p);
+		return;
+	}
+
+	// 可能在别的线程释放(例如finalise时)， 放入当前线程的空闲链表即可
+	freeLists().lists[sizeClass].push_back(p);
+}
+
+//-------------------------------------------------------------------------------------
+}
@@ -0,0 +1,100 @@
+#ifndef X_SESSION_POOL_H
+#define X_SESSION_POOL_H
+
+#include "common/common.h"
+
+namespace XServer {
+
+class Session;
+
+/*
+	session句柄表， 每个事件循环一张
+	SessionID高32位为槽的代数， 低32位为: 外部网络标记(1位) | 循环索引(7位) | 槽索引(24位)
+	槽释放时代数加一， 旧的SessionID再也找不到session， 查找是O(1)的数组访问
+*/
+class SessionSlab
+{
+public:
+	enum
+	{
+		SLOT_BITS = 24,
+		LOOP_BITS = 7,
+		MAX_SLOTS = 1 << SLOT_BITS,
+		MAX_LOOPS = 1 << LOOP_BITS,
+	};
+
+	struct Slot
+	{
+		Session* pSession;
+		uint32 generation;
+		bool inUse;
+	};
+
+public:
+	SessionSlab();
+	~SessionSlab();
+
+	void prefix(bool isInternalNetwork, int loopIndex);
+
+	static int loopIndex(SessionID id) {
+		return (int)((id >> SLOT_BITS) & (MAX_LOOPS - 1));
+	}
+
+	// 预留一个槽并返回SessionID， 槽满时返回SESSION_ID_INVALID
+	SessionID reserve();
+	bool attach(SessionID id, Session* pSession);
+
+	// 释放槽， 返回槽中的session(由调用者删除)
+	Session* release(SessionID id);
+
+	Session* find(SessionID id) const
+	{
+		uint32 index = (uint32)(id & (MAX_SLOTS - 1));
+		if (index >= slots_.size())
+			return NULL;
+
+		const Slot& slot = slots_[index];
+		if (!slot.inUse || slot.generation != (uint32)(id >> 32) || (uint32)(id & 0xffffffff) >> SLOT_BITS != prefix_)
+			return NULL;
+
+		return slot.pSession;
+	}
+
+	size_t size() const {
+		return count_;
+	}
+
+	template<typename F>
+	void forEach(F f)
+	{
+		for (auto& slot : slots_)
+		{
+			if (slot.inUse && slot.pSession)
+				f(slot.pSession);
+		}
+	}
+
+	// 删除所有session并清空
+	void clear();
+
+private:
+	std::vector<Slot> slots_;
+	std::vector<uint32> freeSlots_;
+	uint32 prefix_;
+	size_t count_;
+};
+
+/*
+	Session和TcpSocket的内存池， 按64字节对齐的大小分级， 每个线程一组空闲链表
+	内存块只会在池中复用， 不会归还给系统
+*/
+class SessionAllocator
+{
+public:
+	static void* allocate(size_t size);
+	static void deallocate(void* p, size_t size);
+};
+
+}
+
+#endif // X_SESSION_POOL_H
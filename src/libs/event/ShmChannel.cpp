@@ -0,0 +1,859 @@
+#include "ShmChannel.h"
+#include "EventDispatcher.h"
+#include "log/XLog.h"
+
+#ifdef __linux__
+#include <sys/eventfd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <poll.h>
+#endif
+
+namespace XServer {
+
+// 两个进程通过同一块内存上的原子变量同步， 必须是无锁的
+static_assert(ATOMIC_LLONG_LOCK_FREE == 2 && ATOMIC_INT_LOCK_FREE == 2, "ShmChannel needs lock-free atomics");
+
+// 生产者只写head， 消费者只写tail， 分开在不同的缓存行
+struct ShmChannel::Ring
+{
+	alignas(64) std::atomic<uint64> head;
+	alignas(64) std::atomic<uint64> tail;
+
+	// 消费者读空后置1， 生产者写入后发现为1才唤醒
+	alignas(64) std::atomic<uint32> readerWaiting;
+
+	// 生产者写满后置1， 消费者取走后发现为1才唤醒
+	std::atomic<uint32> writerWaiting;
+};
+
+namespace {
+
+	const uint32 SHM_MAGIC = 0x58534d43;
+	const uint32 SHM_VERSION = 1;
+	const uint32 SHM_HEADER_SIZE = 4096;
+	const uint32 SHM_RING_MIN = 4096;
+	const uint32 SHM_RING_MAX = 1U << 30;
+
+	struct ShmHeader
+	{
+		uint32 magic;
+		uint32 version;
+		uint32 ringSize;
+		uint32 reserved;
+	};
+
+	std::atomic<uint32> g_channelSeq(0);
+
+}
+
+//-------------------------------------------------------------------------------------
+ShmChannel::ShmChannel():
+name_(),
+pMapping_(NULL),
+mappingSize_(0),
+ringSize_(0),
+owner_(false),
+unlinked_(false),
+pTx_(NULL),
+pTxData_(NULL),
+pRx_(NULL),
+pRxData_(NULL),
+wakeupFd_(-1),
+notifyFd_(-1),
+listenFd_(-1),
+attachFd_(-1),
+pListenEvent_(NULL),
+pAttachEvent_(NULL),
+pWakeupEvent_(NULL),
+wakeupCallback_(),
+attachCallback_(),
+notifications_(0)
+{
+}
+
+//-------------------------------------------------------------------------------------
+ShmChannel::~ShmChannel()
+{
+	close();
+}
+
+//-------------------------------------------------------------------------------------
+const std::string& ShmChannel::hostID()
+{
+	static std::string id;
+
+#ifdef __linux__
+	static std::once_flag flag;
+	std::call_once(flag, []() {
+		char hostname[256] = { 0 };
+		gethostname(hostname, sizeof(hostname) - 1);
+
+		// 容器之间boot_id相同但主机名不同， /dev/shm也不同
+		std::string bootID;
+		std::ifstream file("/proc/sys/kernel/random/boot_id");
+		std::getline(file, bootID);
+
+		if (bootID.size() > 0)
+			id = fmt::format("{}/{}", hostname, bootID);
+	});
+#endif
+
+	return id;
+}
+
+//-------------------------------------------------------------------------------------
+std::string ShmChannel::path() const
+{
+	// 直接使用/dev/shm， 不需要链接librt
+	return fmt::format("/dev/shm/{}", name_);
+}
+
+//-------------------------------------------------------------------------------------
+bool ShmChannel::create(uint32 ringSize)
+{
+#ifdef __linux__
+	close();
+
+	// 下标直接用掩码取模
+	ringSize_ = SHM_RING_MIN;
+	while (ringSize_ < ringSize && ringSize_ < SHM_RING_MAX)
+		ringSize_ <<= 1;
+
+	name_ = fmt::format("xserver-{}-{}", getpid(), ++g_channelSeq);
+	owner_ = true;
+
+	int fd = ::open(path().c_str(), O_RDWR | O_CREAT | O_EXCL | O_CLOEXEC, 0600);
+	if (fd < 0)
+	{
+		ERROR_MSG(fmt::format("ShmChannel::create(): open {} error: {}\n", path(), strerror(errno)));
+		unlinked_ = true;
+		close();
+		return false;
+	}
+
+	size_t size = SHM_HEADER_SIZE + (size_t)ringSize_ * 2;
+	bool ret = ftruncate(fd, size) == 0 && map(fd, size, true);
+	::close(fd);
+
+	if (ret)
+	{
+		wakeupFd_ = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+		notifyFd_ = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+	}
+
+	if (!isGood())
+	{
+		ERROR_MSG(fmt::format("ShmChannel::create(): {} error: {}\n", name_, strerror(errno)));
+		close();
+		return false;
+	}
+
+	setupRings();
+	return true;
+#else
+	return false;
+#endif
+}
+
+//-------------------------------------------------------------------------------------
+bool ShmChannel::map(int fd, size_t size, bool init)
+{
+#ifdef __linux__
+	void* p = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+	if (p == MAP_FAILED)
+		return false;
+
+	pMapping_ = (uint8*)p;
+	mappingSize_ = size;
+
+	ShmHeader* pHeader = (ShmHeader*)pMapping_;
+	Ring* pRings = (Ring*)(pMapping_ + 64);
+
+	if (init)
+	{
+		pHeader->magic = SHM_MAGIC;
+		pHeader->version = SHM_VERSION;
+		pHeader->ringSize = ringSize_;
+
+		for (int i = 0; i < 2; ++i)
+		{
+			Ring* pRing = new (&pRings[i]) Ring();
+			pRing->head.store(0);
+			pRing->tail.store(0);
+			pRing->readerWaiting.store(1);
+			pRing->writerWaiting.store(0);
+		}
+
+		return true;
+	}
+
+	if (pHeader->magic != SHM_MAGIC || pHeader->version != SHM_VERSION ||
+		size != SHM_HEADER_SIZE + (size_t)pHeader->ringSize * 2)
+	{
+		return false;
+	}
+
+	ringSize_ = pHeader->ringSize;
+	return true;
+#else
+	return false;
+#endif
+}
+
+//-------------------------------------------------------------------------------------
+void ShmChannel::setupRings()
+{
+	// 第一个缓存行是ShmHeader， 之后是两个环的控制块， 数据从第一页之后开始
+	static_assert(64 + sizeof(Ring) * 2 <= SHM_HEADER_SIZE, "ShmChannel header overflow");
+
+	Ring* pRings = (Ring*)(pMapping_ + 64);
+	uint8* pData = pMapping_ + SHM_HEADER_SIZE;
+
+	int tx = owner_ ? 0 : 1;
+
+	pTx_ = &pRings[tx];
+	pTxData_ = pData + (size_t)ringSize_ * tx;
+	pRx_ = &pRings[1 - tx];
+	pRxData_ = pData + (size_t)ringSize_ * (1 - tx);
+}
+
+//-------------------------------------------------------------------------------------
+bool ShmChannel::listen(EventDispatcher* pEventDispatcher)
+{
+#ifdef __linux__
+	if (!isGood() || !owner_)
+		return false;
+
+	listenFd_ = ::socket(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+	if (listenFd_ < 0)
+		return false;
+
+	// 抽象命名空间， 进程退出后自动消失
+	struct sockaddr_un addr;
+	memset(&addr, 0, sizeof(addr));
+	addr.sun_family = AF_UNIX;
+	memcpy(addr.sun_path + 1, name_.data(), std::min(name_.size(), sizeof(addr.sun_path) - 1));
+	socklen_t len = (socklen_t)(offsetof(struct sockaddr_un, sun_path) + 1 + name_.size());
+
+	if (::bind(listenFd_, (struct sockaddr*)&addr, len) != 0 || ::listen(listenFd_, 1) != 0)
+	{
+		ERROR_MSG(fmt::format("ShmChannel::listen(): {} error: {}\n", name_, strerror(errno)));
+		return false;
+	}
+
+	pListenEvent_ = event_new(pEventDispatcher->base(), listenFd_, EV_READ | EV_PERSIST, acceptCallback, this);
+	if (!pListenEvent_)
+		return false;
+
+	// 共享内存只在服务器之间使用
+	pEventDispatcher->setPriority(pListenEvent_, EVENT_PRIORITY_INTERNAL);
+	return event_add(pListenEvent_, NULL) == 0;
+#else
+	return false;
+#endif
+}
+
+//-------------------------------------------------------------------------------------
+void ShmChannel::acceptCallback(evutil_socket_t fd, short events, void* arg)
+{
+	((ShmChannel*)arg)->onAccept();
+}
+
+//-------------------------------------------------------------------------------------
+void ShmChannel::onAccept()
+{
+#ifdef __linux__
+	int sock = ::accept4(listenFd_, NULL, NULL, SOCK_CLOEXEC);
+	if (sock < 0)
+		return;
+
+	// 只交给同一用户的进程
+	struct ucred cred;
+	socklen_t credLen = sizeof(cred);
+	if (getsockopt(sock, SOL_SOCKET, SO_PEERCRED, &cred, &credLen) != 0 || cred.uid != getuid())
+	{
+		WARNING_MSG(fmt::format("ShmChannel::onAccept(): {} rejected peer pid={}, uid={}\n", name_, cred.pid, cred.uid));
+		::close(sock);
+		return;
+	}
+
+	// 对端的唤醒fd在前
+	int fds[2] = { notifyFd_, wakeupFd_ };
+
+	char byte = 0;
+	struct iovec iov;
+	iov.iov_base = &byte;
+	iov.iov_len = 1;
+
+	char control[CMSG_SPACE(sizeof(fds))];
+	memset(control, 0, sizeof(control));
+
+	struct msghdr msg;
+	memset(&msg, 0, sizeof(msg));
+	msg.msg_iov = &iov;
+	msg.msg_iovlen = 1;
+	msg.msg_control = control;
+	msg.msg_controllen = sizeof(control);
+
+	struct cmsghdr* pCmsg = CMSG_FIRSTHDR(&msg);
+	pCmsg->cmsg_level = SOL_SOCKET;
+	pCmsg->cmsg_type = SCM_RIGHTS;
+	pCmsg->cmsg_len = CMSG_LEN(sizeof(fds));
+	memcpy(CMSG_DATA(pCmsg), fds, sizeof(fds));
+
+	if (sendmsg(sock, &msg, MSG_NOSIGNAL) != 1)
+		ERROR_MSG(fmt::format("ShmChannel::onAccept(): {} sendmsg error: {}\n", name_, strerror(errno)));
+
+	::close(sock);
+
+	// 只接受一次， 对端在连接之前已经映射好， 可以删除文件
+	event_free(pListenEvent_);
+	pListenEvent_ = NULL;
+	::close(listenFd_);
+	listenFd_ = -1;
+
+	if (!unlinked_)
+	{
+		::unlink(path().c_str());
+		unlinked_ = true;
+	}
+#endif
+}
+
+//-------------------------------------------------------------------------------------
+bool ShmChannel::attach(EventDispatcher* pEventDispatcher, const std::string& name, uint32 timeoutMS, const AttachCallback& callback)
+{
+#ifdef __linux__
+	close();
+
+	name_ = name;
+	owner_ = false;
+	unlinked_ = true;
+
+	if (name_.size() == 0 || name_.find('/') != std::string::npos || !mapPeer())
+	{
+		close();
+		return false;
+	}
+
+	attachFd_ = ::socket(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+	if (attachFd_ < 0)
+	{
+		close();
+		return false;
+	}
+
+	struct sockaddr_un addr;
+	memset(&addr, 0, sizeof(addr));
+	addr.sun_family = AF_UNIX;
+	memcpy(addr.sun_path + 1, name_.data(), std::min(name_.size(), sizeof(addr.sun_path) - 1));
+	socklen_t len = (socklen_t)(offsetof(struct sockaddr_un, sun_path) + 1 + name_.size());
+
+	// unix socket的connect不需要等待握手， 对端的accept队列满时直接失败
+	if (::connect(attachFd_, (struct sockaddr*)&addr, len) != 0)
+	{
+		ERROR_MSG(fmt::format("ShmChannel::attach(): {} connect error: {}\n", name_, strerror(errno)));
+		close();
+		return false;
+	}
+
+	// 对端在自己的循环中accept后发来eventfd， 在这里的读回调中完成
+	pAttachEvent_ = event_new(pEventDispatcher->base(), attachFd_, EV_READ, attachCallback, this);
+	if (!pAttachEvent_)
+	{
+		close();
+		return false;
+	}
+
+	pEventDispatcher->setPriority(pAttachEvent_, EVENT_PRIORITY_INTERNAL);
+
+	struct timeval tv;
+	tv.tv_sec = timeoutMS / 1000;
+	tv.tv_usec = (timeoutMS % 1000) * 1000;
+
+	if (event_add(pAttachEvent_, &tv) != 0)
+	{
+		close();
+		return false;
+	}
+
+	attachCallback_ = callback;
+	return true;
+#else
+	return false;
+#endif
+}
+
+//-------------------------------------------------------------------------------------
+bool ShmChannel::mapPeer()
+{
+#ifdef __linux__
+	int fd = ::open(path().c_str(), O_RDWR | O_CLOEXEC);
+	if (fd < 0)
+	{
+		ERROR_MSG(fmt::format("ShmChannel::attach(): open {} error: {}\n", path(), strerror(errno)));
+		return false;
+	}
+
+	struct stat st;
+	bool ret = fstat(fd, &st) == 0 && map(fd, (size_t)st.st_size, false);
+	::close(fd);
+
+	if (!ret)
+		ERROR_MSG(fmt::format("ShmChannel::attach(): {} is not a valid channel!\n", name_));
+
+	return ret;
+#else
+	return false;
+#endif
+}
+
+//-------------------------------------------------------------------------------------
+bool ShmChannel::receiveFds(int sock)
+{
+#ifdef __linux__
+	int fds[2] = { -1, -1 };
+
+	char byte = 0;
+	struct iovec iov;
+	iov.iov_base = &byte;
+	iov.iov_len = 1;
+
+	char control[CMSG_SPACE(sizeof(fds))];
+	memset(control, 0, sizeof(control));
+
+	struct msghdr msg;
+	memset(&msg, 0, sizeof(msg));
+	msg.msg_iov = &iov;
+	msg.msg_iovlen = 1;
+	msg.msg_control = control;
+	msg.msg_controllen = sizeof(control);
+
+	if (recvmsg(sock, &msg, MSG_CMSG_CLOEXEC | MSG_DONTWAIT) == 1)
+	{
+		struct cmsghdr* pCmsg = CMSG_FIRSTHDR(&msg);
+		if (pCmsg && pCmsg->cmsg_level == SOL_SOCKET && pCmsg->cmsg_type == SCM_RIGHTS &&
+			pCmsg->cmsg_len == CMSG_LEN(sizeof(fds)))
+		{
+			memcpy(fds, CMSG_DATA(pCmsg), sizeof(fds));
+		}
+	}
+
+	wakeupFd_ = fds[0];
+	notifyFd_ = fds[1];
+	return isGood();
+#else
+	return false;
+#endif
+}
+
+//-------------------------------------------------------------------------------------
+void ShmChannel::attachCallback(evutil_socket_t fd, short events, void* arg)
+{
+	((ShmChannel*)arg)->onAttach(events);
+}
+
+//-------------------------------------------------------------------------------------
+void ShmChannel::onAttach(short events)
+{
+#ifdef __linux__
+	bool ok = (events & EV_READ) && receiveFds(attachFd_);
+
+	if (!ok)
+	{
+		if (events & EV_TIMEOUT)
+			ERROR_MSG(fmt::format("ShmChannel::onAttach(): {} timed out waiting for eventfd!\n", name_));
+		else
+			ERROR_MSG(fmt::format("ShmChannel::onAttach(): {} peer closed without passing eventfd!\n", name_));
+	}
+
+	// 回调中可能删除自己， 之后不能再访问成员
+	AttachCallback callback;
+	callback.swap(attachCallback_);
+
+	event_free(pAttachEvent_);
+	pAttachEvent_ = NULL;
+	::close(attachFd_);
+	attachFd_ = -1;
+
+	if (ok)
+		setupRings();
+	else
+		close();
+
+	if (callback)
+		callback(ok);
+#endif
+}
+
+//-------------------------------------------------------------------------------------
+bool ShmChannel::attach(const ShmChannel& owner)
+{
+#ifdef __linux__
+	close();
+
+	if (!owner.isGood() || !owner.owner_ || owner.unlinked_)
+		return false;
+
+	name_ = owner.name_;
+	owner_ = false;
+	unlinked_ = true;
+
+	int fd = ::open(path().c_str(), O_RDWR | O_CLOEXEC);
+	if (fd < 0)
+		return false;
+
+	bool ret = map(fd, owner.mappingSize_, false);
+	::close(fd);
+
+	if (ret)
+	{
+		wakeupFd_ = dup(owner.notifyFd_);
+		notifyFd_ = dup(owner.wakeupFd_);
+	}
+
+	if (!isGood())
+	{
+		close();
+		return false;
+	}
+
+	setupRings();
+	return true;
+#else
+	return false;
+#endif
+}
+
+//-------------------------------------------------------------------------------------
+void ShmChannel::close()
+{
+#ifdef __linux__
+	if (pListenEvent_)
+	{
+		event_free(pListenEvent_);
+		pListenEvent_ = NULL;
+	}
+
+	if (pWakeupEvent_)
+	{
+		event_free(pWakeupEvent_);
+		pWakeupEvent_ = NULL;
+	}
+
+	if (pAttachEvent_)
+	{
+		event_free(pAttachEvent_);
+		pAttachEvent_ = NULL;
+	}
+
+	if (listenFd_ >= 0)
+	{
+		::close(listenFd_);
+		listenFd_ = -1;
+	}
+
+	if (attachFd_ >= 0)
+	{
+		::close(attachFd_);
+		attachFd_ = -1;
+	}
+
+	if (wakeupFd_ >= 0)
+	{
+		::close(wakeupFd_);
+		wakeupFd_ = -1;
+	}
+
+	if (notifyFd_ >= 0)
+	{
+		::close(notifyFd_);
+		notifyFd_ = -1;
+	}
+
+	if (pMapping_)
+	{
+		munmap(pMapping_, mappingSize_);
+		pMapping_ = NULL;
+		mappingSize_ = 0;
+	}
+
+	if (owner_ && !unlinked_ && name_.size() > 0)
+		::unlink(path().c_str());
+#endif
+
+	unlinked_ = false;
+	owner_ = false;
+	pTx_ = pRx_ = NULL;
+	pTxData_ = pRxData_ = NULL;
+	wakeupCallback_ = nullptr;
+	attachCallback_ = nullptr;
+}
+
+//-------------------------------------------------------------------------------------
+bool ShmChannel::watch(EventDispatcher* pEventDispatcher, const WakeupCallback& callback)
+{
+	if (!isGood() || pWakeupEvent_)
+		return false;
+
+	wakeupCallback_ = callback;
+	pWakeupEvent_ = event_new(pEventDispatcher->base(), wakeupFd_, EV_READ | EV_PERSIST, wakeupCallback, this);
+	if (!pWakeupEvent_)
+		return false;
+
+	pEventDispatcher->setPriority(pWakeupEvent_, EVENT_PRIORITY_INTERNAL);
+	return event_add(pWakeupEvent_, NULL) == 0;
+}
+
+//-------------------------------------------------------------------------------------
+void ShmChannel::wakeup()
+{
+	if (pWakeupEvent_)
+		event_active(pWakeupEvent_, EV_READ, 0);
+}
+
+//-------------------------------------------------------------------------------------
+void ShmChannel::clearWakeup()
+{
+	uint64 value;
+	if (wakeupFd_ >= 0 && ::read(wakeupFd_, &value, sizeof(value)) < 0)
+		return;
+}
+
+//-------------------------------------------------------------------------------------
+void ShmChannel::wakeupCallback(evutil_socket_t fd, short events, void* arg)
+{
+	((ShmChannel*)arg)->onWakeup();
+}
+
+//-------------------------------------------------------------------------------------
+void ShmChannel::onWakeup()
+{
+	clearWakeup();
+
+	if (wakeupCallback_)
+		wakeupCallback_();
+}
+
+//-------------------------------------------------------------------------------------
+void ShmChannel::notify()
+{
+	uint64 value = 1;
+	if (::write(notifyFd_, &value, sizeof(value)) == sizeof(value))
+		++notifications_;
+}
+
+//-------------------------------------------------------------------------------------
+uint32 ShmChannel::readable() const
+{
+	if (!pRx_)
+		return 0;
+
+	return (uint32)(pRx_->head.load(std::memory_order_acquire) - pRx_->tail.load(std::memory_order_relaxed));
+}
+
+//-------------------------------------------------------------------------------------
+bool ShmChannel::waitData(uint64 tail)
+{
+	// 置位后再检查一次， 生产者在两者之间写入时不会错过
+	pRx_->readerWaiting.store(1);
+	if (pRx_->head.load() == tail)
+		return true;
+
+	pRx_->readerWaiting.store(0);
+	return false;
+}
+
+//-------------------------------------------------------------------------------------
+bool ShmChannel::waitSpace(uint64 head)
+{
+	pTx_->writerWaiting.store(1);
+	if (head - pTx_->tail.load() >= ringSize_)
+		return true;
+
+	pTx_->writerWaiting.store(0);
+	return false;
+}
+
+//-------------------------------------------------------------------------------------
+void ShmChannel::publish(uint64 head)
+{
+	pTx_->head.store(head);
+
+	// 消费者正忙时不需要唤醒
+	if (pTx_->readerWaiting.load() && pTx_->readerWaiting.exchange(0))
+		notify();
+}
+
+//-------------------------------------------------------------------------------------
+void ShmChannel::consume(uint64 tail)
+{
+	pRx_->tail.store(tail);
+
+	if (pRx_->writerWaiting.load() && pRx_->writerWaiting.exchange(0))
+		notify();
+}
+
+//-------------------------------------------------------------------------------------
+uint32 ShmChannel::write(struct evbuffer* pBuffer)
+{
+	if (!pTx_)
+		return 0;
+
+	uint32 total = 0;
+	uint32 mask = ringSize_ - 1;
+
+	for (;;)
+	{
+		uint32 length = (uint32)std::min<size_t>(evbuffer_get_length(pBuffer), ringSize_);
+		if (length == 0)
+			break;
+
+		uint64 head = pTx_->head.load(std::memory_order_relaxed);
+		uint32 space = ringSize_ - (uint32)(head - pTx_->tail.load(std::memory_order_acquire));
+		uint32 n = std::min(space, length);
+
+		if (n == 0)
+		{
+			if (waitSpace(head))
+				break;
+
+			continue;
+		}
+
+		uint32 offset = (uint32)head & mask;
+		uint32 first = std::min(n, ringSize_ - offset);
+
+		evbuffer_remove(pBuffer, pTxData_ + offset, first);
+		if (n > first)
+			evbuffer_remove(pBuffer, pTxData_, n - first);
+
+		publish(head + n);
+		total += n;
+	}
+
+	return total;
+}
+
+//-------------------------------------------------------------------------------------
+uint32 ShmChannel::write(const uint8* data, uint32 size)
+{
+	if (!pTx_)
+		return 0;
+
+	uint32 total = 0;
+	uint32 mask = ringSize_ - 1;
+
+	while (total < size)
+	{
+		uint64 head = pTx_->head.load(std::memory_order_relaxed);
+		uint32 space = ringSize_ - (uint32)(head - pTx_->tail.load(std::memory_order_acquire));
+		uint32 n = std::min(space, size - total);
+
+		if (n == 0)
+		{
+			if (waitSpace(head))
+				break;
+
+			continue;
+		}
+
+		uint32 offset = (uint32)head & mask;
+		uint32 first = std::min(n, ringSize_ - offset);
+
+		memcpy(pTxData_ + offset, data + total, first);
+		if (n > first)
+			memcpy(pTxData_, data + total + first, n - first);
+
+		publish(head + n);
+		total += n;
+	}
+
+	return total;
+}
+
+//-------------------------------------------------------------------------------------
+uint32 ShmChannel::read(struct evbuffer* pBuffer, uint32 max)
+{
+	if (!pRx_)
+		return 0;
+
+	uint32 total = 0;
+	uint32 mask = ringSize_ - 1;
+
+	while (total < max)
+	{
+		uint64 tail = pRx_->tail.load(std::memory_order_relaxed);
+		uint32 n = std::min((uint32)(pRx_->head.load(std::memory_order_acquire) - tail), max - total);
+
+		if (n == 0)
+		{
+			if (waitData(tail))
+				break;
+
+			continue;
+		}
+
+		// 直接拷贝到接收缓冲区的空闲空间， 不经过临时内存
+		struct evbuffer_iovec vec;
+		if (evbuffer_reserve_space(pBuffer, n, &vec, 1) != 1)
+			break;
+
+		uint32 offset = (uint32)tail & mask;
+		uint32 first = std::min(n, ringSize_ - offset);
+
+		memcpy(vec.iov_base, pRxData_ + offset, first);
+		if (n > first)
+			memcpy((uint8*)vec.iov_base + first, pRxData_, n - first);
+
+		vec.iov_len = n;
+		if (evbuffer_commit_space(pBuffer, &vec, 1) != 0)
+			break;
+
+		consume(tail + n);
+		total += n;
+	}
+
+	return total;
+}
+
+//-------------------------------------------------------------------------------------
+uint32 ShmChannel::read(uint8* dest, uint32 size)
+{
+	if (!pRx_)
+		return 0;
+
+	uint32 total = 0;
+	uint32 mask = ringSize_ - 1;
+
+	while (total < size)
+	{
+		uint64 tail = pRx_->tail.load(std::memory_order_relaxed);
+		uint32 n = std::min((uint32)(pRx_->head.load(std::memory_order_acquire) - tail), size - total);
+
+		if (n == 0)
+		{
+			if (waitData(tail))
+				break;
+
+			continue;
+		}
+
+		uint32 offset = (uint32)tail & mask;
+		uint32 first = std::min(n, ringSize_ - offset);
+
+		memcpy(dest + total, pRxData_ + offset, first);
+		if (n > first)
+			memcpy(dest + total + first, pRxData_, n - first);
+
+		consume(tail + n);
+		total += n;
+	}
+
+	return total;
+}
+
+//-------------------------------------------------------------------------------------
+}
@@ -0,0 +1,140 @@
+#ifndef X_SHM_CHANNEL_H
+#define X_SHM_CHANNEL_H
+
+#include "common/common.h"
+
+namespace XServer {
+
+class EventDispatcher;
+
+/*
+	同一台机器上两个进程之间的共享内存通道， 代替回环TCP承载帧数据
+	每个方向一个单生产者单消费者环形缓冲区， 只有对端读空(或写满)后在等待时才用eventfd唤醒，
+	双方都忙碌时收发不需要任何系统调用
+	接受连接的一方create并listen， 发起连接的一方attach， 两个eventfd通过抽象unix socket传过去，
+	双方都在各自的事件循环中完成交接， 不阻塞循环
+	非linux平台上create/attach总是失败， 链路继续使用TCP
+*/
+class ShmChannel
+{
+public:
+	typedef std::function<void()> WakeupCallback;
+	typedef std::function<void(bool)> AttachCallback;
+
+	ShmChannel();
+	~ShmChannel();
+
+	// 本机的标识(主机名/boot_id)， 两端相同才能共享/dev/shm
+	static const std::string& hostID();
+
+	// 创建共享内存和eventfd， ringSize向上取2的幂
+	bool create(uint32 ringSize);
+
+	// 等待对端attach， 把eventfd交给第一个连上来的同用户进程
+	bool listen(EventDispatcher* pEventDispatcher);
+
+	// 映射对端创建的共享内存， 在循环中等待对端交出eventfd， 最多等待timeoutMS
+	// 返回false时不会回调， 否则在close之前成功、 出错或超时时回调一次， 回调中可以删除ShmChannel
+	bool attach(EventDispatcher* pEventDispatcher, const std::string& name, uint32 timeoutMS, const AttachCallback& callback);
+
+	// 同一进程内直接连接另一端， 只用于基准测试
+	bool attach(const ShmChannel& owner);
+
+	void close();
+
+	bool isGood() const {
+		return pMapping_ != NULL && wakeupFd_ >= 0 && notifyFd_ >= 0;
+	}
+
+	const std::string& name() const {
+		return name_;
+	}
+
+	uint32 ringSize() const {
+		return ringSize_;
+	}
+
+	// 对端写入数据或腾出空间时可读
+	int wakeupFd() const {
+		return wakeupFd_;
+	}
+
+	// 在循环中监听wakeupFd， 回调中先取数据再继续写
+	bool watch(EventDispatcher* pEventDispatcher, const WakeupCallback& callback);
+
+	// 让watch的回调在本轮循环中再执行一次
+	void wakeup();
+
+	// 清除wakeupFd上的计数， 自己poll时使用
+	void clearWakeup();
+
+	// 写入能放下的部分， 从pBuffer中取走写入的字节， 放不下时登记等待对端腾出空间
+	uint32 write(struct evbuffer* pBuffer);
+	uint32 write(const uint8* data, uint32 size);
+
+	// 最多取出max字节追加到pBuffer， 读空时登记等待对端写入
+	uint32 read(struct evbuffer* pBuffer, uint32 max);
+	uint32 read(uint8* dest, uint32 size);
+
+	uint32 readable() const;
+
+	// 写eventfd唤醒对端的次数
+	uint64 notifications() const {
+		return notifications_;
+	}
+
+private:
+	struct Ring;
+
+	std::string path() const;
+	bool map(int fd, size_t size, bool init);
+	bool mapPeer();
+	bool receiveFds(int sock);
+	void setupRings();
+
+	bool waitData(uint64 tail);
+	bool waitSpace(uint64 head);
+	void publish(uint64 head);
+	void consume(uint64 tail);
+	void notify();
+
+	void onAccept();
+	void onAttach(short events);
+	void onWakeup();
+
+	static void acceptCallback(evutil_socket_t fd, short events, void* arg);
+	static void attachCallback(evutil_socket_t fd, short events, void* arg);
+	static void wakeupCallback(evutil_socket_t fd, short events, void* arg);
+
+protected:
+	std::string name_;
+
+	uint8* pMapping_;
+	size_t mappingSize_;
+	uint32 ringSize_;
+
+	// 创建方发送用rings[0]， 接收用rings[1]， attach的一方相反
+	bool owner_;
+	bool unlinked_;
+	Ring* pTx_;
+	uint8* pTxData_;
+	Ring* pRx_;
+	uint8* pRxData_;
+
+	int wakeupFd_;
+	int notifyFd_;
+	int listenFd_;
+	int attachFd_;
+
+	struct event* pListenEvent_;
+	struct event* pAttachEvent_;
+	struct event* pWakeupEvent_;
+	WakeupCallback wakeupCallback_;
+	AttachCallback attachCallback_;
+
+	uint64 notifications_;
+};
+
+}
+
+#endif // X_SHM_CHANNEL_H
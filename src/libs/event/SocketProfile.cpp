@@ -0,0 +1,182 @@
+#include "SocketProfile.h"
+#include "log/XLog.h"
+#include "resmgr/ResMgr.h"
+
+namespace XServer {
+
+//-------------------------------------------------------------------------------------
+static bool setSocketOption(socket_t sock, int level, int name, int value, const char* optName)
+{
+	if (setsockopt(sock, level, name, (const char*)&value, sizeof(value)) != 0)
+	{
+		ERROR_MSG(fmt::format("SocketProfile::setSocketOption(): setsockopt({}={}) error: {}, fd={}\n",
+			optName, value, evutil_socket_error_to_string(EVUTIL_SOCKET_ERROR()), sock));
+
+		return false;
+	}
+
+	return true;
+}
+
+//-------------------------------------------------------------------------------------
+static int getSocketOption(socket_t sock, int level, int name)
+{
+	int value = 0;
+	socklen_t len = sizeof(value);
+
+	if (getsockopt(sock, level, name, (char*)&value, &len) != 0)
+		return -1;
+
+	return value;
+}
+
+//-------------------------------------------------------------------------------------
+SocketProfile::SocketProfile():
+sndbuf(0),
+rcvbuf(0),
+nodelay(false),
+notsentLowat(0),
+keepaliveIdle(0),
+keepaliveInterval(0),
+keepaliveCount(0),
+deferAccept(0),
+fastOpen(0)
+{
+}
+
+//-------------------------------------------------------------------------------------
+SocketProfile SocketProfile::fromConfig(bool isInternalNetwork)
+{
+	const ResMgr::ServerConfig& cfg = ResMgr::getSingleton().serverConfig();
+
+	SocketProfile profile;
+
+	if (isInternalNetwork)
+	{
+		profile.sndbuf = cfg.internal_SNDBUF;
+		profile.rcvbuf = cfg.internal_RCVBUF;
+		profile.nodelay = cfg.internal_NODELAY;
+		profile.notsentLowat = cfg.internal_NOTSENT_LOWAT;
+		profile.keepaliveIdle = cfg.internal_KEEPALIVE;
+		profile.deferAccept = cfg.internal_DEFER_ACCEPT;
+		profile.fastOpen = cfg.internal_FASTOPEN;
+
+		// 服务器之间尽快发现断线
+		profile.keepaliveInterval = 10;
+		profile.keepaliveCount = 3;
+	}
+	else
+	{
+		profile.sndbuf = cfg.external_SNDBUF;
+		profile.rcvbuf = cfg.external_RCVBUF;
+		profile.nodelay = cfg.external_NODELAY;
+		profile.notsentLowat = cfg.external_NOTSENT_LOWAT;
+		profile.keepaliveIdle = cfg.external_KEEPALIVE;
+		profile.deferAccept = cfg.external_DEFER_ACCEPT;
+		profile.fastOpen = cfg.external_FASTOPEN;
+
+		// 移动网络容易短暂中断， 探测放宽一些
+		profile.keepaliveInterval = 30;
+		profile.keepaliveCount = 4;
+	}
+
+	return profile;
+}
+
+//-------------------------------------------------------------------------------------
+void SocketProfile::applyListener(socket_t sock) const
+{
+	if (sndbuf > 0)
+		setSocketOption(sock, SOL_SOCKET, SO_SNDBUF, sndbuf, "SO_SNDBUF");
+
+	if (rcvbuf > 0)
+		setSocketOption(sock, SOL_SOCKET, SO_RCVBUF, rcvbuf, "SO_RCVBUF");
+
+#if defined(TCP_DEFER_ACCEPT)
+	if (deferAccept > 0)
+		setSocketOption(sock, IPPROTO_TCP, TCP_DEFER_ACCEPT, deferAccept, "TCP_DEFER_ACCEPT");
+#endif
+
+#if defined(TCP_FASTOPEN)
+	if (fastOpen > 0)
+		setSocketOption(sock, IPPROTO_TCP, TCP_FASTOPEN, fastOpen, "TCP_FASTOPEN");
+#endif
+}
+
+//-------------------------------------------------------------------------------------
+void SocketProfile::apply(socket_t sock) const
+{
+	if (sndbuf > 0)
+		setSocketOption(sock, SOL_SOCKET, SO_SNDBUF, sndbuf, "SO_SNDBUF");
+
+	if (rcvbuf > 0)
+		setSocketOption(sock, SOL_SOCKET, SO_RCVBUF, rcvbuf, "SO_RCVBUF");
+
+	if (nodelay)
+		setSocketOption(sock, IPPROTO_TCP, TCP_NODELAY, 1, "TCP_NODELAY");
+
+#if defined(TCP_NOTSENT_LOWAT)
+	if (notsentLowat > 0)
+		setSocketOption(sock, IPPROTO_TCP, TCP_NOTSENT_LOWAT, notsentLowat, "TCP_NOTSENT_LOWAT");
+#endif
+
+	if (keepaliveIdle > 0)
+	{
+		setSocketOption(sock, SOL_SOCKET, SO_KEEPALIVE, 1, "SO_KEEPALIVE");
+
+#if defined(TCP_KEEPIDLE)
+		setSocketOption(sock, IPPROTO_TCP, TCP_KEEPIDLE, keepaliveIdle, "TCP_KEEPIDLE");
+#endif
+
+#if defined(TCP_KEEPINTVL)
+		if (keepaliveInterval > 0)
+			setSocketOption(sock, IPPROTO_TCP, TCP_KEEPINTVL, keepaliveInterval, "TCP_KEEPINTVL");
+#endif
+
+#if defined(TCP_KEEPCNT)
+		if (keepaliveCount > 0)
+			setSocketOption(sock, IPPROTO_TCP, TCP_KEEPCNT, keepaliveCount, "TCP_KEEPCNT");
+#endif
+	}
+}
+
+//-------------------------------------------------------------------------------------
+std::string SocketProfile::listenerEffective(socket_t sock) const
+{
+	std::string s = fmt::format("SO_SNDBUF={}, SO_RCVBUF={}",
+		getSocketOption(sock, SOL_SOCKET, SO_SNDBUF), getSocketOption(sock, SOL_SOCKET, SO_RCVBUF));
+
+#if defined(TCP_DEFER_ACCEPT)
+	s += fmt::format(", TCP_DEFER_ACCEPT={}", getSocketOption(sock, IPPROTO_TCP, TCP_DEFER_ACCEPT));
+#endif
+
+#if defined(TCP_FASTOPEN)
+	s += fmt::format(", TCP_FASTOPEN={}", getSocketOption(sock, IPPROTO_TCP, TCP_FASTOPEN));
+#endif
+
+	return s;
+}
+
+//-------------------------------------------------------------------------------------
+std::string SocketProfile::effective(socket_t sock) const
+{
+	std::string s = fmt::format("SO_SNDBUF={}, SO_RCVBUF={}, TCP_NODELAY={}",
+		getSocketOption(sock, SOL_SOCKET, SO_SNDBUF), getSocketOption(sock, SOL_SOCKET, SO_RCVBUF),
+		getSocketOption(sock, IPPROTO_TCP, TCP_NODELAY));
+
+#if defined(TCP_NOTSENT_LOWAT)
+	s += fmt::format(", TCP_NOTSENT_LOWAT={}", getSocketOption(sock, IPPROTO_TCP, TCP_NOTSENT_LOWAT));
+#endif
+
+	s += fmt::format(", SO_KEEPALIVE={}", getSocketOption(sock, SOL_SOCKET, SO_KEEPALIVE));
+
+#if defined(TCP_KEEPIDLE) && defined(TCP_KEEPINTVL) && defined(TCP_KEEPCNT)
+	s += fmt::format("(idle={}, interval={}, count={})", getSocketOption(sock, IPPROTO_TCP, TCP_KEEPIDLE),
+		getSocketOption(sock, IPPROTO_TCP, TCP_KEEPINTVL), getSocketOption(sock, IPPROTO_TCP, TCP_KEEPCNT));
+#endif
+
+	return s;
+}
+
+//-------------------------------------------------------------------------------------
+}
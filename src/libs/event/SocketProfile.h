@@ -0,0 +1,53 @@
+#ifndef X_SOCKET_PROFILE_H
+#define X_SOCKET_PROFILE_H
+
+#include "common/common.h"
+
+namespace XServer {
+
+/*
+	一组socket参数， 内部网络(服务器之间)和外部网络(客户端)各用一份
+	数值为0表示保持系统默认
+*/
+class SocketProfile
+{
+public:
+	SocketProfile();
+
+	// 从ResMgr的服务器配置中读取
+	static SocketProfile fromConfig(bool isInternalNetwork);
+
+	// 监听socket： 缓冲区大小(accept出来的socket会继承)、DEFER_ACCEPT、FASTOPEN
+	void applyListener(socket_t sock) const;
+
+	// 已accept或即将connect的socket： 缓冲区大小、NODELAY、NOTSENT_LOWAT、keepalive
+	void apply(socket_t sock) const;
+
+	// 通过getsockopt读回实际生效的值
+	std::string listenerEffective(socket_t sock) const;
+	std::string effective(socket_t sock) const;
+
+public:
+	int sndbuf;
+	int rcvbuf;
+
+	bool nodelay;
+
+	// 内核发送队列中未发送数据的上限， 更多数据留在用户态由Session的发送队列管理
+	int notsentLowat;
+
+	// 空闲多少秒后开始发送keepalive探测， 0为关闭
+	int keepaliveIdle;
+	int keepaliveInterval;
+	int keepaliveCount;
+
+	// 收到数据之前不唤醒accept的秒数
+	int deferAccept;
+
+	// TFO等待队列长度
+	int fastOpen;
+};
+
+}
+
+#endif // X_SOCKET_PROFILE_H
@@ -1,5 +1,8 @@
 ﻿#include "TcpSocket.h"
 #include "EventDispatcher.h"
+#include "ShmChannel.h"
+#include "IoUring.h"
+#include "BufferPool.h"
 #include "log/XLog.h"
 
 namespace XServer {
@@ -7,27 +10,69 @@ namespace XServer {
 #define RECV_BUFFER bufferevent_get_input(bufEvt_)
 #define SEND_BUFFER bufferevent_get_output(bufEvt_)
 
+// 每次读事件最多读满这么多块， 和bufferevent一次最多读16K相当
+static const int READ_CHUNKS_MAX = 4;
+
 //-------------------------------------------------------------------------------------
 TcpSocket::TcpSocket(EventDispatcher* pEventDispatcher, socket_t sock):
-bufEvt_(NULL)
+bufEvt_(NULL),
+corkBuffer_(NULL),
+pReadEvent_(NULL),
+readEnabled_(false),
+pUringSocket_(NULL),
+pShmChannel_(NULL),
+shmSend_(false),
+shmRecv_(false),
+shmReadPaused_(false),
+recvSuspended_(false)
 {
+	IoUring* pIoUring = pEventDispatcher->pIoUring();
+	if (pIoUring && sock != SOCKET_T_INVALID)
+	{
+		// fd交给io_uring收发， bufferevent只用来存放数据和回调上层
+		bufEvt_ = bufferevent_socket_new(pEventDispatcher->base(), -1, 0);
+		if (bufEvt_)
+			pUringSocket_ = new UringSocket(pIoUring, sock, bufEvt_);
+
+		return;
+	}
+
 	bufEvt_ = bufferevent_socket_new(pEventDispatcher->base(),
 		sock, BEV_OPT_CLOSE_ON_FREE);
+
+#if X_PLATFORM != PLATFORM_WIN32
+	// bufferevent读socket时按每次读到的长度申请内存， 改为读到池中的块里
+	if (bufEvt_ && sock != SOCKET_T_INVALID && BufferPool::enabled())
+	{
+		// 边缘触发时每次就绪只通知一次， 没有读到EAGAIN之前由onReadable自己继续
+		short events = EV_READ | EV_PERSIST | (pEventDispatcher->edgeTriggered() ? EV_ET : 0);
+		pReadEvent_ = event_new(pEventDispatcher->base(), sock, events, readCallback, this);
+	}
+#endif
 }
 
 //-------------------------------------------------------------------------------------
 TcpSocket::~TcpSocket()
 {
+	closeShm();
+	closeReadEvent();
+	SAFE_RELEASE(pUringSocket_);
+
 	if(bufEvt_)
 	{
 		bufferevent_free(bufEvt_);
 		bufEvt_ = NULL;
 	}
+
+	cork(false);
 }
 
 //-------------------------------------------------------------------------------------
 socket_t TcpSocket::socket() const
 {
+	if (pUringSocket_)
+		return pUringSocket_->socket();
+
 	return (!bufEvt_) ? SOCKET_T_INVALID : bufferevent_getfd(bufEvt_);
 }
 
@@ -39,6 +84,9 @@ bool TcpSocket::send(const uint8 *data, uint32 size)
 		return false;
 	}
 
+	if (corkBuffer_)
+		return (-1 != evbuffer_add(corkBuffer_, data, size));
+
 	return (-1 != bufferevent_write(bufEvt_, data, size));
 }
 
@@ -54,12 +102,72 @@ uint32 TcpSocket::getRecvBufferLength() const
 	return (bufEvt_) ? (uint32)evbuffer_get_length(RECV_BUFFER) : 0;
 }
 
+//-------------------------------------------------------------------------------------
+uint32 TcpSocket::getSendBufferLength() const
+{
+	if (!bufEvt_)
+		return 0;
+
+	size_t length = evbuffer_get_length(SEND_BUFFER);
+	if (corkBuffer_)
+		length += evbuffer_get_length(corkBuffer_);
+
+	if (pUringSocket_)
+		length += pUringSocket_->sending();
+
+	return (uint32)length;
+}
+
+//-------------------------------------------------------------------------------------
+bool TcpSocket::setPriority(int priority)
+{
+	if (pReadEvent_ && event_priority_set(pReadEvent_, priority) != 0)
+		return false;
+
+	return bufEvt_ && bufferevent_priority_set(bufEvt_, priority) == 0;
+}
+
+//-------------------------------------------------------------------------------------
+void TcpSocket::setSendLowWatermark(uint32 low)
+{
+	if (bufEvt_)
+		bufferevent_setwatermark(bufEvt_, EV_WRITE, low, 0);
+}
+
 //-------------------------------------------------------------------------------------
 const uint8* TcpSocket::getRecvBuffer(uint32_t size) const
 {
 	return (bufEvt_) ? evbuffer_pullup(RECV_BUFFER, size) : NULL;
 }
 
+//-------------------------------------------------------------------------------------
+struct evbuffer * TcpSocket::getRecvEvbuffer() const
+{
+	return (bufEvt_) ? RECV_BUFFER : NULL;
+}
+
+//-------------------------------------------------------------------------------------
+struct evbuffer * TcpSocket::getSendEvbuffer() const
+{
+	if (!bufEvt_)
+		return NULL;
+
+	return (corkBuffer_) ? corkBuffer_ : SEND_BUFFER;
+}
+
+//-------------------------------------------------------------------------------------
+bool TcpSocket::peek(uint8 * dest, uint32 size) const
+{
+	return (bufEvt_) ? (size == (uint32)evbuffer_copyout(RECV_BUFFER, (void *)dest, size)) : false;
+}
+
+//-------------------------------------------------------------------------------------
+void TcpSocket::drain(uint32 size)
+{
+	if(bufEvt_)
+		evbuffer_drain(RECV_BUFFER, size);
+}
+
 //-------------------------------------------------------------------------------------
 void TcpSocket::clearRecvBuffer()
 {
@@ -74,6 +182,10 @@ void TcpSocket::close()
 	//clearRecvBuffer();
 	//evutil_closesocket(socket());
 
+	closeShm();
+	closeReadEvent();
+	SAFE_RELEASE(pUringSocket_);
+
 	if(bufEvt_)
 		bufferevent_free(bufEvt_);
 		
@@ -141,47 +253,451 @@ uint16 TcpSocket::getPort()
 	return TcpSocket::getSocketPort(socket());
 }
 
+//-------------------------------------------------------------------------------------
+bool TcpSocket::connect(const struct sockaddr* pAddr, socklen_t len)
+{
+	if (!bufEvt_)
+		return false;
+
+	if (pUringSocket_)
+		return pUringSocket_->connect(pAddr, len);
+
+	return bufferevent_socket_connect(bufEvt_, (struct sockaddr*)pAddr, len) == 0;
+}
+
 //-------------------------------------------------------------------------------------
 bool TcpSocket::setcb(
 	bufferevent_data_cb recvcb, bufferevent_data_cb sendcb,
 	bufferevent_event_cb eventcb, void *cbarg)
 {
 	bufferevent_setcb(bufEvt_, recvcb, sendcb, eventcb, cbarg);
-	if (-1 == bufferevent_enable(bufEvt_, EV_READ | EV_WRITE))
+	if (-1 == bufferevent_enable(bufEvt_, pReadEvent_ ? EV_WRITE : EV_READ | EV_WRITE))
 	{
+		closeReadEvent();
+		SAFE_RELEASE(pUringSocket_);
 		bufferevent_free(bufEvt_);
 		bufEvt_ = NULL;
 		return false;
 	}
 
+	if (pUringSocket_)
+		pUringSocket_->enableRecv(true);
+
+	readEnabled_ = true;
+	updateReadEvent();
 	return true;
 }
 
 //-------------------------------------------------------------------------------------
 bool TcpSocket::enable(short event)
 {
-	if (-1 == bufferevent_enable(bufEvt_, event))
+	if ((event & EV_READ) && shmReadPaused_)
+	{
+		shmReadPaused_ = false;
+
+		// 暂停期间没有取的数据
+		if (pShmChannel_)
+			pShmChannel_->wakeup();
+	}
+
+	if (event & EV_READ)
+		readEnabled_ = true;
+
+	// 自己读socket时bufferevent一直不读
+	short bufEvtEvents = pReadEvent_ ? (event & ~EV_READ) : event;
+	if (bufEvtEvents && -1 == bufferevent_enable(bufEvt_, bufEvtEvents))
 	{
+		closeReadEvent();
+		SAFE_RELEASE(pUringSocket_);
 		bufferevent_free(bufEvt_);
 		bufEvt_ = NULL;
 		return false;
 	}
 
+	if ((event & EV_READ) && pUringSocket_ && !recvSuspended_)
+		pUringSocket_->enableRecv(true);
+
+	updateReadEvent();
 	return true;
 }
 
 //-------------------------------------------------------------------------------------
 bool TcpSocket::disable(short event)
 {
-	if (-1 == bufferevent_disable(bufEvt_, event))
+	if (event & EV_READ)
 	{
+		shmReadPaused_ = true;
+
+		if (pUringSocket_)
+			pUringSocket_->enableRecv(false);
+
+		readEnabled_ = false;
+	}
+
+	short bufEvtEvents = pReadEvent_ ? (event & ~EV_READ) : event;
+	if (bufEvtEvents && -1 == bufferevent_disable(bufEvt_, bufEvtEvents))
+	{
+		closeReadEvent();
+		SAFE_RELEASE(pUringSocket_);
 		bufferevent_free(bufEvt_);
 		bufEvt_ = NULL;
 		return false;
 	}
 
+	updateReadEvent();
 	return true;
 }
 
+//-------------------------------------------------------------------------------------
+void TcpSocket::suspendRecv(bool v)
+{
+	if (!bufEvt_ || recvSuspended_ == v)
+		return;
+
+	recvSuspended_ = v;
+
+	if (pUringSocket_)
+	{
+		// 被disable的读不在这里恢复
+		if (!shmReadPaused_)
+			pUringSocket_->enableRecv(!v);
+	}
+	else if (pReadEvent_)
+	{
+		updateReadEvent();
+	}
+	else
+	{
+		// 读高水位设为当前长度， 之后只能读入session处理掉的那么多， 设回0时恢复
+		size_t length = evbuffer_get_length(RECV_BUFFER);
+		bufferevent_setwatermark(bufEvt_, EV_READ, 0, v ? std::max<size_t>(1, length) : 0);
+	}
+
+	// 暂停期间没有取的数据
+	if (!v && pShmChannel_ && !shmReadPaused_)
+		pShmChannel_->wakeup();
+}
+
+//-------------------------------------------------------------------------------------
+void TcpSocket::updateReadEvent()
+{
+	if (!pReadEvent_)
+		return;
+
+	if (!readEnabled_ || recvSuspended_)
+	{
+		event_del(pReadEvent_);
+		return;
+	}
+
+	bool pending = event_pending(pReadEvent_, EV_READ, NULL) != 0;
+	event_add(pReadEvent_, NULL);
+
+	// 边缘触发时暂停期间到达的数据不会再通知， 重新打开后主动读一次
+	if (!pending && (event_get_events(pReadEvent_) & EV_ET))
+		event_active(pReadEvent_, EV_READ, 1);
+}
+
+//-------------------------------------------------------------------------------------
+void TcpSocket::closeReadEvent()
+{
+	if (!pReadEvent_)
+		return;
+
+	event_free(pReadEvent_);
+	pReadEvent_ = NULL;
+}
+
+//-------------------------------------------------------------------------------------
+void TcpSocket::readCallback(evutil_socket_t fd, short events, void* arg)
+{
+	((TcpSocket*)arg)->onReadable();
+}
+
+//-------------------------------------------------------------------------------------
+void TcpSocket::onReadable()
+{
+	struct evbuffer* pInput = RECV_BUFFER;
+	socket_t sock = bufferevent_getfd(bufEvt_);
+
+	ssize_t result = 0;
+	size_t bytes = 0;
+	bool added = true;
+	bool drained = false;
+	int error = 0;
+
+	// 接收缓冲区只在读入时解冻， 和bufferevent自己读socket时一样
+	evbuffer_unfreeze(pInput, 0);
+
+#if X_PLATFORM != PLATFORM_WIN32
+	for (int i = 0; i < READ_CHUNKS_MAX; ++i)
+	{
+		uint8* pChunk = BufferPool::acquire();
+
+		// 池已满时退回evbuffer自己的内存
+		if (!pChunk)
+		{
+			result = evbuffer_read(pInput, sock, -1);
+			error = errno;
+			bytes += result > 0 ? result : 0;
+			break;
+		}
+
+		result = ::read(sock, pChunk, BufferPool::chunkSize());
+		if (result <= 0)
+		{
+			error = errno;
+			BufferPool::release(pChunk);
+			break;
+		}
+
+		bytes += result;
+
+		// 很短的数据复制到evbuffer中， 块立即放回池中
+		if ((uint32)result < BufferPool::copyThreshold())
+		{
+			added = BufferPool::add(pInput, pChunk, (uint32)result) && added;
+			BufferPool::release(pChunk);
+		}
+		else
+		{
+			added = BufferPool::addChunk(pInput, pChunk, (uint32)result) && added;
+		}
+
+		// 没有读满说明socket中已经没有数据了
+		if ((uint32)result < BufferPool::chunkSize())
+		{
+			drained = true;
+			break;
+		}
+	}
+#endif
+
+	evbuffer_freeze(pInput, 0);
+
+	// 以下的bufferevent回调中上层可能释放自己， 之后不能再访问成员
+	if (result == 0 && bytes == 0)
+	{
+		event_del(pReadEvent_);
+		bufferevent_trigger_event(bufEvt_, BEV_EVENT_EOF | BEV_EVENT_READING, 0);
+		return;
+	}
+
+	if ((result < 0 && bytes == 0 && error != EAGAIN && error != EWOULDBLOCK && error != EINTR) || !added)
+	{
+		event_del(pReadEvent_);
+		bufferevent_trigger_event(bufEvt_, BEV_EVENT_ERROR | BEV_EVENT_READING, 0);
+		return;
+	}
+
+	if (result < 0 && (error == EAGAIN || error == EWOULDBLOCK))
+		drained = true;
+
+	// 边缘触发时不会再有下一次通知， socket没有读空就在下一轮接着读
+	if (!drained && (event_get_events(pReadEvent_) & EV_ET))
+		event_active(pReadEvent_, EV_READ, 1);
+
+	// 读满之后的那次read结束或出错时， 已经读到的数据先交给上层， 下一次读事件再报告
+	if (bytes > 0)
+		bufferevent_trigger(bufEvt_, EV_READ, 0);
+}
+
+//-------------------------------------------------------------------------------------
+void TcpSocket::compactRecvBuffer()
+{
+	if (!bufEvt_ || (!pReadEvent_ && !(pUringSocket_ && BufferPool::enabled())))
+		return;
+
+	struct evbuffer* pInput = RECV_BUFFER;
+
+	size_t length = evbuffer_get_length(pInput);
+	if (length == 0 || length >= BufferPool::copyThreshold())
+		return;
+
+	static thread_local std::vector<uint8> buffer;
+	buffer.resize(length);
+
+	if (evbuffer_remove(pInput, &buffer[0], length) != (int)length)
+		return;
+
+	evbuffer_unfreeze(pInput, 0);
+	BufferPool::add(pInput, &buffer[0], (uint32)length);
+
+	// io_uring收数据时接收缓冲区一直是解冻的
+	if (!pUringSocket_)
+		evbuffer_freeze(pInput, 0);
+}
+
+//-------------------------------------------------------------------------------------
+void TcpSocket::cork(bool v)
+{
+	if (v)
+	{
+		if (!corkBuffer_)
+			corkBuffer_ = evbuffer_new();
+
+		return;
+	}
+
+	// 共享内存只能从corkBuffer_写出
+	if (!corkBuffer_ || shmSend_)
+		return;
+
+	flush(false);
+	evbuffer_free(corkBuffer_);
+	corkBuffer_ = NULL;
+}
+
+//-------------------------------------------------------------------------------------
+bool TcpSocket::flush(bool direct)
+{
+	if (!bufEvt_ || !corkBuffer_ || evbuffer_get_length(corkBuffer_) == 0)
+		return false;
+
+	// 环满时剩下的留在corkBuffer_中， 对端腾出空间后唤醒继续写
+	if (shmSend_)
+		return pShmChannel_->write(corkBuffer_) > 0;
+
+	// 交给io_uring在本轮末尾和其他socket一起提交
+	if (pUringSocket_)
+	{
+		evbuffer_add_buffer(SEND_BUFFER, corkBuffer_);
+		return false;
+	}
+
+	bool written = false;
+
+	// bufferevent的发送缓冲区为空时直接一次writev写出， 否则追加到其后保证顺序
+	if (direct && evbuffer_get_length(SEND_BUFFER) == 0)
+	{
+		evbuffer_write(corkBuffer_, socket());
+		written = true;
+	}
+
+	// 没写完的部分(包括出错)交给bufferevent， 可写时继续发送或报告错误
+	if (evbuffer_get_length(corkBuffer_) > 0)
+		evbuffer_add_buffer(SEND_BUFFER, corkBuffer_);
+
+	return written;
+}
+
+//-------------------------------------------------------------------------------------
+bool TcpSocket::listenShm(EventDispatcher* pEventDispatcher, uint32 ringSize, std::string& name)
+{
+	closeShm();
+
+	pShmChannel_ = new ShmChannel();
+	if (!pShmChannel_->create(ringSize) || !pShmChannel_->listen(pEventDispatcher) ||
+		!pShmChannel_->watch(pEventDispatcher, std::bind(&TcpSocket::onShmWakeup, this)))
+	{
+		closeShm();
+		return false;
+	}
+
+	name = pShmChannel_->name();
+	return true;
+}
+
+//-------------------------------------------------------------------------------------
+bool TcpSocket::attachShm(EventDispatcher* pEventDispatcher, const std::string& name, const ShmAttachCallback& callback)
+{
+	closeShm();
+
+	// 对端在HelloCB之前已经开始监听， 通常在它的下一轮循环accept后就能完成
+	pShmChannel_ = new ShmChannel();
+
+	bool ret = pShmChannel_->attach(pEventDispatcher, name, 1000, [this, pEventDispatcher, callback](bool ok) {
+		if (ok && !pShmChannel_->watch(pEventDispatcher, std::bind(&TcpSocket::onShmWakeup, this)))
+			ok = false;
+
+		if (!ok)
+			closeShm();
+
+		callback(ok);
+	});
+
+	if (!ret)
+		closeShm();
+
+	return ret;
+}
+
+//-------------------------------------------------------------------------------------
+void TcpSocket::startShmSend()
+{
+	if (!pShmChannel_ || shmSend_)
+		return;
+
+	// 切换之前的数据(包括通知对端切换的包)全部交给TCP
+	if (corkBuffer_)
+		flush(false);
+	else
+		cork(true);
+
+	shmSend_ = true;
+}
+
+//-------------------------------------------------------------------------------------
+void TcpSocket::startShmRecv()
+{
+	if (!pShmChannel_ || shmRecv_)
+		return;
+
+	// 当前可能正在分发接收缓冲区中的包， 留到下一次回调再取
+	shmRecv_ = true;
+	pShmChannel_->wakeup();
+}
+
+//-------------------------------------------------------------------------------------
+void TcpSocket::closeShm()
+{
+	if (!pShmChannel_)
+		return;
+
+	// 已经切换的数据没有别的通道可走
+	if (shmSend_ && corkBuffer_)
+		evbuffer_drain(corkBuffer_, UINT32_MAX);
+
+	delete pShmChannel_;
+	pShmChannel_ = NULL;
+	shmSend_ = shmRecv_ = false;
+}
+
+//-------------------------------------------------------------------------------------
+bool TcpSocket::pollShm()
+{
+	if (!bufEvt_ || !pShmChannel_ || !shmRecv_ || shmReadPaused_ || recvSuspended_)
+		return false;
+
+	// bufferevent只在自己读socket时解冻接收缓冲区的尾部， 其余时间不能追加
+	// 每次最多取一个环的长度， 剩下的下一轮再取， 不让一个对端独占循环
+	evbuffer_unfreeze(RECV_BUFFER, 0);
+	uint32 size = pShmChannel_->read(RECV_BUFFER, pShmChannel_->ringSize());
+
+	// io_uring收数据时接收缓冲区一直是解冻的
+	if (!pUringSocket_)
+		evbuffer_freeze(RECV_BUFFER, 0);
+
+	if (pShmChannel_->readable() > 0)
+		pShmChannel_->wakeup();
+
+	return size > 0;
+}
+
+//-------------------------------------------------------------------------------------
+void TcpSocket::onShmWakeup()
+{
+	if (!bufEvt_)
+		return;
+
+	// 对端腾出了空间， 继续写出上次没写完的部分
+	if (shmSend_ && corkBuffer_ && evbuffer_get_length(corkBuffer_) > 0 && pShmChannel_->write(corkBuffer_) > 0)
+		bufferevent_trigger(bufEvt_, EV_WRITE, 0);
+
+	// 和TCP一样通过bufferevent的读回调交给session
+	if (pollShm())
+		bufferevent_trigger(bufEvt_, EV_READ, 0);
+}
+
 //-------------------------------------------------------------------------------------
 }
@@ -1,18 +1,31 @@
-#ifndef X_TCP_SOCKET_H
+﻿#ifndef X_TCP_SOCKET_H
 #define X_TCP_SOCKET_H
 
 #include "common/common.h"
+#include "event/SessionPool.h"
 
 namespace XServer {
 
 class EventDispatcher;
+class ShmChannel;
+class UringSocket;
 
 class TcpSocket
 {
 public:
+	typedef std::function<void(bool)> ShmAttachCallback;
+
 	TcpSocket(EventDispatcher* pEventDispatcher, socket_t sock);
 	virtual ~TcpSocket();
 
+	static void* operator new(size_t size) {
+		return SessionAllocator::allocate(size);
+	}
+
+	static void operator delete(void* p, size_t size) {
+		SessionAllocator::deallocate(p, size);
+	}
+
 	std::string addr();
 
 	std::string getIP();
@@ -29,10 +42,25 @@ public:
 	bool send(const uint8 *data, uint32 size);
 	
 	uint32 getRecvBufferLength() const;
+
+	// 还未写到socket的数据长度， 包括corking暂存的部分
+	uint32 getSendBufferLength() const;
+
+	// 发送缓冲区降到low以下时回调sendcb
+	void setSendLowWatermark(uint32 low);
+
+	// 读写事件的优先级(EventPriority)
+	bool setPriority(int priority);
 	
 	const uint8 * getRecvBuffer(uint32 size) const;
+
+	struct evbuffer * getRecvEvbuffer() const;
+	struct evbuffer * getSendEvbuffer() const;
 	
 	bool recv(uint8 * dest, uint32_t size);
+
+	bool peek(uint8 * dest, uint32 size) const;
+	void drain(uint32 size);
 	
 	void clearRecvBuffer();
 	
@@ -46,6 +74,14 @@ public:
 		return bufEvt_;
 	}
 
+	// 自己创建的socket发起连接， 结果以BEV_EVENT_CONNECTED或BEV_EVENT_ERROR通知
+	bool connect(const struct sockaddr* pAddr, socklen_t len);
+
+	// 所属循环开启了io_uring时由它收发， 见IoUring
+	bool usingUring() const {
+		return pUringSocket_ != NULL;
+	}
+
 	bool setcb(
 		bufferevent_data_cb recvcb, bufferevent_data_cb sendcb,
 		bufferevent_event_cb eventcb, void *cbarg);
@@ -53,8 +89,76 @@ public:
 	bool enable(short event);
 	bool disable(short event);
 
+	// 接收缓冲区中还有没处理的包时暂停从socket读取， 和enable/disable互不影响
+	void suspendRecv(bool v);
+
+	bool recvSuspended() const {
+		return recvSuspended_;
+	}
+
+	// 开启后发送的数据先暂存在corkBuffer_中， 由flush统一写出
+	void cork(bool v);
+
+	bool corked() const {
+		return corkBuffer_ != NULL;
+	}
+
+	// 返回是否调用了一次writev
+	bool flush(bool direct);
+
+	// 同一台机器上的对端改用共享内存传输， TCP连接只用来握手和检测断开
+	// 接受连接的一方listenShm， 发起连接的一方attachShm， 双方在各自的切换点之后startShmSend/startShmRecv
+	bool listenShm(EventDispatcher* pEventDispatcher, uint32 ringSize, std::string& name);
+
+	// 在循环中异步attach， 完成后回调是否成功， 失败时已经closeShm； 返回false时不会回调
+	bool attachShm(EventDispatcher* pEventDispatcher, const std::string& name, const ShmAttachCallback& callback);
+	void startShmSend();
+	void startShmRecv();
+	void closeShm();
+
+	// attach还没有完成时也返回true
+	bool hasShm() const {
+		return pShmChannel_ != NULL;
+	}
+
+	bool shmSending() const {
+		return shmSend_;
+	}
+
+	// 把共享内存中已到达的数据取到接收缓冲区， 返回是否取到了数据
+	bool pollShm();
+
+	// 开启内存池时由自己读socket， 数据放在池中的块里， bufferevent只负责写
+	bool pooledRecv() const {
+		return pReadEvent_ != NULL;
+	}
+
+	// 接收缓冲区只剩不完整的短包时复制出来， 让它所在的块归还到池中， 空闲的连接不再占用整块
+	void compactRecvBuffer();
+
+protected:
+	void onShmWakeup();
+
+	static void readCallback(evutil_socket_t fd, short events, void* arg);
+	void onReadable();
+	void updateReadEvent();
+	void closeReadEvent();
+
 protected:
 	struct bufferevent* bufEvt_;
+	struct evbuffer* corkBuffer_;
+
+	// 自己读socket时的读事件， 上层要求读且没有暂停时才添加
+	struct event* pReadEvent_;
+	bool readEnabled_;
+
+	UringSocket* pUringSocket_;
+
+	ShmChannel* pShmChannel_;
+	bool shmSend_;
+	bool shmRecv_;
+	bool shmReadPaused_;
+	bool recvSuspended_;
 };
 
 }
@@ -7,76 +7,321 @@ namespace XServer {
 const int Timer::Seconds = 1000;
 
 //-------------------------------------------------------------------------------------
-Timer::Timer(EventDispatcher* pEventDispatcher):
-pEventDispatcher_(pEventDispatcher)
+Timer::Timer(EventDispatcher* pEventDispatcher, uint32 tickMs, int priority):
+pEventDispatcher_(pEventDispatcher),
+pTickEvent_(NULL),
+tickMs_(std::max<uint32>(1, tickMs)),
+currentTick_(0),
+lastTickTime_(0),
+nodes_(),
+freeNodes_(),
+count_(0)
 {
+	for (int i = 0; i <= WHEEL_SLOTS; ++i)
+		slots_[i] = -1;
+
+	pTickEvent_ = event_new(pEventDispatcher_->base(), -1, EV_PERSIST, tickCallback, this);
+	if (!pTickEvent_)
+	{
+		ERROR_MSG(fmt::format("Timer::Timer(): event_new error!\n"));
+		return;
+	}
+
+	if (priority >= 0)
+		pEventDispatcher_->setPriority(pTickEvent_, priority);
 }
 
 //-------------------------------------------------------------------------------------
 Timer::~Timer()
 {
+	if (pTickEvent_)
+	{
+		event_free(pTickEvent_);
+		pTickEvent_ = NULL;
+	}
+
+	nodes_.clear();
+	freeNodes_.clear();
+	count_ = 0;
 }
 
 //-------------------------------------------------------------------------------------
-struct event * Timer::addTimer(uint32_t interval, int round, TimerHandler timeout_cb, void* userargs)
+uint64 Timer::monotonicMs()
 {
-	struct timeval tv;
-	evutil_timerclear(&tv);
-
-	cb_arg* arg = new cb_arg();
-	arg->ev = NULL;
-	arg->pTimer = this;
-	arg->userargs = userargs;
-	arg->pHandler = timeout_cb;
-	arg->round = 0;
-	arg->roundMax = round;
-
-	struct event *timeout_ev = event_new(pEventDispatcher_->base(), -1, (round > 1 || round == -1) ? EV_PERSIST : 0, eventHandler, (void*)arg);
-	if (!timeout_ev)
+	return (uint64)std::chrono::duration_cast<std::chrono::milliseconds>(
+		std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+//-------------------------------------------------------------------------------------
+TimerHandle Timer::addTimer(uint32_t interval, int round, TimerHandler timeout_cb, void* userargs)
+{
+	if (!pTickEvent_)
 	{
-		ERROR_MSG(fmt::format("Timer::addTimer(): event_new error!\n"));
-		return NULL;
+		ERROR_MSG(fmt::format("Timer::addTimer(): tick event is null!\n"));
+		return TIMER_HANDLE_INVALID;
 	}
 
-	arg->ev = timeout_ev;
+	// 没有定时器时时间轮不转动， 重新开始时从当前时间算起
+	if (!evtimer_pending(pTickEvent_, NULL))
+	{
+		struct timeval tv;
+		tv.tv_sec = tickMs_ / 1000;
+		tv.tv_usec = tickMs_ % 1000 * 1000;
 
-	tv.tv_sec = interval / 1000;
-	tv.tv_usec = interval % 1000 * 1000;
+		if (0 != evtimer_add(pTickEvent_, &tv))
+		{
+			ERROR_MSG(fmt::format("Timer::addTimer(): evtimer_add error!\n"));
+			return TIMER_HANDLE_INVALID;
+		}
 
-	if (0 != evtimer_add(timeout_ev, &tv))
+		lastTickTime_ = monotonicMs();
+	}
+
+	int32 index = allocNode();
+	Node& node = nodes_[index];
+
+	node.interval = std::max<uint32>(1, (interval + tickMs_ - 1) / tickMs_);
+	node.expire = currentTick_ + node.interval;
+	node.round = 0;
+	node.roundMax = round;
+	node.cancelled = false;
+	node.pHandler = timeout_cb;
+	node.userargs = userargs;
+
+	link(index);
+	++count_;
+
+	return ((TimerHandle)node.generation << 32) | (TimerHandle)(uint32)(index + 1);
+}
+
+//-------------------------------------------------------------------------------------
+bool Timer::delTimer(TimerHandle handle)
+{
+	Node* pNode = findNode(handle);
+	if (!pNode)
+		return false;
+
+	int32 index = (int32)(uint32)(handle & 0xffffffff) - 1;
+
+	// 正在执行回调(例如在回调中删除自己)， 回调返回后再释放
+	if (pNode->slot == SLOT_NONE)
 	{
-		event_free(timeout_ev);
-		ERROR_MSG(fmt::format("Timer::addTimer(): evtimer_add error!\n"));
+		pNode->cancelled = true;
+		return true;
+	}
+
+	unlink(index);
+	freeNode(index);
+	return true;
+}
+
+//-------------------------------------------------------------------------------------
+Timer::Node* Timer::findNode(TimerHandle handle)
+{
+	int32 index = (int32)(uint32)(handle & 0xffffffff) - 1;
+	if (index < 0 || index >= (int32)nodes_.size())
+		return NULL;
+
+	Node& node = nodes_[index];
+	if (node.generation != (uint32)(handle >> 32) || node.cancelled)
 		return NULL;
+
+	return &node;
+}
+
+//-------------------------------------------------------------------------------------
+int32 Timer::allocNode()
+{
+	int32 index = 0;
+
+	if (freeNodes_.empty())
+	{
+		index = (int32)nodes_.size();
+		nodes_.push_back(Node());
+		nodes_[index].generation = 1;
+	}
+	else
+	{
+		index = freeNodes_.back();
+		freeNodes_.pop_back();
 	}
 
-	return timeout_ev;
+	Node& node = nodes_[index];
+	node.prev = node.next = -1;
+	node.slot = SLOT_NONE;
+	return index;
 }
 
 //-------------------------------------------------------------------------------------
-bool Timer::delTimer(struct event * ev)
+void Timer::freeNode(int32 index)
 {
-	return evtimer_del(ev) == 0;
+	Node& node = nodes_[index];
+
+	// 代数加一， 旧句柄不会误删复用后的节点
+	if (++node.generation == 0)
+		node.generation = 1;
+
+	node.pHandler = nullptr;
+	node.userargs = NULL;
+	node.slot = SLOT_NONE;
+	node.cancelled = false;
+
+	freeNodes_.push_back(index);
+	--count_;
 }
 
 //-------------------------------------------------------------------------------------
-void Timer::eventHandler(evutil_socket_t fd, short events, void *ctx)
+void Timer::link(int32 index)
 {
-	cb_arg *arg = (cb_arg *)ctx;
-	Timer* pTimer = arg->pTimer;
+	Node& node = nodes_[index];
+
+	uint64 expire = std::max<uint64>(node.expire, currentTick_);
+	uint64 delta = expire - currentTick_;
 
-	++arg->round;
+	if (delta < WHEEL_ROOT_SIZE)
+	{
+		linkTo(index, (int32)(expire & (WHEEL_ROOT_SIZE - 1)));
+		return;
+	}
 
-	if (arg->roundMax >= 0 && arg->round >= arg->roundMax)
+	// 超出时间轮范围的先放在最高层， 下放时再按真实的到期时间安置
+	const uint64 maxDelta = (uint64)1 << (WHEEL_ROOT_BITS + WHEEL_LEVEL_BITS * (WHEEL_LEVELS - 1));
+	if (delta >= maxDelta)
 	{
-		event_del(arg->ev);
-		arg->pHandler(arg->userargs);
-		delete arg;
+		expire = currentTick_ + maxDelta - 1;
+		delta = maxDelta - 1;
 	}
+
+	int level = 1;
+	while (level < WHEEL_LEVELS - 1 && delta >= ((uint64)1 << (WHEEL_ROOT_BITS + WHEEL_LEVEL_BITS * level)))
+		++level;
+
+	uint32 shift = WHEEL_ROOT_BITS + WHEEL_LEVEL_BITS * (level - 1);
+	linkTo(index, WHEEL_ROOT_SIZE + (level - 1) * WHEEL_LEVEL_SIZE + (int32)((expire >> shift) & (WHEEL_LEVEL_SIZE - 1)));
+}
+
+//-------------------------------------------------------------------------------------
+void Timer::linkTo(int32 index, int32 slot)
+{
+	Node& node = nodes_[index];
+	node.slot = slot;
+	node.prev = -1;
+	node.next = slots_[slot];
+
+	if (node.next >= 0)
+		nodes_[node.next].prev = index;
+
+	slots_[slot] = index;
+}
+
+//-------------------------------------------------------------------------------------
+void Timer::unlink(int32 index)
+{
+	Node& node = nodes_[index];
+
+	if (node.prev >= 0)
+		nodes_[node.prev].next = node.next;
 	else
+		slots_[node.slot] = node.next;
+
+	if (node.next >= 0)
+		nodes_[node.next].prev = node.prev;
+
+	node.prev = node.next = -1;
+	node.slot = SLOT_NONE;
+}
+
+//-------------------------------------------------------------------------------------
+void Timer::cascade(int level, uint32 index)
+{
+	int32 slot = WHEEL_ROOT_SIZE + (level - 1) * WHEEL_LEVEL_SIZE + (int32)index;
+
+	int32 i = slots_[slot];
+	slots_[slot] = -1;
+
+	while (i >= 0)
+	{
+		int32 next = nodes_[i].next;
+		link(i);
+		i = next;
+	}
+}
+
+//-------------------------------------------------------------------------------------
+void Timer::tick()
+{
+	++currentTick_;
+
+	// 低层转完一圈时， 把上一层对应槽中的节点下放
+	uint32 index = (uint32)(currentTick_ & (WHEEL_ROOT_SIZE - 1));
+	for (int level = 1; index == 0 && level < WHEEL_LEVELS; ++level)
 	{
-		arg->pHandler(arg->userargs);
+		index = (uint32)((currentTick_ >> (WHEEL_ROOT_BITS + WHEEL_LEVEL_BITS * (level - 1))) & (WHEEL_LEVEL_SIZE - 1));
+		cascade(level, index);
 	}
+
+	int32 slot = (int32)(currentTick_ & (WHEEL_ROOT_SIZE - 1));
+	if (slots_[slot] < 0)
+		return;
+
+	// 整个槽移到待执行列表， 回调中删除其它到期的定时器时也能正确摘除
+	slots_[SLOT_PENDING] = slots_[slot];
+	slots_[slot] = -1;
+
+	for (int32 i = slots_[SLOT_PENDING]; i >= 0; i = nodes_[i].next)
+		nodes_[i].slot = SLOT_PENDING;
+
+	while (slots_[SLOT_PENDING] >= 0)
+	{
+		int32 i = slots_[SLOT_PENDING];
+		unlink(i);
+
+		Node& node = nodes_[i];
+		++node.round;
+
+		node.pHandler(node.userargs);
+
+		if (node.cancelled || (node.roundMax >= 0 && node.round >= node.roundMax))
+		{
+			freeNode(i);
+		}
+		else
+		{
+			node.expire = currentTick_ + node.interval;
+			link(i);
+		}
+	}
+}
+
+//-------------------------------------------------------------------------------------
+void Timer::onTick()
+{
+	uint64 now = monotonicMs();
+	if (now < lastTickTime_ + tickMs_)
+		return;
+
+	// 事件循环被阻塞时一次补上落下的tick
+	uint64 ticks = (now - lastTickTime_) / tickMs_;
+	lastTickTime_ += ticks * tickMs_;
+
+	while (ticks > 0 && count_ > 0)
+	{
+		tick();
+		--ticks;
+	}
+
+	if (count_ == 0)
+	{
+		currentTick_ += ticks;
+		event_del(pTickEvent_);
+	}
+}
+
+//-------------------------------------------------------------------------------------
+void Timer::tickCallback(evutil_socket_t fd, short events, void *ctx)
+{
+	Timer* pTimer = (Timer *)ctx;
+	pTimer->onTick();
 }
 
 //-------------------------------------------------------------------------------------
@@ -7,6 +7,15 @@ namespace XServer {
 
 class EventDispatcher;
 
+// 低32位为节点索引+1， 高32位为节点的代数， 节点复用后旧句柄自动失效
+typedef uint64 TimerHandle;
+
+#define TIMER_HANDLE_INVALID 0
+
+/*
+	分层时间轮， 所有定时器共用一个libevent定时事件驱动
+	第0层256个槽， 1~3层各64个槽， 添加和删除都是O(1)， 节点放在池中复用
+*/
 class Timer
 {
 public:
@@ -14,28 +23,89 @@ public:
 
 	typedef std::function<void(void*)> TimerHandler;
 
-	struct cb_arg
+	enum
 	{
-		struct event *ev;
-		struct timeval tv;
-		void* userargs;
-		Timer* pTimer;
-		TimerHandler pHandler;
+		WHEEL_LEVELS = 4,
+		WHEEL_ROOT_BITS = 8,
+		WHEEL_LEVEL_BITS = 6,
+		WHEEL_ROOT_SIZE = 1 << WHEEL_ROOT_BITS,
+		WHEEL_LEVEL_SIZE = 1 << WHEEL_LEVEL_BITS,
+		WHEEL_SLOTS = WHEEL_ROOT_SIZE + (WHEEL_LEVELS - 1) * WHEEL_LEVEL_SIZE,
+
+		// 到期的节点先移到这里再逐个执行， 执行中的节点不在任何槽中
+		SLOT_PENDING = WHEEL_SLOTS,
+		SLOT_NONE = WHEEL_SLOTS + 1,
+	};
+
+	struct Node
+	{
+		int32 prev, next;
+		int32 slot;
+		uint32 generation;
+
+		uint64 expire;
+		uint32 interval;
 		int round, roundMax;
+
+		bool cancelled;
+
+		TimerHandler pHandler;
+		void* userargs;
 	};
 
 public:
-	Timer(EventDispatcher* pEventDispatcher);
+	// tickMs为时间轮的精度， 定时时间向上取整到tickMs的整数倍
+	// priority为驱动时间轮的事件的优先级(EventPriority)， -1为默认
+	Timer(EventDispatcher* pEventDispatcher, uint32 tickMs = 10, int priority = -1);
 	virtual ~Timer();
 
-	struct event* addTimer(uint32_t interval, int round, TimerHandler timeout_cb, void* userargs);
-	bool delTimer(struct event * ev);
+	// round为触发次数， -1表示一直触发直到被删除
+	TimerHandle addTimer(uint32 interval, int round, TimerHandler timeout_cb, void* userargs);
+	bool delTimer(TimerHandle handle);
+
+	size_t size() const {
+		return count_;
+	}
+
+	uint32 tickMs() const {
+		return tickMs_;
+	}
 
 private:
-	static void eventHandler(evutil_socket_t fd, short events, void *ctx);
+	static void tickCallback(evutil_socket_t fd, short events, void *ctx);
+
+	void onTick();
+	void tick();
+	void cascade(int level, uint32 index);
+
+	int32 allocNode();
+	void freeNode(int32 index);
+
+	void link(int32 index);
+	void linkTo(int32 index, int32 slot);
+	void unlink(int32 index);
+
+	Node* findNode(TimerHandle handle);
+
+	static uint64 monotonicMs();
 
 protected:
 	EventDispatcher* pEventDispatcher_;
+
+	struct event* pTickEvent_;
+	uint32 tickMs_;
+
+	// 已经处理过的tick数， 以及对应的时间
+	uint64 currentTick_;
+	uint64 lastTickTime_;
+
+	int32 slots_[WHEEL_SLOTS + 1];
+
+	// deque扩容时已有元素的地址不变， 回调中添加定时器是安全的
+	std::deque<Node> nodes_;
+	std::vector<int32> freeNodes_;
+
+	size_t count_;
 };
 
 }
@@ -5,23 +5,213 @@
 
 namespace XServer {
 
-#pragma pack(push, 1)
+// 包头的版本， 在Hello/HelloCB中协商， 未协商时使用版本1
+enum FrameVersion
+{
+	FRAME_VERSION_1 = 1,	// msglen(2) | msgcmd(2)
+	FRAME_VERSION_2 = 2,	// msglen(4) | msgcmd(2) | flags(1) | reserved(1)
+	FRAME_VERSION_MAX = FRAME_VERSION_2,
+};
+
+// 版本2包头中的标记
+enum FrameFlags
+{
+	FRAME_FLAG_COMPRESSED = 0x01,	// 包体已压缩
+	FRAME_FLAG_BATCH = 0x02,		// 包体中是多个包
+	FRAME_FLAG_MORE = 0x08,			// 大包的一部分， 后面还有同一个包的帧
+
+	// 收到带有其他位的帧时断开连接， 新增标记时必须加到这里
+	FRAME_FLAGS_KNOWN = FRAME_FLAG_COMPRESSED | FRAME_FLAG_BATCH | FRAME_FLAG_MORE,
+};
+
+#define PACKET_HEADER_SIZE_MAX 8
+
+// 合并帧(FRAME_FLAG_BATCH)的包体中每个包前的头: msglen(4) | msgcmd(2)
+#define BATCH_ENTRY_HEADER_SIZE 6
+
+// 解码后的包头， 网络上的格式由版本决定
 struct PacketHeader
 {
-	uint16 msglen;
+	uint32 msglen;
+	uint16 msgcmd;
+	uint8 flags;
+
+	static inline uint32 size(uint8 version) {
+		return version >= FRAME_VERSION_2 ? 8 : 4;
+	}
+
+	static inline uint32 lengthMax(uint8 version) {
+		return version >= FRAME_VERSION_2 ? FRAME_LENGTH_MAX : PACKET_LENGTH_MAX;
+	}
+
+	inline void encode(uint8 version, uint8* dest) const {
+		if (version >= FRAME_VERSION_2)
+		{
+			uint32 len = htonl(msglen);
+			uint16 cmd = htons(msgcmd);
+			memcpy(dest, &len, 4);
+			memcpy(dest + 4, &cmd, 2);
+			dest[6] = flags;
+			dest[7] = 0;
+		}
+		else
+		{
+			uint16 len = htons((uint16)msglen);
+			uint16 cmd = htons(msgcmd);
+			memcpy(dest, &len, 2);
+			memcpy(dest + 2, &cmd, 2);
+		}
+	}
+
+	inline void decode(uint8 version, const uint8* src) {
+		if (version >= FRAME_VERSION_2)
+		{
+			uint32 len;
+			uint16 cmd;
+			memcpy(&len, src, 4);
+			memcpy(&cmd, src + 4, 2);
+			msglen = ntohl(len);
+			msgcmd = ntohs(cmd);
+			flags = src[6];
+		}
+		else
+		{
+			uint16 len;
+			uint16 cmd;
+			memcpy(&len, src, 2);
+			memcpy(&cmd, src + 2, 2);
+			msglen = ntohs(len);
+			msgcmd = ntohs(cmd);
+			flags = 0;
+		}
+	}
+};
+
+/*
+	服务器之间转发客户端的包(CMD::ForwardFrame)， 包体: requestorID(8) | msgcmd(2) | 原始包体
+	connector收发时只移动包体的字节， 不做protobuf编解码
+*/
+struct ForwardEnvelope
+{
+	enum
+	{
+		SIZE = 10,
+	};
+
+	uint64 requestorID;
+	uint16 msgcmd;
+
+	inline void encode(uint8* dest) const {
+		for (int i = 7; i >= 0; --i)
+			dest[7 - i] = (uint8)(requestorID >> (i * 8));
+
+		uint16 cmd = htons(msgcmd);
+		memcpy(dest + 8, &cmd, 2);
+	}
+
+	inline void decode(const uint8* src) {
+		requestorID = 0;
+		for (int i = 0; i < 8; ++i)
+			requestorID = (requestorID << 8) | src[i];
+
+		uint16 cmd;
+		memcpy(&cmd, src + 8, 2);
+		msgcmd = ntohs(cmd);
+	}
+};
+
+// 组播的目标， 其余的组ID保留
+#define MULTICAST_GROUP_NONE 0ULL					// 只发给列出的requestor
+#define MULTICAST_GROUP_ALL 0xffffffffffffffffULL	// connector上绑定到发送方的所有客户端
+
+/*
+	服务器发给connector的组播帧(CMD::MulticastFrame)， 包体:
+	groupID(8) | msgcmd(2) | count(2) | requestorID(8) * count | 原始包体
+*/
+struct MulticastEnvelope
+{
+	enum
+	{
+		HEADER_SIZE = 12,
+		REQUESTORS_MAX = 0xffff,
+	};
+
+	uint64 groupID;
 	uint16 msgcmd;
+	uint16 count;
+
+	static inline void encodeID(uint64 id, uint8* dest) {
+		for (int i = 7; i >= 0; --i)
+			dest[7 - i] = (uint8)(id >> (i * 8));
+	}
+
+	static inline uint64 decodeID(const uint8* src) {
+		uint64 id = 0;
+		for (int i = 0; i < 8; ++i)
+			id = (id << 8) | src[i];
 
-	inline void encode() {
-		msglen = htons(msglen);
-		msgcmd = htons(msgcmd);
+		return id;
 	}
 
-	inline void decode() {
-		msglen = ntohs(msglen);
-		msgcmd = htons(msgcmd);
+	inline void encode(uint8* dest) const {
+		encodeID(groupID, dest);
+
+		uint16 cmd = htons(msgcmd);
+		uint16 num = htons(count);
+		memcpy(dest + 8, &cmd, 2);
+		memcpy(dest + 10, &num, 2);
 	}
+
+	inline void decode(const uint8* src) {
+		groupID = decodeID(src);
+
+		uint16 cmd, num;
+		memcpy(&cmd, src + 8, 2);
+		memcpy(&num, src + 10, 2);
+		msgcmd = ntohs(cmd);
+		count = ntohs(num);
+	}
+};
+
+// 发送队列超过上限后的处理策略
+enum SendQueuePolicy
+{
+	SENDQUEUE_POLICY_DROP_SESSION = 0,		// 断开session
+	SENDQUEUE_POLICY_DROP_DROPPABLE = 1,	// 丢弃可丢弃的包， 超过两倍上限时断开
+	SENDQUEUE_POLICY_PAUSE_UPSTREAM = 2,	// 暂停往这里写数据的来源(应用指定的session或者对端)， 超过两倍上限时断开
+};
+
+// 同一条链路上的发送优先级， 数值小的先发， 同一优先级内保持顺序
+enum SendPriority
+{
+	SEND_PRIORITY_CONTROL = 0,		// 握手、 心跳、 服务器信息等链路本身的包
+	SEND_PRIORITY_INTERACTIVE = 1,	// 直接发送的请求和回应， 以及匹配等关键的转发包
+	SEND_PRIORITY_BULK = 2,			// 其余转发和组播的包
+	SEND_PRIORITY_MAX = 3
+};
+
+// 包体压缩算法， 在Hello中协商， 只用于版本2以上的包头(需要FRAME_FLAG_COMPRESSED)
+enum PacketCompression
+{
+	PACKET_COMPRESSION_NONE = 0,
+	PACKET_COMPRESSION_LZ = 1,		// LZ77类快速压缩， 可以带预置字典
+};
+
+// socket收发使用的后端， 见ResMgr::ServerConfig::ioBackend
+enum IOBackend
+{
+	IO_BACKEND_LIBEVENT = 0,		// libevent自己选择的后端， linux上是epoll
+	IO_BACKEND_URING = 1,			// io_uring， 需要linux 6.0以上， 不可用时退回libevent
+};
+
+// 链路加密算法， 在Hello中协商， 只用于版本2以上的包头
+enum CipherType
+{
+	CIPHER_NONE = 0,
+	CIPHER_AES_128_GCM = 1,			// 有AES-NI的服务器和PC
+	CIPHER_CHACHA20_POLY1305 = 2,	// 没有AES硬件指令的移动设备
+	CIPHER_MAX = CIPHER_CHACHA20_POLY1305,
 };
-#pragma pack(pop)
 
 }
 
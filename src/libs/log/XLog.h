@@ -28,11 +28,11 @@ protected:
 };
 
 
-#define PRINT_MSG(m)				XServer::XLog::getSingleton().print_msg((m))								// κϢ
-#define ERROR_MSG(m)				XServer::XLog::getSingleton().error_msg((m))								// һ
-#define DEBUG_MSG(m)				XServer::XLog::getSingleton().debug_msg((m))								// һdebugϢ
-#define INFO_MSG(m)					XServer::XLog::getSingleton().info_msg((m))								// һinfoϢ
-#define WARNING_MSG(m)				XServer::XLog::getSingleton().warning_msg((m))							// һϢ
+#define PRINT_MSG(m)				XServer::XLog::getSingleton().print_msg((m))								// 输出任何信息
+#define ERROR_MSG(m)				XServer::XLog::getSingleton().error_msg((m))								// 输出一个错误
+#define DEBUG_MSG(m)				XServer::XLog::getSingleton().debug_msg((m))								// 输出一个debug信息
+#define INFO_MSG(m)					XServer::XLog::getSingleton().info_msg((m))								// 输出一个info信息
+#define WARNING_MSG(m)				XServer::XLog::getSingleton().warning_msg((m))							// 输出一个警告信息
 	
 }
 
@@ -22,6 +22,8 @@ class CMD_HelloDefaultTypeInternal : public ::google::protobuf::internal::Explic
 } _CMD_Hello_default_instance_;
 class CMD_HelloCBDefaultTypeInternal : public ::google::protobuf::internal::ExplicitlyConstructed<CMD_HelloCB> {
 } _CMD_HelloCB_default_instance_;
+class CMD_FrameUpgradeDefaultTypeInternal : public ::google::protobuf::internal::ExplicitlyConstructed<CMD_FrameUpgrade> {
+} _CMD_FrameUpgrade_default_instance_;
 class CMD_HeartbeatDefaultTypeInternal : public ::google::protobuf::internal::ExplicitlyConstructed<CMD_Heartbeat> {
 } _CMD_Heartbeat_default_instance_;
 class CMD_HeartbeatCBDefaultTypeInternal : public ::google::protobuf::internal::ExplicitlyConstructed<CMD_HeartbeatCB> {
@@ -34,6 +36,8 @@ class CMD_QueryServerInfosDefaultTypeInternal : public ::google::protobuf::inter
 } _CMD_QueryServerInfos_default_instance_;
 class CMD_QueryServerInfosCBDefaultTypeInternal : public ::google::protobuf::internal::ExplicitlyConstructed<CMD_QueryServerInfosCB> {
 } _CMD_QueryServerInfosCB_default_instance_;
+class CMD_ShmAttachDefaultTypeInternal : public ::google::protobuf::internal::ExplicitlyConstructed<CMD_ShmAttach> {
+} _CMD_ShmAttach_default_instance_;
 class CMD_PingDefaultTypeInternal : public ::google::protobuf::internal::ExplicitlyConstructed<CMD_Ping> {
 } _CMD_Ping_default_instance_;
 class CMD_PongDefaultTypeInternal : public ::google::protobuf::internal::ExplicitlyConstructed<CMD_Pong> {
@@ -138,7 +142,7 @@ namespace protobuf_Commands_2eproto {
 
 namespace {
 
-::google::protobuf::Metadata file_level_metadata[58];
+::google::protobuf::Metadata file_level_metadata[60];
 const ::google::protobuf::EnumDescriptor* file_level_enum_descriptors[1];
 
 }  // namespace
@@ -157,6 +161,14 @@ const ::google::protobuf::uint32 TableStruct::offsets[] = {
   GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CMD_Hello, apptype_),
   GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CMD_Hello, appgid_),
   GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CMD_Hello, name_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CMD_Hello, frameversion_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CMD_Hello, compression_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CMD_Hello, compressdict_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CMD_Hello, ciphers_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CMD_Hello, cipherkey_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CMD_Hello, batch_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CMD_Hello, hostid_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CMD_Hello, link_),
   ~0u,  // no _has_bits_
   GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CMD_HelloCB, _internal_metadata_),
   ~0u,  // no _extensions_
@@ -166,6 +178,18 @@ const ::google::protobuf::uint32 TableStruct::offsets[] = {
   GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CMD_HelloCB, apptype_),
   GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CMD_HelloCB, appgid_),
   GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CMD_HelloCB, name_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CMD_HelloCB, frameversion_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CMD_HelloCB, compression_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CMD_HelloCB, compressdict_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CMD_HelloCB, cipher_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CMD_HelloCB, cipherkey_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CMD_HelloCB, batch_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CMD_HelloCB, shmname_),
+  ~0u,  // no _has_bits_
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CMD_FrameUpgrade, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CMD_FrameUpgrade, version_),
   ~0u,  // no _has_bits_
   GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CMD_Heartbeat, _internal_metadata_),
   ~0u,  // no _extensions_
@@ -201,6 +225,7 @@ const ::google::protobuf::uint32 TableStruct::offsets[] = {
   GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CMD_UpdateServerInfos, appgid_),
   GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CMD_UpdateServerInfos, name_),
   GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CMD_UpdateServerInfos, child_srvs_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CMD_UpdateServerInfos, hostid_),
   ~0u,  // no _has_bits_
   GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CMD_QueryServerInfos, _internal_metadata_),
   ~0u,  // no _extensions_
@@ -215,6 +240,11 @@ const ::google::protobuf::uint32 TableStruct::offsets[] = {
   ~0u,  // no _oneof_case_
   GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CMD_QueryServerInfosCB, srvs_),
   ~0u,  // no _has_bits_
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CMD_ShmAttach, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CMD_ShmAttach, ok_),
+  ~0u,  // no _has_bits_
   GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CMD_Ping, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
@@ -271,6 +301,7 @@ const ::google::protobuf::uint32 TableStruct::offsets[] = {
   GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CMD_Login_OnSigninCB, datas_),
   GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CMD_Login_OnSigninCB, foundobjectid_),
   GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CMD_Login_OnSigninCB, foundappid_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CMD_Login_OnSigninCB, hallsid_),
   ~0u,  // no _has_bits_
   GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CMD_Login_OnRequestAllocClientCB, _internal_metadata_),
   ~0u,  // no _extensions_
@@ -280,6 +311,7 @@ const ::google::protobuf::uint32 TableStruct::offsets[] = {
   GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CMD_Login_OnRequestAllocClientCB, commitaccountname_),
   GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CMD_Login_OnRequestAllocClientCB, errcode_),
   GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CMD_Login_OnRequestAllocClientCB, tokenid_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CMD_Login_OnRequestAllocClientCB, hallsid_),
   ~0u,  // no _has_bits_
   GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CMD_Dbmgr_WriteAccount, _internal_metadata_),
   ~0u,  // no _extensions_
@@ -437,6 +469,7 @@ const ::google::protobuf::uint32 TableStruct::offsets[] = {
   GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CMD_Hallsmgr_OnRequestAllocClientCB, errcode_),
   GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CMD_Hallsmgr_OnRequestAllocClientCB, loginsessionid_),
   GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CMD_Hallsmgr_OnRequestAllocClientCB, tokenid_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CMD_Hallsmgr_OnRequestAllocClientCB, hallsid_),
   ~0u,  // no _has_bits_
   GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CMD_RoomPlayerInfo, _internal_metadata_),
   ~0u,  // no _extensions_
@@ -544,6 +577,7 @@ const ::google::protobuf::uint32 TableStruct::offsets[] = {
   GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CMD_Client_OnSigninCB, addr_),
   GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CMD_Client_OnSigninCB, port_),
   GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CMD_Client_OnSigninCB, tokenid_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CMD_Client_OnSigninCB, hallsid_),
   ~0u,  // no _has_bits_
   GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CMD_PlayerContext, _internal_metadata_),
   ~0u,  // no _extensions_
@@ -601,7 +635,6 @@ const ::google::protobuf::uint32 TableStruct::offsets[] = {
   GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CMD_Client_OnLoginCB, errcode_),
   GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CMD_Client_OnLoginCB, datas_),
   GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CMD_Client_OnLoginCB, playercontext_),
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CMD_Client_OnLoginCB, hallsid_),
   ~0u,  // no _has_bits_
   GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CMD_Client_OnMatchingUpdate, _internal_metadata_),
   ~0u,  // no _extensions_
@@ -644,74 +677,78 @@ const ::google::protobuf::uint32 TableStruct::offsets[] = {
 static const ::google::protobuf::internal::MigrationSchema schemas[] = {
   { 0, -1, sizeof(CMD_Unkown)},
   { 4, -1, sizeof(CMD_Hello)},
-  { 13, -1, sizeof(CMD_HelloCB)},
-  { 22, -1, sizeof(CMD_Heartbeat)},
-  { 28, -1, sizeof(CMD_HeartbeatCB)},
-  { 34, -1, sizeof(CMD_Version_Not_Match)},
-  { 41, -1, sizeof(CMD_UpdateServerInfos)},
-  { 57, -1, sizeof(CMD_QueryServerInfos)},
-  { 65, -1, sizeof(CMD_QueryServerInfosCB)},
-  { 70, -1, sizeof(CMD_Ping)},
-  { 75, -1, sizeof(CMD_Pong)},
-  { 80, -1, sizeof(CMD_ForwardPacket)},
-  { 87, -1, sizeof(CMD_RemoteDisconnected)},
-  { 91, -1, sizeof(CMD_Directory_ListServers)},
-  { 95, -1, sizeof(CMD_Login_Signup)},
-  { 102, -1, sizeof(CMD_Login_OnSignupCB)},
-  { 110, -1, sizeof(CMD_Login_Signin)},
-  { 117, -1, sizeof(CMD_Login_OnSigninCB)},
-  { 127, -1, sizeof(CMD_Login_OnRequestAllocClientCB)},
-  { 136, -1, sizeof(CMD_Dbmgr_WriteAccount)},
-  { 148, -1, sizeof(CMD_Dbmgr_QueryAccount)},
-  { 158, -1, sizeof(CMD_Dbmgr_UpdateAccountData)},
-  { 167, -1, sizeof(CMD_Dbmgr_WritePlayerGameData)},
-  { 178, -1, sizeof(CMD_Dbmgr_QueryPlayerGameData)},
-  { 185, -1, sizeof(CMD_Halls_PlayerGameData)},
-  { 193, -1, sizeof(CMD_Halls_Login)},
-  { 201, -1, sizeof(CMD_Halls_RequestAllocClient)},
-  { 210, -1, sizeof(CMD_Halls_StartMatch)},
-  { 216, -1, sizeof(CMD_Halls_CancelMatch)},
-  { 220, -1, sizeof(CMD_Halls_OnRequestCreateRoomCB)},
-  { 229, -1, sizeof(CMD_Halls_OnRoomSrvGameOverReport)},
-  { 236, -1, sizeof(CMD_Halls_OnQueryAccountCB)},
-  { 249, -1, sizeof(CMD_Halls_OnQueryPlayerGameDataCB)},
-  { 261, -1, sizeof(CMD_Halls_QueryPlayerGameData)},
-  { 267, -1, sizeof(CMD_Halls_ListGames)},
-  { 274, -1, sizeof(CMD_Hallsmgr_RequestAllocClient)},
-  { 283, -1, sizeof(CMD_Hallsmgr_OnRequestAllocClientCB)},
-  { 293, -1, sizeof(CMD_RoomPlayerInfo)},
-  { 306, -1, sizeof(CMD_Roommgr_RequestCreateRoom)},
-  { 319, -1, sizeof(CMD_Roommgr_OnRequestCreateRoomCB)},
-  { 329, -1, sizeof(CMD_Roommgr_OnRoomSrvGameOverReport)},
-  { 337, -1, sizeof(CMD_Machine_RequestCreateRoom)},
-  { 353, -1, sizeof(CMD_Machine_RoomSrvReportAddr)},
-  { 362, -1, sizeof(CMD_Machine_OnRoomSrvGameOverReport)},
-  { 370, -1, sizeof(CMD_ListServersInfo)},
-  { 379, -1, sizeof(CMD_Client_OnListServersCB)},
-  { 385, -1, sizeof(CMD_Client_OnSignupCB)},
-  { 391, -1, sizeof(CMD_Client_OnSigninCB)},
-  { 400, -1, sizeof(CMD_PlayerContext)},
-  { 418, -1, sizeof(CMD_Client_UpdatePlayerContext)},
-  { 423, -1, sizeof(CMD_GameModeInfos)},
-  { 431, -1, sizeof(CMD_GameInfos)},
-  { 442, -1, sizeof(CMD_Client_OnListGamesCB)},
-  { 450, -1, sizeof(CMD_Client_OnLoginCB)},
-  { 458, -1, sizeof(CMD_Client_OnMatchingUpdate)},
-  { 466, -1, sizeof(CMD_Client_OnEndMatch)},
-  { 482, -1, sizeof(CMD_Client_OnGameOver)},
-  { 490, -1, sizeof(CMD_Client_OnCancelMatch)},
+  { 21, -1, sizeof(CMD_HelloCB)},
+  { 37, -1, sizeof(CMD_FrameUpgrade)},
+  { 42, -1, sizeof(CMD_Heartbeat)},
+  { 48, -1, sizeof(CMD_HeartbeatCB)},
+  { 54, -1, sizeof(CMD_Version_Not_Match)},
+  { 61, -1, sizeof(CMD_UpdateServerInfos)},
+  { 78, -1, sizeof(CMD_QueryServerInfos)},
+  { 86, -1, sizeof(CMD_QueryServerInfosCB)},
+  { 91, -1, sizeof(CMD_ShmAttach)},
+  { 96, -1, sizeof(CMD_Ping)},
+  { 101, -1, sizeof(CMD_Pong)},
+  { 106, -1, sizeof(CMD_ForwardPacket)},
+  { 113, -1, sizeof(CMD_RemoteDisconnected)},
+  { 117, -1, sizeof(CMD_Directory_ListServers)},
+  { 121, -1, sizeof(CMD_Login_Signup)},
+  { 128, -1, sizeof(CMD_Login_OnSignupCB)},
+  { 136, -1, sizeof(CMD_Login_Signin)},
+  { 143, -1, sizeof(CMD_Login_OnSigninCB)},
+  { 154, -1, sizeof(CMD_Login_OnRequestAllocClientCB)},
+  { 164, -1, sizeof(CMD_Dbmgr_WriteAccount)},
+  { 176, -1, sizeof(CMD_Dbmgr_QueryAccount)},
+  { 186, -1, sizeof(CMD_Dbmgr_UpdateAccountData)},
+  { 195, -1, sizeof(CMD_Dbmgr_WritePlayerGameData)},
+  { 206, -1, sizeof(CMD_Dbmgr_QueryPlayerGameData)},
+  { 213, -1, sizeof(CMD_Halls_PlayerGameData)},
+  { 221, -1, sizeof(CMD_Halls_Login)},
+  { 229, -1, sizeof(CMD_Halls_RequestAllocClient)},
+  { 238, -1, sizeof(CMD_Halls_StartMatch)},
+  { 244, -1, sizeof(CMD_Halls_CancelMatch)},
+  { 248, -1, sizeof(CMD_Halls_OnRequestCreateRoomCB)},
+  { 257, -1, sizeof(CMD_Halls_OnRoomSrvGameOverReport)},
+  { 264, -1, sizeof(CMD_Halls_OnQueryAccountCB)},
+  { 277, -1, sizeof(CMD_Halls_OnQueryPlayerGameDataCB)},
+  { 289, -1, sizeof(CMD_Halls_QueryPlayerGameData)},
+  { 295, -1, sizeof(CMD_Halls_ListGames)},
+  { 302, -1, sizeof(CMD_Hallsmgr_RequestAllocClient)},
+  { 311, -1, sizeof(CMD_Hallsmgr_OnRequestAllocClientCB)},
+  { 322, -1, sizeof(CMD_RoomPlayerInfo)},
+  { 335, -1, sizeof(CMD_Roommgr_RequestCreateRoom)},
+  { 348, -1, sizeof(CMD_Roommgr_OnRequestCreateRoomCB)},
+  { 358, -1, sizeof(CMD_Roommgr_OnRoomSrvGameOverReport)},
+  { 366, -1, sizeof(CMD_Machine_RequestCreateRoom)},
+  { 382, -1, sizeof(CMD_Machine_RoomSrvReportAddr)},
+  { 391, -1, sizeof(CMD_Machine_OnRoomSrvGameOverReport)},
+  { 399, -1, sizeof(CMD_ListServersInfo)},
+  { 408, -1, sizeof(CMD_Client_OnListServersCB)},
+  { 414, -1, sizeof(CMD_Client_OnSignupCB)},
+  { 420, -1, sizeof(CMD_Client_OnSigninCB)},
+  { 430, -1, sizeof(CMD_PlayerContext)},
+  { 448, -1, sizeof(CMD_Client_UpdatePlayerContext)},
+  { 453, -1, sizeof(CMD_GameModeInfos)},
+  { 461, -1, sizeof(CMD_GameInfos)},
+  { 472, -1, sizeof(CMD_Client_OnListGamesCB)},
+  { 480, -1, sizeof(CMD_Client_OnLoginCB)},
+  { 487, -1, sizeof(CMD_Client_OnMatchingUpdate)},
+  { 495, -1, sizeof(CMD_Client_OnEndMatch)},
+  { 511, -1, sizeof(CMD_Client_OnGameOver)},
+  { 519, -1, sizeof(CMD_Client_OnCancelMatch)},
 };
 
 static ::google::protobuf::Message const * const file_default_instances[] = {
   reinterpret_cast<const ::google::protobuf::Message*>(&_CMD_Unkown_default_instance_),
   reinterpret_cast<const ::google::protobuf::Message*>(&_CMD_Hello_default_instance_),
   reinterpret_cast<const ::google::protobuf::Message*>(&_CMD_HelloCB_default_instance_),
+  reinterpret_cast<const ::google::protobuf::Message*>(&_CMD_FrameUpgrade_default_instance_),
   reinterpret_cast<const ::google::protobuf::Message*>(&_CMD_Heartbeat_default_instance_),
   reinterpret_cast<const ::google::protobuf::Message*>(&_CMD_HeartbeatCB_default_instance_),
   reinterpret_cast<const ::google::protobuf::Message*>(&_CMD_Version_Not_Match_default_instance_),
   reinterpret_cast<const ::google::protobuf::Message*>(&_CMD_UpdateServerInfos_default_instance_),
   reinterpret_cast<const ::google::protobuf::Message*>(&_CMD_QueryServerInfos_default_instance_),
   reinterpret_cast<const ::google::protobuf::Message*>(&_CMD_QueryServerInfosCB_default_instance_),
+  reinterpret_cast<const ::google::protobuf::Message*>(&_CMD_ShmAttach_default_instance_),
   reinterpret_cast<const ::google::protobuf::Message*>(&_CMD_Ping_default_instance_),
   reinterpret_cast<const ::google::protobuf::Message*>(&_CMD_Pong_default_instance_),
   reinterpret_cast<const ::google::protobuf::Message*>(&_CMD_ForwardPacket_default_instance_),
@@ -781,7 +818,7 @@ void protobuf_AssignDescriptorsOnce() {
 void protobuf_RegisterTypes(const ::std::string&) GOOGLE_ATTRIBUTE_COLD;
 void protobuf_RegisterTypes(const ::std::string&) {
   protobuf_AssignDescriptorsOnce();
-  ::google::protobuf::internal::RegisterAllTypes(file_level_metadata, 58);
+  ::google::protobuf::internal::RegisterAllTypes(file_level_metadata, 60);
 }
 
 }  // namespace
@@ -793,116 +830,120 @@ void TableStruct::Shutdown() {
   delete file_level_metadata[1].reflection;
   _CMD_HelloCB_default_instance_.Shutdown();
   delete file_level_metadata[2].reflection;
-  _CMD_Heartbeat_default_instance_.Shutdown();
+  _CMD_FrameUpgrade_default_instance_.Shutdown();
   delete file_level_metadata[3].reflection;
-  _CMD_HeartbeatCB_default_instance_.Shutdown();
+  _CMD_Heartbeat_default_instance_.Shutdown();
   delete file_level_metadata[4].reflection;
-  _CMD_Version_Not_Match_default_instance_.Shutdown();
+  _CMD_HeartbeatCB_default_instance_.Shutdown();
   delete file_level_metadata[5].reflection;
-  _CMD_UpdateServerInfos_default_instance_.Shutdown();
+  _CMD_Version_Not_Match_default_instance_.Shutdown();
   delete file_level_metadata[6].reflection;
-  _CMD_QueryServerInfos_default_instance_.Shutdown();
+  _CMD_UpdateServerInfos_default_instance_.Shutdown();
   delete file_level_metadata[7].reflection;
-  _CMD_QueryServerInfosCB_default_instance_.Shutdown();
+  _CMD_QueryServerInfos_default_instance_.Shutdown();
   delete file_level_metadata[8].reflection;
-  _CMD_Ping_default_instance_.Shutdown();
+  _CMD_QueryServerInfosCB_default_instance_.Shutdown();
   delete file_level_metadata[9].reflection;
-  _CMD_Pong_default_instance_.Shutdown();
+  _CMD_ShmAttach_default_instance_.Shutdown();
   delete file_level_metadata[10].reflection;
-  _CMD_ForwardPacket_default_instance_.Shutdown();
+  _CMD_Ping_default_instance_.Shutdown();
   delete file_level_metadata[11].reflection;
-  _CMD_RemoteDisconnected_default_instance_.Shutdown();
+  _CMD_Pong_default_instance_.Shutdown();
   delete file_level_metadata[12].reflection;
-  _CMD_Directory_ListServers_default_instance_.Shutdown();
+  _CMD_ForwardPacket_default_instance_.Shutdown();
   delete file_level_metadata[13].reflection;
-  _CMD_Login_Signup_default_instance_.Shutdown();
+  _CMD_RemoteDisconnected_default_instance_.Shutdown();
   delete file_level_metadata[14].reflection;
-  _CMD_Login_OnSignupCB_default_instance_.Shutdown();
+  _CMD_Directory_ListServers_default_instance_.Shutdown();
   delete file_level_metadata[15].reflection;
-  _CMD_Login_Signin_default_instance_.Shutdown();
+  _CMD_Login_Signup_default_instance_.Shutdown();
   delete file_level_metadata[16].reflection;
-  _CMD_Login_OnSigninCB_default_instance_.Shutdown();
+  _CMD_Login_OnSignupCB_default_instance_.Shutdown();
   delete file_level_metadata[17].reflection;
-  _CMD_Login_OnRequestAllocClientCB_default_instance_.Shutdown();
+  _CMD_Login_Signin_default_instance_.Shutdown();
   delete file_level_metadata[18].reflection;
-  _CMD_Dbmgr_WriteAccount_default_instance_.Shutdown();
+  _CMD_Login_OnSigninCB_default_instance_.Shutdown();
   delete file_level_metadata[19].reflection;
-  _CMD_Dbmgr_QueryAccount_default_instance_.Shutdown();
+  _CMD_Login_OnRequestAllocClientCB_default_instance_.Shutdown();
   delete file_level_metadata[20].reflection;
-  _CMD_Dbmgr_UpdateAccountData_default_instance_.Shutdown();
+  _CMD_Dbmgr_WriteAccount_default_instance_.Shutdown();
   delete file_level_metadata[21].reflection;
-  _CMD_Dbmgr_WritePlayerGameData_default_instance_.Shutdown();
+  _CMD_Dbmgr_QueryAccount_default_instance_.Shutdown();
   delete file_level_metadata[22].reflection;
-  _CMD_Dbmgr_QueryPlayerGameData_default_instance_.Shutdown();
+  _CMD_Dbmgr_UpdateAccountData_default_instance_.Shutdown();
   delete file_level_metadata[23].reflection;
-  _CMD_Halls_PlayerGameData_default_instance_.Shutdown();
+  _CMD_Dbmgr_WritePlayerGameData_default_instance_.Shutdown();
   delete file_level_metadata[24].reflection;
-  _CMD_Halls_Login_default_instance_.Shutdown();
+  _CMD_Dbmgr_QueryPlayerGameData_default_instance_.Shutdown();
   delete file_level_metadata[25].reflection;
-  _CMD_Halls_RequestAllocClient_default_instance_.Shutdown();
+  _CMD_Halls_PlayerGameData_default_instance_.Shutdown();
   delete file_level_metadata[26].reflection;
-  _CMD_Halls_StartMatch_default_instance_.Shutdown();
+  _CMD_Halls_Login_default_instance_.Shutdown();
   delete file_level_metadata[27].reflection;
-  _CMD_Halls_CancelMatch_default_instance_.Shutdown();
+  _CMD_Halls_RequestAllocClient_default_instance_.Shutdown();
   delete file_level_metadata[28].reflection;
-  _CMD_Halls_OnRequestCreateRoomCB_default_instance_.Shutdown();
+  _CMD_Halls_StartMatch_default_instance_.Shutdown();
   delete file_level_metadata[29].reflection;
-  _CMD_Halls_OnRoomSrvGameOverReport_default_instance_.Shutdown();
+  _CMD_Halls_CancelMatch_default_instance_.Shutdown();
   delete file_level_metadata[30].reflection;
-  _CMD_Halls_OnQueryAccountCB_default_instance_.Shutdown();
+  _CMD_Halls_OnRequestCreateRoomCB_default_instance_.Shutdown();
   delete file_level_metadata[31].reflection;
-  _CMD_Halls_OnQueryPlayerGameDataCB_default_instance_.Shutdown();
+  _CMD_Halls_OnRoomSrvGameOverReport_default_instance_.Shutdown();
   delete file_level_metadata[32].reflection;
-  _CMD_Halls_QueryPlayerGameData_default_instance_.Shutdown();
+  _CMD_Halls_OnQueryAccountCB_default_instance_.Shutdown();
   delete file_level_metadata[33].reflection;
-  _CMD_Halls_ListGames_default_instance_.Shutdown();
+  _CMD_Halls_OnQueryPlayerGameDataCB_default_instance_.Shutdown();
   delete file_level_metadata[34].reflection;
-  _CMD_Hallsmgr_RequestAllocClient_default_instance_.Shutdown();
+  _CMD_Halls_QueryPlayerGameData_default_instance_.Shutdown();
   delete file_level_metadata[35].reflection;
-  _CMD_Hallsmgr_OnRequestAllocClientCB_default_instance_.Shutdown();
+  _CMD_Halls_ListGames_default_instance_.Shutdown();
   delete file_level_metadata[36].reflection;
-  _CMD_RoomPlayerInfo_default_instance_.Shutdown();
+  _CMD_Hallsmgr_RequestAllocClient_default_instance_.Shutdown();
   delete file_level_metadata[37].reflection;
-  _CMD_Roommgr_RequestCreateRoom_default_instance_.Shutdown();
+  _CMD_Hallsmgr_OnRequestAllocClientCB_default_instance_.Shutdown();
   delete file_level_metadata[38].reflection;
-  _CMD_Roommgr_OnRequestCreateRoomCB_default_instance_.Shutdown();
+  _CMD_RoomPlayerInfo_default_instance_.Shutdown();
   delete file_level_metadata[39].reflection;
-  _CMD_Roommgr_OnRoomSrvGameOverReport_default_instance_.Shutdown();
+  _CMD_Roommgr_RequestCreateRoom_default_instance_.Shutdown();
   delete file_level_metadata[40].reflection;
-  _CMD_Machine_RequestCreateRoom_default_instance_.Shutdown();
+  _CMD_Roommgr_OnRequestCreateRoomCB_default_instance_.Shutdown();
   delete file_level_metadata[41].reflection;
-  _CMD_Machine_RoomSrvReportAddr_default_instance_.Shutdown();
+  _CMD_Roommgr_OnRoomSrvGameOverReport_default_instance_.Shutdown();
   delete file_level_metadata[42].reflection;
-  _CMD_Machine_OnRoomSrvGameOverReport_default_instance_.Shutdown();
+  _CMD_Machine_RequestCreateRoom_default_instance_.Shutdown();
   delete file_level_metadata[43].reflection;
-  _CMD_ListServersInfo_default_instance_.Shutdown();
+  _CMD_Machine_RoomSrvReportAddr_default_instance_.Shutdown();
   delete file_level_metadata[44].reflection;
-  _CMD_Client_OnListServersCB_default_instance_.Shutdown();
+  _CMD_Machine_OnRoomSrvGameOverReport_default_instance_.Shutdown();
   delete file_level_metadata[45].reflection;
-  _CMD_Client_OnSignupCB_default_instance_.Shutdown();
+  _CMD_ListServersInfo_default_instance_.Shutdown();
   delete file_level_metadata[46].reflection;
-  _CMD_Client_OnSigninCB_default_instance_.Shutdown();
+  _CMD_Client_OnListServersCB_default_instance_.Shutdown();
   delete file_level_metadata[47].reflection;
-  _CMD_PlayerContext_default_instance_.Shutdown();
+  _CMD_Client_OnSignupCB_default_instance_.Shutdown();
   delete file_level_metadata[48].reflection;
-  _CMD_Client_UpdatePlayerContext_default_instance_.Shutdown();
+  _CMD_Client_OnSigninCB_default_instance_.Shutdown();
   delete file_level_metadata[49].reflection;
-  _CMD_GameModeInfos_default_instance_.Shutdown();
+  _CMD_PlayerContext_default_instance_.Shutdown();
   delete file_level_metadata[50].reflection;
-  _CMD_GameInfos_default_instance_.Shutdown();
+  _CMD_Client_UpdatePlayerContext_default_instance_.Shutdown();
   delete file_level_metadata[51].reflection;
-  _CMD_Client_OnListGamesCB_default_instance_.Shutdown();
+  _CMD_GameModeInfos_default_instance_.Shutdown();
   delete file_level_metadata[52].reflection;
-  _CMD_Client_OnLoginCB_default_instance_.Shutdown();
+  _CMD_GameInfos_default_instance_.Shutdown();
   delete file_level_metadata[53].reflection;
-  _CMD_Client_OnMatchingUpdate_default_instance_.Shutdown();
+  _CMD_Client_OnListGamesCB_default_instance_.Shutdown();
   delete file_level_metadata[54].reflection;
-  _CMD_Client_OnEndMatch_default_instance_.Shutdown();
+  _CMD_Client_OnLoginCB_default_instance_.Shutdown();
   delete file_level_metadata[55].reflection;
-  _CMD_Client_OnGameOver_default_instance_.Shutdown();
+  _CMD_Client_OnMatchingUpdate_default_instance_.Shutdown();
   delete file_level_metadata[56].reflection;
-  _CMD_Client_OnCancelMatch_default_instance_.Shutdown();
+  _CMD_Client_OnEndMatch_default_instance_.Shutdown();
   delete file_level_metadata[57].reflection;
+  _CMD_Client_OnGameOver_default_instance_.Shutdown();
+  delete file_level_metadata[58].reflection;
+  _CMD_Client_OnCancelMatch_default_instance_.Shutdown();
+  delete file_level_metadata[59].reflection;
 }
 
 void TableStruct::InitDefaultsImpl() {
@@ -913,12 +954,14 @@ void TableStruct::InitDefaultsImpl() {
   _CMD_Unkown_default_instance_.DefaultConstruct();
   _CMD_Hello_default_instance_.DefaultConstruct();
   _CMD_HelloCB_default_instance_.DefaultConstruct();
+  _CMD_FrameUpgrade_default_instance_.DefaultConstruct();
   _CMD_Heartbeat_default_instance_.DefaultConstruct();
   _CMD_HeartbeatCB_default_instance_.DefaultConstruct();
   _CMD_Version_Not_Match_default_instance_.DefaultConstruct();
   _CMD_UpdateServerInfos_default_instance_.DefaultConstruct();
   _CMD_QueryServerInfos_default_instance_.DefaultConstruct();
   _CMD_QueryServerInfosCB_default_instance_.DefaultConstruct();
+  _CMD_ShmAttach_default_instance_.DefaultConstruct();
   _CMD_Ping_default_instance_.DefaultConstruct();
   _CMD_Pong_default_instance_.DefaultConstruct();
   _CMD_ForwardPacket_default_instance_.DefaultConstruct();
@@ -982,222 +1025,234 @@ void AddDescriptorsImpl() {
   InitDefaults();
   static const char descriptor[] = {
       "\n\016Commands.proto\032\022ServerCommon.proto\"\014\n\n"
-      "CMD_Unkown\"Z\n\tCMD_Hello\022\017\n\007version\030\001 \001(\005"
-      "\022\r\n\005appID\030\002 \001(\004\022\017\n\007appType\030\003 \001(\005\022\016\n\006appG"
-      "ID\030\004 \001(\004\022\014\n\004name\030\005 \001(\t\"\\\n\013CMD_HelloCB\022\017\n"
-      "\007version\030\001 \001(\005\022\r\n\005appID\030\002 \001(\004\022\017\n\007appType"
-      "\030\003 \001(\005\022\016\n\006appGID\030\004 \001(\004\022\014\n\004name\030\005 \001(\t\"/\n\r"
-      "CMD_Heartbeat\022\r\n\005appID\030\001 \001(\004\022\017\n\007appType\030"
-      "\002 \001(\005\"1\n\017CMD_HeartbeatCB\022\r\n\005appID\030\001 \001(\004\022"
-      "\017\n\007appType\030\002 \001(\005\"H\n\025CMD_Version_Not_Matc"
-      "h\022\017\n\007version\030\001 \001(\005\022\r\n\005appID\030\002 \001(\004\022\017\n\007app"
-      "Type\030\003 \001(\005\"\216\002\n\025CMD_UpdateServerInfos\022\r\n\005"
-      "appID\030\001 \001(\004\022\017\n\007appType\030\002 \001(\005\022\023\n\013internal"
-      "_ip\030\003 \001(\t\022\025\n\rinternal_port\030\004 \001(\r\022\023\n\013exte"
-      "rnal_ip\030\005 \001(\t\022\025\n\rexternal_port\030\006 \001(\r\022\014\n\004"
-      "load\030\007 \001(\002\022\021\n\tplayerNum\030\010 \001(\005\022\022\n\nsession"
-      "Num\030\t \001(\005\022\016\n\006appGID\030\n \001(\004\022\014\n\004name\030\013 \001(\t\022"
-      "*\n\nchild_srvs\030\014 \003(\0132\026.CMD_UpdateServerIn"
-      "fos\"V\n\024CMD_QueryServerInfos\022\r\n\005appID\030\001 \001"
-      "(\004\022\016\n\006appGID\030\002 \001(\004\022\017\n\007appType\030\003 \001(\005\022\016\n\006m"
-      "axNum\030\004 \001(\005\">\n\026CMD_QueryServerInfosCB\022$\n"
-      "\004srvs\030\001 \003(\0132\026.CMD_UpdateServerInfos\"\030\n\010C"
-      "MD_Ping\022\014\n\004time\030\001 \001(\004\"\030\n\010CMD_Pong\022\014\n\004tim"
-      "e\030\001 \001(\004\"G\n\021CMD_ForwardPacket\022\023\n\013requesto"
-      "rID\030\001 \001(\004\022\r\n\005datas\030\002 \001(\014\022\016\n\006msgcmd\030\003 \001(\005"
-      "\"\030\n\026CMD_RemoteDisconnected\"\033\n\031CMD_Direct"
-      "ory_ListServers\"N\n\020CMD_Login_Signup\022\031\n\021c"
-      "ommitAccountName\030\001 \001(\t\022\020\n\010password\030\002 \001(\t"
-      "\022\r\n\005datas\030\003 \001(\014\"x\n\024CMD_Login_OnSignupCB\022"
-      "\035\n\007errcode\030\001 \001(\0162\014.ServerError\022\031\n\021commit"
-      "AccountName\030\002 \001(\t\022\027\n\017realAccountName\030\003 \001"
-      "(\t\022\r\n\005datas\030\004 \001(\014\"N\n\020CMD_Login_Signin\022\031\n"
+      "CMD_Unkown\"\354\001\n\tCMD_Hello\022\017\n\007version\030\001 \001("
+      "\005\022\r\n\005appID\030\002 \001(\004\022\017\n\007appType\030\003 \001(\005\022\016\n\006app"
+      "GID\030\004 \001(\004\022\014\n\004name\030\005 \001(\t\022\024\n\014frameVersion\030"
+      "\006 \001(\r\022\023\n\013compression\030\007 \001(\r\022\024\n\014compressDi"
+      "ct\030\010 \001(\r\022\017\n\007ciphers\030\t \001(\r\022\021\n\tcipherKey\030\n"
+      " \001(\014\022\r\n\005batch\030\013 \001(\010\022\016\n\006hostID\030\014 \001(\t\022\014\n\004l"
+      "ink\030\r \001(\r\"\340\001\n\013CMD_HelloCB\022\017\n\007version\030\001 \001"
+      "(\005\022\r\n\005appID\030\002 \001(\004\022\017\n\007appType\030\003 \001(\005\022\016\n\006ap"
+      "pGID\030\004 \001(\004\022\014\n\004name\030\005 \001(\t\022\024\n\014frameVersion"
+      "\030\006 \001(\r\022\023\n\013compression\030\007 \001(\r\022\024\n\014compressD"
+      "ict\030\010 \001(\r\022\016\n\006cipher\030\t \001(\r\022\021\n\tcipherKey\030\n"
+      " \001(\014\022\r\n\005batch\030\013 \001(\010\022\017\n\007shmName\030\014 \001(\t\"#\n\020"
+      "CMD_FrameUpgrade\022\017\n\007version\030\001 \001(\r\"/\n\rCMD"
+      "_Heartbeat\022\r\n\005appID\030\001 \001(\004\022\017\n\007appType\030\002 \001"
+      "(\005\"1\n\017CMD_HeartbeatCB\022\r\n\005appID\030\001 \001(\004\022\017\n\007"
+      "appType\030\002 \001(\005\"H\n\025CMD_Version_Not_Match\022\017"
+      "\n\007version\030\001 \001(\005\022\r\n\005appID\030\002 \001(\004\022\017\n\007appTyp"
+      "e\030\003 \001(\005\"\236\002\n\025CMD_UpdateServerInfos\022\r\n\005app"
+      "ID\030\001 \001(\004\022\017\n\007appType\030\002 \001(\005\022\023\n\013internal_ip"
+      "\030\003 \001(\t\022\025\n\rinternal_port\030\004 \001(\r\022\023\n\013externa"
+      "l_ip\030\005 \001(\t\022\025\n\rexternal_port\030\006 \001(\r\022\014\n\004loa"
+      "d\030\007 \001(\002\022\021\n\tplayerNum\030\010 \001(\005\022\022\n\nsessionNum"
+      "\030\t \001(\005\022\016\n\006appGID\030\n \001(\004\022\014\n\004name\030\013 \001(\t\022*\n\n"
+      "child_srvs\030\014 \003(\0132\026.CMD_UpdateServerInfos"
+      "\022\016\n\006hostID\030\r \001(\t\"V\n\024CMD_QueryServerInfos"
+      "\022\r\n\005appID\030\001 \001(\004\022\016\n\006appGID\030\002 \001(\004\022\017\n\007appTy"
+      "pe\030\003 \001(\005\022\016\n\006maxNum\030\004 \001(\005\">\n\026CMD_QuerySer"
+      "verInfosCB\022$\n\004srvs\030\001 \003(\0132\026.CMD_UpdateSer"
+      "verInfos\"\033\n\rCMD_ShmAttach\022\n\n\002ok\030\001 \001(\010\"\030\n"
+      "\010CMD_Ping\022\014\n\004time\030\001 \001(\004\"\030\n\010CMD_Pong\022\014\n\004t"
+      "ime\030\001 \001(\004\"G\n\021CMD_ForwardPacket\022\023\n\013reques"
+      "torID\030\001 \001(\004\022\r\n\005datas\030\002 \001(\014\022\016\n\006msgcmd\030\003 \001"
+      "(\005\"\030\n\026CMD_RemoteDisconnected\"\033\n\031CMD_Dire"
+      "ctory_ListServers\"N\n\020CMD_Login_Signup\022\031\n"
       "\021commitAccountName\030\001 \001(\t\022\020\n\010password\030\002 \001"
-      "(\t\022\r\n\005datas\030\003 \001(\014\"\243\001\n\024CMD_Login_OnSignin"
-      "CB\022\035\n\007errcode\030\001 \001(\0162\014.ServerError\022\031\n\021com"
-      "mitAccountName\030\002 \001(\t\022\027\n\017realAccountName\030"
-      "\003 \001(\t\022\r\n\005datas\030\004 \001(\014\022\025\n\rfoundObjectID\030\005 "
-      "\001(\004\022\022\n\nfoundAppID\030\006 \001(\004\"\207\001\n CMD_Login_On"
-      "RequestAllocClientCB\022\n\n\002ip\030\001 \001(\t\022\014\n\004port"
-      "\030\002 \001(\005\022\031\n\021commitAccountName\030\003 \001(\t\022\035\n\007err"
-      "code\030\004 \001(\0162\014.ServerError\022\017\n\007tokenID\030\005 \001("
-      "\004\"\243\001\n\026CMD_Dbmgr_WriteAccount\022\r\n\005appID\030\001 "
-      "\001(\004\022\031\n\021commitAccountName\030\002 \001(\t\022\020\n\010passwo"
-      "rd\030\003 \001(\t\022\r\n\005datas\030\004 \001(\014\022\022\n\nplayerName\030\005 "
-      "\001(\t\022\017\n\007modelID\030\006 \001(\005\022\013\n\003exp\030\007 \001(\005\022\014\n\004gol"
-      "d\030\010 \001(\005\"\216\001\n\026CMD_Dbmgr_QueryAccount\022\031\n\021co"
-      "mmitAccountName\030\001 \001(\t\022\020\n\010password\030\002 \001(\t\022"
-      "\022\n\nqueryAppID\030\003 \001(\004\022\021\n\tqueryType\030\004 \001(\005\022\r"
-      "\n\005datas\030\005 \001(\t\022\021\n\taccountID\030\006 \001(\004\"x\n\033CMD_"
-      "Dbmgr_UpdateAccountData\022\031\n\021commitAccount"
-      "Name\030\001 \001(\t\022\022\n\nplayerName\030\002 \001(\t\022\017\n\007modelI"
-      "D\030\003 \001(\005\022\013\n\003exp\030\004 \001(\005\022\014\n\004gold\030\005 \001(\005\"\225\001\n\035C"
-      "MD_Dbmgr_WritePlayerGameData\022\020\n\010playerID"
-      "\030\001 \001(\004\022\r\n\005score\030\002 \001(\005\022\020\n\010topscore\030\003 \001(\005\022"
-      "\016\n\006gameID\030\004 \001(\004\022\020\n\010gameMode\030\005 \001(\r\022\017\n\007vic"
-      "tory\030\006 \001(\005\022\016\n\006defeat\030\007 \001(\005\"S\n\035CMD_Dbmgr_"
-      "QueryPlayerGameData\022\020\n\010playerID\030\001 \001(\004\022\016\n"
-      "\006gameID\030\002 \001(\004\022\020\n\010gameMode\030\003 \001(\r\"S\n\030CMD_H"
-      "alls_PlayerGameData\022\013\n\003exp\030\001 \001(\005\022\r\n\005scor"
-      "e\030\002 \001(\005\022\n\n\002id\030\003 \001(\004\022\017\n\007victory\030\004 \001(\010\"`\n\017"
-      "CMD_Halls_Login\022\017\n\007tokenID\030\001 \001(\004\022\031\n\021comm"
-      "itAccountName\030\002 \001(\t\022\017\n\007hallsID\030\003 \001(\004\022\020\n\010"
-      "playerID\030\004 \001(\004\"\211\001\n\034CMD_Halls_RequestAllo"
-      "cClient\022\031\n\021commitAccountName\030\001 \001(\t\022\020\n\010pa"
-      "ssword\030\002 \001(\t\022\r\n\005datas\030\003 \001(\014\022\025\n\rfoundObje"
-      "ctID\030\004 \001(\004\022\026\n\016loginSessionID\030\005 \001(\004\"8\n\024CM"
-      "D_Halls_StartMatch\022\016\n\006gameID\030\001 \001(\004\022\020\n\010ga"
-      "meMode\030\002 \001(\005\"\027\n\025CMD_Halls_CancelMatch\"{\n"
-      "\037CMD_Halls_OnRequestCreateRoomCB\022\016\n\006room"
-      "ID\030\001 \001(\004\022\n\n\002ip\030\002 \001(\t\022\014\n\004port\030\003 \001(\005\022\017\n\007to"
-      "kenID\030\004 \001(\004\022\035\n\007errcode\030\005 \001(\0162\014.ServerErr"
-      "or\"\202\001\n!CMD_Halls_OnRoomSrvGameOverReport"
-      "\022\016\n\006roomID\030\001 \001(\004\022\035\n\007errcode\030\002 \001(\0162\014.Serv"
-      "erError\022.\n\013playerdatas\030\003 \003(\0132\031.CMD_Halls"
-      "_PlayerGameData\"\317\001\n\032CMD_Halls_OnQueryAcc"
-      "ountCB\022\031\n\021commitAccountName\030\001 \001(\t\022\r\n\005dat"
-      "as\030\002 \001(\014\022\025\n\rfoundObjectID\030\003 \001(\004\022\022\n\nplaye"
-      "rName\030\004 \001(\t\022\017\n\007modelID\030\005 \001(\005\022\013\n\003exp\030\006 \001("
-      "\005\022\014\n\004gold\030\007 \001(\005\022\035\n\007errcode\030\010 \001(\0162\014.Serve"
-      "rError\022\021\n\tqueryType\030\t \001(\005\"\270\001\n!CMD_Halls_"
-      "OnQueryPlayerGameDataCB\022\020\n\010playerID\030\001 \001("
-      "\004\022\r\n\005score\030\002 \001(\005\022\020\n\010topscore\030\003 \001(\005\022\016\n\006ga"
-      "meID\030\004 \001(\004\022\020\n\010gameMode\030\005 \001(\r\022\017\n\007victory\030"
-      "\006 \001(\005\022\016\n\006defeat\030\007 \001(\005\022\035\n\007errcode\030\010 \001(\0162\014"
-      ".ServerError\"A\n\035CMD_Halls_QueryPlayerGam"
-      "eData\022\016\n\006gameID\030\001 \001(\004\022\020\n\010gameMode\030\002 \001(\r\""
-      "A\n\023CMD_Halls_ListGames\022\014\n\004page\030\001 \001(\r\022\014\n\004"
-      "type\030\002 \001(\r\022\016\n\006maxNum\030\003 \001(\r\"\210\001\n\037CMD_Halls"
-      "mgr_RequestAllocClient\022\031\n\021commitAccountN"
-      "ame\030\001 \001(\t\022\020\n\010password\030\002 \001(\t\022\r\n\005datas\030\003 \001"
-      "(\014\022\025\n\rfoundObjectID\030\004 \001(\004\022\022\n\nfoundAppID\030"
-      "\005 \001(\004\"\242\001\n#CMD_Hallsmgr_OnRequestAllocCli"
-      "entCB\022\n\n\002ip\030\001 \001(\t\022\014\n\004port\030\002 \001(\005\022\031\n\021commi"
-      "tAccountName\030\003 \001(\t\022\035\n\007errcode\030\004 \001(\0162\014.Se"
-      "rverError\022\026\n\016loginSessionID\030\005 \001(\004\022\017\n\007tok"
-      "enID\030\006 \001(\004\"\264\001\n\022CMD_RoomPlayerInfo\022\020\n\010pla"
-      "yerID\030\001 \001(\004\022\022\n\nclientAddr\030\002 \001(\t\022\013\n\003exp\030\003"
-      " \001(\005\022\r\n\005score\030\004 \001(\005\022\020\n\010topscore\030\005 \001(\005\022\017\n"
-      "\007victory\030\006 \001(\005\022\016\n\006defeat\030\007 \001(\005\022\022\n\nplayer"
-      "Name\030\010 \001(\t\022\025\n\rplayerModelID\030\t \001(\005\"\325\001\n\035CM"
-      "D_Roommgr_RequestCreateRoom\022\017\n\007hallsID\030\001"
-      " \001(\004\022\016\n\006gameID\030\002 \001(\004\022\020\n\010gameMode\030\003 \001(\005\022\016"
-      "\n\006roomID\030\004 \001(\004\022\024\n\014maxPlayerNum\030\005 \001(\005\022\020\n\010"
-      "gameTime\030\006 \001(\002\022$\n\007players\030\007 \003(\0132\023.CMD_Ro"
-      "omPlayerInfo\022\017\n\007exeFile\030\010 \001(\t\022\022\n\nexeOpti"
-      "ons\030\t \001(\t\"\216\001\n!CMD_Roommgr_OnRequestCreat"
-      "eRoomCB\022\017\n\007hallsID\030\001 \001(\004\022\016\n\006roomID\030\002 \001(\004"
-      "\022\n\n\002ip\030\003 \001(\t\022\014\n\004port\030\004 \001(\005\022\017\n\007tokenID\030\005 "
-      "\001(\004\022\035\n\007errcode\030\006 \001(\0162\014.ServerError\"\225\001\n#C"
-      "MD_Roommgr_OnRoomSrvGameOverReport\022\017\n\007ha"
-      "llsID\030\001 \001(\004\022\016\n\006roomID\030\002 \001(\004\022\035\n\007errcode\030\003"
-      " \001(\0162\014.ServerError\022.\n\013playerdatas\030\004 \003(\0132"
-      "\031.CMD_Halls_PlayerGameData\"\216\002\n\035CMD_Machi"
-      "ne_RequestCreateRoom\022\017\n\007hallsID\030\001 \001(\004\022\016\n"
-      "\006gameID\030\002 \001(\004\022\020\n\010gameMode\030\003 \001(\005\022\016\n\006roomI"
-      "D\030\004 \001(\004\022\024\n\014maxPlayerNum\030\005 \001(\005\022\020\n\010gameTim"
-      "e\030\006 \001(\002\022$\n\007players\030\007 \003(\0132\023.CMD_RoomPlaye"
-      "rInfo\022\017\n\007exeFile\030\010 \001(\t\022\022\n\nexeOptions\030\t \001"
-      "(\t\022\017\n\007tokenID\030\n \001(\004\022\021\n\troommgrIP\030\013 \001(\t\022\023"
-      "\n\013roommgrPort\030\014 \001(\005\"y\n\035CMD_Machine_RoomS"
-      "rvReportAddr\022\017\n\007hallsID\030\001 \001(\004\022\016\n\006roomID\030"
-      "\002 \001(\004\022\n\n\002ip\030\003 \001(\t\022\014\n\004port\030\004 \001(\005\022\035\n\007errco"
-      "de\030\005 \001(\0162\014.ServerError\"\225\001\n#CMD_Machine_O"
-      "nRoomSrvGameOverReport\022\017\n\007hallsID\030\001 \001(\004\022"
-      "\016\n\006roomID\030\002 \001(\004\022\035\n\007errcode\030\003 \001(\0162\014.Serve"
-      "rError\022.\n\013playerdatas\030\004 \003(\0132\031.CMD_Halls_"
-      "PlayerGameData\"\\\n\023CMD_ListServersInfo\022\014\n"
-      "\004addr\030\001 \001(\t\022\014\n\004port\030\002 \001(\005\022\017\n\007groupid\030\003 \001"
-      "(\004\022\014\n\004name\030\004 \001(\t\022\n\n\002id\030\005 \001(\004\"_\n\032CMD_Clie"
-      "nt_OnListServersCB\022\035\n\007errcode\030\001 \001(\0162\014.Se"
-      "rverError\022\"\n\004srvs\030\002 \003(\0132\024.CMD_ListServer"
-      "sInfo\"E\n\025CMD_Client_OnSignupCB\022\035\n\007errcod"
-      "e\030\001 \001(\0162\014.ServerError\022\r\n\005datas\030\002 \001(\014\"r\n\025"
-      "CMD_Client_OnSigninCB\022\035\n\007errcode\030\001 \001(\0162\014"
-      ".ServerError\022\r\n\005datas\030\002 \001(\014\022\014\n\004addr\030\003 \001("
-      "\t\022\014\n\004port\030\004 \001(\005\022\017\n\007tokenID\030\005 \001(\004\"\312\002\n\021CMD"
-      "_PlayerContext\022\020\n\010playerID\030\001 \001(\004\022\022\n\nplay"
-      "erName\030\002 \001(\t\022\025\n\rplayerModelID\030\003 \001(\005\022\013\n\003e"
-      "xp\030\004 \001(\005\022\016\n\006roomID\030\005 \001(\004\022\016\n\006gameID\030\006 \001(\004"
-      "\022\020\n\010gameMode\030\007 \001(\005\022\024\n\014gameServerIP\030\010 \001(\t"
-      "\022\026\n\016gameServerPort\030\t \001(\005\022\031\n\021gameServerTo"
-      "kenID\030\n \001(\004\022\030\n\020gameMaxPlayerNum\030\013 \001(\005\022\020\n"
-      "\010gameTime\030\014 \001(\002\022\032\n\022playerGameTopScore\030\r "
-      "\001(\005\022(\n\013gamePlayers\030\016 \003(\0132\023.CMD_RoomPlaye"
-      "rInfo\"K\n\036CMD_Client_UpdatePlayerContext\022"
-      ")\n\rplayerContext\030\001 \001(\0132\022.CMD_PlayerConte"
-      "xt\"b\n\021CMD_GameModeInfos\022\022\n\ngameModeID\030\001 "
-      "\001(\r\022\024\n\014gameModeName\030\002 \001(\t\022\021\n\tplayerMax\030\003"
-      " \001(\r\022\020\n\010gameTime\030\004 \001(\r\"\233\001\n\rCMD_GameInfos"
-      "\022\016\n\006gameID\030\001 \001(\004\022\020\n\010gameMode\030\002 \001(\r\022\014\n\004ty"
-      "pe\030\003 \001(\r\022\020\n\010gameName\030\004 \001(\t\022\020\n\010url_icon\030\005"
-      " \001(\t\022\017\n\007url_apk\030\006 \001(\t\022%\n\tgameModes\030\007 \003(\013"
-      "2\022.CMD_GameModeInfos\"p\n\030CMD_Client_OnLis"
-      "tGamesCB\022\014\n\004page\030\001 \001(\r\022\014\n\004type\030\002 \001(\r\022\025\n\r"
-      "totalGamesNum\030\003 \001(\r\022!\n\tgameInfos\030\004 \003(\0132\016"
-      ".CMD_GameInfos\"\200\001\n\024CMD_Client_OnLoginCB\022"
-      "\035\n\007errcode\030\001 \001(\0162\014.ServerError\022\r\n\005datas\030"
-      "\002 \001(\014\022)\n\rplayerContext\030\003 \001(\0132\022.CMD_Playe"
-      "rContext\022\017\n\007hallsID\030\004 \001(\004\"W\n\033CMD_Client_"
-      "OnMatchingUpdate\022\014\n\004name\030\001 \001(\t\022\n\n\002id\030\002 \001"
-      "(\004\022\017\n\007modelID\030\003 \001(\005\022\r\n\005enter\030\004 \001(\010\"\216\002\n\025C"
-      "MD_Client_OnEndMatch\022\035\n\007errcode\030\001 \001(\0162\014."
-      "ServerError\022\024\n\014gameServerIP\030\002 \001(\t\022\026\n\016gam"
-      "eServerPort\030\003 \001(\005\022\016\n\006gameID\030\004 \001(\004\022\020\n\010gam"
-      "eMode\030\005 \001(\005\022\031\n\021gameServerTokenID\030\006 \001(\004\022\026"
-      "\n\016gamePlayerSize\030\007 \001(\005\022\020\n\010topScore\030\010 \001(\005"
-      "\022\017\n\007victory\030\t \001(\005\022\016\n\006defeat\030\n \001(\005\022\020\n\010gam"
-      "eTime\030\013 \001(\002\022\016\n\006roomID\030\014 \001(\004\"h\n\025CMD_Clien"
-      "t_OnGameOver\022\035\n\007errcode\030\001 \001(\0162\014.ServerEr"
-      "ror\022\016\n\006gameID\030\002 \001(\004\022\020\n\010gameMode\030\003 \001(\005\022\016\n"
-      "\006roomID\030\004 \001(\004\"9\n\030CMD_Client_OnCancelMatc"
-      "h\022\035\n\007errcode\030\001 \001(\0162\014.ServerError*\225\r\n\003CMD"
-      "\022\n\n\006Unkown\020\000\022\t\n\005Hello\020\001\022\013\n\007HelloCB\020\002\022\r\n\t"
-      "Heartbeat\020\003\022\017\n\013HeartbeatCB\020\004\022\025\n\021Version_"
-      "Not_Match\020\005\022\025\n\021UpdateServerInfos\020\006\022\024\n\020Qu"
-      "eryServerInfos\020\007\022\026\n\022QueryServerInfosCB\020\010"
-      "\022\010\n\004Ping\020\t\022\010\n\004Pong\020\n\022\021\n\rForwardPacket\020\013\022"
-      "\026\n\022RemoteDisconnected\020\014\022\023\n\017Directory_Beg"
-      "in\020e\022\031\n\025Directory_ListServers\020f\022\022\n\rDirec"
-      "tory_End\020\310\001\022\020\n\013Login_Begin\020\311\001\022\021\n\014Login_S"
-      "ignup\020\312\001\022\025\n\020Login_OnSignupCB\020\313\001\022\021\n\014Login"
-      "_Signin\020\314\001\022\025\n\020Login_OnSigninCB\020\315\001\022!\n\034Log"
-      "in_OnRequestAllocClientCB\020\316\001\022\016\n\tLogin_En"
-      "d\020\254\002\022\020\n\013Dbmgr_Begin\020\255\002\022\027\n\022Dbmgr_WriteAcc"
-      "ount\020\256\002\022\027\n\022Dbmgr_QueryAccount\020\257\002\022\034\n\027Dbmg"
-      "r_UpdateAccountData\020\260\002\022\036\n\031Dbmgr_WritePla"
-      "yerGameData\020\261\002\022\036\n\031Dbmgr_QueryPlayerGameD"
-      "ata\020\262\002\022\016\n\tDbmgr_End\020\220\003\022\024\n\017Connector_Begi"
-      "n\020\221\003\022\022\n\rConnector_End\020\364\003\022\020\n\013Halls_Begin\020"
-      "\365\003\022\020\n\013Halls_Login\020\366\003\022\035\n\030Halls_RequestAll"
-      "ocClient\020\367\003\022\025\n\020Halls_StartMatch\020\370\003\022\026\n\021Ha"
-      "lls_CancelMatch\020\371\003\022 \n\033Halls_OnRequestCre"
-      "ateRoomCB\020\372\003\022\"\n\035Halls_OnRoomSrvGameOverR"
-      "eport\020\373\003\022\033\n\026Halls_OnQueryAccountCB\020\374\003\022\"\n"
-      "\035Halls_OnQueryPlayerGameDataCB\020\375\003\022\036\n\031Hal"
-      "ls_QueryPlayerGameData\020\376\003\022\024\n\017Halls_ListG"
-      "ames\020\377\003\022\016\n\tHalls_End\020\330\004\022\023\n\016Hallsmgr_Begi"
-      "n\020\331\004\022 \n\033Hallsmgr_RequestAllocClient\020\332\004\022$"
-      "\n\037Hallsmgr_OnRequestAllocClientCB\020\333\004\022\021\n\014"
-      "Hallsmgr_End\020\274\005\022\022\n\rRoommgr_Begin\020\275\005\022\036\n\031R"
-      "oommgr_RequestCreateRoom\020\276\005\022\"\n\035Roommgr_O"
-      "nRequestCreateRoomCB\020\277\005\022$\n\037Roommgr_OnRoo"
-      "mSrvGameOverReport\020\300\005\022\020\n\013Roommgr_End\020\240\006\022"
-      "\022\n\rMachine_Begin\020\241\006\022\036\n\031Machine_RequestCr"
-      "eateRoom\020\242\006\022\036\n\031Machine_RoomSrvReportAddr"
-      "\020\243\006\022$\n\037Machine_OnRoomSrvGameOverReport\020\244"
-      "\006\022\020\n\013Machine_End\020\204\007\022\021\n\014Client_Begin\020\205\007\022\033"
-      "\n\026Client_OnListServersCB\020\206\007\022\026\n\021Client_On"
-      "SignupCB\020\207\007\022\026\n\021Client_OnSigninCB\020\210\007\022\025\n\020C"
-      "lient_OnLoginCB\020\211\007\022\034\n\027Client_OnMatchingU"
-      "pdate\020\212\007\022\026\n\021Client_OnEndMatch\020\213\007\022\026\n\021Clie"
-      "nt_OnGameOver\020\214\007\022\031\n\024Client_OnCancelMatch"
-      "\020\215\007\022\037\n\032Client_UpdatePlayerContext\020\216\007\022\031\n\024"
-      "Client_OnListGamesCB\020\217\007\022\017\n\nClient_End\020\350\007"
-      "b\006proto3"
+      "(\t\022\r\n\005datas\030\003 \001(\014\"x\n\024CMD_Login_OnSignupC"
+      "B\022\035\n\007errcode\030\001 \001(\0162\014.ServerError\022\031\n\021comm"
+      "itAccountName\030\002 \001(\t\022\027\n\017realAccountName\030\003"
+      " \001(\t\022\r\n\005datas\030\004 \001(\014\"N\n\020CMD_Login_Signin\022"
+      "\031\n\021commitAccountName\030\001 \001(\t\022\020\n\010password\030\002"
+      " \001(\t\022\r\n\005datas\030\003 \001(\014\"\264\001\n\024CMD_Login_OnSign"
+      "inCB\022\035\n\007errcode\030\001 \001(\0162\014.ServerError\022\031\n\021c"
+      "ommitAccountName\030\002 \001(\t\022\027\n\017realAccountNam"
+      "e\030\003 \001(\t\022\r\n\005datas\030\004 \001(\014\022\025\n\rfoundObjectID\030"
+      "\005 \001(\004\022\022\n\nfoundAppID\030\006 \001(\004\022\017\n\007hallsID\030\007 \001"
+      "(\004\"\230\001\n CMD_Login_OnRequestAllocClientCB\022"
+      "\n\n\002ip\030\001 \001(\t\022\014\n\004port\030\002 \001(\005\022\031\n\021commitAccou"
+      "ntName\030\003 \001(\t\022\035\n\007errcode\030\004 \001(\0162\014.ServerEr"
+      "ror\022\017\n\007tokenID\030\005 \001(\004\022\017\n\007hallsID\030\006 \001(\004\"\243\001"
+      "\n\026CMD_Dbmgr_WriteAccount\022\r\n\005appID\030\001 \001(\004\022"
+      "\031\n\021commitAccountName\030\002 \001(\t\022\020\n\010password\030\003"
+      " \001(\t\022\r\n\005datas\030\004 \001(\014\022\022\n\nplayerName\030\005 \001(\t\022"
+      "\017\n\007modelID\030\006 \001(\005\022\013\n\003exp\030\007 \001(\005\022\014\n\004gold\030\010 "
+      "\001(\005\"\216\001\n\026CMD_Dbmgr_QueryAccount\022\031\n\021commit"
+      "AccountName\030\001 \001(\t\022\020\n\010password\030\002 \001(\t\022\022\n\nq"
+      "ueryAppID\030\003 \001(\004\022\021\n\tqueryType\030\004 \001(\005\022\r\n\005da"
+      "tas\030\005 \001(\t\022\021\n\taccountID\030\006 \001(\004\"x\n\033CMD_Dbmg"
+      "r_UpdateAccountData\022\031\n\021commitAccountName"
+      "\030\001 \001(\t\022\022\n\nplayerName\030\002 \001(\t\022\017\n\007modelID\030\003 "
+      "\001(\005\022\013\n\003exp\030\004 \001(\005\022\014\n\004gold\030\005 \001(\005\"\225\001\n\035CMD_D"
+      "bmgr_WritePlayerGameData\022\020\n\010playerID\030\001 \001"
+      "(\004\022\r\n\005score\030\002 \001(\005\022\020\n\010topscore\030\003 \001(\005\022\016\n\006g"
+      "ameID\030\004 \001(\004\022\020\n\010gameMode\030\005 \001(\r\022\017\n\007victory"
+      "\030\006 \001(\005\022\016\n\006defeat\030\007 \001(\005\"S\n\035CMD_Dbmgr_Quer"
+      "yPlayerGameData\022\020\n\010playerID\030\001 \001(\004\022\016\n\006gam"
+      "eID\030\002 \001(\004\022\020\n\010gameMode\030\003 \001(\r\"S\n\030CMD_Halls"
+      "_PlayerGameData\022\013\n\003exp\030\001 \001(\005\022\r\n\005score\030\002 "
+      "\001(\005\022\n\n\002id\030\003 \001(\004\022\017\n\007victory\030\004 \001(\010\"`\n\017CMD_"
+      "Halls_Login\022\017\n\007tokenID\030\001 \001(\004\022\031\n\021commitAc"
+      "countName\030\002 \001(\t\022\017\n\007hallsID\030\003 \001(\004\022\020\n\010play"
+      "erID\030\004 \001(\004\"\211\001\n\034CMD_Halls_RequestAllocCli"
+      "ent\022\031\n\021commitAccountName\030\001 \001(\t\022\020\n\010passwo"
+      "rd\030\002 \001(\t\022\r\n\005datas\030\003 \001(\014\022\025\n\rfoundObjectID"
+      "\030\004 \001(\004\022\026\n\016loginSessionID\030\005 \001(\004\"8\n\024CMD_Ha"
+      "lls_StartMatch\022\016\n\006gameID\030\001 \001(\004\022\020\n\010gameMo"
+      "de\030\002 \001(\005\"\027\n\025CMD_Halls_CancelMatch\"{\n\037CMD"
+      "_Halls_OnRequestCreateRoomCB\022\016\n\006roomID\030\001"
+      " \001(\004\022\n\n\002ip\030\002 \001(\t\022\014\n\004port\030\003 \001(\005\022\017\n\007tokenI"
+      "D\030\004 \001(\004\022\035\n\007errcode\030\005 \001(\0162\014.ServerError\"\202"
+      "\001\n!CMD_Halls_OnRoomSrvGameOverReport\022\016\n\006"
+      "roomID\030\001 \001(\004\022\035\n\007errcode\030\002 \001(\0162\014.ServerEr"
+      "ror\022.\n\013playerdatas\030\003 \003(\0132\031.CMD_Halls_Pla"
+      "yerGameData\"\317\001\n\032CMD_Halls_OnQueryAccount"
+      "CB\022\031\n\021commitAccountName\030\001 \001(\t\022\r\n\005datas\030\002"
+      " \001(\014\022\025\n\rfoundObjectID\030\003 \001(\004\022\022\n\nplayerNam"
+      "e\030\004 \001(\t\022\017\n\007modelID\030\005 \001(\005\022\013\n\003exp\030\006 \001(\005\022\014\n"
+      "\004gold\030\007 \001(\005\022\035\n\007errcode\030\010 \001(\0162\014.ServerErr"
+      "or\022\021\n\tqueryType\030\t \001(\005\"\270\001\n!CMD_Halls_OnQu"
+      "eryPlayerGameDataCB\022\020\n\010playerID\030\001 \001(\004\022\r\n"
+      "\005score\030\002 \001(\005\022\020\n\010topscore\030\003 \001(\005\022\016\n\006gameID"
+      "\030\004 \001(\004\022\020\n\010gameMode\030\005 \001(\r\022\017\n\007victory\030\006 \001("
+      "\005\022\016\n\006defeat\030\007 \001(\005\022\035\n\007errcode\030\010 \001(\0162\014.Ser"
+      "verError\"A\n\035CMD_Halls_QueryPlayerGameDat"
+      "a\022\016\n\006gameID\030\001 \001(\004\022\020\n\010gameMode\030\002 \001(\r\"A\n\023C"
+      "MD_Halls_ListGames\022\014\n\004page\030\001 \001(\r\022\014\n\004type"
+      "\030\002 \001(\r\022\016\n\006maxNum\030\003 \001(\r\"\210\001\n\037CMD_Hallsmgr_"
+      "RequestAllocClient\022\031\n\021commitAccountName\030"
+      "\001 \001(\t\022\020\n\010password\030\002 \001(\t\022\r\n\005datas\030\003 \001(\014\022\025"
+      "\n\rfoundObjectID\030\004 \001(\004\022\022\n\nfoundAppID\030\005 \001("
+      "\004\"\263\001\n#CMD_Hallsmgr_OnRequestAllocClientC"
+      "B\022\n\n\002ip\030\001 \001(\t\022\014\n\004port\030\002 \001(\005\022\031\n\021commitAcc"
+      "ountName\030\003 \001(\t\022\035\n\007errcode\030\004 \001(\0162\014.Server"
+      "Error\022\026\n\016loginSessionID\030\005 \001(\004\022\017\n\007tokenID"
+      "\030\006 \001(\004\022\017\n\007hallsID\030\007 \001(\004\"\264\001\n\022CMD_RoomPlay"
+      "erInfo\022\020\n\010playerID\030\001 \001(\004\022\022\n\nclientAddr\030\002"
+      " \001(\t\022\013\n\003exp\030\003 \001(\005\022\r\n\005score\030\004 \001(\005\022\020\n\010tops"
+      "core\030\005 \001(\005\022\017\n\007victory\030\006 \001(\005\022\016\n\006defeat\030\007 "
+      "\001(\005\022\022\n\nplayerName\030\010 \001(\t\022\025\n\rplayerModelID"
+      "\030\t \001(\005\"\325\001\n\035CMD_Roommgr_RequestCreateRoom"
+      "\022\017\n\007hallsID\030\001 \001(\004\022\016\n\006gameID\030\002 \001(\004\022\020\n\010gam"
+      "eMode\030\003 \001(\005\022\016\n\006roomID\030\004 \001(\004\022\024\n\014maxPlayer"
+      "Num\030\005 \001(\005\022\020\n\010gameTime\030\006 \001(\002\022$\n\007players\030\007"
+      " \003(\0132\023.CMD_RoomPlayerInfo\022\017\n\007exeFile\030\010 \001"
+      "(\t\022\022\n\nexeOptions\030\t \001(\t\"\216\001\n!CMD_Roommgr_O"
+      "nRequestCreateRoomCB\022\017\n\007hallsID\030\001 \001(\004\022\016\n"
+      "\006roomID\030\002 \001(\004\022\n\n\002ip\030\003 \001(\t\022\014\n\004port\030\004 \001(\005\022"
+      "\017\n\007tokenID\030\005 \001(\004\022\035\n\007errcode\030\006 \001(\0162\014.Serv"
+      "erError\"\225\001\n#CMD_Roommgr_OnRoomSrvGameOve"
+      "rReport\022\017\n\007hallsID\030\001 \001(\004\022\016\n\006roomID\030\002 \001(\004"
+      "\022\035\n\007errcode\030\003 \001(\0162\014.ServerError\022.\n\013playe"
+      "rdatas\030\004 \003(\0132\031.CMD_Halls_PlayerGameData\""
+      "\216\002\n\035CMD_Machine_RequestCreateRoom\022\017\n\007hal"
+      "lsID\030\001 \001(\004\022\016\n\006gameID\030\002 \001(\004\022\020\n\010gameMode\030\003"
+      " \001(\005\022\016\n\006roomID\030\004 \001(\004\022\024\n\014maxPlayerNum\030\005 \001"
+      "(\005\022\020\n\010gameTime\030\006 \001(\002\022$\n\007players\030\007 \003(\0132\023."
+      "CMD_RoomPlayerInfo\022\017\n\007exeFile\030\010 \001(\t\022\022\n\ne"
+      "xeOptions\030\t \001(\t\022\017\n\007tokenID\030\n \001(\004\022\021\n\troom"
+      "mgrIP\030\013 \001(\t\022\023\n\013roommgrPort\030\014 \001(\005\"y\n\035CMD_"
+      "Machine_RoomSrvReportAddr\022\017\n\007hallsID\030\001 \001"
+      "(\004\022\016\n\006roomID\030\002 \001(\004\022\n\n\002ip\030\003 \001(\t\022\014\n\004port\030\004"
+      " \001(\005\022\035\n\007errcode\030\005 \001(\0162\014.ServerError\"\225\001\n#"
+      "CMD_Machine_OnRoomSrvGameOverReport\022\017\n\007h"
+      "allsID\030\001 \001(\004\022\016\n\006roomID\030\002 \001(\004\022\035\n\007errcode\030"
+      "\003 \001(\0162\014.ServerError\022.\n\013playerdatas\030\004 \003(\013"
+      "2\031.CMD_Halls_PlayerGameData\"\\\n\023CMD_ListS"
+      "erversInfo\022\014\n\004addr\030\001 \001(\t\022\014\n\004port\030\002 \001(\005\022\017"
+      "\n\007groupid\030\003 \001(\004\022\014\n\004name\030\004 \001(\t\022\n\n\002id\030\005 \001("
+      "\004\"_\n\032CMD_Client_OnListServersCB\022\035\n\007errco"
+      "de\030\001 \001(\0162\014.ServerError\022\"\n\004srvs\030\002 \003(\0132\024.C"
+      "MD_ListServersInfo\"E\n\025CMD_Client_OnSignu"
+      "pCB\022\035\n\007errcode\030\001 \001(\0162\014.ServerError\022\r\n\005da"
+      "tas\030\002 \001(\014\"\203\001\n\025CMD_Client_OnSigninCB\022\035\n\007e"
+      "rrcode\030\001 \001(\0162\014.ServerError\022\r\n\005datas\030\002 \001("
+      "\014\022\014\n\004addr\030\003 \001(\t\022\014\n\004port\030\004 \001(\005\022\017\n\007tokenID"
+      "\030\005 \001(\004\022\017\n\007hallsID\030\006 \001(\004\"\312\002\n\021CMD_PlayerCo"
+      "ntext\022\020\n\010playerID\030\001 \001(\004\022\022\n\nplayerName\030\002 "
+      "\001(\t\022\025\n\rplayerModelID\030\003 \001(\005\022\013\n\003exp\030\004 \001(\005\022"
+      "\016\n\006roomID\030\005 \001(\004\022\016\n\006gameID\030\006 \001(\004\022\020\n\010gameM"
+      "ode\030\007 \001(\005\022\024\n\014gameServerIP\030\010 \001(\t\022\026\n\016gameS"
+      "erverPort\030\t \001(\005\022\031\n\021gameServerTokenID\030\n \001"
+      "(\004\022\030\n\020gameMaxPlayerNum\030\013 \001(\005\022\020\n\010gameTime"
+      "\030\014 \001(\002\022\032\n\022playerGameTopScore\030\r \001(\005\022(\n\013ga"
+      "mePlayers\030\016 \003(\0132\023.CMD_RoomPlayerInfo\"K\n\036"
+      "CMD_Client_UpdatePlayerContext\022)\n\rplayer"
+      "Context\030\001 \001(\0132\022.CMD_PlayerContext\"b\n\021CMD"
+      "_GameModeInfos\022\022\n\ngameModeID\030\001 \001(\r\022\024\n\014ga"
+      "meModeName\030\002 \001(\t\022\021\n\tplayerMax\030\003 \001(\r\022\020\n\010g"
+      "ameTime\030\004 \001(\r\"\233\001\n\rCMD_GameInfos\022\016\n\006gameI"
+      "D\030\001 \001(\004\022\020\n\010gameMode\030\002 \001(\r\022\014\n\004type\030\003 \001(\r\022"
+      "\020\n\010gameName\030\004 \001(\t\022\020\n\010url_icon\030\005 \001(\t\022\017\n\007u"
+      "rl_apk\030\006 \001(\t\022%\n\tgameModes\030\007 \003(\0132\022.CMD_Ga"
+      "meModeInfos\"p\n\030CMD_Client_OnListGamesCB\022"
+      "\014\n\004page\030\001 \001(\r\022\014\n\004type\030\002 \001(\r\022\025\n\rtotalGame"
+      "sNum\030\003 \001(\r\022!\n\tgameInfos\030\004 \003(\0132\016.CMD_Game"
+      "Infos\"o\n\024CMD_Client_OnLoginCB\022\035\n\007errcode"
+      "\030\001 \001(\0162\014.ServerError\022\r\n\005datas\030\002 \001(\014\022)\n\rp"
+      "layerContext\030\003 \001(\0132\022.CMD_PlayerContext\"W"
+      "\n\033CMD_Client_OnMatchingUpdate\022\014\n\004name\030\001 "
+      "\001(\t\022\n\n\002id\030\002 \001(\004\022\017\n\007modelID\030\003 \001(\005\022\r\n\005ente"
+      "r\030\004 \001(\010\"\216\002\n\025CMD_Client_OnEndMatch\022\035\n\007err"
+      "code\030\001 \001(\0162\014.ServerError\022\024\n\014gameServerIP"
+      "\030\002 \001(\t\022\026\n\016gameServerPort\030\003 \001(\005\022\016\n\006gameID"
+      "\030\004 \001(\004\022\020\n\010gameMode\030\005 \001(\005\022\031\n\021gameServerTo"
+      "kenID\030\006 \001(\004\022\026\n\016gamePlayerSize\030\007 \001(\005\022\020\n\010t"
+      "opScore\030\010 \001(\005\022\017\n\007victory\030\t \001(\005\022\016\n\006defeat"
+      "\030\n \001(\005\022\020\n\010gameTime\030\013 \001(\002\022\016\n\006roomID\030\014 \001(\004"
+      "\"h\n\025CMD_Client_OnGameOver\022\035\n\007errcode\030\001 \001"
+      "(\0162\014.ServerError\022\016\n\006gameID\030\002 \001(\004\022\020\n\010game"
+      "Mode\030\003 \001(\005\022\016\n\006roomID\030\004 \001(\004\"9\n\030CMD_Client"
+      "_OnCancelMatch\022\035\n\007errcode\030\001 \001(\0162\014.Server"
+      "Error*\334\r\n\003CMD\022\n\n\006Unkown\020\000\022\t\n\005Hello\020\001\022\013\n\007"
+      "HelloCB\020\002\022\r\n\tHeartbeat\020\003\022\017\n\013HeartbeatCB\020"
+      "\004\022\025\n\021Version_Not_Match\020\005\022\025\n\021UpdateServer"
+      "Infos\020\006\022\024\n\020QueryServerInfos\020\007\022\026\n\022QuerySe"
+      "rverInfosCB\020\010\022\010\n\004Ping\020\t\022\010\n\004Pong\020\n\022\021\n\rFor"
+      "wardPacket\020\013\022\026\n\022RemoteDisconnected\020\014\022\020\n\014"
+      "FrameUpgrade\020\r\022\020\n\014ForwardFrame\020\016\022\022\n\016Mult"
+      "icastFrame\020\017\022\r\n\tShmAttach\020\020\022\023\n\017Directory"
+      "_Begin\020e\022\031\n\025Directory_ListServers\020f\022\022\n\rD"
+      "irectory_End\020\310\001\022\020\n\013Login_Begin\020\311\001\022\021\n\014Log"
+      "in_Signup\020\312\001\022\025\n\020Login_OnSignupCB\020\313\001\022\021\n\014L"
+      "ogin_Signin\020\314\001\022\025\n\020Login_OnSigninCB\020\315\001\022!\n"
+      "\034Login_OnRequestAllocClientCB\020\316\001\022\016\n\tLogi"
+      "n_End\020\254\002\022\020\n\013Dbmgr_Begin\020\255\002\022\027\n\022Dbmgr_Writ"
+      "eAccount\020\256\002\022\027\n\022Dbmgr_QueryAccount\020\257\002\022\034\n\027"
+      "Dbmgr_UpdateAccountData\020\260\002\022\036\n\031Dbmgr_Writ"
+      "ePlayerGameData\020\261\002\022\036\n\031Dbmgr_QueryPlayerG"
+      "ameData\020\262\002\022\016\n\tDbmgr_End\020\220\003\022\024\n\017Connector_"
+      "Begin\020\221\003\022\022\n\rConnector_End\020\364\003\022\020\n\013Halls_Be"
+      "gin\020\365\003\022\020\n\013Halls_Login\020\366\003\022\035\n\030Halls_Reques"
+      "tAllocClient\020\367\003\022\025\n\020Halls_StartMatch\020\370\003\022\026"
+      "\n\021Halls_CancelMatch\020\371\003\022 \n\033Halls_OnReques"
+      "tCreateRoomCB\020\372\003\022\"\n\035Halls_OnRoomSrvGameO"
+      "verReport\020\373\003\022\033\n\026Halls_OnQueryAccountCB\020\374"
+      "\003\022\"\n\035Halls_OnQueryPlayerGameDataCB\020\375\003\022\036\n"
+      "\031Halls_QueryPlayerGameData\020\376\003\022\024\n\017Halls_L"
+      "istGames\020\377\003\022\016\n\tHalls_End\020\330\004\022\023\n\016Hallsmgr_"
+      "Begin\020\331\004\022 \n\033Hallsmgr_RequestAllocClient\020"
+      "\332\004\022$\n\037Hallsmgr_OnRequestAllocClientCB\020\333\004"
+      "\022\021\n\014Hallsmgr_End\020\274\005\022\022\n\rRoommgr_Begin\020\275\005\022"
+      "\036\n\031Roommgr_RequestCreateRoom\020\276\005\022\"\n\035Roomm"
+      "gr_OnRequestCreateRoomCB\020\277\005\022$\n\037Roommgr_O"
+      "nRoomSrvGameOverReport\020\300\005\022\020\n\013Roommgr_End"
+      "\020\240\006\022\022\n\rMachine_Begin\020\241\006\022\036\n\031Machine_Reque"
+      "stCreateRoom\020\242\006\022\036\n\031Machine_RoomSrvReport"
+      "Addr\020\243\006\022$\n\037Machine_OnRoomSrvGameOverRepo"
+      "rt\020\244\006\022\020\n\013Machine_End\020\204\007\022\021\n\014Client_Begin\020"
+      "\205\007\022\033\n\026Client_OnListServersCB\020\206\007\022\026\n\021Clien"
+      "t_OnSignupCB\020\207\007\022\026\n\021Client_OnSigninCB\020\210\007\022"
+      "\025\n\020Client_OnLoginCB\020\211\007\022\034\n\027Client_OnMatch"
+      "ingUpdate\020\212\007\022\026\n\021Client_OnEndMatch\020\213\007\022\026\n\021"
+      "Client_OnGameOver\020\214\007\022\031\n\024Client_OnCancelM"
+      "atch\020\215\007\022\037\n\032Client_UpdatePlayerContext\020\216\007"
+      "\022\031\n\024Client_OnListGamesCB\020\217\007\022\017\n\nClient_En"
+      "d\020\350\007B\003\370\001\001b\006proto3"
   };
   ::google::protobuf::DescriptorPool::InternalAddGeneratedFile(
-      descriptor, 8528);
+      descriptor, 9017);
   ::google::protobuf::MessageFactory::InternalRegisterGeneratedFile(
     "Commands.proto", &protobuf_RegisterTypes);
   ::protobuf_ServerCommon_2eproto::AddDescriptors();
@@ -1236,6 +1291,10 @@ bool CMD_IsValid(int value) {
     case 10:
     case 11:
     case 12:
+    case 13:
+    case 14:
+    case 15:
+    case 16:
     case 101:
     case 102:
     case 200:
@@ -1313,6 +1372,16 @@ CMD_Unkown::CMD_Unkown()
   SharedCtor();
   // @@protoc_insertion_point(constructor:CMD_Unkown)
 }
+CMD_Unkown::CMD_Unkown(::google::protobuf::Arena* arena)
+  : ::google::protobuf::Message(),
+  _internal_metadata_(arena) {
+#ifdef GOOGLE_PROTOBUF_NO_STATIC_INITIALIZER
+  protobuf_Commands_2eproto::InitDefaults();
+#endif  // GOOGLE_PROTOBUF_NO_STATIC_INITIALIZER
+  SharedCtor();
+  RegisterArenaDtor(arena);
+  // @@protoc_insertion_point(arena_constructor:CMD_Unkown)
+}
 CMD_Unkown::CMD_Unkown(const CMD_Unkown& from)
   : ::google::protobuf::Message(),
       _internal_metadata_(NULL),
@@ -1331,8 +1400,19 @@ CMD_Unkown::~CMD_Unkown() {
 }
 
 void CMD_Unkown::SharedDtor() {
+  ::google::protobuf::Arena* arena = GetArenaNoVirtual();
+  if (arena != NULL) {
+    return;
+  }
+
 }
 
+void CMD_Unkown::ArenaDtor(void* object) {
+  CMD_Unkown* _this = reinterpret_cast< CMD_Unkown* >(object);
+  (void)_this;
+}
+void CMD_Unkown::RegisterArenaDtor(::google::protobuf::Arena* arena) {
+}
 void CMD_Unkown::SetCachedSize(int size) const {
   GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
   _cached_size_ = size;
@@ -1349,11 +1429,7 @@ const CMD_Unkown& CMD_Unkown::default_instance() {
 }
 
 CMD_Unkown* CMD_Unkown::New(::google::protobuf::Arena* arena) const {
-  CMD_Unkown* n = new CMD_Unkown;
-  if (arena != NULL) {
-    arena->Own(n);
-  }
-  return n;
+  return ::google::protobuf::Arena::CreateMessage<CMD_Unkown>(arena);
 }
 
 void CMD_Unkown::Clear() {
@@ -1452,6 +1528,21 @@ bool CMD_Unkown::IsInitialized() const {
 
 void CMD_Unkown::Swap(CMD_Unkown* other) {
   if (other == this) return;
+  if (GetArenaNoVirtual() == other->GetArenaNoVirtual()) {
+    InternalSwap(other);
+  } else {
+    CMD_Unkown* temp = New(GetArenaNoVirtual());
+    temp->MergeFrom(*other);
+    other->CopyFrom(*this);
+    InternalSwap(temp);
+    if (GetArenaNoVirtual() == NULL) {
+      delete temp;
+    }
+  }
+}
+void CMD_Unkown::UnsafeArenaSwap(CMD_Unkown* other) {
+  if (other == this) return;
+  GOOGLE_DCHECK(GetArenaNoVirtual() == other->GetArenaNoVirtual());
   InternalSwap(other);
 }
 void CMD_Unkown::InternalSwap(CMD_Unkown* other) {
@@ -1476,6 +1567,14 @@ const int CMD_Hello::kAppIDFieldNumber;
 const int CMD_Hello::kAppTypeFieldNumber;
 const int CMD_Hello::kAppGIDFieldNumber;
 const int CMD_Hello::kNameFieldNumber;
+const int CMD_Hello::kFrameVersionFieldNumber;
+const int CMD_Hello::kCompressionFieldNumber;
+const int CMD_Hello::kCompressDictFieldNumber;
+const int CMD_Hello::kCiphersFieldNumber;
+const int CMD_Hello::kCipherKeyFieldNumber;
+const int CMD_Hello::kBatchFieldNumber;
+const int CMD_Hello::kHostIDFieldNumber;
+const int CMD_Hello::kLinkFieldNumber;
 #endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
 
 CMD_Hello::CMD_Hello()
@@ -1486,6 +1585,16 @@ CMD_Hello::CMD_Hello()
   SharedCtor();
   // @@protoc_insertion_point(constructor:CMD_Hello)
 }
+CMD_Hello::CMD_Hello(::google::protobuf::Arena* arena)
+  : ::google::protobuf::Message(),
+  _internal_metadata_(arena) {
+#ifdef GOOGLE_PROTOBUF_NO_STATIC_INITIALIZER
+  protobuf_Commands_2eproto::InitDefaults();
+#endif  // GOOGLE_PROTOBUF_NO_STATIC_INITIALIZER
+  SharedCtor();
+  RegisterArenaDtor(arena);
+  // @@protoc_insertion_point(arena_constructor:CMD_Hello)
+}
 CMD_Hello::CMD_Hello(const CMD_Hello& from)
   : ::google::protobuf::Message(),
       _internal_metadata_(NULL),
@@ -1493,18 +1602,31 @@ CMD_Hello::CMD_Hello(const CMD_Hello& from)
   _internal_metadata_.MergeFrom(from._internal_metadata_);
   name_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
   if (from.name().size() > 0) {
-    name_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.name_);
+    name_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.name(),
+      GetArenaNoVirtual());
+  }
+  cipherkey_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  if (from.cipherkey().size() > 0) {
+    cipherkey_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.cipherkey(),
+      GetArenaNoVirtual());
+  }
+  hostid_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  if (from.hostid().size() > 0) {
+    hostid_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.hostid(),
+      GetArenaNoVirtual());
   }
   ::memcpy(&appid_, &from.appid_,
-    reinterpret_cast<char*>(&appgid_) -
-    reinterpret_cast<char*>(&appid_) + sizeof(appgid_));
+    reinterpret_cast<char*>(&link_) -
+    reinterpret_cast<char*>(&appid_) + sizeof(link_));
   // @@protoc_insertion_point(copy_constructor:CMD_Hello)
 }
 
 void CMD_Hello::SharedCtor() {
   name_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  ::memset(&appid_, 0, reinterpret_cast<char*>(&appgid_) -
-    reinterpret_cast<char*>(&appid_) + sizeof(appgid_));
+  cipherkey_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  hostid_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  ::memset(&appid_, 0, reinterpret_cast<char*>(&link_) -
+    reinterpret_cast<char*>(&appid_) + sizeof(link_));
   _cached_size_ = 0;
 }
 
@@ -1514,9 +1636,22 @@ CMD_Hello::~CMD_Hello() {
 }
 
 void CMD_Hello::SharedDtor() {
-  name_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  ::google::protobuf::Arena* arena = GetArenaNoVirtual();
+  if (arena != NULL) {
+    return;
+  }
+
+  name_.Destroy(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), arena);
+  cipherkey_.Destroy(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), arena);
+  hostid_.Destroy(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), arena);
 }
 
+void CMD_Hello::ArenaDtor(void* object) {
+  CMD_Hello* _this = reinterpret_cast< CMD_Hello* >(object);
+  (void)_this;
+}
+void CMD_Hello::RegisterArenaDtor(::google::protobuf::Arena* arena) {
+}
 void CMD_Hello::SetCachedSize(int size) const {
   GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
   _cached_size_ = size;
@@ -1533,18 +1668,16 @@ const CMD_Hello& CMD_Hello::default_instance() {
 }
 
 CMD_Hello* CMD_Hello::New(::google::protobuf::Arena* arena) const {
-  CMD_Hello* n = new CMD_Hello;
-  if (arena != NULL) {
-    arena->Own(n);
-  }
-  return n;
+  return ::google::protobuf::Arena::CreateMessage<CMD_Hello>(arena);
 }
 
 void CMD_Hello::Clear() {
 // @@protoc_insertion_point(message_clear_start:CMD_Hello)
-  name_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  ::memset(&appid_, 0, reinterpret_cast<char*>(&appgid_) -
-    reinterpret_cast<char*>(&appid_) + sizeof(appgid_));
+  name_.ClearToEmpty(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
+  cipherkey_.ClearToEmpty(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
+  hostid_.ClearToEmpty(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
+  ::memset(&appid_, 0, reinterpret_cast<char*>(&link_) -
+    reinterpret_cast<char*>(&appid_) + sizeof(link_));
 }
 
 bool CMD_Hello::MergePartialFromCodedStream(
@@ -1624,6 +1757,110 @@ bool CMD_Hello::MergePartialFromCodedStream(
         break;
       }
 
+      // uint32 frameVersion = 6;
+      case 6: {
+        if (tag == 48u) {
+
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
+                 input, &frameversion_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // uint32 compression = 7;
+      case 7: {
+        if (tag == 56u) {
+
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
+                 input, &compression_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // uint32 compressDict = 8;
+      case 8: {
+        if (tag == 64u) {
+
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
+                 input, &compressdict_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // uint32 ciphers = 9;
+      case 9: {
+        if (tag == 72u) {
+
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
+                 input, &ciphers_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // bytes cipherKey = 10;
+      case 10: {
+        if (tag == 82u) {
+          DO_(::google::protobuf::internal::WireFormatLite::ReadBytes(
+                input, this->mutable_cipherkey()));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // bool batch = 11;
+      case 11: {
+        if (tag == 88u) {
+
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   bool, ::google::protobuf::internal::WireFormatLite::TYPE_BOOL>(
+                 input, &batch_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // string hostID = 12;
+      case 12: {
+        if (tag == 98u) {
+          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
+                input, this->mutable_hostid()));
+          DO_(::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+            this->hostid().data(), this->hostid().length(),
+            ::google::protobuf::internal::WireFormatLite::PARSE,
+            "CMD_Hello.hostID"));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // uint32 link = 13;
+      case 13: {
+        if (tag == 104u) {
+
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
+                 input, &link_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
       default: {
       handle_unusual:
         if (tag == 0 ||
@@ -1678,6 +1915,52 @@ void CMD_Hello::SerializeWithCachedSizes(
       5, this->name(), output);
   }
 
+  // uint32 frameVersion = 6;
+  if (this->frameversion() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt32(6, this->frameversion(), output);
+  }
+
+  // uint32 compression = 7;
+  if (this->compression() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt32(7, this->compression(), output);
+  }
+
+  // uint32 compressDict = 8;
+  if (this->compressdict() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt32(8, this->compressdict(), output);
+  }
+
+  // uint32 ciphers = 9;
+  if (this->ciphers() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt32(9, this->ciphers(), output);
+  }
+
+  // bytes cipherKey = 10;
+  if (this->cipherkey().size() > 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteBytesMaybeAliased(
+      10, this->cipherkey(), output);
+  }
+
+  // bool batch = 11;
+  if (this->batch() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteBool(11, this->batch(), output);
+  }
+
+  // string hostID = 12;
+  if (this->hostid().size() > 0) {
+    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+      this->hostid().data(), this->hostid().length(),
+      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
+      "CMD_Hello.hostID");
+    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
+      12, this->hostid(), output);
+  }
+
+  // uint32 link = 13;
+  if (this->link() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt32(13, this->link(), output);
+  }
+
   // @@protoc_insertion_point(serialize_end:CMD_Hello)
 }
 
@@ -1716,6 +1999,54 @@ void CMD_Hello::SerializeWithCachedSizes(
         5, this->name(), target);
   }
 
+  // uint32 frameVersion = 6;
+  if (this->frameversion() != 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteUInt32ToArray(6, this->frameversion(), target);
+  }
+
+  // uint32 compression = 7;
+  if (this->compression() != 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteUInt32ToArray(7, this->compression(), target);
+  }
+
+  // uint32 compressDict = 8;
+  if (this->compressdict() != 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteUInt32ToArray(8, this->compressdict(), target);
+  }
+
+  // uint32 ciphers = 9;
+  if (this->ciphers() != 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteUInt32ToArray(9, this->ciphers(), target);
+  }
+
+  // bytes cipherKey = 10;
+  if (this->cipherkey().size() > 0) {
+    target =
+      ::google::protobuf::internal::WireFormatLite::WriteBytesToArray(
+        10, this->cipherkey(), target);
+  }
+
+  // bool batch = 11;
+  if (this->batch() != 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteBoolToArray(11, this->batch(), target);
+  }
+
+  // string hostID = 12;
+  if (this->hostid().size() > 0) {
+    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+      this->hostid().data(), this->hostid().length(),
+      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
+      "CMD_Hello.hostID");
+    target =
+      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
+        12, this->hostid(), target);
+  }
+
+  // uint32 link = 13;
+  if (this->link() != 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteUInt32ToArray(13, this->link(), target);
+  }
+
   // @@protoc_insertion_point(serialize_to_array_end:CMD_Hello)
   return target;
 }
@@ -1731,6 +2062,20 @@ size_t CMD_Hello::ByteSizeLong() const {
         this->name());
   }
 
+  // bytes cipherKey = 10;
+  if (this->cipherkey().size() > 0) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::BytesSize(
+        this->cipherkey());
+  }
+
+  // string hostID = 12;
+  if (this->hostid().size() > 0) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::StringSize(
+        this->hostid());
+  }
+
   // uint64 appID = 2;
   if (this->appid() != 0) {
     total_size += 1 +
@@ -1759,6 +2104,46 @@ size_t CMD_Hello::ByteSizeLong() const {
         this->appgid());
   }
 
+  // uint32 frameVersion = 6;
+  if (this->frameversion() != 0) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::UInt32Size(
+        this->frameversion());
+  }
+
+  // uint32 compression = 7;
+  if (this->compression() != 0) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::UInt32Size(
+        this->compression());
+  }
+
+  // uint32 compressDict = 8;
+  if (this->compressdict() != 0) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::UInt32Size(
+        this->compressdict());
+  }
+
+  // uint32 ciphers = 9;
+  if (this->ciphers() != 0) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::UInt32Size(
+        this->ciphers());
+  }
+
+  // bool batch = 11;
+  if (this->batch() != 0) {
+    total_size += 1 + 1;
+  }
+
+  // uint32 link = 13;
+  if (this->link() != 0) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::UInt32Size(
+        this->link());
+  }
+
   int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
   GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
   _cached_size_ = cached_size;
@@ -1786,8 +2171,13 @@ void CMD_Hello::MergeFrom(const CMD_Hello& from) {
   GOOGLE_DCHECK_NE(&from, this);
   _internal_metadata_.MergeFrom(from._internal_metadata_);
   if (from.name().size() > 0) {
-
-    name_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.name_);
+    set_name(from.name());
+  }
+  if (from.cipherkey().size() > 0) {
+    set_cipherkey(from.cipherkey());
+  }
+  if (from.hostid().size() > 0) {
+    set_hostid(from.hostid());
   }
   if (from.appid() != 0) {
     set_appid(from.appid());
@@ -1801,6 +2191,24 @@ void CMD_Hello::MergeFrom(const CMD_Hello& from) {
   if (from.appgid() != 0) {
     set_appgid(from.appgid());
   }
+  if (from.frameversion() != 0) {
+    set_frameversion(from.frameversion());
+  }
+  if (from.compression() != 0) {
+    set_compression(from.compression());
+  }
+  if (from.compressdict() != 0) {
+    set_compressdict(from.compressdict());
+  }
+  if (from.ciphers() != 0) {
+    set_ciphers(from.ciphers());
+  }
+  if (from.batch() != 0) {
+    set_batch(from.batch());
+  }
+  if (from.link() != 0) {
+    set_link(from.link());
+  }
 }
 
 void CMD_Hello::CopyFrom(const ::google::protobuf::Message& from) {
@@ -1823,14 +2231,37 @@ bool CMD_Hello::IsInitialized() const {
 
 void CMD_Hello::Swap(CMD_Hello* other) {
   if (other == this) return;
+  if (GetArenaNoVirtual() == other->GetArenaNoVirtual()) {
+    InternalSwap(other);
+  } else {
+    CMD_Hello* temp = New(GetArenaNoVirtual());
+    temp->MergeFrom(*other);
+    other->CopyFrom(*this);
+    InternalSwap(temp);
+    if (GetArenaNoVirtual() == NULL) {
+      delete temp;
+    }
+  }
+}
+void CMD_Hello::UnsafeArenaSwap(CMD_Hello* other) {
+  if (other == this) return;
+  GOOGLE_DCHECK(GetArenaNoVirtual() == other->GetArenaNoVirtual());
   InternalSwap(other);
 }
 void CMD_Hello::InternalSwap(CMD_Hello* other) {
   name_.Swap(&other->name_);
+  cipherkey_.Swap(&other->cipherkey_);
+  hostid_.Swap(&other->hostid_);
   std::swap(appid_, other->appid_);
   std::swap(version_, other->version_);
   std::swap(apptype_, other->apptype_);
   std::swap(appgid_, other->appgid_);
+  std::swap(frameversion_, other->frameversion_);
+  std::swap(compression_, other->compression_);
+  std::swap(compressdict_, other->compressdict_);
+  std::swap(ciphers_, other->ciphers_);
+  std::swap(batch_, other->batch_);
+  std::swap(link_, other->link_);
   std::swap(_cached_size_, other->_cached_size_);
 }
 
@@ -1900,45 +2331,46 @@ void CMD_Hello::set_appgid(::google::protobuf::uint64 value) {
 
 // string name = 5;
 void CMD_Hello::clear_name() {
-  name_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  name_.ClearToEmpty(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 const ::std::string& CMD_Hello::name() const {
   // @@protoc_insertion_point(field_get:CMD_Hello.name)
-  return name_.GetNoArena();
+  return name_.Get();
 }
 void CMD_Hello::set_name(const ::std::string& value) {
   
-  name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  name_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value, GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set:CMD_Hello.name)
 }
-#if LANG_CXX11
-void CMD_Hello::set_name(::std::string&& value) {
-  
-  name_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:CMD_Hello.name)
-}
-#endif
 void CMD_Hello::set_name(const char* value) {
   
-  name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  name_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+              GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_char:CMD_Hello.name)
 }
-void CMD_Hello::set_name(const char* value, size_t size) {
+void CMD_Hello::set_name(const char* value,
+    size_t size) {
   
-  name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
+  name_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_pointer:CMD_Hello.name)
 }
 ::std::string* CMD_Hello::mutable_name() {
   
   // @@protoc_insertion_point(field_mutable:CMD_Hello.name)
-  return name_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return name_.Mutable(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 ::std::string* CMD_Hello::release_name() {
   // @@protoc_insertion_point(field_release:CMD_Hello.name)
   
-  return name_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return name_.Release(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
+}
+::std::string* CMD_Hello::unsafe_arena_release_name() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:CMD_Hello.name)
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  
+  return name_.UnsafeArenaRelease(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      GetArenaNoVirtual());
 }
 void CMD_Hello::set_allocated_name(::std::string* name) {
   if (name != NULL) {
@@ -1946,9 +2378,238 @@ void CMD_Hello::set_allocated_name(::std::string* name) {
   } else {
     
   }
-  name_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), name);
+  name_.SetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), name,
+      GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_allocated:CMD_Hello.name)
 }
+void CMD_Hello::unsafe_arena_set_allocated_name(
+    ::std::string* name) {
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  if (name != NULL) {
+    
+  } else {
+    
+  }
+  name_.UnsafeArenaSetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      name, GetArenaNoVirtual());
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:CMD_Hello.name)
+}
+
+// uint32 frameVersion = 6;
+void CMD_Hello::clear_frameversion() {
+  frameversion_ = 0u;
+}
+::google::protobuf::uint32 CMD_Hello::frameversion() const {
+  // @@protoc_insertion_point(field_get:CMD_Hello.frameVersion)
+  return frameversion_;
+}
+void CMD_Hello::set_frameversion(::google::protobuf::uint32 value) {
+  
+  frameversion_ = value;
+  // @@protoc_insertion_point(field_set:CMD_Hello.frameVersion)
+}
+
+// uint32 compression = 7;
+void CMD_Hello::clear_compression() {
+  compression_ = 0u;
+}
+::google::protobuf::uint32 CMD_Hello::compression() const {
+  // @@protoc_insertion_point(field_get:CMD_Hello.compression)
+  return compression_;
+}
+void CMD_Hello::set_compression(::google::protobuf::uint32 value) {
+  
+  compression_ = value;
+  // @@protoc_insertion_point(field_set:CMD_Hello.compression)
+}
+
+// uint32 compressDict = 8;
+void CMD_Hello::clear_compressdict() {
+  compressdict_ = 0u;
+}
+::google::protobuf::uint32 CMD_Hello::compressdict() const {
+  // @@protoc_insertion_point(field_get:CMD_Hello.compressDict)
+  return compressdict_;
+}
+void CMD_Hello::set_compressdict(::google::protobuf::uint32 value) {
+  
+  compressdict_ = value;
+  // @@protoc_insertion_point(field_set:CMD_Hello.compressDict)
+}
+
+// uint32 ciphers = 9;
+void CMD_Hello::clear_ciphers() {
+  ciphers_ = 0u;
+}
+::google::protobuf::uint32 CMD_Hello::ciphers() const {
+  // @@protoc_insertion_point(field_get:CMD_Hello.ciphers)
+  return ciphers_;
+}
+void CMD_Hello::set_ciphers(::google::protobuf::uint32 value) {
+  
+  ciphers_ = value;
+  // @@protoc_insertion_point(field_set:CMD_Hello.ciphers)
+}
+
+// bytes cipherKey = 10;
+void CMD_Hello::clear_cipherkey() {
+  cipherkey_.ClearToEmpty(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
+}
+const ::std::string& CMD_Hello::cipherkey() const {
+  // @@protoc_insertion_point(field_get:CMD_Hello.cipherKey)
+  return cipherkey_.Get();
+}
+void CMD_Hello::set_cipherkey(const ::std::string& value) {
+  
+  cipherkey_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value, GetArenaNoVirtual());
+  // @@protoc_insertion_point(field_set:CMD_Hello.cipherKey)
+}
+void CMD_Hello::set_cipherkey(const char* value) {
+  
+  cipherkey_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+              GetArenaNoVirtual());
+  // @@protoc_insertion_point(field_set_char:CMD_Hello.cipherKey)
+}
+void CMD_Hello::set_cipherkey(const void* value,
+    size_t size) {
+  
+  cipherkey_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArenaNoVirtual());
+  // @@protoc_insertion_point(field_set_pointer:CMD_Hello.cipherKey)
+}
+::std::string* CMD_Hello::mutable_cipherkey() {
+  
+  // @@protoc_insertion_point(field_mutable:CMD_Hello.cipherKey)
+  return cipherkey_.Mutable(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
+}
+::std::string* CMD_Hello::release_cipherkey() {
+  // @@protoc_insertion_point(field_release:CMD_Hello.cipherKey)
+  
+  return cipherkey_.Release(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
+}
+::std::string* CMD_Hello::unsafe_arena_release_cipherkey() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:CMD_Hello.cipherKey)
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  
+  return cipherkey_.UnsafeArenaRelease(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      GetArenaNoVirtual());
+}
+void CMD_Hello::set_allocated_cipherkey(::std::string* cipherkey) {
+  if (cipherkey != NULL) {
+    
+  } else {
+    
+  }
+  cipherkey_.SetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), cipherkey,
+      GetArenaNoVirtual());
+  // @@protoc_insertion_point(field_set_allocated:CMD_Hello.cipherKey)
+}
+void CMD_Hello::unsafe_arena_set_allocated_cipherkey(
+    ::std::string* cipherkey) {
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  if (cipherkey != NULL) {
+    
+  } else {
+    
+  }
+  cipherkey_.UnsafeArenaSetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      cipherkey, GetArenaNoVirtual());
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:CMD_Hello.cipherKey)
+}
+
+// bool batch = 11;
+void CMD_Hello::clear_batch() {
+  batch_ = false;
+}
+bool CMD_Hello::batch() const {
+  // @@protoc_insertion_point(field_get:CMD_Hello.batch)
+  return batch_;
+}
+void CMD_Hello::set_batch(bool value) {
+  
+  batch_ = value;
+  // @@protoc_insertion_point(field_set:CMD_Hello.batch)
+}
+
+// string hostID = 12;
+void CMD_Hello::clear_hostid() {
+  hostid_.ClearToEmpty(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
+}
+const ::std::string& CMD_Hello::hostid() const {
+  // @@protoc_insertion_point(field_get:CMD_Hello.hostID)
+  return hostid_.Get();
+}
+void CMD_Hello::set_hostid(const ::std::string& value) {
+  
+  hostid_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value, GetArenaNoVirtual());
+  // @@protoc_insertion_point(field_set:CMD_Hello.hostID)
+}
+void CMD_Hello::set_hostid(const char* value) {
+  
+  hostid_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+              GetArenaNoVirtual());
+  // @@protoc_insertion_point(field_set_char:CMD_Hello.hostID)
+}
+void CMD_Hello::set_hostid(const char* value,
+    size_t size) {
+  
+  hostid_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArenaNoVirtual());
+  // @@protoc_insertion_point(field_set_pointer:CMD_Hello.hostID)
+}
+::std::string* CMD_Hello::mutable_hostid() {
+  
+  // @@protoc_insertion_point(field_mutable:CMD_Hello.hostID)
+  return hostid_.Mutable(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
+}
+::std::string* CMD_Hello::release_hostid() {
+  // @@protoc_insertion_point(field_release:CMD_Hello.hostID)
+  
+  return hostid_.Release(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
+}
+::std::string* CMD_Hello::unsafe_arena_release_hostid() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:CMD_Hello.hostID)
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  
+  return hostid_.UnsafeArenaRelease(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      GetArenaNoVirtual());
+}
+void CMD_Hello::set_allocated_hostid(::std::string* hostid) {
+  if (hostid != NULL) {
+    
+  } else {
+    
+  }
+  hostid_.SetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), hostid,
+      GetArenaNoVirtual());
+  // @@protoc_insertion_point(field_set_allocated:CMD_Hello.hostID)
+}
+void CMD_Hello::unsafe_arena_set_allocated_hostid(
+    ::std::string* hostid) {
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  if (hostid != NULL) {
+    
+  } else {
+    
+  }
+  hostid_.UnsafeArenaSetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      hostid, GetArenaNoVirtual());
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:CMD_Hello.hostID)
+}
+
+// uint32 link = 13;
+void CMD_Hello::clear_link() {
+  link_ = 0u;
+}
+::google::protobuf::uint32 CMD_Hello::link() const {
+  // @@protoc_insertion_point(field_get:CMD_Hello.link)
+  return link_;
+}
+void CMD_Hello::set_link(::google::protobuf::uint32 value) {
+  
+  link_ = value;
+  // @@protoc_insertion_point(field_set:CMD_Hello.link)
+}
 
 #endif  // PROTOBUF_INLINE_NOT_IN_HEADERS
 
@@ -1960,6 +2621,13 @@ const int CMD_HelloCB::kAppIDFieldNumber;
 const int CMD_HelloCB::kAppTypeFieldNumber;
 const int CMD_HelloCB::kAppGIDFieldNumber;
 const int CMD_HelloCB::kNameFieldNumber;
+const int CMD_HelloCB::kFrameVersionFieldNumber;
+const int CMD_HelloCB::kCompressionFieldNumber;
+const int CMD_HelloCB::kCompressDictFieldNumber;
+const int CMD_HelloCB::kCipherFieldNumber;
+const int CMD_HelloCB::kCipherKeyFieldNumber;
+const int CMD_HelloCB::kBatchFieldNumber;
+const int CMD_HelloCB::kShmNameFieldNumber;
 #endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
 
 CMD_HelloCB::CMD_HelloCB()
@@ -1970,6 +2638,16 @@ CMD_HelloCB::CMD_HelloCB()
   SharedCtor();
   // @@protoc_insertion_point(constructor:CMD_HelloCB)
 }
+CMD_HelloCB::CMD_HelloCB(::google::protobuf::Arena* arena)
+  : ::google::protobuf::Message(),
+  _internal_metadata_(arena) {
+#ifdef GOOGLE_PROTOBUF_NO_STATIC_INITIALIZER
+  protobuf_Commands_2eproto::InitDefaults();
+#endif  // GOOGLE_PROTOBUF_NO_STATIC_INITIALIZER
+  SharedCtor();
+  RegisterArenaDtor(arena);
+  // @@protoc_insertion_point(arena_constructor:CMD_HelloCB)
+}
 CMD_HelloCB::CMD_HelloCB(const CMD_HelloCB& from)
   : ::google::protobuf::Message(),
       _internal_metadata_(NULL),
@@ -1977,18 +2655,31 @@ CMD_HelloCB::CMD_HelloCB(const CMD_HelloCB& from)
   _internal_metadata_.MergeFrom(from._internal_metadata_);
   name_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
   if (from.name().size() > 0) {
-    name_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.name_);
+    name_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.name(),
+      GetArenaNoVirtual());
+  }
+  cipherkey_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  if (from.cipherkey().size() > 0) {
+    cipherkey_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.cipherkey(),
+      GetArenaNoVirtual());
+  }
+  shmname_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  if (from.shmname().size() > 0) {
+    shmname_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.shmname(),
+      GetArenaNoVirtual());
   }
   ::memcpy(&appid_, &from.appid_,
-    reinterpret_cast<char*>(&appgid_) -
-    reinterpret_cast<char*>(&appid_) + sizeof(appgid_));
+    reinterpret_cast<char*>(&batch_) -
+    reinterpret_cast<char*>(&appid_) + sizeof(batch_));
   // @@protoc_insertion_point(copy_constructor:CMD_HelloCB)
 }
 
 void CMD_HelloCB::SharedCtor() {
   name_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  ::memset(&appid_, 0, reinterpret_cast<char*>(&appgid_) -
-    reinterpret_cast<char*>(&appid_) + sizeof(appgid_));
+  cipherkey_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  shmname_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  ::memset(&appid_, 0, reinterpret_cast<char*>(&batch_) -
+    reinterpret_cast<char*>(&appid_) + sizeof(batch_));
   _cached_size_ = 0;
 }
 
@@ -1998,9 +2689,22 @@ CMD_HelloCB::~CMD_HelloCB() {
 }
 
 void CMD_HelloCB::SharedDtor() {
-  name_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  ::google::protobuf::Arena* arena = GetArenaNoVirtual();
+  if (arena != NULL) {
+    return;
+  }
+
+  name_.Destroy(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), arena);
+  cipherkey_.Destroy(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), arena);
+  shmname_.Destroy(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), arena);
 }
 
+void CMD_HelloCB::ArenaDtor(void* object) {
+  CMD_HelloCB* _this = reinterpret_cast< CMD_HelloCB* >(object);
+  (void)_this;
+}
+void CMD_HelloCB::RegisterArenaDtor(::google::protobuf::Arena* arena) {
+}
 void CMD_HelloCB::SetCachedSize(int size) const {
   GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
   _cached_size_ = size;
@@ -2017,18 +2721,16 @@ const CMD_HelloCB& CMD_HelloCB::default_instance() {
 }
 
 CMD_HelloCB* CMD_HelloCB::New(::google::protobuf::Arena* arena) const {
-  CMD_HelloCB* n = new CMD_HelloCB;
-  if (arena != NULL) {
-    arena->Own(n);
-  }
-  return n;
+  return ::google::protobuf::Arena::CreateMessage<CMD_HelloCB>(arena);
 }
 
 void CMD_HelloCB::Clear() {
 // @@protoc_insertion_point(message_clear_start:CMD_HelloCB)
-  name_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  ::memset(&appid_, 0, reinterpret_cast<char*>(&appgid_) -
-    reinterpret_cast<char*>(&appid_) + sizeof(appgid_));
+  name_.ClearToEmpty(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
+  cipherkey_.ClearToEmpty(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
+  shmname_.ClearToEmpty(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
+  ::memset(&appid_, 0, reinterpret_cast<char*>(&batch_) -
+    reinterpret_cast<char*>(&appid_) + sizeof(batch_));
 }
 
 bool CMD_HelloCB::MergePartialFromCodedStream(
@@ -2108,6 +2810,97 @@ bool CMD_HelloCB::MergePartialFromCodedStream(
         break;
       }
 
+      // uint32 frameVersion = 6;
+      case 6: {
+        if (tag == 48u) {
+
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
+                 input, &frameversion_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // uint32 compression = 7;
+      case 7: {
+        if (tag == 56u) {
+
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
+                 input, &compression_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // uint32 compressDict = 8;
+      case 8: {
+        if (tag == 64u) {
+
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
+                 input, &compressdict_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // uint32 cipher = 9;
+      case 9: {
+        if (tag == 72u) {
+
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
+                 input, &cipher_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // bytes cipherKey = 10;
+      case 10: {
+        if (tag == 82u) {
+          DO_(::google::protobuf::internal::WireFormatLite::ReadBytes(
+                input, this->mutable_cipherkey()));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // bool batch = 11;
+      case 11: {
+        if (tag == 88u) {
+
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   bool, ::google::protobuf::internal::WireFormatLite::TYPE_BOOL>(
+                 input, &batch_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // string shmName = 12;
+      case 12: {
+        if (tag == 98u) {
+          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
+                input, this->mutable_shmname()));
+          DO_(::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+            this->shmname().data(), this->shmname().length(),
+            ::google::protobuf::internal::WireFormatLite::PARSE,
+            "CMD_HelloCB.shmName"));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
       default: {
       handle_unusual:
         if (tag == 0 ||
@@ -2162,12 +2955,53 @@ void CMD_HelloCB::SerializeWithCachedSizes(
       5, this->name(), output);
   }
 
-  // @@protoc_insertion_point(serialize_end:CMD_HelloCB)
-}
+  // uint32 frameVersion = 6;
+  if (this->frameversion() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt32(6, this->frameversion(), output);
+  }
 
-::google::protobuf::uint8* CMD_HelloCB::InternalSerializeWithCachedSizesToArray(
-    bool deterministic, ::google::protobuf::uint8* target) const {
-  (void)deterministic;  // Unused
+  // uint32 compression = 7;
+  if (this->compression() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt32(7, this->compression(), output);
+  }
+
+  // uint32 compressDict = 8;
+  if (this->compressdict() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt32(8, this->compressdict(), output);
+  }
+
+  // uint32 cipher = 9;
+  if (this->cipher() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt32(9, this->cipher(), output);
+  }
+
+  // bytes cipherKey = 10;
+  if (this->cipherkey().size() > 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteBytesMaybeAliased(
+      10, this->cipherkey(), output);
+  }
+
+  // bool batch = 11;
+  if (this->batch() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteBool(11, this->batch(), output);
+  }
+
+  // string shmName = 12;
+  if (this->shmname().size() > 0) {
+    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+      this->shmname().data(), this->shmname().length(),
+      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
+      "CMD_HelloCB.shmName");
+    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
+      12, this->shmname(), output);
+  }
+
+  // @@protoc_insertion_point(serialize_end:CMD_HelloCB)
+}
+
+::google::protobuf::uint8* CMD_HelloCB::InternalSerializeWithCachedSizesToArray(
+    bool deterministic, ::google::protobuf::uint8* target) const {
+  (void)deterministic;  // Unused
   // @@protoc_insertion_point(serialize_to_array_start:CMD_HelloCB)
   // int32 version = 1;
   if (this->version() != 0) {
@@ -2200,6 +3034,49 @@ void CMD_HelloCB::SerializeWithCachedSizes(
         5, this->name(), target);
   }
 
+  // uint32 frameVersion = 6;
+  if (this->frameversion() != 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteUInt32ToArray(6, this->frameversion(), target);
+  }
+
+  // uint32 compression = 7;
+  if (this->compression() != 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteUInt32ToArray(7, this->compression(), target);
+  }
+
+  // uint32 compressDict = 8;
+  if (this->compressdict() != 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteUInt32ToArray(8, this->compressdict(), target);
+  }
+
+  // uint32 cipher = 9;
+  if (this->cipher() != 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteUInt32ToArray(9, this->cipher(), target);
+  }
+
+  // bytes cipherKey = 10;
+  if (this->cipherkey().size() > 0) {
+    target =
+      ::google::protobuf::internal::WireFormatLite::WriteBytesToArray(
+        10, this->cipherkey(), target);
+  }
+
+  // bool batch = 11;
+  if (this->batch() != 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteBoolToArray(11, this->batch(), target);
+  }
+
+  // string shmName = 12;
+  if (this->shmname().size() > 0) {
+    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+      this->shmname().data(), this->shmname().length(),
+      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
+      "CMD_HelloCB.shmName");
+    target =
+      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
+        12, this->shmname(), target);
+  }
+
   // @@protoc_insertion_point(serialize_to_array_end:CMD_HelloCB)
   return target;
 }
@@ -2215,6 +3092,20 @@ size_t CMD_HelloCB::ByteSizeLong() const {
         this->name());
   }
 
+  // bytes cipherKey = 10;
+  if (this->cipherkey().size() > 0) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::BytesSize(
+        this->cipherkey());
+  }
+
+  // string shmName = 12;
+  if (this->shmname().size() > 0) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::StringSize(
+        this->shmname());
+  }
+
   // uint64 appID = 2;
   if (this->appid() != 0) {
     total_size += 1 +
@@ -2243,6 +3134,39 @@ size_t CMD_HelloCB::ByteSizeLong() const {
         this->appgid());
   }
 
+  // uint32 frameVersion = 6;
+  if (this->frameversion() != 0) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::UInt32Size(
+        this->frameversion());
+  }
+
+  // uint32 compression = 7;
+  if (this->compression() != 0) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::UInt32Size(
+        this->compression());
+  }
+
+  // uint32 compressDict = 8;
+  if (this->compressdict() != 0) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::UInt32Size(
+        this->compressdict());
+  }
+
+  // uint32 cipher = 9;
+  if (this->cipher() != 0) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::UInt32Size(
+        this->cipher());
+  }
+
+  // bool batch = 11;
+  if (this->batch() != 0) {
+    total_size += 1 + 1;
+  }
+
   int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
   GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
   _cached_size_ = cached_size;
@@ -2270,8 +3194,13 @@ void CMD_HelloCB::MergeFrom(const CMD_HelloCB& from) {
   GOOGLE_DCHECK_NE(&from, this);
   _internal_metadata_.MergeFrom(from._internal_metadata_);
   if (from.name().size() > 0) {
-
-    name_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.name_);
+    set_name(from.name());
+  }
+  if (from.cipherkey().size() > 0) {
+    set_cipherkey(from.cipherkey());
+  }
+  if (from.shmname().size() > 0) {
+    set_shmname(from.shmname());
   }
   if (from.appid() != 0) {
     set_appid(from.appid());
@@ -2285,6 +3214,21 @@ void CMD_HelloCB::MergeFrom(const CMD_HelloCB& from) {
   if (from.appgid() != 0) {
     set_appgid(from.appgid());
   }
+  if (from.frameversion() != 0) {
+    set_frameversion(from.frameversion());
+  }
+  if (from.compression() != 0) {
+    set_compression(from.compression());
+  }
+  if (from.compressdict() != 0) {
+    set_compressdict(from.compressdict());
+  }
+  if (from.cipher() != 0) {
+    set_cipher(from.cipher());
+  }
+  if (from.batch() != 0) {
+    set_batch(from.batch());
+  }
 }
 
 void CMD_HelloCB::CopyFrom(const ::google::protobuf::Message& from) {
@@ -2307,14 +3251,36 @@ bool CMD_HelloCB::IsInitialized() const {
 
 void CMD_HelloCB::Swap(CMD_HelloCB* other) {
   if (other == this) return;
+  if (GetArenaNoVirtual() == other->GetArenaNoVirtual()) {
+    InternalSwap(other);
+  } else {
+    CMD_HelloCB* temp = New(GetArenaNoVirtual());
+    temp->MergeFrom(*other);
+    other->CopyFrom(*this);
+    InternalSwap(temp);
+    if (GetArenaNoVirtual() == NULL) {
+      delete temp;
+    }
+  }
+}
+void CMD_HelloCB::UnsafeArenaSwap(CMD_HelloCB* other) {
+  if (other == this) return;
+  GOOGLE_DCHECK(GetArenaNoVirtual() == other->GetArenaNoVirtual());
   InternalSwap(other);
 }
 void CMD_HelloCB::InternalSwap(CMD_HelloCB* other) {
   name_.Swap(&other->name_);
+  cipherkey_.Swap(&other->cipherkey_);
+  shmname_.Swap(&other->shmname_);
   std::swap(appid_, other->appid_);
   std::swap(version_, other->version_);
   std::swap(apptype_, other->apptype_);
   std::swap(appgid_, other->appgid_);
+  std::swap(frameversion_, other->frameversion_);
+  std::swap(compression_, other->compression_);
+  std::swap(compressdict_, other->compressdict_);
+  std::swap(cipher_, other->cipher_);
+  std::swap(batch_, other->batch_);
   std::swap(_cached_size_, other->_cached_size_);
 }
 
@@ -2384,45 +3350,46 @@ void CMD_HelloCB::set_appgid(::google::protobuf::uint64 value) {
 
 // string name = 5;
 void CMD_HelloCB::clear_name() {
-  name_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  name_.ClearToEmpty(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 const ::std::string& CMD_HelloCB::name() const {
   // @@protoc_insertion_point(field_get:CMD_HelloCB.name)
-  return name_.GetNoArena();
+  return name_.Get();
 }
 void CMD_HelloCB::set_name(const ::std::string& value) {
   
-  name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  name_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value, GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set:CMD_HelloCB.name)
 }
-#if LANG_CXX11
-void CMD_HelloCB::set_name(::std::string&& value) {
-  
-  name_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:CMD_HelloCB.name)
-}
-#endif
 void CMD_HelloCB::set_name(const char* value) {
   
-  name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  name_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+              GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_char:CMD_HelloCB.name)
 }
-void CMD_HelloCB::set_name(const char* value, size_t size) {
+void CMD_HelloCB::set_name(const char* value,
+    size_t size) {
   
-  name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
+  name_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_pointer:CMD_HelloCB.name)
 }
 ::std::string* CMD_HelloCB::mutable_name() {
   
   // @@protoc_insertion_point(field_mutable:CMD_HelloCB.name)
-  return name_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return name_.Mutable(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 ::std::string* CMD_HelloCB::release_name() {
   // @@protoc_insertion_point(field_release:CMD_HelloCB.name)
   
-  return name_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return name_.Release(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
+}
+::std::string* CMD_HelloCB::unsafe_arena_release_name() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:CMD_HelloCB.name)
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  
+  return name_.UnsafeArenaRelease(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      GetArenaNoVirtual());
 }
 void CMD_HelloCB::set_allocated_name(::std::string* name) {
   if (name != NULL) {
@@ -2430,111 +3397,325 @@ void CMD_HelloCB::set_allocated_name(::std::string* name) {
   } else {
     
   }
-  name_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), name);
+  name_.SetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), name,
+      GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_allocated:CMD_HelloCB.name)
 }
+void CMD_HelloCB::unsafe_arena_set_allocated_name(
+    ::std::string* name) {
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  if (name != NULL) {
+    
+  } else {
+    
+  }
+  name_.UnsafeArenaSetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      name, GetArenaNoVirtual());
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:CMD_HelloCB.name)
+}
+
+// uint32 frameVersion = 6;
+void CMD_HelloCB::clear_frameversion() {
+  frameversion_ = 0u;
+}
+::google::protobuf::uint32 CMD_HelloCB::frameversion() const {
+  // @@protoc_insertion_point(field_get:CMD_HelloCB.frameVersion)
+  return frameversion_;
+}
+void CMD_HelloCB::set_frameversion(::google::protobuf::uint32 value) {
+  
+  frameversion_ = value;
+  // @@protoc_insertion_point(field_set:CMD_HelloCB.frameVersion)
+}
+
+// uint32 compression = 7;
+void CMD_HelloCB::clear_compression() {
+  compression_ = 0u;
+}
+::google::protobuf::uint32 CMD_HelloCB::compression() const {
+  // @@protoc_insertion_point(field_get:CMD_HelloCB.compression)
+  return compression_;
+}
+void CMD_HelloCB::set_compression(::google::protobuf::uint32 value) {
+  
+  compression_ = value;
+  // @@protoc_insertion_point(field_set:CMD_HelloCB.compression)
+}
+
+// uint32 compressDict = 8;
+void CMD_HelloCB::clear_compressdict() {
+  compressdict_ = 0u;
+}
+::google::protobuf::uint32 CMD_HelloCB::compressdict() const {
+  // @@protoc_insertion_point(field_get:CMD_HelloCB.compressDict)
+  return compressdict_;
+}
+void CMD_HelloCB::set_compressdict(::google::protobuf::uint32 value) {
+  
+  compressdict_ = value;
+  // @@protoc_insertion_point(field_set:CMD_HelloCB.compressDict)
+}
+
+// uint32 cipher = 9;
+void CMD_HelloCB::clear_cipher() {
+  cipher_ = 0u;
+}
+::google::protobuf::uint32 CMD_HelloCB::cipher() const {
+  // @@protoc_insertion_point(field_get:CMD_HelloCB.cipher)
+  return cipher_;
+}
+void CMD_HelloCB::set_cipher(::google::protobuf::uint32 value) {
+  
+  cipher_ = value;
+  // @@protoc_insertion_point(field_set:CMD_HelloCB.cipher)
+}
+
+// bytes cipherKey = 10;
+void CMD_HelloCB::clear_cipherkey() {
+  cipherkey_.ClearToEmpty(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
+}
+const ::std::string& CMD_HelloCB::cipherkey() const {
+  // @@protoc_insertion_point(field_get:CMD_HelloCB.cipherKey)
+  return cipherkey_.Get();
+}
+void CMD_HelloCB::set_cipherkey(const ::std::string& value) {
+  
+  cipherkey_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value, GetArenaNoVirtual());
+  // @@protoc_insertion_point(field_set:CMD_HelloCB.cipherKey)
+}
+void CMD_HelloCB::set_cipherkey(const char* value) {
+  
+  cipherkey_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+              GetArenaNoVirtual());
+  // @@protoc_insertion_point(field_set_char:CMD_HelloCB.cipherKey)
+}
+void CMD_HelloCB::set_cipherkey(const void* value,
+    size_t size) {
+  
+  cipherkey_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArenaNoVirtual());
+  // @@protoc_insertion_point(field_set_pointer:CMD_HelloCB.cipherKey)
+}
+::std::string* CMD_HelloCB::mutable_cipherkey() {
+  
+  // @@protoc_insertion_point(field_mutable:CMD_HelloCB.cipherKey)
+  return cipherkey_.Mutable(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
+}
+::std::string* CMD_HelloCB::release_cipherkey() {
+  // @@protoc_insertion_point(field_release:CMD_HelloCB.cipherKey)
+  
+  return cipherkey_.Release(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
+}
+::std::string* CMD_HelloCB::unsafe_arena_release_cipherkey() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:CMD_HelloCB.cipherKey)
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  
+  return cipherkey_.UnsafeArenaRelease(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      GetArenaNoVirtual());
+}
+void CMD_HelloCB::set_allocated_cipherkey(::std::string* cipherkey) {
+  if (cipherkey != NULL) {
+    
+  } else {
+    
+  }
+  cipherkey_.SetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), cipherkey,
+      GetArenaNoVirtual());
+  // @@protoc_insertion_point(field_set_allocated:CMD_HelloCB.cipherKey)
+}
+void CMD_HelloCB::unsafe_arena_set_allocated_cipherkey(
+    ::std::string* cipherkey) {
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  if (cipherkey != NULL) {
+    
+  } else {
+    
+  }
+  cipherkey_.UnsafeArenaSetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      cipherkey, GetArenaNoVirtual());
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:CMD_HelloCB.cipherKey)
+}
+
+// bool batch = 11;
+void CMD_HelloCB::clear_batch() {
+  batch_ = false;
+}
+bool CMD_HelloCB::batch() const {
+  // @@protoc_insertion_point(field_get:CMD_HelloCB.batch)
+  return batch_;
+}
+void CMD_HelloCB::set_batch(bool value) {
+  
+  batch_ = value;
+  // @@protoc_insertion_point(field_set:CMD_HelloCB.batch)
+}
+
+// string shmName = 12;
+void CMD_HelloCB::clear_shmname() {
+  shmname_.ClearToEmpty(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
+}
+const ::std::string& CMD_HelloCB::shmname() const {
+  // @@protoc_insertion_point(field_get:CMD_HelloCB.shmName)
+  return shmname_.Get();
+}
+void CMD_HelloCB::set_shmname(const ::std::string& value) {
+  
+  shmname_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value, GetArenaNoVirtual());
+  // @@protoc_insertion_point(field_set:CMD_HelloCB.shmName)
+}
+void CMD_HelloCB::set_shmname(const char* value) {
+  
+  shmname_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+              GetArenaNoVirtual());
+  // @@protoc_insertion_point(field_set_char:CMD_HelloCB.shmName)
+}
+void CMD_HelloCB::set_shmname(const char* value,
+    size_t size) {
+  
+  shmname_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArenaNoVirtual());
+  // @@protoc_insertion_point(field_set_pointer:CMD_HelloCB.shmName)
+}
+::std::string* CMD_HelloCB::mutable_shmname() {
+  
+  // @@protoc_insertion_point(field_mutable:CMD_HelloCB.shmName)
+  return shmname_.Mutable(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
+}
+::std::string* CMD_HelloCB::release_shmname() {
+  // @@protoc_insertion_point(field_release:CMD_HelloCB.shmName)
+  
+  return shmname_.Release(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
+}
+::std::string* CMD_HelloCB::unsafe_arena_release_shmname() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:CMD_HelloCB.shmName)
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  
+  return shmname_.UnsafeArenaRelease(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      GetArenaNoVirtual());
+}
+void CMD_HelloCB::set_allocated_shmname(::std::string* shmname) {
+  if (shmname != NULL) {
+    
+  } else {
+    
+  }
+  shmname_.SetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), shmname,
+      GetArenaNoVirtual());
+  // @@protoc_insertion_point(field_set_allocated:CMD_HelloCB.shmName)
+}
+void CMD_HelloCB::unsafe_arena_set_allocated_shmname(
+    ::std::string* shmname) {
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  if (shmname != NULL) {
+    
+  } else {
+    
+  }
+  shmname_.UnsafeArenaSetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      shmname, GetArenaNoVirtual());
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:CMD_HelloCB.shmName)
+}
 
 #endif  // PROTOBUF_INLINE_NOT_IN_HEADERS
 
 // ===================================================================
 
 #if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int CMD_Heartbeat::kAppIDFieldNumber;
-const int CMD_Heartbeat::kAppTypeFieldNumber;
+const int CMD_FrameUpgrade::kVersionFieldNumber;
 #endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
 
-CMD_Heartbeat::CMD_Heartbeat()
+CMD_FrameUpgrade::CMD_FrameUpgrade()
   : ::google::protobuf::Message(), _internal_metadata_(NULL) {
   if (GOOGLE_PREDICT_TRUE(this != internal_default_instance())) {
     protobuf_Commands_2eproto::InitDefaults();
   }
   SharedCtor();
-  // @@protoc_insertion_point(constructor:CMD_Heartbeat)
+  // @@protoc_insertion_point(constructor:CMD_FrameUpgrade)
 }
-CMD_Heartbeat::CMD_Heartbeat(const CMD_Heartbeat& from)
+CMD_FrameUpgrade::CMD_FrameUpgrade(::google::protobuf::Arena* arena)
+  : ::google::protobuf::Message(),
+  _internal_metadata_(arena) {
+#ifdef GOOGLE_PROTOBUF_NO_STATIC_INITIALIZER
+  protobuf_Commands_2eproto::InitDefaults();
+#endif  // GOOGLE_PROTOBUF_NO_STATIC_INITIALIZER
+  SharedCtor();
+  RegisterArenaDtor(arena);
+  // @@protoc_insertion_point(arena_constructor:CMD_FrameUpgrade)
+}
+CMD_FrameUpgrade::CMD_FrameUpgrade(const CMD_FrameUpgrade& from)
   : ::google::protobuf::Message(),
       _internal_metadata_(NULL),
       _cached_size_(0) {
   _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::memcpy(&appid_, &from.appid_,
-    reinterpret_cast<char*>(&apptype_) -
-    reinterpret_cast<char*>(&appid_) + sizeof(apptype_));
-  // @@protoc_insertion_point(copy_constructor:CMD_Heartbeat)
+  version_ = from.version_;
+  // @@protoc_insertion_point(copy_constructor:CMD_FrameUpgrade)
 }
 
-void CMD_Heartbeat::SharedCtor() {
-  ::memset(&appid_, 0, reinterpret_cast<char*>(&apptype_) -
-    reinterpret_cast<char*>(&appid_) + sizeof(apptype_));
+void CMD_FrameUpgrade::SharedCtor() {
+  version_ = 0u;
   _cached_size_ = 0;
 }
 
-CMD_Heartbeat::~CMD_Heartbeat() {
-  // @@protoc_insertion_point(destructor:CMD_Heartbeat)
+CMD_FrameUpgrade::~CMD_FrameUpgrade() {
+  // @@protoc_insertion_point(destructor:CMD_FrameUpgrade)
   SharedDtor();
 }
 
-void CMD_Heartbeat::SharedDtor() {
+void CMD_FrameUpgrade::SharedDtor() {
+  ::google::protobuf::Arena* arena = GetArenaNoVirtual();
+  if (arena != NULL) {
+    return;
+  }
+
 }
 
-void CMD_Heartbeat::SetCachedSize(int size) const {
+void CMD_FrameUpgrade::ArenaDtor(void* object) {
+  CMD_FrameUpgrade* _this = reinterpret_cast< CMD_FrameUpgrade* >(object);
+  (void)_this;
+}
+void CMD_FrameUpgrade::RegisterArenaDtor(::google::protobuf::Arena* arena) {
+}
+void CMD_FrameUpgrade::SetCachedSize(int size) const {
   GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
   _cached_size_ = size;
   GOOGLE_SAFE_CONCURRENT_WRITES_END();
 }
-const ::google::protobuf::Descriptor* CMD_Heartbeat::descriptor() {
+const ::google::protobuf::Descriptor* CMD_FrameUpgrade::descriptor() {
   protobuf_Commands_2eproto::protobuf_AssignDescriptorsOnce();
   return protobuf_Commands_2eproto::file_level_metadata[3].descriptor;
 }
 
-const CMD_Heartbeat& CMD_Heartbeat::default_instance() {
+const CMD_FrameUpgrade& CMD_FrameUpgrade::default_instance() {
   protobuf_Commands_2eproto::InitDefaults();
   return *internal_default_instance();
 }
 
-CMD_Heartbeat* CMD_Heartbeat::New(::google::protobuf::Arena* arena) const {
-  CMD_Heartbeat* n = new CMD_Heartbeat;
-  if (arena != NULL) {
-    arena->Own(n);
-  }
-  return n;
+CMD_FrameUpgrade* CMD_FrameUpgrade::New(::google::protobuf::Arena* arena) const {
+  return ::google::protobuf::Arena::CreateMessage<CMD_FrameUpgrade>(arena);
 }
 
-void CMD_Heartbeat::Clear() {
-// @@protoc_insertion_point(message_clear_start:CMD_Heartbeat)
-  ::memset(&appid_, 0, reinterpret_cast<char*>(&apptype_) -
-    reinterpret_cast<char*>(&appid_) + sizeof(apptype_));
+void CMD_FrameUpgrade::Clear() {
+// @@protoc_insertion_point(message_clear_start:CMD_FrameUpgrade)
+  version_ = 0u;
 }
 
-bool CMD_Heartbeat::MergePartialFromCodedStream(
+bool CMD_FrameUpgrade::MergePartialFromCodedStream(
     ::google::protobuf::io::CodedInputStream* input) {
 #define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
   ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:CMD_Heartbeat)
+  // @@protoc_insertion_point(parse_start:CMD_FrameUpgrade)
   for (;;) {
     ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
     tag = p.first;
     if (!p.second) goto handle_unusual;
     switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
-      // uint64 appID = 1;
+      // uint32 version = 1;
       case 1: {
         if (tag == 8u) {
 
           DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
-                 input, &appid_)));
-        } else {
-          goto handle_unusual;
-        }
-        break;
-      }
-
-      // int32 appType = 2;
-      case 2: {
-        if (tag == 16u) {
-
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
-                 input, &apptype_)));
+                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
+                 input, &version_)));
         } else {
           goto handle_unusual;
         }
@@ -2554,64 +3735,47 @@ bool CMD_Heartbeat::MergePartialFromCodedStream(
     }
   }
 success:
-  // @@protoc_insertion_point(parse_success:CMD_Heartbeat)
+  // @@protoc_insertion_point(parse_success:CMD_FrameUpgrade)
   return true;
 failure:
-  // @@protoc_insertion_point(parse_failure:CMD_Heartbeat)
+  // @@protoc_insertion_point(parse_failure:CMD_FrameUpgrade)
   return false;
 #undef DO_
 }
 
-void CMD_Heartbeat::SerializeWithCachedSizes(
+void CMD_FrameUpgrade::SerializeWithCachedSizes(
     ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:CMD_Heartbeat)
-  // uint64 appID = 1;
-  if (this->appid() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteUInt64(1, this->appid(), output);
-  }
-
-  // int32 appType = 2;
-  if (this->apptype() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteInt32(2, this->apptype(), output);
+  // @@protoc_insertion_point(serialize_start:CMD_FrameUpgrade)
+  // uint32 version = 1;
+  if (this->version() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt32(1, this->version(), output);
   }
 
-  // @@protoc_insertion_point(serialize_end:CMD_Heartbeat)
+  // @@protoc_insertion_point(serialize_end:CMD_FrameUpgrade)
 }
 
-::google::protobuf::uint8* CMD_Heartbeat::InternalSerializeWithCachedSizesToArray(
+::google::protobuf::uint8* CMD_FrameUpgrade::InternalSerializeWithCachedSizesToArray(
     bool deterministic, ::google::protobuf::uint8* target) const {
   (void)deterministic;  // Unused
-  // @@protoc_insertion_point(serialize_to_array_start:CMD_Heartbeat)
-  // uint64 appID = 1;
-  if (this->appid() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteUInt64ToArray(1, this->appid(), target);
-  }
-
-  // int32 appType = 2;
-  if (this->apptype() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteInt32ToArray(2, this->apptype(), target);
+  // @@protoc_insertion_point(serialize_to_array_start:CMD_FrameUpgrade)
+  // uint32 version = 1;
+  if (this->version() != 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteUInt32ToArray(1, this->version(), target);
   }
 
-  // @@protoc_insertion_point(serialize_to_array_end:CMD_Heartbeat)
+  // @@protoc_insertion_point(serialize_to_array_end:CMD_FrameUpgrade)
   return target;
 }
 
-size_t CMD_Heartbeat::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:CMD_Heartbeat)
+size_t CMD_FrameUpgrade::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:CMD_FrameUpgrade)
   size_t total_size = 0;
 
-  // uint64 appID = 1;
-  if (this->appid() != 0) {
+  // uint32 version = 1;
+  if (this->version() != 0) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::UInt64Size(
-        this->appid());
-  }
-
-  // int32 appType = 2;
-  if (this->apptype() != 0) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::Int32Size(
-        this->apptype());
+      ::google::protobuf::internal::WireFormatLite::UInt32Size(
+        this->version());
   }
 
   int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
@@ -2621,95 +3785,92 @@ size_t CMD_Heartbeat::ByteSizeLong() const {
   return total_size;
 }
 
-void CMD_Heartbeat::MergeFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:CMD_Heartbeat)
+void CMD_FrameUpgrade::MergeFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:CMD_FrameUpgrade)
   GOOGLE_DCHECK_NE(&from, this);
-  const CMD_Heartbeat* source =
-      ::google::protobuf::internal::DynamicCastToGenerated<const CMD_Heartbeat>(
+  const CMD_FrameUpgrade* source =
+      ::google::protobuf::internal::DynamicCastToGenerated<const CMD_FrameUpgrade>(
           &from);
   if (source == NULL) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:CMD_Heartbeat)
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:CMD_FrameUpgrade)
     ::google::protobuf::internal::ReflectionOps::Merge(from, this);
   } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:CMD_Heartbeat)
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:CMD_FrameUpgrade)
     MergeFrom(*source);
   }
 }
 
-void CMD_Heartbeat::MergeFrom(const CMD_Heartbeat& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:CMD_Heartbeat)
+void CMD_FrameUpgrade::MergeFrom(const CMD_FrameUpgrade& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:CMD_FrameUpgrade)
   GOOGLE_DCHECK_NE(&from, this);
   _internal_metadata_.MergeFrom(from._internal_metadata_);
-  if (from.appid() != 0) {
-    set_appid(from.appid());
-  }
-  if (from.apptype() != 0) {
-    set_apptype(from.apptype());
+  if (from.version() != 0) {
+    set_version(from.version());
   }
 }
 
-void CMD_Heartbeat::CopyFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:CMD_Heartbeat)
+void CMD_FrameUpgrade::CopyFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:CMD_FrameUpgrade)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-void CMD_Heartbeat::CopyFrom(const CMD_Heartbeat& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:CMD_Heartbeat)
+void CMD_FrameUpgrade::CopyFrom(const CMD_FrameUpgrade& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:CMD_FrameUpgrade)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool CMD_Heartbeat::IsInitialized() const {
+bool CMD_FrameUpgrade::IsInitialized() const {
   return true;
 }
 
-void CMD_Heartbeat::Swap(CMD_Heartbeat* other) {
+void CMD_FrameUpgrade::Swap(CMD_FrameUpgrade* other) {
+  if (other == this) return;
+  if (GetArenaNoVirtual() == other->GetArenaNoVirtual()) {
+    InternalSwap(other);
+  } else {
+    CMD_FrameUpgrade* temp = New(GetArenaNoVirtual());
+    temp->MergeFrom(*other);
+    other->CopyFrom(*this);
+    InternalSwap(temp);
+    if (GetArenaNoVirtual() == NULL) {
+      delete temp;
+    }
+  }
+}
+void CMD_FrameUpgrade::UnsafeArenaSwap(CMD_FrameUpgrade* other) {
   if (other == this) return;
+  GOOGLE_DCHECK(GetArenaNoVirtual() == other->GetArenaNoVirtual());
   InternalSwap(other);
 }
-void CMD_Heartbeat::InternalSwap(CMD_Heartbeat* other) {
-  std::swap(appid_, other->appid_);
-  std::swap(apptype_, other->apptype_);
+void CMD_FrameUpgrade::InternalSwap(CMD_FrameUpgrade* other) {
+  std::swap(version_, other->version_);
   std::swap(_cached_size_, other->_cached_size_);
 }
 
-::google::protobuf::Metadata CMD_Heartbeat::GetMetadata() const {
+::google::protobuf::Metadata CMD_FrameUpgrade::GetMetadata() const {
   protobuf_Commands_2eproto::protobuf_AssignDescriptorsOnce();
   return protobuf_Commands_2eproto::file_level_metadata[3];
 }
 
 #if PROTOBUF_INLINE_NOT_IN_HEADERS
-// CMD_Heartbeat
-
-// uint64 appID = 1;
-void CMD_Heartbeat::clear_appid() {
-  appid_ = GOOGLE_ULONGLONG(0);
-}
-::google::protobuf::uint64 CMD_Heartbeat::appid() const {
-  // @@protoc_insertion_point(field_get:CMD_Heartbeat.appID)
-  return appid_;
-}
-void CMD_Heartbeat::set_appid(::google::protobuf::uint64 value) {
-  
-  appid_ = value;
-  // @@protoc_insertion_point(field_set:CMD_Heartbeat.appID)
-}
+// CMD_FrameUpgrade
 
-// int32 appType = 2;
-void CMD_Heartbeat::clear_apptype() {
-  apptype_ = 0;
+// uint32 version = 1;
+void CMD_FrameUpgrade::clear_version() {
+  version_ = 0u;
 }
-::google::protobuf::int32 CMD_Heartbeat::apptype() const {
-  // @@protoc_insertion_point(field_get:CMD_Heartbeat.appType)
-  return apptype_;
+::google::protobuf::uint32 CMD_FrameUpgrade::version() const {
+  // @@protoc_insertion_point(field_get:CMD_FrameUpgrade.version)
+  return version_;
 }
-void CMD_Heartbeat::set_apptype(::google::protobuf::int32 value) {
+void CMD_FrameUpgrade::set_version(::google::protobuf::uint32 value) {
   
-  apptype_ = value;
-  // @@protoc_insertion_point(field_set:CMD_Heartbeat.appType)
+  version_ = value;
+  // @@protoc_insertion_point(field_set:CMD_FrameUpgrade.version)
 }
 
 #endif  // PROTOBUF_INLINE_NOT_IN_HEADERS
@@ -2717,19 +3878,29 @@ void CMD_Heartbeat::set_apptype(::google::protobuf::int32 value) {
 // ===================================================================
 
 #if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int CMD_HeartbeatCB::kAppIDFieldNumber;
-const int CMD_HeartbeatCB::kAppTypeFieldNumber;
+const int CMD_Heartbeat::kAppIDFieldNumber;
+const int CMD_Heartbeat::kAppTypeFieldNumber;
 #endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
 
-CMD_HeartbeatCB::CMD_HeartbeatCB()
+CMD_Heartbeat::CMD_Heartbeat()
   : ::google::protobuf::Message(), _internal_metadata_(NULL) {
   if (GOOGLE_PREDICT_TRUE(this != internal_default_instance())) {
     protobuf_Commands_2eproto::InitDefaults();
   }
   SharedCtor();
-  // @@protoc_insertion_point(constructor:CMD_HeartbeatCB)
+  // @@protoc_insertion_point(constructor:CMD_Heartbeat)
 }
-CMD_HeartbeatCB::CMD_HeartbeatCB(const CMD_HeartbeatCB& from)
+CMD_Heartbeat::CMD_Heartbeat(::google::protobuf::Arena* arena)
+  : ::google::protobuf::Message(),
+  _internal_metadata_(arena) {
+#ifdef GOOGLE_PROTOBUF_NO_STATIC_INITIALIZER
+  protobuf_Commands_2eproto::InitDefaults();
+#endif  // GOOGLE_PROTOBUF_NO_STATIC_INITIALIZER
+  SharedCtor();
+  RegisterArenaDtor(arena);
+  // @@protoc_insertion_point(arena_constructor:CMD_Heartbeat)
+}
+CMD_Heartbeat::CMD_Heartbeat(const CMD_Heartbeat& from)
   : ::google::protobuf::Message(),
       _internal_metadata_(NULL),
       _cached_size_(0) {
@@ -2737,57 +3908,64 @@ CMD_HeartbeatCB::CMD_HeartbeatCB(const CMD_HeartbeatCB& from)
   ::memcpy(&appid_, &from.appid_,
     reinterpret_cast<char*>(&apptype_) -
     reinterpret_cast<char*>(&appid_) + sizeof(apptype_));
-  // @@protoc_insertion_point(copy_constructor:CMD_HeartbeatCB)
+  // @@protoc_insertion_point(copy_constructor:CMD_Heartbeat)
 }
 
-void CMD_HeartbeatCB::SharedCtor() {
+void CMD_Heartbeat::SharedCtor() {
   ::memset(&appid_, 0, reinterpret_cast<char*>(&apptype_) -
     reinterpret_cast<char*>(&appid_) + sizeof(apptype_));
   _cached_size_ = 0;
 }
 
-CMD_HeartbeatCB::~CMD_HeartbeatCB() {
-  // @@protoc_insertion_point(destructor:CMD_HeartbeatCB)
+CMD_Heartbeat::~CMD_Heartbeat() {
+  // @@protoc_insertion_point(destructor:CMD_Heartbeat)
   SharedDtor();
 }
 
-void CMD_HeartbeatCB::SharedDtor() {
+void CMD_Heartbeat::SharedDtor() {
+  ::google::protobuf::Arena* arena = GetArenaNoVirtual();
+  if (arena != NULL) {
+    return;
+  }
+
 }
 
-void CMD_HeartbeatCB::SetCachedSize(int size) const {
+void CMD_Heartbeat::ArenaDtor(void* object) {
+  CMD_Heartbeat* _this = reinterpret_cast< CMD_Heartbeat* >(object);
+  (void)_this;
+}
+void CMD_Heartbeat::RegisterArenaDtor(::google::protobuf::Arena* arena) {
+}
+void CMD_Heartbeat::SetCachedSize(int size) const {
   GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
   _cached_size_ = size;
   GOOGLE_SAFE_CONCURRENT_WRITES_END();
 }
-const ::google::protobuf::Descriptor* CMD_HeartbeatCB::descriptor() {
+const ::google::protobuf::Descriptor* CMD_Heartbeat::descriptor() {
   protobuf_Commands_2eproto::protobuf_AssignDescriptorsOnce();
   return protobuf_Commands_2eproto::file_level_metadata[4].descriptor;
 }
 
-const CMD_HeartbeatCB& CMD_HeartbeatCB::default_instance() {
+const CMD_Heartbeat& CMD_Heartbeat::default_instance() {
   protobuf_Commands_2eproto::InitDefaults();
   return *internal_default_instance();
 }
 
-CMD_HeartbeatCB* CMD_HeartbeatCB::New(::google::protobuf::Arena* arena) const {
-  CMD_HeartbeatCB* n = new CMD_HeartbeatCB;
-  if (arena != NULL) {
-    arena->Own(n);
-  }
-  return n;
+CMD_Heartbeat* CMD_Heartbeat::New(::google::protobuf::Arena* arena) const {
+  return ::google::protobuf::Arena::CreateMessage<CMD_Heartbeat>(arena);
 }
 
-void CMD_HeartbeatCB::Clear() {
-// @@protoc_insertion_point(message_clear_start:CMD_HeartbeatCB)
+void CMD_Heartbeat::Clear() {
+// @@protoc_insertion_point(message_clear_start:CMD_Heartbeat)
   ::memset(&appid_, 0, reinterpret_cast<char*>(&apptype_) -
     reinterpret_cast<char*>(&appid_) + sizeof(apptype_));
 }
 
-bool CMD_HeartbeatCB::MergePartialFromCodedStream(
+bool CMD_Heartbeat::MergePartialFromCodedStream(
     ::google::protobuf::io::CodedInputStream* input) {
 #define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
   ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:CMD_HeartbeatCB)
+  // @@protoc_insertion_point(parse_start:CMD_Heartbeat)
   for (;;) {
     ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
     tag = p.first;
@@ -2832,17 +4010,17 @@ bool CMD_HeartbeatCB::MergePartialFromCodedStream(
     }
   }
 success:
-  // @@protoc_insertion_point(parse_success:CMD_HeartbeatCB)
+  // @@protoc_insertion_point(parse_success:CMD_Heartbeat)
   return true;
 failure:
-  // @@protoc_insertion_point(parse_failure:CMD_HeartbeatCB)
+  // @@protoc_insertion_point(parse_failure:CMD_Heartbeat)
   return false;
 #undef DO_
 }
 
-void CMD_HeartbeatCB::SerializeWithCachedSizes(
+void CMD_Heartbeat::SerializeWithCachedSizes(
     ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:CMD_HeartbeatCB)
+  // @@protoc_insertion_point(serialize_start:CMD_Heartbeat)
   // uint64 appID = 1;
   if (this->appid() != 0) {
     ::google::protobuf::internal::WireFormatLite::WriteUInt64(1, this->appid(), output);
@@ -2853,13 +4031,13 @@ void CMD_HeartbeatCB::SerializeWithCachedSizes(
     ::google::protobuf::internal::WireFormatLite::WriteInt32(2, this->apptype(), output);
   }
 
-  // @@protoc_insertion_point(serialize_end:CMD_HeartbeatCB)
+  // @@protoc_insertion_point(serialize_end:CMD_Heartbeat)
 }
 
-::google::protobuf::uint8* CMD_HeartbeatCB::InternalSerializeWithCachedSizesToArray(
+::google::protobuf::uint8* CMD_Heartbeat::InternalSerializeWithCachedSizesToArray(
     bool deterministic, ::google::protobuf::uint8* target) const {
   (void)deterministic;  // Unused
-  // @@protoc_insertion_point(serialize_to_array_start:CMD_HeartbeatCB)
+  // @@protoc_insertion_point(serialize_to_array_start:CMD_Heartbeat)
   // uint64 appID = 1;
   if (this->appid() != 0) {
     target = ::google::protobuf::internal::WireFormatLite::WriteUInt64ToArray(1, this->appid(), target);
@@ -2870,12 +4048,12 @@ void CMD_HeartbeatCB::SerializeWithCachedSizes(
     target = ::google::protobuf::internal::WireFormatLite::WriteInt32ToArray(2, this->apptype(), target);
   }
 
-  // @@protoc_insertion_point(serialize_to_array_end:CMD_HeartbeatCB)
+  // @@protoc_insertion_point(serialize_to_array_end:CMD_Heartbeat)
   return target;
 }
 
-size_t CMD_HeartbeatCB::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:CMD_HeartbeatCB)
+size_t CMD_Heartbeat::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:CMD_Heartbeat)
   size_t total_size = 0;
 
   // uint64 appID = 1;
@@ -2899,23 +4077,23 @@ size_t CMD_HeartbeatCB::ByteSizeLong() const {
   return total_size;
 }
 
-void CMD_HeartbeatCB::MergeFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:CMD_HeartbeatCB)
+void CMD_Heartbeat::MergeFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:CMD_Heartbeat)
   GOOGLE_DCHECK_NE(&from, this);
-  const CMD_HeartbeatCB* source =
-      ::google::protobuf::internal::DynamicCastToGenerated<const CMD_HeartbeatCB>(
+  const CMD_Heartbeat* source =
+      ::google::protobuf::internal::DynamicCastToGenerated<const CMD_Heartbeat>(
           &from);
   if (source == NULL) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:CMD_HeartbeatCB)
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:CMD_Heartbeat)
     ::google::protobuf::internal::ReflectionOps::Merge(from, this);
   } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:CMD_HeartbeatCB)
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:CMD_Heartbeat)
     MergeFrom(*source);
   }
 }
 
-void CMD_HeartbeatCB::MergeFrom(const CMD_HeartbeatCB& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:CMD_HeartbeatCB)
+void CMD_Heartbeat::MergeFrom(const CMD_Heartbeat& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:CMD_Heartbeat)
   GOOGLE_DCHECK_NE(&from, this);
   _internal_metadata_.MergeFrom(from._internal_metadata_);
   if (from.appid() != 0) {
@@ -2926,68 +4104,83 @@ void CMD_HeartbeatCB::MergeFrom(const CMD_HeartbeatCB& from) {
   }
 }
 
-void CMD_HeartbeatCB::CopyFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:CMD_HeartbeatCB)
+void CMD_Heartbeat::CopyFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:CMD_Heartbeat)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-void CMD_HeartbeatCB::CopyFrom(const CMD_HeartbeatCB& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:CMD_HeartbeatCB)
+void CMD_Heartbeat::CopyFrom(const CMD_Heartbeat& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:CMD_Heartbeat)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool CMD_HeartbeatCB::IsInitialized() const {
+bool CMD_Heartbeat::IsInitialized() const {
   return true;
 }
 
-void CMD_HeartbeatCB::Swap(CMD_HeartbeatCB* other) {
+void CMD_Heartbeat::Swap(CMD_Heartbeat* other) {
+  if (other == this) return;
+  if (GetArenaNoVirtual() == other->GetArenaNoVirtual()) {
+    InternalSwap(other);
+  } else {
+    CMD_Heartbeat* temp = New(GetArenaNoVirtual());
+    temp->MergeFrom(*other);
+    other->CopyFrom(*this);
+    InternalSwap(temp);
+    if (GetArenaNoVirtual() == NULL) {
+      delete temp;
+    }
+  }
+}
+void CMD_Heartbeat::UnsafeArenaSwap(CMD_Heartbeat* other) {
   if (other == this) return;
+  GOOGLE_DCHECK(GetArenaNoVirtual() == other->GetArenaNoVirtual());
   InternalSwap(other);
 }
-void CMD_HeartbeatCB::InternalSwap(CMD_HeartbeatCB* other) {
+void CMD_Heartbeat::InternalSwap(CMD_Heartbeat* other) {
   std::swap(appid_, other->appid_);
   std::swap(apptype_, other->apptype_);
   std::swap(_cached_size_, other->_cached_size_);
 }
 
-::google::protobuf::Metadata CMD_HeartbeatCB::GetMetadata() const {
+::google::protobuf::Metadata CMD_Heartbeat::GetMetadata() const {
   protobuf_Commands_2eproto::protobuf_AssignDescriptorsOnce();
   return protobuf_Commands_2eproto::file_level_metadata[4];
 }
 
 #if PROTOBUF_INLINE_NOT_IN_HEADERS
-// CMD_HeartbeatCB
+// CMD_Heartbeat
 
 // uint64 appID = 1;
-void CMD_HeartbeatCB::clear_appid() {
+void CMD_Heartbeat::clear_appid() {
   appid_ = GOOGLE_ULONGLONG(0);
 }
-::google::protobuf::uint64 CMD_HeartbeatCB::appid() const {
-  // @@protoc_insertion_point(field_get:CMD_HeartbeatCB.appID)
+::google::protobuf::uint64 CMD_Heartbeat::appid() const {
+  // @@protoc_insertion_point(field_get:CMD_Heartbeat.appID)
   return appid_;
 }
-void CMD_HeartbeatCB::set_appid(::google::protobuf::uint64 value) {
+void CMD_Heartbeat::set_appid(::google::protobuf::uint64 value) {
   
   appid_ = value;
-  // @@protoc_insertion_point(field_set:CMD_HeartbeatCB.appID)
+  // @@protoc_insertion_point(field_set:CMD_Heartbeat.appID)
 }
 
 // int32 appType = 2;
-void CMD_HeartbeatCB::clear_apptype() {
+void CMD_Heartbeat::clear_apptype() {
   apptype_ = 0;
 }
-::google::protobuf::int32 CMD_HeartbeatCB::apptype() const {
-  // @@protoc_insertion_point(field_get:CMD_HeartbeatCB.appType)
+::google::protobuf::int32 CMD_Heartbeat::apptype() const {
+  // @@protoc_insertion_point(field_get:CMD_Heartbeat.appType)
   return apptype_;
 }
-void CMD_HeartbeatCB::set_apptype(::google::protobuf::int32 value) {
+void CMD_Heartbeat::set_apptype(::google::protobuf::int32 value) {
   
   apptype_ = value;
-  // @@protoc_insertion_point(field_set:CMD_HeartbeatCB.appType)
+  // @@protoc_insertion_point(field_set:CMD_Heartbeat.appType)
 }
 
 #endif  // PROTOBUF_INLINE_NOT_IN_HEADERS
@@ -2995,20 +4188,29 @@ void CMD_HeartbeatCB::set_apptype(::google::protobuf::int32 value) {
 // ===================================================================
 
 #if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int CMD_Version_Not_Match::kVersionFieldNumber;
-const int CMD_Version_Not_Match::kAppIDFieldNumber;
-const int CMD_Version_Not_Match::kAppTypeFieldNumber;
+const int CMD_HeartbeatCB::kAppIDFieldNumber;
+const int CMD_HeartbeatCB::kAppTypeFieldNumber;
 #endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
 
-CMD_Version_Not_Match::CMD_Version_Not_Match()
+CMD_HeartbeatCB::CMD_HeartbeatCB()
   : ::google::protobuf::Message(), _internal_metadata_(NULL) {
   if (GOOGLE_PREDICT_TRUE(this != internal_default_instance())) {
     protobuf_Commands_2eproto::InitDefaults();
   }
   SharedCtor();
-  // @@protoc_insertion_point(constructor:CMD_Version_Not_Match)
+  // @@protoc_insertion_point(constructor:CMD_HeartbeatCB)
 }
-CMD_Version_Not_Match::CMD_Version_Not_Match(const CMD_Version_Not_Match& from)
+CMD_HeartbeatCB::CMD_HeartbeatCB(::google::protobuf::Arena* arena)
+  : ::google::protobuf::Message(),
+  _internal_metadata_(arena) {
+#ifdef GOOGLE_PROTOBUF_NO_STATIC_INITIALIZER
+  protobuf_Commands_2eproto::InitDefaults();
+#endif  // GOOGLE_PROTOBUF_NO_STATIC_INITIALIZER
+  SharedCtor();
+  RegisterArenaDtor(arena);
+  // @@protoc_insertion_point(arena_constructor:CMD_HeartbeatCB)
+}
+CMD_HeartbeatCB::CMD_HeartbeatCB(const CMD_HeartbeatCB& from)
   : ::google::protobuf::Message(),
       _internal_metadata_(NULL),
       _cached_size_(0) {
@@ -3016,94 +4218,412 @@ CMD_Version_Not_Match::CMD_Version_Not_Match(const CMD_Version_Not_Match& from)
   ::memcpy(&appid_, &from.appid_,
     reinterpret_cast<char*>(&apptype_) -
     reinterpret_cast<char*>(&appid_) + sizeof(apptype_));
-  // @@protoc_insertion_point(copy_constructor:CMD_Version_Not_Match)
+  // @@protoc_insertion_point(copy_constructor:CMD_HeartbeatCB)
 }
 
-void CMD_Version_Not_Match::SharedCtor() {
+void CMD_HeartbeatCB::SharedCtor() {
   ::memset(&appid_, 0, reinterpret_cast<char*>(&apptype_) -
     reinterpret_cast<char*>(&appid_) + sizeof(apptype_));
   _cached_size_ = 0;
 }
 
-CMD_Version_Not_Match::~CMD_Version_Not_Match() {
-  // @@protoc_insertion_point(destructor:CMD_Version_Not_Match)
+CMD_HeartbeatCB::~CMD_HeartbeatCB() {
+  // @@protoc_insertion_point(destructor:CMD_HeartbeatCB)
   SharedDtor();
 }
 
-void CMD_Version_Not_Match::SharedDtor() {
+void CMD_HeartbeatCB::SharedDtor() {
+  ::google::protobuf::Arena* arena = GetArenaNoVirtual();
+  if (arena != NULL) {
+    return;
+  }
+
 }
 
-void CMD_Version_Not_Match::SetCachedSize(int size) const {
+void CMD_HeartbeatCB::ArenaDtor(void* object) {
+  CMD_HeartbeatCB* _this = reinterpret_cast< CMD_HeartbeatCB* >(object);
+  (void)_this;
+}
+void CMD_HeartbeatCB::RegisterArenaDtor(::google::protobuf::Arena* arena) {
+}
+void CMD_HeartbeatCB::SetCachedSize(int size) const {
   GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
   _cached_size_ = size;
   GOOGLE_SAFE_CONCURRENT_WRITES_END();
 }
-const ::google::protobuf::Descriptor* CMD_Version_Not_Match::descriptor() {
+const ::google::protobuf::Descriptor* CMD_HeartbeatCB::descriptor() {
   protobuf_Commands_2eproto::protobuf_AssignDescriptorsOnce();
   return protobuf_Commands_2eproto::file_level_metadata[5].descriptor;
 }
 
-const CMD_Version_Not_Match& CMD_Version_Not_Match::default_instance() {
+const CMD_HeartbeatCB& CMD_HeartbeatCB::default_instance() {
   protobuf_Commands_2eproto::InitDefaults();
   return *internal_default_instance();
 }
 
-CMD_Version_Not_Match* CMD_Version_Not_Match::New(::google::protobuf::Arena* arena) const {
-  CMD_Version_Not_Match* n = new CMD_Version_Not_Match;
-  if (arena != NULL) {
-    arena->Own(n);
-  }
-  return n;
+CMD_HeartbeatCB* CMD_HeartbeatCB::New(::google::protobuf::Arena* arena) const {
+  return ::google::protobuf::Arena::CreateMessage<CMD_HeartbeatCB>(arena);
 }
 
-void CMD_Version_Not_Match::Clear() {
-// @@protoc_insertion_point(message_clear_start:CMD_Version_Not_Match)
+void CMD_HeartbeatCB::Clear() {
+// @@protoc_insertion_point(message_clear_start:CMD_HeartbeatCB)
   ::memset(&appid_, 0, reinterpret_cast<char*>(&apptype_) -
     reinterpret_cast<char*>(&appid_) + sizeof(apptype_));
 }
 
-bool CMD_Version_Not_Match::MergePartialFromCodedStream(
+bool CMD_HeartbeatCB::MergePartialFromCodedStream(
     ::google::protobuf::io::CodedInputStream* input) {
 #define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
   ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:CMD_Version_Not_Match)
+  // @@protoc_insertion_point(parse_start:CMD_HeartbeatCB)
   for (;;) {
     ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
     tag = p.first;
     if (!p.second) goto handle_unusual;
     switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
-      // int32 version = 1;
+      // uint64 appID = 1;
       case 1: {
         if (tag == 8u) {
 
           DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
-                 input, &version_)));
+                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
+                 input, &appid_)));
         } else {
           goto handle_unusual;
         }
         break;
       }
 
-      // uint64 appID = 2;
+      // int32 appType = 2;
       case 2: {
         if (tag == 16u) {
 
           DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
-                 input, &appid_)));
+                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
+                 input, &apptype_)));
         } else {
           goto handle_unusual;
         }
         break;
       }
 
-      // int32 appType = 3;
-      case 3: {
-        if (tag == 24u) {
-
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
+      default: {
+      handle_unusual:
+        if (tag == 0 ||
+            ::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
+          goto success;
+        }
+        DO_(::google::protobuf::internal::WireFormatLite::SkipField(input, tag));
+        break;
+      }
+    }
+  }
+success:
+  // @@protoc_insertion_point(parse_success:CMD_HeartbeatCB)
+  return true;
+failure:
+  // @@protoc_insertion_point(parse_failure:CMD_HeartbeatCB)
+  return false;
+#undef DO_
+}
+
+void CMD_HeartbeatCB::SerializeWithCachedSizes(
+    ::google::protobuf::io::CodedOutputStream* output) const {
+  // @@protoc_insertion_point(serialize_start:CMD_HeartbeatCB)
+  // uint64 appID = 1;
+  if (this->appid() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt64(1, this->appid(), output);
+  }
+
+  // int32 appType = 2;
+  if (this->apptype() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteInt32(2, this->apptype(), output);
+  }
+
+  // @@protoc_insertion_point(serialize_end:CMD_HeartbeatCB)
+}
+
+::google::protobuf::uint8* CMD_HeartbeatCB::InternalSerializeWithCachedSizesToArray(
+    bool deterministic, ::google::protobuf::uint8* target) const {
+  (void)deterministic;  // Unused
+  // @@protoc_insertion_point(serialize_to_array_start:CMD_HeartbeatCB)
+  // uint64 appID = 1;
+  if (this->appid() != 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteUInt64ToArray(1, this->appid(), target);
+  }
+
+  // int32 appType = 2;
+  if (this->apptype() != 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteInt32ToArray(2, this->apptype(), target);
+  }
+
+  // @@protoc_insertion_point(serialize_to_array_end:CMD_HeartbeatCB)
+  return target;
+}
+
+size_t CMD_HeartbeatCB::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:CMD_HeartbeatCB)
+  size_t total_size = 0;
+
+  // uint64 appID = 1;
+  if (this->appid() != 0) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::UInt64Size(
+        this->appid());
+  }
+
+  // int32 appType = 2;
+  if (this->apptype() != 0) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::Int32Size(
+        this->apptype());
+  }
+
+  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = cached_size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  return total_size;
+}
+
+void CMD_HeartbeatCB::MergeFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:CMD_HeartbeatCB)
+  GOOGLE_DCHECK_NE(&from, this);
+  const CMD_HeartbeatCB* source =
+      ::google::protobuf::internal::DynamicCastToGenerated<const CMD_HeartbeatCB>(
+          &from);
+  if (source == NULL) {
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:CMD_HeartbeatCB)
+    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
+  } else {
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:CMD_HeartbeatCB)
+    MergeFrom(*source);
+  }
+}
+
+void CMD_HeartbeatCB::MergeFrom(const CMD_HeartbeatCB& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:CMD_HeartbeatCB)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  if (from.appid() != 0) {
+    set_appid(from.appid());
+  }
+  if (from.apptype() != 0) {
+    set_apptype(from.apptype());
+  }
+}
+
+void CMD_HeartbeatCB::CopyFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:CMD_HeartbeatCB)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void CMD_HeartbeatCB::CopyFrom(const CMD_HeartbeatCB& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:CMD_HeartbeatCB)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool CMD_HeartbeatCB::IsInitialized() const {
+  return true;
+}
+
+void CMD_HeartbeatCB::Swap(CMD_HeartbeatCB* other) {
+  if (other == this) return;
+  if (GetArenaNoVirtual() == other->GetArenaNoVirtual()) {
+    InternalSwap(other);
+  } else {
+    CMD_HeartbeatCB* temp = New(GetArenaNoVirtual());
+    temp->MergeFrom(*other);
+    other->CopyFrom(*this);
+    InternalSwap(temp);
+    if (GetArenaNoVirtual() == NULL) {
+      delete temp;
+    }
+  }
+}
+void CMD_HeartbeatCB::UnsafeArenaSwap(CMD_HeartbeatCB* other) {
+  if (other == this) return;
+  GOOGLE_DCHECK(GetArenaNoVirtual() == other->GetArenaNoVirtual());
+  InternalSwap(other);
+}
+void CMD_HeartbeatCB::InternalSwap(CMD_HeartbeatCB* other) {
+  std::swap(appid_, other->appid_);
+  std::swap(apptype_, other->apptype_);
+  std::swap(_cached_size_, other->_cached_size_);
+}
+
+::google::protobuf::Metadata CMD_HeartbeatCB::GetMetadata() const {
+  protobuf_Commands_2eproto::protobuf_AssignDescriptorsOnce();
+  return protobuf_Commands_2eproto::file_level_metadata[5];
+}
+
+#if PROTOBUF_INLINE_NOT_IN_HEADERS
+// CMD_HeartbeatCB
+
+// uint64 appID = 1;
+void CMD_HeartbeatCB::clear_appid() {
+  appid_ = GOOGLE_ULONGLONG(0);
+}
+::google::protobuf::uint64 CMD_HeartbeatCB::appid() const {
+  // @@protoc_insertion_point(field_get:CMD_HeartbeatCB.appID)
+  return appid_;
+}
+void CMD_HeartbeatCB::set_appid(::google::protobuf::uint64 value) {
+  
+  appid_ = value;
+  // @@protoc_insertion_point(field_set:CMD_HeartbeatCB.appID)
+}
+
+// int32 appType = 2;
+void CMD_HeartbeatCB::clear_apptype() {
+  apptype_ = 0;
+}
+::google::protobuf::int32 CMD_HeartbeatCB::apptype() const {
+  // @@protoc_insertion_point(field_get:CMD_HeartbeatCB.appType)
+  return apptype_;
+}
+void CMD_HeartbeatCB::set_apptype(::google::protobuf::int32 value) {
+  
+  apptype_ = value;
+  // @@protoc_insertion_point(field_set:CMD_HeartbeatCB.appType)
+}
+
+#endif  // PROTOBUF_INLINE_NOT_IN_HEADERS
+
+// ===================================================================
+
+#if !defined(_MSC_VER) || _MSC_VER >= 1900
+const int CMD_Version_Not_Match::kVersionFieldNumber;
+const int CMD_Version_Not_Match::kAppIDFieldNumber;
+const int CMD_Version_Not_Match::kAppTypeFieldNumber;
+#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+
+CMD_Version_Not_Match::CMD_Version_Not_Match()
+  : ::google::protobuf::Message(), _internal_metadata_(NULL) {
+  if (GOOGLE_PREDICT_TRUE(this != internal_default_instance())) {
+    protobuf_Commands_2eproto::InitDefaults();
+  }
+  SharedCtor();
+  // @@protoc_insertion_point(constructor:CMD_Version_Not_Match)
+}
+CMD_Version_Not_Match::CMD_Version_Not_Match(::google::protobuf::Arena* arena)
+  : ::google::protobuf::Message(),
+  _internal_metadata_(arena) {
+#ifdef GOOGLE_PROTOBUF_NO_STATIC_INITIALIZER
+  protobuf_Commands_2eproto::InitDefaults();
+#endif  // GOOGLE_PROTOBUF_NO_STATIC_INITIALIZER
+  SharedCtor();
+  RegisterArenaDtor(arena);
+  // @@protoc_insertion_point(arena_constructor:CMD_Version_Not_Match)
+}
+CMD_Version_Not_Match::CMD_Version_Not_Match(const CMD_Version_Not_Match& from)
+  : ::google::protobuf::Message(),
+      _internal_metadata_(NULL),
+      _cached_size_(0) {
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  ::memcpy(&appid_, &from.appid_,
+    reinterpret_cast<char*>(&apptype_) -
+    reinterpret_cast<char*>(&appid_) + sizeof(apptype_));
+  // @@protoc_insertion_point(copy_constructor:CMD_Version_Not_Match)
+}
+
+void CMD_Version_Not_Match::SharedCtor() {
+  ::memset(&appid_, 0, reinterpret_cast<char*>(&apptype_) -
+    reinterpret_cast<char*>(&appid_) + sizeof(apptype_));
+  _cached_size_ = 0;
+}
+
+CMD_Version_Not_Match::~CMD_Version_Not_Match() {
+  // @@protoc_insertion_point(destructor:CMD_Version_Not_Match)
+  SharedDtor();
+}
+
+void CMD_Version_Not_Match::SharedDtor() {
+  ::google::protobuf::Arena* arena = GetArenaNoVirtual();
+  if (arena != NULL) {
+    return;
+  }
+
+}
+
+void CMD_Version_Not_Match::ArenaDtor(void* object) {
+  CMD_Version_Not_Match* _this = reinterpret_cast< CMD_Version_Not_Match* >(object);
+  (void)_this;
+}
+void CMD_Version_Not_Match::RegisterArenaDtor(::google::protobuf::Arena* arena) {
+}
+void CMD_Version_Not_Match::SetCachedSize(int size) const {
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+}
+const ::google::protobuf::Descriptor* CMD_Version_Not_Match::descriptor() {
+  protobuf_Commands_2eproto::protobuf_AssignDescriptorsOnce();
+  return protobuf_Commands_2eproto::file_level_metadata[6].descriptor;
+}
+
+const CMD_Version_Not_Match& CMD_Version_Not_Match::default_instance() {
+  protobuf_Commands_2eproto::InitDefaults();
+  return *internal_default_instance();
+}
+
+CMD_Version_Not_Match* CMD_Version_Not_Match::New(::google::protobuf::Arena* arena) const {
+  return ::google::protobuf::Arena::CreateMessage<CMD_Version_Not_Match>(arena);
+}
+
+void CMD_Version_Not_Match::Clear() {
+// @@protoc_insertion_point(message_clear_start:CMD_Version_Not_Match)
+  ::memset(&appid_, 0, reinterpret_cast<char*>(&apptype_) -
+    reinterpret_cast<char*>(&appid_) + sizeof(apptype_));
+}
+
+bool CMD_Version_Not_Match::MergePartialFromCodedStream(
+    ::google::protobuf::io::CodedInputStream* input) {
+#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
+  ::google::protobuf::uint32 tag;
+  // @@protoc_insertion_point(parse_start:CMD_Version_Not_Match)
+  for (;;) {
+    ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
+    tag = p.first;
+    if (!p.second) goto handle_unusual;
+    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+      // int32 version = 1;
+      case 1: {
+        if (tag == 8u) {
+
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
+                 input, &version_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // uint64 appID = 2;
+      case 2: {
+        if (tag == 16u) {
+
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
+                 input, &appid_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // int32 appType = 3;
+      case 3: {
+        if (tag == 24u) {
+
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
                  input, &apptype_)));
         } else {
           goto handle_unusual;
@@ -3258,6 +4778,21 @@ bool CMD_Version_Not_Match::IsInitialized() const {
 
 void CMD_Version_Not_Match::Swap(CMD_Version_Not_Match* other) {
   if (other == this) return;
+  if (GetArenaNoVirtual() == other->GetArenaNoVirtual()) {
+    InternalSwap(other);
+  } else {
+    CMD_Version_Not_Match* temp = New(GetArenaNoVirtual());
+    temp->MergeFrom(*other);
+    other->CopyFrom(*this);
+    InternalSwap(temp);
+    if (GetArenaNoVirtual() == NULL) {
+      delete temp;
+    }
+  }
+}
+void CMD_Version_Not_Match::UnsafeArenaSwap(CMD_Version_Not_Match* other) {
+  if (other == this) return;
+  GOOGLE_DCHECK(GetArenaNoVirtual() == other->GetArenaNoVirtual());
   InternalSwap(other);
 }
 void CMD_Version_Not_Match::InternalSwap(CMD_Version_Not_Match* other) {
@@ -3269,7 +4804,7 @@ void CMD_Version_Not_Match::InternalSwap(CMD_Version_Not_Match* other) {
 
 ::google::protobuf::Metadata CMD_Version_Not_Match::GetMetadata() const {
   protobuf_Commands_2eproto::protobuf_AssignDescriptorsOnce();
-  return protobuf_Commands_2eproto::file_level_metadata[5];
+  return protobuf_Commands_2eproto::file_level_metadata[6];
 }
 
 #if PROTOBUF_INLINE_NOT_IN_HEADERS
@@ -3334,6 +4869,7 @@ const int CMD_UpdateServerInfos::kSessionNumFieldNumber;
 const int CMD_UpdateServerInfos::kAppGIDFieldNumber;
 const int CMD_UpdateServerInfos::kNameFieldNumber;
 const int CMD_UpdateServerInfos::kChildSrvsFieldNumber;
+const int CMD_UpdateServerInfos::kHostIDFieldNumber;
 #endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
 
 CMD_UpdateServerInfos::CMD_UpdateServerInfos()
@@ -3344,6 +4880,17 @@ CMD_UpdateServerInfos::CMD_UpdateServerInfos()
   SharedCtor();
   // @@protoc_insertion_point(constructor:CMD_UpdateServerInfos)
 }
+CMD_UpdateServerInfos::CMD_UpdateServerInfos(::google::protobuf::Arena* arena)
+  : ::google::protobuf::Message(),
+  _internal_metadata_(arena),
+  child_srvs_(arena) {
+#ifdef GOOGLE_PROTOBUF_NO_STATIC_INITIALIZER
+  protobuf_Commands_2eproto::InitDefaults();
+#endif  // GOOGLE_PROTOBUF_NO_STATIC_INITIALIZER
+  SharedCtor();
+  RegisterArenaDtor(arena);
+  // @@protoc_insertion_point(arena_constructor:CMD_UpdateServerInfos)
+}
 CMD_UpdateServerInfos::CMD_UpdateServerInfos(const CMD_UpdateServerInfos& from)
   : ::google::protobuf::Message(),
       _internal_metadata_(NULL),
@@ -3352,15 +4899,23 @@ CMD_UpdateServerInfos::CMD_UpdateServerInfos(const CMD_UpdateServerInfos& from)
   _internal_metadata_.MergeFrom(from._internal_metadata_);
   internal_ip_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
   if (from.internal_ip().size() > 0) {
-    internal_ip_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.internal_ip_);
+    internal_ip_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.internal_ip(),
+      GetArenaNoVirtual());
   }
   external_ip_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
   if (from.external_ip().size() > 0) {
-    external_ip_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.external_ip_);
+    external_ip_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.external_ip(),
+      GetArenaNoVirtual());
   }
   name_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
   if (from.name().size() > 0) {
-    name_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.name_);
+    name_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.name(),
+      GetArenaNoVirtual());
+  }
+  hostid_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  if (from.hostid().size() > 0) {
+    hostid_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.hostid(),
+      GetArenaNoVirtual());
   }
   ::memcpy(&appid_, &from.appid_,
     reinterpret_cast<char*>(&appgid_) -
@@ -3372,6 +4927,7 @@ void CMD_UpdateServerInfos::SharedCtor() {
   internal_ip_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
   external_ip_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
   name_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  hostid_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
   ::memset(&appid_, 0, reinterpret_cast<char*>(&appgid_) -
     reinterpret_cast<char*>(&appid_) + sizeof(appgid_));
   _cached_size_ = 0;
@@ -3383,11 +4939,23 @@ CMD_UpdateServerInfos::~CMD_UpdateServerInfos() {
 }
 
 void CMD_UpdateServerInfos::SharedDtor() {
-  internal_ip_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  external_ip_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  name_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  ::google::protobuf::Arena* arena = GetArenaNoVirtual();
+  if (arena != NULL) {
+    return;
+  }
+
+  internal_ip_.Destroy(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), arena);
+  external_ip_.Destroy(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), arena);
+  name_.Destroy(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), arena);
+  hostid_.Destroy(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), arena);
 }
 
+void CMD_UpdateServerInfos::ArenaDtor(void* object) {
+  CMD_UpdateServerInfos* _this = reinterpret_cast< CMD_UpdateServerInfos* >(object);
+  (void)_this;
+}
+void CMD_UpdateServerInfos::RegisterArenaDtor(::google::protobuf::Arena* arena) {
+}
 void CMD_UpdateServerInfos::SetCachedSize(int size) const {
   GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
   _cached_size_ = size;
@@ -3395,7 +4963,7 @@ void CMD_UpdateServerInfos::SetCachedSize(int size) const {
 }
 const ::google::protobuf::Descriptor* CMD_UpdateServerInfos::descriptor() {
   protobuf_Commands_2eproto::protobuf_AssignDescriptorsOnce();
-  return protobuf_Commands_2eproto::file_level_metadata[6].descriptor;
+  return protobuf_Commands_2eproto::file_level_metadata[7].descriptor;
 }
 
 const CMD_UpdateServerInfos& CMD_UpdateServerInfos::default_instance() {
@@ -3404,19 +4972,16 @@ const CMD_UpdateServerInfos& CMD_UpdateServerInfos::default_instance() {
 }
 
 CMD_UpdateServerInfos* CMD_UpdateServerInfos::New(::google::protobuf::Arena* arena) const {
-  CMD_UpdateServerInfos* n = new CMD_UpdateServerInfos;
-  if (arena != NULL) {
-    arena->Own(n);
-  }
-  return n;
+  return ::google::protobuf::Arena::CreateMessage<CMD_UpdateServerInfos>(arena);
 }
 
 void CMD_UpdateServerInfos::Clear() {
 // @@protoc_insertion_point(message_clear_start:CMD_UpdateServerInfos)
   child_srvs_.Clear();
-  internal_ip_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  external_ip_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  name_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  internal_ip_.ClearToEmpty(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
+  external_ip_.ClearToEmpty(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
+  name_.ClearToEmpty(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
+  hostid_.ClearToEmpty(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
   ::memset(&appid_, 0, reinterpret_cast<char*>(&appgid_) -
     reinterpret_cast<char*>(&appid_) + sizeof(appgid_));
 }
@@ -3593,6 +5158,21 @@ bool CMD_UpdateServerInfos::MergePartialFromCodedStream(
         break;
       }
 
+      // string hostID = 13;
+      case 13: {
+        if (tag == 106u) {
+          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
+                input, this->mutable_hostid()));
+          DO_(::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+            this->hostid().data(), this->hostid().length(),
+            ::google::protobuf::internal::WireFormatLite::PARSE,
+            "CMD_UpdateServerInfos.hostID"));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
       default: {
       handle_unusual:
         if (tag == 0 ||
@@ -3693,6 +5273,16 @@ void CMD_UpdateServerInfos::SerializeWithCachedSizes(
       12, this->child_srvs(i), output);
   }
 
+  // string hostID = 13;
+  if (this->hostid().size() > 0) {
+    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+      this->hostid().data(), this->hostid().length(),
+      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
+      "CMD_UpdateServerInfos.hostID");
+    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
+      13, this->hostid(), output);
+  }
+
   // @@protoc_insertion_point(serialize_end:CMD_UpdateServerInfos)
 }
 
@@ -3780,6 +5370,17 @@ void CMD_UpdateServerInfos::SerializeWithCachedSizes(
         12, this->child_srvs(i), false, target);
   }
 
+  // string hostID = 13;
+  if (this->hostid().size() > 0) {
+    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+      this->hostid().data(), this->hostid().length(),
+      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
+      "CMD_UpdateServerInfos.hostID");
+    target =
+      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
+        13, this->hostid(), target);
+  }
+
   // @@protoc_insertion_point(serialize_to_array_end:CMD_UpdateServerInfos)
   return target;
 }
@@ -3820,6 +5421,13 @@ size_t CMD_UpdateServerInfos::ByteSizeLong() const {
         this->name());
   }
 
+  // string hostID = 13;
+  if (this->hostid().size() > 0) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::StringSize(
+        this->hostid());
+  }
+
   // uint64 appID = 1;
   if (this->appid() != 0) {
     total_size += 1 +
@@ -3902,16 +5510,16 @@ void CMD_UpdateServerInfos::MergeFrom(const CMD_UpdateServerInfos& from) {
   _internal_metadata_.MergeFrom(from._internal_metadata_);
   child_srvs_.MergeFrom(from.child_srvs_);
   if (from.internal_ip().size() > 0) {
-
-    internal_ip_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.internal_ip_);
+    set_internal_ip(from.internal_ip());
   }
   if (from.external_ip().size() > 0) {
-
-    external_ip_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.external_ip_);
+    set_external_ip(from.external_ip());
   }
   if (from.name().size() > 0) {
-
-    name_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.name_);
+    set_name(from.name());
+  }
+  if (from.hostid().size() > 0) {
+    set_hostid(from.hostid());
   }
   if (from.appid() != 0) {
     set_appid(from.appid());
@@ -3959,6 +5567,21 @@ bool CMD_UpdateServerInfos::IsInitialized() const {
 
 void CMD_UpdateServerInfos::Swap(CMD_UpdateServerInfos* other) {
   if (other == this) return;
+  if (GetArenaNoVirtual() == other->GetArenaNoVirtual()) {
+    InternalSwap(other);
+  } else {
+    CMD_UpdateServerInfos* temp = New(GetArenaNoVirtual());
+    temp->MergeFrom(*other);
+    other->CopyFrom(*this);
+    InternalSwap(temp);
+    if (GetArenaNoVirtual() == NULL) {
+      delete temp;
+    }
+  }
+}
+void CMD_UpdateServerInfos::UnsafeArenaSwap(CMD_UpdateServerInfos* other) {
+  if (other == this) return;
+  GOOGLE_DCHECK(GetArenaNoVirtual() == other->GetArenaNoVirtual());
   InternalSwap(other);
 }
 void CMD_UpdateServerInfos::InternalSwap(CMD_UpdateServerInfos* other) {
@@ -3966,6 +5589,7 @@ void CMD_UpdateServerInfos::InternalSwap(CMD_UpdateServerInfos* other) {
   internal_ip_.Swap(&other->internal_ip_);
   external_ip_.Swap(&other->external_ip_);
   name_.Swap(&other->name_);
+  hostid_.Swap(&other->hostid_);
   std::swap(appid_, other->appid_);
   std::swap(apptype_, other->apptype_);
   std::swap(internal_port_, other->internal_port_);
@@ -3979,7 +5603,7 @@ void CMD_UpdateServerInfos::InternalSwap(CMD_UpdateServerInfos* other) {
 
 ::google::protobuf::Metadata CMD_UpdateServerInfos::GetMetadata() const {
   protobuf_Commands_2eproto::protobuf_AssignDescriptorsOnce();
-  return protobuf_Commands_2eproto::file_level_metadata[6];
+  return protobuf_Commands_2eproto::file_level_metadata[7];
 }
 
 #if PROTOBUF_INLINE_NOT_IN_HEADERS
@@ -4015,45 +5639,46 @@ void CMD_UpdateServerInfos::set_apptype(::google::protobuf::int32 value) {
 
 // string internal_ip = 3;
 void CMD_UpdateServerInfos::clear_internal_ip() {
-  internal_ip_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  internal_ip_.ClearToEmpty(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 const ::std::string& CMD_UpdateServerInfos::internal_ip() const {
   // @@protoc_insertion_point(field_get:CMD_UpdateServerInfos.internal_ip)
-  return internal_ip_.GetNoArena();
+  return internal_ip_.Get();
 }
 void CMD_UpdateServerInfos::set_internal_ip(const ::std::string& value) {
   
-  internal_ip_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  internal_ip_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value, GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set:CMD_UpdateServerInfos.internal_ip)
 }
-#if LANG_CXX11
-void CMD_UpdateServerInfos::set_internal_ip(::std::string&& value) {
-  
-  internal_ip_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:CMD_UpdateServerInfos.internal_ip)
-}
-#endif
 void CMD_UpdateServerInfos::set_internal_ip(const char* value) {
   
-  internal_ip_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  internal_ip_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+              GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_char:CMD_UpdateServerInfos.internal_ip)
 }
-void CMD_UpdateServerInfos::set_internal_ip(const char* value, size_t size) {
+void CMD_UpdateServerInfos::set_internal_ip(const char* value,
+    size_t size) {
   
-  internal_ip_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
+  internal_ip_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_pointer:CMD_UpdateServerInfos.internal_ip)
 }
 ::std::string* CMD_UpdateServerInfos::mutable_internal_ip() {
   
   // @@protoc_insertion_point(field_mutable:CMD_UpdateServerInfos.internal_ip)
-  return internal_ip_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return internal_ip_.Mutable(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 ::std::string* CMD_UpdateServerInfos::release_internal_ip() {
   // @@protoc_insertion_point(field_release:CMD_UpdateServerInfos.internal_ip)
   
-  return internal_ip_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return internal_ip_.Release(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
+}
+::std::string* CMD_UpdateServerInfos::unsafe_arena_release_internal_ip() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:CMD_UpdateServerInfos.internal_ip)
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  
+  return internal_ip_.UnsafeArenaRelease(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      GetArenaNoVirtual());
 }
 void CMD_UpdateServerInfos::set_allocated_internal_ip(::std::string* internal_ip) {
   if (internal_ip != NULL) {
@@ -4061,9 +5686,22 @@ void CMD_UpdateServerInfos::set_allocated_internal_ip(::std::string* internal_ip
   } else {
     
   }
-  internal_ip_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), internal_ip);
+  internal_ip_.SetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), internal_ip,
+      GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_allocated:CMD_UpdateServerInfos.internal_ip)
 }
+void CMD_UpdateServerInfos::unsafe_arena_set_allocated_internal_ip(
+    ::std::string* internal_ip) {
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  if (internal_ip != NULL) {
+    
+  } else {
+    
+  }
+  internal_ip_.UnsafeArenaSetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      internal_ip, GetArenaNoVirtual());
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:CMD_UpdateServerInfos.internal_ip)
+}
 
 // uint32 internal_port = 4;
 void CMD_UpdateServerInfos::clear_internal_port() {
@@ -4081,45 +5719,46 @@ void CMD_UpdateServerInfos::set_internal_port(::google::protobuf::uint32 value)
 
 // string external_ip = 5;
 void CMD_UpdateServerInfos::clear_external_ip() {
-  external_ip_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  external_ip_.ClearToEmpty(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 const ::std::string& CMD_UpdateServerInfos::external_ip() const {
   // @@protoc_insertion_point(field_get:CMD_UpdateServerInfos.external_ip)
-  return external_ip_.GetNoArena();
+  return external_ip_.Get();
 }
 void CMD_UpdateServerInfos::set_external_ip(const ::std::string& value) {
   
-  external_ip_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  external_ip_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value, GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set:CMD_UpdateServerInfos.external_ip)
 }
-#if LANG_CXX11
-void CMD_UpdateServerInfos::set_external_ip(::std::string&& value) {
-  
-  external_ip_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:CMD_UpdateServerInfos.external_ip)
-}
-#endif
 void CMD_UpdateServerInfos::set_external_ip(const char* value) {
   
-  external_ip_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  external_ip_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+              GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_char:CMD_UpdateServerInfos.external_ip)
 }
-void CMD_UpdateServerInfos::set_external_ip(const char* value, size_t size) {
+void CMD_UpdateServerInfos::set_external_ip(const char* value,
+    size_t size) {
   
-  external_ip_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
+  external_ip_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_pointer:CMD_UpdateServerInfos.external_ip)
 }
 ::std::string* CMD_UpdateServerInfos::mutable_external_ip() {
   
   // @@protoc_insertion_point(field_mutable:CMD_UpdateServerInfos.external_ip)
-  return external_ip_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return external_ip_.Mutable(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 ::std::string* CMD_UpdateServerInfos::release_external_ip() {
   // @@protoc_insertion_point(field_release:CMD_UpdateServerInfos.external_ip)
   
-  return external_ip_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return external_ip_.Release(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
+}
+::std::string* CMD_UpdateServerInfos::unsafe_arena_release_external_ip() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:CMD_UpdateServerInfos.external_ip)
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  
+  return external_ip_.UnsafeArenaRelease(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      GetArenaNoVirtual());
 }
 void CMD_UpdateServerInfos::set_allocated_external_ip(::std::string* external_ip) {
   if (external_ip != NULL) {
@@ -4127,9 +5766,22 @@ void CMD_UpdateServerInfos::set_allocated_external_ip(::std::string* external_ip
   } else {
     
   }
-  external_ip_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), external_ip);
+  external_ip_.SetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), external_ip,
+      GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_allocated:CMD_UpdateServerInfos.external_ip)
 }
+void CMD_UpdateServerInfos::unsafe_arena_set_allocated_external_ip(
+    ::std::string* external_ip) {
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  if (external_ip != NULL) {
+    
+  } else {
+    
+  }
+  external_ip_.UnsafeArenaSetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      external_ip, GetArenaNoVirtual());
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:CMD_UpdateServerInfos.external_ip)
+}
 
 // uint32 external_port = 6;
 void CMD_UpdateServerInfos::clear_external_port() {
@@ -4203,45 +5855,46 @@ void CMD_UpdateServerInfos::set_appgid(::google::protobuf::uint64 value) {
 
 // string name = 11;
 void CMD_UpdateServerInfos::clear_name() {
-  name_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  name_.ClearToEmpty(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 const ::std::string& CMD_UpdateServerInfos::name() const {
   // @@protoc_insertion_point(field_get:CMD_UpdateServerInfos.name)
-  return name_.GetNoArena();
+  return name_.Get();
 }
 void CMD_UpdateServerInfos::set_name(const ::std::string& value) {
   
-  name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  name_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value, GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set:CMD_UpdateServerInfos.name)
 }
-#if LANG_CXX11
-void CMD_UpdateServerInfos::set_name(::std::string&& value) {
-  
-  name_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:CMD_UpdateServerInfos.name)
-}
-#endif
 void CMD_UpdateServerInfos::set_name(const char* value) {
   
-  name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  name_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+              GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_char:CMD_UpdateServerInfos.name)
 }
-void CMD_UpdateServerInfos::set_name(const char* value, size_t size) {
+void CMD_UpdateServerInfos::set_name(const char* value,
+    size_t size) {
   
-  name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
+  name_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_pointer:CMD_UpdateServerInfos.name)
 }
 ::std::string* CMD_UpdateServerInfos::mutable_name() {
   
   // @@protoc_insertion_point(field_mutable:CMD_UpdateServerInfos.name)
-  return name_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return name_.Mutable(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 ::std::string* CMD_UpdateServerInfos::release_name() {
   // @@protoc_insertion_point(field_release:CMD_UpdateServerInfos.name)
   
-  return name_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return name_.Release(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
+}
+::std::string* CMD_UpdateServerInfos::unsafe_arena_release_name() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:CMD_UpdateServerInfos.name)
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  
+  return name_.UnsafeArenaRelease(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      GetArenaNoVirtual());
 }
 void CMD_UpdateServerInfos::set_allocated_name(::std::string* name) {
   if (name != NULL) {
@@ -4249,9 +5902,22 @@ void CMD_UpdateServerInfos::set_allocated_name(::std::string* name) {
   } else {
     
   }
-  name_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), name);
+  name_.SetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), name,
+      GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_allocated:CMD_UpdateServerInfos.name)
 }
+void CMD_UpdateServerInfos::unsafe_arena_set_allocated_name(
+    ::std::string* name) {
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  if (name != NULL) {
+    
+  } else {
+    
+  }
+  name_.UnsafeArenaSetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      name, GetArenaNoVirtual());
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:CMD_UpdateServerInfos.name)
+}
 
 // repeated .CMD_UpdateServerInfos child_srvs = 12;
 int CMD_UpdateServerInfos::child_srvs_size() const {
@@ -4283,6 +5949,72 @@ CMD_UpdateServerInfos::child_srvs() const {
   return child_srvs_;
 }
 
+// string hostID = 13;
+void CMD_UpdateServerInfos::clear_hostid() {
+  hostid_.ClearToEmpty(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
+}
+const ::std::string& CMD_UpdateServerInfos::hostid() const {
+  // @@protoc_insertion_point(field_get:CMD_UpdateServerInfos.hostID)
+  return hostid_.Get();
+}
+void CMD_UpdateServerInfos::set_hostid(const ::std::string& value) {
+  
+  hostid_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value, GetArenaNoVirtual());
+  // @@protoc_insertion_point(field_set:CMD_UpdateServerInfos.hostID)
+}
+void CMD_UpdateServerInfos::set_hostid(const char* value) {
+  
+  hostid_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+              GetArenaNoVirtual());
+  // @@protoc_insertion_point(field_set_char:CMD_UpdateServerInfos.hostID)
+}
+void CMD_UpdateServerInfos::set_hostid(const char* value,
+    size_t size) {
+  
+  hostid_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArenaNoVirtual());
+  // @@protoc_insertion_point(field_set_pointer:CMD_UpdateServerInfos.hostID)
+}
+::std::string* CMD_UpdateServerInfos::mutable_hostid() {
+  
+  // @@protoc_insertion_point(field_mutable:CMD_UpdateServerInfos.hostID)
+  return hostid_.Mutable(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
+}
+::std::string* CMD_UpdateServerInfos::release_hostid() {
+  // @@protoc_insertion_point(field_release:CMD_UpdateServerInfos.hostID)
+  
+  return hostid_.Release(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
+}
+::std::string* CMD_UpdateServerInfos::unsafe_arena_release_hostid() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:CMD_UpdateServerInfos.hostID)
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  
+  return hostid_.UnsafeArenaRelease(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      GetArenaNoVirtual());
+}
+void CMD_UpdateServerInfos::set_allocated_hostid(::std::string* hostid) {
+  if (hostid != NULL) {
+    
+  } else {
+    
+  }
+  hostid_.SetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), hostid,
+      GetArenaNoVirtual());
+  // @@protoc_insertion_point(field_set_allocated:CMD_UpdateServerInfos.hostID)
+}
+void CMD_UpdateServerInfos::unsafe_arena_set_allocated_hostid(
+    ::std::string* hostid) {
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  if (hostid != NULL) {
+    
+  } else {
+    
+  }
+  hostid_.UnsafeArenaSetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      hostid, GetArenaNoVirtual());
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:CMD_UpdateServerInfos.hostID)
+}
+
 #endif  // PROTOBUF_INLINE_NOT_IN_HEADERS
 
 // ===================================================================
@@ -4302,6 +6034,16 @@ CMD_QueryServerInfos::CMD_QueryServerInfos()
   SharedCtor();
   // @@protoc_insertion_point(constructor:CMD_QueryServerInfos)
 }
+CMD_QueryServerInfos::CMD_QueryServerInfos(::google::protobuf::Arena* arena)
+  : ::google::protobuf::Message(),
+  _internal_metadata_(arena) {
+#ifdef GOOGLE_PROTOBUF_NO_STATIC_INITIALIZER
+  protobuf_Commands_2eproto::InitDefaults();
+#endif  // GOOGLE_PROTOBUF_NO_STATIC_INITIALIZER
+  SharedCtor();
+  RegisterArenaDtor(arena);
+  // @@protoc_insertion_point(arena_constructor:CMD_QueryServerInfos)
+}
 CMD_QueryServerInfos::CMD_QueryServerInfos(const CMD_QueryServerInfos& from)
   : ::google::protobuf::Message(),
       _internal_metadata_(NULL),
@@ -4325,8 +6067,19 @@ CMD_QueryServerInfos::~CMD_QueryServerInfos() {
 }
 
 void CMD_QueryServerInfos::SharedDtor() {
+  ::google::protobuf::Arena* arena = GetArenaNoVirtual();
+  if (arena != NULL) {
+    return;
+  }
+
 }
 
+void CMD_QueryServerInfos::ArenaDtor(void* object) {
+  CMD_QueryServerInfos* _this = reinterpret_cast< CMD_QueryServerInfos* >(object);
+  (void)_this;
+}
+void CMD_QueryServerInfos::RegisterArenaDtor(::google::protobuf::Arena* arena) {
+}
 void CMD_QueryServerInfos::SetCachedSize(int size) const {
   GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
   _cached_size_ = size;
@@ -4334,7 +6087,7 @@ void CMD_QueryServerInfos::SetCachedSize(int size) const {
 }
 const ::google::protobuf::Descriptor* CMD_QueryServerInfos::descriptor() {
   protobuf_Commands_2eproto::protobuf_AssignDescriptorsOnce();
-  return protobuf_Commands_2eproto::file_level_metadata[7].descriptor;
+  return protobuf_Commands_2eproto::file_level_metadata[8].descriptor;
 }
 
 const CMD_QueryServerInfos& CMD_QueryServerInfos::default_instance() {
@@ -4343,11 +6096,7 @@ const CMD_QueryServerInfos& CMD_QueryServerInfos::default_instance() {
 }
 
 CMD_QueryServerInfos* CMD_QueryServerInfos::New(::google::protobuf::Arena* arena) const {
-  CMD_QueryServerInfos* n = new CMD_QueryServerInfos;
-  if (arena != NULL) {
-    arena->Own(n);
-  }
-  return n;
+  return ::google::protobuf::Arena::CreateMessage<CMD_QueryServerInfos>(arena);
 }
 
 void CMD_QueryServerInfos::Clear() {
@@ -4585,6 +6334,21 @@ bool CMD_QueryServerInfos::IsInitialized() const {
 
 void CMD_QueryServerInfos::Swap(CMD_QueryServerInfos* other) {
   if (other == this) return;
+  if (GetArenaNoVirtual() == other->GetArenaNoVirtual()) {
+    InternalSwap(other);
+  } else {
+    CMD_QueryServerInfos* temp = New(GetArenaNoVirtual());
+    temp->MergeFrom(*other);
+    other->CopyFrom(*this);
+    InternalSwap(temp);
+    if (GetArenaNoVirtual() == NULL) {
+      delete temp;
+    }
+  }
+}
+void CMD_QueryServerInfos::UnsafeArenaSwap(CMD_QueryServerInfos* other) {
+  if (other == this) return;
+  GOOGLE_DCHECK(GetArenaNoVirtual() == other->GetArenaNoVirtual());
   InternalSwap(other);
 }
 void CMD_QueryServerInfos::InternalSwap(CMD_QueryServerInfos* other) {
@@ -4597,7 +6361,7 @@ void CMD_QueryServerInfos::InternalSwap(CMD_QueryServerInfos* other) {
 
 ::google::protobuf::Metadata CMD_QueryServerInfos::GetMetadata() const {
   protobuf_Commands_2eproto::protobuf_AssignDescriptorsOnce();
-  return protobuf_Commands_2eproto::file_level_metadata[7];
+  return protobuf_Commands_2eproto::file_level_metadata[8];
 }
 
 #if PROTOBUF_INLINE_NOT_IN_HEADERS
@@ -4649,14 +6413,292 @@ void CMD_QueryServerInfos::set_apptype(::google::protobuf::int32 value) {
 void CMD_QueryServerInfos::clear_maxnum() {
   maxnum_ = 0;
 }
-::google::protobuf::int32 CMD_QueryServerInfos::maxnum() const {
-  // @@protoc_insertion_point(field_get:CMD_QueryServerInfos.maxNum)
-  return maxnum_;
+::google::protobuf::int32 CMD_QueryServerInfos::maxnum() const {
+  // @@protoc_insertion_point(field_get:CMD_QueryServerInfos.maxNum)
+  return maxnum_;
+}
+void CMD_QueryServerInfos::set_maxnum(::google::protobuf::int32 value) {
+  
+  maxnum_ = value;
+  // @@protoc_insertion_point(field_set:CMD_QueryServerInfos.maxNum)
+}
+
+#endif  // PROTOBUF_INLINE_NOT_IN_HEADERS
+
+// ===================================================================
+
+#if !defined(_MSC_VER) || _MSC_VER >= 1900
+const int CMD_QueryServerInfosCB::kSrvsFieldNumber;
+#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+
+CMD_QueryServerInfosCB::CMD_QueryServerInfosCB()
+  : ::google::protobuf::Message(), _internal_metadata_(NULL) {
+  if (GOOGLE_PREDICT_TRUE(this != internal_default_instance())) {
+    protobuf_Commands_2eproto::InitDefaults();
+  }
+  SharedCtor();
+  // @@protoc_insertion_point(constructor:CMD_QueryServerInfosCB)
+}
+CMD_QueryServerInfosCB::CMD_QueryServerInfosCB(::google::protobuf::Arena* arena)
+  : ::google::protobuf::Message(),
+  _internal_metadata_(arena),
+  srvs_(arena) {
+#ifdef GOOGLE_PROTOBUF_NO_STATIC_INITIALIZER
+  protobuf_Commands_2eproto::InitDefaults();
+#endif  // GOOGLE_PROTOBUF_NO_STATIC_INITIALIZER
+  SharedCtor();
+  RegisterArenaDtor(arena);
+  // @@protoc_insertion_point(arena_constructor:CMD_QueryServerInfosCB)
+}
+CMD_QueryServerInfosCB::CMD_QueryServerInfosCB(const CMD_QueryServerInfosCB& from)
+  : ::google::protobuf::Message(),
+      _internal_metadata_(NULL),
+      srvs_(from.srvs_),
+      _cached_size_(0) {
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:CMD_QueryServerInfosCB)
+}
+
+void CMD_QueryServerInfosCB::SharedCtor() {
+  _cached_size_ = 0;
+}
+
+CMD_QueryServerInfosCB::~CMD_QueryServerInfosCB() {
+  // @@protoc_insertion_point(destructor:CMD_QueryServerInfosCB)
+  SharedDtor();
+}
+
+void CMD_QueryServerInfosCB::SharedDtor() {
+  ::google::protobuf::Arena* arena = GetArenaNoVirtual();
+  if (arena != NULL) {
+    return;
+  }
+
+}
+
+void CMD_QueryServerInfosCB::ArenaDtor(void* object) {
+  CMD_QueryServerInfosCB* _this = reinterpret_cast< CMD_QueryServerInfosCB* >(object);
+  (void)_this;
+}
+void CMD_QueryServerInfosCB::RegisterArenaDtor(::google::protobuf::Arena* arena) {
+}
+void CMD_QueryServerInfosCB::SetCachedSize(int size) const {
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+}
+const ::google::protobuf::Descriptor* CMD_QueryServerInfosCB::descriptor() {
+  protobuf_Commands_2eproto::protobuf_AssignDescriptorsOnce();
+  return protobuf_Commands_2eproto::file_level_metadata[9].descriptor;
+}
+
+const CMD_QueryServerInfosCB& CMD_QueryServerInfosCB::default_instance() {
+  protobuf_Commands_2eproto::InitDefaults();
+  return *internal_default_instance();
+}
+
+CMD_QueryServerInfosCB* CMD_QueryServerInfosCB::New(::google::protobuf::Arena* arena) const {
+  return ::google::protobuf::Arena::CreateMessage<CMD_QueryServerInfosCB>(arena);
+}
+
+void CMD_QueryServerInfosCB::Clear() {
+// @@protoc_insertion_point(message_clear_start:CMD_QueryServerInfosCB)
+  srvs_.Clear();
+}
+
+bool CMD_QueryServerInfosCB::MergePartialFromCodedStream(
+    ::google::protobuf::io::CodedInputStream* input) {
+#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
+  ::google::protobuf::uint32 tag;
+  // @@protoc_insertion_point(parse_start:CMD_QueryServerInfosCB)
+  for (;;) {
+    ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
+    tag = p.first;
+    if (!p.second) goto handle_unusual;
+    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+      // repeated .CMD_UpdateServerInfos srvs = 1;
+      case 1: {
+        if (tag == 10u) {
+          DO_(input->IncrementRecursionDepth());
+          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtualNoRecursionDepth(
+                input, add_srvs()));
+        } else {
+          goto handle_unusual;
+        }
+        input->UnsafeDecrementRecursionDepth();
+        break;
+      }
+
+      default: {
+      handle_unusual:
+        if (tag == 0 ||
+            ::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
+          goto success;
+        }
+        DO_(::google::protobuf::internal::WireFormatLite::SkipField(input, tag));
+        break;
+      }
+    }
+  }
+success:
+  // @@protoc_insertion_point(parse_success:CMD_QueryServerInfosCB)
+  return true;
+failure:
+  // @@protoc_insertion_point(parse_failure:CMD_QueryServerInfosCB)
+  return false;
+#undef DO_
+}
+
+void CMD_QueryServerInfosCB::SerializeWithCachedSizes(
+    ::google::protobuf::io::CodedOutputStream* output) const {
+  // @@protoc_insertion_point(serialize_start:CMD_QueryServerInfosCB)
+  // repeated .CMD_UpdateServerInfos srvs = 1;
+  for (unsigned int i = 0, n = this->srvs_size(); i < n; i++) {
+    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
+      1, this->srvs(i), output);
+  }
+
+  // @@protoc_insertion_point(serialize_end:CMD_QueryServerInfosCB)
+}
+
+::google::protobuf::uint8* CMD_QueryServerInfosCB::InternalSerializeWithCachedSizesToArray(
+    bool deterministic, ::google::protobuf::uint8* target) const {
+  (void)deterministic;  // Unused
+  // @@protoc_insertion_point(serialize_to_array_start:CMD_QueryServerInfosCB)
+  // repeated .CMD_UpdateServerInfos srvs = 1;
+  for (unsigned int i = 0, n = this->srvs_size(); i < n; i++) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      InternalWriteMessageNoVirtualToArray(
+        1, this->srvs(i), false, target);
+  }
+
+  // @@protoc_insertion_point(serialize_to_array_end:CMD_QueryServerInfosCB)
+  return target;
+}
+
+size_t CMD_QueryServerInfosCB::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:CMD_QueryServerInfosCB)
+  size_t total_size = 0;
+
+  // repeated .CMD_UpdateServerInfos srvs = 1;
+  {
+    unsigned int count = this->srvs_size();
+    total_size += 1UL * count;
+    for (unsigned int i = 0; i < count; i++) {
+      total_size +=
+        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
+          this->srvs(i));
+    }
+  }
+
+  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = cached_size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  return total_size;
+}
+
+void CMD_QueryServerInfosCB::MergeFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:CMD_QueryServerInfosCB)
+  GOOGLE_DCHECK_NE(&from, this);
+  const CMD_QueryServerInfosCB* source =
+      ::google::protobuf::internal::DynamicCastToGenerated<const CMD_QueryServerInfosCB>(
+          &from);
+  if (source == NULL) {
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:CMD_QueryServerInfosCB)
+    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
+  } else {
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:CMD_QueryServerInfosCB)
+    MergeFrom(*source);
+  }
+}
+
+void CMD_QueryServerInfosCB::MergeFrom(const CMD_QueryServerInfosCB& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:CMD_QueryServerInfosCB)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  srvs_.MergeFrom(from.srvs_);
+}
+
+void CMD_QueryServerInfosCB::CopyFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:CMD_QueryServerInfosCB)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void CMD_QueryServerInfosCB::CopyFrom(const CMD_QueryServerInfosCB& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:CMD_QueryServerInfosCB)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool CMD_QueryServerInfosCB::IsInitialized() const {
+  return true;
+}
+
+void CMD_QueryServerInfosCB::Swap(CMD_QueryServerInfosCB* other) {
+  if (other == this) return;
+  if (GetArenaNoVirtual() == other->GetArenaNoVirtual()) {
+    InternalSwap(other);
+  } else {
+    CMD_QueryServerInfosCB* temp = New(GetArenaNoVirtual());
+    temp->MergeFrom(*other);
+    other->CopyFrom(*this);
+    InternalSwap(temp);
+    if (GetArenaNoVirtual() == NULL) {
+      delete temp;
+    }
+  }
+}
+void CMD_QueryServerInfosCB::UnsafeArenaSwap(CMD_QueryServerInfosCB* other) {
+  if (other == this) return;
+  GOOGLE_DCHECK(GetArenaNoVirtual() == other->GetArenaNoVirtual());
+  InternalSwap(other);
+}
+void CMD_QueryServerInfosCB::InternalSwap(CMD_QueryServerInfosCB* other) {
+  srvs_.UnsafeArenaSwap(&other->srvs_);
+  std::swap(_cached_size_, other->_cached_size_);
+}
+
+::google::protobuf::Metadata CMD_QueryServerInfosCB::GetMetadata() const {
+  protobuf_Commands_2eproto::protobuf_AssignDescriptorsOnce();
+  return protobuf_Commands_2eproto::file_level_metadata[9];
+}
+
+#if PROTOBUF_INLINE_NOT_IN_HEADERS
+// CMD_QueryServerInfosCB
+
+// repeated .CMD_UpdateServerInfos srvs = 1;
+int CMD_QueryServerInfosCB::srvs_size() const {
+  return srvs_.size();
+}
+void CMD_QueryServerInfosCB::clear_srvs() {
+  srvs_.Clear();
+}
+const ::CMD_UpdateServerInfos& CMD_QueryServerInfosCB::srvs(int index) const {
+  // @@protoc_insertion_point(field_get:CMD_QueryServerInfosCB.srvs)
+  return srvs_.Get(index);
+}
+::CMD_UpdateServerInfos* CMD_QueryServerInfosCB::mutable_srvs(int index) {
+  // @@protoc_insertion_point(field_mutable:CMD_QueryServerInfosCB.srvs)
+  return srvs_.Mutable(index);
+}
+::CMD_UpdateServerInfos* CMD_QueryServerInfosCB::add_srvs() {
+  // @@protoc_insertion_point(field_add:CMD_QueryServerInfosCB.srvs)
+  return srvs_.Add();
 }
-void CMD_QueryServerInfos::set_maxnum(::google::protobuf::int32 value) {
-  
-  maxnum_ = value;
-  // @@protoc_insertion_point(field_set:CMD_QueryServerInfos.maxNum)
+::google::protobuf::RepeatedPtrField< ::CMD_UpdateServerInfos >*
+CMD_QueryServerInfosCB::mutable_srvs() {
+  // @@protoc_insertion_point(field_mutable_list:CMD_QueryServerInfosCB.srvs)
+  return &srvs_;
+}
+const ::google::protobuf::RepeatedPtrField< ::CMD_UpdateServerInfos >&
+CMD_QueryServerInfosCB::srvs() const {
+  // @@protoc_insertion_point(field_list:CMD_QueryServerInfosCB.srvs)
+  return srvs_;
 }
 
 #endif  // PROTOBUF_INLINE_NOT_IN_HEADERS
@@ -4664,86 +6706,104 @@ void CMD_QueryServerInfos::set_maxnum(::google::protobuf::int32 value) {
 // ===================================================================
 
 #if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int CMD_QueryServerInfosCB::kSrvsFieldNumber;
+const int CMD_ShmAttach::kOkFieldNumber;
 #endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
 
-CMD_QueryServerInfosCB::CMD_QueryServerInfosCB()
+CMD_ShmAttach::CMD_ShmAttach()
   : ::google::protobuf::Message(), _internal_metadata_(NULL) {
   if (GOOGLE_PREDICT_TRUE(this != internal_default_instance())) {
     protobuf_Commands_2eproto::InitDefaults();
   }
   SharedCtor();
-  // @@protoc_insertion_point(constructor:CMD_QueryServerInfosCB)
+  // @@protoc_insertion_point(constructor:CMD_ShmAttach)
 }
-CMD_QueryServerInfosCB::CMD_QueryServerInfosCB(const CMD_QueryServerInfosCB& from)
+CMD_ShmAttach::CMD_ShmAttach(::google::protobuf::Arena* arena)
+  : ::google::protobuf::Message(),
+  _internal_metadata_(arena) {
+#ifdef GOOGLE_PROTOBUF_NO_STATIC_INITIALIZER
+  protobuf_Commands_2eproto::InitDefaults();
+#endif  // GOOGLE_PROTOBUF_NO_STATIC_INITIALIZER
+  SharedCtor();
+  RegisterArenaDtor(arena);
+  // @@protoc_insertion_point(arena_constructor:CMD_ShmAttach)
+}
+CMD_ShmAttach::CMD_ShmAttach(const CMD_ShmAttach& from)
   : ::google::protobuf::Message(),
       _internal_metadata_(NULL),
-      srvs_(from.srvs_),
       _cached_size_(0) {
   _internal_metadata_.MergeFrom(from._internal_metadata_);
-  // @@protoc_insertion_point(copy_constructor:CMD_QueryServerInfosCB)
+  ok_ = from.ok_;
+  // @@protoc_insertion_point(copy_constructor:CMD_ShmAttach)
 }
 
-void CMD_QueryServerInfosCB::SharedCtor() {
+void CMD_ShmAttach::SharedCtor() {
+  ok_ = false;
   _cached_size_ = 0;
 }
 
-CMD_QueryServerInfosCB::~CMD_QueryServerInfosCB() {
-  // @@protoc_insertion_point(destructor:CMD_QueryServerInfosCB)
+CMD_ShmAttach::~CMD_ShmAttach() {
+  // @@protoc_insertion_point(destructor:CMD_ShmAttach)
   SharedDtor();
 }
 
-void CMD_QueryServerInfosCB::SharedDtor() {
+void CMD_ShmAttach::SharedDtor() {
+  ::google::protobuf::Arena* arena = GetArenaNoVirtual();
+  if (arena != NULL) {
+    return;
+  }
+
 }
 
-void CMD_QueryServerInfosCB::SetCachedSize(int size) const {
+void CMD_ShmAttach::ArenaDtor(void* object) {
+  CMD_ShmAttach* _this = reinterpret_cast< CMD_ShmAttach* >(object);
+  (void)_this;
+}
+void CMD_ShmAttach::RegisterArenaDtor(::google::protobuf::Arena* arena) {
+}
+void CMD_ShmAttach::SetCachedSize(int size) const {
   GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
   _cached_size_ = size;
   GOOGLE_SAFE_CONCURRENT_WRITES_END();
 }
-const ::google::protobuf::Descriptor* CMD_QueryServerInfosCB::descriptor() {
+const ::google::protobuf::Descriptor* CMD_ShmAttach::descriptor() {
   protobuf_Commands_2eproto::protobuf_AssignDescriptorsOnce();
-  return protobuf_Commands_2eproto::file_level_metadata[8].descriptor;
+  return protobuf_Commands_2eproto::file_level_metadata[10].descriptor;
 }
 
-const CMD_QueryServerInfosCB& CMD_QueryServerInfosCB::default_instance() {
+const CMD_ShmAttach& CMD_ShmAttach::default_instance() {
   protobuf_Commands_2eproto::InitDefaults();
   return *internal_default_instance();
 }
 
-CMD_QueryServerInfosCB* CMD_QueryServerInfosCB::New(::google::protobuf::Arena* arena) const {
-  CMD_QueryServerInfosCB* n = new CMD_QueryServerInfosCB;
-  if (arena != NULL) {
-    arena->Own(n);
-  }
-  return n;
+CMD_ShmAttach* CMD_ShmAttach::New(::google::protobuf::Arena* arena) const {
+  return ::google::protobuf::Arena::CreateMessage<CMD_ShmAttach>(arena);
 }
 
-void CMD_QueryServerInfosCB::Clear() {
-// @@protoc_insertion_point(message_clear_start:CMD_QueryServerInfosCB)
-  srvs_.Clear();
+void CMD_ShmAttach::Clear() {
+// @@protoc_insertion_point(message_clear_start:CMD_ShmAttach)
+  ok_ = false;
 }
 
-bool CMD_QueryServerInfosCB::MergePartialFromCodedStream(
+bool CMD_ShmAttach::MergePartialFromCodedStream(
     ::google::protobuf::io::CodedInputStream* input) {
 #define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
   ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:CMD_QueryServerInfosCB)
+  // @@protoc_insertion_point(parse_start:CMD_ShmAttach)
   for (;;) {
     ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
     tag = p.first;
     if (!p.second) goto handle_unusual;
     switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
-      // repeated .CMD_UpdateServerInfos srvs = 1;
+      // bool ok = 1;
       case 1: {
-        if (tag == 10u) {
-          DO_(input->IncrementRecursionDepth());
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtualNoRecursionDepth(
-                input, add_srvs()));
+        if (tag == 8u) {
+
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   bool, ::google::protobuf::internal::WireFormatLite::TYPE_BOOL>(
+                 input, &ok_)));
         } else {
           goto handle_unusual;
         }
-        input->UnsafeDecrementRecursionDepth();
         break;
       }
 
@@ -4760,54 +6820,45 @@ bool CMD_QueryServerInfosCB::MergePartialFromCodedStream(
     }
   }
 success:
-  // @@protoc_insertion_point(parse_success:CMD_QueryServerInfosCB)
+  // @@protoc_insertion_point(parse_success:CMD_ShmAttach)
   return true;
 failure:
-  // @@protoc_insertion_point(parse_failure:CMD_QueryServerInfosCB)
+  // @@protoc_insertion_point(parse_failure:CMD_ShmAttach)
   return false;
 #undef DO_
 }
 
-void CMD_QueryServerInfosCB::SerializeWithCachedSizes(
+void CMD_ShmAttach::SerializeWithCachedSizes(
     ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:CMD_QueryServerInfosCB)
-  // repeated .CMD_UpdateServerInfos srvs = 1;
-  for (unsigned int i = 0, n = this->srvs_size(); i < n; i++) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      1, this->srvs(i), output);
+  // @@protoc_insertion_point(serialize_start:CMD_ShmAttach)
+  // bool ok = 1;
+  if (this->ok() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteBool(1, this->ok(), output);
   }
 
-  // @@protoc_insertion_point(serialize_end:CMD_QueryServerInfosCB)
+  // @@protoc_insertion_point(serialize_end:CMD_ShmAttach)
 }
 
-::google::protobuf::uint8* CMD_QueryServerInfosCB::InternalSerializeWithCachedSizesToArray(
+::google::protobuf::uint8* CMD_ShmAttach::InternalSerializeWithCachedSizesToArray(
     bool deterministic, ::google::protobuf::uint8* target) const {
   (void)deterministic;  // Unused
-  // @@protoc_insertion_point(serialize_to_array_start:CMD_QueryServerInfosCB)
-  // repeated .CMD_UpdateServerInfos srvs = 1;
-  for (unsigned int i = 0, n = this->srvs_size(); i < n; i++) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      InternalWriteMessageNoVirtualToArray(
-        1, this->srvs(i), false, target);
+  // @@protoc_insertion_point(serialize_to_array_start:CMD_ShmAttach)
+  // bool ok = 1;
+  if (this->ok() != 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteBoolToArray(1, this->ok(), target);
   }
 
-  // @@protoc_insertion_point(serialize_to_array_end:CMD_QueryServerInfosCB)
+  // @@protoc_insertion_point(serialize_to_array_end:CMD_ShmAttach)
   return target;
 }
 
-size_t CMD_QueryServerInfosCB::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:CMD_QueryServerInfosCB)
+size_t CMD_ShmAttach::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:CMD_ShmAttach)
   size_t total_size = 0;
 
-  // repeated .CMD_UpdateServerInfos srvs = 1;
-  {
-    unsigned int count = this->srvs_size();
-    total_size += 1UL * count;
-    for (unsigned int i = 0; i < count; i++) {
-      total_size +=
-        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-          this->srvs(i));
-    }
+  // bool ok = 1;
+  if (this->ok() != 0) {
+    total_size += 1 + 1;
   }
 
   int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
@@ -4817,91 +6868,92 @@ size_t CMD_QueryServerInfosCB::ByteSizeLong() const {
   return total_size;
 }
 
-void CMD_QueryServerInfosCB::MergeFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:CMD_QueryServerInfosCB)
+void CMD_ShmAttach::MergeFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:CMD_ShmAttach)
   GOOGLE_DCHECK_NE(&from, this);
-  const CMD_QueryServerInfosCB* source =
-      ::google::protobuf::internal::DynamicCastToGenerated<const CMD_QueryServerInfosCB>(
+  const CMD_ShmAttach* source =
+      ::google::protobuf::internal::DynamicCastToGenerated<const CMD_ShmAttach>(
           &from);
   if (source == NULL) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:CMD_QueryServerInfosCB)
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:CMD_ShmAttach)
     ::google::protobuf::internal::ReflectionOps::Merge(from, this);
   } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:CMD_QueryServerInfosCB)
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:CMD_ShmAttach)
     MergeFrom(*source);
   }
 }
 
-void CMD_QueryServerInfosCB::MergeFrom(const CMD_QueryServerInfosCB& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:CMD_QueryServerInfosCB)
+void CMD_ShmAttach::MergeFrom(const CMD_ShmAttach& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:CMD_ShmAttach)
   GOOGLE_DCHECK_NE(&from, this);
   _internal_metadata_.MergeFrom(from._internal_metadata_);
-  srvs_.MergeFrom(from.srvs_);
+  if (from.ok() != 0) {
+    set_ok(from.ok());
+  }
 }
 
-void CMD_QueryServerInfosCB::CopyFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:CMD_QueryServerInfosCB)
+void CMD_ShmAttach::CopyFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:CMD_ShmAttach)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-void CMD_QueryServerInfosCB::CopyFrom(const CMD_QueryServerInfosCB& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:CMD_QueryServerInfosCB)
+void CMD_ShmAttach::CopyFrom(const CMD_ShmAttach& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:CMD_ShmAttach)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool CMD_QueryServerInfosCB::IsInitialized() const {
+bool CMD_ShmAttach::IsInitialized() const {
   return true;
 }
 
-void CMD_QueryServerInfosCB::Swap(CMD_QueryServerInfosCB* other) {
+void CMD_ShmAttach::Swap(CMD_ShmAttach* other) {
+  if (other == this) return;
+  if (GetArenaNoVirtual() == other->GetArenaNoVirtual()) {
+    InternalSwap(other);
+  } else {
+    CMD_ShmAttach* temp = New(GetArenaNoVirtual());
+    temp->MergeFrom(*other);
+    other->CopyFrom(*this);
+    InternalSwap(temp);
+    if (GetArenaNoVirtual() == NULL) {
+      delete temp;
+    }
+  }
+}
+void CMD_ShmAttach::UnsafeArenaSwap(CMD_ShmAttach* other) {
   if (other == this) return;
+  GOOGLE_DCHECK(GetArenaNoVirtual() == other->GetArenaNoVirtual());
   InternalSwap(other);
 }
-void CMD_QueryServerInfosCB::InternalSwap(CMD_QueryServerInfosCB* other) {
-  srvs_.UnsafeArenaSwap(&other->srvs_);
+void CMD_ShmAttach::InternalSwap(CMD_ShmAttach* other) {
+  std::swap(ok_, other->ok_);
   std::swap(_cached_size_, other->_cached_size_);
 }
 
-::google::protobuf::Metadata CMD_QueryServerInfosCB::GetMetadata() const {
+::google::protobuf::Metadata CMD_ShmAttach::GetMetadata() const {
   protobuf_Commands_2eproto::protobuf_AssignDescriptorsOnce();
-  return protobuf_Commands_2eproto::file_level_metadata[8];
+  return protobuf_Commands_2eproto::file_level_metadata[10];
 }
 
 #if PROTOBUF_INLINE_NOT_IN_HEADERS
-// CMD_QueryServerInfosCB
+// CMD_ShmAttach
 
-// repeated .CMD_UpdateServerInfos srvs = 1;
-int CMD_QueryServerInfosCB::srvs_size() const {
-  return srvs_.size();
-}
-void CMD_QueryServerInfosCB::clear_srvs() {
-  srvs_.Clear();
-}
-const ::CMD_UpdateServerInfos& CMD_QueryServerInfosCB::srvs(int index) const {
-  // @@protoc_insertion_point(field_get:CMD_QueryServerInfosCB.srvs)
-  return srvs_.Get(index);
-}
-::CMD_UpdateServerInfos* CMD_QueryServerInfosCB::mutable_srvs(int index) {
-  // @@protoc_insertion_point(field_mutable:CMD_QueryServerInfosCB.srvs)
-  return srvs_.Mutable(index);
-}
-::CMD_UpdateServerInfos* CMD_QueryServerInfosCB::add_srvs() {
-  // @@protoc_insertion_point(field_add:CMD_QueryServerInfosCB.srvs)
-  return srvs_.Add();
+// bool ok = 1;
+void CMD_ShmAttach::clear_ok() {
+  ok_ = false;
 }
-::google::protobuf::RepeatedPtrField< ::CMD_UpdateServerInfos >*
-CMD_QueryServerInfosCB::mutable_srvs() {
-  // @@protoc_insertion_point(field_mutable_list:CMD_QueryServerInfosCB.srvs)
-  return &srvs_;
+bool CMD_ShmAttach::ok() const {
+  // @@protoc_insertion_point(field_get:CMD_ShmAttach.ok)
+  return ok_;
 }
-const ::google::protobuf::RepeatedPtrField< ::CMD_UpdateServerInfos >&
-CMD_QueryServerInfosCB::srvs() const {
-  // @@protoc_insertion_point(field_list:CMD_QueryServerInfosCB.srvs)
-  return srvs_;
+void CMD_ShmAttach::set_ok(bool value) {
+  
+  ok_ = value;
+  // @@protoc_insertion_point(field_set:CMD_ShmAttach.ok)
 }
 
 #endif  // PROTOBUF_INLINE_NOT_IN_HEADERS
@@ -4920,6 +6972,16 @@ CMD_Ping::CMD_Ping()
   SharedCtor();
   // @@protoc_insertion_point(constructor:CMD_Ping)
 }
+CMD_Ping::CMD_Ping(::google::protobuf::Arena* arena)
+  : ::google::protobuf::Message(),
+  _internal_metadata_(arena) {
+#ifdef GOOGLE_PROTOBUF_NO_STATIC_INITIALIZER
+  protobuf_Commands_2eproto::InitDefaults();
+#endif  // GOOGLE_PROTOBUF_NO_STATIC_INITIALIZER
+  SharedCtor();
+  RegisterArenaDtor(arena);
+  // @@protoc_insertion_point(arena_constructor:CMD_Ping)
+}
 CMD_Ping::CMD_Ping(const CMD_Ping& from)
   : ::google::protobuf::Message(),
       _internal_metadata_(NULL),
@@ -4940,8 +7002,19 @@ CMD_Ping::~CMD_Ping() {
 }
 
 void CMD_Ping::SharedDtor() {
+  ::google::protobuf::Arena* arena = GetArenaNoVirtual();
+  if (arena != NULL) {
+    return;
+  }
+
 }
 
+void CMD_Ping::ArenaDtor(void* object) {
+  CMD_Ping* _this = reinterpret_cast< CMD_Ping* >(object);
+  (void)_this;
+}
+void CMD_Ping::RegisterArenaDtor(::google::protobuf::Arena* arena) {
+}
 void CMD_Ping::SetCachedSize(int size) const {
   GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
   _cached_size_ = size;
@@ -4949,7 +7022,7 @@ void CMD_Ping::SetCachedSize(int size) const {
 }
 const ::google::protobuf::Descriptor* CMD_Ping::descriptor() {
   protobuf_Commands_2eproto::protobuf_AssignDescriptorsOnce();
-  return protobuf_Commands_2eproto::file_level_metadata[9].descriptor;
+  return protobuf_Commands_2eproto::file_level_metadata[11].descriptor;
 }
 
 const CMD_Ping& CMD_Ping::default_instance() {
@@ -4958,11 +7031,7 @@ const CMD_Ping& CMD_Ping::default_instance() {
 }
 
 CMD_Ping* CMD_Ping::New(::google::protobuf::Arena* arena) const {
-  CMD_Ping* n = new CMD_Ping;
-  if (arena != NULL) {
-    arena->Own(n);
-  }
-  return n;
+  return ::google::protobuf::Arena::CreateMessage<CMD_Ping>(arena);
 }
 
 void CMD_Ping::Clear() {
@@ -5100,6 +7169,21 @@ bool CMD_Ping::IsInitialized() const {
 
 void CMD_Ping::Swap(CMD_Ping* other) {
   if (other == this) return;
+  if (GetArenaNoVirtual() == other->GetArenaNoVirtual()) {
+    InternalSwap(other);
+  } else {
+    CMD_Ping* temp = New(GetArenaNoVirtual());
+    temp->MergeFrom(*other);
+    other->CopyFrom(*this);
+    InternalSwap(temp);
+    if (GetArenaNoVirtual() == NULL) {
+      delete temp;
+    }
+  }
+}
+void CMD_Ping::UnsafeArenaSwap(CMD_Ping* other) {
+  if (other == this) return;
+  GOOGLE_DCHECK(GetArenaNoVirtual() == other->GetArenaNoVirtual());
   InternalSwap(other);
 }
 void CMD_Ping::InternalSwap(CMD_Ping* other) {
@@ -5109,7 +7193,7 @@ void CMD_Ping::InternalSwap(CMD_Ping* other) {
 
 ::google::protobuf::Metadata CMD_Ping::GetMetadata() const {
   protobuf_Commands_2eproto::protobuf_AssignDescriptorsOnce();
-  return protobuf_Commands_2eproto::file_level_metadata[9];
+  return protobuf_Commands_2eproto::file_level_metadata[11];
 }
 
 #if PROTOBUF_INLINE_NOT_IN_HEADERS
@@ -5145,6 +7229,16 @@ CMD_Pong::CMD_Pong()
   SharedCtor();
   // @@protoc_insertion_point(constructor:CMD_Pong)
 }
+CMD_Pong::CMD_Pong(::google::protobuf::Arena* arena)
+  : ::google::protobuf::Message(),
+  _internal_metadata_(arena) {
+#ifdef GOOGLE_PROTOBUF_NO_STATIC_INITIALIZER
+  protobuf_Commands_2eproto::InitDefaults();
+#endif  // GOOGLE_PROTOBUF_NO_STATIC_INITIALIZER
+  SharedCtor();
+  RegisterArenaDtor(arena);
+  // @@protoc_insertion_point(arena_constructor:CMD_Pong)
+}
 CMD_Pong::CMD_Pong(const CMD_Pong& from)
   : ::google::protobuf::Message(),
       _internal_metadata_(NULL),
@@ -5165,8 +7259,19 @@ CMD_Pong::~CMD_Pong() {
 }
 
 void CMD_Pong::SharedDtor() {
+  ::google::protobuf::Arena* arena = GetArenaNoVirtual();
+  if (arena != NULL) {
+    return;
+  }
+
 }
 
+void CMD_Pong::ArenaDtor(void* object) {
+  CMD_Pong* _this = reinterpret_cast< CMD_Pong* >(object);
+  (void)_this;
+}
+void CMD_Pong::RegisterArenaDtor(::google::protobuf::Arena* arena) {
+}
 void CMD_Pong::SetCachedSize(int size) const {
   GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
   _cached_size_ = size;
@@ -5174,7 +7279,7 @@ void CMD_Pong::SetCachedSize(int size) const {
 }
 const ::google::protobuf::Descriptor* CMD_Pong::descriptor() {
   protobuf_Commands_2eproto::protobuf_AssignDescriptorsOnce();
-  return protobuf_Commands_2eproto::file_level_metadata[10].descriptor;
+  return protobuf_Commands_2eproto::file_level_metadata[12].descriptor;
 }
 
 const CMD_Pong& CMD_Pong::default_instance() {
@@ -5183,11 +7288,7 @@ const CMD_Pong& CMD_Pong::default_instance() {
 }
 
 CMD_Pong* CMD_Pong::New(::google::protobuf::Arena* arena) const {
-  CMD_Pong* n = new CMD_Pong;
-  if (arena != NULL) {
-    arena->Own(n);
-  }
-  return n;
+  return ::google::protobuf::Arena::CreateMessage<CMD_Pong>(arena);
 }
 
 void CMD_Pong::Clear() {
@@ -5325,6 +7426,21 @@ bool CMD_Pong::IsInitialized() const {
 
 void CMD_Pong::Swap(CMD_Pong* other) {
   if (other == this) return;
+  if (GetArenaNoVirtual() == other->GetArenaNoVirtual()) {
+    InternalSwap(other);
+  } else {
+    CMD_Pong* temp = New(GetArenaNoVirtual());
+    temp->MergeFrom(*other);
+    other->CopyFrom(*this);
+    InternalSwap(temp);
+    if (GetArenaNoVirtual() == NULL) {
+      delete temp;
+    }
+  }
+}
+void CMD_Pong::UnsafeArenaSwap(CMD_Pong* other) {
+  if (other == this) return;
+  GOOGLE_DCHECK(GetArenaNoVirtual() == other->GetArenaNoVirtual());
   InternalSwap(other);
 }
 void CMD_Pong::InternalSwap(CMD_Pong* other) {
@@ -5334,7 +7450,7 @@ void CMD_Pong::InternalSwap(CMD_Pong* other) {
 
 ::google::protobuf::Metadata CMD_Pong::GetMetadata() const {
   protobuf_Commands_2eproto::protobuf_AssignDescriptorsOnce();
-  return protobuf_Commands_2eproto::file_level_metadata[10];
+  return protobuf_Commands_2eproto::file_level_metadata[12];
 }
 
 #if PROTOBUF_INLINE_NOT_IN_HEADERS
@@ -5372,6 +7488,16 @@ CMD_ForwardPacket::CMD_ForwardPacket()
   SharedCtor();
   // @@protoc_insertion_point(constructor:CMD_ForwardPacket)
 }
+CMD_ForwardPacket::CMD_ForwardPacket(::google::protobuf::Arena* arena)
+  : ::google::protobuf::Message(),
+  _internal_metadata_(arena) {
+#ifdef GOOGLE_PROTOBUF_NO_STATIC_INITIALIZER
+  protobuf_Commands_2eproto::InitDefaults();
+#endif  // GOOGLE_PROTOBUF_NO_STATIC_INITIALIZER
+  SharedCtor();
+  RegisterArenaDtor(arena);
+  // @@protoc_insertion_point(arena_constructor:CMD_ForwardPacket)
+}
 CMD_ForwardPacket::CMD_ForwardPacket(const CMD_ForwardPacket& from)
   : ::google::protobuf::Message(),
       _internal_metadata_(NULL),
@@ -5379,7 +7505,8 @@ CMD_ForwardPacket::CMD_ForwardPacket(const CMD_ForwardPacket& from)
   _internal_metadata_.MergeFrom(from._internal_metadata_);
   datas_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
   if (from.datas().size() > 0) {
-    datas_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.datas_);
+    datas_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.datas(),
+      GetArenaNoVirtual());
   }
   ::memcpy(&requestorid_, &from.requestorid_,
     reinterpret_cast<char*>(&msgcmd_) -
@@ -5400,9 +7527,20 @@ CMD_ForwardPacket::~CMD_ForwardPacket() {
 }
 
 void CMD_ForwardPacket::SharedDtor() {
-  datas_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  ::google::protobuf::Arena* arena = GetArenaNoVirtual();
+  if (arena != NULL) {
+    return;
+  }
+
+  datas_.Destroy(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), arena);
 }
 
+void CMD_ForwardPacket::ArenaDtor(void* object) {
+  CMD_ForwardPacket* _this = reinterpret_cast< CMD_ForwardPacket* >(object);
+  (void)_this;
+}
+void CMD_ForwardPacket::RegisterArenaDtor(::google::protobuf::Arena* arena) {
+}
 void CMD_ForwardPacket::SetCachedSize(int size) const {
   GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
   _cached_size_ = size;
@@ -5410,7 +7548,7 @@ void CMD_ForwardPacket::SetCachedSize(int size) const {
 }
 const ::google::protobuf::Descriptor* CMD_ForwardPacket::descriptor() {
   protobuf_Commands_2eproto::protobuf_AssignDescriptorsOnce();
-  return protobuf_Commands_2eproto::file_level_metadata[11].descriptor;
+  return protobuf_Commands_2eproto::file_level_metadata[13].descriptor;
 }
 
 const CMD_ForwardPacket& CMD_ForwardPacket::default_instance() {
@@ -5419,16 +7557,12 @@ const CMD_ForwardPacket& CMD_ForwardPacket::default_instance() {
 }
 
 CMD_ForwardPacket* CMD_ForwardPacket::New(::google::protobuf::Arena* arena) const {
-  CMD_ForwardPacket* n = new CMD_ForwardPacket;
-  if (arena != NULL) {
-    arena->Own(n);
-  }
-  return n;
+  return ::google::protobuf::Arena::CreateMessage<CMD_ForwardPacket>(arena);
 }
 
 void CMD_ForwardPacket::Clear() {
 // @@protoc_insertion_point(message_clear_start:CMD_ForwardPacket)
-  datas_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  datas_.ClearToEmpty(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
   ::memset(&requestorid_, 0, reinterpret_cast<char*>(&msgcmd_) -
     reinterpret_cast<char*>(&requestorid_) + sizeof(msgcmd_));
 }
@@ -5600,8 +7734,7 @@ void CMD_ForwardPacket::MergeFrom(const CMD_ForwardPacket& from) {
   GOOGLE_DCHECK_NE(&from, this);
   _internal_metadata_.MergeFrom(from._internal_metadata_);
   if (from.datas().size() > 0) {
-
-    datas_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.datas_);
+    set_datas(from.datas());
   }
   if (from.requestorid() != 0) {
     set_requestorid(from.requestorid());
@@ -5631,6 +7764,21 @@ bool CMD_ForwardPacket::IsInitialized() const {
 
 void CMD_ForwardPacket::Swap(CMD_ForwardPacket* other) {
   if (other == this) return;
+  if (GetArenaNoVirtual() == other->GetArenaNoVirtual()) {
+    InternalSwap(other);
+  } else {
+    CMD_ForwardPacket* temp = New(GetArenaNoVirtual());
+    temp->MergeFrom(*other);
+    other->CopyFrom(*this);
+    InternalSwap(temp);
+    if (GetArenaNoVirtual() == NULL) {
+      delete temp;
+    }
+  }
+}
+void CMD_ForwardPacket::UnsafeArenaSwap(CMD_ForwardPacket* other) {
+  if (other == this) return;
+  GOOGLE_DCHECK(GetArenaNoVirtual() == other->GetArenaNoVirtual());
   InternalSwap(other);
 }
 void CMD_ForwardPacket::InternalSwap(CMD_ForwardPacket* other) {
@@ -5642,7 +7790,7 @@ void CMD_ForwardPacket::InternalSwap(CMD_ForwardPacket* other) {
 
 ::google::protobuf::Metadata CMD_ForwardPacket::GetMetadata() const {
   protobuf_Commands_2eproto::protobuf_AssignDescriptorsOnce();
-  return protobuf_Commands_2eproto::file_level_metadata[11];
+  return protobuf_Commands_2eproto::file_level_metadata[13];
 }
 
 #if PROTOBUF_INLINE_NOT_IN_HEADERS
@@ -5664,45 +7812,46 @@ void CMD_ForwardPacket::set_requestorid(::google::protobuf::uint64 value) {
 
 // bytes datas = 2;
 void CMD_ForwardPacket::clear_datas() {
-  datas_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  datas_.ClearToEmpty(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 const ::std::string& CMD_ForwardPacket::datas() const {
   // @@protoc_insertion_point(field_get:CMD_ForwardPacket.datas)
-  return datas_.GetNoArena();
+  return datas_.Get();
 }
 void CMD_ForwardPacket::set_datas(const ::std::string& value) {
   
-  datas_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  datas_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value, GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set:CMD_ForwardPacket.datas)
 }
-#if LANG_CXX11
-void CMD_ForwardPacket::set_datas(::std::string&& value) {
-  
-  datas_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:CMD_ForwardPacket.datas)
-}
-#endif
 void CMD_ForwardPacket::set_datas(const char* value) {
   
-  datas_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  datas_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+              GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_char:CMD_ForwardPacket.datas)
 }
-void CMD_ForwardPacket::set_datas(const void* value, size_t size) {
+void CMD_ForwardPacket::set_datas(const void* value,
+    size_t size) {
   
-  datas_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
+  datas_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_pointer:CMD_ForwardPacket.datas)
 }
 ::std::string* CMD_ForwardPacket::mutable_datas() {
   
   // @@protoc_insertion_point(field_mutable:CMD_ForwardPacket.datas)
-  return datas_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return datas_.Mutable(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 ::std::string* CMD_ForwardPacket::release_datas() {
   // @@protoc_insertion_point(field_release:CMD_ForwardPacket.datas)
   
-  return datas_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return datas_.Release(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
+}
+::std::string* CMD_ForwardPacket::unsafe_arena_release_datas() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:CMD_ForwardPacket.datas)
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  
+  return datas_.UnsafeArenaRelease(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      GetArenaNoVirtual());
 }
 void CMD_ForwardPacket::set_allocated_datas(::std::string* datas) {
   if (datas != NULL) {
@@ -5710,9 +7859,22 @@ void CMD_ForwardPacket::set_allocated_datas(::std::string* datas) {
   } else {
     
   }
-  datas_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), datas);
+  datas_.SetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), datas,
+      GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_allocated:CMD_ForwardPacket.datas)
 }
+void CMD_ForwardPacket::unsafe_arena_set_allocated_datas(
+    ::std::string* datas) {
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  if (datas != NULL) {
+    
+  } else {
+    
+  }
+  datas_.UnsafeArenaSetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      datas, GetArenaNoVirtual());
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:CMD_ForwardPacket.datas)
+}
 
 // int32 msgcmd = 3;
 void CMD_ForwardPacket::clear_msgcmd() {
@@ -5743,6 +7905,16 @@ CMD_RemoteDisconnected::CMD_RemoteDisconnected()
   SharedCtor();
   // @@protoc_insertion_point(constructor:CMD_RemoteDisconnected)
 }
+CMD_RemoteDisconnected::CMD_RemoteDisconnected(::google::protobuf::Arena* arena)
+  : ::google::protobuf::Message(),
+  _internal_metadata_(arena) {
+#ifdef GOOGLE_PROTOBUF_NO_STATIC_INITIALIZER
+  protobuf_Commands_2eproto::InitDefaults();
+#endif  // GOOGLE_PROTOBUF_NO_STATIC_INITIALIZER
+  SharedCtor();
+  RegisterArenaDtor(arena);
+  // @@protoc_insertion_point(arena_constructor:CMD_RemoteDisconnected)
+}
 CMD_RemoteDisconnected::CMD_RemoteDisconnected(const CMD_RemoteDisconnected& from)
   : ::google::protobuf::Message(),
       _internal_metadata_(NULL),
@@ -5761,8 +7933,19 @@ CMD_RemoteDisconnected::~CMD_RemoteDisconnected() {
 }
 
 void CMD_RemoteDisconnected::SharedDtor() {
+  ::google::protobuf::Arena* arena = GetArenaNoVirtual();
+  if (arena != NULL) {
+    return;
+  }
+
 }
 
+void CMD_RemoteDisconnected::ArenaDtor(void* object) {
+  CMD_RemoteDisconnected* _this = reinterpret_cast< CMD_RemoteDisconnected* >(object);
+  (void)_this;
+}
+void CMD_RemoteDisconnected::RegisterArenaDtor(::google::protobuf::Arena* arena) {
+}
 void CMD_RemoteDisconnected::SetCachedSize(int size) const {
   GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
   _cached_size_ = size;
@@ -5770,7 +7953,7 @@ void CMD_RemoteDisconnected::SetCachedSize(int size) const {
 }
 const ::google::protobuf::Descriptor* CMD_RemoteDisconnected::descriptor() {
   protobuf_Commands_2eproto::protobuf_AssignDescriptorsOnce();
-  return protobuf_Commands_2eproto::file_level_metadata[12].descriptor;
+  return protobuf_Commands_2eproto::file_level_metadata[14].descriptor;
 }
 
 const CMD_RemoteDisconnected& CMD_RemoteDisconnected::default_instance() {
@@ -5779,11 +7962,7 @@ const CMD_RemoteDisconnected& CMD_RemoteDisconnected::default_instance() {
 }
 
 CMD_RemoteDisconnected* CMD_RemoteDisconnected::New(::google::protobuf::Arena* arena) const {
-  CMD_RemoteDisconnected* n = new CMD_RemoteDisconnected;
-  if (arena != NULL) {
-    arena->Own(n);
-  }
-  return n;
+  return ::google::protobuf::Arena::CreateMessage<CMD_RemoteDisconnected>(arena);
 }
 
 void CMD_RemoteDisconnected::Clear() {
@@ -5882,6 +8061,21 @@ bool CMD_RemoteDisconnected::IsInitialized() const {
 
 void CMD_RemoteDisconnected::Swap(CMD_RemoteDisconnected* other) {
   if (other == this) return;
+  if (GetArenaNoVirtual() == other->GetArenaNoVirtual()) {
+    InternalSwap(other);
+  } else {
+    CMD_RemoteDisconnected* temp = New(GetArenaNoVirtual());
+    temp->MergeFrom(*other);
+    other->CopyFrom(*this);
+    InternalSwap(temp);
+    if (GetArenaNoVirtual() == NULL) {
+      delete temp;
+    }
+  }
+}
+void CMD_RemoteDisconnected::UnsafeArenaSwap(CMD_RemoteDisconnected* other) {
+  if (other == this) return;
+  GOOGLE_DCHECK(GetArenaNoVirtual() == other->GetArenaNoVirtual());
   InternalSwap(other);
 }
 void CMD_RemoteDisconnected::InternalSwap(CMD_RemoteDisconnected* other) {
@@ -5890,7 +8084,7 @@ void CMD_RemoteDisconnected::InternalSwap(CMD_RemoteDisconnected* other) {
 
 ::google::protobuf::Metadata CMD_RemoteDisconnected::GetMetadata() const {
   protobuf_Commands_2eproto::protobuf_AssignDescriptorsOnce();
-  return protobuf_Commands_2eproto::file_level_metadata[12];
+  return protobuf_Commands_2eproto::file_level_metadata[14];
 }
 
 #if PROTOBUF_INLINE_NOT_IN_HEADERS
@@ -5911,6 +8105,16 @@ CMD_Directory_ListServers::CMD_Directory_ListServers()
   SharedCtor();
   // @@protoc_insertion_point(constructor:CMD_Directory_ListServers)
 }
+CMD_Directory_ListServers::CMD_Directory_ListServers(::google::protobuf::Arena* arena)
+  : ::google::protobuf::Message(),
+  _internal_metadata_(arena) {
+#ifdef GOOGLE_PROTOBUF_NO_STATIC_INITIALIZER
+  protobuf_Commands_2eproto::InitDefaults();
+#endif  // GOOGLE_PROTOBUF_NO_STATIC_INITIALIZER
+  SharedCtor();
+  RegisterArenaDtor(arena);
+  // @@protoc_insertion_point(arena_constructor:CMD_Directory_ListServers)
+}
 CMD_Directory_ListServers::CMD_Directory_ListServers(const CMD_Directory_ListServers& from)
   : ::google::protobuf::Message(),
       _internal_metadata_(NULL),
@@ -5929,8 +8133,19 @@ CMD_Directory_ListServers::~CMD_Directory_ListServers() {
 }
 
 void CMD_Directory_ListServers::SharedDtor() {
+  ::google::protobuf::Arena* arena = GetArenaNoVirtual();
+  if (arena != NULL) {
+    return;
+  }
+
 }
 
+void CMD_Directory_ListServers::ArenaDtor(void* object) {
+  CMD_Directory_ListServers* _this = reinterpret_cast< CMD_Directory_ListServers* >(object);
+  (void)_this;
+}
+void CMD_Directory_ListServers::RegisterArenaDtor(::google::protobuf::Arena* arena) {
+}
 void CMD_Directory_ListServers::SetCachedSize(int size) const {
   GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
   _cached_size_ = size;
@@ -5938,7 +8153,7 @@ void CMD_Directory_ListServers::SetCachedSize(int size) const {
 }
 const ::google::protobuf::Descriptor* CMD_Directory_ListServers::descriptor() {
   protobuf_Commands_2eproto::protobuf_AssignDescriptorsOnce();
-  return protobuf_Commands_2eproto::file_level_metadata[13].descriptor;
+  return protobuf_Commands_2eproto::file_level_metadata[15].descriptor;
 }
 
 const CMD_Directory_ListServers& CMD_Directory_ListServers::default_instance() {
@@ -5947,11 +8162,7 @@ const CMD_Directory_ListServers& CMD_Directory_ListServers::default_instance() {
 }
 
 CMD_Directory_ListServers* CMD_Directory_ListServers::New(::google::protobuf::Arena* arena) const {
-  CMD_Directory_ListServers* n = new CMD_Directory_ListServers;
-  if (arena != NULL) {
-    arena->Own(n);
-  }
-  return n;
+  return ::google::protobuf::Arena::CreateMessage<CMD_Directory_ListServers>(arena);
 }
 
 void CMD_Directory_ListServers::Clear() {
@@ -6047,9 +8258,24 @@ void CMD_Directory_ListServers::CopyFrom(const CMD_Directory_ListServers& from)
 bool CMD_Directory_ListServers::IsInitialized() const {
   return true;
 }
-
-void CMD_Directory_ListServers::Swap(CMD_Directory_ListServers* other) {
+
+void CMD_Directory_ListServers::Swap(CMD_Directory_ListServers* other) {
+  if (other == this) return;
+  if (GetArenaNoVirtual() == other->GetArenaNoVirtual()) {
+    InternalSwap(other);
+  } else {
+    CMD_Directory_ListServers* temp = New(GetArenaNoVirtual());
+    temp->MergeFrom(*other);
+    other->CopyFrom(*this);
+    InternalSwap(temp);
+    if (GetArenaNoVirtual() == NULL) {
+      delete temp;
+    }
+  }
+}
+void CMD_Directory_ListServers::UnsafeArenaSwap(CMD_Directory_ListServers* other) {
   if (other == this) return;
+  GOOGLE_DCHECK(GetArenaNoVirtual() == other->GetArenaNoVirtual());
   InternalSwap(other);
 }
 void CMD_Directory_ListServers::InternalSwap(CMD_Directory_ListServers* other) {
@@ -6058,7 +8284,7 @@ void CMD_Directory_ListServers::InternalSwap(CMD_Directory_ListServers* other) {
 
 ::google::protobuf::Metadata CMD_Directory_ListServers::GetMetadata() const {
   protobuf_Commands_2eproto::protobuf_AssignDescriptorsOnce();
-  return protobuf_Commands_2eproto::file_level_metadata[13];
+  return protobuf_Commands_2eproto::file_level_metadata[15];
 }
 
 #if PROTOBUF_INLINE_NOT_IN_HEADERS
@@ -6082,6 +8308,16 @@ CMD_Login_Signup::CMD_Login_Signup()
   SharedCtor();
   // @@protoc_insertion_point(constructor:CMD_Login_Signup)
 }
+CMD_Login_Signup::CMD_Login_Signup(::google::protobuf::Arena* arena)
+  : ::google::protobuf::Message(),
+  _internal_metadata_(arena) {
+#ifdef GOOGLE_PROTOBUF_NO_STATIC_INITIALIZER
+  protobuf_Commands_2eproto::InitDefaults();
+#endif  // GOOGLE_PROTOBUF_NO_STATIC_INITIALIZER
+  SharedCtor();
+  RegisterArenaDtor(arena);
+  // @@protoc_insertion_point(arena_constructor:CMD_Login_Signup)
+}
 CMD_Login_Signup::CMD_Login_Signup(const CMD_Login_Signup& from)
   : ::google::protobuf::Message(),
       _internal_metadata_(NULL),
@@ -6089,15 +8325,18 @@ CMD_Login_Signup::CMD_Login_Signup(const CMD_Login_Signup& from)
   _internal_metadata_.MergeFrom(from._internal_metadata_);
   commitaccountname_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
   if (from.commitaccountname().size() > 0) {
-    commitaccountname_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.commitaccountname_);
+    commitaccountname_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.commitaccountname(),
+      GetArenaNoVirtual());
   }
   password_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
   if (from.password().size() > 0) {
-    password_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.password_);
+    password_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.password(),
+      GetArenaNoVirtual());
   }
   datas_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
   if (from.datas().size() > 0) {
-    datas_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.datas_);
+    datas_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.datas(),
+      GetArenaNoVirtual());
   }
   // @@protoc_insertion_point(copy_constructor:CMD_Login_Signup)
 }
@@ -6115,11 +8354,22 @@ CMD_Login_Signup::~CMD_Login_Signup() {
 }
 
 void CMD_Login_Signup::SharedDtor() {
-  commitaccountname_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  password_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  datas_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  ::google::protobuf::Arena* arena = GetArenaNoVirtual();
+  if (arena != NULL) {
+    return;
+  }
+
+  commitaccountname_.Destroy(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), arena);
+  password_.Destroy(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), arena);
+  datas_.Destroy(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), arena);
 }
 
+void CMD_Login_Signup::ArenaDtor(void* object) {
+  CMD_Login_Signup* _this = reinterpret_cast< CMD_Login_Signup* >(object);
+  (void)_this;
+}
+void CMD_Login_Signup::RegisterArenaDtor(::google::protobuf::Arena* arena) {
+}
 void CMD_Login_Signup::SetCachedSize(int size) const {
   GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
   _cached_size_ = size;
@@ -6127,7 +8377,7 @@ void CMD_Login_Signup::SetCachedSize(int size) const {
 }
 const ::google::protobuf::Descriptor* CMD_Login_Signup::descriptor() {
   protobuf_Commands_2eproto::protobuf_AssignDescriptorsOnce();
-  return protobuf_Commands_2eproto::file_level_metadata[14].descriptor;
+  return protobuf_Commands_2eproto::file_level_metadata[16].descriptor;
 }
 
 const CMD_Login_Signup& CMD_Login_Signup::default_instance() {
@@ -6136,18 +8386,14 @@ const CMD_Login_Signup& CMD_Login_Signup::default_instance() {
 }
 
 CMD_Login_Signup* CMD_Login_Signup::New(::google::protobuf::Arena* arena) const {
-  CMD_Login_Signup* n = new CMD_Login_Signup;
-  if (arena != NULL) {
-    arena->Own(n);
-  }
-  return n;
+  return ::google::protobuf::Arena::CreateMessage<CMD_Login_Signup>(arena);
 }
 
 void CMD_Login_Signup::Clear() {
 // @@protoc_insertion_point(message_clear_start:CMD_Login_Signup)
-  commitaccountname_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  password_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  datas_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  commitaccountname_.ClearToEmpty(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
+  password_.ClearToEmpty(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
+  datas_.ClearToEmpty(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 
 bool CMD_Login_Signup::MergePartialFromCodedStream(
@@ -6343,16 +8589,13 @@ void CMD_Login_Signup::MergeFrom(const CMD_Login_Signup& from) {
   GOOGLE_DCHECK_NE(&from, this);
   _internal_metadata_.MergeFrom(from._internal_metadata_);
   if (from.commitaccountname().size() > 0) {
-
-    commitaccountname_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.commitaccountname_);
+    set_commitaccountname(from.commitaccountname());
   }
   if (from.password().size() > 0) {
-
-    password_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.password_);
+    set_password(from.password());
   }
   if (from.datas().size() > 0) {
-
-    datas_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.datas_);
+    set_datas(from.datas());
   }
 }
 
@@ -6376,6 +8619,21 @@ bool CMD_Login_Signup::IsInitialized() const {
 
 void CMD_Login_Signup::Swap(CMD_Login_Signup* other) {
   if (other == this) return;
+  if (GetArenaNoVirtual() == other->GetArenaNoVirtual()) {
+    InternalSwap(other);
+  } else {
+    CMD_Login_Signup* temp = New(GetArenaNoVirtual());
+    temp->MergeFrom(*other);
+    other->CopyFrom(*this);
+    InternalSwap(temp);
+    if (GetArenaNoVirtual() == NULL) {
+      delete temp;
+    }
+  }
+}
+void CMD_Login_Signup::UnsafeArenaSwap(CMD_Login_Signup* other) {
+  if (other == this) return;
+  GOOGLE_DCHECK(GetArenaNoVirtual() == other->GetArenaNoVirtual());
   InternalSwap(other);
 }
 void CMD_Login_Signup::InternalSwap(CMD_Login_Signup* other) {
@@ -6387,7 +8645,7 @@ void CMD_Login_Signup::InternalSwap(CMD_Login_Signup* other) {
 
 ::google::protobuf::Metadata CMD_Login_Signup::GetMetadata() const {
   protobuf_Commands_2eproto::protobuf_AssignDescriptorsOnce();
-  return protobuf_Commands_2eproto::file_level_metadata[14];
+  return protobuf_Commands_2eproto::file_level_metadata[16];
 }
 
 #if PROTOBUF_INLINE_NOT_IN_HEADERS
@@ -6395,45 +8653,46 @@ void CMD_Login_Signup::InternalSwap(CMD_Login_Signup* other) {
 
 // string commitAccountName = 1;
 void CMD_Login_Signup::clear_commitaccountname() {
-  commitaccountname_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  commitaccountname_.ClearToEmpty(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 const ::std::string& CMD_Login_Signup::commitaccountname() const {
   // @@protoc_insertion_point(field_get:CMD_Login_Signup.commitAccountName)
-  return commitaccountname_.GetNoArena();
+  return commitaccountname_.Get();
 }
 void CMD_Login_Signup::set_commitaccountname(const ::std::string& value) {
   
-  commitaccountname_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  commitaccountname_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value, GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set:CMD_Login_Signup.commitAccountName)
 }
-#if LANG_CXX11
-void CMD_Login_Signup::set_commitaccountname(::std::string&& value) {
-  
-  commitaccountname_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:CMD_Login_Signup.commitAccountName)
-}
-#endif
 void CMD_Login_Signup::set_commitaccountname(const char* value) {
   
-  commitaccountname_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  commitaccountname_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+              GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_char:CMD_Login_Signup.commitAccountName)
 }
-void CMD_Login_Signup::set_commitaccountname(const char* value, size_t size) {
+void CMD_Login_Signup::set_commitaccountname(const char* value,
+    size_t size) {
   
-  commitaccountname_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
+  commitaccountname_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_pointer:CMD_Login_Signup.commitAccountName)
 }
 ::std::string* CMD_Login_Signup::mutable_commitaccountname() {
   
   // @@protoc_insertion_point(field_mutable:CMD_Login_Signup.commitAccountName)
-  return commitaccountname_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return commitaccountname_.Mutable(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 ::std::string* CMD_Login_Signup::release_commitaccountname() {
   // @@protoc_insertion_point(field_release:CMD_Login_Signup.commitAccountName)
   
-  return commitaccountname_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return commitaccountname_.Release(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
+}
+::std::string* CMD_Login_Signup::unsafe_arena_release_commitaccountname() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:CMD_Login_Signup.commitAccountName)
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  
+  return commitaccountname_.UnsafeArenaRelease(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      GetArenaNoVirtual());
 }
 void CMD_Login_Signup::set_allocated_commitaccountname(::std::string* commitaccountname) {
   if (commitaccountname != NULL) {
@@ -6441,51 +8700,65 @@ void CMD_Login_Signup::set_allocated_commitaccountname(::std::string* commitacco
   } else {
     
   }
-  commitaccountname_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), commitaccountname);
+  commitaccountname_.SetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), commitaccountname,
+      GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_allocated:CMD_Login_Signup.commitAccountName)
 }
+void CMD_Login_Signup::unsafe_arena_set_allocated_commitaccountname(
+    ::std::string* commitaccountname) {
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  if (commitaccountname != NULL) {
+    
+  } else {
+    
+  }
+  commitaccountname_.UnsafeArenaSetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      commitaccountname, GetArenaNoVirtual());
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:CMD_Login_Signup.commitAccountName)
+}
 
 // string password = 2;
 void CMD_Login_Signup::clear_password() {
-  password_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  password_.ClearToEmpty(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 const ::std::string& CMD_Login_Signup::password() const {
   // @@protoc_insertion_point(field_get:CMD_Login_Signup.password)
-  return password_.GetNoArena();
+  return password_.Get();
 }
 void CMD_Login_Signup::set_password(const ::std::string& value) {
   
-  password_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  password_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value, GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set:CMD_Login_Signup.password)
 }
-#if LANG_CXX11
-void CMD_Login_Signup::set_password(::std::string&& value) {
-  
-  password_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:CMD_Login_Signup.password)
-}
-#endif
 void CMD_Login_Signup::set_password(const char* value) {
   
-  password_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  password_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+              GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_char:CMD_Login_Signup.password)
 }
-void CMD_Login_Signup::set_password(const char* value, size_t size) {
+void CMD_Login_Signup::set_password(const char* value,
+    size_t size) {
   
-  password_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
+  password_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_pointer:CMD_Login_Signup.password)
 }
 ::std::string* CMD_Login_Signup::mutable_password() {
   
   // @@protoc_insertion_point(field_mutable:CMD_Login_Signup.password)
-  return password_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return password_.Mutable(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 ::std::string* CMD_Login_Signup::release_password() {
   // @@protoc_insertion_point(field_release:CMD_Login_Signup.password)
   
-  return password_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return password_.Release(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
+}
+::std::string* CMD_Login_Signup::unsafe_arena_release_password() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:CMD_Login_Signup.password)
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  
+  return password_.UnsafeArenaRelease(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      GetArenaNoVirtual());
 }
 void CMD_Login_Signup::set_allocated_password(::std::string* password) {
   if (password != NULL) {
@@ -6493,51 +8766,65 @@ void CMD_Login_Signup::set_allocated_password(::std::string* password) {
   } else {
     
   }
-  password_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), password);
+  password_.SetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), password,
+      GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_allocated:CMD_Login_Signup.password)
 }
+void CMD_Login_Signup::unsafe_arena_set_allocated_password(
+    ::std::string* password) {
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  if (password != NULL) {
+    
+  } else {
+    
+  }
+  password_.UnsafeArenaSetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      password, GetArenaNoVirtual());
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:CMD_Login_Signup.password)
+}
 
 // bytes datas = 3;
 void CMD_Login_Signup::clear_datas() {
-  datas_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  datas_.ClearToEmpty(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 const ::std::string& CMD_Login_Signup::datas() const {
   // @@protoc_insertion_point(field_get:CMD_Login_Signup.datas)
-  return datas_.GetNoArena();
+  return datas_.Get();
 }
 void CMD_Login_Signup::set_datas(const ::std::string& value) {
   
-  datas_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  datas_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value, GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set:CMD_Login_Signup.datas)
 }
-#if LANG_CXX11
-void CMD_Login_Signup::set_datas(::std::string&& value) {
-  
-  datas_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:CMD_Login_Signup.datas)
-}
-#endif
 void CMD_Login_Signup::set_datas(const char* value) {
   
-  datas_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  datas_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+              GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_char:CMD_Login_Signup.datas)
 }
-void CMD_Login_Signup::set_datas(const void* value, size_t size) {
+void CMD_Login_Signup::set_datas(const void* value,
+    size_t size) {
   
-  datas_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
+  datas_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_pointer:CMD_Login_Signup.datas)
 }
 ::std::string* CMD_Login_Signup::mutable_datas() {
   
   // @@protoc_insertion_point(field_mutable:CMD_Login_Signup.datas)
-  return datas_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return datas_.Mutable(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 ::std::string* CMD_Login_Signup::release_datas() {
   // @@protoc_insertion_point(field_release:CMD_Login_Signup.datas)
   
-  return datas_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return datas_.Release(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
+}
+::std::string* CMD_Login_Signup::unsafe_arena_release_datas() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:CMD_Login_Signup.datas)
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  
+  return datas_.UnsafeArenaRelease(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      GetArenaNoVirtual());
 }
 void CMD_Login_Signup::set_allocated_datas(::std::string* datas) {
   if (datas != NULL) {
@@ -6545,9 +8832,22 @@ void CMD_Login_Signup::set_allocated_datas(::std::string* datas) {
   } else {
     
   }
-  datas_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), datas);
+  datas_.SetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), datas,
+      GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_allocated:CMD_Login_Signup.datas)
 }
+void CMD_Login_Signup::unsafe_arena_set_allocated_datas(
+    ::std::string* datas) {
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  if (datas != NULL) {
+    
+  } else {
+    
+  }
+  datas_.UnsafeArenaSetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      datas, GetArenaNoVirtual());
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:CMD_Login_Signup.datas)
+}
 
 #endif  // PROTOBUF_INLINE_NOT_IN_HEADERS
 
@@ -6568,6 +8868,16 @@ CMD_Login_OnSignupCB::CMD_Login_OnSignupCB()
   SharedCtor();
   // @@protoc_insertion_point(constructor:CMD_Login_OnSignupCB)
 }
+CMD_Login_OnSignupCB::CMD_Login_OnSignupCB(::google::protobuf::Arena* arena)
+  : ::google::protobuf::Message(),
+  _internal_metadata_(arena) {
+#ifdef GOOGLE_PROTOBUF_NO_STATIC_INITIALIZER
+  protobuf_Commands_2eproto::InitDefaults();
+#endif  // GOOGLE_PROTOBUF_NO_STATIC_INITIALIZER
+  SharedCtor();
+  RegisterArenaDtor(arena);
+  // @@protoc_insertion_point(arena_constructor:CMD_Login_OnSignupCB)
+}
 CMD_Login_OnSignupCB::CMD_Login_OnSignupCB(const CMD_Login_OnSignupCB& from)
   : ::google::protobuf::Message(),
       _internal_metadata_(NULL),
@@ -6575,15 +8885,18 @@ CMD_Login_OnSignupCB::CMD_Login_OnSignupCB(const CMD_Login_OnSignupCB& from)
   _internal_metadata_.MergeFrom(from._internal_metadata_);
   commitaccountname_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
   if (from.commitaccountname().size() > 0) {
-    commitaccountname_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.commitaccountname_);
+    commitaccountname_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.commitaccountname(),
+      GetArenaNoVirtual());
   }
   realaccountname_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
   if (from.realaccountname().size() > 0) {
-    realaccountname_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.realaccountname_);
+    realaccountname_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.realaccountname(),
+      GetArenaNoVirtual());
   }
   datas_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
   if (from.datas().size() > 0) {
-    datas_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.datas_);
+    datas_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.datas(),
+      GetArenaNoVirtual());
   }
   errcode_ = from.errcode_;
   // @@protoc_insertion_point(copy_constructor:CMD_Login_OnSignupCB)
@@ -6603,11 +8916,22 @@ CMD_Login_OnSignupCB::~CMD_Login_OnSignupCB() {
 }
 
 void CMD_Login_OnSignupCB::SharedDtor() {
-  commitaccountname_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  realaccountname_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  datas_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  ::google::protobuf::Arena* arena = GetArenaNoVirtual();
+  if (arena != NULL) {
+    return;
+  }
+
+  commitaccountname_.Destroy(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), arena);
+  realaccountname_.Destroy(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), arena);
+  datas_.Destroy(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), arena);
 }
 
+void CMD_Login_OnSignupCB::ArenaDtor(void* object) {
+  CMD_Login_OnSignupCB* _this = reinterpret_cast< CMD_Login_OnSignupCB* >(object);
+  (void)_this;
+}
+void CMD_Login_OnSignupCB::RegisterArenaDtor(::google::protobuf::Arena* arena) {
+}
 void CMD_Login_OnSignupCB::SetCachedSize(int size) const {
   GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
   _cached_size_ = size;
@@ -6615,7 +8939,7 @@ void CMD_Login_OnSignupCB::SetCachedSize(int size) const {
 }
 const ::google::protobuf::Descriptor* CMD_Login_OnSignupCB::descriptor() {
   protobuf_Commands_2eproto::protobuf_AssignDescriptorsOnce();
-  return protobuf_Commands_2eproto::file_level_metadata[15].descriptor;
+  return protobuf_Commands_2eproto::file_level_metadata[17].descriptor;
 }
 
 const CMD_Login_OnSignupCB& CMD_Login_OnSignupCB::default_instance() {
@@ -6624,18 +8948,14 @@ const CMD_Login_OnSignupCB& CMD_Login_OnSignupCB::default_instance() {
 }
 
 CMD_Login_OnSignupCB* CMD_Login_OnSignupCB::New(::google::protobuf::Arena* arena) const {
-  CMD_Login_OnSignupCB* n = new CMD_Login_OnSignupCB;
-  if (arena != NULL) {
-    arena->Own(n);
-  }
-  return n;
+  return ::google::protobuf::Arena::CreateMessage<CMD_Login_OnSignupCB>(arena);
 }
 
 void CMD_Login_OnSignupCB::Clear() {
 // @@protoc_insertion_point(message_clear_start:CMD_Login_OnSignupCB)
-  commitaccountname_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  realaccountname_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  datas_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  commitaccountname_.ClearToEmpty(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
+  realaccountname_.ClearToEmpty(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
+  datas_.ClearToEmpty(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
   errcode_ = 0;
 }
 
@@ -6864,16 +9184,13 @@ void CMD_Login_OnSignupCB::MergeFrom(const CMD_Login_OnSignupCB& from) {
   GOOGLE_DCHECK_NE(&from, this);
   _internal_metadata_.MergeFrom(from._internal_metadata_);
   if (from.commitaccountname().size() > 0) {
-
-    commitaccountname_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.commitaccountname_);
+    set_commitaccountname(from.commitaccountname());
   }
   if (from.realaccountname().size() > 0) {
-
-    realaccountname_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.realaccountname_);
+    set_realaccountname(from.realaccountname());
   }
   if (from.datas().size() > 0) {
-
-    datas_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.datas_);
+    set_datas(from.datas());
   }
   if (from.errcode() != 0) {
     set_errcode(from.errcode());
@@ -6900,6 +9217,21 @@ bool CMD_Login_OnSignupCB::IsInitialized() const {
 
 void CMD_Login_OnSignupCB::Swap(CMD_Login_OnSignupCB* other) {
   if (other == this) return;
+  if (GetArenaNoVirtual() == other->GetArenaNoVirtual()) {
+    InternalSwap(other);
+  } else {
+    CMD_Login_OnSignupCB* temp = New(GetArenaNoVirtual());
+    temp->MergeFrom(*other);
+    other->CopyFrom(*this);
+    InternalSwap(temp);
+    if (GetArenaNoVirtual() == NULL) {
+      delete temp;
+    }
+  }
+}
+void CMD_Login_OnSignupCB::UnsafeArenaSwap(CMD_Login_OnSignupCB* other) {
+  if (other == this) return;
+  GOOGLE_DCHECK(GetArenaNoVirtual() == other->GetArenaNoVirtual());
   InternalSwap(other);
 }
 void CMD_Login_OnSignupCB::InternalSwap(CMD_Login_OnSignupCB* other) {
@@ -6912,7 +9244,7 @@ void CMD_Login_OnSignupCB::InternalSwap(CMD_Login_OnSignupCB* other) {
 
 ::google::protobuf::Metadata CMD_Login_OnSignupCB::GetMetadata() const {
   protobuf_Commands_2eproto::protobuf_AssignDescriptorsOnce();
-  return protobuf_Commands_2eproto::file_level_metadata[15];
+  return protobuf_Commands_2eproto::file_level_metadata[17];
 }
 
 #if PROTOBUF_INLINE_NOT_IN_HEADERS
@@ -6934,45 +9266,46 @@ void CMD_Login_OnSignupCB::set_errcode(::ServerError value) {
 
 // string commitAccountName = 2;
 void CMD_Login_OnSignupCB::clear_commitaccountname() {
-  commitaccountname_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  commitaccountname_.ClearToEmpty(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 const ::std::string& CMD_Login_OnSignupCB::commitaccountname() const {
   // @@protoc_insertion_point(field_get:CMD_Login_OnSignupCB.commitAccountName)
-  return commitaccountname_.GetNoArena();
+  return commitaccountname_.Get();
 }
 void CMD_Login_OnSignupCB::set_commitaccountname(const ::std::string& value) {
   
-  commitaccountname_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  commitaccountname_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value, GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set:CMD_Login_OnSignupCB.commitAccountName)
 }
-#if LANG_CXX11
-void CMD_Login_OnSignupCB::set_commitaccountname(::std::string&& value) {
-  
-  commitaccountname_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:CMD_Login_OnSignupCB.commitAccountName)
-}
-#endif
 void CMD_Login_OnSignupCB::set_commitaccountname(const char* value) {
   
-  commitaccountname_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  commitaccountname_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+              GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_char:CMD_Login_OnSignupCB.commitAccountName)
 }
-void CMD_Login_OnSignupCB::set_commitaccountname(const char* value, size_t size) {
+void CMD_Login_OnSignupCB::set_commitaccountname(const char* value,
+    size_t size) {
   
-  commitaccountname_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
+  commitaccountname_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_pointer:CMD_Login_OnSignupCB.commitAccountName)
 }
 ::std::string* CMD_Login_OnSignupCB::mutable_commitaccountname() {
   
   // @@protoc_insertion_point(field_mutable:CMD_Login_OnSignupCB.commitAccountName)
-  return commitaccountname_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return commitaccountname_.Mutable(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 ::std::string* CMD_Login_OnSignupCB::release_commitaccountname() {
   // @@protoc_insertion_point(field_release:CMD_Login_OnSignupCB.commitAccountName)
   
-  return commitaccountname_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return commitaccountname_.Release(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
+}
+::std::string* CMD_Login_OnSignupCB::unsafe_arena_release_commitaccountname() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:CMD_Login_OnSignupCB.commitAccountName)
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  
+  return commitaccountname_.UnsafeArenaRelease(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      GetArenaNoVirtual());
 }
 void CMD_Login_OnSignupCB::set_allocated_commitaccountname(::std::string* commitaccountname) {
   if (commitaccountname != NULL) {
@@ -6980,51 +9313,65 @@ void CMD_Login_OnSignupCB::set_allocated_commitaccountname(::std::string* commit
   } else {
     
   }
-  commitaccountname_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), commitaccountname);
+  commitaccountname_.SetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), commitaccountname,
+      GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_allocated:CMD_Login_OnSignupCB.commitAccountName)
 }
+void CMD_Login_OnSignupCB::unsafe_arena_set_allocated_commitaccountname(
+    ::std::string* commitaccountname) {
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  if (commitaccountname != NULL) {
+    
+  } else {
+    
+  }
+  commitaccountname_.UnsafeArenaSetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      commitaccountname, GetArenaNoVirtual());
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:CMD_Login_OnSignupCB.commitAccountName)
+}
 
 // string realAccountName = 3;
 void CMD_Login_OnSignupCB::clear_realaccountname() {
-  realaccountname_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  realaccountname_.ClearToEmpty(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 const ::std::string& CMD_Login_OnSignupCB::realaccountname() const {
   // @@protoc_insertion_point(field_get:CMD_Login_OnSignupCB.realAccountName)
-  return realaccountname_.GetNoArena();
+  return realaccountname_.Get();
 }
 void CMD_Login_OnSignupCB::set_realaccountname(const ::std::string& value) {
   
-  realaccountname_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  realaccountname_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value, GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set:CMD_Login_OnSignupCB.realAccountName)
 }
-#if LANG_CXX11
-void CMD_Login_OnSignupCB::set_realaccountname(::std::string&& value) {
-  
-  realaccountname_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:CMD_Login_OnSignupCB.realAccountName)
-}
-#endif
 void CMD_Login_OnSignupCB::set_realaccountname(const char* value) {
   
-  realaccountname_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  realaccountname_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+              GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_char:CMD_Login_OnSignupCB.realAccountName)
 }
-void CMD_Login_OnSignupCB::set_realaccountname(const char* value, size_t size) {
+void CMD_Login_OnSignupCB::set_realaccountname(const char* value,
+    size_t size) {
   
-  realaccountname_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
+  realaccountname_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_pointer:CMD_Login_OnSignupCB.realAccountName)
 }
 ::std::string* CMD_Login_OnSignupCB::mutable_realaccountname() {
   
   // @@protoc_insertion_point(field_mutable:CMD_Login_OnSignupCB.realAccountName)
-  return realaccountname_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return realaccountname_.Mutable(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 ::std::string* CMD_Login_OnSignupCB::release_realaccountname() {
   // @@protoc_insertion_point(field_release:CMD_Login_OnSignupCB.realAccountName)
   
-  return realaccountname_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return realaccountname_.Release(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
+}
+::std::string* CMD_Login_OnSignupCB::unsafe_arena_release_realaccountname() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:CMD_Login_OnSignupCB.realAccountName)
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  
+  return realaccountname_.UnsafeArenaRelease(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      GetArenaNoVirtual());
 }
 void CMD_Login_OnSignupCB::set_allocated_realaccountname(::std::string* realaccountname) {
   if (realaccountname != NULL) {
@@ -7032,51 +9379,65 @@ void CMD_Login_OnSignupCB::set_allocated_realaccountname(::std::string* realacco
   } else {
     
   }
-  realaccountname_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), realaccountname);
+  realaccountname_.SetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), realaccountname,
+      GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_allocated:CMD_Login_OnSignupCB.realAccountName)
 }
+void CMD_Login_OnSignupCB::unsafe_arena_set_allocated_realaccountname(
+    ::std::string* realaccountname) {
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  if (realaccountname != NULL) {
+    
+  } else {
+    
+  }
+  realaccountname_.UnsafeArenaSetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      realaccountname, GetArenaNoVirtual());
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:CMD_Login_OnSignupCB.realAccountName)
+}
 
 // bytes datas = 4;
 void CMD_Login_OnSignupCB::clear_datas() {
-  datas_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  datas_.ClearToEmpty(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 const ::std::string& CMD_Login_OnSignupCB::datas() const {
   // @@protoc_insertion_point(field_get:CMD_Login_OnSignupCB.datas)
-  return datas_.GetNoArena();
+  return datas_.Get();
 }
 void CMD_Login_OnSignupCB::set_datas(const ::std::string& value) {
   
-  datas_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  datas_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value, GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set:CMD_Login_OnSignupCB.datas)
 }
-#if LANG_CXX11
-void CMD_Login_OnSignupCB::set_datas(::std::string&& value) {
-  
-  datas_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:CMD_Login_OnSignupCB.datas)
-}
-#endif
 void CMD_Login_OnSignupCB::set_datas(const char* value) {
   
-  datas_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  datas_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+              GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_char:CMD_Login_OnSignupCB.datas)
 }
-void CMD_Login_OnSignupCB::set_datas(const void* value, size_t size) {
+void CMD_Login_OnSignupCB::set_datas(const void* value,
+    size_t size) {
   
-  datas_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
+  datas_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_pointer:CMD_Login_OnSignupCB.datas)
 }
 ::std::string* CMD_Login_OnSignupCB::mutable_datas() {
   
   // @@protoc_insertion_point(field_mutable:CMD_Login_OnSignupCB.datas)
-  return datas_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return datas_.Mutable(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 ::std::string* CMD_Login_OnSignupCB::release_datas() {
   // @@protoc_insertion_point(field_release:CMD_Login_OnSignupCB.datas)
   
-  return datas_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return datas_.Release(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
+}
+::std::string* CMD_Login_OnSignupCB::unsafe_arena_release_datas() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:CMD_Login_OnSignupCB.datas)
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  
+  return datas_.UnsafeArenaRelease(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      GetArenaNoVirtual());
 }
 void CMD_Login_OnSignupCB::set_allocated_datas(::std::string* datas) {
   if (datas != NULL) {
@@ -7084,9 +9445,22 @@ void CMD_Login_OnSignupCB::set_allocated_datas(::std::string* datas) {
   } else {
     
   }
-  datas_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), datas);
+  datas_.SetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), datas,
+      GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_allocated:CMD_Login_OnSignupCB.datas)
 }
+void CMD_Login_OnSignupCB::unsafe_arena_set_allocated_datas(
+    ::std::string* datas) {
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  if (datas != NULL) {
+    
+  } else {
+    
+  }
+  datas_.UnsafeArenaSetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      datas, GetArenaNoVirtual());
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:CMD_Login_OnSignupCB.datas)
+}
 
 #endif  // PROTOBUF_INLINE_NOT_IN_HEADERS
 
@@ -7106,6 +9480,16 @@ CMD_Login_Signin::CMD_Login_Signin()
   SharedCtor();
   // @@protoc_insertion_point(constructor:CMD_Login_Signin)
 }
+CMD_Login_Signin::CMD_Login_Signin(::google::protobuf::Arena* arena)
+  : ::google::protobuf::Message(),
+  _internal_metadata_(arena) {
+#ifdef GOOGLE_PROTOBUF_NO_STATIC_INITIALIZER
+  protobuf_Commands_2eproto::InitDefaults();
+#endif  // GOOGLE_PROTOBUF_NO_STATIC_INITIALIZER
+  SharedCtor();
+  RegisterArenaDtor(arena);
+  // @@protoc_insertion_point(arena_constructor:CMD_Login_Signin)
+}
 CMD_Login_Signin::CMD_Login_Signin(const CMD_Login_Signin& from)
   : ::google::protobuf::Message(),
       _internal_metadata_(NULL),
@@ -7113,15 +9497,18 @@ CMD_Login_Signin::CMD_Login_Signin(const CMD_Login_Signin& from)
   _internal_metadata_.MergeFrom(from._internal_metadata_);
   commitaccountname_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
   if (from.commitaccountname().size() > 0) {
-    commitaccountname_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.commitaccountname_);
+    commitaccountname_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.commitaccountname(),
+      GetArenaNoVirtual());
   }
   password_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
   if (from.password().size() > 0) {
-    password_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.password_);
+    password_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.password(),
+      GetArenaNoVirtual());
   }
   datas_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
   if (from.datas().size() > 0) {
-    datas_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.datas_);
+    datas_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.datas(),
+      GetArenaNoVirtual());
   }
   // @@protoc_insertion_point(copy_constructor:CMD_Login_Signin)
 }
@@ -7139,11 +9526,22 @@ CMD_Login_Signin::~CMD_Login_Signin() {
 }
 
 void CMD_Login_Signin::SharedDtor() {
-  commitaccountname_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  password_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  datas_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  ::google::protobuf::Arena* arena = GetArenaNoVirtual();
+  if (arena != NULL) {
+    return;
+  }
+
+  commitaccountname_.Destroy(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), arena);
+  password_.Destroy(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), arena);
+  datas_.Destroy(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), arena);
 }
 
+void CMD_Login_Signin::ArenaDtor(void* object) {
+  CMD_Login_Signin* _this = reinterpret_cast< CMD_Login_Signin* >(object);
+  (void)_this;
+}
+void CMD_Login_Signin::RegisterArenaDtor(::google::protobuf::Arena* arena) {
+}
 void CMD_Login_Signin::SetCachedSize(int size) const {
   GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
   _cached_size_ = size;
@@ -7151,7 +9549,7 @@ void CMD_Login_Signin::SetCachedSize(int size) const {
 }
 const ::google::protobuf::Descriptor* CMD_Login_Signin::descriptor() {
   protobuf_Commands_2eproto::protobuf_AssignDescriptorsOnce();
-  return protobuf_Commands_2eproto::file_level_metadata[16].descriptor;
+  return protobuf_Commands_2eproto::file_level_metadata[18].descriptor;
 }
 
 const CMD_Login_Signin& CMD_Login_Signin::default_instance() {
@@ -7160,18 +9558,14 @@ const CMD_Login_Signin& CMD_Login_Signin::default_instance() {
 }
 
 CMD_Login_Signin* CMD_Login_Signin::New(::google::protobuf::Arena* arena) const {
-  CMD_Login_Signin* n = new CMD_Login_Signin;
-  if (arena != NULL) {
-    arena->Own(n);
-  }
-  return n;
+  return ::google::protobuf::Arena::CreateMessage<CMD_Login_Signin>(arena);
 }
 
 void CMD_Login_Signin::Clear() {
 // @@protoc_insertion_point(message_clear_start:CMD_Login_Signin)
-  commitaccountname_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  password_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  datas_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  commitaccountname_.ClearToEmpty(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
+  password_.ClearToEmpty(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
+  datas_.ClearToEmpty(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 
 bool CMD_Login_Signin::MergePartialFromCodedStream(
@@ -7367,16 +9761,13 @@ void CMD_Login_Signin::MergeFrom(const CMD_Login_Signin& from) {
   GOOGLE_DCHECK_NE(&from, this);
   _internal_metadata_.MergeFrom(from._internal_metadata_);
   if (from.commitaccountname().size() > 0) {
-
-    commitaccountname_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.commitaccountname_);
+    set_commitaccountname(from.commitaccountname());
   }
   if (from.password().size() > 0) {
-
-    password_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.password_);
+    set_password(from.password());
   }
   if (from.datas().size() > 0) {
-
-    datas_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.datas_);
+    set_datas(from.datas());
   }
 }
 
@@ -7400,6 +9791,21 @@ bool CMD_Login_Signin::IsInitialized() const {
 
 void CMD_Login_Signin::Swap(CMD_Login_Signin* other) {
   if (other == this) return;
+  if (GetArenaNoVirtual() == other->GetArenaNoVirtual()) {
+    InternalSwap(other);
+  } else {
+    CMD_Login_Signin* temp = New(GetArenaNoVirtual());
+    temp->MergeFrom(*other);
+    other->CopyFrom(*this);
+    InternalSwap(temp);
+    if (GetArenaNoVirtual() == NULL) {
+      delete temp;
+    }
+  }
+}
+void CMD_Login_Signin::UnsafeArenaSwap(CMD_Login_Signin* other) {
+  if (other == this) return;
+  GOOGLE_DCHECK(GetArenaNoVirtual() == other->GetArenaNoVirtual());
   InternalSwap(other);
 }
 void CMD_Login_Signin::InternalSwap(CMD_Login_Signin* other) {
@@ -7411,7 +9817,7 @@ void CMD_Login_Signin::InternalSwap(CMD_Login_Signin* other) {
 
 ::google::protobuf::Metadata CMD_Login_Signin::GetMetadata() const {
   protobuf_Commands_2eproto::protobuf_AssignDescriptorsOnce();
-  return protobuf_Commands_2eproto::file_level_metadata[16];
+  return protobuf_Commands_2eproto::file_level_metadata[18];
 }
 
 #if PROTOBUF_INLINE_NOT_IN_HEADERS
@@ -7419,45 +9825,46 @@ void CMD_Login_Signin::InternalSwap(CMD_Login_Signin* other) {
 
 // string commitAccountName = 1;
 void CMD_Login_Signin::clear_commitaccountname() {
-  commitaccountname_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  commitaccountname_.ClearToEmpty(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 const ::std::string& CMD_Login_Signin::commitaccountname() const {
   // @@protoc_insertion_point(field_get:CMD_Login_Signin.commitAccountName)
-  return commitaccountname_.GetNoArena();
+  return commitaccountname_.Get();
 }
 void CMD_Login_Signin::set_commitaccountname(const ::std::string& value) {
   
-  commitaccountname_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  commitaccountname_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value, GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set:CMD_Login_Signin.commitAccountName)
 }
-#if LANG_CXX11
-void CMD_Login_Signin::set_commitaccountname(::std::string&& value) {
-  
-  commitaccountname_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:CMD_Login_Signin.commitAccountName)
-}
-#endif
 void CMD_Login_Signin::set_commitaccountname(const char* value) {
   
-  commitaccountname_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  commitaccountname_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+              GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_char:CMD_Login_Signin.commitAccountName)
 }
-void CMD_Login_Signin::set_commitaccountname(const char* value, size_t size) {
+void CMD_Login_Signin::set_commitaccountname(const char* value,
+    size_t size) {
   
-  commitaccountname_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
+  commitaccountname_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_pointer:CMD_Login_Signin.commitAccountName)
 }
 ::std::string* CMD_Login_Signin::mutable_commitaccountname() {
   
   // @@protoc_insertion_point(field_mutable:CMD_Login_Signin.commitAccountName)
-  return commitaccountname_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return commitaccountname_.Mutable(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 ::std::string* CMD_Login_Signin::release_commitaccountname() {
   // @@protoc_insertion_point(field_release:CMD_Login_Signin.commitAccountName)
   
-  return commitaccountname_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return commitaccountname_.Release(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
+}
+::std::string* CMD_Login_Signin::unsafe_arena_release_commitaccountname() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:CMD_Login_Signin.commitAccountName)
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  
+  return commitaccountname_.UnsafeArenaRelease(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      GetArenaNoVirtual());
 }
 void CMD_Login_Signin::set_allocated_commitaccountname(::std::string* commitaccountname) {
   if (commitaccountname != NULL) {
@@ -7465,51 +9872,65 @@ void CMD_Login_Signin::set_allocated_commitaccountname(::std::string* commitacco
   } else {
     
   }
-  commitaccountname_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), commitaccountname);
+  commitaccountname_.SetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), commitaccountname,
+      GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_allocated:CMD_Login_Signin.commitAccountName)
 }
+void CMD_Login_Signin::unsafe_arena_set_allocated_commitaccountname(
+    ::std::string* commitaccountname) {
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  if (commitaccountname != NULL) {
+    
+  } else {
+    
+  }
+  commitaccountname_.UnsafeArenaSetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      commitaccountname, GetArenaNoVirtual());
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:CMD_Login_Signin.commitAccountName)
+}
 
 // string password = 2;
 void CMD_Login_Signin::clear_password() {
-  password_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  password_.ClearToEmpty(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 const ::std::string& CMD_Login_Signin::password() const {
   // @@protoc_insertion_point(field_get:CMD_Login_Signin.password)
-  return password_.GetNoArena();
+  return password_.Get();
 }
 void CMD_Login_Signin::set_password(const ::std::string& value) {
   
-  password_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  password_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value, GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set:CMD_Login_Signin.password)
 }
-#if LANG_CXX11
-void CMD_Login_Signin::set_password(::std::string&& value) {
-  
-  password_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:CMD_Login_Signin.password)
-}
-#endif
 void CMD_Login_Signin::set_password(const char* value) {
   
-  password_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  password_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+              GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_char:CMD_Login_Signin.password)
 }
-void CMD_Login_Signin::set_password(const char* value, size_t size) {
+void CMD_Login_Signin::set_password(const char* value,
+    size_t size) {
   
-  password_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
+  password_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_pointer:CMD_Login_Signin.password)
 }
 ::std::string* CMD_Login_Signin::mutable_password() {
   
   // @@protoc_insertion_point(field_mutable:CMD_Login_Signin.password)
-  return password_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return password_.Mutable(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 ::std::string* CMD_Login_Signin::release_password() {
   // @@protoc_insertion_point(field_release:CMD_Login_Signin.password)
   
-  return password_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return password_.Release(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
+}
+::std::string* CMD_Login_Signin::unsafe_arena_release_password() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:CMD_Login_Signin.password)
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  
+  return password_.UnsafeArenaRelease(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      GetArenaNoVirtual());
 }
 void CMD_Login_Signin::set_allocated_password(::std::string* password) {
   if (password != NULL) {
@@ -7517,51 +9938,65 @@ void CMD_Login_Signin::set_allocated_password(::std::string* password) {
   } else {
     
   }
-  password_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), password);
+  password_.SetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), password,
+      GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_allocated:CMD_Login_Signin.password)
 }
+void CMD_Login_Signin::unsafe_arena_set_allocated_password(
+    ::std::string* password) {
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  if (password != NULL) {
+    
+  } else {
+    
+  }
+  password_.UnsafeArenaSetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      password, GetArenaNoVirtual());
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:CMD_Login_Signin.password)
+}
 
 // bytes datas = 3;
 void CMD_Login_Signin::clear_datas() {
-  datas_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  datas_.ClearToEmpty(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 const ::std::string& CMD_Login_Signin::datas() const {
   // @@protoc_insertion_point(field_get:CMD_Login_Signin.datas)
-  return datas_.GetNoArena();
+  return datas_.Get();
 }
 void CMD_Login_Signin::set_datas(const ::std::string& value) {
   
-  datas_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  datas_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value, GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set:CMD_Login_Signin.datas)
 }
-#if LANG_CXX11
-void CMD_Login_Signin::set_datas(::std::string&& value) {
-  
-  datas_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:CMD_Login_Signin.datas)
-}
-#endif
 void CMD_Login_Signin::set_datas(const char* value) {
   
-  datas_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  datas_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+              GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_char:CMD_Login_Signin.datas)
 }
-void CMD_Login_Signin::set_datas(const void* value, size_t size) {
+void CMD_Login_Signin::set_datas(const void* value,
+    size_t size) {
   
-  datas_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
+  datas_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_pointer:CMD_Login_Signin.datas)
 }
 ::std::string* CMD_Login_Signin::mutable_datas() {
   
   // @@protoc_insertion_point(field_mutable:CMD_Login_Signin.datas)
-  return datas_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return datas_.Mutable(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 ::std::string* CMD_Login_Signin::release_datas() {
   // @@protoc_insertion_point(field_release:CMD_Login_Signin.datas)
   
-  return datas_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return datas_.Release(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
+}
+::std::string* CMD_Login_Signin::unsafe_arena_release_datas() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:CMD_Login_Signin.datas)
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  
+  return datas_.UnsafeArenaRelease(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      GetArenaNoVirtual());
 }
 void CMD_Login_Signin::set_allocated_datas(::std::string* datas) {
   if (datas != NULL) {
@@ -7569,9 +10004,22 @@ void CMD_Login_Signin::set_allocated_datas(::std::string* datas) {
   } else {
     
   }
-  datas_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), datas);
+  datas_.SetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), datas,
+      GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_allocated:CMD_Login_Signin.datas)
 }
+void CMD_Login_Signin::unsafe_arena_set_allocated_datas(
+    ::std::string* datas) {
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  if (datas != NULL) {
+    
+  } else {
+    
+  }
+  datas_.UnsafeArenaSetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      datas, GetArenaNoVirtual());
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:CMD_Login_Signin.datas)
+}
 
 #endif  // PROTOBUF_INLINE_NOT_IN_HEADERS
 
@@ -7584,6 +10032,7 @@ const int CMD_Login_OnSigninCB::kRealAccountNameFieldNumber;
 const int CMD_Login_OnSigninCB::kDatasFieldNumber;
 const int CMD_Login_OnSigninCB::kFoundObjectIDFieldNumber;
 const int CMD_Login_OnSigninCB::kFoundAppIDFieldNumber;
+const int CMD_Login_OnSigninCB::kHallsIDFieldNumber;
 #endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
 
 CMD_Login_OnSigninCB::CMD_Login_OnSigninCB()
@@ -7594,6 +10043,16 @@ CMD_Login_OnSigninCB::CMD_Login_OnSigninCB()
   SharedCtor();
   // @@protoc_insertion_point(constructor:CMD_Login_OnSigninCB)
 }
+CMD_Login_OnSigninCB::CMD_Login_OnSigninCB(::google::protobuf::Arena* arena)
+  : ::google::protobuf::Message(),
+  _internal_metadata_(arena) {
+#ifdef GOOGLE_PROTOBUF_NO_STATIC_INITIALIZER
+  protobuf_Commands_2eproto::InitDefaults();
+#endif  // GOOGLE_PROTOBUF_NO_STATIC_INITIALIZER
+  SharedCtor();
+  RegisterArenaDtor(arena);
+  // @@protoc_insertion_point(arena_constructor:CMD_Login_OnSigninCB)
+}
 CMD_Login_OnSigninCB::CMD_Login_OnSigninCB(const CMD_Login_OnSigninCB& from)
   : ::google::protobuf::Message(),
       _internal_metadata_(NULL),
@@ -7601,15 +10060,18 @@ CMD_Login_OnSigninCB::CMD_Login_OnSigninCB(const CMD_Login_OnSigninCB& from)
   _internal_metadata_.MergeFrom(from._internal_metadata_);
   commitaccountname_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
   if (from.commitaccountname().size() > 0) {
-    commitaccountname_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.commitaccountname_);
+    commitaccountname_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.commitaccountname(),
+      GetArenaNoVirtual());
   }
   realaccountname_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
   if (from.realaccountname().size() > 0) {
-    realaccountname_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.realaccountname_);
+    realaccountname_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.realaccountname(),
+      GetArenaNoVirtual());
   }
   datas_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
   if (from.datas().size() > 0) {
-    datas_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.datas_);
+    datas_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.datas(),
+      GetArenaNoVirtual());
   }
   ::memcpy(&foundobjectid_, &from.foundobjectid_,
     reinterpret_cast<char*>(&errcode_) -
@@ -7632,11 +10094,22 @@ CMD_Login_OnSigninCB::~CMD_Login_OnSigninCB() {
 }
 
 void CMD_Login_OnSigninCB::SharedDtor() {
-  commitaccountname_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  realaccountname_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  datas_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  ::google::protobuf::Arena* arena = GetArenaNoVirtual();
+  if (arena != NULL) {
+    return;
+  }
+
+  commitaccountname_.Destroy(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), arena);
+  realaccountname_.Destroy(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), arena);
+  datas_.Destroy(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), arena);
 }
 
+void CMD_Login_OnSigninCB::ArenaDtor(void* object) {
+  CMD_Login_OnSigninCB* _this = reinterpret_cast< CMD_Login_OnSigninCB* >(object);
+  (void)_this;
+}
+void CMD_Login_OnSigninCB::RegisterArenaDtor(::google::protobuf::Arena* arena) {
+}
 void CMD_Login_OnSigninCB::SetCachedSize(int size) const {
   GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
   _cached_size_ = size;
@@ -7644,7 +10117,7 @@ void CMD_Login_OnSigninCB::SetCachedSize(int size) const {
 }
 const ::google::protobuf::Descriptor* CMD_Login_OnSigninCB::descriptor() {
   protobuf_Commands_2eproto::protobuf_AssignDescriptorsOnce();
-  return protobuf_Commands_2eproto::file_level_metadata[17].descriptor;
+  return protobuf_Commands_2eproto::file_level_metadata[19].descriptor;
 }
 
 const CMD_Login_OnSigninCB& CMD_Login_OnSigninCB::default_instance() {
@@ -7653,18 +10126,14 @@ const CMD_Login_OnSigninCB& CMD_Login_OnSigninCB::default_instance() {
 }
 
 CMD_Login_OnSigninCB* CMD_Login_OnSigninCB::New(::google::protobuf::Arena* arena) const {
-  CMD_Login_OnSigninCB* n = new CMD_Login_OnSigninCB;
-  if (arena != NULL) {
-    arena->Own(n);
-  }
-  return n;
+  return ::google::protobuf::Arena::CreateMessage<CMD_Login_OnSigninCB>(arena);
 }
 
 void CMD_Login_OnSigninCB::Clear() {
 // @@protoc_insertion_point(message_clear_start:CMD_Login_OnSigninCB)
-  commitaccountname_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  realaccountname_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  datas_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  commitaccountname_.ClearToEmpty(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
+  realaccountname_.ClearToEmpty(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
+  datas_.ClearToEmpty(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
   ::memset(&foundobjectid_, 0, reinterpret_cast<char*>(&errcode_) -
     reinterpret_cast<char*>(&foundobjectid_) + sizeof(errcode_));
 }
@@ -7760,6 +10229,19 @@ bool CMD_Login_OnSigninCB::MergePartialFromCodedStream(
         break;
       }
 
+      // uint64 hallsID = 7;
+      case 7: {
+        if (tag == 56u) {
+
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
+                 input, &hallsid_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
       default: {
       handle_unusual:
         if (tag == 0 ||
@@ -7826,6 +10308,11 @@ void CMD_Login_OnSigninCB::SerializeWithCachedSizes(
     ::google::protobuf::internal::WireFormatLite::WriteUInt64(6, this->foundappid(), output);
   }
 
+  // uint64 hallsID = 7;
+  if (this->hallsid() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt64(7, this->hallsid(), output);
+  }
+
   // @@protoc_insertion_point(serialize_end:CMD_Login_OnSigninCB)
 }
 
@@ -7878,6 +10365,11 @@ void CMD_Login_OnSigninCB::SerializeWithCachedSizes(
     target = ::google::protobuf::internal::WireFormatLite::WriteUInt64ToArray(6, this->foundappid(), target);
   }
 
+  // uint64 hallsID = 7;
+  if (this->hallsid() != 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteUInt64ToArray(7, this->hallsid(), target);
+  }
+
   // @@protoc_insertion_point(serialize_to_array_end:CMD_Login_OnSigninCB)
   return target;
 }
@@ -7921,6 +10413,13 @@ size_t CMD_Login_OnSigninCB::ByteSizeLong() const {
         this->foundappid());
   }
 
+  // uint64 hallsID = 7;
+  if (this->hallsid() != 0) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::UInt64Size(
+        this->hallsid());
+  }
+
   // .ServerError errcode = 1;
   if (this->errcode() != 0) {
     total_size += 1 +
@@ -7954,16 +10453,13 @@ void CMD_Login_OnSigninCB::MergeFrom(const CMD_Login_OnSigninCB& from) {
   GOOGLE_DCHECK_NE(&from, this);
   _internal_metadata_.MergeFrom(from._internal_metadata_);
   if (from.commitaccountname().size() > 0) {
-
-    commitaccountname_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.commitaccountname_);
+    set_commitaccountname(from.commitaccountname());
   }
   if (from.realaccountname().size() > 0) {
-
-    realaccountname_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.realaccountname_);
+    set_realaccountname(from.realaccountname());
   }
   if (from.datas().size() > 0) {
-
-    datas_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.datas_);
+    set_datas(from.datas());
   }
   if (from.foundobjectid() != 0) {
     set_foundobjectid(from.foundobjectid());
@@ -7971,6 +10467,9 @@ void CMD_Login_OnSigninCB::MergeFrom(const CMD_Login_OnSigninCB& from) {
   if (from.foundappid() != 0) {
     set_foundappid(from.foundappid());
   }
+  if (from.hallsid() != 0) {
+    set_hallsid(from.hallsid());
+  }
   if (from.errcode() != 0) {
     set_errcode(from.errcode());
   }
@@ -7996,6 +10495,21 @@ bool CMD_Login_OnSigninCB::IsInitialized() const {
 
 void CMD_Login_OnSigninCB::Swap(CMD_Login_OnSigninCB* other) {
   if (other == this) return;
+  if (GetArenaNoVirtual() == other->GetArenaNoVirtual()) {
+    InternalSwap(other);
+  } else {
+    CMD_Login_OnSigninCB* temp = New(GetArenaNoVirtual());
+    temp->MergeFrom(*other);
+    other->CopyFrom(*this);
+    InternalSwap(temp);
+    if (GetArenaNoVirtual() == NULL) {
+      delete temp;
+    }
+  }
+}
+void CMD_Login_OnSigninCB::UnsafeArenaSwap(CMD_Login_OnSigninCB* other) {
+  if (other == this) return;
+  GOOGLE_DCHECK(GetArenaNoVirtual() == other->GetArenaNoVirtual());
   InternalSwap(other);
 }
 void CMD_Login_OnSigninCB::InternalSwap(CMD_Login_OnSigninCB* other) {
@@ -8004,13 +10518,14 @@ void CMD_Login_OnSigninCB::InternalSwap(CMD_Login_OnSigninCB* other) {
   datas_.Swap(&other->datas_);
   std::swap(foundobjectid_, other->foundobjectid_);
   std::swap(foundappid_, other->foundappid_);
+  std::swap(hallsid_, other->hallsid_);
   std::swap(errcode_, other->errcode_);
   std::swap(_cached_size_, other->_cached_size_);
 }
 
 ::google::protobuf::Metadata CMD_Login_OnSigninCB::GetMetadata() const {
   protobuf_Commands_2eproto::protobuf_AssignDescriptorsOnce();
-  return protobuf_Commands_2eproto::file_level_metadata[17];
+  return protobuf_Commands_2eproto::file_level_metadata[19];
 }
 
 #if PROTOBUF_INLINE_NOT_IN_HEADERS
@@ -8032,45 +10547,46 @@ void CMD_Login_OnSigninCB::set_errcode(::ServerError value) {
 
 // string commitAccountName = 2;
 void CMD_Login_OnSigninCB::clear_commitaccountname() {
-  commitaccountname_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  commitaccountname_.ClearToEmpty(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 const ::std::string& CMD_Login_OnSigninCB::commitaccountname() const {
   // @@protoc_insertion_point(field_get:CMD_Login_OnSigninCB.commitAccountName)
-  return commitaccountname_.GetNoArena();
+  return commitaccountname_.Get();
 }
 void CMD_Login_OnSigninCB::set_commitaccountname(const ::std::string& value) {
   
-  commitaccountname_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  commitaccountname_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value, GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set:CMD_Login_OnSigninCB.commitAccountName)
 }
-#if LANG_CXX11
-void CMD_Login_OnSigninCB::set_commitaccountname(::std::string&& value) {
-  
-  commitaccountname_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:CMD_Login_OnSigninCB.commitAccountName)
-}
-#endif
 void CMD_Login_OnSigninCB::set_commitaccountname(const char* value) {
   
-  commitaccountname_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  commitaccountname_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+              GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_char:CMD_Login_OnSigninCB.commitAccountName)
 }
-void CMD_Login_OnSigninCB::set_commitaccountname(const char* value, size_t size) {
+void CMD_Login_OnSigninCB::set_commitaccountname(const char* value,
+    size_t size) {
   
-  commitaccountname_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
+  commitaccountname_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_pointer:CMD_Login_OnSigninCB.commitAccountName)
 }
 ::std::string* CMD_Login_OnSigninCB::mutable_commitaccountname() {
   
   // @@protoc_insertion_point(field_mutable:CMD_Login_OnSigninCB.commitAccountName)
-  return commitaccountname_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return commitaccountname_.Mutable(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 ::std::string* CMD_Login_OnSigninCB::release_commitaccountname() {
   // @@protoc_insertion_point(field_release:CMD_Login_OnSigninCB.commitAccountName)
   
-  return commitaccountname_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return commitaccountname_.Release(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
+}
+::std::string* CMD_Login_OnSigninCB::unsafe_arena_release_commitaccountname() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:CMD_Login_OnSigninCB.commitAccountName)
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  
+  return commitaccountname_.UnsafeArenaRelease(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      GetArenaNoVirtual());
 }
 void CMD_Login_OnSigninCB::set_allocated_commitaccountname(::std::string* commitaccountname) {
   if (commitaccountname != NULL) {
@@ -8078,51 +10594,65 @@ void CMD_Login_OnSigninCB::set_allocated_commitaccountname(::std::string* commit
   } else {
     
   }
-  commitaccountname_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), commitaccountname);
+  commitaccountname_.SetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), commitaccountname,
+      GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_allocated:CMD_Login_OnSigninCB.commitAccountName)
 }
+void CMD_Login_OnSigninCB::unsafe_arena_set_allocated_commitaccountname(
+    ::std::string* commitaccountname) {
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  if (commitaccountname != NULL) {
+    
+  } else {
+    
+  }
+  commitaccountname_.UnsafeArenaSetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      commitaccountname, GetArenaNoVirtual());
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:CMD_Login_OnSigninCB.commitAccountName)
+}
 
 // string realAccountName = 3;
 void CMD_Login_OnSigninCB::clear_realaccountname() {
-  realaccountname_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  realaccountname_.ClearToEmpty(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 const ::std::string& CMD_Login_OnSigninCB::realaccountname() const {
   // @@protoc_insertion_point(field_get:CMD_Login_OnSigninCB.realAccountName)
-  return realaccountname_.GetNoArena();
+  return realaccountname_.Get();
 }
 void CMD_Login_OnSigninCB::set_realaccountname(const ::std::string& value) {
   
-  realaccountname_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  realaccountname_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value, GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set:CMD_Login_OnSigninCB.realAccountName)
 }
-#if LANG_CXX11
-void CMD_Login_OnSigninCB::set_realaccountname(::std::string&& value) {
-  
-  realaccountname_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:CMD_Login_OnSigninCB.realAccountName)
-}
-#endif
 void CMD_Login_OnSigninCB::set_realaccountname(const char* value) {
   
-  realaccountname_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  realaccountname_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+              GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_char:CMD_Login_OnSigninCB.realAccountName)
 }
-void CMD_Login_OnSigninCB::set_realaccountname(const char* value, size_t size) {
+void CMD_Login_OnSigninCB::set_realaccountname(const char* value,
+    size_t size) {
   
-  realaccountname_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
+  realaccountname_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_pointer:CMD_Login_OnSigninCB.realAccountName)
 }
 ::std::string* CMD_Login_OnSigninCB::mutable_realaccountname() {
   
   // @@protoc_insertion_point(field_mutable:CMD_Login_OnSigninCB.realAccountName)
-  return realaccountname_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return realaccountname_.Mutable(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 ::std::string* CMD_Login_OnSigninCB::release_realaccountname() {
   // @@protoc_insertion_point(field_release:CMD_Login_OnSigninCB.realAccountName)
   
-  return realaccountname_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return realaccountname_.Release(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
+}
+::std::string* CMD_Login_OnSigninCB::unsafe_arena_release_realaccountname() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:CMD_Login_OnSigninCB.realAccountName)
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  
+  return realaccountname_.UnsafeArenaRelease(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      GetArenaNoVirtual());
 }
 void CMD_Login_OnSigninCB::set_allocated_realaccountname(::std::string* realaccountname) {
   if (realaccountname != NULL) {
@@ -8130,51 +10660,65 @@ void CMD_Login_OnSigninCB::set_allocated_realaccountname(::std::string* realacco
   } else {
     
   }
-  realaccountname_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), realaccountname);
+  realaccountname_.SetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), realaccountname,
+      GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_allocated:CMD_Login_OnSigninCB.realAccountName)
 }
+void CMD_Login_OnSigninCB::unsafe_arena_set_allocated_realaccountname(
+    ::std::string* realaccountname) {
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  if (realaccountname != NULL) {
+    
+  } else {
+    
+  }
+  realaccountname_.UnsafeArenaSetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      realaccountname, GetArenaNoVirtual());
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:CMD_Login_OnSigninCB.realAccountName)
+}
 
 // bytes datas = 4;
 void CMD_Login_OnSigninCB::clear_datas() {
-  datas_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  datas_.ClearToEmpty(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 const ::std::string& CMD_Login_OnSigninCB::datas() const {
   // @@protoc_insertion_point(field_get:CMD_Login_OnSigninCB.datas)
-  return datas_.GetNoArena();
+  return datas_.Get();
 }
 void CMD_Login_OnSigninCB::set_datas(const ::std::string& value) {
   
-  datas_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  datas_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value, GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set:CMD_Login_OnSigninCB.datas)
 }
-#if LANG_CXX11
-void CMD_Login_OnSigninCB::set_datas(::std::string&& value) {
-  
-  datas_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:CMD_Login_OnSigninCB.datas)
-}
-#endif
 void CMD_Login_OnSigninCB::set_datas(const char* value) {
   
-  datas_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  datas_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+              GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_char:CMD_Login_OnSigninCB.datas)
 }
-void CMD_Login_OnSigninCB::set_datas(const void* value, size_t size) {
+void CMD_Login_OnSigninCB::set_datas(const void* value,
+    size_t size) {
   
-  datas_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
+  datas_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_pointer:CMD_Login_OnSigninCB.datas)
 }
 ::std::string* CMD_Login_OnSigninCB::mutable_datas() {
   
   // @@protoc_insertion_point(field_mutable:CMD_Login_OnSigninCB.datas)
-  return datas_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return datas_.Mutable(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 ::std::string* CMD_Login_OnSigninCB::release_datas() {
   // @@protoc_insertion_point(field_release:CMD_Login_OnSigninCB.datas)
   
-  return datas_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return datas_.Release(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
+}
+::std::string* CMD_Login_OnSigninCB::unsafe_arena_release_datas() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:CMD_Login_OnSigninCB.datas)
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  
+  return datas_.UnsafeArenaRelease(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      GetArenaNoVirtual());
 }
 void CMD_Login_OnSigninCB::set_allocated_datas(::std::string* datas) {
   if (datas != NULL) {
@@ -8182,9 +10726,22 @@ void CMD_Login_OnSigninCB::set_allocated_datas(::std::string* datas) {
   } else {
     
   }
-  datas_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), datas);
+  datas_.SetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), datas,
+      GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_allocated:CMD_Login_OnSigninCB.datas)
 }
+void CMD_Login_OnSigninCB::unsafe_arena_set_allocated_datas(
+    ::std::string* datas) {
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  if (datas != NULL) {
+    
+  } else {
+    
+  }
+  datas_.UnsafeArenaSetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      datas, GetArenaNoVirtual());
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:CMD_Login_OnSigninCB.datas)
+}
 
 // uint64 foundObjectID = 5;
 void CMD_Login_OnSigninCB::clear_foundobjectid() {
@@ -8214,6 +10771,20 @@ void CMD_Login_OnSigninCB::set_foundappid(::google::protobuf::uint64 value) {
   // @@protoc_insertion_point(field_set:CMD_Login_OnSigninCB.foundAppID)
 }
 
+// uint64 hallsID = 7;
+void CMD_Login_OnSigninCB::clear_hallsid() {
+  hallsid_ = GOOGLE_ULONGLONG(0);
+}
+::google::protobuf::uint64 CMD_Login_OnSigninCB::hallsid() const {
+  // @@protoc_insertion_point(field_get:CMD_Login_OnSigninCB.hallsID)
+  return hallsid_;
+}
+void CMD_Login_OnSigninCB::set_hallsid(::google::protobuf::uint64 value) {
+  
+  hallsid_ = value;
+  // @@protoc_insertion_point(field_set:CMD_Login_OnSigninCB.hallsID)
+}
+
 #endif  // PROTOBUF_INLINE_NOT_IN_HEADERS
 
 // ===================================================================
@@ -8224,6 +10795,7 @@ const int CMD_Login_OnRequestAllocClientCB::kPortFieldNumber;
 const int CMD_Login_OnRequestAllocClientCB::kCommitAccountNameFieldNumber;
 const int CMD_Login_OnRequestAllocClientCB::kErrcodeFieldNumber;
 const int CMD_Login_OnRequestAllocClientCB::kTokenIDFieldNumber;
+const int CMD_Login_OnRequestAllocClientCB::kHallsIDFieldNumber;
 #endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
 
 CMD_Login_OnRequestAllocClientCB::CMD_Login_OnRequestAllocClientCB()
@@ -8232,7 +10804,17 @@ CMD_Login_OnRequestAllocClientCB::CMD_Login_OnRequestAllocClientCB()
     protobuf_Commands_2eproto::InitDefaults();
   }
   SharedCtor();
-  // @@protoc_insertion_point(constructor:CMD_Login_OnRequestAllocClientCB)
+  // @@protoc_insertion_point(constructor:CMD_Login_OnRequestAllocClientCB)
+}
+CMD_Login_OnRequestAllocClientCB::CMD_Login_OnRequestAllocClientCB(::google::protobuf::Arena* arena)
+  : ::google::protobuf::Message(),
+  _internal_metadata_(arena) {
+#ifdef GOOGLE_PROTOBUF_NO_STATIC_INITIALIZER
+  protobuf_Commands_2eproto::InitDefaults();
+#endif  // GOOGLE_PROTOBUF_NO_STATIC_INITIALIZER
+  SharedCtor();
+  RegisterArenaDtor(arena);
+  // @@protoc_insertion_point(arena_constructor:CMD_Login_OnRequestAllocClientCB)
 }
 CMD_Login_OnRequestAllocClientCB::CMD_Login_OnRequestAllocClientCB(const CMD_Login_OnRequestAllocClientCB& from)
   : ::google::protobuf::Message(),
@@ -8241,23 +10823,25 @@ CMD_Login_OnRequestAllocClientCB::CMD_Login_OnRequestAllocClientCB(const CMD_Log
   _internal_metadata_.MergeFrom(from._internal_metadata_);
   ip_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
   if (from.ip().size() > 0) {
-    ip_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.ip_);
+    ip_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.ip(),
+      GetArenaNoVirtual());
   }
   commitaccountname_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
   if (from.commitaccountname().size() > 0) {
-    commitaccountname_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.commitaccountname_);
+    commitaccountname_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.commitaccountname(),
+      GetArenaNoVirtual());
   }
   ::memcpy(&port_, &from.port_,
-    reinterpret_cast<char*>(&tokenid_) -
-    reinterpret_cast<char*>(&port_) + sizeof(tokenid_));
+    reinterpret_cast<char*>(&hallsid_) -
+    reinterpret_cast<char*>(&port_) + sizeof(hallsid_));
   // @@protoc_insertion_point(copy_constructor:CMD_Login_OnRequestAllocClientCB)
 }
 
 void CMD_Login_OnRequestAllocClientCB::SharedCtor() {
   ip_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
   commitaccountname_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  ::memset(&port_, 0, reinterpret_cast<char*>(&tokenid_) -
-    reinterpret_cast<char*>(&port_) + sizeof(tokenid_));
+  ::memset(&port_, 0, reinterpret_cast<char*>(&hallsid_) -
+    reinterpret_cast<char*>(&port_) + sizeof(hallsid_));
   _cached_size_ = 0;
 }
 
@@ -8267,10 +10851,21 @@ CMD_Login_OnRequestAllocClientCB::~CMD_Login_OnRequestAllocClientCB() {
 }
 
 void CMD_Login_OnRequestAllocClientCB::SharedDtor() {
-  ip_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  commitaccountname_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  ::google::protobuf::Arena* arena = GetArenaNoVirtual();
+  if (arena != NULL) {
+    return;
+  }
+
+  ip_.Destroy(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), arena);
+  commitaccountname_.Destroy(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), arena);
 }
 
+void CMD_Login_OnRequestAllocClientCB::ArenaDtor(void* object) {
+  CMD_Login_OnRequestAllocClientCB* _this = reinterpret_cast< CMD_Login_OnRequestAllocClientCB* >(object);
+  (void)_this;
+}
+void CMD_Login_OnRequestAllocClientCB::RegisterArenaDtor(::google::protobuf::Arena* arena) {
+}
 void CMD_Login_OnRequestAllocClientCB::SetCachedSize(int size) const {
   GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
   _cached_size_ = size;
@@ -8278,7 +10873,7 @@ void CMD_Login_OnRequestAllocClientCB::SetCachedSize(int size) const {
 }
 const ::google::protobuf::Descriptor* CMD_Login_OnRequestAllocClientCB::descriptor() {
   protobuf_Commands_2eproto::protobuf_AssignDescriptorsOnce();
-  return protobuf_Commands_2eproto::file_level_metadata[18].descriptor;
+  return protobuf_Commands_2eproto::file_level_metadata[20].descriptor;
 }
 
 const CMD_Login_OnRequestAllocClientCB& CMD_Login_OnRequestAllocClientCB::default_instance() {
@@ -8287,19 +10882,15 @@ const CMD_Login_OnRequestAllocClientCB& CMD_Login_OnRequestAllocClientCB::defaul
 }
 
 CMD_Login_OnRequestAllocClientCB* CMD_Login_OnRequestAllocClientCB::New(::google::protobuf::Arena* arena) const {
-  CMD_Login_OnRequestAllocClientCB* n = new CMD_Login_OnRequestAllocClientCB;
-  if (arena != NULL) {
-    arena->Own(n);
-  }
-  return n;
+  return ::google::protobuf::Arena::CreateMessage<CMD_Login_OnRequestAllocClientCB>(arena);
 }
 
 void CMD_Login_OnRequestAllocClientCB::Clear() {
 // @@protoc_insertion_point(message_clear_start:CMD_Login_OnRequestAllocClientCB)
-  ip_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  commitaccountname_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  ::memset(&port_, 0, reinterpret_cast<char*>(&tokenid_) -
-    reinterpret_cast<char*>(&port_) + sizeof(tokenid_));
+  ip_.ClearToEmpty(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
+  commitaccountname_.ClearToEmpty(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
+  ::memset(&port_, 0, reinterpret_cast<char*>(&hallsid_) -
+    reinterpret_cast<char*>(&port_) + sizeof(hallsid_));
 }
 
 bool CMD_Login_OnRequestAllocClientCB::MergePartialFromCodedStream(
@@ -8382,6 +10973,19 @@ bool CMD_Login_OnRequestAllocClientCB::MergePartialFromCodedStream(
         break;
       }
 
+      // uint64 hallsID = 6;
+      case 6: {
+        if (tag == 48u) {
+
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
+                 input, &hallsid_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
       default: {
       handle_unusual:
         if (tag == 0 ||
@@ -8442,6 +11046,11 @@ void CMD_Login_OnRequestAllocClientCB::SerializeWithCachedSizes(
     ::google::protobuf::internal::WireFormatLite::WriteUInt64(5, this->tokenid(), output);
   }
 
+  // uint64 hallsID = 6;
+  if (this->hallsid() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt64(6, this->hallsid(), output);
+  }
+
   // @@protoc_insertion_point(serialize_end:CMD_Login_OnRequestAllocClientCB)
 }
 
@@ -8487,6 +11096,11 @@ void CMD_Login_OnRequestAllocClientCB::SerializeWithCachedSizes(
     target = ::google::protobuf::internal::WireFormatLite::WriteUInt64ToArray(5, this->tokenid(), target);
   }
 
+  // uint64 hallsID = 6;
+  if (this->hallsid() != 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteUInt64ToArray(6, this->hallsid(), target);
+  }
+
   // @@protoc_insertion_point(serialize_to_array_end:CMD_Login_OnRequestAllocClientCB)
   return target;
 }
@@ -8529,6 +11143,13 @@ size_t CMD_Login_OnRequestAllocClientCB::ByteSizeLong() const {
         this->tokenid());
   }
 
+  // uint64 hallsID = 6;
+  if (this->hallsid() != 0) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::UInt64Size(
+        this->hallsid());
+  }
+
   int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
   GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
   _cached_size_ = cached_size;
@@ -8556,12 +11177,10 @@ void CMD_Login_OnRequestAllocClientCB::MergeFrom(const CMD_Login_OnRequestAllocC
   GOOGLE_DCHECK_NE(&from, this);
   _internal_metadata_.MergeFrom(from._internal_metadata_);
   if (from.ip().size() > 0) {
-
-    ip_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.ip_);
+    set_ip(from.ip());
   }
   if (from.commitaccountname().size() > 0) {
-
-    commitaccountname_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.commitaccountname_);
+    set_commitaccountname(from.commitaccountname());
   }
   if (from.port() != 0) {
     set_port(from.port());
@@ -8572,6 +11191,9 @@ void CMD_Login_OnRequestAllocClientCB::MergeFrom(const CMD_Login_OnRequestAllocC
   if (from.tokenid() != 0) {
     set_tokenid(from.tokenid());
   }
+  if (from.hallsid() != 0) {
+    set_hallsid(from.hallsid());
+  }
 }
 
 void CMD_Login_OnRequestAllocClientCB::CopyFrom(const ::google::protobuf::Message& from) {
@@ -8594,6 +11216,21 @@ bool CMD_Login_OnRequestAllocClientCB::IsInitialized() const {
 
 void CMD_Login_OnRequestAllocClientCB::Swap(CMD_Login_OnRequestAllocClientCB* other) {
   if (other == this) return;
+  if (GetArenaNoVirtual() == other->GetArenaNoVirtual()) {
+    InternalSwap(other);
+  } else {
+    CMD_Login_OnRequestAllocClientCB* temp = New(GetArenaNoVirtual());
+    temp->MergeFrom(*other);
+    other->CopyFrom(*this);
+    InternalSwap(temp);
+    if (GetArenaNoVirtual() == NULL) {
+      delete temp;
+    }
+  }
+}
+void CMD_Login_OnRequestAllocClientCB::UnsafeArenaSwap(CMD_Login_OnRequestAllocClientCB* other) {
+  if (other == this) return;
+  GOOGLE_DCHECK(GetArenaNoVirtual() == other->GetArenaNoVirtual());
   InternalSwap(other);
 }
 void CMD_Login_OnRequestAllocClientCB::InternalSwap(CMD_Login_OnRequestAllocClientCB* other) {
@@ -8602,12 +11239,13 @@ void CMD_Login_OnRequestAllocClientCB::InternalSwap(CMD_Login_OnRequestAllocClie
   std::swap(port_, other->port_);
   std::swap(errcode_, other->errcode_);
   std::swap(tokenid_, other->tokenid_);
+  std::swap(hallsid_, other->hallsid_);
   std::swap(_cached_size_, other->_cached_size_);
 }
 
 ::google::protobuf::Metadata CMD_Login_OnRequestAllocClientCB::GetMetadata() const {
   protobuf_Commands_2eproto::protobuf_AssignDescriptorsOnce();
-  return protobuf_Commands_2eproto::file_level_metadata[18];
+  return protobuf_Commands_2eproto::file_level_metadata[20];
 }
 
 #if PROTOBUF_INLINE_NOT_IN_HEADERS
@@ -8615,45 +11253,46 @@ void CMD_Login_OnRequestAllocClientCB::InternalSwap(CMD_Login_OnRequestAllocClie
 
 // string ip = 1;
 void CMD_Login_OnRequestAllocClientCB::clear_ip() {
-  ip_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  ip_.ClearToEmpty(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 const ::std::string& CMD_Login_OnRequestAllocClientCB::ip() const {
   // @@protoc_insertion_point(field_get:CMD_Login_OnRequestAllocClientCB.ip)
-  return ip_.GetNoArena();
+  return ip_.Get();
 }
 void CMD_Login_OnRequestAllocClientCB::set_ip(const ::std::string& value) {
   
-  ip_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  ip_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value, GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set:CMD_Login_OnRequestAllocClientCB.ip)
 }
-#if LANG_CXX11
-void CMD_Login_OnRequestAllocClientCB::set_ip(::std::string&& value) {
-  
-  ip_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:CMD_Login_OnRequestAllocClientCB.ip)
-}
-#endif
 void CMD_Login_OnRequestAllocClientCB::set_ip(const char* value) {
   
-  ip_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  ip_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+              GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_char:CMD_Login_OnRequestAllocClientCB.ip)
 }
-void CMD_Login_OnRequestAllocClientCB::set_ip(const char* value, size_t size) {
+void CMD_Login_OnRequestAllocClientCB::set_ip(const char* value,
+    size_t size) {
   
-  ip_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
+  ip_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_pointer:CMD_Login_OnRequestAllocClientCB.ip)
 }
 ::std::string* CMD_Login_OnRequestAllocClientCB::mutable_ip() {
   
   // @@protoc_insertion_point(field_mutable:CMD_Login_OnRequestAllocClientCB.ip)
-  return ip_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return ip_.Mutable(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 ::std::string* CMD_Login_OnRequestAllocClientCB::release_ip() {
   // @@protoc_insertion_point(field_release:CMD_Login_OnRequestAllocClientCB.ip)
   
-  return ip_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return ip_.Release(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
+}
+::std::string* CMD_Login_OnRequestAllocClientCB::unsafe_arena_release_ip() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:CMD_Login_OnRequestAllocClientCB.ip)
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  
+  return ip_.UnsafeArenaRelease(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      GetArenaNoVirtual());
 }
 void CMD_Login_OnRequestAllocClientCB::set_allocated_ip(::std::string* ip) {
   if (ip != NULL) {
@@ -8661,9 +11300,22 @@ void CMD_Login_OnRequestAllocClientCB::set_allocated_ip(::std::string* ip) {
   } else {
     
   }
-  ip_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ip);
+  ip_.SetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ip,
+      GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_allocated:CMD_Login_OnRequestAllocClientCB.ip)
 }
+void CMD_Login_OnRequestAllocClientCB::unsafe_arena_set_allocated_ip(
+    ::std::string* ip) {
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  if (ip != NULL) {
+    
+  } else {
+    
+  }
+  ip_.UnsafeArenaSetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      ip, GetArenaNoVirtual());
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:CMD_Login_OnRequestAllocClientCB.ip)
+}
 
 // int32 port = 2;
 void CMD_Login_OnRequestAllocClientCB::clear_port() {
@@ -8681,45 +11333,46 @@ void CMD_Login_OnRequestAllocClientCB::set_port(::google::protobuf::int32 value)
 
 // string commitAccountName = 3;
 void CMD_Login_OnRequestAllocClientCB::clear_commitaccountname() {
-  commitaccountname_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  commitaccountname_.ClearToEmpty(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 const ::std::string& CMD_Login_OnRequestAllocClientCB::commitaccountname() const {
   // @@protoc_insertion_point(field_get:CMD_Login_OnRequestAllocClientCB.commitAccountName)
-  return commitaccountname_.GetNoArena();
+  return commitaccountname_.Get();
 }
 void CMD_Login_OnRequestAllocClientCB::set_commitaccountname(const ::std::string& value) {
   
-  commitaccountname_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  commitaccountname_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value, GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set:CMD_Login_OnRequestAllocClientCB.commitAccountName)
 }
-#if LANG_CXX11
-void CMD_Login_OnRequestAllocClientCB::set_commitaccountname(::std::string&& value) {
-  
-  commitaccountname_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:CMD_Login_OnRequestAllocClientCB.commitAccountName)
-}
-#endif
 void CMD_Login_OnRequestAllocClientCB::set_commitaccountname(const char* value) {
   
-  commitaccountname_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  commitaccountname_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+              GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_char:CMD_Login_OnRequestAllocClientCB.commitAccountName)
 }
-void CMD_Login_OnRequestAllocClientCB::set_commitaccountname(const char* value, size_t size) {
+void CMD_Login_OnRequestAllocClientCB::set_commitaccountname(const char* value,
+    size_t size) {
   
-  commitaccountname_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
+  commitaccountname_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_pointer:CMD_Login_OnRequestAllocClientCB.commitAccountName)
 }
 ::std::string* CMD_Login_OnRequestAllocClientCB::mutable_commitaccountname() {
   
   // @@protoc_insertion_point(field_mutable:CMD_Login_OnRequestAllocClientCB.commitAccountName)
-  return commitaccountname_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return commitaccountname_.Mutable(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 ::std::string* CMD_Login_OnRequestAllocClientCB::release_commitaccountname() {
   // @@protoc_insertion_point(field_release:CMD_Login_OnRequestAllocClientCB.commitAccountName)
   
-  return commitaccountname_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return commitaccountname_.Release(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
+}
+::std::string* CMD_Login_OnRequestAllocClientCB::unsafe_arena_release_commitaccountname() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:CMD_Login_OnRequestAllocClientCB.commitAccountName)
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  
+  return commitaccountname_.UnsafeArenaRelease(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      GetArenaNoVirtual());
 }
 void CMD_Login_OnRequestAllocClientCB::set_allocated_commitaccountname(::std::string* commitaccountname) {
   if (commitaccountname != NULL) {
@@ -8727,9 +11380,22 @@ void CMD_Login_OnRequestAllocClientCB::set_allocated_commitaccountname(::std::st
   } else {
     
   }
-  commitaccountname_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), commitaccountname);
+  commitaccountname_.SetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), commitaccountname,
+      GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_allocated:CMD_Login_OnRequestAllocClientCB.commitAccountName)
 }
+void CMD_Login_OnRequestAllocClientCB::unsafe_arena_set_allocated_commitaccountname(
+    ::std::string* commitaccountname) {
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  if (commitaccountname != NULL) {
+    
+  } else {
+    
+  }
+  commitaccountname_.UnsafeArenaSetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      commitaccountname, GetArenaNoVirtual());
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:CMD_Login_OnRequestAllocClientCB.commitAccountName)
+}
 
 // .ServerError errcode = 4;
 void CMD_Login_OnRequestAllocClientCB::clear_errcode() {
@@ -8759,6 +11425,20 @@ void CMD_Login_OnRequestAllocClientCB::set_tokenid(::google::protobuf::uint64 va
   // @@protoc_insertion_point(field_set:CMD_Login_OnRequestAllocClientCB.tokenID)
 }
 
+// uint64 hallsID = 6;
+void CMD_Login_OnRequestAllocClientCB::clear_hallsid() {
+  hallsid_ = GOOGLE_ULONGLONG(0);
+}
+::google::protobuf::uint64 CMD_Login_OnRequestAllocClientCB::hallsid() const {
+  // @@protoc_insertion_point(field_get:CMD_Login_OnRequestAllocClientCB.hallsID)
+  return hallsid_;
+}
+void CMD_Login_OnRequestAllocClientCB::set_hallsid(::google::protobuf::uint64 value) {
+  
+  hallsid_ = value;
+  // @@protoc_insertion_point(field_set:CMD_Login_OnRequestAllocClientCB.hallsID)
+}
+
 #endif  // PROTOBUF_INLINE_NOT_IN_HEADERS
 
 // ===================================================================
@@ -8782,6 +11462,16 @@ CMD_Dbmgr_WriteAccount::CMD_Dbmgr_WriteAccount()
   SharedCtor();
   // @@protoc_insertion_point(constructor:CMD_Dbmgr_WriteAccount)
 }
+CMD_Dbmgr_WriteAccount::CMD_Dbmgr_WriteAccount(::google::protobuf::Arena* arena)
+  : ::google::protobuf::Message(),
+  _internal_metadata_(arena) {
+#ifdef GOOGLE_PROTOBUF_NO_STATIC_INITIALIZER
+  protobuf_Commands_2eproto::InitDefaults();
+#endif  // GOOGLE_PROTOBUF_NO_STATIC_INITIALIZER
+  SharedCtor();
+  RegisterArenaDtor(arena);
+  // @@protoc_insertion_point(arena_constructor:CMD_Dbmgr_WriteAccount)
+}
 CMD_Dbmgr_WriteAccount::CMD_Dbmgr_WriteAccount(const CMD_Dbmgr_WriteAccount& from)
   : ::google::protobuf::Message(),
       _internal_metadata_(NULL),
@@ -8789,19 +11479,23 @@ CMD_Dbmgr_WriteAccount::CMD_Dbmgr_WriteAccount(const CMD_Dbmgr_WriteAccount& fro
   _internal_metadata_.MergeFrom(from._internal_metadata_);
   commitaccountname_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
   if (from.commitaccountname().size() > 0) {
-    commitaccountname_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.commitaccountname_);
+    commitaccountname_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.commitaccountname(),
+      GetArenaNoVirtual());
   }
   password_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
   if (from.password().size() > 0) {
-    password_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.password_);
+    password_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.password(),
+      GetArenaNoVirtual());
   }
   datas_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
   if (from.datas().size() > 0) {
-    datas_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.datas_);
+    datas_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.datas(),
+      GetArenaNoVirtual());
   }
   playername_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
   if (from.playername().size() > 0) {
-    playername_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.playername_);
+    playername_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.playername(),
+      GetArenaNoVirtual());
   }
   ::memcpy(&appid_, &from.appid_,
     reinterpret_cast<char*>(&gold_) -
@@ -8825,12 +11519,23 @@ CMD_Dbmgr_WriteAccount::~CMD_Dbmgr_WriteAccount() {
 }
 
 void CMD_Dbmgr_WriteAccount::SharedDtor() {
-  commitaccountname_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  password_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  datas_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  playername_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  ::google::protobuf::Arena* arena = GetArenaNoVirtual();
+  if (arena != NULL) {
+    return;
+  }
+
+  commitaccountname_.Destroy(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), arena);
+  password_.Destroy(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), arena);
+  datas_.Destroy(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), arena);
+  playername_.Destroy(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), arena);
 }
 
+void CMD_Dbmgr_WriteAccount::ArenaDtor(void* object) {
+  CMD_Dbmgr_WriteAccount* _this = reinterpret_cast< CMD_Dbmgr_WriteAccount* >(object);
+  (void)_this;
+}
+void CMD_Dbmgr_WriteAccount::RegisterArenaDtor(::google::protobuf::Arena* arena) {
+}
 void CMD_Dbmgr_WriteAccount::SetCachedSize(int size) const {
   GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
   _cached_size_ = size;
@@ -8838,7 +11543,7 @@ void CMD_Dbmgr_WriteAccount::SetCachedSize(int size) const {
 }
 const ::google::protobuf::Descriptor* CMD_Dbmgr_WriteAccount::descriptor() {
   protobuf_Commands_2eproto::protobuf_AssignDescriptorsOnce();
-  return protobuf_Commands_2eproto::file_level_metadata[19].descriptor;
+  return protobuf_Commands_2eproto::file_level_metadata[21].descriptor;
 }
 
 const CMD_Dbmgr_WriteAccount& CMD_Dbmgr_WriteAccount::default_instance() {
@@ -8847,19 +11552,15 @@ const CMD_Dbmgr_WriteAccount& CMD_Dbmgr_WriteAccount::default_instance() {
 }
 
 CMD_Dbmgr_WriteAccount* CMD_Dbmgr_WriteAccount::New(::google::protobuf::Arena* arena) const {
-  CMD_Dbmgr_WriteAccount* n = new CMD_Dbmgr_WriteAccount;
-  if (arena != NULL) {
-    arena->Own(n);
-  }
-  return n;
+  return ::google::protobuf::Arena::CreateMessage<CMD_Dbmgr_WriteAccount>(arena);
 }
 
 void CMD_Dbmgr_WriteAccount::Clear() {
 // @@protoc_insertion_point(message_clear_start:CMD_Dbmgr_WriteAccount)
-  commitaccountname_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  password_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  datas_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  playername_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  commitaccountname_.ClearToEmpty(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
+  password_.ClearToEmpty(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
+  datas_.ClearToEmpty(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
+  playername_.ClearToEmpty(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
   ::memset(&appid_, 0, reinterpret_cast<char*>(&gold_) -
     reinterpret_cast<char*>(&appid_) + sizeof(gold_));
 }
@@ -9220,20 +11921,16 @@ void CMD_Dbmgr_WriteAccount::MergeFrom(const CMD_Dbmgr_WriteAccount& from) {
   GOOGLE_DCHECK_NE(&from, this);
   _internal_metadata_.MergeFrom(from._internal_metadata_);
   if (from.commitaccountname().size() > 0) {
-
-    commitaccountname_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.commitaccountname_);
+    set_commitaccountname(from.commitaccountname());
   }
   if (from.password().size() > 0) {
-
-    password_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.password_);
+    set_password(from.password());
   }
   if (from.datas().size() > 0) {
-
-    datas_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.datas_);
+    set_datas(from.datas());
   }
   if (from.playername().size() > 0) {
-
-    playername_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.playername_);
+    set_playername(from.playername());
   }
   if (from.appid() != 0) {
     set_appid(from.appid());
@@ -9269,6 +11966,21 @@ bool CMD_Dbmgr_WriteAccount::IsInitialized() const {
 
 void CMD_Dbmgr_WriteAccount::Swap(CMD_Dbmgr_WriteAccount* other) {
   if (other == this) return;
+  if (GetArenaNoVirtual() == other->GetArenaNoVirtual()) {
+    InternalSwap(other);
+  } else {
+    CMD_Dbmgr_WriteAccount* temp = New(GetArenaNoVirtual());
+    temp->MergeFrom(*other);
+    other->CopyFrom(*this);
+    InternalSwap(temp);
+    if (GetArenaNoVirtual() == NULL) {
+      delete temp;
+    }
+  }
+}
+void CMD_Dbmgr_WriteAccount::UnsafeArenaSwap(CMD_Dbmgr_WriteAccount* other) {
+  if (other == this) return;
+  GOOGLE_DCHECK(GetArenaNoVirtual() == other->GetArenaNoVirtual());
   InternalSwap(other);
 }
 void CMD_Dbmgr_WriteAccount::InternalSwap(CMD_Dbmgr_WriteAccount* other) {
@@ -9285,7 +11997,7 @@ void CMD_Dbmgr_WriteAccount::InternalSwap(CMD_Dbmgr_WriteAccount* other) {
 
 ::google::protobuf::Metadata CMD_Dbmgr_WriteAccount::GetMetadata() const {
   protobuf_Commands_2eproto::protobuf_AssignDescriptorsOnce();
-  return protobuf_Commands_2eproto::file_level_metadata[19];
+  return protobuf_Commands_2eproto::file_level_metadata[21];
 }
 
 #if PROTOBUF_INLINE_NOT_IN_HEADERS
@@ -9307,45 +12019,46 @@ void CMD_Dbmgr_WriteAccount::set_appid(::google::protobuf::uint64 value) {
 
 // string commitAccountName = 2;
 void CMD_Dbmgr_WriteAccount::clear_commitaccountname() {
-  commitaccountname_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  commitaccountname_.ClearToEmpty(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 const ::std::string& CMD_Dbmgr_WriteAccount::commitaccountname() const {
   // @@protoc_insertion_point(field_get:CMD_Dbmgr_WriteAccount.commitAccountName)
-  return commitaccountname_.GetNoArena();
+  return commitaccountname_.Get();
 }
 void CMD_Dbmgr_WriteAccount::set_commitaccountname(const ::std::string& value) {
   
-  commitaccountname_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  commitaccountname_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value, GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set:CMD_Dbmgr_WriteAccount.commitAccountName)
 }
-#if LANG_CXX11
-void CMD_Dbmgr_WriteAccount::set_commitaccountname(::std::string&& value) {
-  
-  commitaccountname_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:CMD_Dbmgr_WriteAccount.commitAccountName)
-}
-#endif
 void CMD_Dbmgr_WriteAccount::set_commitaccountname(const char* value) {
   
-  commitaccountname_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  commitaccountname_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+              GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_char:CMD_Dbmgr_WriteAccount.commitAccountName)
 }
-void CMD_Dbmgr_WriteAccount::set_commitaccountname(const char* value, size_t size) {
+void CMD_Dbmgr_WriteAccount::set_commitaccountname(const char* value,
+    size_t size) {
   
-  commitaccountname_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
+  commitaccountname_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_pointer:CMD_Dbmgr_WriteAccount.commitAccountName)
 }
 ::std::string* CMD_Dbmgr_WriteAccount::mutable_commitaccountname() {
   
   // @@protoc_insertion_point(field_mutable:CMD_Dbmgr_WriteAccount.commitAccountName)
-  return commitaccountname_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return commitaccountname_.Mutable(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 ::std::string* CMD_Dbmgr_WriteAccount::release_commitaccountname() {
   // @@protoc_insertion_point(field_release:CMD_Dbmgr_WriteAccount.commitAccountName)
   
-  return commitaccountname_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return commitaccountname_.Release(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
+}
+::std::string* CMD_Dbmgr_WriteAccount::unsafe_arena_release_commitaccountname() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:CMD_Dbmgr_WriteAccount.commitAccountName)
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  
+  return commitaccountname_.UnsafeArenaRelease(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      GetArenaNoVirtual());
 }
 void CMD_Dbmgr_WriteAccount::set_allocated_commitaccountname(::std::string* commitaccountname) {
   if (commitaccountname != NULL) {
@@ -9353,51 +12066,65 @@ void CMD_Dbmgr_WriteAccount::set_allocated_commitaccountname(::std::string* comm
   } else {
     
   }
-  commitaccountname_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), commitaccountname);
+  commitaccountname_.SetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), commitaccountname,
+      GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_allocated:CMD_Dbmgr_WriteAccount.commitAccountName)
 }
+void CMD_Dbmgr_WriteAccount::unsafe_arena_set_allocated_commitaccountname(
+    ::std::string* commitaccountname) {
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  if (commitaccountname != NULL) {
+    
+  } else {
+    
+  }
+  commitaccountname_.UnsafeArenaSetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      commitaccountname, GetArenaNoVirtual());
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:CMD_Dbmgr_WriteAccount.commitAccountName)
+}
 
 // string password = 3;
 void CMD_Dbmgr_WriteAccount::clear_password() {
-  password_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  password_.ClearToEmpty(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 const ::std::string& CMD_Dbmgr_WriteAccount::password() const {
   // @@protoc_insertion_point(field_get:CMD_Dbmgr_WriteAccount.password)
-  return password_.GetNoArena();
+  return password_.Get();
 }
 void CMD_Dbmgr_WriteAccount::set_password(const ::std::string& value) {
   
-  password_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  password_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value, GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set:CMD_Dbmgr_WriteAccount.password)
 }
-#if LANG_CXX11
-void CMD_Dbmgr_WriteAccount::set_password(::std::string&& value) {
-  
-  password_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:CMD_Dbmgr_WriteAccount.password)
-}
-#endif
 void CMD_Dbmgr_WriteAccount::set_password(const char* value) {
   
-  password_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  password_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+              GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_char:CMD_Dbmgr_WriteAccount.password)
 }
-void CMD_Dbmgr_WriteAccount::set_password(const char* value, size_t size) {
+void CMD_Dbmgr_WriteAccount::set_password(const char* value,
+    size_t size) {
   
-  password_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
+  password_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_pointer:CMD_Dbmgr_WriteAccount.password)
 }
 ::std::string* CMD_Dbmgr_WriteAccount::mutable_password() {
   
   // @@protoc_insertion_point(field_mutable:CMD_Dbmgr_WriteAccount.password)
-  return password_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return password_.Mutable(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 ::std::string* CMD_Dbmgr_WriteAccount::release_password() {
   // @@protoc_insertion_point(field_release:CMD_Dbmgr_WriteAccount.password)
   
-  return password_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return password_.Release(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
+}
+::std::string* CMD_Dbmgr_WriteAccount::unsafe_arena_release_password() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:CMD_Dbmgr_WriteAccount.password)
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  
+  return password_.UnsafeArenaRelease(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      GetArenaNoVirtual());
 }
 void CMD_Dbmgr_WriteAccount::set_allocated_password(::std::string* password) {
   if (password != NULL) {
@@ -9405,51 +12132,65 @@ void CMD_Dbmgr_WriteAccount::set_allocated_password(::std::string* password) {
   } else {
     
   }
-  password_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), password);
+  password_.SetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), password,
+      GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_allocated:CMD_Dbmgr_WriteAccount.password)
 }
+void CMD_Dbmgr_WriteAccount::unsafe_arena_set_allocated_password(
+    ::std::string* password) {
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  if (password != NULL) {
+    
+  } else {
+    
+  }
+  password_.UnsafeArenaSetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      password, GetArenaNoVirtual());
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:CMD_Dbmgr_WriteAccount.password)
+}
 
 // bytes datas = 4;
 void CMD_Dbmgr_WriteAccount::clear_datas() {
-  datas_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  datas_.ClearToEmpty(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 const ::std::string& CMD_Dbmgr_WriteAccount::datas() const {
   // @@protoc_insertion_point(field_get:CMD_Dbmgr_WriteAccount.datas)
-  return datas_.GetNoArena();
+  return datas_.Get();
 }
 void CMD_Dbmgr_WriteAccount::set_datas(const ::std::string& value) {
   
-  datas_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  datas_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value, GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set:CMD_Dbmgr_WriteAccount.datas)
 }
-#if LANG_CXX11
-void CMD_Dbmgr_WriteAccount::set_datas(::std::string&& value) {
-  
-  datas_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:CMD_Dbmgr_WriteAccount.datas)
-}
-#endif
 void CMD_Dbmgr_WriteAccount::set_datas(const char* value) {
   
-  datas_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  datas_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+              GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_char:CMD_Dbmgr_WriteAccount.datas)
 }
-void CMD_Dbmgr_WriteAccount::set_datas(const void* value, size_t size) {
+void CMD_Dbmgr_WriteAccount::set_datas(const void* value,
+    size_t size) {
   
-  datas_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
+  datas_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_pointer:CMD_Dbmgr_WriteAccount.datas)
 }
 ::std::string* CMD_Dbmgr_WriteAccount::mutable_datas() {
   
   // @@protoc_insertion_point(field_mutable:CMD_Dbmgr_WriteAccount.datas)
-  return datas_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return datas_.Mutable(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 ::std::string* CMD_Dbmgr_WriteAccount::release_datas() {
   // @@protoc_insertion_point(field_release:CMD_Dbmgr_WriteAccount.datas)
   
-  return datas_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return datas_.Release(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
+}
+::std::string* CMD_Dbmgr_WriteAccount::unsafe_arena_release_datas() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:CMD_Dbmgr_WriteAccount.datas)
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  
+  return datas_.UnsafeArenaRelease(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      GetArenaNoVirtual());
 }
 void CMD_Dbmgr_WriteAccount::set_allocated_datas(::std::string* datas) {
   if (datas != NULL) {
@@ -9457,51 +12198,65 @@ void CMD_Dbmgr_WriteAccount::set_allocated_datas(::std::string* datas) {
   } else {
     
   }
-  datas_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), datas);
+  datas_.SetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), datas,
+      GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_allocated:CMD_Dbmgr_WriteAccount.datas)
 }
+void CMD_Dbmgr_WriteAccount::unsafe_arena_set_allocated_datas(
+    ::std::string* datas) {
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  if (datas != NULL) {
+    
+  } else {
+    
+  }
+  datas_.UnsafeArenaSetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      datas, GetArenaNoVirtual());
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:CMD_Dbmgr_WriteAccount.datas)
+}
 
 // string playerName = 5;
 void CMD_Dbmgr_WriteAccount::clear_playername() {
-  playername_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  playername_.ClearToEmpty(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 const ::std::string& CMD_Dbmgr_WriteAccount::playername() const {
   // @@protoc_insertion_point(field_get:CMD_Dbmgr_WriteAccount.playerName)
-  return playername_.GetNoArena();
+  return playername_.Get();
 }
 void CMD_Dbmgr_WriteAccount::set_playername(const ::std::string& value) {
   
-  playername_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  playername_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value, GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set:CMD_Dbmgr_WriteAccount.playerName)
 }
-#if LANG_CXX11
-void CMD_Dbmgr_WriteAccount::set_playername(::std::string&& value) {
-  
-  playername_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:CMD_Dbmgr_WriteAccount.playerName)
-}
-#endif
 void CMD_Dbmgr_WriteAccount::set_playername(const char* value) {
   
-  playername_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  playername_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+              GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_char:CMD_Dbmgr_WriteAccount.playerName)
 }
-void CMD_Dbmgr_WriteAccount::set_playername(const char* value, size_t size) {
+void CMD_Dbmgr_WriteAccount::set_playername(const char* value,
+    size_t size) {
   
-  playername_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
+  playername_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_pointer:CMD_Dbmgr_WriteAccount.playerName)
 }
 ::std::string* CMD_Dbmgr_WriteAccount::mutable_playername() {
   
   // @@protoc_insertion_point(field_mutable:CMD_Dbmgr_WriteAccount.playerName)
-  return playername_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return playername_.Mutable(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 ::std::string* CMD_Dbmgr_WriteAccount::release_playername() {
   // @@protoc_insertion_point(field_release:CMD_Dbmgr_WriteAccount.playerName)
   
-  return playername_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return playername_.Release(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
+}
+::std::string* CMD_Dbmgr_WriteAccount::unsafe_arena_release_playername() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:CMD_Dbmgr_WriteAccount.playerName)
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  
+  return playername_.UnsafeArenaRelease(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      GetArenaNoVirtual());
 }
 void CMD_Dbmgr_WriteAccount::set_allocated_playername(::std::string* playername) {
   if (playername != NULL) {
@@ -9509,9 +12264,22 @@ void CMD_Dbmgr_WriteAccount::set_allocated_playername(::std::string* playername)
   } else {
     
   }
-  playername_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), playername);
+  playername_.SetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), playername,
+      GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_allocated:CMD_Dbmgr_WriteAccount.playerName)
 }
+void CMD_Dbmgr_WriteAccount::unsafe_arena_set_allocated_playername(
+    ::std::string* playername) {
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  if (playername != NULL) {
+    
+  } else {
+    
+  }
+  playername_.UnsafeArenaSetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      playername, GetArenaNoVirtual());
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:CMD_Dbmgr_WriteAccount.playerName)
+}
 
 // int32 modelID = 6;
 void CMD_Dbmgr_WriteAccount::clear_modelid() {
@@ -9576,6 +12344,16 @@ CMD_Dbmgr_QueryAccount::CMD_Dbmgr_QueryAccount()
   SharedCtor();
   // @@protoc_insertion_point(constructor:CMD_Dbmgr_QueryAccount)
 }
+CMD_Dbmgr_QueryAccount::CMD_Dbmgr_QueryAccount(::google::protobuf::Arena* arena)
+  : ::google::protobuf::Message(),
+  _internal_metadata_(arena) {
+#ifdef GOOGLE_PROTOBUF_NO_STATIC_INITIALIZER
+  protobuf_Commands_2eproto::InitDefaults();
+#endif  // GOOGLE_PROTOBUF_NO_STATIC_INITIALIZER
+  SharedCtor();
+  RegisterArenaDtor(arena);
+  // @@protoc_insertion_point(arena_constructor:CMD_Dbmgr_QueryAccount)
+}
 CMD_Dbmgr_QueryAccount::CMD_Dbmgr_QueryAccount(const CMD_Dbmgr_QueryAccount& from)
   : ::google::protobuf::Message(),
       _internal_metadata_(NULL),
@@ -9583,15 +12361,18 @@ CMD_Dbmgr_QueryAccount::CMD_Dbmgr_QueryAccount(const CMD_Dbmgr_QueryAccount& fro
   _internal_metadata_.MergeFrom(from._internal_metadata_);
   commitaccountname_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
   if (from.commitaccountname().size() > 0) {
-    commitaccountname_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.commitaccountname_);
+    commitaccountname_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.commitaccountname(),
+      GetArenaNoVirtual());
   }
   password_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
   if (from.password().size() > 0) {
-    password_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.password_);
+    password_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.password(),
+      GetArenaNoVirtual());
   }
   datas_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
   if (from.datas().size() > 0) {
-    datas_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.datas_);
+    datas_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.datas(),
+      GetArenaNoVirtual());
   }
   ::memcpy(&queryappid_, &from.queryappid_,
     reinterpret_cast<char*>(&querytype_) -
@@ -9614,11 +12395,22 @@ CMD_Dbmgr_QueryAccount::~CMD_Dbmgr_QueryAccount() {
 }
 
 void CMD_Dbmgr_QueryAccount::SharedDtor() {
-  commitaccountname_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  password_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  datas_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  ::google::protobuf::Arena* arena = GetArenaNoVirtual();
+  if (arena != NULL) {
+    return;
+  }
+
+  commitaccountname_.Destroy(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), arena);
+  password_.Destroy(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), arena);
+  datas_.Destroy(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), arena);
 }
 
+void CMD_Dbmgr_QueryAccount::ArenaDtor(void* object) {
+  CMD_Dbmgr_QueryAccount* _this = reinterpret_cast< CMD_Dbmgr_QueryAccount* >(object);
+  (void)_this;
+}
+void CMD_Dbmgr_QueryAccount::RegisterArenaDtor(::google::protobuf::Arena* arena) {
+}
 void CMD_Dbmgr_QueryAccount::SetCachedSize(int size) const {
   GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
   _cached_size_ = size;
@@ -9626,7 +12418,7 @@ void CMD_Dbmgr_QueryAccount::SetCachedSize(int size) const {
 }
 const ::google::protobuf::Descriptor* CMD_Dbmgr_QueryAccount::descriptor() {
   protobuf_Commands_2eproto::protobuf_AssignDescriptorsOnce();
-  return protobuf_Commands_2eproto::file_level_metadata[20].descriptor;
+  return protobuf_Commands_2eproto::file_level_metadata[22].descriptor;
 }
 
 const CMD_Dbmgr_QueryAccount& CMD_Dbmgr_QueryAccount::default_instance() {
@@ -9635,18 +12427,14 @@ const CMD_Dbmgr_QueryAccount& CMD_Dbmgr_QueryAccount::default_instance() {
 }
 
 CMD_Dbmgr_QueryAccount* CMD_Dbmgr_QueryAccount::New(::google::protobuf::Arena* arena) const {
-  CMD_Dbmgr_QueryAccount* n = new CMD_Dbmgr_QueryAccount;
-  if (arena != NULL) {
-    arena->Own(n);
-  }
-  return n;
+  return ::google::protobuf::Arena::CreateMessage<CMD_Dbmgr_QueryAccount>(arena);
 }
 
 void CMD_Dbmgr_QueryAccount::Clear() {
 // @@protoc_insertion_point(message_clear_start:CMD_Dbmgr_QueryAccount)
-  commitaccountname_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  password_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  datas_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  commitaccountname_.ClearToEmpty(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
+  password_.ClearToEmpty(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
+  datas_.ClearToEmpty(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
   ::memset(&queryappid_, 0, reinterpret_cast<char*>(&querytype_) -
     reinterpret_cast<char*>(&queryappid_) + sizeof(querytype_));
 }
@@ -9946,16 +12734,13 @@ void CMD_Dbmgr_QueryAccount::MergeFrom(const CMD_Dbmgr_QueryAccount& from) {
   GOOGLE_DCHECK_NE(&from, this);
   _internal_metadata_.MergeFrom(from._internal_metadata_);
   if (from.commitaccountname().size() > 0) {
-
-    commitaccountname_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.commitaccountname_);
+    set_commitaccountname(from.commitaccountname());
   }
   if (from.password().size() > 0) {
-
-    password_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.password_);
+    set_password(from.password());
   }
   if (from.datas().size() > 0) {
-
-    datas_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.datas_);
+    set_datas(from.datas());
   }
   if (from.queryappid() != 0) {
     set_queryappid(from.queryappid());
@@ -9988,6 +12773,21 @@ bool CMD_Dbmgr_QueryAccount::IsInitialized() const {
 
 void CMD_Dbmgr_QueryAccount::Swap(CMD_Dbmgr_QueryAccount* other) {
   if (other == this) return;
+  if (GetArenaNoVirtual() == other->GetArenaNoVirtual()) {
+    InternalSwap(other);
+  } else {
+    CMD_Dbmgr_QueryAccount* temp = New(GetArenaNoVirtual());
+    temp->MergeFrom(*other);
+    other->CopyFrom(*this);
+    InternalSwap(temp);
+    if (GetArenaNoVirtual() == NULL) {
+      delete temp;
+    }
+  }
+}
+void CMD_Dbmgr_QueryAccount::UnsafeArenaSwap(CMD_Dbmgr_QueryAccount* other) {
+  if (other == this) return;
+  GOOGLE_DCHECK(GetArenaNoVirtual() == other->GetArenaNoVirtual());
   InternalSwap(other);
 }
 void CMD_Dbmgr_QueryAccount::InternalSwap(CMD_Dbmgr_QueryAccount* other) {
@@ -10002,7 +12802,7 @@ void CMD_Dbmgr_QueryAccount::InternalSwap(CMD_Dbmgr_QueryAccount* other) {
 
 ::google::protobuf::Metadata CMD_Dbmgr_QueryAccount::GetMetadata() const {
   protobuf_Commands_2eproto::protobuf_AssignDescriptorsOnce();
-  return protobuf_Commands_2eproto::file_level_metadata[20];
+  return protobuf_Commands_2eproto::file_level_metadata[22];
 }
 
 #if PROTOBUF_INLINE_NOT_IN_HEADERS
@@ -10010,45 +12810,46 @@ void CMD_Dbmgr_QueryAccount::InternalSwap(CMD_Dbmgr_QueryAccount* other) {
 
 // string commitAccountName = 1;
 void CMD_Dbmgr_QueryAccount::clear_commitaccountname() {
-  commitaccountname_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  commitaccountname_.ClearToEmpty(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 const ::std::string& CMD_Dbmgr_QueryAccount::commitaccountname() const {
   // @@protoc_insertion_point(field_get:CMD_Dbmgr_QueryAccount.commitAccountName)
-  return commitaccountname_.GetNoArena();
+  return commitaccountname_.Get();
 }
 void CMD_Dbmgr_QueryAccount::set_commitaccountname(const ::std::string& value) {
   
-  commitaccountname_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  commitaccountname_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value, GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set:CMD_Dbmgr_QueryAccount.commitAccountName)
 }
-#if LANG_CXX11
-void CMD_Dbmgr_QueryAccount::set_commitaccountname(::std::string&& value) {
-  
-  commitaccountname_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:CMD_Dbmgr_QueryAccount.commitAccountName)
-}
-#endif
 void CMD_Dbmgr_QueryAccount::set_commitaccountname(const char* value) {
   
-  commitaccountname_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  commitaccountname_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+              GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_char:CMD_Dbmgr_QueryAccount.commitAccountName)
 }
-void CMD_Dbmgr_QueryAccount::set_commitaccountname(const char* value, size_t size) {
+void CMD_Dbmgr_QueryAccount::set_commitaccountname(const char* value,
+    size_t size) {
   
-  commitaccountname_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
+  commitaccountname_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_pointer:CMD_Dbmgr_QueryAccount.commitAccountName)
 }
 ::std::string* CMD_Dbmgr_QueryAccount::mutable_commitaccountname() {
   
   // @@protoc_insertion_point(field_mutable:CMD_Dbmgr_QueryAccount.commitAccountName)
-  return commitaccountname_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return commitaccountname_.Mutable(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 ::std::string* CMD_Dbmgr_QueryAccount::release_commitaccountname() {
   // @@protoc_insertion_point(field_release:CMD_Dbmgr_QueryAccount.commitAccountName)
   
-  return commitaccountname_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return commitaccountname_.Release(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
+}
+::std::string* CMD_Dbmgr_QueryAccount::unsafe_arena_release_commitaccountname() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:CMD_Dbmgr_QueryAccount.commitAccountName)
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  
+  return commitaccountname_.UnsafeArenaRelease(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      GetArenaNoVirtual());
 }
 void CMD_Dbmgr_QueryAccount::set_allocated_commitaccountname(::std::string* commitaccountname) {
   if (commitaccountname != NULL) {
@@ -10056,51 +12857,65 @@ void CMD_Dbmgr_QueryAccount::set_allocated_commitaccountname(::std::string* comm
   } else {
     
   }
-  commitaccountname_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), commitaccountname);
+  commitaccountname_.SetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), commitaccountname,
+      GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_allocated:CMD_Dbmgr_QueryAccount.commitAccountName)
 }
+void CMD_Dbmgr_QueryAccount::unsafe_arena_set_allocated_commitaccountname(
+    ::std::string* commitaccountname) {
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  if (commitaccountname != NULL) {
+    
+  } else {
+    
+  }
+  commitaccountname_.UnsafeArenaSetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      commitaccountname, GetArenaNoVirtual());
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:CMD_Dbmgr_QueryAccount.commitAccountName)
+}
 
 // string password = 2;
 void CMD_Dbmgr_QueryAccount::clear_password() {
-  password_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  password_.ClearToEmpty(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 const ::std::string& CMD_Dbmgr_QueryAccount::password() const {
   // @@protoc_insertion_point(field_get:CMD_Dbmgr_QueryAccount.password)
-  return password_.GetNoArena();
+  return password_.Get();
 }
 void CMD_Dbmgr_QueryAccount::set_password(const ::std::string& value) {
   
-  password_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  password_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value, GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set:CMD_Dbmgr_QueryAccount.password)
 }
-#if LANG_CXX11
-void CMD_Dbmgr_QueryAccount::set_password(::std::string&& value) {
-  
-  password_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:CMD_Dbmgr_QueryAccount.password)
-}
-#endif
 void CMD_Dbmgr_QueryAccount::set_password(const char* value) {
   
-  password_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  password_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+              GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_char:CMD_Dbmgr_QueryAccount.password)
 }
-void CMD_Dbmgr_QueryAccount::set_password(const char* value, size_t size) {
+void CMD_Dbmgr_QueryAccount::set_password(const char* value,
+    size_t size) {
   
-  password_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
+  password_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_pointer:CMD_Dbmgr_QueryAccount.password)
 }
 ::std::string* CMD_Dbmgr_QueryAccount::mutable_password() {
   
   // @@protoc_insertion_point(field_mutable:CMD_Dbmgr_QueryAccount.password)
-  return password_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return password_.Mutable(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 ::std::string* CMD_Dbmgr_QueryAccount::release_password() {
   // @@protoc_insertion_point(field_release:CMD_Dbmgr_QueryAccount.password)
   
-  return password_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return password_.Release(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
+}
+::std::string* CMD_Dbmgr_QueryAccount::unsafe_arena_release_password() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:CMD_Dbmgr_QueryAccount.password)
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  
+  return password_.UnsafeArenaRelease(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      GetArenaNoVirtual());
 }
 void CMD_Dbmgr_QueryAccount::set_allocated_password(::std::string* password) {
   if (password != NULL) {
@@ -10108,9 +12923,22 @@ void CMD_Dbmgr_QueryAccount::set_allocated_password(::std::string* password) {
   } else {
     
   }
-  password_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), password);
+  password_.SetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), password,
+      GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_allocated:CMD_Dbmgr_QueryAccount.password)
 }
+void CMD_Dbmgr_QueryAccount::unsafe_arena_set_allocated_password(
+    ::std::string* password) {
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  if (password != NULL) {
+    
+  } else {
+    
+  }
+  password_.UnsafeArenaSetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      password, GetArenaNoVirtual());
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:CMD_Dbmgr_QueryAccount.password)
+}
 
 // uint64 queryAppID = 3;
 void CMD_Dbmgr_QueryAccount::clear_queryappid() {
@@ -10142,45 +12970,46 @@ void CMD_Dbmgr_QueryAccount::set_querytype(::google::protobuf::int32 value) {
 
 // string datas = 5;
 void CMD_Dbmgr_QueryAccount::clear_datas() {
-  datas_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  datas_.ClearToEmpty(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 const ::std::string& CMD_Dbmgr_QueryAccount::datas() const {
   // @@protoc_insertion_point(field_get:CMD_Dbmgr_QueryAccount.datas)
-  return datas_.GetNoArena();
+  return datas_.Get();
 }
 void CMD_Dbmgr_QueryAccount::set_datas(const ::std::string& value) {
   
-  datas_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  datas_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value, GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set:CMD_Dbmgr_QueryAccount.datas)
 }
-#if LANG_CXX11
-void CMD_Dbmgr_QueryAccount::set_datas(::std::string&& value) {
-  
-  datas_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:CMD_Dbmgr_QueryAccount.datas)
-}
-#endif
 void CMD_Dbmgr_QueryAccount::set_datas(const char* value) {
   
-  datas_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  datas_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+              GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_char:CMD_Dbmgr_QueryAccount.datas)
 }
-void CMD_Dbmgr_QueryAccount::set_datas(const char* value, size_t size) {
+void CMD_Dbmgr_QueryAccount::set_datas(const char* value,
+    size_t size) {
   
-  datas_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
+  datas_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_pointer:CMD_Dbmgr_QueryAccount.datas)
 }
 ::std::string* CMD_Dbmgr_QueryAccount::mutable_datas() {
   
   // @@protoc_insertion_point(field_mutable:CMD_Dbmgr_QueryAccount.datas)
-  return datas_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return datas_.Mutable(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 ::std::string* CMD_Dbmgr_QueryAccount::release_datas() {
   // @@protoc_insertion_point(field_release:CMD_Dbmgr_QueryAccount.datas)
   
-  return datas_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return datas_.Release(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
+}
+::std::string* CMD_Dbmgr_QueryAccount::unsafe_arena_release_datas() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:CMD_Dbmgr_QueryAccount.datas)
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  
+  return datas_.UnsafeArenaRelease(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      GetArenaNoVirtual());
 }
 void CMD_Dbmgr_QueryAccount::set_allocated_datas(::std::string* datas) {
   if (datas != NULL) {
@@ -10188,9 +13017,22 @@ void CMD_Dbmgr_QueryAccount::set_allocated_datas(::std::string* datas) {
   } else {
     
   }
-  datas_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), datas);
+  datas_.SetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), datas,
+      GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_allocated:CMD_Dbmgr_QueryAccount.datas)
 }
+void CMD_Dbmgr_QueryAccount::unsafe_arena_set_allocated_datas(
+    ::std::string* datas) {
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  if (datas != NULL) {
+    
+  } else {
+    
+  }
+  datas_.UnsafeArenaSetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      datas, GetArenaNoVirtual());
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:CMD_Dbmgr_QueryAccount.datas)
+}
 
 // uint64 accountID = 6;
 void CMD_Dbmgr_QueryAccount::clear_accountid() {
@@ -10226,6 +13068,16 @@ CMD_Dbmgr_UpdateAccountData::CMD_Dbmgr_UpdateAccountData()
   SharedCtor();
   // @@protoc_insertion_point(constructor:CMD_Dbmgr_UpdateAccountData)
 }
+CMD_Dbmgr_UpdateAccountData::CMD_Dbmgr_UpdateAccountData(::google::protobuf::Arena* arena)
+  : ::google::protobuf::Message(),
+  _internal_metadata_(arena) {
+#ifdef GOOGLE_PROTOBUF_NO_STATIC_INITIALIZER
+  protobuf_Commands_2eproto::InitDefaults();
+#endif  // GOOGLE_PROTOBUF_NO_STATIC_INITIALIZER
+  SharedCtor();
+  RegisterArenaDtor(arena);
+  // @@protoc_insertion_point(arena_constructor:CMD_Dbmgr_UpdateAccountData)
+}
 CMD_Dbmgr_UpdateAccountData::CMD_Dbmgr_UpdateAccountData(const CMD_Dbmgr_UpdateAccountData& from)
   : ::google::protobuf::Message(),
       _internal_metadata_(NULL),
@@ -10233,11 +13085,13 @@ CMD_Dbmgr_UpdateAccountData::CMD_Dbmgr_UpdateAccountData(const CMD_Dbmgr_UpdateA
   _internal_metadata_.MergeFrom(from._internal_metadata_);
   commitaccountname_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
   if (from.commitaccountname().size() > 0) {
-    commitaccountname_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.commitaccountname_);
+    commitaccountname_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.commitaccountname(),
+      GetArenaNoVirtual());
   }
   playername_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
   if (from.playername().size() > 0) {
-    playername_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.playername_);
+    playername_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.playername(),
+      GetArenaNoVirtual());
   }
   ::memcpy(&modelid_, &from.modelid_,
     reinterpret_cast<char*>(&gold_) -
@@ -10259,10 +13113,21 @@ CMD_Dbmgr_UpdateAccountData::~CMD_Dbmgr_UpdateAccountData() {
 }
 
 void CMD_Dbmgr_UpdateAccountData::SharedDtor() {
-  commitaccountname_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  playername_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  ::google::protobuf::Arena* arena = GetArenaNoVirtual();
+  if (arena != NULL) {
+    return;
+  }
+
+  commitaccountname_.Destroy(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), arena);
+  playername_.Destroy(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), arena);
 }
 
+void CMD_Dbmgr_UpdateAccountData::ArenaDtor(void* object) {
+  CMD_Dbmgr_UpdateAccountData* _this = reinterpret_cast< CMD_Dbmgr_UpdateAccountData* >(object);
+  (void)_this;
+}
+void CMD_Dbmgr_UpdateAccountData::RegisterArenaDtor(::google::protobuf::Arena* arena) {
+}
 void CMD_Dbmgr_UpdateAccountData::SetCachedSize(int size) const {
   GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
   _cached_size_ = size;
@@ -10270,7 +13135,7 @@ void CMD_Dbmgr_UpdateAccountData::SetCachedSize(int size) const {
 }
 const ::google::protobuf::Descriptor* CMD_Dbmgr_UpdateAccountData::descriptor() {
   protobuf_Commands_2eproto::protobuf_AssignDescriptorsOnce();
-  return protobuf_Commands_2eproto::file_level_metadata[21].descriptor;
+  return protobuf_Commands_2eproto::file_level_metadata[23].descriptor;
 }
 
 const CMD_Dbmgr_UpdateAccountData& CMD_Dbmgr_UpdateAccountData::default_instance() {
@@ -10279,17 +13144,13 @@ const CMD_Dbmgr_UpdateAccountData& CMD_Dbmgr_UpdateAccountData::default_instance
 }
 
 CMD_Dbmgr_UpdateAccountData* CMD_Dbmgr_UpdateAccountData::New(::google::protobuf::Arena* arena) const {
-  CMD_Dbmgr_UpdateAccountData* n = new CMD_Dbmgr_UpdateAccountData;
-  if (arena != NULL) {
-    arena->Own(n);
-  }
-  return n;
+  return ::google::protobuf::Arena::CreateMessage<CMD_Dbmgr_UpdateAccountData>(arena);
 }
 
 void CMD_Dbmgr_UpdateAccountData::Clear() {
 // @@protoc_insertion_point(message_clear_start:CMD_Dbmgr_UpdateAccountData)
-  commitaccountname_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  playername_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  commitaccountname_.ClearToEmpty(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
+  playername_.ClearToEmpty(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
   ::memset(&modelid_, 0, reinterpret_cast<char*>(&gold_) -
     reinterpret_cast<char*>(&modelid_) + sizeof(gold_));
 }
@@ -10546,12 +13407,10 @@ void CMD_Dbmgr_UpdateAccountData::MergeFrom(const CMD_Dbmgr_UpdateAccountData& f
   GOOGLE_DCHECK_NE(&from, this);
   _internal_metadata_.MergeFrom(from._internal_metadata_);
   if (from.commitaccountname().size() > 0) {
-
-    commitaccountname_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.commitaccountname_);
+    set_commitaccountname(from.commitaccountname());
   }
   if (from.playername().size() > 0) {
-
-    playername_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.playername_);
+    set_playername(from.playername());
   }
   if (from.modelid() != 0) {
     set_modelid(from.modelid());
@@ -10584,6 +13443,21 @@ bool CMD_Dbmgr_UpdateAccountData::IsInitialized() const {
 
 void CMD_Dbmgr_UpdateAccountData::Swap(CMD_Dbmgr_UpdateAccountData* other) {
   if (other == this) return;
+  if (GetArenaNoVirtual() == other->GetArenaNoVirtual()) {
+    InternalSwap(other);
+  } else {
+    CMD_Dbmgr_UpdateAccountData* temp = New(GetArenaNoVirtual());
+    temp->MergeFrom(*other);
+    other->CopyFrom(*this);
+    InternalSwap(temp);
+    if (GetArenaNoVirtual() == NULL) {
+      delete temp;
+    }
+  }
+}
+void CMD_Dbmgr_UpdateAccountData::UnsafeArenaSwap(CMD_Dbmgr_UpdateAccountData* other) {
+  if (other == this) return;
+  GOOGLE_DCHECK(GetArenaNoVirtual() == other->GetArenaNoVirtual());
   InternalSwap(other);
 }
 void CMD_Dbmgr_UpdateAccountData::InternalSwap(CMD_Dbmgr_UpdateAccountData* other) {
@@ -10597,7 +13471,7 @@ void CMD_Dbmgr_UpdateAccountData::InternalSwap(CMD_Dbmgr_UpdateAccountData* othe
 
 ::google::protobuf::Metadata CMD_Dbmgr_UpdateAccountData::GetMetadata() const {
   protobuf_Commands_2eproto::protobuf_AssignDescriptorsOnce();
-  return protobuf_Commands_2eproto::file_level_metadata[21];
+  return protobuf_Commands_2eproto::file_level_metadata[23];
 }
 
 #if PROTOBUF_INLINE_NOT_IN_HEADERS
@@ -10605,45 +13479,46 @@ void CMD_Dbmgr_UpdateAccountData::InternalSwap(CMD_Dbmgr_UpdateAccountData* othe
 
 // string commitAccountName = 1;
 void CMD_Dbmgr_UpdateAccountData::clear_commitaccountname() {
-  commitaccountname_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  commitaccountname_.ClearToEmpty(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 const ::std::string& CMD_Dbmgr_UpdateAccountData::commitaccountname() const {
   // @@protoc_insertion_point(field_get:CMD_Dbmgr_UpdateAccountData.commitAccountName)
-  return commitaccountname_.GetNoArena();
+  return commitaccountname_.Get();
 }
 void CMD_Dbmgr_UpdateAccountData::set_commitaccountname(const ::std::string& value) {
   
-  commitaccountname_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  commitaccountname_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value, GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set:CMD_Dbmgr_UpdateAccountData.commitAccountName)
 }
-#if LANG_CXX11
-void CMD_Dbmgr_UpdateAccountData::set_commitaccountname(::std::string&& value) {
-  
-  commitaccountname_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:CMD_Dbmgr_UpdateAccountData.commitAccountName)
-}
-#endif
 void CMD_Dbmgr_UpdateAccountData::set_commitaccountname(const char* value) {
   
-  commitaccountname_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  commitaccountname_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+              GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_char:CMD_Dbmgr_UpdateAccountData.commitAccountName)
 }
-void CMD_Dbmgr_UpdateAccountData::set_commitaccountname(const char* value, size_t size) {
+void CMD_Dbmgr_UpdateAccountData::set_commitaccountname(const char* value,
+    size_t size) {
   
-  commitaccountname_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
+  commitaccountname_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_pointer:CMD_Dbmgr_UpdateAccountData.commitAccountName)
 }
 ::std::string* CMD_Dbmgr_UpdateAccountData::mutable_commitaccountname() {
   
   // @@protoc_insertion_point(field_mutable:CMD_Dbmgr_UpdateAccountData.commitAccountName)
-  return commitaccountname_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return commitaccountname_.Mutable(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 ::std::string* CMD_Dbmgr_UpdateAccountData::release_commitaccountname() {
   // @@protoc_insertion_point(field_release:CMD_Dbmgr_UpdateAccountData.commitAccountName)
   
-  return commitaccountname_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return commitaccountname_.Release(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
+}
+::std::string* CMD_Dbmgr_UpdateAccountData::unsafe_arena_release_commitaccountname() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:CMD_Dbmgr_UpdateAccountData.commitAccountName)
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  
+  return commitaccountname_.UnsafeArenaRelease(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      GetArenaNoVirtual());
 }
 void CMD_Dbmgr_UpdateAccountData::set_allocated_commitaccountname(::std::string* commitaccountname) {
   if (commitaccountname != NULL) {
@@ -10651,51 +13526,65 @@ void CMD_Dbmgr_UpdateAccountData::set_allocated_commitaccountname(::std::string*
   } else {
     
   }
-  commitaccountname_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), commitaccountname);
+  commitaccountname_.SetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), commitaccountname,
+      GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_allocated:CMD_Dbmgr_UpdateAccountData.commitAccountName)
 }
+void CMD_Dbmgr_UpdateAccountData::unsafe_arena_set_allocated_commitaccountname(
+    ::std::string* commitaccountname) {
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  if (commitaccountname != NULL) {
+    
+  } else {
+    
+  }
+  commitaccountname_.UnsafeArenaSetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      commitaccountname, GetArenaNoVirtual());
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:CMD_Dbmgr_UpdateAccountData.commitAccountName)
+}
 
 // string playerName = 2;
 void CMD_Dbmgr_UpdateAccountData::clear_playername() {
-  playername_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  playername_.ClearToEmpty(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 const ::std::string& CMD_Dbmgr_UpdateAccountData::playername() const {
   // @@protoc_insertion_point(field_get:CMD_Dbmgr_UpdateAccountData.playerName)
-  return playername_.GetNoArena();
+  return playername_.Get();
 }
 void CMD_Dbmgr_UpdateAccountData::set_playername(const ::std::string& value) {
   
-  playername_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  playername_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value, GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set:CMD_Dbmgr_UpdateAccountData.playerName)
 }
-#if LANG_CXX11
-void CMD_Dbmgr_UpdateAccountData::set_playername(::std::string&& value) {
-  
-  playername_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:CMD_Dbmgr_UpdateAccountData.playerName)
-}
-#endif
 void CMD_Dbmgr_UpdateAccountData::set_playername(const char* value) {
   
-  playername_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  playername_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+              GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_char:CMD_Dbmgr_UpdateAccountData.playerName)
 }
-void CMD_Dbmgr_UpdateAccountData::set_playername(const char* value, size_t size) {
+void CMD_Dbmgr_UpdateAccountData::set_playername(const char* value,
+    size_t size) {
   
-  playername_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
+  playername_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_pointer:CMD_Dbmgr_UpdateAccountData.playerName)
 }
 ::std::string* CMD_Dbmgr_UpdateAccountData::mutable_playername() {
   
   // @@protoc_insertion_point(field_mutable:CMD_Dbmgr_UpdateAccountData.playerName)
-  return playername_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return playername_.Mutable(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 ::std::string* CMD_Dbmgr_UpdateAccountData::release_playername() {
   // @@protoc_insertion_point(field_release:CMD_Dbmgr_UpdateAccountData.playerName)
   
-  return playername_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return playername_.Release(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
+}
+::std::string* CMD_Dbmgr_UpdateAccountData::unsafe_arena_release_playername() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:CMD_Dbmgr_UpdateAccountData.playerName)
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  
+  return playername_.UnsafeArenaRelease(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      GetArenaNoVirtual());
 }
 void CMD_Dbmgr_UpdateAccountData::set_allocated_playername(::std::string* playername) {
   if (playername != NULL) {
@@ -10703,9 +13592,22 @@ void CMD_Dbmgr_UpdateAccountData::set_allocated_playername(::std::string* player
   } else {
     
   }
-  playername_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), playername);
+  playername_.SetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), playername,
+      GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_allocated:CMD_Dbmgr_UpdateAccountData.playerName)
 }
+void CMD_Dbmgr_UpdateAccountData::unsafe_arena_set_allocated_playername(
+    ::std::string* playername) {
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  if (playername != NULL) {
+    
+  } else {
+    
+  }
+  playername_.UnsafeArenaSetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      playername, GetArenaNoVirtual());
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:CMD_Dbmgr_UpdateAccountData.playerName)
+}
 
 // int32 modelID = 3;
 void CMD_Dbmgr_UpdateAccountData::clear_modelid() {
@@ -10771,6 +13673,16 @@ CMD_Dbmgr_WritePlayerGameData::CMD_Dbmgr_WritePlayerGameData()
   SharedCtor();
   // @@protoc_insertion_point(constructor:CMD_Dbmgr_WritePlayerGameData)
 }
+CMD_Dbmgr_WritePlayerGameData::CMD_Dbmgr_WritePlayerGameData(::google::protobuf::Arena* arena)
+  : ::google::protobuf::Message(),
+  _internal_metadata_(arena) {
+#ifdef GOOGLE_PROTOBUF_NO_STATIC_INITIALIZER
+  protobuf_Commands_2eproto::InitDefaults();
+#endif  // GOOGLE_PROTOBUF_NO_STATIC_INITIALIZER
+  SharedCtor();
+  RegisterArenaDtor(arena);
+  // @@protoc_insertion_point(arena_constructor:CMD_Dbmgr_WritePlayerGameData)
+}
 CMD_Dbmgr_WritePlayerGameData::CMD_Dbmgr_WritePlayerGameData(const CMD_Dbmgr_WritePlayerGameData& from)
   : ::google::protobuf::Message(),
       _internal_metadata_(NULL),
@@ -10794,8 +13706,19 @@ CMD_Dbmgr_WritePlayerGameData::~CMD_Dbmgr_WritePlayerGameData() {
 }
 
 void CMD_Dbmgr_WritePlayerGameData::SharedDtor() {
+  ::google::protobuf::Arena* arena = GetArenaNoVirtual();
+  if (arena != NULL) {
+    return;
+  }
+
 }
 
+void CMD_Dbmgr_WritePlayerGameData::ArenaDtor(void* object) {
+  CMD_Dbmgr_WritePlayerGameData* _this = reinterpret_cast< CMD_Dbmgr_WritePlayerGameData* >(object);
+  (void)_this;
+}
+void CMD_Dbmgr_WritePlayerGameData::RegisterArenaDtor(::google::protobuf::Arena* arena) {
+}
 void CMD_Dbmgr_WritePlayerGameData::SetCachedSize(int size) const {
   GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
   _cached_size_ = size;
@@ -10803,7 +13726,7 @@ void CMD_Dbmgr_WritePlayerGameData::SetCachedSize(int size) const {
 }
 const ::google::protobuf::Descriptor* CMD_Dbmgr_WritePlayerGameData::descriptor() {
   protobuf_Commands_2eproto::protobuf_AssignDescriptorsOnce();
-  return protobuf_Commands_2eproto::file_level_metadata[22].descriptor;
+  return protobuf_Commands_2eproto::file_level_metadata[24].descriptor;
 }
 
 const CMD_Dbmgr_WritePlayerGameData& CMD_Dbmgr_WritePlayerGameData::default_instance() {
@@ -10812,11 +13735,7 @@ const CMD_Dbmgr_WritePlayerGameData& CMD_Dbmgr_WritePlayerGameData::default_inst
 }
 
 CMD_Dbmgr_WritePlayerGameData* CMD_Dbmgr_WritePlayerGameData::New(::google::protobuf::Arena* arena) const {
-  CMD_Dbmgr_WritePlayerGameData* n = new CMD_Dbmgr_WritePlayerGameData;
-  if (arena != NULL) {
-    arena->Own(n);
-  }
-  return n;
+  return ::google::protobuf::Arena::CreateMessage<CMD_Dbmgr_WritePlayerGameData>(arena);
 }
 
 void CMD_Dbmgr_WritePlayerGameData::Clear() {
@@ -11150,9 +14069,24 @@ void CMD_Dbmgr_WritePlayerGameData::CopyFrom(const CMD_Dbmgr_WritePlayerGameData
 bool CMD_Dbmgr_WritePlayerGameData::IsInitialized() const {
   return true;
 }
-
-void CMD_Dbmgr_WritePlayerGameData::Swap(CMD_Dbmgr_WritePlayerGameData* other) {
+
+void CMD_Dbmgr_WritePlayerGameData::Swap(CMD_Dbmgr_WritePlayerGameData* other) {
+  if (other == this) return;
+  if (GetArenaNoVirtual() == other->GetArenaNoVirtual()) {
+    InternalSwap(other);
+  } else {
+    CMD_Dbmgr_WritePlayerGameData* temp = New(GetArenaNoVirtual());
+    temp->MergeFrom(*other);
+    other->CopyFrom(*this);
+    InternalSwap(temp);
+    if (GetArenaNoVirtual() == NULL) {
+      delete temp;
+    }
+  }
+}
+void CMD_Dbmgr_WritePlayerGameData::UnsafeArenaSwap(CMD_Dbmgr_WritePlayerGameData* other) {
   if (other == this) return;
+  GOOGLE_DCHECK(GetArenaNoVirtual() == other->GetArenaNoVirtual());
   InternalSwap(other);
 }
 void CMD_Dbmgr_WritePlayerGameData::InternalSwap(CMD_Dbmgr_WritePlayerGameData* other) {
@@ -11168,7 +14102,7 @@ void CMD_Dbmgr_WritePlayerGameData::InternalSwap(CMD_Dbmgr_WritePlayerGameData*
 
 ::google::protobuf::Metadata CMD_Dbmgr_WritePlayerGameData::GetMetadata() const {
   protobuf_Commands_2eproto::protobuf_AssignDescriptorsOnce();
-  return protobuf_Commands_2eproto::file_level_metadata[22];
+  return protobuf_Commands_2eproto::file_level_metadata[24];
 }
 
 #if PROTOBUF_INLINE_NOT_IN_HEADERS
@@ -11290,6 +14224,16 @@ CMD_Dbmgr_QueryPlayerGameData::CMD_Dbmgr_QueryPlayerGameData()
   SharedCtor();
   // @@protoc_insertion_point(constructor:CMD_Dbmgr_QueryPlayerGameData)
 }
+CMD_Dbmgr_QueryPlayerGameData::CMD_Dbmgr_QueryPlayerGameData(::google::protobuf::Arena* arena)
+  : ::google::protobuf::Message(),
+  _internal_metadata_(arena) {
+#ifdef GOOGLE_PROTOBUF_NO_STATIC_INITIALIZER
+  protobuf_Commands_2eproto::InitDefaults();
+#endif  // GOOGLE_PROTOBUF_NO_STATIC_INITIALIZER
+  SharedCtor();
+  RegisterArenaDtor(arena);
+  // @@protoc_insertion_point(arena_constructor:CMD_Dbmgr_QueryPlayerGameData)
+}
 CMD_Dbmgr_QueryPlayerGameData::CMD_Dbmgr_QueryPlayerGameData(const CMD_Dbmgr_QueryPlayerGameData& from)
   : ::google::protobuf::Message(),
       _internal_metadata_(NULL),
@@ -11313,8 +14257,19 @@ CMD_Dbmgr_QueryPlayerGameData::~CMD_Dbmgr_QueryPlayerGameData() {
 }
 
 void CMD_Dbmgr_QueryPlayerGameData::SharedDtor() {
+  ::google::protobuf::Arena* arena = GetArenaNoVirtual();
+  if (arena != NULL) {
+    return;
+  }
+
 }
 
+void CMD_Dbmgr_QueryPlayerGameData::ArenaDtor(void* object) {
+  CMD_Dbmgr_QueryPlayerGameData* _this = reinterpret_cast< CMD_Dbmgr_QueryPlayerGameData* >(object);
+  (void)_this;
+}
+void CMD_Dbmgr_QueryPlayerGameData::RegisterArenaDtor(::google::protobuf::Arena* arena) {
+}
 void CMD_Dbmgr_QueryPlayerGameData::SetCachedSize(int size) const {
   GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
   _cached_size_ = size;
@@ -11322,7 +14277,7 @@ void CMD_Dbmgr_QueryPlayerGameData::SetCachedSize(int size) const {
 }
 const ::google::protobuf::Descriptor* CMD_Dbmgr_QueryPlayerGameData::descriptor() {
   protobuf_Commands_2eproto::protobuf_AssignDescriptorsOnce();
-  return protobuf_Commands_2eproto::file_level_metadata[23].descriptor;
+  return protobuf_Commands_2eproto::file_level_metadata[25].descriptor;
 }
 
 const CMD_Dbmgr_QueryPlayerGameData& CMD_Dbmgr_QueryPlayerGameData::default_instance() {
@@ -11331,11 +14286,7 @@ const CMD_Dbmgr_QueryPlayerGameData& CMD_Dbmgr_QueryPlayerGameData::default_inst
 }
 
 CMD_Dbmgr_QueryPlayerGameData* CMD_Dbmgr_QueryPlayerGameData::New(::google::protobuf::Arena* arena) const {
-  CMD_Dbmgr_QueryPlayerGameData* n = new CMD_Dbmgr_QueryPlayerGameData;
-  if (arena != NULL) {
-    arena->Own(n);
-  }
-  return n;
+  return ::google::protobuf::Arena::CreateMessage<CMD_Dbmgr_QueryPlayerGameData>(arena);
 }
 
 void CMD_Dbmgr_QueryPlayerGameData::Clear() {
@@ -11540,6 +14491,21 @@ bool CMD_Dbmgr_QueryPlayerGameData::IsInitialized() const {
 
 void CMD_Dbmgr_QueryPlayerGameData::Swap(CMD_Dbmgr_QueryPlayerGameData* other) {
   if (other == this) return;
+  if (GetArenaNoVirtual() == other->GetArenaNoVirtual()) {
+    InternalSwap(other);
+  } else {
+    CMD_Dbmgr_QueryPlayerGameData* temp = New(GetArenaNoVirtual());
+    temp->MergeFrom(*other);
+    other->CopyFrom(*this);
+    InternalSwap(temp);
+    if (GetArenaNoVirtual() == NULL) {
+      delete temp;
+    }
+  }
+}
+void CMD_Dbmgr_QueryPlayerGameData::UnsafeArenaSwap(CMD_Dbmgr_QueryPlayerGameData* other) {
+  if (other == this) return;
+  GOOGLE_DCHECK(GetArenaNoVirtual() == other->GetArenaNoVirtual());
   InternalSwap(other);
 }
 void CMD_Dbmgr_QueryPlayerGameData::InternalSwap(CMD_Dbmgr_QueryPlayerGameData* other) {
@@ -11551,7 +14517,7 @@ void CMD_Dbmgr_QueryPlayerGameData::InternalSwap(CMD_Dbmgr_QueryPlayerGameData*
 
 ::google::protobuf::Metadata CMD_Dbmgr_QueryPlayerGameData::GetMetadata() const {
   protobuf_Commands_2eproto::protobuf_AssignDescriptorsOnce();
-  return protobuf_Commands_2eproto::file_level_metadata[23];
+  return protobuf_Commands_2eproto::file_level_metadata[25];
 }
 
 #if PROTOBUF_INLINE_NOT_IN_HEADERS
@@ -11618,6 +14584,16 @@ CMD_Halls_PlayerGameData::CMD_Halls_PlayerGameData()
   SharedCtor();
   // @@protoc_insertion_point(constructor:CMD_Halls_PlayerGameData)
 }
+CMD_Halls_PlayerGameData::CMD_Halls_PlayerGameData(::google::protobuf::Arena* arena)
+  : ::google::protobuf::Message(),
+  _internal_metadata_(arena) {
+#ifdef GOOGLE_PROTOBUF_NO_STATIC_INITIALIZER
+  protobuf_Commands_2eproto::InitDefaults();
+#endif  // GOOGLE_PROTOBUF_NO_STATIC_INITIALIZER
+  SharedCtor();
+  RegisterArenaDtor(arena);
+  // @@protoc_insertion_point(arena_constructor:CMD_Halls_PlayerGameData)
+}
 CMD_Halls_PlayerGameData::CMD_Halls_PlayerGameData(const CMD_Halls_PlayerGameData& from)
   : ::google::protobuf::Message(),
       _internal_metadata_(NULL),
@@ -11641,8 +14617,19 @@ CMD_Halls_PlayerGameData::~CMD_Halls_PlayerGameData() {
 }
 
 void CMD_Halls_PlayerGameData::SharedDtor() {
+  ::google::protobuf::Arena* arena = GetArenaNoVirtual();
+  if (arena != NULL) {
+    return;
+  }
+
 }
 
+void CMD_Halls_PlayerGameData::ArenaDtor(void* object) {
+  CMD_Halls_PlayerGameData* _this = reinterpret_cast< CMD_Halls_PlayerGameData* >(object);
+  (void)_this;
+}
+void CMD_Halls_PlayerGameData::RegisterArenaDtor(::google::protobuf::Arena* arena) {
+}
 void CMD_Halls_PlayerGameData::SetCachedSize(int size) const {
   GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
   _cached_size_ = size;
@@ -11650,7 +14637,7 @@ void CMD_Halls_PlayerGameData::SetCachedSize(int size) const {
 }
 const ::google::protobuf::Descriptor* CMD_Halls_PlayerGameData::descriptor() {
   protobuf_Commands_2eproto::protobuf_AssignDescriptorsOnce();
-  return protobuf_Commands_2eproto::file_level_metadata[24].descriptor;
+  return protobuf_Commands_2eproto::file_level_metadata[26].descriptor;
 }
 
 const CMD_Halls_PlayerGameData& CMD_Halls_PlayerGameData::default_instance() {
@@ -11659,11 +14646,7 @@ const CMD_Halls_PlayerGameData& CMD_Halls_PlayerGameData::default_instance() {
 }
 
 CMD_Halls_PlayerGameData* CMD_Halls_PlayerGameData::New(::google::protobuf::Arena* arena) const {
-  CMD_Halls_PlayerGameData* n = new CMD_Halls_PlayerGameData;
-  if (arena != NULL) {
-    arena->Own(n);
-  }
-  return n;
+  return ::google::protobuf::Arena::CreateMessage<CMD_Halls_PlayerGameData>(arena);
 }
 
 void CMD_Halls_PlayerGameData::Clear() {
@@ -11899,6 +14882,21 @@ bool CMD_Halls_PlayerGameData::IsInitialized() const {
 
 void CMD_Halls_PlayerGameData::Swap(CMD_Halls_PlayerGameData* other) {
   if (other == this) return;
+  if (GetArenaNoVirtual() == other->GetArenaNoVirtual()) {
+    InternalSwap(other);
+  } else {
+    CMD_Halls_PlayerGameData* temp = New(GetArenaNoVirtual());
+    temp->MergeFrom(*other);
+    other->CopyFrom(*this);
+    InternalSwap(temp);
+    if (GetArenaNoVirtual() == NULL) {
+      delete temp;
+    }
+  }
+}
+void CMD_Halls_PlayerGameData::UnsafeArenaSwap(CMD_Halls_PlayerGameData* other) {
+  if (other == this) return;
+  GOOGLE_DCHECK(GetArenaNoVirtual() == other->GetArenaNoVirtual());
   InternalSwap(other);
 }
 void CMD_Halls_PlayerGameData::InternalSwap(CMD_Halls_PlayerGameData* other) {
@@ -11911,7 +14909,7 @@ void CMD_Halls_PlayerGameData::InternalSwap(CMD_Halls_PlayerGameData* other) {
 
 ::google::protobuf::Metadata CMD_Halls_PlayerGameData::GetMetadata() const {
   protobuf_Commands_2eproto::protobuf_AssignDescriptorsOnce();
-  return protobuf_Commands_2eproto::file_level_metadata[24];
+  return protobuf_Commands_2eproto::file_level_metadata[26];
 }
 
 #if PROTOBUF_INLINE_NOT_IN_HEADERS
@@ -11992,6 +14990,16 @@ CMD_Halls_Login::CMD_Halls_Login()
   SharedCtor();
   // @@protoc_insertion_point(constructor:CMD_Halls_Login)
 }
+CMD_Halls_Login::CMD_Halls_Login(::google::protobuf::Arena* arena)
+  : ::google::protobuf::Message(),
+  _internal_metadata_(arena) {
+#ifdef GOOGLE_PROTOBUF_NO_STATIC_INITIALIZER
+  protobuf_Commands_2eproto::InitDefaults();
+#endif  // GOOGLE_PROTOBUF_NO_STATIC_INITIALIZER
+  SharedCtor();
+  RegisterArenaDtor(arena);
+  // @@protoc_insertion_point(arena_constructor:CMD_Halls_Login)
+}
 CMD_Halls_Login::CMD_Halls_Login(const CMD_Halls_Login& from)
   : ::google::protobuf::Message(),
       _internal_metadata_(NULL),
@@ -11999,7 +15007,8 @@ CMD_Halls_Login::CMD_Halls_Login(const CMD_Halls_Login& from)
   _internal_metadata_.MergeFrom(from._internal_metadata_);
   commitaccountname_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
   if (from.commitaccountname().size() > 0) {
-    commitaccountname_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.commitaccountname_);
+    commitaccountname_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.commitaccountname(),
+      GetArenaNoVirtual());
   }
   ::memcpy(&tokenid_, &from.tokenid_,
     reinterpret_cast<char*>(&playerid_) -
@@ -12020,9 +15029,20 @@ CMD_Halls_Login::~CMD_Halls_Login() {
 }
 
 void CMD_Halls_Login::SharedDtor() {
-  commitaccountname_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  ::google::protobuf::Arena* arena = GetArenaNoVirtual();
+  if (arena != NULL) {
+    return;
+  }
+
+  commitaccountname_.Destroy(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), arena);
 }
 
+void CMD_Halls_Login::ArenaDtor(void* object) {
+  CMD_Halls_Login* _this = reinterpret_cast< CMD_Halls_Login* >(object);
+  (void)_this;
+}
+void CMD_Halls_Login::RegisterArenaDtor(::google::protobuf::Arena* arena) {
+}
 void CMD_Halls_Login::SetCachedSize(int size) const {
   GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
   _cached_size_ = size;
@@ -12030,7 +15050,7 @@ void CMD_Halls_Login::SetCachedSize(int size) const {
 }
 const ::google::protobuf::Descriptor* CMD_Halls_Login::descriptor() {
   protobuf_Commands_2eproto::protobuf_AssignDescriptorsOnce();
-  return protobuf_Commands_2eproto::file_level_metadata[25].descriptor;
+  return protobuf_Commands_2eproto::file_level_metadata[27].descriptor;
 }
 
 const CMD_Halls_Login& CMD_Halls_Login::default_instance() {
@@ -12039,16 +15059,12 @@ const CMD_Halls_Login& CMD_Halls_Login::default_instance() {
 }
 
 CMD_Halls_Login* CMD_Halls_Login::New(::google::protobuf::Arena* arena) const {
-  CMD_Halls_Login* n = new CMD_Halls_Login;
-  if (arena != NULL) {
-    arena->Own(n);
-  }
-  return n;
+  return ::google::protobuf::Arena::CreateMessage<CMD_Halls_Login>(arena);
 }
 
 void CMD_Halls_Login::Clear() {
 // @@protoc_insertion_point(message_clear_start:CMD_Halls_Login)
-  commitaccountname_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  commitaccountname_.ClearToEmpty(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
   ::memset(&tokenid_, 0, reinterpret_cast<char*>(&playerid_) -
     reinterpret_cast<char*>(&tokenid_) + sizeof(playerid_));
 }
@@ -12262,8 +15278,7 @@ void CMD_Halls_Login::MergeFrom(const CMD_Halls_Login& from) {
   GOOGLE_DCHECK_NE(&from, this);
   _internal_metadata_.MergeFrom(from._internal_metadata_);
   if (from.commitaccountname().size() > 0) {
-
-    commitaccountname_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.commitaccountname_);
+    set_commitaccountname(from.commitaccountname());
   }
   if (from.tokenid() != 0) {
     set_tokenid(from.tokenid());
@@ -12296,6 +15311,21 @@ bool CMD_Halls_Login::IsInitialized() const {
 
 void CMD_Halls_Login::Swap(CMD_Halls_Login* other) {
   if (other == this) return;
+  if (GetArenaNoVirtual() == other->GetArenaNoVirtual()) {
+    InternalSwap(other);
+  } else {
+    CMD_Halls_Login* temp = New(GetArenaNoVirtual());
+    temp->MergeFrom(*other);
+    other->CopyFrom(*this);
+    InternalSwap(temp);
+    if (GetArenaNoVirtual() == NULL) {
+      delete temp;
+    }
+  }
+}
+void CMD_Halls_Login::UnsafeArenaSwap(CMD_Halls_Login* other) {
+  if (other == this) return;
+  GOOGLE_DCHECK(GetArenaNoVirtual() == other->GetArenaNoVirtual());
   InternalSwap(other);
 }
 void CMD_Halls_Login::InternalSwap(CMD_Halls_Login* other) {
@@ -12308,7 +15338,7 @@ void CMD_Halls_Login::InternalSwap(CMD_Halls_Login* other) {
 
 ::google::protobuf::Metadata CMD_Halls_Login::GetMetadata() const {
   protobuf_Commands_2eproto::protobuf_AssignDescriptorsOnce();
-  return protobuf_Commands_2eproto::file_level_metadata[25];
+  return protobuf_Commands_2eproto::file_level_metadata[27];
 }
 
 #if PROTOBUF_INLINE_NOT_IN_HEADERS
@@ -12330,45 +15360,46 @@ void CMD_Halls_Login::set_tokenid(::google::protobuf::uint64 value) {
 
 // string commitAccountName = 2;
 void CMD_Halls_Login::clear_commitaccountname() {
-  commitaccountname_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  commitaccountname_.ClearToEmpty(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 const ::std::string& CMD_Halls_Login::commitaccountname() const {
   // @@protoc_insertion_point(field_get:CMD_Halls_Login.commitAccountName)
-  return commitaccountname_.GetNoArena();
+  return commitaccountname_.Get();
 }
 void CMD_Halls_Login::set_commitaccountname(const ::std::string& value) {
   
-  commitaccountname_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  commitaccountname_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value, GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set:CMD_Halls_Login.commitAccountName)
 }
-#if LANG_CXX11
-void CMD_Halls_Login::set_commitaccountname(::std::string&& value) {
-  
-  commitaccountname_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:CMD_Halls_Login.commitAccountName)
-}
-#endif
 void CMD_Halls_Login::set_commitaccountname(const char* value) {
   
-  commitaccountname_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  commitaccountname_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+              GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_char:CMD_Halls_Login.commitAccountName)
 }
-void CMD_Halls_Login::set_commitaccountname(const char* value, size_t size) {
+void CMD_Halls_Login::set_commitaccountname(const char* value,
+    size_t size) {
   
-  commitaccountname_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
+  commitaccountname_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_pointer:CMD_Halls_Login.commitAccountName)
 }
 ::std::string* CMD_Halls_Login::mutable_commitaccountname() {
   
   // @@protoc_insertion_point(field_mutable:CMD_Halls_Login.commitAccountName)
-  return commitaccountname_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return commitaccountname_.Mutable(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 ::std::string* CMD_Halls_Login::release_commitaccountname() {
   // @@protoc_insertion_point(field_release:CMD_Halls_Login.commitAccountName)
   
-  return commitaccountname_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return commitaccountname_.Release(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
+}
+::std::string* CMD_Halls_Login::unsafe_arena_release_commitaccountname() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:CMD_Halls_Login.commitAccountName)
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  
+  return commitaccountname_.UnsafeArenaRelease(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      GetArenaNoVirtual());
 }
 void CMD_Halls_Login::set_allocated_commitaccountname(::std::string* commitaccountname) {
   if (commitaccountname != NULL) {
@@ -12376,9 +15407,22 @@ void CMD_Halls_Login::set_allocated_commitaccountname(::std::string* commitaccou
   } else {
     
   }
-  commitaccountname_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), commitaccountname);
+  commitaccountname_.SetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), commitaccountname,
+      GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_allocated:CMD_Halls_Login.commitAccountName)
 }
+void CMD_Halls_Login::unsafe_arena_set_allocated_commitaccountname(
+    ::std::string* commitaccountname) {
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  if (commitaccountname != NULL) {
+    
+  } else {
+    
+  }
+  commitaccountname_.UnsafeArenaSetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      commitaccountname, GetArenaNoVirtual());
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:CMD_Halls_Login.commitAccountName)
+}
 
 // uint64 hallsID = 3;
 void CMD_Halls_Login::clear_hallsid() {
@@ -12428,6 +15472,16 @@ CMD_Halls_RequestAllocClient::CMD_Halls_RequestAllocClient()
   SharedCtor();
   // @@protoc_insertion_point(constructor:CMD_Halls_RequestAllocClient)
 }
+CMD_Halls_RequestAllocClient::CMD_Halls_RequestAllocClient(::google::protobuf::Arena* arena)
+  : ::google::protobuf::Message(),
+  _internal_metadata_(arena) {
+#ifdef GOOGLE_PROTOBUF_NO_STATIC_INITIALIZER
+  protobuf_Commands_2eproto::InitDefaults();
+#endif  // GOOGLE_PROTOBUF_NO_STATIC_INITIALIZER
+  SharedCtor();
+  RegisterArenaDtor(arena);
+  // @@protoc_insertion_point(arena_constructor:CMD_Halls_RequestAllocClient)
+}
 CMD_Halls_RequestAllocClient::CMD_Halls_RequestAllocClient(const CMD_Halls_RequestAllocClient& from)
   : ::google::protobuf::Message(),
       _internal_metadata_(NULL),
@@ -12435,15 +15489,18 @@ CMD_Halls_RequestAllocClient::CMD_Halls_RequestAllocClient(const CMD_Halls_Reque
   _internal_metadata_.MergeFrom(from._internal_metadata_);
   commitaccountname_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
   if (from.commitaccountname().size() > 0) {
-    commitaccountname_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.commitaccountname_);
+    commitaccountname_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.commitaccountname(),
+      GetArenaNoVirtual());
   }
   password_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
   if (from.password().size() > 0) {
-    password_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.password_);
+    password_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.password(),
+      GetArenaNoVirtual());
   }
   datas_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
   if (from.datas().size() > 0) {
-    datas_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.datas_);
+    datas_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.datas(),
+      GetArenaNoVirtual());
   }
   ::memcpy(&foundobjectid_, &from.foundobjectid_,
     reinterpret_cast<char*>(&loginsessionid_) -
@@ -12466,11 +15523,22 @@ CMD_Halls_RequestAllocClient::~CMD_Halls_RequestAllocClient() {
 }
 
 void CMD_Halls_RequestAllocClient::SharedDtor() {
-  commitaccountname_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  password_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  datas_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  ::google::protobuf::Arena* arena = GetArenaNoVirtual();
+  if (arena != NULL) {
+    return;
+  }
+
+  commitaccountname_.Destroy(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), arena);
+  password_.Destroy(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), arena);
+  datas_.Destroy(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), arena);
 }
 
+void CMD_Halls_RequestAllocClient::ArenaDtor(void* object) {
+  CMD_Halls_RequestAllocClient* _this = reinterpret_cast< CMD_Halls_RequestAllocClient* >(object);
+  (void)_this;
+}
+void CMD_Halls_RequestAllocClient::RegisterArenaDtor(::google::protobuf::Arena* arena) {
+}
 void CMD_Halls_RequestAllocClient::SetCachedSize(int size) const {
   GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
   _cached_size_ = size;
@@ -12478,7 +15546,7 @@ void CMD_Halls_RequestAllocClient::SetCachedSize(int size) const {
 }
 const ::google::protobuf::Descriptor* CMD_Halls_RequestAllocClient::descriptor() {
   protobuf_Commands_2eproto::protobuf_AssignDescriptorsOnce();
-  return protobuf_Commands_2eproto::file_level_metadata[26].descriptor;
+  return protobuf_Commands_2eproto::file_level_metadata[28].descriptor;
 }
 
 const CMD_Halls_RequestAllocClient& CMD_Halls_RequestAllocClient::default_instance() {
@@ -12487,18 +15555,14 @@ const CMD_Halls_RequestAllocClient& CMD_Halls_RequestAllocClient::default_instan
 }
 
 CMD_Halls_RequestAllocClient* CMD_Halls_RequestAllocClient::New(::google::protobuf::Arena* arena) const {
-  CMD_Halls_RequestAllocClient* n = new CMD_Halls_RequestAllocClient;
-  if (arena != NULL) {
-    arena->Own(n);
-  }
-  return n;
+  return ::google::protobuf::Arena::CreateMessage<CMD_Halls_RequestAllocClient>(arena);
 }
 
 void CMD_Halls_RequestAllocClient::Clear() {
 // @@protoc_insertion_point(message_clear_start:CMD_Halls_RequestAllocClient)
-  commitaccountname_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  password_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  datas_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  commitaccountname_.ClearToEmpty(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
+  password_.ClearToEmpty(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
+  datas_.ClearToEmpty(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
   ::memset(&foundobjectid_, 0, reinterpret_cast<char*>(&loginsessionid_) -
     reinterpret_cast<char*>(&foundobjectid_) + sizeof(loginsessionid_));
 }
@@ -12756,16 +15820,13 @@ void CMD_Halls_RequestAllocClient::MergeFrom(const CMD_Halls_RequestAllocClient&
   GOOGLE_DCHECK_NE(&from, this);
   _internal_metadata_.MergeFrom(from._internal_metadata_);
   if (from.commitaccountname().size() > 0) {
-
-    commitaccountname_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.commitaccountname_);
+    set_commitaccountname(from.commitaccountname());
   }
   if (from.password().size() > 0) {
-
-    password_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.password_);
+    set_password(from.password());
   }
   if (from.datas().size() > 0) {
-
-    datas_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.datas_);
+    set_datas(from.datas());
   }
   if (from.foundobjectid() != 0) {
     set_foundobjectid(from.foundobjectid());
@@ -12795,6 +15856,21 @@ bool CMD_Halls_RequestAllocClient::IsInitialized() const {
 
 void CMD_Halls_RequestAllocClient::Swap(CMD_Halls_RequestAllocClient* other) {
   if (other == this) return;
+  if (GetArenaNoVirtual() == other->GetArenaNoVirtual()) {
+    InternalSwap(other);
+  } else {
+    CMD_Halls_RequestAllocClient* temp = New(GetArenaNoVirtual());
+    temp->MergeFrom(*other);
+    other->CopyFrom(*this);
+    InternalSwap(temp);
+    if (GetArenaNoVirtual() == NULL) {
+      delete temp;
+    }
+  }
+}
+void CMD_Halls_RequestAllocClient::UnsafeArenaSwap(CMD_Halls_RequestAllocClient* other) {
+  if (other == this) return;
+  GOOGLE_DCHECK(GetArenaNoVirtual() == other->GetArenaNoVirtual());
   InternalSwap(other);
 }
 void CMD_Halls_RequestAllocClient::InternalSwap(CMD_Halls_RequestAllocClient* other) {
@@ -12808,7 +15884,7 @@ void CMD_Halls_RequestAllocClient::InternalSwap(CMD_Halls_RequestAllocClient* ot
 
 ::google::protobuf::Metadata CMD_Halls_RequestAllocClient::GetMetadata() const {
   protobuf_Commands_2eproto::protobuf_AssignDescriptorsOnce();
-  return protobuf_Commands_2eproto::file_level_metadata[26];
+  return protobuf_Commands_2eproto::file_level_metadata[28];
 }
 
 #if PROTOBUF_INLINE_NOT_IN_HEADERS
@@ -12816,45 +15892,46 @@ void CMD_Halls_RequestAllocClient::InternalSwap(CMD_Halls_RequestAllocClient* ot
 
 // string commitAccountName = 1;
 void CMD_Halls_RequestAllocClient::clear_commitaccountname() {
-  commitaccountname_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  commitaccountname_.ClearToEmpty(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 const ::std::string& CMD_Halls_RequestAllocClient::commitaccountname() const {
   // @@protoc_insertion_point(field_get:CMD_Halls_RequestAllocClient.commitAccountName)
-  return commitaccountname_.GetNoArena();
+  return commitaccountname_.Get();
 }
 void CMD_Halls_RequestAllocClient::set_commitaccountname(const ::std::string& value) {
   
-  commitaccountname_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  commitaccountname_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value, GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set:CMD_Halls_RequestAllocClient.commitAccountName)
 }
-#if LANG_CXX11
-void CMD_Halls_RequestAllocClient::set_commitaccountname(::std::string&& value) {
-  
-  commitaccountname_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:CMD_Halls_RequestAllocClient.commitAccountName)
-}
-#endif
 void CMD_Halls_RequestAllocClient::set_commitaccountname(const char* value) {
   
-  commitaccountname_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  commitaccountname_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+              GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_char:CMD_Halls_RequestAllocClient.commitAccountName)
 }
-void CMD_Halls_RequestAllocClient::set_commitaccountname(const char* value, size_t size) {
+void CMD_Halls_RequestAllocClient::set_commitaccountname(const char* value,
+    size_t size) {
   
-  commitaccountname_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
+  commitaccountname_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_pointer:CMD_Halls_RequestAllocClient.commitAccountName)
 }
 ::std::string* CMD_Halls_RequestAllocClient::mutable_commitaccountname() {
   
   // @@protoc_insertion_point(field_mutable:CMD_Halls_RequestAllocClient.commitAccountName)
-  return commitaccountname_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return commitaccountname_.Mutable(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 ::std::string* CMD_Halls_RequestAllocClient::release_commitaccountname() {
   // @@protoc_insertion_point(field_release:CMD_Halls_RequestAllocClient.commitAccountName)
   
-  return commitaccountname_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return commitaccountname_.Release(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
+}
+::std::string* CMD_Halls_RequestAllocClient::unsafe_arena_release_commitaccountname() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:CMD_Halls_RequestAllocClient.commitAccountName)
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  
+  return commitaccountname_.UnsafeArenaRelease(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      GetArenaNoVirtual());
 }
 void CMD_Halls_RequestAllocClient::set_allocated_commitaccountname(::std::string* commitaccountname) {
   if (commitaccountname != NULL) {
@@ -12862,51 +15939,65 @@ void CMD_Halls_RequestAllocClient::set_allocated_commitaccountname(::std::string
   } else {
     
   }
-  commitaccountname_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), commitaccountname);
+  commitaccountname_.SetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), commitaccountname,
+      GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_allocated:CMD_Halls_RequestAllocClient.commitAccountName)
 }
+void CMD_Halls_RequestAllocClient::unsafe_arena_set_allocated_commitaccountname(
+    ::std::string* commitaccountname) {
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  if (commitaccountname != NULL) {
+    
+  } else {
+    
+  }
+  commitaccountname_.UnsafeArenaSetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      commitaccountname, GetArenaNoVirtual());
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:CMD_Halls_RequestAllocClient.commitAccountName)
+}
 
 // string password = 2;
 void CMD_Halls_RequestAllocClient::clear_password() {
-  password_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  password_.ClearToEmpty(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 const ::std::string& CMD_Halls_RequestAllocClient::password() const {
   // @@protoc_insertion_point(field_get:CMD_Halls_RequestAllocClient.password)
-  return password_.GetNoArena();
+  return password_.Get();
 }
 void CMD_Halls_RequestAllocClient::set_password(const ::std::string& value) {
   
-  password_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  password_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value, GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set:CMD_Halls_RequestAllocClient.password)
 }
-#if LANG_CXX11
-void CMD_Halls_RequestAllocClient::set_password(::std::string&& value) {
-  
-  password_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:CMD_Halls_RequestAllocClient.password)
-}
-#endif
 void CMD_Halls_RequestAllocClient::set_password(const char* value) {
   
-  password_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  password_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+              GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_char:CMD_Halls_RequestAllocClient.password)
 }
-void CMD_Halls_RequestAllocClient::set_password(const char* value, size_t size) {
+void CMD_Halls_RequestAllocClient::set_password(const char* value,
+    size_t size) {
   
-  password_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
+  password_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_pointer:CMD_Halls_RequestAllocClient.password)
 }
 ::std::string* CMD_Halls_RequestAllocClient::mutable_password() {
   
   // @@protoc_insertion_point(field_mutable:CMD_Halls_RequestAllocClient.password)
-  return password_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return password_.Mutable(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 ::std::string* CMD_Halls_RequestAllocClient::release_password() {
   // @@protoc_insertion_point(field_release:CMD_Halls_RequestAllocClient.password)
   
-  return password_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return password_.Release(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
+}
+::std::string* CMD_Halls_RequestAllocClient::unsafe_arena_release_password() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:CMD_Halls_RequestAllocClient.password)
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  
+  return password_.UnsafeArenaRelease(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      GetArenaNoVirtual());
 }
 void CMD_Halls_RequestAllocClient::set_allocated_password(::std::string* password) {
   if (password != NULL) {
@@ -12914,51 +16005,65 @@ void CMD_Halls_RequestAllocClient::set_allocated_password(::std::string* passwor
   } else {
     
   }
-  password_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), password);
+  password_.SetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), password,
+      GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_allocated:CMD_Halls_RequestAllocClient.password)
 }
+void CMD_Halls_RequestAllocClient::unsafe_arena_set_allocated_password(
+    ::std::string* password) {
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  if (password != NULL) {
+    
+  } else {
+    
+  }
+  password_.UnsafeArenaSetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      password, GetArenaNoVirtual());
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:CMD_Halls_RequestAllocClient.password)
+}
 
 // bytes datas = 3;
 void CMD_Halls_RequestAllocClient::clear_datas() {
-  datas_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  datas_.ClearToEmpty(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 const ::std::string& CMD_Halls_RequestAllocClient::datas() const {
   // @@protoc_insertion_point(field_get:CMD_Halls_RequestAllocClient.datas)
-  return datas_.GetNoArena();
+  return datas_.Get();
 }
 void CMD_Halls_RequestAllocClient::set_datas(const ::std::string& value) {
   
-  datas_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  datas_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value, GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set:CMD_Halls_RequestAllocClient.datas)
 }
-#if LANG_CXX11
-void CMD_Halls_RequestAllocClient::set_datas(::std::string&& value) {
-  
-  datas_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:CMD_Halls_RequestAllocClient.datas)
-}
-#endif
 void CMD_Halls_RequestAllocClient::set_datas(const char* value) {
   
-  datas_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  datas_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+              GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_char:CMD_Halls_RequestAllocClient.datas)
 }
-void CMD_Halls_RequestAllocClient::set_datas(const void* value, size_t size) {
+void CMD_Halls_RequestAllocClient::set_datas(const void* value,
+    size_t size) {
   
-  datas_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
+  datas_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_pointer:CMD_Halls_RequestAllocClient.datas)
 }
 ::std::string* CMD_Halls_RequestAllocClient::mutable_datas() {
   
   // @@protoc_insertion_point(field_mutable:CMD_Halls_RequestAllocClient.datas)
-  return datas_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return datas_.Mutable(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 ::std::string* CMD_Halls_RequestAllocClient::release_datas() {
   // @@protoc_insertion_point(field_release:CMD_Halls_RequestAllocClient.datas)
   
-  return datas_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return datas_.Release(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
+}
+::std::string* CMD_Halls_RequestAllocClient::unsafe_arena_release_datas() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:CMD_Halls_RequestAllocClient.datas)
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  
+  return datas_.UnsafeArenaRelease(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      GetArenaNoVirtual());
 }
 void CMD_Halls_RequestAllocClient::set_allocated_datas(::std::string* datas) {
   if (datas != NULL) {
@@ -12966,9 +16071,22 @@ void CMD_Halls_RequestAllocClient::set_allocated_datas(::std::string* datas) {
   } else {
     
   }
-  datas_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), datas);
+  datas_.SetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), datas,
+      GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_allocated:CMD_Halls_RequestAllocClient.datas)
 }
+void CMD_Halls_RequestAllocClient::unsafe_arena_set_allocated_datas(
+    ::std::string* datas) {
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  if (datas != NULL) {
+    
+  } else {
+    
+  }
+  datas_.UnsafeArenaSetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      datas, GetArenaNoVirtual());
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:CMD_Halls_RequestAllocClient.datas)
+}
 
 // uint64 foundObjectID = 4;
 void CMD_Halls_RequestAllocClient::clear_foundobjectid() {
@@ -13015,6 +16133,16 @@ CMD_Halls_StartMatch::CMD_Halls_StartMatch()
   SharedCtor();
   // @@protoc_insertion_point(constructor:CMD_Halls_StartMatch)
 }
+CMD_Halls_StartMatch::CMD_Halls_StartMatch(::google::protobuf::Arena* arena)
+  : ::google::protobuf::Message(),
+  _internal_metadata_(arena) {
+#ifdef GOOGLE_PROTOBUF_NO_STATIC_INITIALIZER
+  protobuf_Commands_2eproto::InitDefaults();
+#endif  // GOOGLE_PROTOBUF_NO_STATIC_INITIALIZER
+  SharedCtor();
+  RegisterArenaDtor(arena);
+  // @@protoc_insertion_point(arena_constructor:CMD_Halls_StartMatch)
+}
 CMD_Halls_StartMatch::CMD_Halls_StartMatch(const CMD_Halls_StartMatch& from)
   : ::google::protobuf::Message(),
       _internal_metadata_(NULL),
@@ -13038,8 +16166,19 @@ CMD_Halls_StartMatch::~CMD_Halls_StartMatch() {
 }
 
 void CMD_Halls_StartMatch::SharedDtor() {
+  ::google::protobuf::Arena* arena = GetArenaNoVirtual();
+  if (arena != NULL) {
+    return;
+  }
+
 }
 
+void CMD_Halls_StartMatch::ArenaDtor(void* object) {
+  CMD_Halls_StartMatch* _this = reinterpret_cast< CMD_Halls_StartMatch* >(object);
+  (void)_this;
+}
+void CMD_Halls_StartMatch::RegisterArenaDtor(::google::protobuf::Arena* arena) {
+}
 void CMD_Halls_StartMatch::SetCachedSize(int size) const {
   GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
   _cached_size_ = size;
@@ -13047,7 +16186,7 @@ void CMD_Halls_StartMatch::SetCachedSize(int size) const {
 }
 const ::google::protobuf::Descriptor* CMD_Halls_StartMatch::descriptor() {
   protobuf_Commands_2eproto::protobuf_AssignDescriptorsOnce();
-  return protobuf_Commands_2eproto::file_level_metadata[27].descriptor;
+  return protobuf_Commands_2eproto::file_level_metadata[29].descriptor;
 }
 
 const CMD_Halls_StartMatch& CMD_Halls_StartMatch::default_instance() {
@@ -13056,11 +16195,7 @@ const CMD_Halls_StartMatch& CMD_Halls_StartMatch::default_instance() {
 }
 
 CMD_Halls_StartMatch* CMD_Halls_StartMatch::New(::google::protobuf::Arena* arena) const {
-  CMD_Halls_StartMatch* n = new CMD_Halls_StartMatch;
-  if (arena != NULL) {
-    arena->Own(n);
-  }
-  return n;
+  return ::google::protobuf::Arena::CreateMessage<CMD_Halls_StartMatch>(arena);
 }
 
 void CMD_Halls_StartMatch::Clear() {
@@ -13232,6 +16367,21 @@ bool CMD_Halls_StartMatch::IsInitialized() const {
 
 void CMD_Halls_StartMatch::Swap(CMD_Halls_StartMatch* other) {
   if (other == this) return;
+  if (GetArenaNoVirtual() == other->GetArenaNoVirtual()) {
+    InternalSwap(other);
+  } else {
+    CMD_Halls_StartMatch* temp = New(GetArenaNoVirtual());
+    temp->MergeFrom(*other);
+    other->CopyFrom(*this);
+    InternalSwap(temp);
+    if (GetArenaNoVirtual() == NULL) {
+      delete temp;
+    }
+  }
+}
+void CMD_Halls_StartMatch::UnsafeArenaSwap(CMD_Halls_StartMatch* other) {
+  if (other == this) return;
+  GOOGLE_DCHECK(GetArenaNoVirtual() == other->GetArenaNoVirtual());
   InternalSwap(other);
 }
 void CMD_Halls_StartMatch::InternalSwap(CMD_Halls_StartMatch* other) {
@@ -13242,7 +16392,7 @@ void CMD_Halls_StartMatch::InternalSwap(CMD_Halls_StartMatch* other) {
 
 ::google::protobuf::Metadata CMD_Halls_StartMatch::GetMetadata() const {
   protobuf_Commands_2eproto::protobuf_AssignDescriptorsOnce();
-  return protobuf_Commands_2eproto::file_level_metadata[27];
+  return protobuf_Commands_2eproto::file_level_metadata[29];
 }
 
 #if PROTOBUF_INLINE_NOT_IN_HEADERS
@@ -13291,6 +16441,16 @@ CMD_Halls_CancelMatch::CMD_Halls_CancelMatch()
   SharedCtor();
   // @@protoc_insertion_point(constructor:CMD_Halls_CancelMatch)
 }
+CMD_Halls_CancelMatch::CMD_Halls_CancelMatch(::google::protobuf::Arena* arena)
+  : ::google::protobuf::Message(),
+  _internal_metadata_(arena) {
+#ifdef GOOGLE_PROTOBUF_NO_STATIC_INITIALIZER
+  protobuf_Commands_2eproto::InitDefaults();
+#endif  // GOOGLE_PROTOBUF_NO_STATIC_INITIALIZER
+  SharedCtor();
+  RegisterArenaDtor(arena);
+  // @@protoc_insertion_point(arena_constructor:CMD_Halls_CancelMatch)
+}
 CMD_Halls_CancelMatch::CMD_Halls_CancelMatch(const CMD_Halls_CancelMatch& from)
   : ::google::protobuf::Message(),
       _internal_metadata_(NULL),
@@ -13309,8 +16469,19 @@ CMD_Halls_CancelMatch::~CMD_Halls_CancelMatch() {
 }
 
 void CMD_Halls_CancelMatch::SharedDtor() {
+  ::google::protobuf::Arena* arena = GetArenaNoVirtual();
+  if (arena != NULL) {
+    return;
+  }
+
 }
 
+void CMD_Halls_CancelMatch::ArenaDtor(void* object) {
+  CMD_Halls_CancelMatch* _this = reinterpret_cast< CMD_Halls_CancelMatch* >(object);
+  (void)_this;
+}
+void CMD_Halls_CancelMatch::RegisterArenaDtor(::google::protobuf::Arena* arena) {
+}
 void CMD_Halls_CancelMatch::SetCachedSize(int size) const {
   GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
   _cached_size_ = size;
@@ -13318,7 +16489,7 @@ void CMD_Halls_CancelMatch::SetCachedSize(int size) const {
 }
 const ::google::protobuf::Descriptor* CMD_Halls_CancelMatch::descriptor() {
   protobuf_Commands_2eproto::protobuf_AssignDescriptorsOnce();
-  return protobuf_Commands_2eproto::file_level_metadata[28].descriptor;
+  return protobuf_Commands_2eproto::file_level_metadata[30].descriptor;
 }
 
 const CMD_Halls_CancelMatch& CMD_Halls_CancelMatch::default_instance() {
@@ -13327,11 +16498,7 @@ const CMD_Halls_CancelMatch& CMD_Halls_CancelMatch::default_instance() {
 }
 
 CMD_Halls_CancelMatch* CMD_Halls_CancelMatch::New(::google::protobuf::Arena* arena) const {
-  CMD_Halls_CancelMatch* n = new CMD_Halls_CancelMatch;
-  if (arena != NULL) {
-    arena->Own(n);
-  }
-  return n;
+  return ::google::protobuf::Arena::CreateMessage<CMD_Halls_CancelMatch>(arena);
 }
 
 void CMD_Halls_CancelMatch::Clear() {
@@ -13430,6 +16597,21 @@ bool CMD_Halls_CancelMatch::IsInitialized() const {
 
 void CMD_Halls_CancelMatch::Swap(CMD_Halls_CancelMatch* other) {
   if (other == this) return;
+  if (GetArenaNoVirtual() == other->GetArenaNoVirtual()) {
+    InternalSwap(other);
+  } else {
+    CMD_Halls_CancelMatch* temp = New(GetArenaNoVirtual());
+    temp->MergeFrom(*other);
+    other->CopyFrom(*this);
+    InternalSwap(temp);
+    if (GetArenaNoVirtual() == NULL) {
+      delete temp;
+    }
+  }
+}
+void CMD_Halls_CancelMatch::UnsafeArenaSwap(CMD_Halls_CancelMatch* other) {
+  if (other == this) return;
+  GOOGLE_DCHECK(GetArenaNoVirtual() == other->GetArenaNoVirtual());
   InternalSwap(other);
 }
 void CMD_Halls_CancelMatch::InternalSwap(CMD_Halls_CancelMatch* other) {
@@ -13438,7 +16620,7 @@ void CMD_Halls_CancelMatch::InternalSwap(CMD_Halls_CancelMatch* other) {
 
 ::google::protobuf::Metadata CMD_Halls_CancelMatch::GetMetadata() const {
   protobuf_Commands_2eproto::protobuf_AssignDescriptorsOnce();
-  return protobuf_Commands_2eproto::file_level_metadata[28];
+  return protobuf_Commands_2eproto::file_level_metadata[30];
 }
 
 #if PROTOBUF_INLINE_NOT_IN_HEADERS
@@ -13464,6 +16646,16 @@ CMD_Halls_OnRequestCreateRoomCB::CMD_Halls_OnRequestCreateRoomCB()
   SharedCtor();
   // @@protoc_insertion_point(constructor:CMD_Halls_OnRequestCreateRoomCB)
 }
+CMD_Halls_OnRequestCreateRoomCB::CMD_Halls_OnRequestCreateRoomCB(::google::protobuf::Arena* arena)
+  : ::google::protobuf::Message(),
+  _internal_metadata_(arena) {
+#ifdef GOOGLE_PROTOBUF_NO_STATIC_INITIALIZER
+  protobuf_Commands_2eproto::InitDefaults();
+#endif  // GOOGLE_PROTOBUF_NO_STATIC_INITIALIZER
+  SharedCtor();
+  RegisterArenaDtor(arena);
+  // @@protoc_insertion_point(arena_constructor:CMD_Halls_OnRequestCreateRoomCB)
+}
 CMD_Halls_OnRequestCreateRoomCB::CMD_Halls_OnRequestCreateRoomCB(const CMD_Halls_OnRequestCreateRoomCB& from)
   : ::google::protobuf::Message(),
       _internal_metadata_(NULL),
@@ -13471,7 +16663,8 @@ CMD_Halls_OnRequestCreateRoomCB::CMD_Halls_OnRequestCreateRoomCB(const CMD_Halls
   _internal_metadata_.MergeFrom(from._internal_metadata_);
   ip_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
   if (from.ip().size() > 0) {
-    ip_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.ip_);
+    ip_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.ip(),
+      GetArenaNoVirtual());
   }
   ::memcpy(&roomid_, &from.roomid_,
     reinterpret_cast<char*>(&errcode_) -
@@ -13492,9 +16685,20 @@ CMD_Halls_OnRequestCreateRoomCB::~CMD_Halls_OnRequestCreateRoomCB() {
 }
 
 void CMD_Halls_OnRequestCreateRoomCB::SharedDtor() {
-  ip_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  ::google::protobuf::Arena* arena = GetArenaNoVirtual();
+  if (arena != NULL) {
+    return;
+  }
+
+  ip_.Destroy(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), arena);
 }
 
+void CMD_Halls_OnRequestCreateRoomCB::ArenaDtor(void* object) {
+  CMD_Halls_OnRequestCreateRoomCB* _this = reinterpret_cast< CMD_Halls_OnRequestCreateRoomCB* >(object);
+  (void)_this;
+}
+void CMD_Halls_OnRequestCreateRoomCB::RegisterArenaDtor(::google::protobuf::Arena* arena) {
+}
 void CMD_Halls_OnRequestCreateRoomCB::SetCachedSize(int size) const {
   GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
   _cached_size_ = size;
@@ -13502,7 +16706,7 @@ void CMD_Halls_OnRequestCreateRoomCB::SetCachedSize(int size) const {
 }
 const ::google::protobuf::Descriptor* CMD_Halls_OnRequestCreateRoomCB::descriptor() {
   protobuf_Commands_2eproto::protobuf_AssignDescriptorsOnce();
-  return protobuf_Commands_2eproto::file_level_metadata[29].descriptor;
+  return protobuf_Commands_2eproto::file_level_metadata[31].descriptor;
 }
 
 const CMD_Halls_OnRequestCreateRoomCB& CMD_Halls_OnRequestCreateRoomCB::default_instance() {
@@ -13511,16 +16715,12 @@ const CMD_Halls_OnRequestCreateRoomCB& CMD_Halls_OnRequestCreateRoomCB::default_
 }
 
 CMD_Halls_OnRequestCreateRoomCB* CMD_Halls_OnRequestCreateRoomCB::New(::google::protobuf::Arena* arena) const {
-  CMD_Halls_OnRequestCreateRoomCB* n = new CMD_Halls_OnRequestCreateRoomCB;
-  if (arena != NULL) {
-    arena->Own(n);
-  }
-  return n;
+  return ::google::protobuf::Arena::CreateMessage<CMD_Halls_OnRequestCreateRoomCB>(arena);
 }
 
 void CMD_Halls_OnRequestCreateRoomCB::Clear() {
 // @@protoc_insertion_point(message_clear_start:CMD_Halls_OnRequestCreateRoomCB)
-  ip_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  ip_.ClearToEmpty(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
   ::memset(&roomid_, 0, reinterpret_cast<char*>(&errcode_) -
     reinterpret_cast<char*>(&roomid_) + sizeof(errcode_));
 }
@@ -13766,8 +16966,7 @@ void CMD_Halls_OnRequestCreateRoomCB::MergeFrom(const CMD_Halls_OnRequestCreateR
   GOOGLE_DCHECK_NE(&from, this);
   _internal_metadata_.MergeFrom(from._internal_metadata_);
   if (from.ip().size() > 0) {
-
-    ip_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.ip_);
+    set_ip(from.ip());
   }
   if (from.roomid() != 0) {
     set_roomid(from.roomid());
@@ -13803,6 +17002,21 @@ bool CMD_Halls_OnRequestCreateRoomCB::IsInitialized() const {
 
 void CMD_Halls_OnRequestCreateRoomCB::Swap(CMD_Halls_OnRequestCreateRoomCB* other) {
   if (other == this) return;
+  if (GetArenaNoVirtual() == other->GetArenaNoVirtual()) {
+    InternalSwap(other);
+  } else {
+    CMD_Halls_OnRequestCreateRoomCB* temp = New(GetArenaNoVirtual());
+    temp->MergeFrom(*other);
+    other->CopyFrom(*this);
+    InternalSwap(temp);
+    if (GetArenaNoVirtual() == NULL) {
+      delete temp;
+    }
+  }
+}
+void CMD_Halls_OnRequestCreateRoomCB::UnsafeArenaSwap(CMD_Halls_OnRequestCreateRoomCB* other) {
+  if (other == this) return;
+  GOOGLE_DCHECK(GetArenaNoVirtual() == other->GetArenaNoVirtual());
   InternalSwap(other);
 }
 void CMD_Halls_OnRequestCreateRoomCB::InternalSwap(CMD_Halls_OnRequestCreateRoomCB* other) {
@@ -13816,7 +17030,7 @@ void CMD_Halls_OnRequestCreateRoomCB::InternalSwap(CMD_Halls_OnRequestCreateRoom
 
 ::google::protobuf::Metadata CMD_Halls_OnRequestCreateRoomCB::GetMetadata() const {
   protobuf_Commands_2eproto::protobuf_AssignDescriptorsOnce();
-  return protobuf_Commands_2eproto::file_level_metadata[29];
+  return protobuf_Commands_2eproto::file_level_metadata[31];
 }
 
 #if PROTOBUF_INLINE_NOT_IN_HEADERS
@@ -13838,45 +17052,46 @@ void CMD_Halls_OnRequestCreateRoomCB::set_roomid(::google::protobuf::uint64 valu
 
 // string ip = 2;
 void CMD_Halls_OnRequestCreateRoomCB::clear_ip() {
-  ip_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  ip_.ClearToEmpty(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 const ::std::string& CMD_Halls_OnRequestCreateRoomCB::ip() const {
   // @@protoc_insertion_point(field_get:CMD_Halls_OnRequestCreateRoomCB.ip)
-  return ip_.GetNoArena();
+  return ip_.Get();
 }
 void CMD_Halls_OnRequestCreateRoomCB::set_ip(const ::std::string& value) {
   
-  ip_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  ip_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value, GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set:CMD_Halls_OnRequestCreateRoomCB.ip)
 }
-#if LANG_CXX11
-void CMD_Halls_OnRequestCreateRoomCB::set_ip(::std::string&& value) {
-  
-  ip_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:CMD_Halls_OnRequestCreateRoomCB.ip)
-}
-#endif
 void CMD_Halls_OnRequestCreateRoomCB::set_ip(const char* value) {
   
-  ip_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  ip_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+              GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_char:CMD_Halls_OnRequestCreateRoomCB.ip)
 }
-void CMD_Halls_OnRequestCreateRoomCB::set_ip(const char* value, size_t size) {
+void CMD_Halls_OnRequestCreateRoomCB::set_ip(const char* value,
+    size_t size) {
   
-  ip_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
+  ip_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_pointer:CMD_Halls_OnRequestCreateRoomCB.ip)
 }
 ::std::string* CMD_Halls_OnRequestCreateRoomCB::mutable_ip() {
   
   // @@protoc_insertion_point(field_mutable:CMD_Halls_OnRequestCreateRoomCB.ip)
-  return ip_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return ip_.Mutable(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 ::std::string* CMD_Halls_OnRequestCreateRoomCB::release_ip() {
   // @@protoc_insertion_point(field_release:CMD_Halls_OnRequestCreateRoomCB.ip)
   
-  return ip_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return ip_.Release(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
+}
+::std::string* CMD_Halls_OnRequestCreateRoomCB::unsafe_arena_release_ip() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:CMD_Halls_OnRequestCreateRoomCB.ip)
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  
+  return ip_.UnsafeArenaRelease(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      GetArenaNoVirtual());
 }
 void CMD_Halls_OnRequestCreateRoomCB::set_allocated_ip(::std::string* ip) {
   if (ip != NULL) {
@@ -13884,9 +17099,22 @@ void CMD_Halls_OnRequestCreateRoomCB::set_allocated_ip(::std::string* ip) {
   } else {
     
   }
-  ip_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ip);
+  ip_.SetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ip,
+      GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_allocated:CMD_Halls_OnRequestCreateRoomCB.ip)
 }
+void CMD_Halls_OnRequestCreateRoomCB::unsafe_arena_set_allocated_ip(
+    ::std::string* ip) {
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  if (ip != NULL) {
+    
+  } else {
+    
+  }
+  ip_.UnsafeArenaSetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      ip, GetArenaNoVirtual());
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:CMD_Halls_OnRequestCreateRoomCB.ip)
+}
 
 // int32 port = 3;
 void CMD_Halls_OnRequestCreateRoomCB::clear_port() {
@@ -13948,6 +17176,17 @@ CMD_Halls_OnRoomSrvGameOverReport::CMD_Halls_OnRoomSrvGameOverReport()
   SharedCtor();
   // @@protoc_insertion_point(constructor:CMD_Halls_OnRoomSrvGameOverReport)
 }
+CMD_Halls_OnRoomSrvGameOverReport::CMD_Halls_OnRoomSrvGameOverReport(::google::protobuf::Arena* arena)
+  : ::google::protobuf::Message(),
+  _internal_metadata_(arena),
+  playerdatas_(arena) {
+#ifdef GOOGLE_PROTOBUF_NO_STATIC_INITIALIZER
+  protobuf_Commands_2eproto::InitDefaults();
+#endif  // GOOGLE_PROTOBUF_NO_STATIC_INITIALIZER
+  SharedCtor();
+  RegisterArenaDtor(arena);
+  // @@protoc_insertion_point(arena_constructor:CMD_Halls_OnRoomSrvGameOverReport)
+}
 CMD_Halls_OnRoomSrvGameOverReport::CMD_Halls_OnRoomSrvGameOverReport(const CMD_Halls_OnRoomSrvGameOverReport& from)
   : ::google::protobuf::Message(),
       _internal_metadata_(NULL),
@@ -13972,8 +17211,19 @@ CMD_Halls_OnRoomSrvGameOverReport::~CMD_Halls_OnRoomSrvGameOverReport() {
 }
 
 void CMD_Halls_OnRoomSrvGameOverReport::SharedDtor() {
+  ::google::protobuf::Arena* arena = GetArenaNoVirtual();
+  if (arena != NULL) {
+    return;
+  }
+
 }
 
+void CMD_Halls_OnRoomSrvGameOverReport::ArenaDtor(void* object) {
+  CMD_Halls_OnRoomSrvGameOverReport* _this = reinterpret_cast< CMD_Halls_OnRoomSrvGameOverReport* >(object);
+  (void)_this;
+}
+void CMD_Halls_OnRoomSrvGameOverReport::RegisterArenaDtor(::google::protobuf::Arena* arena) {
+}
 void CMD_Halls_OnRoomSrvGameOverReport::SetCachedSize(int size) const {
   GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
   _cached_size_ = size;
@@ -13981,7 +17231,7 @@ void CMD_Halls_OnRoomSrvGameOverReport::SetCachedSize(int size) const {
 }
 const ::google::protobuf::Descriptor* CMD_Halls_OnRoomSrvGameOverReport::descriptor() {
   protobuf_Commands_2eproto::protobuf_AssignDescriptorsOnce();
-  return protobuf_Commands_2eproto::file_level_metadata[30].descriptor;
+  return protobuf_Commands_2eproto::file_level_metadata[32].descriptor;
 }
 
 const CMD_Halls_OnRoomSrvGameOverReport& CMD_Halls_OnRoomSrvGameOverReport::default_instance() {
@@ -13990,11 +17240,7 @@ const CMD_Halls_OnRoomSrvGameOverReport& CMD_Halls_OnRoomSrvGameOverReport::defa
 }
 
 CMD_Halls_OnRoomSrvGameOverReport* CMD_Halls_OnRoomSrvGameOverReport::New(::google::protobuf::Arena* arena) const {
-  CMD_Halls_OnRoomSrvGameOverReport* n = new CMD_Halls_OnRoomSrvGameOverReport;
-  if (arena != NULL) {
-    arena->Own(n);
-  }
-  return n;
+  return ::google::protobuf::Arena::CreateMessage<CMD_Halls_OnRoomSrvGameOverReport>(arena);
 }
 
 void CMD_Halls_OnRoomSrvGameOverReport::Clear() {
@@ -14207,6 +17453,21 @@ bool CMD_Halls_OnRoomSrvGameOverReport::IsInitialized() const {
 
 void CMD_Halls_OnRoomSrvGameOverReport::Swap(CMD_Halls_OnRoomSrvGameOverReport* other) {
   if (other == this) return;
+  if (GetArenaNoVirtual() == other->GetArenaNoVirtual()) {
+    InternalSwap(other);
+  } else {
+    CMD_Halls_OnRoomSrvGameOverReport* temp = New(GetArenaNoVirtual());
+    temp->MergeFrom(*other);
+    other->CopyFrom(*this);
+    InternalSwap(temp);
+    if (GetArenaNoVirtual() == NULL) {
+      delete temp;
+    }
+  }
+}
+void CMD_Halls_OnRoomSrvGameOverReport::UnsafeArenaSwap(CMD_Halls_OnRoomSrvGameOverReport* other) {
+  if (other == this) return;
+  GOOGLE_DCHECK(GetArenaNoVirtual() == other->GetArenaNoVirtual());
   InternalSwap(other);
 }
 void CMD_Halls_OnRoomSrvGameOverReport::InternalSwap(CMD_Halls_OnRoomSrvGameOverReport* other) {
@@ -14218,7 +17479,7 @@ void CMD_Halls_OnRoomSrvGameOverReport::InternalSwap(CMD_Halls_OnRoomSrvGameOver
 
 ::google::protobuf::Metadata CMD_Halls_OnRoomSrvGameOverReport::GetMetadata() const {
   protobuf_Commands_2eproto::protobuf_AssignDescriptorsOnce();
-  return protobuf_Commands_2eproto::file_level_metadata[30];
+  return protobuf_Commands_2eproto::file_level_metadata[32];
 }
 
 #if PROTOBUF_INLINE_NOT_IN_HEADERS
@@ -14306,6 +17567,16 @@ CMD_Halls_OnQueryAccountCB::CMD_Halls_OnQueryAccountCB()
   SharedCtor();
   // @@protoc_insertion_point(constructor:CMD_Halls_OnQueryAccountCB)
 }
+CMD_Halls_OnQueryAccountCB::CMD_Halls_OnQueryAccountCB(::google::protobuf::Arena* arena)
+  : ::google::protobuf::Message(),
+  _internal_metadata_(arena) {
+#ifdef GOOGLE_PROTOBUF_NO_STATIC_INITIALIZER
+  protobuf_Commands_2eproto::InitDefaults();
+#endif  // GOOGLE_PROTOBUF_NO_STATIC_INITIALIZER
+  SharedCtor();
+  RegisterArenaDtor(arena);
+  // @@protoc_insertion_point(arena_constructor:CMD_Halls_OnQueryAccountCB)
+}
 CMD_Halls_OnQueryAccountCB::CMD_Halls_OnQueryAccountCB(const CMD_Halls_OnQueryAccountCB& from)
   : ::google::protobuf::Message(),
       _internal_metadata_(NULL),
@@ -14313,15 +17584,18 @@ CMD_Halls_OnQueryAccountCB::CMD_Halls_OnQueryAccountCB(const CMD_Halls_OnQueryAc
   _internal_metadata_.MergeFrom(from._internal_metadata_);
   commitaccountname_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
   if (from.commitaccountname().size() > 0) {
-    commitaccountname_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.commitaccountname_);
+    commitaccountname_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.commitaccountname(),
+      GetArenaNoVirtual());
   }
   datas_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
   if (from.datas().size() > 0) {
-    datas_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.datas_);
+    datas_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.datas(),
+      GetArenaNoVirtual());
   }
   playername_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
   if (from.playername().size() > 0) {
-    playername_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.playername_);
+    playername_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.playername(),
+      GetArenaNoVirtual());
   }
   ::memcpy(&foundobjectid_, &from.foundobjectid_,
     reinterpret_cast<char*>(&querytype_) -
@@ -14344,11 +17618,22 @@ CMD_Halls_OnQueryAccountCB::~CMD_Halls_OnQueryAccountCB() {
 }
 
 void CMD_Halls_OnQueryAccountCB::SharedDtor() {
-  commitaccountname_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  datas_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  playername_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  ::google::protobuf::Arena* arena = GetArenaNoVirtual();
+  if (arena != NULL) {
+    return;
+  }
+
+  commitaccountname_.Destroy(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), arena);
+  datas_.Destroy(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), arena);
+  playername_.Destroy(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), arena);
 }
 
+void CMD_Halls_OnQueryAccountCB::ArenaDtor(void* object) {
+  CMD_Halls_OnQueryAccountCB* _this = reinterpret_cast< CMD_Halls_OnQueryAccountCB* >(object);
+  (void)_this;
+}
+void CMD_Halls_OnQueryAccountCB::RegisterArenaDtor(::google::protobuf::Arena* arena) {
+}
 void CMD_Halls_OnQueryAccountCB::SetCachedSize(int size) const {
   GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
   _cached_size_ = size;
@@ -14356,7 +17641,7 @@ void CMD_Halls_OnQueryAccountCB::SetCachedSize(int size) const {
 }
 const ::google::protobuf::Descriptor* CMD_Halls_OnQueryAccountCB::descriptor() {
   protobuf_Commands_2eproto::protobuf_AssignDescriptorsOnce();
-  return protobuf_Commands_2eproto::file_level_metadata[31].descriptor;
+  return protobuf_Commands_2eproto::file_level_metadata[33].descriptor;
 }
 
 const CMD_Halls_OnQueryAccountCB& CMD_Halls_OnQueryAccountCB::default_instance() {
@@ -14365,18 +17650,14 @@ const CMD_Halls_OnQueryAccountCB& CMD_Halls_OnQueryAccountCB::default_instance()
 }
 
 CMD_Halls_OnQueryAccountCB* CMD_Halls_OnQueryAccountCB::New(::google::protobuf::Arena* arena) const {
-  CMD_Halls_OnQueryAccountCB* n = new CMD_Halls_OnQueryAccountCB;
-  if (arena != NULL) {
-    arena->Own(n);
-  }
-  return n;
+  return ::google::protobuf::Arena::CreateMessage<CMD_Halls_OnQueryAccountCB>(arena);
 }
 
 void CMD_Halls_OnQueryAccountCB::Clear() {
 // @@protoc_insertion_point(message_clear_start:CMD_Halls_OnQueryAccountCB)
-  commitaccountname_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  datas_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  playername_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  commitaccountname_.ClearToEmpty(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
+  datas_.ClearToEmpty(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
+  playername_.ClearToEmpty(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
   ::memset(&foundobjectid_, 0, reinterpret_cast<char*>(&querytype_) -
     reinterpret_cast<char*>(&foundobjectid_) + sizeof(querytype_));
 }
@@ -14756,16 +18037,13 @@ void CMD_Halls_OnQueryAccountCB::MergeFrom(const CMD_Halls_OnQueryAccountCB& fro
   GOOGLE_DCHECK_NE(&from, this);
   _internal_metadata_.MergeFrom(from._internal_metadata_);
   if (from.commitaccountname().size() > 0) {
-
-    commitaccountname_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.commitaccountname_);
+    set_commitaccountname(from.commitaccountname());
   }
   if (from.datas().size() > 0) {
-
-    datas_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.datas_);
+    set_datas(from.datas());
   }
   if (from.playername().size() > 0) {
-
-    playername_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.playername_);
+    set_playername(from.playername());
   }
   if (from.foundobjectid() != 0) {
     set_foundobjectid(from.foundobjectid());
@@ -14807,6 +18085,21 @@ bool CMD_Halls_OnQueryAccountCB::IsInitialized() const {
 
 void CMD_Halls_OnQueryAccountCB::Swap(CMD_Halls_OnQueryAccountCB* other) {
   if (other == this) return;
+  if (GetArenaNoVirtual() == other->GetArenaNoVirtual()) {
+    InternalSwap(other);
+  } else {
+    CMD_Halls_OnQueryAccountCB* temp = New(GetArenaNoVirtual());
+    temp->MergeFrom(*other);
+    other->CopyFrom(*this);
+    InternalSwap(temp);
+    if (GetArenaNoVirtual() == NULL) {
+      delete temp;
+    }
+  }
+}
+void CMD_Halls_OnQueryAccountCB::UnsafeArenaSwap(CMD_Halls_OnQueryAccountCB* other) {
+  if (other == this) return;
+  GOOGLE_DCHECK(GetArenaNoVirtual() == other->GetArenaNoVirtual());
   InternalSwap(other);
 }
 void CMD_Halls_OnQueryAccountCB::InternalSwap(CMD_Halls_OnQueryAccountCB* other) {
@@ -14824,7 +18117,7 @@ void CMD_Halls_OnQueryAccountCB::InternalSwap(CMD_Halls_OnQueryAccountCB* other)
 
 ::google::protobuf::Metadata CMD_Halls_OnQueryAccountCB::GetMetadata() const {
   protobuf_Commands_2eproto::protobuf_AssignDescriptorsOnce();
-  return protobuf_Commands_2eproto::file_level_metadata[31];
+  return protobuf_Commands_2eproto::file_level_metadata[33];
 }
 
 #if PROTOBUF_INLINE_NOT_IN_HEADERS
@@ -14832,45 +18125,46 @@ void CMD_Halls_OnQueryAccountCB::InternalSwap(CMD_Halls_OnQueryAccountCB* other)
 
 // string commitAccountName = 1;
 void CMD_Halls_OnQueryAccountCB::clear_commitaccountname() {
-  commitaccountname_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  commitaccountname_.ClearToEmpty(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 const ::std::string& CMD_Halls_OnQueryAccountCB::commitaccountname() const {
   // @@protoc_insertion_point(field_get:CMD_Halls_OnQueryAccountCB.commitAccountName)
-  return commitaccountname_.GetNoArena();
+  return commitaccountname_.Get();
 }
 void CMD_Halls_OnQueryAccountCB::set_commitaccountname(const ::std::string& value) {
   
-  commitaccountname_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  commitaccountname_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value, GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set:CMD_Halls_OnQueryAccountCB.commitAccountName)
 }
-#if LANG_CXX11
-void CMD_Halls_OnQueryAccountCB::set_commitaccountname(::std::string&& value) {
-  
-  commitaccountname_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:CMD_Halls_OnQueryAccountCB.commitAccountName)
-}
-#endif
 void CMD_Halls_OnQueryAccountCB::set_commitaccountname(const char* value) {
   
-  commitaccountname_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  commitaccountname_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+              GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_char:CMD_Halls_OnQueryAccountCB.commitAccountName)
 }
-void CMD_Halls_OnQueryAccountCB::set_commitaccountname(const char* value, size_t size) {
+void CMD_Halls_OnQueryAccountCB::set_commitaccountname(const char* value,
+    size_t size) {
   
-  commitaccountname_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
+  commitaccountname_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_pointer:CMD_Halls_OnQueryAccountCB.commitAccountName)
 }
 ::std::string* CMD_Halls_OnQueryAccountCB::mutable_commitaccountname() {
   
   // @@protoc_insertion_point(field_mutable:CMD_Halls_OnQueryAccountCB.commitAccountName)
-  return commitaccountname_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return commitaccountname_.Mutable(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 ::std::string* CMD_Halls_OnQueryAccountCB::release_commitaccountname() {
   // @@protoc_insertion_point(field_release:CMD_Halls_OnQueryAccountCB.commitAccountName)
   
-  return commitaccountname_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return commitaccountname_.Release(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
+}
+::std::string* CMD_Halls_OnQueryAccountCB::unsafe_arena_release_commitaccountname() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:CMD_Halls_OnQueryAccountCB.commitAccountName)
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  
+  return commitaccountname_.UnsafeArenaRelease(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      GetArenaNoVirtual());
 }
 void CMD_Halls_OnQueryAccountCB::set_allocated_commitaccountname(::std::string* commitaccountname) {
   if (commitaccountname != NULL) {
@@ -14878,51 +18172,65 @@ void CMD_Halls_OnQueryAccountCB::set_allocated_commitaccountname(::std::string*
   } else {
     
   }
-  commitaccountname_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), commitaccountname);
+  commitaccountname_.SetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), commitaccountname,
+      GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_allocated:CMD_Halls_OnQueryAccountCB.commitAccountName)
 }
+void CMD_Halls_OnQueryAccountCB::unsafe_arena_set_allocated_commitaccountname(
+    ::std::string* commitaccountname) {
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  if (commitaccountname != NULL) {
+    
+  } else {
+    
+  }
+  commitaccountname_.UnsafeArenaSetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      commitaccountname, GetArenaNoVirtual());
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:CMD_Halls_OnQueryAccountCB.commitAccountName)
+}
 
 // bytes datas = 2;
 void CMD_Halls_OnQueryAccountCB::clear_datas() {
-  datas_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  datas_.ClearToEmpty(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 const ::std::string& CMD_Halls_OnQueryAccountCB::datas() const {
   // @@protoc_insertion_point(field_get:CMD_Halls_OnQueryAccountCB.datas)
-  return datas_.GetNoArena();
+  return datas_.Get();
 }
 void CMD_Halls_OnQueryAccountCB::set_datas(const ::std::string& value) {
   
-  datas_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:CMD_Halls_OnQueryAccountCB.datas)
-}
-#if LANG_CXX11
-void CMD_Halls_OnQueryAccountCB::set_datas(::std::string&& value) {
-  
-  datas_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:CMD_Halls_OnQueryAccountCB.datas)
+  datas_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value, GetArenaNoVirtual());
+  // @@protoc_insertion_point(field_set:CMD_Halls_OnQueryAccountCB.datas)
 }
-#endif
 void CMD_Halls_OnQueryAccountCB::set_datas(const char* value) {
   
-  datas_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  datas_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+              GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_char:CMD_Halls_OnQueryAccountCB.datas)
 }
-void CMD_Halls_OnQueryAccountCB::set_datas(const void* value, size_t size) {
+void CMD_Halls_OnQueryAccountCB::set_datas(const void* value,
+    size_t size) {
   
-  datas_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
+  datas_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_pointer:CMD_Halls_OnQueryAccountCB.datas)
 }
 ::std::string* CMD_Halls_OnQueryAccountCB::mutable_datas() {
   
   // @@protoc_insertion_point(field_mutable:CMD_Halls_OnQueryAccountCB.datas)
-  return datas_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return datas_.Mutable(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 ::std::string* CMD_Halls_OnQueryAccountCB::release_datas() {
   // @@protoc_insertion_point(field_release:CMD_Halls_OnQueryAccountCB.datas)
   
-  return datas_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return datas_.Release(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
+}
+::std::string* CMD_Halls_OnQueryAccountCB::unsafe_arena_release_datas() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:CMD_Halls_OnQueryAccountCB.datas)
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  
+  return datas_.UnsafeArenaRelease(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      GetArenaNoVirtual());
 }
 void CMD_Halls_OnQueryAccountCB::set_allocated_datas(::std::string* datas) {
   if (datas != NULL) {
@@ -14930,9 +18238,22 @@ void CMD_Halls_OnQueryAccountCB::set_allocated_datas(::std::string* datas) {
   } else {
     
   }
-  datas_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), datas);
+  datas_.SetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), datas,
+      GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_allocated:CMD_Halls_OnQueryAccountCB.datas)
 }
+void CMD_Halls_OnQueryAccountCB::unsafe_arena_set_allocated_datas(
+    ::std::string* datas) {
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  if (datas != NULL) {
+    
+  } else {
+    
+  }
+  datas_.UnsafeArenaSetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      datas, GetArenaNoVirtual());
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:CMD_Halls_OnQueryAccountCB.datas)
+}
 
 // uint64 foundObjectID = 3;
 void CMD_Halls_OnQueryAccountCB::clear_foundobjectid() {
@@ -14950,45 +18271,46 @@ void CMD_Halls_OnQueryAccountCB::set_foundobjectid(::google::protobuf::uint64 va
 
 // string playerName = 4;
 void CMD_Halls_OnQueryAccountCB::clear_playername() {
-  playername_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  playername_.ClearToEmpty(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 const ::std::string& CMD_Halls_OnQueryAccountCB::playername() const {
   // @@protoc_insertion_point(field_get:CMD_Halls_OnQueryAccountCB.playerName)
-  return playername_.GetNoArena();
+  return playername_.Get();
 }
 void CMD_Halls_OnQueryAccountCB::set_playername(const ::std::string& value) {
   
-  playername_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  playername_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value, GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set:CMD_Halls_OnQueryAccountCB.playerName)
 }
-#if LANG_CXX11
-void CMD_Halls_OnQueryAccountCB::set_playername(::std::string&& value) {
-  
-  playername_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:CMD_Halls_OnQueryAccountCB.playerName)
-}
-#endif
 void CMD_Halls_OnQueryAccountCB::set_playername(const char* value) {
   
-  playername_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  playername_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+              GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_char:CMD_Halls_OnQueryAccountCB.playerName)
 }
-void CMD_Halls_OnQueryAccountCB::set_playername(const char* value, size_t size) {
+void CMD_Halls_OnQueryAccountCB::set_playername(const char* value,
+    size_t size) {
   
-  playername_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
+  playername_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_pointer:CMD_Halls_OnQueryAccountCB.playerName)
 }
 ::std::string* CMD_Halls_OnQueryAccountCB::mutable_playername() {
   
   // @@protoc_insertion_point(field_mutable:CMD_Halls_OnQueryAccountCB.playerName)
-  return playername_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return playername_.Mutable(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 ::std::string* CMD_Halls_OnQueryAccountCB::release_playername() {
   // @@protoc_insertion_point(field_release:CMD_Halls_OnQueryAccountCB.playerName)
   
-  return playername_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return playername_.Release(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
+}
+::std::string* CMD_Halls_OnQueryAccountCB::unsafe_arena_release_playername() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:CMD_Halls_OnQueryAccountCB.playerName)
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  
+  return playername_.UnsafeArenaRelease(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      GetArenaNoVirtual());
 }
 void CMD_Halls_OnQueryAccountCB::set_allocated_playername(::std::string* playername) {
   if (playername != NULL) {
@@ -14996,9 +18318,22 @@ void CMD_Halls_OnQueryAccountCB::set_allocated_playername(::std::string* playern
   } else {
     
   }
-  playername_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), playername);
+  playername_.SetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), playername,
+      GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_allocated:CMD_Halls_OnQueryAccountCB.playerName)
 }
+void CMD_Halls_OnQueryAccountCB::unsafe_arena_set_allocated_playername(
+    ::std::string* playername) {
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  if (playername != NULL) {
+    
+  } else {
+    
+  }
+  playername_.UnsafeArenaSetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      playername, GetArenaNoVirtual());
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:CMD_Halls_OnQueryAccountCB.playerName)
+}
 
 // int32 modelID = 5;
 void CMD_Halls_OnQueryAccountCB::clear_modelid() {
@@ -15093,6 +18428,16 @@ CMD_Halls_OnQueryPlayerGameDataCB::CMD_Halls_OnQueryPlayerGameDataCB()
   SharedCtor();
   // @@protoc_insertion_point(constructor:CMD_Halls_OnQueryPlayerGameDataCB)
 }
+CMD_Halls_OnQueryPlayerGameDataCB::CMD_Halls_OnQueryPlayerGameDataCB(::google::protobuf::Arena* arena)
+  : ::google::protobuf::Message(),
+  _internal_metadata_(arena) {
+#ifdef GOOGLE_PROTOBUF_NO_STATIC_INITIALIZER
+  protobuf_Commands_2eproto::InitDefaults();
+#endif  // GOOGLE_PROTOBUF_NO_STATIC_INITIALIZER
+  SharedCtor();
+  RegisterArenaDtor(arena);
+  // @@protoc_insertion_point(arena_constructor:CMD_Halls_OnQueryPlayerGameDataCB)
+}
 CMD_Halls_OnQueryPlayerGameDataCB::CMD_Halls_OnQueryPlayerGameDataCB(const CMD_Halls_OnQueryPlayerGameDataCB& from)
   : ::google::protobuf::Message(),
       _internal_metadata_(NULL),
@@ -15116,8 +18461,19 @@ CMD_Halls_OnQueryPlayerGameDataCB::~CMD_Halls_OnQueryPlayerGameDataCB() {
 }
 
 void CMD_Halls_OnQueryPlayerGameDataCB::SharedDtor() {
+  ::google::protobuf::Arena* arena = GetArenaNoVirtual();
+  if (arena != NULL) {
+    return;
+  }
+
 }
 
+void CMD_Halls_OnQueryPlayerGameDataCB::ArenaDtor(void* object) {
+  CMD_Halls_OnQueryPlayerGameDataCB* _this = reinterpret_cast< CMD_Halls_OnQueryPlayerGameDataCB* >(object);
+  (void)_this;
+}
+void CMD_Halls_OnQueryPlayerGameDataCB::RegisterArenaDtor(::google::protobuf::Arena* arena) {
+}
 void CMD_Halls_OnQueryPlayerGameDataCB::SetCachedSize(int size) const {
   GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
   _cached_size_ = size;
@@ -15125,7 +18481,7 @@ void CMD_Halls_OnQueryPlayerGameDataCB::SetCachedSize(int size) const {
 }
 const ::google::protobuf::Descriptor* CMD_Halls_OnQueryPlayerGameDataCB::descriptor() {
   protobuf_Commands_2eproto::protobuf_AssignDescriptorsOnce();
-  return protobuf_Commands_2eproto::file_level_metadata[32].descriptor;
+  return protobuf_Commands_2eproto::file_level_metadata[34].descriptor;
 }
 
 const CMD_Halls_OnQueryPlayerGameDataCB& CMD_Halls_OnQueryPlayerGameDataCB::default_instance() {
@@ -15134,11 +18490,7 @@ const CMD_Halls_OnQueryPlayerGameDataCB& CMD_Halls_OnQueryPlayerGameDataCB::defa
 }
 
 CMD_Halls_OnQueryPlayerGameDataCB* CMD_Halls_OnQueryPlayerGameDataCB::New(::google::protobuf::Arena* arena) const {
-  CMD_Halls_OnQueryPlayerGameDataCB* n = new CMD_Halls_OnQueryPlayerGameDataCB;
-  if (arena != NULL) {
-    arena->Own(n);
-  }
-  return n;
+  return ::google::protobuf::Arena::CreateMessage<CMD_Halls_OnQueryPlayerGameDataCB>(arena);
 }
 
 void CMD_Halls_OnQueryPlayerGameDataCB::Clear() {
@@ -15510,6 +18862,21 @@ bool CMD_Halls_OnQueryPlayerGameDataCB::IsInitialized() const {
 
 void CMD_Halls_OnQueryPlayerGameDataCB::Swap(CMD_Halls_OnQueryPlayerGameDataCB* other) {
   if (other == this) return;
+  if (GetArenaNoVirtual() == other->GetArenaNoVirtual()) {
+    InternalSwap(other);
+  } else {
+    CMD_Halls_OnQueryPlayerGameDataCB* temp = New(GetArenaNoVirtual());
+    temp->MergeFrom(*other);
+    other->CopyFrom(*this);
+    InternalSwap(temp);
+    if (GetArenaNoVirtual() == NULL) {
+      delete temp;
+    }
+  }
+}
+void CMD_Halls_OnQueryPlayerGameDataCB::UnsafeArenaSwap(CMD_Halls_OnQueryPlayerGameDataCB* other) {
+  if (other == this) return;
+  GOOGLE_DCHECK(GetArenaNoVirtual() == other->GetArenaNoVirtual());
   InternalSwap(other);
 }
 void CMD_Halls_OnQueryPlayerGameDataCB::InternalSwap(CMD_Halls_OnQueryPlayerGameDataCB* other) {
@@ -15526,7 +18893,7 @@ void CMD_Halls_OnQueryPlayerGameDataCB::InternalSwap(CMD_Halls_OnQueryPlayerGame
 
 ::google::protobuf::Metadata CMD_Halls_OnQueryPlayerGameDataCB::GetMetadata() const {
   protobuf_Commands_2eproto::protobuf_AssignDescriptorsOnce();
-  return protobuf_Commands_2eproto::file_level_metadata[32];
+  return protobuf_Commands_2eproto::file_level_metadata[34];
 }
 
 #if PROTOBUF_INLINE_NOT_IN_HEADERS
@@ -15661,6 +19028,16 @@ CMD_Halls_QueryPlayerGameData::CMD_Halls_QueryPlayerGameData()
   SharedCtor();
   // @@protoc_insertion_point(constructor:CMD_Halls_QueryPlayerGameData)
 }
+CMD_Halls_QueryPlayerGameData::CMD_Halls_QueryPlayerGameData(::google::protobuf::Arena* arena)
+  : ::google::protobuf::Message(),
+  _internal_metadata_(arena) {
+#ifdef GOOGLE_PROTOBUF_NO_STATIC_INITIALIZER
+  protobuf_Commands_2eproto::InitDefaults();
+#endif  // GOOGLE_PROTOBUF_NO_STATIC_INITIALIZER
+  SharedCtor();
+  RegisterArenaDtor(arena);
+  // @@protoc_insertion_point(arena_constructor:CMD_Halls_QueryPlayerGameData)
+}
 CMD_Halls_QueryPlayerGameData::CMD_Halls_QueryPlayerGameData(const CMD_Halls_QueryPlayerGameData& from)
   : ::google::protobuf::Message(),
       _internal_metadata_(NULL),
@@ -15684,8 +19061,19 @@ CMD_Halls_QueryPlayerGameData::~CMD_Halls_QueryPlayerGameData() {
 }
 
 void CMD_Halls_QueryPlayerGameData::SharedDtor() {
+  ::google::protobuf::Arena* arena = GetArenaNoVirtual();
+  if (arena != NULL) {
+    return;
+  }
+
 }
 
+void CMD_Halls_QueryPlayerGameData::ArenaDtor(void* object) {
+  CMD_Halls_QueryPlayerGameData* _this = reinterpret_cast< CMD_Halls_QueryPlayerGameData* >(object);
+  (void)_this;
+}
+void CMD_Halls_QueryPlayerGameData::RegisterArenaDtor(::google::protobuf::Arena* arena) {
+}
 void CMD_Halls_QueryPlayerGameData::SetCachedSize(int size) const {
   GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
   _cached_size_ = size;
@@ -15693,7 +19081,7 @@ void CMD_Halls_QueryPlayerGameData::SetCachedSize(int size) const {
 }
 const ::google::protobuf::Descriptor* CMD_Halls_QueryPlayerGameData::descriptor() {
   protobuf_Commands_2eproto::protobuf_AssignDescriptorsOnce();
-  return protobuf_Commands_2eproto::file_level_metadata[33].descriptor;
+  return protobuf_Commands_2eproto::file_level_metadata[35].descriptor;
 }
 
 const CMD_Halls_QueryPlayerGameData& CMD_Halls_QueryPlayerGameData::default_instance() {
@@ -15702,11 +19090,7 @@ const CMD_Halls_QueryPlayerGameData& CMD_Halls_QueryPlayerGameData::default_inst
 }
 
 CMD_Halls_QueryPlayerGameData* CMD_Halls_QueryPlayerGameData::New(::google::protobuf::Arena* arena) const {
-  CMD_Halls_QueryPlayerGameData* n = new CMD_Halls_QueryPlayerGameData;
-  if (arena != NULL) {
-    arena->Own(n);
-  }
-  return n;
+  return ::google::protobuf::Arena::CreateMessage<CMD_Halls_QueryPlayerGameData>(arena);
 }
 
 void CMD_Halls_QueryPlayerGameData::Clear() {
@@ -15878,6 +19262,21 @@ bool CMD_Halls_QueryPlayerGameData::IsInitialized() const {
 
 void CMD_Halls_QueryPlayerGameData::Swap(CMD_Halls_QueryPlayerGameData* other) {
   if (other == this) return;
+  if (GetArenaNoVirtual() == other->GetArenaNoVirtual()) {
+    InternalSwap(other);
+  } else {
+    CMD_Halls_QueryPlayerGameData* temp = New(GetArenaNoVirtual());
+    temp->MergeFrom(*other);
+    other->CopyFrom(*this);
+    InternalSwap(temp);
+    if (GetArenaNoVirtual() == NULL) {
+      delete temp;
+    }
+  }
+}
+void CMD_Halls_QueryPlayerGameData::UnsafeArenaSwap(CMD_Halls_QueryPlayerGameData* other) {
+  if (other == this) return;
+  GOOGLE_DCHECK(GetArenaNoVirtual() == other->GetArenaNoVirtual());
   InternalSwap(other);
 }
 void CMD_Halls_QueryPlayerGameData::InternalSwap(CMD_Halls_QueryPlayerGameData* other) {
@@ -15888,7 +19287,7 @@ void CMD_Halls_QueryPlayerGameData::InternalSwap(CMD_Halls_QueryPlayerGameData*
 
 ::google::protobuf::Metadata CMD_Halls_QueryPlayerGameData::GetMetadata() const {
   protobuf_Commands_2eproto::protobuf_AssignDescriptorsOnce();
-  return protobuf_Commands_2eproto::file_level_metadata[33];
+  return protobuf_Commands_2eproto::file_level_metadata[35];
 }
 
 #if PROTOBUF_INLINE_NOT_IN_HEADERS
@@ -15940,6 +19339,16 @@ CMD_Halls_ListGames::CMD_Halls_ListGames()
   SharedCtor();
   // @@protoc_insertion_point(constructor:CMD_Halls_ListGames)
 }
+CMD_Halls_ListGames::CMD_Halls_ListGames(::google::protobuf::Arena* arena)
+  : ::google::protobuf::Message(),
+  _internal_metadata_(arena) {
+#ifdef GOOGLE_PROTOBUF_NO_STATIC_INITIALIZER
+  protobuf_Commands_2eproto::InitDefaults();
+#endif  // GOOGLE_PROTOBUF_NO_STATIC_INITIALIZER
+  SharedCtor();
+  RegisterArenaDtor(arena);
+  // @@protoc_insertion_point(arena_constructor:CMD_Halls_ListGames)
+}
 CMD_Halls_ListGames::CMD_Halls_ListGames(const CMD_Halls_ListGames& from)
   : ::google::protobuf::Message(),
       _internal_metadata_(NULL),
@@ -15963,8 +19372,19 @@ CMD_Halls_ListGames::~CMD_Halls_ListGames() {
 }
 
 void CMD_Halls_ListGames::SharedDtor() {
+  ::google::protobuf::Arena* arena = GetArenaNoVirtual();
+  if (arena != NULL) {
+    return;
+  }
+
 }
 
+void CMD_Halls_ListGames::ArenaDtor(void* object) {
+  CMD_Halls_ListGames* _this = reinterpret_cast< CMD_Halls_ListGames* >(object);
+  (void)_this;
+}
+void CMD_Halls_ListGames::RegisterArenaDtor(::google::protobuf::Arena* arena) {
+}
 void CMD_Halls_ListGames::SetCachedSize(int size) const {
   GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
   _cached_size_ = size;
@@ -15972,7 +19392,7 @@ void CMD_Halls_ListGames::SetCachedSize(int size) const {
 }
 const ::google::protobuf::Descriptor* CMD_Halls_ListGames::descriptor() {
   protobuf_Commands_2eproto::protobuf_AssignDescriptorsOnce();
-  return protobuf_Commands_2eproto::file_level_metadata[34].descriptor;
+  return protobuf_Commands_2eproto::file_level_metadata[36].descriptor;
 }
 
 const CMD_Halls_ListGames& CMD_Halls_ListGames::default_instance() {
@@ -15981,11 +19401,7 @@ const CMD_Halls_ListGames& CMD_Halls_ListGames::default_instance() {
 }
 
 CMD_Halls_ListGames* CMD_Halls_ListGames::New(::google::protobuf::Arena* arena) const {
-  CMD_Halls_ListGames* n = new CMD_Halls_ListGames;
-  if (arena != NULL) {
-    arena->Own(n);
-  }
-  return n;
+  return ::google::protobuf::Arena::CreateMessage<CMD_Halls_ListGames>(arena);
 }
 
 void CMD_Halls_ListGames::Clear() {
@@ -16190,6 +19606,21 @@ bool CMD_Halls_ListGames::IsInitialized() const {
 
 void CMD_Halls_ListGames::Swap(CMD_Halls_ListGames* other) {
   if (other == this) return;
+  if (GetArenaNoVirtual() == other->GetArenaNoVirtual()) {
+    InternalSwap(other);
+  } else {
+    CMD_Halls_ListGames* temp = New(GetArenaNoVirtual());
+    temp->MergeFrom(*other);
+    other->CopyFrom(*this);
+    InternalSwap(temp);
+    if (GetArenaNoVirtual() == NULL) {
+      delete temp;
+    }
+  }
+}
+void CMD_Halls_ListGames::UnsafeArenaSwap(CMD_Halls_ListGames* other) {
+  if (other == this) return;
+  GOOGLE_DCHECK(GetArenaNoVirtual() == other->GetArenaNoVirtual());
   InternalSwap(other);
 }
 void CMD_Halls_ListGames::InternalSwap(CMD_Halls_ListGames* other) {
@@ -16201,7 +19632,7 @@ void CMD_Halls_ListGames::InternalSwap(CMD_Halls_ListGames* other) {
 
 ::google::protobuf::Metadata CMD_Halls_ListGames::GetMetadata() const {
   protobuf_Commands_2eproto::protobuf_AssignDescriptorsOnce();
-  return protobuf_Commands_2eproto::file_level_metadata[34];
+  return protobuf_Commands_2eproto::file_level_metadata[36];
 }
 
 #if PROTOBUF_INLINE_NOT_IN_HEADERS
@@ -16269,6 +19700,16 @@ CMD_Hallsmgr_RequestAllocClient::CMD_Hallsmgr_RequestAllocClient()
   SharedCtor();
   // @@protoc_insertion_point(constructor:CMD_Hallsmgr_RequestAllocClient)
 }
+CMD_Hallsmgr_RequestAllocClient::CMD_Hallsmgr_RequestAllocClient(::google::protobuf::Arena* arena)
+  : ::google::protobuf::Message(),
+  _internal_metadata_(arena) {
+#ifdef GOOGLE_PROTOBUF_NO_STATIC_INITIALIZER
+  protobuf_Commands_2eproto::InitDefaults();
+#endif  // GOOGLE_PROTOBUF_NO_STATIC_INITIALIZER
+  SharedCtor();
+  RegisterArenaDtor(arena);
+  // @@protoc_insertion_point(arena_constructor:CMD_Hallsmgr_RequestAllocClient)
+}
 CMD_Hallsmgr_RequestAllocClient::CMD_Hallsmgr_RequestAllocClient(const CMD_Hallsmgr_RequestAllocClient& from)
   : ::google::protobuf::Message(),
       _internal_metadata_(NULL),
@@ -16276,15 +19717,18 @@ CMD_Hallsmgr_RequestAllocClient::CMD_Hallsmgr_RequestAllocClient(const CMD_Halls
   _internal_metadata_.MergeFrom(from._internal_metadata_);
   commitaccountname_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
   if (from.commitaccountname().size() > 0) {
-    commitaccountname_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.commitaccountname_);
+    commitaccountname_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.commitaccountname(),
+      GetArenaNoVirtual());
   }
   password_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
   if (from.password().size() > 0) {
-    password_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.password_);
+    password_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.password(),
+      GetArenaNoVirtual());
   }
   datas_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
   if (from.datas().size() > 0) {
-    datas_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.datas_);
+    datas_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.datas(),
+      GetArenaNoVirtual());
   }
   ::memcpy(&foundobjectid_, &from.foundobjectid_,
     reinterpret_cast<char*>(&foundappid_) -
@@ -16307,11 +19751,22 @@ CMD_Hallsmgr_RequestAllocClient::~CMD_Hallsmgr_RequestAllocClient() {
 }
 
 void CMD_Hallsmgr_RequestAllocClient::SharedDtor() {
-  commitaccountname_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  password_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  datas_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  ::google::protobuf::Arena* arena = GetArenaNoVirtual();
+  if (arena != NULL) {
+    return;
+  }
+
+  commitaccountname_.Destroy(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), arena);
+  password_.Destroy(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), arena);
+  datas_.Destroy(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), arena);
 }
 
+void CMD_Hallsmgr_RequestAllocClient::ArenaDtor(void* object) {
+  CMD_Hallsmgr_RequestAllocClient* _this = reinterpret_cast< CMD_Hallsmgr_RequestAllocClient* >(object);
+  (void)_this;
+}
+void CMD_Hallsmgr_RequestAllocClient::RegisterArenaDtor(::google::protobuf::Arena* arena) {
+}
 void CMD_Hallsmgr_RequestAllocClient::SetCachedSize(int size) const {
   GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
   _cached_size_ = size;
@@ -16319,7 +19774,7 @@ void CMD_Hallsmgr_RequestAllocClient::SetCachedSize(int size) const {
 }
 const ::google::protobuf::Descriptor* CMD_Hallsmgr_RequestAllocClient::descriptor() {
   protobuf_Commands_2eproto::protobuf_AssignDescriptorsOnce();
-  return protobuf_Commands_2eproto::file_level_metadata[35].descriptor;
+  return protobuf_Commands_2eproto::file_level_metadata[37].descriptor;
 }
 
 const CMD_Hallsmgr_RequestAllocClient& CMD_Hallsmgr_RequestAllocClient::default_instance() {
@@ -16328,18 +19783,14 @@ const CMD_Hallsmgr_RequestAllocClient& CMD_Hallsmgr_RequestAllocClient::default_
 }
 
 CMD_Hallsmgr_RequestAllocClient* CMD_Hallsmgr_RequestAllocClient::New(::google::protobuf::Arena* arena) const {
-  CMD_Hallsmgr_RequestAllocClient* n = new CMD_Hallsmgr_RequestAllocClient;
-  if (arena != NULL) {
-    arena->Own(n);
-  }
-  return n;
+  return ::google::protobuf::Arena::CreateMessage<CMD_Hallsmgr_RequestAllocClient>(arena);
 }
 
 void CMD_Hallsmgr_RequestAllocClient::Clear() {
 // @@protoc_insertion_point(message_clear_start:CMD_Hallsmgr_RequestAllocClient)
-  commitaccountname_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  password_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  datas_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  commitaccountname_.ClearToEmpty(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
+  password_.ClearToEmpty(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
+  datas_.ClearToEmpty(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
   ::memset(&foundobjectid_, 0, reinterpret_cast<char*>(&foundappid_) -
     reinterpret_cast<char*>(&foundobjectid_) + sizeof(foundappid_));
 }
@@ -16597,16 +20048,13 @@ void CMD_Hallsmgr_RequestAllocClient::MergeFrom(const CMD_Hallsmgr_RequestAllocC
   GOOGLE_DCHECK_NE(&from, this);
   _internal_metadata_.MergeFrom(from._internal_metadata_);
   if (from.commitaccountname().size() > 0) {
-
-    commitaccountname_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.commitaccountname_);
+    set_commitaccountname(from.commitaccountname());
   }
   if (from.password().size() > 0) {
-
-    password_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.password_);
+    set_password(from.password());
   }
   if (from.datas().size() > 0) {
-
-    datas_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.datas_);
+    set_datas(from.datas());
   }
   if (from.foundobjectid() != 0) {
     set_foundobjectid(from.foundobjectid());
@@ -16636,6 +20084,21 @@ bool CMD_Hallsmgr_RequestAllocClient::IsInitialized() const {
 
 void CMD_Hallsmgr_RequestAllocClient::Swap(CMD_Hallsmgr_RequestAllocClient* other) {
   if (other == this) return;
+  if (GetArenaNoVirtual() == other->GetArenaNoVirtual()) {
+    InternalSwap(other);
+  } else {
+    CMD_Hallsmgr_RequestAllocClient* temp = New(GetArenaNoVirtual());
+    temp->MergeFrom(*other);
+    other->CopyFrom(*this);
+    InternalSwap(temp);
+    if (GetArenaNoVirtual() == NULL) {
+      delete temp;
+    }
+  }
+}
+void CMD_Hallsmgr_RequestAllocClient::UnsafeArenaSwap(CMD_Hallsmgr_RequestAllocClient* other) {
+  if (other == this) return;
+  GOOGLE_DCHECK(GetArenaNoVirtual() == other->GetArenaNoVirtual());
   InternalSwap(other);
 }
 void CMD_Hallsmgr_RequestAllocClient::InternalSwap(CMD_Hallsmgr_RequestAllocClient* other) {
@@ -16649,7 +20112,7 @@ void CMD_Hallsmgr_RequestAllocClient::InternalSwap(CMD_Hallsmgr_RequestAllocClie
 
 ::google::protobuf::Metadata CMD_Hallsmgr_RequestAllocClient::GetMetadata() const {
   protobuf_Commands_2eproto::protobuf_AssignDescriptorsOnce();
-  return protobuf_Commands_2eproto::file_level_metadata[35];
+  return protobuf_Commands_2eproto::file_level_metadata[37];
 }
 
 #if PROTOBUF_INLINE_NOT_IN_HEADERS
@@ -16657,45 +20120,46 @@ void CMD_Hallsmgr_RequestAllocClient::InternalSwap(CMD_Hallsmgr_RequestAllocClie
 
 // string commitAccountName = 1;
 void CMD_Hallsmgr_RequestAllocClient::clear_commitaccountname() {
-  commitaccountname_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  commitaccountname_.ClearToEmpty(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 const ::std::string& CMD_Hallsmgr_RequestAllocClient::commitaccountname() const {
   // @@protoc_insertion_point(field_get:CMD_Hallsmgr_RequestAllocClient.commitAccountName)
-  return commitaccountname_.GetNoArena();
+  return commitaccountname_.Get();
 }
 void CMD_Hallsmgr_RequestAllocClient::set_commitaccountname(const ::std::string& value) {
   
-  commitaccountname_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  commitaccountname_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value, GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set:CMD_Hallsmgr_RequestAllocClient.commitAccountName)
 }
-#if LANG_CXX11
-void CMD_Hallsmgr_RequestAllocClient::set_commitaccountname(::std::string&& value) {
-  
-  commitaccountname_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:CMD_Hallsmgr_RequestAllocClient.commitAccountName)
-}
-#endif
 void CMD_Hallsmgr_RequestAllocClient::set_commitaccountname(const char* value) {
   
-  commitaccountname_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  commitaccountname_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+              GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_char:CMD_Hallsmgr_RequestAllocClient.commitAccountName)
 }
-void CMD_Hallsmgr_RequestAllocClient::set_commitaccountname(const char* value, size_t size) {
+void CMD_Hallsmgr_RequestAllocClient::set_commitaccountname(const char* value,
+    size_t size) {
   
-  commitaccountname_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
+  commitaccountname_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_pointer:CMD_Hallsmgr_RequestAllocClient.commitAccountName)
 }
 ::std::string* CMD_Hallsmgr_RequestAllocClient::mutable_commitaccountname() {
   
   // @@protoc_insertion_point(field_mutable:CMD_Hallsmgr_RequestAllocClient.commitAccountName)
-  return commitaccountname_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return commitaccountname_.Mutable(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 ::std::string* CMD_Hallsmgr_RequestAllocClient::release_commitaccountname() {
   // @@protoc_insertion_point(field_release:CMD_Hallsmgr_RequestAllocClient.commitAccountName)
   
-  return commitaccountname_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return commitaccountname_.Release(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
+}
+::std::string* CMD_Hallsmgr_RequestAllocClient::unsafe_arena_release_commitaccountname() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:CMD_Hallsmgr_RequestAllocClient.commitAccountName)
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  
+  return commitaccountname_.UnsafeArenaRelease(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      GetArenaNoVirtual());
 }
 void CMD_Hallsmgr_RequestAllocClient::set_allocated_commitaccountname(::std::string* commitaccountname) {
   if (commitaccountname != NULL) {
@@ -16703,51 +20167,65 @@ void CMD_Hallsmgr_RequestAllocClient::set_allocated_commitaccountname(::std::str
   } else {
     
   }
-  commitaccountname_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), commitaccountname);
+  commitaccountname_.SetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), commitaccountname,
+      GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_allocated:CMD_Hallsmgr_RequestAllocClient.commitAccountName)
 }
+void CMD_Hallsmgr_RequestAllocClient::unsafe_arena_set_allocated_commitaccountname(
+    ::std::string* commitaccountname) {
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  if (commitaccountname != NULL) {
+    
+  } else {
+    
+  }
+  commitaccountname_.UnsafeArenaSetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      commitaccountname, GetArenaNoVirtual());
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:CMD_Hallsmgr_RequestAllocClient.commitAccountName)
+}
 
 // string password = 2;
 void CMD_Hallsmgr_RequestAllocClient::clear_password() {
-  password_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  password_.ClearToEmpty(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 const ::std::string& CMD_Hallsmgr_RequestAllocClient::password() const {
   // @@protoc_insertion_point(field_get:CMD_Hallsmgr_RequestAllocClient.password)
-  return password_.GetNoArena();
+  return password_.Get();
 }
 void CMD_Hallsmgr_RequestAllocClient::set_password(const ::std::string& value) {
   
-  password_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  password_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value, GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set:CMD_Hallsmgr_RequestAllocClient.password)
 }
-#if LANG_CXX11
-void CMD_Hallsmgr_RequestAllocClient::set_password(::std::string&& value) {
-  
-  password_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:CMD_Hallsmgr_RequestAllocClient.password)
-}
-#endif
 void CMD_Hallsmgr_RequestAllocClient::set_password(const char* value) {
   
-  password_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  password_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+              GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_char:CMD_Hallsmgr_RequestAllocClient.password)
 }
-void CMD_Hallsmgr_RequestAllocClient::set_password(const char* value, size_t size) {
+void CMD_Hallsmgr_RequestAllocClient::set_password(const char* value,
+    size_t size) {
   
-  password_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
+  password_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_pointer:CMD_Hallsmgr_RequestAllocClient.password)
 }
 ::std::string* CMD_Hallsmgr_RequestAllocClient::mutable_password() {
   
   // @@protoc_insertion_point(field_mutable:CMD_Hallsmgr_RequestAllocClient.password)
-  return password_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return password_.Mutable(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 ::std::string* CMD_Hallsmgr_RequestAllocClient::release_password() {
   // @@protoc_insertion_point(field_release:CMD_Hallsmgr_RequestAllocClient.password)
   
-  return password_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return password_.Release(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
+}
+::std::string* CMD_Hallsmgr_RequestAllocClient::unsafe_arena_release_password() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:CMD_Hallsmgr_RequestAllocClient.password)
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  
+  return password_.UnsafeArenaRelease(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      GetArenaNoVirtual());
 }
 void CMD_Hallsmgr_RequestAllocClient::set_allocated_password(::std::string* password) {
   if (password != NULL) {
@@ -16755,51 +20233,65 @@ void CMD_Hallsmgr_RequestAllocClient::set_allocated_password(::std::string* pass
   } else {
     
   }
-  password_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), password);
+  password_.SetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), password,
+      GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_allocated:CMD_Hallsmgr_RequestAllocClient.password)
 }
+void CMD_Hallsmgr_RequestAllocClient::unsafe_arena_set_allocated_password(
+    ::std::string* password) {
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  if (password != NULL) {
+    
+  } else {
+    
+  }
+  password_.UnsafeArenaSetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      password, GetArenaNoVirtual());
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:CMD_Hallsmgr_RequestAllocClient.password)
+}
 
 // bytes datas = 3;
 void CMD_Hallsmgr_RequestAllocClient::clear_datas() {
-  datas_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  datas_.ClearToEmpty(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 const ::std::string& CMD_Hallsmgr_RequestAllocClient::datas() const {
   // @@protoc_insertion_point(field_get:CMD_Hallsmgr_RequestAllocClient.datas)
-  return datas_.GetNoArena();
+  return datas_.Get();
 }
 void CMD_Hallsmgr_RequestAllocClient::set_datas(const ::std::string& value) {
   
-  datas_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  datas_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value, GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set:CMD_Hallsmgr_RequestAllocClient.datas)
 }
-#if LANG_CXX11
-void CMD_Hallsmgr_RequestAllocClient::set_datas(::std::string&& value) {
-  
-  datas_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:CMD_Hallsmgr_RequestAllocClient.datas)
-}
-#endif
 void CMD_Hallsmgr_RequestAllocClient::set_datas(const char* value) {
   
-  datas_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  datas_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+              GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_char:CMD_Hallsmgr_RequestAllocClient.datas)
 }
-void CMD_Hallsmgr_RequestAllocClient::set_datas(const void* value, size_t size) {
+void CMD_Hallsmgr_RequestAllocClient::set_datas(const void* value,
+    size_t size) {
   
-  datas_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
+  datas_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_pointer:CMD_Hallsmgr_RequestAllocClient.datas)
 }
 ::std::string* CMD_Hallsmgr_RequestAllocClient::mutable_datas() {
   
   // @@protoc_insertion_point(field_mutable:CMD_Hallsmgr_RequestAllocClient.datas)
-  return datas_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return datas_.Mutable(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 ::std::string* CMD_Hallsmgr_RequestAllocClient::release_datas() {
   // @@protoc_insertion_point(field_release:CMD_Hallsmgr_RequestAllocClient.datas)
   
-  return datas_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return datas_.Release(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
+}
+::std::string* CMD_Hallsmgr_RequestAllocClient::unsafe_arena_release_datas() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:CMD_Hallsmgr_RequestAllocClient.datas)
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  
+  return datas_.UnsafeArenaRelease(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      GetArenaNoVirtual());
 }
 void CMD_Hallsmgr_RequestAllocClient::set_allocated_datas(::std::string* datas) {
   if (datas != NULL) {
@@ -16807,9 +20299,22 @@ void CMD_Hallsmgr_RequestAllocClient::set_allocated_datas(::std::string* datas)
   } else {
     
   }
-  datas_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), datas);
+  datas_.SetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), datas,
+      GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_allocated:CMD_Hallsmgr_RequestAllocClient.datas)
 }
+void CMD_Hallsmgr_RequestAllocClient::unsafe_arena_set_allocated_datas(
+    ::std::string* datas) {
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  if (datas != NULL) {
+    
+  } else {
+    
+  }
+  datas_.UnsafeArenaSetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      datas, GetArenaNoVirtual());
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:CMD_Hallsmgr_RequestAllocClient.datas)
+}
 
 // uint64 foundObjectID = 4;
 void CMD_Hallsmgr_RequestAllocClient::clear_foundobjectid() {
@@ -16850,6 +20355,7 @@ const int CMD_Hallsmgr_OnRequestAllocClientCB::kCommitAccountNameFieldNumber;
 const int CMD_Hallsmgr_OnRequestAllocClientCB::kErrcodeFieldNumber;
 const int CMD_Hallsmgr_OnRequestAllocClientCB::kLoginSessionIDFieldNumber;
 const int CMD_Hallsmgr_OnRequestAllocClientCB::kTokenIDFieldNumber;
+const int CMD_Hallsmgr_OnRequestAllocClientCB::kHallsIDFieldNumber;
 #endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
 
 CMD_Hallsmgr_OnRequestAllocClientCB::CMD_Hallsmgr_OnRequestAllocClientCB()
@@ -16860,6 +20366,16 @@ CMD_Hallsmgr_OnRequestAllocClientCB::CMD_Hallsmgr_OnRequestAllocClientCB()
   SharedCtor();
   // @@protoc_insertion_point(constructor:CMD_Hallsmgr_OnRequestAllocClientCB)
 }
+CMD_Hallsmgr_OnRequestAllocClientCB::CMD_Hallsmgr_OnRequestAllocClientCB(::google::protobuf::Arena* arena)
+  : ::google::protobuf::Message(),
+  _internal_metadata_(arena) {
+#ifdef GOOGLE_PROTOBUF_NO_STATIC_INITIALIZER
+  protobuf_Commands_2eproto::InitDefaults();
+#endif  // GOOGLE_PROTOBUF_NO_STATIC_INITIALIZER
+  SharedCtor();
+  RegisterArenaDtor(arena);
+  // @@protoc_insertion_point(arena_constructor:CMD_Hallsmgr_OnRequestAllocClientCB)
+}
 CMD_Hallsmgr_OnRequestAllocClientCB::CMD_Hallsmgr_OnRequestAllocClientCB(const CMD_Hallsmgr_OnRequestAllocClientCB& from)
   : ::google::protobuf::Message(),
       _internal_metadata_(NULL),
@@ -16867,23 +20383,25 @@ CMD_Hallsmgr_OnRequestAllocClientCB::CMD_Hallsmgr_OnRequestAllocClientCB(const C
   _internal_metadata_.MergeFrom(from._internal_metadata_);
   ip_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
   if (from.ip().size() > 0) {
-    ip_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.ip_);
+    ip_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.ip(),
+      GetArenaNoVirtual());
   }
   commitaccountname_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
   if (from.commitaccountname().size() > 0) {
-    commitaccountname_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.commitaccountname_);
+    commitaccountname_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.commitaccountname(),
+      GetArenaNoVirtual());
   }
   ::memcpy(&port_, &from.port_,
-    reinterpret_cast<char*>(&tokenid_) -
-    reinterpret_cast<char*>(&port_) + sizeof(tokenid_));
+    reinterpret_cast<char*>(&hallsid_) -
+    reinterpret_cast<char*>(&port_) + sizeof(hallsid_));
   // @@protoc_insertion_point(copy_constructor:CMD_Hallsmgr_OnRequestAllocClientCB)
 }
 
 void CMD_Hallsmgr_OnRequestAllocClientCB::SharedCtor() {
   ip_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
   commitaccountname_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  ::memset(&port_, 0, reinterpret_cast<char*>(&tokenid_) -
-    reinterpret_cast<char*>(&port_) + sizeof(tokenid_));
+  ::memset(&port_, 0, reinterpret_cast<char*>(&hallsid_) -
+    reinterpret_cast<char*>(&port_) + sizeof(hallsid_));
   _cached_size_ = 0;
 }
 
@@ -16893,10 +20411,21 @@ CMD_Hallsmgr_OnRequestAllocClientCB::~CMD_Hallsmgr_OnRequestAllocClientCB() {
 }
 
 void CMD_Hallsmgr_OnRequestAllocClientCB::SharedDtor() {
-  ip_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  commitaccountname_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  ::google::protobuf::Arena* arena = GetArenaNoVirtual();
+  if (arena != NULL) {
+    return;
+  }
+
+  ip_.Destroy(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), arena);
+  commitaccountname_.Destroy(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), arena);
 }
 
+void CMD_Hallsmgr_OnRequestAllocClientCB::ArenaDtor(void* object) {
+  CMD_Hallsmgr_OnRequestAllocClientCB* _this = reinterpret_cast< CMD_Hallsmgr_OnRequestAllocClientCB* >(object);
+  (void)_this;
+}
+void CMD_Hallsmgr_OnRequestAllocClientCB::RegisterArenaDtor(::google::protobuf::Arena* arena) {
+}
 void CMD_Hallsmgr_OnRequestAllocClientCB::SetCachedSize(int size) const {
   GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
   _cached_size_ = size;
@@ -16904,7 +20433,7 @@ void CMD_Hallsmgr_OnRequestAllocClientCB::SetCachedSize(int size) const {
 }
 const ::google::protobuf::Descriptor* CMD_Hallsmgr_OnRequestAllocClientCB::descriptor() {
   protobuf_Commands_2eproto::protobuf_AssignDescriptorsOnce();
-  return protobuf_Commands_2eproto::file_level_metadata[36].descriptor;
+  return protobuf_Commands_2eproto::file_level_metadata[38].descriptor;
 }
 
 const CMD_Hallsmgr_OnRequestAllocClientCB& CMD_Hallsmgr_OnRequestAllocClientCB::default_instance() {
@@ -16913,19 +20442,15 @@ const CMD_Hallsmgr_OnRequestAllocClientCB& CMD_Hallsmgr_OnRequestAllocClientCB::
 }
 
 CMD_Hallsmgr_OnRequestAllocClientCB* CMD_Hallsmgr_OnRequestAllocClientCB::New(::google::protobuf::Arena* arena) const {
-  CMD_Hallsmgr_OnRequestAllocClientCB* n = new CMD_Hallsmgr_OnRequestAllocClientCB;
-  if (arena != NULL) {
-    arena->Own(n);
-  }
-  return n;
+  return ::google::protobuf::Arena::CreateMessage<CMD_Hallsmgr_OnRequestAllocClientCB>(arena);
 }
 
 void CMD_Hallsmgr_OnRequestAllocClientCB::Clear() {
 // @@protoc_insertion_point(message_clear_start:CMD_Hallsmgr_OnRequestAllocClientCB)
-  ip_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  commitaccountname_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  ::memset(&port_, 0, reinterpret_cast<char*>(&tokenid_) -
-    reinterpret_cast<char*>(&port_) + sizeof(tokenid_));
+  ip_.ClearToEmpty(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
+  commitaccountname_.ClearToEmpty(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
+  ::memset(&port_, 0, reinterpret_cast<char*>(&hallsid_) -
+    reinterpret_cast<char*>(&port_) + sizeof(hallsid_));
 }
 
 bool CMD_Hallsmgr_OnRequestAllocClientCB::MergePartialFromCodedStream(
@@ -17021,6 +20546,19 @@ bool CMD_Hallsmgr_OnRequestAllocClientCB::MergePartialFromCodedStream(
         break;
       }
 
+      // uint64 hallsID = 7;
+      case 7: {
+        if (tag == 56u) {
+
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
+                 input, &hallsid_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
       default: {
       handle_unusual:
         if (tag == 0 ||
@@ -17086,6 +20624,11 @@ void CMD_Hallsmgr_OnRequestAllocClientCB::SerializeWithCachedSizes(
     ::google::protobuf::internal::WireFormatLite::WriteUInt64(6, this->tokenid(), output);
   }
 
+  // uint64 hallsID = 7;
+  if (this->hallsid() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt64(7, this->hallsid(), output);
+  }
+
   // @@protoc_insertion_point(serialize_end:CMD_Hallsmgr_OnRequestAllocClientCB)
 }
 
@@ -17136,6 +20679,11 @@ void CMD_Hallsmgr_OnRequestAllocClientCB::SerializeWithCachedSizes(
     target = ::google::protobuf::internal::WireFormatLite::WriteUInt64ToArray(6, this->tokenid(), target);
   }
 
+  // uint64 hallsID = 7;
+  if (this->hallsid() != 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteUInt64ToArray(7, this->hallsid(), target);
+  }
+
   // @@protoc_insertion_point(serialize_to_array_end:CMD_Hallsmgr_OnRequestAllocClientCB)
   return target;
 }
@@ -17185,6 +20733,13 @@ size_t CMD_Hallsmgr_OnRequestAllocClientCB::ByteSizeLong() const {
         this->tokenid());
   }
 
+  // uint64 hallsID = 7;
+  if (this->hallsid() != 0) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::UInt64Size(
+        this->hallsid());
+  }
+
   int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
   GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
   _cached_size_ = cached_size;
@@ -17212,12 +20767,10 @@ void CMD_Hallsmgr_OnRequestAllocClientCB::MergeFrom(const CMD_Hallsmgr_OnRequest
   GOOGLE_DCHECK_NE(&from, this);
   _internal_metadata_.MergeFrom(from._internal_metadata_);
   if (from.ip().size() > 0) {
-
-    ip_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.ip_);
+    set_ip(from.ip());
   }
   if (from.commitaccountname().size() > 0) {
-
-    commitaccountname_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.commitaccountname_);
+    set_commitaccountname(from.commitaccountname());
   }
   if (from.port() != 0) {
     set_port(from.port());
@@ -17231,6 +20784,9 @@ void CMD_Hallsmgr_OnRequestAllocClientCB::MergeFrom(const CMD_Hallsmgr_OnRequest
   if (from.tokenid() != 0) {
     set_tokenid(from.tokenid());
   }
+  if (from.hallsid() != 0) {
+    set_hallsid(from.hallsid());
+  }
 }
 
 void CMD_Hallsmgr_OnRequestAllocClientCB::CopyFrom(const ::google::protobuf::Message& from) {
@@ -17253,6 +20809,21 @@ bool CMD_Hallsmgr_OnRequestAllocClientCB::IsInitialized() const {
 
 void CMD_Hallsmgr_OnRequestAllocClientCB::Swap(CMD_Hallsmgr_OnRequestAllocClientCB* other) {
   if (other == this) return;
+  if (GetArenaNoVirtual() == other->GetArenaNoVirtual()) {
+    InternalSwap(other);
+  } else {
+    CMD_Hallsmgr_OnRequestAllocClientCB* temp = New(GetArenaNoVirtual());
+    temp->MergeFrom(*other);
+    other->CopyFrom(*this);
+    InternalSwap(temp);
+    if (GetArenaNoVirtual() == NULL) {
+      delete temp;
+    }
+  }
+}
+void CMD_Hallsmgr_OnRequestAllocClientCB::UnsafeArenaSwap(CMD_Hallsmgr_OnRequestAllocClientCB* other) {
+  if (other == this) return;
+  GOOGLE_DCHECK(GetArenaNoVirtual() == other->GetArenaNoVirtual());
   InternalSwap(other);
 }
 void CMD_Hallsmgr_OnRequestAllocClientCB::InternalSwap(CMD_Hallsmgr_OnRequestAllocClientCB* other) {
@@ -17262,12 +20833,13 @@ void CMD_Hallsmgr_OnRequestAllocClientCB::InternalSwap(CMD_Hallsmgr_OnRequestAll
   std::swap(errcode_, other->errcode_);
   std::swap(loginsessionid_, other->loginsessionid_);
   std::swap(tokenid_, other->tokenid_);
+  std::swap(hallsid_, other->hallsid_);
   std::swap(_cached_size_, other->_cached_size_);
 }
 
 ::google::protobuf::Metadata CMD_Hallsmgr_OnRequestAllocClientCB::GetMetadata() const {
   protobuf_Commands_2eproto::protobuf_AssignDescriptorsOnce();
-  return protobuf_Commands_2eproto::file_level_metadata[36];
+  return protobuf_Commands_2eproto::file_level_metadata[38];
 }
 
 #if PROTOBUF_INLINE_NOT_IN_HEADERS
@@ -17275,45 +20847,46 @@ void CMD_Hallsmgr_OnRequestAllocClientCB::InternalSwap(CMD_Hallsmgr_OnRequestAll
 
 // string ip = 1;
 void CMD_Hallsmgr_OnRequestAllocClientCB::clear_ip() {
-  ip_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  ip_.ClearToEmpty(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 const ::std::string& CMD_Hallsmgr_OnRequestAllocClientCB::ip() const {
   // @@protoc_insertion_point(field_get:CMD_Hallsmgr_OnRequestAllocClientCB.ip)
-  return ip_.GetNoArena();
+  return ip_.Get();
 }
 void CMD_Hallsmgr_OnRequestAllocClientCB::set_ip(const ::std::string& value) {
   
-  ip_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  ip_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value, GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set:CMD_Hallsmgr_OnRequestAllocClientCB.ip)
 }
-#if LANG_CXX11
-void CMD_Hallsmgr_OnRequestAllocClientCB::set_ip(::std::string&& value) {
-  
-  ip_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:CMD_Hallsmgr_OnRequestAllocClientCB.ip)
-}
-#endif
 void CMD_Hallsmgr_OnRequestAllocClientCB::set_ip(const char* value) {
   
-  ip_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  ip_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+              GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_char:CMD_Hallsmgr_OnRequestAllocClientCB.ip)
 }
-void CMD_Hallsmgr_OnRequestAllocClientCB::set_ip(const char* value, size_t size) {
+void CMD_Hallsmgr_OnRequestAllocClientCB::set_ip(const char* value,
+    size_t size) {
   
-  ip_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
+  ip_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_pointer:CMD_Hallsmgr_OnRequestAllocClientCB.ip)
 }
 ::std::string* CMD_Hallsmgr_OnRequestAllocClientCB::mutable_ip() {
   
   // @@protoc_insertion_point(field_mutable:CMD_Hallsmgr_OnRequestAllocClientCB.ip)
-  return ip_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return ip_.Mutable(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 ::std::string* CMD_Hallsmgr_OnRequestAllocClientCB::release_ip() {
   // @@protoc_insertion_point(field_release:CMD_Hallsmgr_OnRequestAllocClientCB.ip)
   
-  return ip_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return ip_.Release(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
+}
+::std::string* CMD_Hallsmgr_OnRequestAllocClientCB::unsafe_arena_release_ip() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:CMD_Hallsmgr_OnRequestAllocClientCB.ip)
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  
+  return ip_.UnsafeArenaRelease(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      GetArenaNoVirtual());
 }
 void CMD_Hallsmgr_OnRequestAllocClientCB::set_allocated_ip(::std::string* ip) {
   if (ip != NULL) {
@@ -17321,9 +20894,22 @@ void CMD_Hallsmgr_OnRequestAllocClientCB::set_allocated_ip(::std::string* ip) {
   } else {
     
   }
-  ip_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ip);
+  ip_.SetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ip,
+      GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_allocated:CMD_Hallsmgr_OnRequestAllocClientCB.ip)
 }
+void CMD_Hallsmgr_OnRequestAllocClientCB::unsafe_arena_set_allocated_ip(
+    ::std::string* ip) {
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  if (ip != NULL) {
+    
+  } else {
+    
+  }
+  ip_.UnsafeArenaSetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      ip, GetArenaNoVirtual());
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:CMD_Hallsmgr_OnRequestAllocClientCB.ip)
+}
 
 // int32 port = 2;
 void CMD_Hallsmgr_OnRequestAllocClientCB::clear_port() {
@@ -17341,45 +20927,46 @@ void CMD_Hallsmgr_OnRequestAllocClientCB::set_port(::google::protobuf::int32 val
 
 // string commitAccountName = 3;
 void CMD_Hallsmgr_OnRequestAllocClientCB::clear_commitaccountname() {
-  commitaccountname_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  commitaccountname_.ClearToEmpty(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 const ::std::string& CMD_Hallsmgr_OnRequestAllocClientCB::commitaccountname() const {
   // @@protoc_insertion_point(field_get:CMD_Hallsmgr_OnRequestAllocClientCB.commitAccountName)
-  return commitaccountname_.GetNoArena();
+  return commitaccountname_.Get();
 }
 void CMD_Hallsmgr_OnRequestAllocClientCB::set_commitaccountname(const ::std::string& value) {
   
-  commitaccountname_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  commitaccountname_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value, GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set:CMD_Hallsmgr_OnRequestAllocClientCB.commitAccountName)
 }
-#if LANG_CXX11
-void CMD_Hallsmgr_OnRequestAllocClientCB::set_commitaccountname(::std::string&& value) {
-  
-  commitaccountname_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:CMD_Hallsmgr_OnRequestAllocClientCB.commitAccountName)
-}
-#endif
 void CMD_Hallsmgr_OnRequestAllocClientCB::set_commitaccountname(const char* value) {
   
-  commitaccountname_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  commitaccountname_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+              GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_char:CMD_Hallsmgr_OnRequestAllocClientCB.commitAccountName)
 }
-void CMD_Hallsmgr_OnRequestAllocClientCB::set_commitaccountname(const char* value, size_t size) {
+void CMD_Hallsmgr_OnRequestAllocClientCB::set_commitaccountname(const char* value,
+    size_t size) {
   
-  commitaccountname_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
+  commitaccountname_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_pointer:CMD_Hallsmgr_OnRequestAllocClientCB.commitAccountName)
 }
 ::std::string* CMD_Hallsmgr_OnRequestAllocClientCB::mutable_commitaccountname() {
   
   // @@protoc_insertion_point(field_mutable:CMD_Hallsmgr_OnRequestAllocClientCB.commitAccountName)
-  return commitaccountname_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return commitaccountname_.Mutable(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 ::std::string* CMD_Hallsmgr_OnRequestAllocClientCB::release_commitaccountname() {
   // @@protoc_insertion_point(field_release:CMD_Hallsmgr_OnRequestAllocClientCB.commitAccountName)
   
-  return commitaccountname_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return commitaccountname_.Release(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
+}
+::std::string* CMD_Hallsmgr_OnRequestAllocClientCB::unsafe_arena_release_commitaccountname() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:CMD_Hallsmgr_OnRequestAllocClientCB.commitAccountName)
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  
+  return commitaccountname_.UnsafeArenaRelease(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      GetArenaNoVirtual());
 }
 void CMD_Hallsmgr_OnRequestAllocClientCB::set_allocated_commitaccountname(::std::string* commitaccountname) {
   if (commitaccountname != NULL) {
@@ -17387,9 +20974,22 @@ void CMD_Hallsmgr_OnRequestAllocClientCB::set_allocated_commitaccountname(::std:
   } else {
     
   }
-  commitaccountname_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), commitaccountname);
+  commitaccountname_.SetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), commitaccountname,
+      GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_allocated:CMD_Hallsmgr_OnRequestAllocClientCB.commitAccountName)
 }
+void CMD_Hallsmgr_OnRequestAllocClientCB::unsafe_arena_set_allocated_commitaccountname(
+    ::std::string* commitaccountname) {
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  if (commitaccountname != NULL) {
+    
+  } else {
+    
+  }
+  commitaccountname_.UnsafeArenaSetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      commitaccountname, GetArenaNoVirtual());
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:CMD_Hallsmgr_OnRequestAllocClientCB.commitAccountName)
+}
 
 // .ServerError errcode = 4;
 void CMD_Hallsmgr_OnRequestAllocClientCB::clear_errcode() {
@@ -17433,6 +21033,20 @@ void CMD_Hallsmgr_OnRequestAllocClientCB::set_tokenid(::google::protobuf::uint64
   // @@protoc_insertion_point(field_set:CMD_Hallsmgr_OnRequestAllocClientCB.tokenID)
 }
 
+// uint64 hallsID = 7;
+void CMD_Hallsmgr_OnRequestAllocClientCB::clear_hallsid() {
+  hallsid_ = GOOGLE_ULONGLONG(0);
+}
+::google::protobuf::uint64 CMD_Hallsmgr_OnRequestAllocClientCB::hallsid() const {
+  // @@protoc_insertion_point(field_get:CMD_Hallsmgr_OnRequestAllocClientCB.hallsID)
+  return hallsid_;
+}
+void CMD_Hallsmgr_OnRequestAllocClientCB::set_hallsid(::google::protobuf::uint64 value) {
+  
+  hallsid_ = value;
+  // @@protoc_insertion_point(field_set:CMD_Hallsmgr_OnRequestAllocClientCB.hallsID)
+}
+
 #endif  // PROTOBUF_INLINE_NOT_IN_HEADERS
 
 // ===================================================================
@@ -17457,6 +21071,16 @@ CMD_RoomPlayerInfo::CMD_RoomPlayerInfo()
   SharedCtor();
   // @@protoc_insertion_point(constructor:CMD_RoomPlayerInfo)
 }
+CMD_RoomPlayerInfo::CMD_RoomPlayerInfo(::google::protobuf::Arena* arena)
+  : ::google::protobuf::Message(),
+  _internal_metadata_(arena) {
+#ifdef GOOGLE_PROTOBUF_NO_STATIC_INITIALIZER
+  protobuf_Commands_2eproto::InitDefaults();
+#endif  // GOOGLE_PROTOBUF_NO_STATIC_INITIALIZER
+  SharedCtor();
+  RegisterArenaDtor(arena);
+  // @@protoc_insertion_point(arena_constructor:CMD_RoomPlayerInfo)
+}
 CMD_RoomPlayerInfo::CMD_RoomPlayerInfo(const CMD_RoomPlayerInfo& from)
   : ::google::protobuf::Message(),
       _internal_metadata_(NULL),
@@ -17464,11 +21088,13 @@ CMD_RoomPlayerInfo::CMD_RoomPlayerInfo(const CMD_RoomPlayerInfo& from)
   _internal_metadata_.MergeFrom(from._internal_metadata_);
   clientaddr_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
   if (from.clientaddr().size() > 0) {
-    clientaddr_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.clientaddr_);
+    clientaddr_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.clientaddr(),
+      GetArenaNoVirtual());
   }
   playername_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
   if (from.playername().size() > 0) {
-    playername_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.playername_);
+    playername_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.playername(),
+      GetArenaNoVirtual());
   }
   ::memcpy(&playerid_, &from.playerid_,
     reinterpret_cast<char*>(&playermodelid_) -
@@ -17490,10 +21116,21 @@ CMD_RoomPlayerInfo::~CMD_RoomPlayerInfo() {
 }
 
 void CMD_RoomPlayerInfo::SharedDtor() {
-  clientaddr_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  playername_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  ::google::protobuf::Arena* arena = GetArenaNoVirtual();
+  if (arena != NULL) {
+    return;
+  }
+
+  clientaddr_.Destroy(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), arena);
+  playername_.Destroy(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), arena);
 }
 
+void CMD_RoomPlayerInfo::ArenaDtor(void* object) {
+  CMD_RoomPlayerInfo* _this = reinterpret_cast< CMD_RoomPlayerInfo* >(object);
+  (void)_this;
+}
+void CMD_RoomPlayerInfo::RegisterArenaDtor(::google::protobuf::Arena* arena) {
+}
 void CMD_RoomPlayerInfo::SetCachedSize(int size) const {
   GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
   _cached_size_ = size;
@@ -17501,7 +21138,7 @@ void CMD_RoomPlayerInfo::SetCachedSize(int size) const {
 }
 const ::google::protobuf::Descriptor* CMD_RoomPlayerInfo::descriptor() {
   protobuf_Commands_2eproto::protobuf_AssignDescriptorsOnce();
-  return protobuf_Commands_2eproto::file_level_metadata[37].descriptor;
+  return protobuf_Commands_2eproto::file_level_metadata[39].descriptor;
 }
 
 const CMD_RoomPlayerInfo& CMD_RoomPlayerInfo::default_instance() {
@@ -17510,17 +21147,13 @@ const CMD_RoomPlayerInfo& CMD_RoomPlayerInfo::default_instance() {
 }
 
 CMD_RoomPlayerInfo* CMD_RoomPlayerInfo::New(::google::protobuf::Arena* arena) const {
-  CMD_RoomPlayerInfo* n = new CMD_RoomPlayerInfo;
-  if (arena != NULL) {
-    arena->Own(n);
-  }
-  return n;
+  return ::google::protobuf::Arena::CreateMessage<CMD_RoomPlayerInfo>(arena);
 }
 
 void CMD_RoomPlayerInfo::Clear() {
 // @@protoc_insertion_point(message_clear_start:CMD_RoomPlayerInfo)
-  clientaddr_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  playername_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  clientaddr_.ClearToEmpty(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
+  playername_.ClearToEmpty(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
   ::memset(&playerid_, 0, reinterpret_cast<char*>(&playermodelid_) -
     reinterpret_cast<char*>(&playerid_) + sizeof(playermodelid_));
 }
@@ -17897,12 +21530,10 @@ void CMD_RoomPlayerInfo::MergeFrom(const CMD_RoomPlayerInfo& from) {
   GOOGLE_DCHECK_NE(&from, this);
   _internal_metadata_.MergeFrom(from._internal_metadata_);
   if (from.clientaddr().size() > 0) {
-
-    clientaddr_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.clientaddr_);
+    set_clientaddr(from.clientaddr());
   }
   if (from.playername().size() > 0) {
-
-    playername_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.playername_);
+    set_playername(from.playername());
   }
   if (from.playerid() != 0) {
     set_playerid(from.playerid());
@@ -17947,6 +21578,21 @@ bool CMD_RoomPlayerInfo::IsInitialized() const {
 
 void CMD_RoomPlayerInfo::Swap(CMD_RoomPlayerInfo* other) {
   if (other == this) return;
+  if (GetArenaNoVirtual() == other->GetArenaNoVirtual()) {
+    InternalSwap(other);
+  } else {
+    CMD_RoomPlayerInfo* temp = New(GetArenaNoVirtual());
+    temp->MergeFrom(*other);
+    other->CopyFrom(*this);
+    InternalSwap(temp);
+    if (GetArenaNoVirtual() == NULL) {
+      delete temp;
+    }
+  }
+}
+void CMD_RoomPlayerInfo::UnsafeArenaSwap(CMD_RoomPlayerInfo* other) {
+  if (other == this) return;
+  GOOGLE_DCHECK(GetArenaNoVirtual() == other->GetArenaNoVirtual());
   InternalSwap(other);
 }
 void CMD_RoomPlayerInfo::InternalSwap(CMD_RoomPlayerInfo* other) {
@@ -17964,7 +21610,7 @@ void CMD_RoomPlayerInfo::InternalSwap(CMD_RoomPlayerInfo* other) {
 
 ::google::protobuf::Metadata CMD_RoomPlayerInfo::GetMetadata() const {
   protobuf_Commands_2eproto::protobuf_AssignDescriptorsOnce();
-  return protobuf_Commands_2eproto::file_level_metadata[37];
+  return protobuf_Commands_2eproto::file_level_metadata[39];
 }
 
 #if PROTOBUF_INLINE_NOT_IN_HEADERS
@@ -17986,45 +21632,46 @@ void CMD_RoomPlayerInfo::set_playerid(::google::protobuf::uint64 value) {
 
 // string clientAddr = 2;
 void CMD_RoomPlayerInfo::clear_clientaddr() {
-  clientaddr_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  clientaddr_.ClearToEmpty(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 const ::std::string& CMD_RoomPlayerInfo::clientaddr() const {
   // @@protoc_insertion_point(field_get:CMD_RoomPlayerInfo.clientAddr)
-  return clientaddr_.GetNoArena();
+  return clientaddr_.Get();
 }
 void CMD_RoomPlayerInfo::set_clientaddr(const ::std::string& value) {
   
-  clientaddr_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  clientaddr_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value, GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set:CMD_RoomPlayerInfo.clientAddr)
 }
-#if LANG_CXX11
-void CMD_RoomPlayerInfo::set_clientaddr(::std::string&& value) {
-  
-  clientaddr_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:CMD_RoomPlayerInfo.clientAddr)
-}
-#endif
 void CMD_RoomPlayerInfo::set_clientaddr(const char* value) {
   
-  clientaddr_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  clientaddr_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+              GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_char:CMD_RoomPlayerInfo.clientAddr)
 }
-void CMD_RoomPlayerInfo::set_clientaddr(const char* value, size_t size) {
+void CMD_RoomPlayerInfo::set_clientaddr(const char* value,
+    size_t size) {
   
-  clientaddr_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
+  clientaddr_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_pointer:CMD_RoomPlayerInfo.clientAddr)
 }
 ::std::string* CMD_RoomPlayerInfo::mutable_clientaddr() {
   
   // @@protoc_insertion_point(field_mutable:CMD_RoomPlayerInfo.clientAddr)
-  return clientaddr_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return clientaddr_.Mutable(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 ::std::string* CMD_RoomPlayerInfo::release_clientaddr() {
   // @@protoc_insertion_point(field_release:CMD_RoomPlayerInfo.clientAddr)
   
-  return clientaddr_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return clientaddr_.Release(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
+}
+::std::string* CMD_RoomPlayerInfo::unsafe_arena_release_clientaddr() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:CMD_RoomPlayerInfo.clientAddr)
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  
+  return clientaddr_.UnsafeArenaRelease(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      GetArenaNoVirtual());
 }
 void CMD_RoomPlayerInfo::set_allocated_clientaddr(::std::string* clientaddr) {
   if (clientaddr != NULL) {
@@ -18032,9 +21679,22 @@ void CMD_RoomPlayerInfo::set_allocated_clientaddr(::std::string* clientaddr) {
   } else {
     
   }
-  clientaddr_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), clientaddr);
+  clientaddr_.SetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), clientaddr,
+      GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_allocated:CMD_RoomPlayerInfo.clientAddr)
 }
+void CMD_RoomPlayerInfo::unsafe_arena_set_allocated_clientaddr(
+    ::std::string* clientaddr) {
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  if (clientaddr != NULL) {
+    
+  } else {
+    
+  }
+  clientaddr_.UnsafeArenaSetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      clientaddr, GetArenaNoVirtual());
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:CMD_RoomPlayerInfo.clientAddr)
+}
 
 // int32 exp = 3;
 void CMD_RoomPlayerInfo::clear_exp() {
@@ -18108,45 +21768,46 @@ void CMD_RoomPlayerInfo::set_defeat(::google::protobuf::int32 value) {
 
 // string playerName = 8;
 void CMD_RoomPlayerInfo::clear_playername() {
-  playername_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  playername_.ClearToEmpty(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 const ::std::string& CMD_RoomPlayerInfo::playername() const {
   // @@protoc_insertion_point(field_get:CMD_RoomPlayerInfo.playerName)
-  return playername_.GetNoArena();
+  return playername_.Get();
 }
 void CMD_RoomPlayerInfo::set_playername(const ::std::string& value) {
   
-  playername_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  playername_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value, GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set:CMD_RoomPlayerInfo.playerName)
 }
-#if LANG_CXX11
-void CMD_RoomPlayerInfo::set_playername(::std::string&& value) {
-  
-  playername_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:CMD_RoomPlayerInfo.playerName)
-}
-#endif
 void CMD_RoomPlayerInfo::set_playername(const char* value) {
   
-  playername_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  playername_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+              GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_char:CMD_RoomPlayerInfo.playerName)
 }
-void CMD_RoomPlayerInfo::set_playername(const char* value, size_t size) {
+void CMD_RoomPlayerInfo::set_playername(const char* value,
+    size_t size) {
   
-  playername_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
+  playername_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_pointer:CMD_RoomPlayerInfo.playerName)
 }
 ::std::string* CMD_RoomPlayerInfo::mutable_playername() {
   
   // @@protoc_insertion_point(field_mutable:CMD_RoomPlayerInfo.playerName)
-  return playername_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return playername_.Mutable(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 ::std::string* CMD_RoomPlayerInfo::release_playername() {
   // @@protoc_insertion_point(field_release:CMD_RoomPlayerInfo.playerName)
   
-  return playername_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return playername_.Release(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
+}
+::std::string* CMD_RoomPlayerInfo::unsafe_arena_release_playername() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:CMD_RoomPlayerInfo.playerName)
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  
+  return playername_.UnsafeArenaRelease(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      GetArenaNoVirtual());
 }
 void CMD_RoomPlayerInfo::set_allocated_playername(::std::string* playername) {
   if (playername != NULL) {
@@ -18154,9 +21815,22 @@ void CMD_RoomPlayerInfo::set_allocated_playername(::std::string* playername) {
   } else {
     
   }
-  playername_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), playername);
+  playername_.SetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), playername,
+      GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_allocated:CMD_RoomPlayerInfo.playerName)
 }
+void CMD_RoomPlayerInfo::unsafe_arena_set_allocated_playername(
+    ::std::string* playername) {
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  if (playername != NULL) {
+    
+  } else {
+    
+  }
+  playername_.UnsafeArenaSetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      playername, GetArenaNoVirtual());
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:CMD_RoomPlayerInfo.playerName)
+}
 
 // int32 playerModelID = 9;
 void CMD_RoomPlayerInfo::clear_playermodelid() {
@@ -18194,7 +21868,18 @@ CMD_Roommgr_RequestCreateRoom::CMD_Roommgr_RequestCreateRoom()
     protobuf_Commands_2eproto::InitDefaults();
   }
   SharedCtor();
-  // @@protoc_insertion_point(constructor:CMD_Roommgr_RequestCreateRoom)
+  // @@protoc_insertion_point(constructor:CMD_Roommgr_RequestCreateRoom)
+}
+CMD_Roommgr_RequestCreateRoom::CMD_Roommgr_RequestCreateRoom(::google::protobuf::Arena* arena)
+  : ::google::protobuf::Message(),
+  _internal_metadata_(arena),
+  players_(arena) {
+#ifdef GOOGLE_PROTOBUF_NO_STATIC_INITIALIZER
+  protobuf_Commands_2eproto::InitDefaults();
+#endif  // GOOGLE_PROTOBUF_NO_STATIC_INITIALIZER
+  SharedCtor();
+  RegisterArenaDtor(arena);
+  // @@protoc_insertion_point(arena_constructor:CMD_Roommgr_RequestCreateRoom)
 }
 CMD_Roommgr_RequestCreateRoom::CMD_Roommgr_RequestCreateRoom(const CMD_Roommgr_RequestCreateRoom& from)
   : ::google::protobuf::Message(),
@@ -18204,11 +21889,13 @@ CMD_Roommgr_RequestCreateRoom::CMD_Roommgr_RequestCreateRoom(const CMD_Roommgr_R
   _internal_metadata_.MergeFrom(from._internal_metadata_);
   exefile_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
   if (from.exefile().size() > 0) {
-    exefile_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.exefile_);
+    exefile_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.exefile(),
+      GetArenaNoVirtual());
   }
   exeoptions_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
   if (from.exeoptions().size() > 0) {
-    exeoptions_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.exeoptions_);
+    exeoptions_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.exeoptions(),
+      GetArenaNoVirtual());
   }
   ::memcpy(&hallsid_, &from.hallsid_,
     reinterpret_cast<char*>(&gametime_) -
@@ -18230,10 +21917,21 @@ CMD_Roommgr_RequestCreateRoom::~CMD_Roommgr_RequestCreateRoom() {
 }
 
 void CMD_Roommgr_RequestCreateRoom::SharedDtor() {
-  exefile_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  exeoptions_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  ::google::protobuf::Arena* arena = GetArenaNoVirtual();
+  if (arena != NULL) {
+    return;
+  }
+
+  exefile_.Destroy(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), arena);
+  exeoptions_.Destroy(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), arena);
 }
 
+void CMD_Roommgr_RequestCreateRoom::ArenaDtor(void* object) {
+  CMD_Roommgr_RequestCreateRoom* _this = reinterpret_cast< CMD_Roommgr_RequestCreateRoom* >(object);
+  (void)_this;
+}
+void CMD_Roommgr_RequestCreateRoom::RegisterArenaDtor(::google::protobuf::Arena* arena) {
+}
 void CMD_Roommgr_RequestCreateRoom::SetCachedSize(int size) const {
   GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
   _cached_size_ = size;
@@ -18241,7 +21939,7 @@ void CMD_Roommgr_RequestCreateRoom::SetCachedSize(int size) const {
 }
 const ::google::protobuf::Descriptor* CMD_Roommgr_RequestCreateRoom::descriptor() {
   protobuf_Commands_2eproto::protobuf_AssignDescriptorsOnce();
-  return protobuf_Commands_2eproto::file_level_metadata[38].descriptor;
+  return protobuf_Commands_2eproto::file_level_metadata[40].descriptor;
 }
 
 const CMD_Roommgr_RequestCreateRoom& CMD_Roommgr_RequestCreateRoom::default_instance() {
@@ -18250,18 +21948,14 @@ const CMD_Roommgr_RequestCreateRoom& CMD_Roommgr_RequestCreateRoom::default_inst
 }
 
 CMD_Roommgr_RequestCreateRoom* CMD_Roommgr_RequestCreateRoom::New(::google::protobuf::Arena* arena) const {
-  CMD_Roommgr_RequestCreateRoom* n = new CMD_Roommgr_RequestCreateRoom;
-  if (arena != NULL) {
-    arena->Own(n);
-  }
-  return n;
+  return ::google::protobuf::Arena::CreateMessage<CMD_Roommgr_RequestCreateRoom>(arena);
 }
 
 void CMD_Roommgr_RequestCreateRoom::Clear() {
 // @@protoc_insertion_point(message_clear_start:CMD_Roommgr_RequestCreateRoom)
   players_.Clear();
-  exefile_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  exeoptions_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  exefile_.ClearToEmpty(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
+  exeoptions_.ClearToEmpty(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
   ::memset(&hallsid_, 0, reinterpret_cast<char*>(&gametime_) -
     reinterpret_cast<char*>(&hallsid_) + sizeof(gametime_));
 }
@@ -18644,12 +22338,10 @@ void CMD_Roommgr_RequestCreateRoom::MergeFrom(const CMD_Roommgr_RequestCreateRoo
   _internal_metadata_.MergeFrom(from._internal_metadata_);
   players_.MergeFrom(from.players_);
   if (from.exefile().size() > 0) {
-
-    exefile_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.exefile_);
+    set_exefile(from.exefile());
   }
   if (from.exeoptions().size() > 0) {
-
-    exeoptions_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.exeoptions_);
+    set_exeoptions(from.exeoptions());
   }
   if (from.hallsid() != 0) {
     set_hallsid(from.hallsid());
@@ -18691,6 +22383,21 @@ bool CMD_Roommgr_RequestCreateRoom::IsInitialized() const {
 
 void CMD_Roommgr_RequestCreateRoom::Swap(CMD_Roommgr_RequestCreateRoom* other) {
   if (other == this) return;
+  if (GetArenaNoVirtual() == other->GetArenaNoVirtual()) {
+    InternalSwap(other);
+  } else {
+    CMD_Roommgr_RequestCreateRoom* temp = New(GetArenaNoVirtual());
+    temp->MergeFrom(*other);
+    other->CopyFrom(*this);
+    InternalSwap(temp);
+    if (GetArenaNoVirtual() == NULL) {
+      delete temp;
+    }
+  }
+}
+void CMD_Roommgr_RequestCreateRoom::UnsafeArenaSwap(CMD_Roommgr_RequestCreateRoom* other) {
+  if (other == this) return;
+  GOOGLE_DCHECK(GetArenaNoVirtual() == other->GetArenaNoVirtual());
   InternalSwap(other);
 }
 void CMD_Roommgr_RequestCreateRoom::InternalSwap(CMD_Roommgr_RequestCreateRoom* other) {
@@ -18708,7 +22415,7 @@ void CMD_Roommgr_RequestCreateRoom::InternalSwap(CMD_Roommgr_RequestCreateRoom*
 
 ::google::protobuf::Metadata CMD_Roommgr_RequestCreateRoom::GetMetadata() const {
   protobuf_Commands_2eproto::protobuf_AssignDescriptorsOnce();
-  return protobuf_Commands_2eproto::file_level_metadata[38];
+  return protobuf_Commands_2eproto::file_level_metadata[40];
 }
 
 #if PROTOBUF_INLINE_NOT_IN_HEADERS
@@ -18830,45 +22537,46 @@ CMD_Roommgr_RequestCreateRoom::players() const {
 
 // string exeFile = 8;
 void CMD_Roommgr_RequestCreateRoom::clear_exefile() {
-  exefile_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  exefile_.ClearToEmpty(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 const ::std::string& CMD_Roommgr_RequestCreateRoom::exefile() const {
   // @@protoc_insertion_point(field_get:CMD_Roommgr_RequestCreateRoom.exeFile)
-  return exefile_.GetNoArena();
+  return exefile_.Get();
 }
 void CMD_Roommgr_RequestCreateRoom::set_exefile(const ::std::string& value) {
   
-  exefile_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  exefile_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value, GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set:CMD_Roommgr_RequestCreateRoom.exeFile)
 }
-#if LANG_CXX11
-void CMD_Roommgr_RequestCreateRoom::set_exefile(::std::string&& value) {
-  
-  exefile_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:CMD_Roommgr_RequestCreateRoom.exeFile)
-}
-#endif
 void CMD_Roommgr_RequestCreateRoom::set_exefile(const char* value) {
   
-  exefile_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  exefile_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+              GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_char:CMD_Roommgr_RequestCreateRoom.exeFile)
 }
-void CMD_Roommgr_RequestCreateRoom::set_exefile(const char* value, size_t size) {
+void CMD_Roommgr_RequestCreateRoom::set_exefile(const char* value,
+    size_t size) {
   
-  exefile_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
+  exefile_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_pointer:CMD_Roommgr_RequestCreateRoom.exeFile)
 }
 ::std::string* CMD_Roommgr_RequestCreateRoom::mutable_exefile() {
   
   // @@protoc_insertion_point(field_mutable:CMD_Roommgr_RequestCreateRoom.exeFile)
-  return exefile_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return exefile_.Mutable(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 ::std::string* CMD_Roommgr_RequestCreateRoom::release_exefile() {
   // @@protoc_insertion_point(field_release:CMD_Roommgr_RequestCreateRoom.exeFile)
   
-  return exefile_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return exefile_.Release(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
+}
+::std::string* CMD_Roommgr_RequestCreateRoom::unsafe_arena_release_exefile() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:CMD_Roommgr_RequestCreateRoom.exeFile)
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  
+  return exefile_.UnsafeArenaRelease(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      GetArenaNoVirtual());
 }
 void CMD_Roommgr_RequestCreateRoom::set_allocated_exefile(::std::string* exefile) {
   if (exefile != NULL) {
@@ -18876,51 +22584,65 @@ void CMD_Roommgr_RequestCreateRoom::set_allocated_exefile(::std::string* exefile
   } else {
     
   }
-  exefile_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), exefile);
+  exefile_.SetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), exefile,
+      GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_allocated:CMD_Roommgr_RequestCreateRoom.exeFile)
 }
+void CMD_Roommgr_RequestCreateRoom::unsafe_arena_set_allocated_exefile(
+    ::std::string* exefile) {
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  if (exefile != NULL) {
+    
+  } else {
+    
+  }
+  exefile_.UnsafeArenaSetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      exefile, GetArenaNoVirtual());
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:CMD_Roommgr_RequestCreateRoom.exeFile)
+}
 
 // string exeOptions = 9;
 void CMD_Roommgr_RequestCreateRoom::clear_exeoptions() {
-  exeoptions_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  exeoptions_.ClearToEmpty(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 const ::std::string& CMD_Roommgr_RequestCreateRoom::exeoptions() const {
   // @@protoc_insertion_point(field_get:CMD_Roommgr_RequestCreateRoom.exeOptions)
-  return exeoptions_.GetNoArena();
+  return exeoptions_.Get();
 }
 void CMD_Roommgr_RequestCreateRoom::set_exeoptions(const ::std::string& value) {
   
-  exeoptions_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  exeoptions_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value, GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set:CMD_Roommgr_RequestCreateRoom.exeOptions)
 }
-#if LANG_CXX11
-void CMD_Roommgr_RequestCreateRoom::set_exeoptions(::std::string&& value) {
-  
-  exeoptions_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:CMD_Roommgr_RequestCreateRoom.exeOptions)
-}
-#endif
 void CMD_Roommgr_RequestCreateRoom::set_exeoptions(const char* value) {
   
-  exeoptions_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  exeoptions_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+              GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_char:CMD_Roommgr_RequestCreateRoom.exeOptions)
 }
-void CMD_Roommgr_RequestCreateRoom::set_exeoptions(const char* value, size_t size) {
+void CMD_Roommgr_RequestCreateRoom::set_exeoptions(const char* value,
+    size_t size) {
   
-  exeoptions_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
+  exeoptions_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_pointer:CMD_Roommgr_RequestCreateRoom.exeOptions)
 }
 ::std::string* CMD_Roommgr_RequestCreateRoom::mutable_exeoptions() {
   
   // @@protoc_insertion_point(field_mutable:CMD_Roommgr_RequestCreateRoom.exeOptions)
-  return exeoptions_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return exeoptions_.Mutable(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 ::std::string* CMD_Roommgr_RequestCreateRoom::release_exeoptions() {
   // @@protoc_insertion_point(field_release:CMD_Roommgr_RequestCreateRoom.exeOptions)
   
-  return exeoptions_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return exeoptions_.Release(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
+}
+::std::string* CMD_Roommgr_RequestCreateRoom::unsafe_arena_release_exeoptions() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:CMD_Roommgr_RequestCreateRoom.exeOptions)
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  
+  return exeoptions_.UnsafeArenaRelease(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      GetArenaNoVirtual());
 }
 void CMD_Roommgr_RequestCreateRoom::set_allocated_exeoptions(::std::string* exeoptions) {
   if (exeoptions != NULL) {
@@ -18928,9 +22650,22 @@ void CMD_Roommgr_RequestCreateRoom::set_allocated_exeoptions(::std::string* exeo
   } else {
     
   }
-  exeoptions_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), exeoptions);
+  exeoptions_.SetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), exeoptions,
+      GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_allocated:CMD_Roommgr_RequestCreateRoom.exeOptions)
 }
+void CMD_Roommgr_RequestCreateRoom::unsafe_arena_set_allocated_exeoptions(
+    ::std::string* exeoptions) {
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  if (exeoptions != NULL) {
+    
+  } else {
+    
+  }
+  exeoptions_.UnsafeArenaSetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      exeoptions, GetArenaNoVirtual());
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:CMD_Roommgr_RequestCreateRoom.exeOptions)
+}
 
 #endif  // PROTOBUF_INLINE_NOT_IN_HEADERS
 
@@ -18953,6 +22688,16 @@ CMD_Roommgr_OnRequestCreateRoomCB::CMD_Roommgr_OnRequestCreateRoomCB()
   SharedCtor();
   // @@protoc_insertion_point(constructor:CMD_Roommgr_OnRequestCreateRoomCB)
 }
+CMD_Roommgr_OnRequestCreateRoomCB::CMD_Roommgr_OnRequestCreateRoomCB(::google::protobuf::Arena* arena)
+  : ::google::protobuf::Message(),
+  _internal_metadata_(arena) {
+#ifdef GOOGLE_PROTOBUF_NO_STATIC_INITIALIZER
+  protobuf_Commands_2eproto::InitDefaults();
+#endif  // GOOGLE_PROTOBUF_NO_STATIC_INITIALIZER
+  SharedCtor();
+  RegisterArenaDtor(arena);
+  // @@protoc_insertion_point(arena_constructor:CMD_Roommgr_OnRequestCreateRoomCB)
+}
 CMD_Roommgr_OnRequestCreateRoomCB::CMD_Roommgr_OnRequestCreateRoomCB(const CMD_Roommgr_OnRequestCreateRoomCB& from)
   : ::google::protobuf::Message(),
       _internal_metadata_(NULL),
@@ -18960,7 +22705,8 @@ CMD_Roommgr_OnRequestCreateRoomCB::CMD_Roommgr_OnRequestCreateRoomCB(const CMD_R
   _internal_metadata_.MergeFrom(from._internal_metadata_);
   ip_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
   if (from.ip().size() > 0) {
-    ip_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.ip_);
+    ip_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.ip(),
+      GetArenaNoVirtual());
   }
   ::memcpy(&hallsid_, &from.hallsid_,
     reinterpret_cast<char*>(&errcode_) -
@@ -18981,9 +22727,20 @@ CMD_Roommgr_OnRequestCreateRoomCB::~CMD_Roommgr_OnRequestCreateRoomCB() {
 }
 
 void CMD_Roommgr_OnRequestCreateRoomCB::SharedDtor() {
-  ip_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  ::google::protobuf::Arena* arena = GetArenaNoVirtual();
+  if (arena != NULL) {
+    return;
+  }
+
+  ip_.Destroy(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), arena);
 }
 
+void CMD_Roommgr_OnRequestCreateRoomCB::ArenaDtor(void* object) {
+  CMD_Roommgr_OnRequestCreateRoomCB* _this = reinterpret_cast< CMD_Roommgr_OnRequestCreateRoomCB* >(object);
+  (void)_this;
+}
+void CMD_Roommgr_OnRequestCreateRoomCB::RegisterArenaDtor(::google::protobuf::Arena* arena) {
+}
 void CMD_Roommgr_OnRequestCreateRoomCB::SetCachedSize(int size) const {
   GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
   _cached_size_ = size;
@@ -18991,7 +22748,7 @@ void CMD_Roommgr_OnRequestCreateRoomCB::SetCachedSize(int size) const {
 }
 const ::google::protobuf::Descriptor* CMD_Roommgr_OnRequestCreateRoomCB::descriptor() {
   protobuf_Commands_2eproto::protobuf_AssignDescriptorsOnce();
-  return protobuf_Commands_2eproto::file_level_metadata[39].descriptor;
+  return protobuf_Commands_2eproto::file_level_metadata[41].descriptor;
 }
 
 const CMD_Roommgr_OnRequestCreateRoomCB& CMD_Roommgr_OnRequestCreateRoomCB::default_instance() {
@@ -19000,16 +22757,12 @@ const CMD_Roommgr_OnRequestCreateRoomCB& CMD_Roommgr_OnRequestCreateRoomCB::defa
 }
 
 CMD_Roommgr_OnRequestCreateRoomCB* CMD_Roommgr_OnRequestCreateRoomCB::New(::google::protobuf::Arena* arena) const {
-  CMD_Roommgr_OnRequestCreateRoomCB* n = new CMD_Roommgr_OnRequestCreateRoomCB;
-  if (arena != NULL) {
-    arena->Own(n);
-  }
-  return n;
+  return ::google::protobuf::Arena::CreateMessage<CMD_Roommgr_OnRequestCreateRoomCB>(arena);
 }
 
 void CMD_Roommgr_OnRequestCreateRoomCB::Clear() {
 // @@protoc_insertion_point(message_clear_start:CMD_Roommgr_OnRequestCreateRoomCB)
-  ip_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  ip_.ClearToEmpty(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
   ::memset(&hallsid_, 0, reinterpret_cast<char*>(&errcode_) -
     reinterpret_cast<char*>(&hallsid_) + sizeof(errcode_));
 }
@@ -19285,8 +23038,7 @@ void CMD_Roommgr_OnRequestCreateRoomCB::MergeFrom(const CMD_Roommgr_OnRequestCre
   GOOGLE_DCHECK_NE(&from, this);
   _internal_metadata_.MergeFrom(from._internal_metadata_);
   if (from.ip().size() > 0) {
-
-    ip_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.ip_);
+    set_ip(from.ip());
   }
   if (from.hallsid() != 0) {
     set_hallsid(from.hallsid());
@@ -19325,6 +23077,21 @@ bool CMD_Roommgr_OnRequestCreateRoomCB::IsInitialized() const {
 
 void CMD_Roommgr_OnRequestCreateRoomCB::Swap(CMD_Roommgr_OnRequestCreateRoomCB* other) {
   if (other == this) return;
+  if (GetArenaNoVirtual() == other->GetArenaNoVirtual()) {
+    InternalSwap(other);
+  } else {
+    CMD_Roommgr_OnRequestCreateRoomCB* temp = New(GetArenaNoVirtual());
+    temp->MergeFrom(*other);
+    other->CopyFrom(*this);
+    InternalSwap(temp);
+    if (GetArenaNoVirtual() == NULL) {
+      delete temp;
+    }
+  }
+}
+void CMD_Roommgr_OnRequestCreateRoomCB::UnsafeArenaSwap(CMD_Roommgr_OnRequestCreateRoomCB* other) {
+  if (other == this) return;
+  GOOGLE_DCHECK(GetArenaNoVirtual() == other->GetArenaNoVirtual());
   InternalSwap(other);
 }
 void CMD_Roommgr_OnRequestCreateRoomCB::InternalSwap(CMD_Roommgr_OnRequestCreateRoomCB* other) {
@@ -19339,7 +23106,7 @@ void CMD_Roommgr_OnRequestCreateRoomCB::InternalSwap(CMD_Roommgr_OnRequestCreate
 
 ::google::protobuf::Metadata CMD_Roommgr_OnRequestCreateRoomCB::GetMetadata() const {
   protobuf_Commands_2eproto::protobuf_AssignDescriptorsOnce();
-  return protobuf_Commands_2eproto::file_level_metadata[39];
+  return protobuf_Commands_2eproto::file_level_metadata[41];
 }
 
 #if PROTOBUF_INLINE_NOT_IN_HEADERS
@@ -19375,45 +23142,46 @@ void CMD_Roommgr_OnRequestCreateRoomCB::set_roomid(::google::protobuf::uint64 va
 
 // string ip = 3;
 void CMD_Roommgr_OnRequestCreateRoomCB::clear_ip() {
-  ip_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  ip_.ClearToEmpty(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 const ::std::string& CMD_Roommgr_OnRequestCreateRoomCB::ip() const {
   // @@protoc_insertion_point(field_get:CMD_Roommgr_OnRequestCreateRoomCB.ip)
-  return ip_.GetNoArena();
+  return ip_.Get();
 }
 void CMD_Roommgr_OnRequestCreateRoomCB::set_ip(const ::std::string& value) {
   
-  ip_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  ip_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value, GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set:CMD_Roommgr_OnRequestCreateRoomCB.ip)
 }
-#if LANG_CXX11
-void CMD_Roommgr_OnRequestCreateRoomCB::set_ip(::std::string&& value) {
-  
-  ip_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:CMD_Roommgr_OnRequestCreateRoomCB.ip)
-}
-#endif
 void CMD_Roommgr_OnRequestCreateRoomCB::set_ip(const char* value) {
   
-  ip_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  ip_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+              GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_char:CMD_Roommgr_OnRequestCreateRoomCB.ip)
 }
-void CMD_Roommgr_OnRequestCreateRoomCB::set_ip(const char* value, size_t size) {
+void CMD_Roommgr_OnRequestCreateRoomCB::set_ip(const char* value,
+    size_t size) {
   
-  ip_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
+  ip_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_pointer:CMD_Roommgr_OnRequestCreateRoomCB.ip)
 }
 ::std::string* CMD_Roommgr_OnRequestCreateRoomCB::mutable_ip() {
   
   // @@protoc_insertion_point(field_mutable:CMD_Roommgr_OnRequestCreateRoomCB.ip)
-  return ip_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return ip_.Mutable(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 ::std::string* CMD_Roommgr_OnRequestCreateRoomCB::release_ip() {
   // @@protoc_insertion_point(field_release:CMD_Roommgr_OnRequestCreateRoomCB.ip)
   
-  return ip_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return ip_.Release(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
+}
+::std::string* CMD_Roommgr_OnRequestCreateRoomCB::unsafe_arena_release_ip() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:CMD_Roommgr_OnRequestCreateRoomCB.ip)
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  
+  return ip_.UnsafeArenaRelease(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      GetArenaNoVirtual());
 }
 void CMD_Roommgr_OnRequestCreateRoomCB::set_allocated_ip(::std::string* ip) {
   if (ip != NULL) {
@@ -19421,9 +23189,22 @@ void CMD_Roommgr_OnRequestCreateRoomCB::set_allocated_ip(::std::string* ip) {
   } else {
     
   }
-  ip_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ip);
+  ip_.SetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ip,
+      GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_allocated:CMD_Roommgr_OnRequestCreateRoomCB.ip)
 }
+void CMD_Roommgr_OnRequestCreateRoomCB::unsafe_arena_set_allocated_ip(
+    ::std::string* ip) {
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  if (ip != NULL) {
+    
+  } else {
+    
+  }
+  ip_.UnsafeArenaSetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      ip, GetArenaNoVirtual());
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:CMD_Roommgr_OnRequestCreateRoomCB.ip)
+}
 
 // int32 port = 4;
 void CMD_Roommgr_OnRequestCreateRoomCB::clear_port() {
@@ -19486,6 +23267,17 @@ CMD_Roommgr_OnRoomSrvGameOverReport::CMD_Roommgr_OnRoomSrvGameOverReport()
   SharedCtor();
   // @@protoc_insertion_point(constructor:CMD_Roommgr_OnRoomSrvGameOverReport)
 }
+CMD_Roommgr_OnRoomSrvGameOverReport::CMD_Roommgr_OnRoomSrvGameOverReport(::google::protobuf::Arena* arena)
+  : ::google::protobuf::Message(),
+  _internal_metadata_(arena),
+  playerdatas_(arena) {
+#ifdef GOOGLE_PROTOBUF_NO_STATIC_INITIALIZER
+  protobuf_Commands_2eproto::InitDefaults();
+#endif  // GOOGLE_PROTOBUF_NO_STATIC_INITIALIZER
+  SharedCtor();
+  RegisterArenaDtor(arena);
+  // @@protoc_insertion_point(arena_constructor:CMD_Roommgr_OnRoomSrvGameOverReport)
+}
 CMD_Roommgr_OnRoomSrvGameOverReport::CMD_Roommgr_OnRoomSrvGameOverReport(const CMD_Roommgr_OnRoomSrvGameOverReport& from)
   : ::google::protobuf::Message(),
       _internal_metadata_(NULL),
@@ -19510,8 +23302,19 @@ CMD_Roommgr_OnRoomSrvGameOverReport::~CMD_Roommgr_OnRoomSrvGameOverReport() {
 }
 
 void CMD_Roommgr_OnRoomSrvGameOverReport::SharedDtor() {
+  ::google::protobuf::Arena* arena = GetArenaNoVirtual();
+  if (arena != NULL) {
+    return;
+  }
+
 }
 
+void CMD_Roommgr_OnRoomSrvGameOverReport::ArenaDtor(void* object) {
+  CMD_Roommgr_OnRoomSrvGameOverReport* _this = reinterpret_cast< CMD_Roommgr_OnRoomSrvGameOverReport* >(object);
+  (void)_this;
+}
+void CMD_Roommgr_OnRoomSrvGameOverReport::RegisterArenaDtor(::google::protobuf::Arena* arena) {
+}
 void CMD_Roommgr_OnRoomSrvGameOverReport::SetCachedSize(int size) const {
   GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
   _cached_size_ = size;
@@ -19519,7 +23322,7 @@ void CMD_Roommgr_OnRoomSrvGameOverReport::SetCachedSize(int size) const {
 }
 const ::google::protobuf::Descriptor* CMD_Roommgr_OnRoomSrvGameOverReport::descriptor() {
   protobuf_Commands_2eproto::protobuf_AssignDescriptorsOnce();
-  return protobuf_Commands_2eproto::file_level_metadata[40].descriptor;
+  return protobuf_Commands_2eproto::file_level_metadata[42].descriptor;
 }
 
 const CMD_Roommgr_OnRoomSrvGameOverReport& CMD_Roommgr_OnRoomSrvGameOverReport::default_instance() {
@@ -19528,11 +23331,7 @@ const CMD_Roommgr_OnRoomSrvGameOverReport& CMD_Roommgr_OnRoomSrvGameOverReport::
 }
 
 CMD_Roommgr_OnRoomSrvGameOverReport* CMD_Roommgr_OnRoomSrvGameOverReport::New(::google::protobuf::Arena* arena) const {
-  CMD_Roommgr_OnRoomSrvGameOverReport* n = new CMD_Roommgr_OnRoomSrvGameOverReport;
-  if (arena != NULL) {
-    arena->Own(n);
-  }
-  return n;
+  return ::google::protobuf::Arena::CreateMessage<CMD_Roommgr_OnRoomSrvGameOverReport>(arena);
 }
 
 void CMD_Roommgr_OnRoomSrvGameOverReport::Clear() {
@@ -19778,6 +23577,21 @@ bool CMD_Roommgr_OnRoomSrvGameOverReport::IsInitialized() const {
 
 void CMD_Roommgr_OnRoomSrvGameOverReport::Swap(CMD_Roommgr_OnRoomSrvGameOverReport* other) {
   if (other == this) return;
+  if (GetArenaNoVirtual() == other->GetArenaNoVirtual()) {
+    InternalSwap(other);
+  } else {
+    CMD_Roommgr_OnRoomSrvGameOverReport* temp = New(GetArenaNoVirtual());
+    temp->MergeFrom(*other);
+    other->CopyFrom(*this);
+    InternalSwap(temp);
+    if (GetArenaNoVirtual() == NULL) {
+      delete temp;
+    }
+  }
+}
+void CMD_Roommgr_OnRoomSrvGameOverReport::UnsafeArenaSwap(CMD_Roommgr_OnRoomSrvGameOverReport* other) {
+  if (other == this) return;
+  GOOGLE_DCHECK(GetArenaNoVirtual() == other->GetArenaNoVirtual());
   InternalSwap(other);
 }
 void CMD_Roommgr_OnRoomSrvGameOverReport::InternalSwap(CMD_Roommgr_OnRoomSrvGameOverReport* other) {
@@ -19790,7 +23604,7 @@ void CMD_Roommgr_OnRoomSrvGameOverReport::InternalSwap(CMD_Roommgr_OnRoomSrvGame
 
 ::google::protobuf::Metadata CMD_Roommgr_OnRoomSrvGameOverReport::GetMetadata() const {
   protobuf_Commands_2eproto::protobuf_AssignDescriptorsOnce();
-  return protobuf_Commands_2eproto::file_level_metadata[40];
+  return protobuf_Commands_2eproto::file_level_metadata[42];
 }
 
 #if PROTOBUF_INLINE_NOT_IN_HEADERS
@@ -19895,6 +23709,17 @@ CMD_Machine_RequestCreateRoom::CMD_Machine_RequestCreateRoom()
   SharedCtor();
   // @@protoc_insertion_point(constructor:CMD_Machine_RequestCreateRoom)
 }
+CMD_Machine_RequestCreateRoom::CMD_Machine_RequestCreateRoom(::google::protobuf::Arena* arena)
+  : ::google::protobuf::Message(),
+  _internal_metadata_(arena),
+  players_(arena) {
+#ifdef GOOGLE_PROTOBUF_NO_STATIC_INITIALIZER
+  protobuf_Commands_2eproto::InitDefaults();
+#endif  // GOOGLE_PROTOBUF_NO_STATIC_INITIALIZER
+  SharedCtor();
+  RegisterArenaDtor(arena);
+  // @@protoc_insertion_point(arena_constructor:CMD_Machine_RequestCreateRoom)
+}
 CMD_Machine_RequestCreateRoom::CMD_Machine_RequestCreateRoom(const CMD_Machine_RequestCreateRoom& from)
   : ::google::protobuf::Message(),
       _internal_metadata_(NULL),
@@ -19903,15 +23728,18 @@ CMD_Machine_RequestCreateRoom::CMD_Machine_RequestCreateRoom(const CMD_Machine_R
   _internal_metadata_.MergeFrom(from._internal_metadata_);
   exefile_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
   if (from.exefile().size() > 0) {
-    exefile_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.exefile_);
+    exefile_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.exefile(),
+      GetArenaNoVirtual());
   }
   exeoptions_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
   if (from.exeoptions().size() > 0) {
-    exeoptions_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.exeoptions_);
+    exeoptions_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.exeoptions(),
+      GetArenaNoVirtual());
   }
   roommgrip_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
   if (from.roommgrip().size() > 0) {
-    roommgrip_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.roommgrip_);
+    roommgrip_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.roommgrip(),
+      GetArenaNoVirtual());
   }
   ::memcpy(&hallsid_, &from.hallsid_,
     reinterpret_cast<char*>(&tokenid_) -
@@ -19934,11 +23762,22 @@ CMD_Machine_RequestCreateRoom::~CMD_Machine_RequestCreateRoom() {
 }
 
 void CMD_Machine_RequestCreateRoom::SharedDtor() {
-  exefile_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  exeoptions_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  roommgrip_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  ::google::protobuf::Arena* arena = GetArenaNoVirtual();
+  if (arena != NULL) {
+    return;
+  }
+
+  exefile_.Destroy(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), arena);
+  exeoptions_.Destroy(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), arena);
+  roommgrip_.Destroy(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), arena);
 }
 
+void CMD_Machine_RequestCreateRoom::ArenaDtor(void* object) {
+  CMD_Machine_RequestCreateRoom* _this = reinterpret_cast< CMD_Machine_RequestCreateRoom* >(object);
+  (void)_this;
+}
+void CMD_Machine_RequestCreateRoom::RegisterArenaDtor(::google::protobuf::Arena* arena) {
+}
 void CMD_Machine_RequestCreateRoom::SetCachedSize(int size) const {
   GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
   _cached_size_ = size;
@@ -19946,7 +23785,7 @@ void CMD_Machine_RequestCreateRoom::SetCachedSize(int size) const {
 }
 const ::google::protobuf::Descriptor* CMD_Machine_RequestCreateRoom::descriptor() {
   protobuf_Commands_2eproto::protobuf_AssignDescriptorsOnce();
-  return protobuf_Commands_2eproto::file_level_metadata[41].descriptor;
+  return protobuf_Commands_2eproto::file_level_metadata[43].descriptor;
 }
 
 const CMD_Machine_RequestCreateRoom& CMD_Machine_RequestCreateRoom::default_instance() {
@@ -19955,19 +23794,15 @@ const CMD_Machine_RequestCreateRoom& CMD_Machine_RequestCreateRoom::default_inst
 }
 
 CMD_Machine_RequestCreateRoom* CMD_Machine_RequestCreateRoom::New(::google::protobuf::Arena* arena) const {
-  CMD_Machine_RequestCreateRoom* n = new CMD_Machine_RequestCreateRoom;
-  if (arena != NULL) {
-    arena->Own(n);
-  }
-  return n;
+  return ::google::protobuf::Arena::CreateMessage<CMD_Machine_RequestCreateRoom>(arena);
 }
 
 void CMD_Machine_RequestCreateRoom::Clear() {
 // @@protoc_insertion_point(message_clear_start:CMD_Machine_RequestCreateRoom)
   players_.Clear();
-  exefile_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  exeoptions_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  roommgrip_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  exefile_.ClearToEmpty(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
+  exeoptions_.ClearToEmpty(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
+  roommgrip_.ClearToEmpty(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
   ::memset(&hallsid_, 0, reinterpret_cast<char*>(&tokenid_) -
     reinterpret_cast<char*>(&hallsid_) + sizeof(tokenid_));
 }
@@ -20453,16 +24288,13 @@ void CMD_Machine_RequestCreateRoom::MergeFrom(const CMD_Machine_RequestCreateRoo
   _internal_metadata_.MergeFrom(from._internal_metadata_);
   players_.MergeFrom(from.players_);
   if (from.exefile().size() > 0) {
-
-    exefile_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.exefile_);
+    set_exefile(from.exefile());
   }
   if (from.exeoptions().size() > 0) {
-
-    exeoptions_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.exeoptions_);
+    set_exeoptions(from.exeoptions());
   }
   if (from.roommgrip().size() > 0) {
-
-    roommgrip_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.roommgrip_);
+    set_roommgrip(from.roommgrip());
   }
   if (from.hallsid() != 0) {
     set_hallsid(from.hallsid());
@@ -20510,6 +24342,21 @@ bool CMD_Machine_RequestCreateRoom::IsInitialized() const {
 
 void CMD_Machine_RequestCreateRoom::Swap(CMD_Machine_RequestCreateRoom* other) {
   if (other == this) return;
+  if (GetArenaNoVirtual() == other->GetArenaNoVirtual()) {
+    InternalSwap(other);
+  } else {
+    CMD_Machine_RequestCreateRoom* temp = New(GetArenaNoVirtual());
+    temp->MergeFrom(*other);
+    other->CopyFrom(*this);
+    InternalSwap(temp);
+    if (GetArenaNoVirtual() == NULL) {
+      delete temp;
+    }
+  }
+}
+void CMD_Machine_RequestCreateRoom::UnsafeArenaSwap(CMD_Machine_RequestCreateRoom* other) {
+  if (other == this) return;
+  GOOGLE_DCHECK(GetArenaNoVirtual() == other->GetArenaNoVirtual());
   InternalSwap(other);
 }
 void CMD_Machine_RequestCreateRoom::InternalSwap(CMD_Machine_RequestCreateRoom* other) {
@@ -20530,7 +24377,7 @@ void CMD_Machine_RequestCreateRoom::InternalSwap(CMD_Machine_RequestCreateRoom*
 
 ::google::protobuf::Metadata CMD_Machine_RequestCreateRoom::GetMetadata() const {
   protobuf_Commands_2eproto::protobuf_AssignDescriptorsOnce();
-  return protobuf_Commands_2eproto::file_level_metadata[41];
+  return protobuf_Commands_2eproto::file_level_metadata[43];
 }
 
 #if PROTOBUF_INLINE_NOT_IN_HEADERS
@@ -20652,45 +24499,46 @@ CMD_Machine_RequestCreateRoom::players() const {
 
 // string exeFile = 8;
 void CMD_Machine_RequestCreateRoom::clear_exefile() {
-  exefile_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  exefile_.ClearToEmpty(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 const ::std::string& CMD_Machine_RequestCreateRoom::exefile() const {
   // @@protoc_insertion_point(field_get:CMD_Machine_RequestCreateRoom.exeFile)
-  return exefile_.GetNoArena();
+  return exefile_.Get();
 }
 void CMD_Machine_RequestCreateRoom::set_exefile(const ::std::string& value) {
   
-  exefile_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  exefile_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value, GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set:CMD_Machine_RequestCreateRoom.exeFile)
 }
-#if LANG_CXX11
-void CMD_Machine_RequestCreateRoom::set_exefile(::std::string&& value) {
-  
-  exefile_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:CMD_Machine_RequestCreateRoom.exeFile)
-}
-#endif
 void CMD_Machine_RequestCreateRoom::set_exefile(const char* value) {
   
-  exefile_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  exefile_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+              GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_char:CMD_Machine_RequestCreateRoom.exeFile)
 }
-void CMD_Machine_RequestCreateRoom::set_exefile(const char* value, size_t size) {
+void CMD_Machine_RequestCreateRoom::set_exefile(const char* value,
+    size_t size) {
   
-  exefile_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
+  exefile_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_pointer:CMD_Machine_RequestCreateRoom.exeFile)
 }
 ::std::string* CMD_Machine_RequestCreateRoom::mutable_exefile() {
   
   // @@protoc_insertion_point(field_mutable:CMD_Machine_RequestCreateRoom.exeFile)
-  return exefile_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return exefile_.Mutable(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 ::std::string* CMD_Machine_RequestCreateRoom::release_exefile() {
   // @@protoc_insertion_point(field_release:CMD_Machine_RequestCreateRoom.exeFile)
   
-  return exefile_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return exefile_.Release(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
+}
+::std::string* CMD_Machine_RequestCreateRoom::unsafe_arena_release_exefile() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:CMD_Machine_RequestCreateRoom.exeFile)
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  
+  return exefile_.UnsafeArenaRelease(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      GetArenaNoVirtual());
 }
 void CMD_Machine_RequestCreateRoom::set_allocated_exefile(::std::string* exefile) {
   if (exefile != NULL) {
@@ -20698,51 +24546,65 @@ void CMD_Machine_RequestCreateRoom::set_allocated_exefile(::std::string* exefile
   } else {
     
   }
-  exefile_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), exefile);
+  exefile_.SetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), exefile,
+      GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_allocated:CMD_Machine_RequestCreateRoom.exeFile)
 }
+void CMD_Machine_RequestCreateRoom::unsafe_arena_set_allocated_exefile(
+    ::std::string* exefile) {
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  if (exefile != NULL) {
+    
+  } else {
+    
+  }
+  exefile_.UnsafeArenaSetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      exefile, GetArenaNoVirtual());
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:CMD_Machine_RequestCreateRoom.exeFile)
+}
 
 // string exeOptions = 9;
 void CMD_Machine_RequestCreateRoom::clear_exeoptions() {
-  exeoptions_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  exeoptions_.ClearToEmpty(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 const ::std::string& CMD_Machine_RequestCreateRoom::exeoptions() const {
   // @@protoc_insertion_point(field_get:CMD_Machine_RequestCreateRoom.exeOptions)
-  return exeoptions_.GetNoArena();
+  return exeoptions_.Get();
 }
 void CMD_Machine_RequestCreateRoom::set_exeoptions(const ::std::string& value) {
   
-  exeoptions_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  exeoptions_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value, GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set:CMD_Machine_RequestCreateRoom.exeOptions)
 }
-#if LANG_CXX11
-void CMD_Machine_RequestCreateRoom::set_exeoptions(::std::string&& value) {
-  
-  exeoptions_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:CMD_Machine_RequestCreateRoom.exeOptions)
-}
-#endif
 void CMD_Machine_RequestCreateRoom::set_exeoptions(const char* value) {
   
-  exeoptions_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  exeoptions_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+              GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_char:CMD_Machine_RequestCreateRoom.exeOptions)
 }
-void CMD_Machine_RequestCreateRoom::set_exeoptions(const char* value, size_t size) {
+void CMD_Machine_RequestCreateRoom::set_exeoptions(const char* value,
+    size_t size) {
   
-  exeoptions_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
+  exeoptions_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_pointer:CMD_Machine_RequestCreateRoom.exeOptions)
 }
 ::std::string* CMD_Machine_RequestCreateRoom::mutable_exeoptions() {
   
   // @@protoc_insertion_point(field_mutable:CMD_Machine_RequestCreateRoom.exeOptions)
-  return exeoptions_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return exeoptions_.Mutable(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 ::std::string* CMD_Machine_RequestCreateRoom::release_exeoptions() {
   // @@protoc_insertion_point(field_release:CMD_Machine_RequestCreateRoom.exeOptions)
   
-  return exeoptions_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return exeoptions_.Release(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
+}
+::std::string* CMD_Machine_RequestCreateRoom::unsafe_arena_release_exeoptions() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:CMD_Machine_RequestCreateRoom.exeOptions)
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  
+  return exeoptions_.UnsafeArenaRelease(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      GetArenaNoVirtual());
 }
 void CMD_Machine_RequestCreateRoom::set_allocated_exeoptions(::std::string* exeoptions) {
   if (exeoptions != NULL) {
@@ -20750,9 +24612,22 @@ void CMD_Machine_RequestCreateRoom::set_allocated_exeoptions(::std::string* exeo
   } else {
     
   }
-  exeoptions_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), exeoptions);
+  exeoptions_.SetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), exeoptions,
+      GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_allocated:CMD_Machine_RequestCreateRoom.exeOptions)
 }
+void CMD_Machine_RequestCreateRoom::unsafe_arena_set_allocated_exeoptions(
+    ::std::string* exeoptions) {
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  if (exeoptions != NULL) {
+    
+  } else {
+    
+  }
+  exeoptions_.UnsafeArenaSetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      exeoptions, GetArenaNoVirtual());
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:CMD_Machine_RequestCreateRoom.exeOptions)
+}
 
 // uint64 tokenID = 10;
 void CMD_Machine_RequestCreateRoom::clear_tokenid() {
@@ -20770,45 +24645,46 @@ void CMD_Machine_RequestCreateRoom::set_tokenid(::google::protobuf::uint64 value
 
 // string roommgrIP = 11;
 void CMD_Machine_RequestCreateRoom::clear_roommgrip() {
-  roommgrip_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  roommgrip_.ClearToEmpty(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 const ::std::string& CMD_Machine_RequestCreateRoom::roommgrip() const {
   // @@protoc_insertion_point(field_get:CMD_Machine_RequestCreateRoom.roommgrIP)
-  return roommgrip_.GetNoArena();
+  return roommgrip_.Get();
 }
 void CMD_Machine_RequestCreateRoom::set_roommgrip(const ::std::string& value) {
   
-  roommgrip_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  roommgrip_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value, GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set:CMD_Machine_RequestCreateRoom.roommgrIP)
 }
-#if LANG_CXX11
-void CMD_Machine_RequestCreateRoom::set_roommgrip(::std::string&& value) {
-  
-  roommgrip_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:CMD_Machine_RequestCreateRoom.roommgrIP)
-}
-#endif
 void CMD_Machine_RequestCreateRoom::set_roommgrip(const char* value) {
   
-  roommgrip_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  roommgrip_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+              GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_char:CMD_Machine_RequestCreateRoom.roommgrIP)
 }
-void CMD_Machine_RequestCreateRoom::set_roommgrip(const char* value, size_t size) {
+void CMD_Machine_RequestCreateRoom::set_roommgrip(const char* value,
+    size_t size) {
   
-  roommgrip_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
+  roommgrip_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_pointer:CMD_Machine_RequestCreateRoom.roommgrIP)
 }
 ::std::string* CMD_Machine_RequestCreateRoom::mutable_roommgrip() {
   
   // @@protoc_insertion_point(field_mutable:CMD_Machine_RequestCreateRoom.roommgrIP)
-  return roommgrip_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return roommgrip_.Mutable(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 ::std::string* CMD_Machine_RequestCreateRoom::release_roommgrip() {
   // @@protoc_insertion_point(field_release:CMD_Machine_RequestCreateRoom.roommgrIP)
   
-  return roommgrip_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return roommgrip_.Release(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
+}
+::std::string* CMD_Machine_RequestCreateRoom::unsafe_arena_release_roommgrip() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:CMD_Machine_RequestCreateRoom.roommgrIP)
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  
+  return roommgrip_.UnsafeArenaRelease(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      GetArenaNoVirtual());
 }
 void CMD_Machine_RequestCreateRoom::set_allocated_roommgrip(::std::string* roommgrip) {
   if (roommgrip != NULL) {
@@ -20816,9 +24692,22 @@ void CMD_Machine_RequestCreateRoom::set_allocated_roommgrip(::std::string* roomm
   } else {
     
   }
-  roommgrip_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), roommgrip);
+  roommgrip_.SetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), roommgrip,
+      GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_allocated:CMD_Machine_RequestCreateRoom.roommgrIP)
 }
+void CMD_Machine_RequestCreateRoom::unsafe_arena_set_allocated_roommgrip(
+    ::std::string* roommgrip) {
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  if (roommgrip != NULL) {
+    
+  } else {
+    
+  }
+  roommgrip_.UnsafeArenaSetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      roommgrip, GetArenaNoVirtual());
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:CMD_Machine_RequestCreateRoom.roommgrIP)
+}
 
 // int32 roommgrPort = 12;
 void CMD_Machine_RequestCreateRoom::clear_roommgrport() {
@@ -20854,6 +24743,16 @@ CMD_Machine_RoomSrvReportAddr::CMD_Machine_RoomSrvReportAddr()
   SharedCtor();
   // @@protoc_insertion_point(constructor:CMD_Machine_RoomSrvReportAddr)
 }
+CMD_Machine_RoomSrvReportAddr::CMD_Machine_RoomSrvReportAddr(::google::protobuf::Arena* arena)
+  : ::google::protobuf::Message(),
+  _internal_metadata_(arena) {
+#ifdef GOOGLE_PROTOBUF_NO_STATIC_INITIALIZER
+  protobuf_Commands_2eproto::InitDefaults();
+#endif  // GOOGLE_PROTOBUF_NO_STATIC_INITIALIZER
+  SharedCtor();
+  RegisterArenaDtor(arena);
+  // @@protoc_insertion_point(arena_constructor:CMD_Machine_RoomSrvReportAddr)
+}
 CMD_Machine_RoomSrvReportAddr::CMD_Machine_RoomSrvReportAddr(const CMD_Machine_RoomSrvReportAddr& from)
   : ::google::protobuf::Message(),
       _internal_metadata_(NULL),
@@ -20861,7 +24760,8 @@ CMD_Machine_RoomSrvReportAddr::CMD_Machine_RoomSrvReportAddr(const CMD_Machine_R
   _internal_metadata_.MergeFrom(from._internal_metadata_);
   ip_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
   if (from.ip().size() > 0) {
-    ip_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.ip_);
+    ip_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.ip(),
+      GetArenaNoVirtual());
   }
   ::memcpy(&hallsid_, &from.hallsid_,
     reinterpret_cast<char*>(&errcode_) -
@@ -20882,9 +24782,20 @@ CMD_Machine_RoomSrvReportAddr::~CMD_Machine_RoomSrvReportAddr() {
 }
 
 void CMD_Machine_RoomSrvReportAddr::SharedDtor() {
-  ip_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  ::google::protobuf::Arena* arena = GetArenaNoVirtual();
+  if (arena != NULL) {
+    return;
+  }
+
+  ip_.Destroy(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), arena);
 }
 
+void CMD_Machine_RoomSrvReportAddr::ArenaDtor(void* object) {
+  CMD_Machine_RoomSrvReportAddr* _this = reinterpret_cast< CMD_Machine_RoomSrvReportAddr* >(object);
+  (void)_this;
+}
+void CMD_Machine_RoomSrvReportAddr::RegisterArenaDtor(::google::protobuf::Arena* arena) {
+}
 void CMD_Machine_RoomSrvReportAddr::SetCachedSize(int size) const {
   GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
   _cached_size_ = size;
@@ -20892,7 +24803,7 @@ void CMD_Machine_RoomSrvReportAddr::SetCachedSize(int size) const {
 }
 const ::google::protobuf::Descriptor* CMD_Machine_RoomSrvReportAddr::descriptor() {
   protobuf_Commands_2eproto::protobuf_AssignDescriptorsOnce();
-  return protobuf_Commands_2eproto::file_level_metadata[42].descriptor;
+  return protobuf_Commands_2eproto::file_level_metadata[44].descriptor;
 }
 
 const CMD_Machine_RoomSrvReportAddr& CMD_Machine_RoomSrvReportAddr::default_instance() {
@@ -20901,16 +24812,12 @@ const CMD_Machine_RoomSrvReportAddr& CMD_Machine_RoomSrvReportAddr::default_inst
 }
 
 CMD_Machine_RoomSrvReportAddr* CMD_Machine_RoomSrvReportAddr::New(::google::protobuf::Arena* arena) const {
-  CMD_Machine_RoomSrvReportAddr* n = new CMD_Machine_RoomSrvReportAddr;
-  if (arena != NULL) {
-    arena->Own(n);
-  }
-  return n;
+  return ::google::protobuf::Arena::CreateMessage<CMD_Machine_RoomSrvReportAddr>(arena);
 }
 
 void CMD_Machine_RoomSrvReportAddr::Clear() {
 // @@protoc_insertion_point(message_clear_start:CMD_Machine_RoomSrvReportAddr)
-  ip_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  ip_.ClearToEmpty(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
   ::memset(&hallsid_, 0, reinterpret_cast<char*>(&errcode_) -
     reinterpret_cast<char*>(&hallsid_) + sizeof(errcode_));
 }
@@ -21156,8 +25063,7 @@ void CMD_Machine_RoomSrvReportAddr::MergeFrom(const CMD_Machine_RoomSrvReportAdd
   GOOGLE_DCHECK_NE(&from, this);
   _internal_metadata_.MergeFrom(from._internal_metadata_);
   if (from.ip().size() > 0) {
-
-    ip_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.ip_);
+    set_ip(from.ip());
   }
   if (from.hallsid() != 0) {
     set_hallsid(from.hallsid());
@@ -21193,6 +25099,21 @@ bool CMD_Machine_RoomSrvReportAddr::IsInitialized() const {
 
 void CMD_Machine_RoomSrvReportAddr::Swap(CMD_Machine_RoomSrvReportAddr* other) {
   if (other == this) return;
+  if (GetArenaNoVirtual() == other->GetArenaNoVirtual()) {
+    InternalSwap(other);
+  } else {
+    CMD_Machine_RoomSrvReportAddr* temp = New(GetArenaNoVirtual());
+    temp->MergeFrom(*other);
+    other->CopyFrom(*this);
+    InternalSwap(temp);
+    if (GetArenaNoVirtual() == NULL) {
+      delete temp;
+    }
+  }
+}
+void CMD_Machine_RoomSrvReportAddr::UnsafeArenaSwap(CMD_Machine_RoomSrvReportAddr* other) {
+  if (other == this) return;
+  GOOGLE_DCHECK(GetArenaNoVirtual() == other->GetArenaNoVirtual());
   InternalSwap(other);
 }
 void CMD_Machine_RoomSrvReportAddr::InternalSwap(CMD_Machine_RoomSrvReportAddr* other) {
@@ -21206,7 +25127,7 @@ void CMD_Machine_RoomSrvReportAddr::InternalSwap(CMD_Machine_RoomSrvReportAddr*
 
 ::google::protobuf::Metadata CMD_Machine_RoomSrvReportAddr::GetMetadata() const {
   protobuf_Commands_2eproto::protobuf_AssignDescriptorsOnce();
-  return protobuf_Commands_2eproto::file_level_metadata[42];
+  return protobuf_Commands_2eproto::file_level_metadata[44];
 }
 
 #if PROTOBUF_INLINE_NOT_IN_HEADERS
@@ -21242,45 +25163,46 @@ void CMD_Machine_RoomSrvReportAddr::set_roomid(::google::protobuf::uint64 value)
 
 // string ip = 3;
 void CMD_Machine_RoomSrvReportAddr::clear_ip() {
-  ip_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  ip_.ClearToEmpty(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 const ::std::string& CMD_Machine_RoomSrvReportAddr::ip() const {
   // @@protoc_insertion_point(field_get:CMD_Machine_RoomSrvReportAddr.ip)
-  return ip_.GetNoArena();
+  return ip_.Get();
 }
 void CMD_Machine_RoomSrvReportAddr::set_ip(const ::std::string& value) {
   
-  ip_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  ip_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value, GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set:CMD_Machine_RoomSrvReportAddr.ip)
 }
-#if LANG_CXX11
-void CMD_Machine_RoomSrvReportAddr::set_ip(::std::string&& value) {
-  
-  ip_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:CMD_Machine_RoomSrvReportAddr.ip)
-}
-#endif
 void CMD_Machine_RoomSrvReportAddr::set_ip(const char* value) {
   
-  ip_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  ip_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+              GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_char:CMD_Machine_RoomSrvReportAddr.ip)
 }
-void CMD_Machine_RoomSrvReportAddr::set_ip(const char* value, size_t size) {
+void CMD_Machine_RoomSrvReportAddr::set_ip(const char* value,
+    size_t size) {
   
-  ip_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
+  ip_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_pointer:CMD_Machine_RoomSrvReportAddr.ip)
 }
 ::std::string* CMD_Machine_RoomSrvReportAddr::mutable_ip() {
   
   // @@protoc_insertion_point(field_mutable:CMD_Machine_RoomSrvReportAddr.ip)
-  return ip_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return ip_.Mutable(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 ::std::string* CMD_Machine_RoomSrvReportAddr::release_ip() {
   // @@protoc_insertion_point(field_release:CMD_Machine_RoomSrvReportAddr.ip)
   
-  return ip_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return ip_.Release(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
+}
+::std::string* CMD_Machine_RoomSrvReportAddr::unsafe_arena_release_ip() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:CMD_Machine_RoomSrvReportAddr.ip)
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  
+  return ip_.UnsafeArenaRelease(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      GetArenaNoVirtual());
 }
 void CMD_Machine_RoomSrvReportAddr::set_allocated_ip(::std::string* ip) {
   if (ip != NULL) {
@@ -21288,9 +25210,22 @@ void CMD_Machine_RoomSrvReportAddr::set_allocated_ip(::std::string* ip) {
   } else {
     
   }
-  ip_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ip);
+  ip_.SetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ip,
+      GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_allocated:CMD_Machine_RoomSrvReportAddr.ip)
 }
+void CMD_Machine_RoomSrvReportAddr::unsafe_arena_set_allocated_ip(
+    ::std::string* ip) {
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  if (ip != NULL) {
+    
+  } else {
+    
+  }
+  ip_.UnsafeArenaSetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      ip, GetArenaNoVirtual());
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:CMD_Machine_RoomSrvReportAddr.ip)
+}
 
 // int32 port = 4;
 void CMD_Machine_RoomSrvReportAddr::clear_port() {
@@ -21339,6 +25274,17 @@ CMD_Machine_OnRoomSrvGameOverReport::CMD_Machine_OnRoomSrvGameOverReport()
   SharedCtor();
   // @@protoc_insertion_point(constructor:CMD_Machine_OnRoomSrvGameOverReport)
 }
+CMD_Machine_OnRoomSrvGameOverReport::CMD_Machine_OnRoomSrvGameOverReport(::google::protobuf::Arena* arena)
+  : ::google::protobuf::Message(),
+  _internal_metadata_(arena),
+  playerdatas_(arena) {
+#ifdef GOOGLE_PROTOBUF_NO_STATIC_INITIALIZER
+  protobuf_Commands_2eproto::InitDefaults();
+#endif  // GOOGLE_PROTOBUF_NO_STATIC_INITIALIZER
+  SharedCtor();
+  RegisterArenaDtor(arena);
+  // @@protoc_insertion_point(arena_constructor:CMD_Machine_OnRoomSrvGameOverReport)
+}
 CMD_Machine_OnRoomSrvGameOverReport::CMD_Machine_OnRoomSrvGameOverReport(const CMD_Machine_OnRoomSrvGameOverReport& from)
   : ::google::protobuf::Message(),
       _internal_metadata_(NULL),
@@ -21363,8 +25309,19 @@ CMD_Machine_OnRoomSrvGameOverReport::~CMD_Machine_OnRoomSrvGameOverReport() {
 }
 
 void CMD_Machine_OnRoomSrvGameOverReport::SharedDtor() {
+  ::google::protobuf::Arena* arena = GetArenaNoVirtual();
+  if (arena != NULL) {
+    return;
+  }
+
 }
 
+void CMD_Machine_OnRoomSrvGameOverReport::ArenaDtor(void* object) {
+  CMD_Machine_OnRoomSrvGameOverReport* _this = reinterpret_cast< CMD_Machine_OnRoomSrvGameOverReport* >(object);
+  (void)_this;
+}
+void CMD_Machine_OnRoomSrvGameOverReport::RegisterArenaDtor(::google::protobuf::Arena* arena) {
+}
 void CMD_Machine_OnRoomSrvGameOverReport::SetCachedSize(int size) const {
   GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
   _cached_size_ = size;
@@ -21372,7 +25329,7 @@ void CMD_Machine_OnRoomSrvGameOverReport::SetCachedSize(int size) const {
 }
 const ::google::protobuf::Descriptor* CMD_Machine_OnRoomSrvGameOverReport::descriptor() {
   protobuf_Commands_2eproto::protobuf_AssignDescriptorsOnce();
-  return protobuf_Commands_2eproto::file_level_metadata[43].descriptor;
+  return protobuf_Commands_2eproto::file_level_metadata[45].descriptor;
 }
 
 const CMD_Machine_OnRoomSrvGameOverReport& CMD_Machine_OnRoomSrvGameOverReport::default_instance() {
@@ -21381,11 +25338,7 @@ const CMD_Machine_OnRoomSrvGameOverReport& CMD_Machine_OnRoomSrvGameOverReport::
 }
 
 CMD_Machine_OnRoomSrvGameOverReport* CMD_Machine_OnRoomSrvGameOverReport::New(::google::protobuf::Arena* arena) const {
-  CMD_Machine_OnRoomSrvGameOverReport* n = new CMD_Machine_OnRoomSrvGameOverReport;
-  if (arena != NULL) {
-    arena->Own(n);
-  }
-  return n;
+  return ::google::protobuf::Arena::CreateMessage<CMD_Machine_OnRoomSrvGameOverReport>(arena);
 }
 
 void CMD_Machine_OnRoomSrvGameOverReport::Clear() {
@@ -21631,6 +25584,21 @@ bool CMD_Machine_OnRoomSrvGameOverReport::IsInitialized() const {
 
 void CMD_Machine_OnRoomSrvGameOverReport::Swap(CMD_Machine_OnRoomSrvGameOverReport* other) {
   if (other == this) return;
+  if (GetArenaNoVirtual() == other->GetArenaNoVirtual()) {
+    InternalSwap(other);
+  } else {
+    CMD_Machine_OnRoomSrvGameOverReport* temp = New(GetArenaNoVirtual());
+    temp->MergeFrom(*other);
+    other->CopyFrom(*this);
+    InternalSwap(temp);
+    if (GetArenaNoVirtual() == NULL) {
+      delete temp;
+    }
+  }
+}
+void CMD_Machine_OnRoomSrvGameOverReport::UnsafeArenaSwap(CMD_Machine_OnRoomSrvGameOverReport* other) {
+  if (other == this) return;
+  GOOGLE_DCHECK(GetArenaNoVirtual() == other->GetArenaNoVirtual());
   InternalSwap(other);
 }
 void CMD_Machine_OnRoomSrvGameOverReport::InternalSwap(CMD_Machine_OnRoomSrvGameOverReport* other) {
@@ -21643,7 +25611,7 @@ void CMD_Machine_OnRoomSrvGameOverReport::InternalSwap(CMD_Machine_OnRoomSrvGame
 
 ::google::protobuf::Metadata CMD_Machine_OnRoomSrvGameOverReport::GetMetadata() const {
   protobuf_Commands_2eproto::protobuf_AssignDescriptorsOnce();
-  return protobuf_Commands_2eproto::file_level_metadata[43];
+  return protobuf_Commands_2eproto::file_level_metadata[45];
 }
 
 #if PROTOBUF_INLINE_NOT_IN_HEADERS
@@ -21741,6 +25709,16 @@ CMD_ListServersInfo::CMD_ListServersInfo()
   SharedCtor();
   // @@protoc_insertion_point(constructor:CMD_ListServersInfo)
 }
+CMD_ListServersInfo::CMD_ListServersInfo(::google::protobuf::Arena* arena)
+  : ::google::protobuf::Message(),
+  _internal_metadata_(arena) {
+#ifdef GOOGLE_PROTOBUF_NO_STATIC_INITIALIZER
+  protobuf_Commands_2eproto::InitDefaults();
+#endif  // GOOGLE_PROTOBUF_NO_STATIC_INITIALIZER
+  SharedCtor();
+  RegisterArenaDtor(arena);
+  // @@protoc_insertion_point(arena_constructor:CMD_ListServersInfo)
+}
 CMD_ListServersInfo::CMD_ListServersInfo(const CMD_ListServersInfo& from)
   : ::google::protobuf::Message(),
       _internal_metadata_(NULL),
@@ -21748,11 +25726,13 @@ CMD_ListServersInfo::CMD_ListServersInfo(const CMD_ListServersInfo& from)
   _internal_metadata_.MergeFrom(from._internal_metadata_);
   addr_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
   if (from.addr().size() > 0) {
-    addr_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.addr_);
+    addr_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.addr(),
+      GetArenaNoVirtual());
   }
   name_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
   if (from.name().size() > 0) {
-    name_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.name_);
+    name_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.name(),
+      GetArenaNoVirtual());
   }
   ::memcpy(&groupid_, &from.groupid_,
     reinterpret_cast<char*>(&port_) -
@@ -21774,10 +25754,21 @@ CMD_ListServersInfo::~CMD_ListServersInfo() {
 }
 
 void CMD_ListServersInfo::SharedDtor() {
-  addr_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  name_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  ::google::protobuf::Arena* arena = GetArenaNoVirtual();
+  if (arena != NULL) {
+    return;
+  }
+
+  addr_.Destroy(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), arena);
+  name_.Destroy(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), arena);
 }
 
+void CMD_ListServersInfo::ArenaDtor(void* object) {
+  CMD_ListServersInfo* _this = reinterpret_cast< CMD_ListServersInfo* >(object);
+  (void)_this;
+}
+void CMD_ListServersInfo::RegisterArenaDtor(::google::protobuf::Arena* arena) {
+}
 void CMD_ListServersInfo::SetCachedSize(int size) const {
   GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
   _cached_size_ = size;
@@ -21785,7 +25776,7 @@ void CMD_ListServersInfo::SetCachedSize(int size) const {
 }
 const ::google::protobuf::Descriptor* CMD_ListServersInfo::descriptor() {
   protobuf_Commands_2eproto::protobuf_AssignDescriptorsOnce();
-  return protobuf_Commands_2eproto::file_level_metadata[44].descriptor;
+  return protobuf_Commands_2eproto::file_level_metadata[46].descriptor;
 }
 
 const CMD_ListServersInfo& CMD_ListServersInfo::default_instance() {
@@ -21794,17 +25785,13 @@ const CMD_ListServersInfo& CMD_ListServersInfo::default_instance() {
 }
 
 CMD_ListServersInfo* CMD_ListServersInfo::New(::google::protobuf::Arena* arena) const {
-  CMD_ListServersInfo* n = new CMD_ListServersInfo;
-  if (arena != NULL) {
-    arena->Own(n);
-  }
-  return n;
+  return ::google::protobuf::Arena::CreateMessage<CMD_ListServersInfo>(arena);
 }
 
 void CMD_ListServersInfo::Clear() {
 // @@protoc_insertion_point(message_clear_start:CMD_ListServersInfo)
-  addr_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  name_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  addr_.ClearToEmpty(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
+  name_.ClearToEmpty(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
   ::memset(&groupid_, 0, reinterpret_cast<char*>(&port_) -
     reinterpret_cast<char*>(&groupid_) + sizeof(port_));
 }
@@ -22061,12 +26048,10 @@ void CMD_ListServersInfo::MergeFrom(const CMD_ListServersInfo& from) {
   GOOGLE_DCHECK_NE(&from, this);
   _internal_metadata_.MergeFrom(from._internal_metadata_);
   if (from.addr().size() > 0) {
-
-    addr_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.addr_);
+    set_addr(from.addr());
   }
   if (from.name().size() > 0) {
-
-    name_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.name_);
+    set_name(from.name());
   }
   if (from.groupid() != 0) {
     set_groupid(from.groupid());
@@ -22099,6 +26084,21 @@ bool CMD_ListServersInfo::IsInitialized() const {
 
 void CMD_ListServersInfo::Swap(CMD_ListServersInfo* other) {
   if (other == this) return;
+  if (GetArenaNoVirtual() == other->GetArenaNoVirtual()) {
+    InternalSwap(other);
+  } else {
+    CMD_ListServersInfo* temp = New(GetArenaNoVirtual());
+    temp->MergeFrom(*other);
+    other->CopyFrom(*this);
+    InternalSwap(temp);
+    if (GetArenaNoVirtual() == NULL) {
+      delete temp;
+    }
+  }
+}
+void CMD_ListServersInfo::UnsafeArenaSwap(CMD_ListServersInfo* other) {
+  if (other == this) return;
+  GOOGLE_DCHECK(GetArenaNoVirtual() == other->GetArenaNoVirtual());
   InternalSwap(other);
 }
 void CMD_ListServersInfo::InternalSwap(CMD_ListServersInfo* other) {
@@ -22112,7 +26112,7 @@ void CMD_ListServersInfo::InternalSwap(CMD_ListServersInfo* other) {
 
 ::google::protobuf::Metadata CMD_ListServersInfo::GetMetadata() const {
   protobuf_Commands_2eproto::protobuf_AssignDescriptorsOnce();
-  return protobuf_Commands_2eproto::file_level_metadata[44];
+  return protobuf_Commands_2eproto::file_level_metadata[46];
 }
 
 #if PROTOBUF_INLINE_NOT_IN_HEADERS
@@ -22120,45 +26120,46 @@ void CMD_ListServersInfo::InternalSwap(CMD_ListServersInfo* other) {
 
 // string addr = 1;
 void CMD_ListServersInfo::clear_addr() {
-  addr_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  addr_.ClearToEmpty(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 const ::std::string& CMD_ListServersInfo::addr() const {
   // @@protoc_insertion_point(field_get:CMD_ListServersInfo.addr)
-  return addr_.GetNoArena();
+  return addr_.Get();
 }
 void CMD_ListServersInfo::set_addr(const ::std::string& value) {
   
-  addr_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  addr_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value, GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set:CMD_ListServersInfo.addr)
 }
-#if LANG_CXX11
-void CMD_ListServersInfo::set_addr(::std::string&& value) {
-  
-  addr_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:CMD_ListServersInfo.addr)
-}
-#endif
 void CMD_ListServersInfo::set_addr(const char* value) {
   
-  addr_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  addr_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+              GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_char:CMD_ListServersInfo.addr)
 }
-void CMD_ListServersInfo::set_addr(const char* value, size_t size) {
+void CMD_ListServersInfo::set_addr(const char* value,
+    size_t size) {
   
-  addr_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
+  addr_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_pointer:CMD_ListServersInfo.addr)
 }
 ::std::string* CMD_ListServersInfo::mutable_addr() {
   
   // @@protoc_insertion_point(field_mutable:CMD_ListServersInfo.addr)
-  return addr_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return addr_.Mutable(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 ::std::string* CMD_ListServersInfo::release_addr() {
   // @@protoc_insertion_point(field_release:CMD_ListServersInfo.addr)
   
-  return addr_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return addr_.Release(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
+}
+::std::string* CMD_ListServersInfo::unsafe_arena_release_addr() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:CMD_ListServersInfo.addr)
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  
+  return addr_.UnsafeArenaRelease(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      GetArenaNoVirtual());
 }
 void CMD_ListServersInfo::set_allocated_addr(::std::string* addr) {
   if (addr != NULL) {
@@ -22166,9 +26167,22 @@ void CMD_ListServersInfo::set_allocated_addr(::std::string* addr) {
   } else {
     
   }
-  addr_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), addr);
+  addr_.SetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), addr,
+      GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_allocated:CMD_ListServersInfo.addr)
 }
+void CMD_ListServersInfo::unsafe_arena_set_allocated_addr(
+    ::std::string* addr) {
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  if (addr != NULL) {
+    
+  } else {
+    
+  }
+  addr_.UnsafeArenaSetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      addr, GetArenaNoVirtual());
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:CMD_ListServersInfo.addr)
+}
 
 // int32 port = 2;
 void CMD_ListServersInfo::clear_port() {
@@ -22200,45 +26214,46 @@ void CMD_ListServersInfo::set_groupid(::google::protobuf::uint64 value) {
 
 // string name = 4;
 void CMD_ListServersInfo::clear_name() {
-  name_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  name_.ClearToEmpty(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 const ::std::string& CMD_ListServersInfo::name() const {
   // @@protoc_insertion_point(field_get:CMD_ListServersInfo.name)
-  return name_.GetNoArena();
+  return name_.Get();
 }
 void CMD_ListServersInfo::set_name(const ::std::string& value) {
   
-  name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  name_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value, GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set:CMD_ListServersInfo.name)
 }
-#if LANG_CXX11
-void CMD_ListServersInfo::set_name(::std::string&& value) {
-  
-  name_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:CMD_ListServersInfo.name)
-}
-#endif
 void CMD_ListServersInfo::set_name(const char* value) {
   
-  name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  name_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+              GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_char:CMD_ListServersInfo.name)
 }
-void CMD_ListServersInfo::set_name(const char* value, size_t size) {
+void CMD_ListServersInfo::set_name(const char* value,
+    size_t size) {
   
-  name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
+  name_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_pointer:CMD_ListServersInfo.name)
 }
 ::std::string* CMD_ListServersInfo::mutable_name() {
   
   // @@protoc_insertion_point(field_mutable:CMD_ListServersInfo.name)
-  return name_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return name_.Mutable(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 ::std::string* CMD_ListServersInfo::release_name() {
   // @@protoc_insertion_point(field_release:CMD_ListServersInfo.name)
   
-  return name_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return name_.Release(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
+}
+::std::string* CMD_ListServersInfo::unsafe_arena_release_name() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:CMD_ListServersInfo.name)
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  
+  return name_.UnsafeArenaRelease(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      GetArenaNoVirtual());
 }
 void CMD_ListServersInfo::set_allocated_name(::std::string* name) {
   if (name != NULL) {
@@ -22246,9 +26261,22 @@ void CMD_ListServersInfo::set_allocated_name(::std::string* name) {
   } else {
     
   }
-  name_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), name);
+  name_.SetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), name,
+      GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_allocated:CMD_ListServersInfo.name)
 }
+void CMD_ListServersInfo::unsafe_arena_set_allocated_name(
+    ::std::string* name) {
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  if (name != NULL) {
+    
+  } else {
+    
+  }
+  name_.UnsafeArenaSetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      name, GetArenaNoVirtual());
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:CMD_ListServersInfo.name)
+}
 
 // uint64 id = 5;
 void CMD_ListServersInfo::clear_id() {
@@ -22281,6 +26309,17 @@ CMD_Client_OnListServersCB::CMD_Client_OnListServersCB()
   SharedCtor();
   // @@protoc_insertion_point(constructor:CMD_Client_OnListServersCB)
 }
+CMD_Client_OnListServersCB::CMD_Client_OnListServersCB(::google::protobuf::Arena* arena)
+  : ::google::protobuf::Message(),
+  _internal_metadata_(arena),
+  srvs_(arena) {
+#ifdef GOOGLE_PROTOBUF_NO_STATIC_INITIALIZER
+  protobuf_Commands_2eproto::InitDefaults();
+#endif  // GOOGLE_PROTOBUF_NO_STATIC_INITIALIZER
+  SharedCtor();
+  RegisterArenaDtor(arena);
+  // @@protoc_insertion_point(arena_constructor:CMD_Client_OnListServersCB)
+}
 CMD_Client_OnListServersCB::CMD_Client_OnListServersCB(const CMD_Client_OnListServersCB& from)
   : ::google::protobuf::Message(),
       _internal_metadata_(NULL),
@@ -22302,8 +26341,19 @@ CMD_Client_OnListServersCB::~CMD_Client_OnListServersCB() {
 }
 
 void CMD_Client_OnListServersCB::SharedDtor() {
+  ::google::protobuf::Arena* arena = GetArenaNoVirtual();
+  if (arena != NULL) {
+    return;
+  }
+
 }
 
+void CMD_Client_OnListServersCB::ArenaDtor(void* object) {
+  CMD_Client_OnListServersCB* _this = reinterpret_cast< CMD_Client_OnListServersCB* >(object);
+  (void)_this;
+}
+void CMD_Client_OnListServersCB::RegisterArenaDtor(::google::protobuf::Arena* arena) {
+}
 void CMD_Client_OnListServersCB::SetCachedSize(int size) const {
   GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
   _cached_size_ = size;
@@ -22311,7 +26361,7 @@ void CMD_Client_OnListServersCB::SetCachedSize(int size) const {
 }
 const ::google::protobuf::Descriptor* CMD_Client_OnListServersCB::descriptor() {
   protobuf_Commands_2eproto::protobuf_AssignDescriptorsOnce();
-  return protobuf_Commands_2eproto::file_level_metadata[45].descriptor;
+  return protobuf_Commands_2eproto::file_level_metadata[47].descriptor;
 }
 
 const CMD_Client_OnListServersCB& CMD_Client_OnListServersCB::default_instance() {
@@ -22320,11 +26370,7 @@ const CMD_Client_OnListServersCB& CMD_Client_OnListServersCB::default_instance()
 }
 
 CMD_Client_OnListServersCB* CMD_Client_OnListServersCB::New(::google::protobuf::Arena* arena) const {
-  CMD_Client_OnListServersCB* n = new CMD_Client_OnListServersCB;
-  if (arena != NULL) {
-    arena->Own(n);
-  }
-  return n;
+  return ::google::protobuf::Arena::CreateMessage<CMD_Client_OnListServersCB>(arena);
 }
 
 void CMD_Client_OnListServersCB::Clear() {
@@ -22503,6 +26549,21 @@ bool CMD_Client_OnListServersCB::IsInitialized() const {
 
 void CMD_Client_OnListServersCB::Swap(CMD_Client_OnListServersCB* other) {
   if (other == this) return;
+  if (GetArenaNoVirtual() == other->GetArenaNoVirtual()) {
+    InternalSwap(other);
+  } else {
+    CMD_Client_OnListServersCB* temp = New(GetArenaNoVirtual());
+    temp->MergeFrom(*other);
+    other->CopyFrom(*this);
+    InternalSwap(temp);
+    if (GetArenaNoVirtual() == NULL) {
+      delete temp;
+    }
+  }
+}
+void CMD_Client_OnListServersCB::UnsafeArenaSwap(CMD_Client_OnListServersCB* other) {
+  if (other == this) return;
+  GOOGLE_DCHECK(GetArenaNoVirtual() == other->GetArenaNoVirtual());
   InternalSwap(other);
 }
 void CMD_Client_OnListServersCB::InternalSwap(CMD_Client_OnListServersCB* other) {
@@ -22513,7 +26574,7 @@ void CMD_Client_OnListServersCB::InternalSwap(CMD_Client_OnListServersCB* other)
 
 ::google::protobuf::Metadata CMD_Client_OnListServersCB::GetMetadata() const {
   protobuf_Commands_2eproto::protobuf_AssignDescriptorsOnce();
-  return protobuf_Commands_2eproto::file_level_metadata[45];
+  return protobuf_Commands_2eproto::file_level_metadata[47];
 }
 
 #if PROTOBUF_INLINE_NOT_IN_HEADERS
@@ -22580,6 +26641,16 @@ CMD_Client_OnSignupCB::CMD_Client_OnSignupCB()
   SharedCtor();
   // @@protoc_insertion_point(constructor:CMD_Client_OnSignupCB)
 }
+CMD_Client_OnSignupCB::CMD_Client_OnSignupCB(::google::protobuf::Arena* arena)
+  : ::google::protobuf::Message(),
+  _internal_metadata_(arena) {
+#ifdef GOOGLE_PROTOBUF_NO_STATIC_INITIALIZER
+  protobuf_Commands_2eproto::InitDefaults();
+#endif  // GOOGLE_PROTOBUF_NO_STATIC_INITIALIZER
+  SharedCtor();
+  RegisterArenaDtor(arena);
+  // @@protoc_insertion_point(arena_constructor:CMD_Client_OnSignupCB)
+}
 CMD_Client_OnSignupCB::CMD_Client_OnSignupCB(const CMD_Client_OnSignupCB& from)
   : ::google::protobuf::Message(),
       _internal_metadata_(NULL),
@@ -22587,7 +26658,8 @@ CMD_Client_OnSignupCB::CMD_Client_OnSignupCB(const CMD_Client_OnSignupCB& from)
   _internal_metadata_.MergeFrom(from._internal_metadata_);
   datas_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
   if (from.datas().size() > 0) {
-    datas_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.datas_);
+    datas_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.datas(),
+      GetArenaNoVirtual());
   }
   errcode_ = from.errcode_;
   // @@protoc_insertion_point(copy_constructor:CMD_Client_OnSignupCB)
@@ -22605,9 +26677,20 @@ CMD_Client_OnSignupCB::~CMD_Client_OnSignupCB() {
 }
 
 void CMD_Client_OnSignupCB::SharedDtor() {
-  datas_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  ::google::protobuf::Arena* arena = GetArenaNoVirtual();
+  if (arena != NULL) {
+    return;
+  }
+
+  datas_.Destroy(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), arena);
 }
 
+void CMD_Client_OnSignupCB::ArenaDtor(void* object) {
+  CMD_Client_OnSignupCB* _this = reinterpret_cast< CMD_Client_OnSignupCB* >(object);
+  (void)_this;
+}
+void CMD_Client_OnSignupCB::RegisterArenaDtor(::google::protobuf::Arena* arena) {
+}
 void CMD_Client_OnSignupCB::SetCachedSize(int size) const {
   GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
   _cached_size_ = size;
@@ -22615,7 +26698,7 @@ void CMD_Client_OnSignupCB::SetCachedSize(int size) const {
 }
 const ::google::protobuf::Descriptor* CMD_Client_OnSignupCB::descriptor() {
   protobuf_Commands_2eproto::protobuf_AssignDescriptorsOnce();
-  return protobuf_Commands_2eproto::file_level_metadata[46].descriptor;
+  return protobuf_Commands_2eproto::file_level_metadata[48].descriptor;
 }
 
 const CMD_Client_OnSignupCB& CMD_Client_OnSignupCB::default_instance() {
@@ -22624,16 +26707,12 @@ const CMD_Client_OnSignupCB& CMD_Client_OnSignupCB::default_instance() {
 }
 
 CMD_Client_OnSignupCB* CMD_Client_OnSignupCB::New(::google::protobuf::Arena* arena) const {
-  CMD_Client_OnSignupCB* n = new CMD_Client_OnSignupCB;
-  if (arena != NULL) {
-    arena->Own(n);
-  }
-  return n;
+  return ::google::protobuf::Arena::CreateMessage<CMD_Client_OnSignupCB>(arena);
 }
 
 void CMD_Client_OnSignupCB::Clear() {
 // @@protoc_insertion_point(message_clear_start:CMD_Client_OnSignupCB)
-  datas_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  datas_.ClearToEmpty(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
   errcode_ = 0;
 }
 
@@ -22776,8 +26855,7 @@ void CMD_Client_OnSignupCB::MergeFrom(const CMD_Client_OnSignupCB& from) {
   GOOGLE_DCHECK_NE(&from, this);
   _internal_metadata_.MergeFrom(from._internal_metadata_);
   if (from.datas().size() > 0) {
-
-    datas_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.datas_);
+    set_datas(from.datas());
   }
   if (from.errcode() != 0) {
     set_errcode(from.errcode());
@@ -22804,6 +26882,21 @@ bool CMD_Client_OnSignupCB::IsInitialized() const {
 
 void CMD_Client_OnSignupCB::Swap(CMD_Client_OnSignupCB* other) {
   if (other == this) return;
+  if (GetArenaNoVirtual() == other->GetArenaNoVirtual()) {
+    InternalSwap(other);
+  } else {
+    CMD_Client_OnSignupCB* temp = New(GetArenaNoVirtual());
+    temp->MergeFrom(*other);
+    other->CopyFrom(*this);
+    InternalSwap(temp);
+    if (GetArenaNoVirtual() == NULL) {
+      delete temp;
+    }
+  }
+}
+void CMD_Client_OnSignupCB::UnsafeArenaSwap(CMD_Client_OnSignupCB* other) {
+  if (other == this) return;
+  GOOGLE_DCHECK(GetArenaNoVirtual() == other->GetArenaNoVirtual());
   InternalSwap(other);
 }
 void CMD_Client_OnSignupCB::InternalSwap(CMD_Client_OnSignupCB* other) {
@@ -22814,7 +26907,7 @@ void CMD_Client_OnSignupCB::InternalSwap(CMD_Client_OnSignupCB* other) {
 
 ::google::protobuf::Metadata CMD_Client_OnSignupCB::GetMetadata() const {
   protobuf_Commands_2eproto::protobuf_AssignDescriptorsOnce();
-  return protobuf_Commands_2eproto::file_level_metadata[46];
+  return protobuf_Commands_2eproto::file_level_metadata[48];
 }
 
 #if PROTOBUF_INLINE_NOT_IN_HEADERS
@@ -22836,45 +26929,46 @@ void CMD_Client_OnSignupCB::set_errcode(::ServerError value) {
 
 // bytes datas = 2;
 void CMD_Client_OnSignupCB::clear_datas() {
-  datas_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  datas_.ClearToEmpty(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 const ::std::string& CMD_Client_OnSignupCB::datas() const {
   // @@protoc_insertion_point(field_get:CMD_Client_OnSignupCB.datas)
-  return datas_.GetNoArena();
+  return datas_.Get();
 }
 void CMD_Client_OnSignupCB::set_datas(const ::std::string& value) {
   
-  datas_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  datas_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value, GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set:CMD_Client_OnSignupCB.datas)
 }
-#if LANG_CXX11
-void CMD_Client_OnSignupCB::set_datas(::std::string&& value) {
-  
-  datas_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:CMD_Client_OnSignupCB.datas)
-}
-#endif
 void CMD_Client_OnSignupCB::set_datas(const char* value) {
   
-  datas_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  datas_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+              GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_char:CMD_Client_OnSignupCB.datas)
 }
-void CMD_Client_OnSignupCB::set_datas(const void* value, size_t size) {
+void CMD_Client_OnSignupCB::set_datas(const void* value,
+    size_t size) {
   
-  datas_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
+  datas_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_pointer:CMD_Client_OnSignupCB.datas)
 }
 ::std::string* CMD_Client_OnSignupCB::mutable_datas() {
   
   // @@protoc_insertion_point(field_mutable:CMD_Client_OnSignupCB.datas)
-  return datas_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return datas_.Mutable(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 ::std::string* CMD_Client_OnSignupCB::release_datas() {
   // @@protoc_insertion_point(field_release:CMD_Client_OnSignupCB.datas)
   
-  return datas_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return datas_.Release(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
+}
+::std::string* CMD_Client_OnSignupCB::unsafe_arena_release_datas() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:CMD_Client_OnSignupCB.datas)
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  
+  return datas_.UnsafeArenaRelease(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      GetArenaNoVirtual());
 }
 void CMD_Client_OnSignupCB::set_allocated_datas(::std::string* datas) {
   if (datas != NULL) {
@@ -22882,9 +26976,22 @@ void CMD_Client_OnSignupCB::set_allocated_datas(::std::string* datas) {
   } else {
     
   }
-  datas_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), datas);
+  datas_.SetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), datas,
+      GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_allocated:CMD_Client_OnSignupCB.datas)
 }
+void CMD_Client_OnSignupCB::unsafe_arena_set_allocated_datas(
+    ::std::string* datas) {
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  if (datas != NULL) {
+    
+  } else {
+    
+  }
+  datas_.UnsafeArenaSetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      datas, GetArenaNoVirtual());
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:CMD_Client_OnSignupCB.datas)
+}
 
 #endif  // PROTOBUF_INLINE_NOT_IN_HEADERS
 
@@ -22896,6 +27003,7 @@ const int CMD_Client_OnSigninCB::kDatasFieldNumber;
 const int CMD_Client_OnSigninCB::kAddrFieldNumber;
 const int CMD_Client_OnSigninCB::kPortFieldNumber;
 const int CMD_Client_OnSigninCB::kTokenIDFieldNumber;
+const int CMD_Client_OnSigninCB::kHallsIDFieldNumber;
 #endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
 
 CMD_Client_OnSigninCB::CMD_Client_OnSigninCB()
@@ -22906,6 +27014,16 @@ CMD_Client_OnSigninCB::CMD_Client_OnSigninCB()
   SharedCtor();
   // @@protoc_insertion_point(constructor:CMD_Client_OnSigninCB)
 }
+CMD_Client_OnSigninCB::CMD_Client_OnSigninCB(::google::protobuf::Arena* arena)
+  : ::google::protobuf::Message(),
+  _internal_metadata_(arena) {
+#ifdef GOOGLE_PROTOBUF_NO_STATIC_INITIALIZER
+  protobuf_Commands_2eproto::InitDefaults();
+#endif  // GOOGLE_PROTOBUF_NO_STATIC_INITIALIZER
+  SharedCtor();
+  RegisterArenaDtor(arena);
+  // @@protoc_insertion_point(arena_constructor:CMD_Client_OnSigninCB)
+}
 CMD_Client_OnSigninCB::CMD_Client_OnSigninCB(const CMD_Client_OnSigninCB& from)
   : ::google::protobuf::Message(),
       _internal_metadata_(NULL),
@@ -22913,23 +27031,25 @@ CMD_Client_OnSigninCB::CMD_Client_OnSigninCB(const CMD_Client_OnSigninCB& from)
   _internal_metadata_.MergeFrom(from._internal_metadata_);
   datas_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
   if (from.datas().size() > 0) {
-    datas_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.datas_);
+    datas_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.datas(),
+      GetArenaNoVirtual());
   }
   addr_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
   if (from.addr().size() > 0) {
-    addr_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.addr_);
+    addr_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.addr(),
+      GetArenaNoVirtual());
   }
   ::memcpy(&errcode_, &from.errcode_,
-    reinterpret_cast<char*>(&tokenid_) -
-    reinterpret_cast<char*>(&errcode_) + sizeof(tokenid_));
+    reinterpret_cast<char*>(&hallsid_) -
+    reinterpret_cast<char*>(&errcode_) + sizeof(hallsid_));
   // @@protoc_insertion_point(copy_constructor:CMD_Client_OnSigninCB)
 }
 
 void CMD_Client_OnSigninCB::SharedCtor() {
   datas_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
   addr_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  ::memset(&errcode_, 0, reinterpret_cast<char*>(&tokenid_) -
-    reinterpret_cast<char*>(&errcode_) + sizeof(tokenid_));
+  ::memset(&errcode_, 0, reinterpret_cast<char*>(&hallsid_) -
+    reinterpret_cast<char*>(&errcode_) + sizeof(hallsid_));
   _cached_size_ = 0;
 }
 
@@ -22939,10 +27059,21 @@ CMD_Client_OnSigninCB::~CMD_Client_OnSigninCB() {
 }
 
 void CMD_Client_OnSigninCB::SharedDtor() {
-  datas_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  addr_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  ::google::protobuf::Arena* arena = GetArenaNoVirtual();
+  if (arena != NULL) {
+    return;
+  }
+
+  datas_.Destroy(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), arena);
+  addr_.Destroy(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), arena);
 }
 
+void CMD_Client_OnSigninCB::ArenaDtor(void* object) {
+  CMD_Client_OnSigninCB* _this = reinterpret_cast< CMD_Client_OnSigninCB* >(object);
+  (void)_this;
+}
+void CMD_Client_OnSigninCB::RegisterArenaDtor(::google::protobuf::Arena* arena) {
+}
 void CMD_Client_OnSigninCB::SetCachedSize(int size) const {
   GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
   _cached_size_ = size;
@@ -22950,7 +27081,7 @@ void CMD_Client_OnSigninCB::SetCachedSize(int size) const {
 }
 const ::google::protobuf::Descriptor* CMD_Client_OnSigninCB::descriptor() {
   protobuf_Commands_2eproto::protobuf_AssignDescriptorsOnce();
-  return protobuf_Commands_2eproto::file_level_metadata[47].descriptor;
+  return protobuf_Commands_2eproto::file_level_metadata[49].descriptor;
 }
 
 const CMD_Client_OnSigninCB& CMD_Client_OnSigninCB::default_instance() {
@@ -22959,19 +27090,15 @@ const CMD_Client_OnSigninCB& CMD_Client_OnSigninCB::default_instance() {
 }
 
 CMD_Client_OnSigninCB* CMD_Client_OnSigninCB::New(::google::protobuf::Arena* arena) const {
-  CMD_Client_OnSigninCB* n = new CMD_Client_OnSigninCB;
-  if (arena != NULL) {
-    arena->Own(n);
-  }
-  return n;
+  return ::google::protobuf::Arena::CreateMessage<CMD_Client_OnSigninCB>(arena);
 }
 
 void CMD_Client_OnSigninCB::Clear() {
 // @@protoc_insertion_point(message_clear_start:CMD_Client_OnSigninCB)
-  datas_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  addr_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  ::memset(&errcode_, 0, reinterpret_cast<char*>(&tokenid_) -
-    reinterpret_cast<char*>(&errcode_) + sizeof(tokenid_));
+  datas_.ClearToEmpty(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
+  addr_.ClearToEmpty(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
+  ::memset(&errcode_, 0, reinterpret_cast<char*>(&hallsid_) -
+    reinterpret_cast<char*>(&errcode_) + sizeof(hallsid_));
 }
 
 bool CMD_Client_OnSigninCB::MergePartialFromCodedStream(
@@ -23050,6 +27177,19 @@ bool CMD_Client_OnSigninCB::MergePartialFromCodedStream(
         break;
       }
 
+      // uint64 hallsID = 6;
+      case 6: {
+        if (tag == 48u) {
+
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
+                 input, &hallsid_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
       default: {
       handle_unusual:
         if (tag == 0 ||
@@ -23106,6 +27246,11 @@ void CMD_Client_OnSigninCB::SerializeWithCachedSizes(
     ::google::protobuf::internal::WireFormatLite::WriteUInt64(5, this->tokenid(), output);
   }
 
+  // uint64 hallsID = 6;
+  if (this->hallsid() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt64(6, this->hallsid(), output);
+  }
+
   // @@protoc_insertion_point(serialize_end:CMD_Client_OnSigninCB)
 }
 
@@ -23147,6 +27292,11 @@ void CMD_Client_OnSigninCB::SerializeWithCachedSizes(
     target = ::google::protobuf::internal::WireFormatLite::WriteUInt64ToArray(5, this->tokenid(), target);
   }
 
+  // uint64 hallsID = 6;
+  if (this->hallsid() != 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteUInt64ToArray(6, this->hallsid(), target);
+  }
+
   // @@protoc_insertion_point(serialize_to_array_end:CMD_Client_OnSigninCB)
   return target;
 }
@@ -23189,6 +27339,13 @@ size_t CMD_Client_OnSigninCB::ByteSizeLong() const {
         this->tokenid());
   }
 
+  // uint64 hallsID = 6;
+  if (this->hallsid() != 0) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::UInt64Size(
+        this->hallsid());
+  }
+
   int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
   GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
   _cached_size_ = cached_size;
@@ -23216,12 +27373,10 @@ void CMD_Client_OnSigninCB::MergeFrom(const CMD_Client_OnSigninCB& from) {
   GOOGLE_DCHECK_NE(&from, this);
   _internal_metadata_.MergeFrom(from._internal_metadata_);
   if (from.datas().size() > 0) {
-
-    datas_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.datas_);
+    set_datas(from.datas());
   }
   if (from.addr().size() > 0) {
-
-    addr_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.addr_);
+    set_addr(from.addr());
   }
   if (from.errcode() != 0) {
     set_errcode(from.errcode());
@@ -23232,6 +27387,9 @@ void CMD_Client_OnSigninCB::MergeFrom(const CMD_Client_OnSigninCB& from) {
   if (from.tokenid() != 0) {
     set_tokenid(from.tokenid());
   }
+  if (from.hallsid() != 0) {
+    set_hallsid(from.hallsid());
+  }
 }
 
 void CMD_Client_OnSigninCB::CopyFrom(const ::google::protobuf::Message& from) {
@@ -23254,6 +27412,21 @@ bool CMD_Client_OnSigninCB::IsInitialized() const {
 
 void CMD_Client_OnSigninCB::Swap(CMD_Client_OnSigninCB* other) {
   if (other == this) return;
+  if (GetArenaNoVirtual() == other->GetArenaNoVirtual()) {
+    InternalSwap(other);
+  } else {
+    CMD_Client_OnSigninCB* temp = New(GetArenaNoVirtual());
+    temp->MergeFrom(*other);
+    other->CopyFrom(*this);
+    InternalSwap(temp);
+    if (GetArenaNoVirtual() == NULL) {
+      delete temp;
+    }
+  }
+}
+void CMD_Client_OnSigninCB::UnsafeArenaSwap(CMD_Client_OnSigninCB* other) {
+  if (other == this) return;
+  GOOGLE_DCHECK(GetArenaNoVirtual() == other->GetArenaNoVirtual());
   InternalSwap(other);
 }
 void CMD_Client_OnSigninCB::InternalSwap(CMD_Client_OnSigninCB* other) {
@@ -23262,12 +27435,13 @@ void CMD_Client_OnSigninCB::InternalSwap(CMD_Client_OnSigninCB* other) {
   std::swap(errcode_, other->errcode_);
   std::swap(port_, other->port_);
   std::swap(tokenid_, other->tokenid_);
+  std::swap(hallsid_, other->hallsid_);
   std::swap(_cached_size_, other->_cached_size_);
 }
 
 ::google::protobuf::Metadata CMD_Client_OnSigninCB::GetMetadata() const {
   protobuf_Commands_2eproto::protobuf_AssignDescriptorsOnce();
-  return protobuf_Commands_2eproto::file_level_metadata[47];
+  return protobuf_Commands_2eproto::file_level_metadata[49];
 }
 
 #if PROTOBUF_INLINE_NOT_IN_HEADERS
@@ -23289,45 +27463,46 @@ void CMD_Client_OnSigninCB::set_errcode(::ServerError value) {
 
 // bytes datas = 2;
 void CMD_Client_OnSigninCB::clear_datas() {
-  datas_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  datas_.ClearToEmpty(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 const ::std::string& CMD_Client_OnSigninCB::datas() const {
   // @@protoc_insertion_point(field_get:CMD_Client_OnSigninCB.datas)
-  return datas_.GetNoArena();
+  return datas_.Get();
 }
 void CMD_Client_OnSigninCB::set_datas(const ::std::string& value) {
   
-  datas_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  datas_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value, GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set:CMD_Client_OnSigninCB.datas)
 }
-#if LANG_CXX11
-void CMD_Client_OnSigninCB::set_datas(::std::string&& value) {
-  
-  datas_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:CMD_Client_OnSigninCB.datas)
-}
-#endif
 void CMD_Client_OnSigninCB::set_datas(const char* value) {
   
-  datas_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  datas_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+              GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_char:CMD_Client_OnSigninCB.datas)
 }
-void CMD_Client_OnSigninCB::set_datas(const void* value, size_t size) {
+void CMD_Client_OnSigninCB::set_datas(const void* value,
+    size_t size) {
   
-  datas_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
+  datas_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_pointer:CMD_Client_OnSigninCB.datas)
 }
 ::std::string* CMD_Client_OnSigninCB::mutable_datas() {
   
   // @@protoc_insertion_point(field_mutable:CMD_Client_OnSigninCB.datas)
-  return datas_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return datas_.Mutable(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 ::std::string* CMD_Client_OnSigninCB::release_datas() {
   // @@protoc_insertion_point(field_release:CMD_Client_OnSigninCB.datas)
   
-  return datas_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return datas_.Release(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
+}
+::std::string* CMD_Client_OnSigninCB::unsafe_arena_release_datas() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:CMD_Client_OnSigninCB.datas)
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  
+  return datas_.UnsafeArenaRelease(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      GetArenaNoVirtual());
 }
 void CMD_Client_OnSigninCB::set_allocated_datas(::std::string* datas) {
   if (datas != NULL) {
@@ -23335,51 +27510,65 @@ void CMD_Client_OnSigninCB::set_allocated_datas(::std::string* datas) {
   } else {
     
   }
-  datas_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), datas);
+  datas_.SetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), datas,
+      GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_allocated:CMD_Client_OnSigninCB.datas)
 }
+void CMD_Client_OnSigninCB::unsafe_arena_set_allocated_datas(
+    ::std::string* datas) {
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  if (datas != NULL) {
+    
+  } else {
+    
+  }
+  datas_.UnsafeArenaSetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      datas, GetArenaNoVirtual());
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:CMD_Client_OnSigninCB.datas)
+}
 
 // string addr = 3;
 void CMD_Client_OnSigninCB::clear_addr() {
-  addr_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  addr_.ClearToEmpty(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 const ::std::string& CMD_Client_OnSigninCB::addr() const {
   // @@protoc_insertion_point(field_get:CMD_Client_OnSigninCB.addr)
-  return addr_.GetNoArena();
+  return addr_.Get();
 }
 void CMD_Client_OnSigninCB::set_addr(const ::std::string& value) {
   
-  addr_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  addr_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value, GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set:CMD_Client_OnSigninCB.addr)
 }
-#if LANG_CXX11
-void CMD_Client_OnSigninCB::set_addr(::std::string&& value) {
-  
-  addr_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:CMD_Client_OnSigninCB.addr)
-}
-#endif
 void CMD_Client_OnSigninCB::set_addr(const char* value) {
   
-  addr_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  addr_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+              GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_char:CMD_Client_OnSigninCB.addr)
 }
-void CMD_Client_OnSigninCB::set_addr(const char* value, size_t size) {
+void CMD_Client_OnSigninCB::set_addr(const char* value,
+    size_t size) {
   
-  addr_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
+  addr_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_pointer:CMD_Client_OnSigninCB.addr)
 }
 ::std::string* CMD_Client_OnSigninCB::mutable_addr() {
   
   // @@protoc_insertion_point(field_mutable:CMD_Client_OnSigninCB.addr)
-  return addr_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return addr_.Mutable(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 ::std::string* CMD_Client_OnSigninCB::release_addr() {
   // @@protoc_insertion_point(field_release:CMD_Client_OnSigninCB.addr)
   
-  return addr_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return addr_.Release(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
+}
+::std::string* CMD_Client_OnSigninCB::unsafe_arena_release_addr() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:CMD_Client_OnSigninCB.addr)
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  
+  return addr_.UnsafeArenaRelease(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      GetArenaNoVirtual());
 }
 void CMD_Client_OnSigninCB::set_allocated_addr(::std::string* addr) {
   if (addr != NULL) {
@@ -23387,9 +27576,22 @@ void CMD_Client_OnSigninCB::set_allocated_addr(::std::string* addr) {
   } else {
     
   }
-  addr_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), addr);
+  addr_.SetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), addr,
+      GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_allocated:CMD_Client_OnSigninCB.addr)
 }
+void CMD_Client_OnSigninCB::unsafe_arena_set_allocated_addr(
+    ::std::string* addr) {
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  if (addr != NULL) {
+    
+  } else {
+    
+  }
+  addr_.UnsafeArenaSetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      addr, GetArenaNoVirtual());
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:CMD_Client_OnSigninCB.addr)
+}
 
 // int32 port = 4;
 void CMD_Client_OnSigninCB::clear_port() {
@@ -23419,6 +27621,20 @@ void CMD_Client_OnSigninCB::set_tokenid(::google::protobuf::uint64 value) {
   // @@protoc_insertion_point(field_set:CMD_Client_OnSigninCB.tokenID)
 }
 
+// uint64 hallsID = 6;
+void CMD_Client_OnSigninCB::clear_hallsid() {
+  hallsid_ = GOOGLE_ULONGLONG(0);
+}
+::google::protobuf::uint64 CMD_Client_OnSigninCB::hallsid() const {
+  // @@protoc_insertion_point(field_get:CMD_Client_OnSigninCB.hallsID)
+  return hallsid_;
+}
+void CMD_Client_OnSigninCB::set_hallsid(::google::protobuf::uint64 value) {
+  
+  hallsid_ = value;
+  // @@protoc_insertion_point(field_set:CMD_Client_OnSigninCB.hallsID)
+}
+
 #endif  // PROTOBUF_INLINE_NOT_IN_HEADERS
 
 // ===================================================================
@@ -23448,6 +27664,17 @@ CMD_PlayerContext::CMD_PlayerContext()
   SharedCtor();
   // @@protoc_insertion_point(constructor:CMD_PlayerContext)
 }
+CMD_PlayerContext::CMD_PlayerContext(::google::protobuf::Arena* arena)
+  : ::google::protobuf::Message(),
+  _internal_metadata_(arena),
+  gameplayers_(arena) {
+#ifdef GOOGLE_PROTOBUF_NO_STATIC_INITIALIZER
+  protobuf_Commands_2eproto::InitDefaults();
+#endif  // GOOGLE_PROTOBUF_NO_STATIC_INITIALIZER
+  SharedCtor();
+  RegisterArenaDtor(arena);
+  // @@protoc_insertion_point(arena_constructor:CMD_PlayerContext)
+}
 CMD_PlayerContext::CMD_PlayerContext(const CMD_PlayerContext& from)
   : ::google::protobuf::Message(),
       _internal_metadata_(NULL),
@@ -23456,11 +27683,13 @@ CMD_PlayerContext::CMD_PlayerContext(const CMD_PlayerContext& from)
   _internal_metadata_.MergeFrom(from._internal_metadata_);
   playername_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
   if (from.playername().size() > 0) {
-    playername_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.playername_);
+    playername_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.playername(),
+      GetArenaNoVirtual());
   }
   gameserverip_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
   if (from.gameserverip().size() > 0) {
-    gameserverip_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.gameserverip_);
+    gameserverip_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.gameserverip(),
+      GetArenaNoVirtual());
   }
   ::memcpy(&playerid_, &from.playerid_,
     reinterpret_cast<char*>(&playergametopscore_) -
@@ -23482,10 +27711,21 @@ CMD_PlayerContext::~CMD_PlayerContext() {
 }
 
 void CMD_PlayerContext::SharedDtor() {
-  playername_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  gameserverip_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  ::google::protobuf::Arena* arena = GetArenaNoVirtual();
+  if (arena != NULL) {
+    return;
+  }
+
+  playername_.Destroy(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), arena);
+  gameserverip_.Destroy(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), arena);
 }
 
+void CMD_PlayerContext::ArenaDtor(void* object) {
+  CMD_PlayerContext* _this = reinterpret_cast< CMD_PlayerContext* >(object);
+  (void)_this;
+}
+void CMD_PlayerContext::RegisterArenaDtor(::google::protobuf::Arena* arena) {
+}
 void CMD_PlayerContext::SetCachedSize(int size) const {
   GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
   _cached_size_ = size;
@@ -23493,7 +27733,7 @@ void CMD_PlayerContext::SetCachedSize(int size) const {
 }
 const ::google::protobuf::Descriptor* CMD_PlayerContext::descriptor() {
   protobuf_Commands_2eproto::protobuf_AssignDescriptorsOnce();
-  return protobuf_Commands_2eproto::file_level_metadata[48].descriptor;
+  return protobuf_Commands_2eproto::file_level_metadata[50].descriptor;
 }
 
 const CMD_PlayerContext& CMD_PlayerContext::default_instance() {
@@ -23502,18 +27742,14 @@ const CMD_PlayerContext& CMD_PlayerContext::default_instance() {
 }
 
 CMD_PlayerContext* CMD_PlayerContext::New(::google::protobuf::Arena* arena) const {
-  CMD_PlayerContext* n = new CMD_PlayerContext;
-  if (arena != NULL) {
-    arena->Own(n);
-  }
-  return n;
+  return ::google::protobuf::Arena::CreateMessage<CMD_PlayerContext>(arena);
 }
 
 void CMD_PlayerContext::Clear() {
 // @@protoc_insertion_point(message_clear_start:CMD_PlayerContext)
   gameplayers_.Clear();
-  playername_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  gameserverip_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  playername_.ClearToEmpty(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
+  gameserverip_.ClearToEmpty(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
   ::memset(&playerid_, 0, reinterpret_cast<char*>(&playergametopscore_) -
     reinterpret_cast<char*>(&playerid_) + sizeof(playergametopscore_));
 }
@@ -24046,12 +28282,10 @@ void CMD_PlayerContext::MergeFrom(const CMD_PlayerContext& from) {
   _internal_metadata_.MergeFrom(from._internal_metadata_);
   gameplayers_.MergeFrom(from.gameplayers_);
   if (from.playername().size() > 0) {
-
-    playername_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.playername_);
+    set_playername(from.playername());
   }
   if (from.gameserverip().size() > 0) {
-
-    gameserverip_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.gameserverip_);
+    set_gameserverip(from.gameserverip());
   }
   if (from.playerid() != 0) {
     set_playerid(from.playerid());
@@ -24108,6 +28342,21 @@ bool CMD_PlayerContext::IsInitialized() const {
 
 void CMD_PlayerContext::Swap(CMD_PlayerContext* other) {
   if (other == this) return;
+  if (GetArenaNoVirtual() == other->GetArenaNoVirtual()) {
+    InternalSwap(other);
+  } else {
+    CMD_PlayerContext* temp = New(GetArenaNoVirtual());
+    temp->MergeFrom(*other);
+    other->CopyFrom(*this);
+    InternalSwap(temp);
+    if (GetArenaNoVirtual() == NULL) {
+      delete temp;
+    }
+  }
+}
+void CMD_PlayerContext::UnsafeArenaSwap(CMD_PlayerContext* other) {
+  if (other == this) return;
+  GOOGLE_DCHECK(GetArenaNoVirtual() == other->GetArenaNoVirtual());
   InternalSwap(other);
 }
 void CMD_PlayerContext::InternalSwap(CMD_PlayerContext* other) {
@@ -24130,7 +28379,7 @@ void CMD_PlayerContext::InternalSwap(CMD_PlayerContext* other) {
 
 ::google::protobuf::Metadata CMD_PlayerContext::GetMetadata() const {
   protobuf_Commands_2eproto::protobuf_AssignDescriptorsOnce();
-  return protobuf_Commands_2eproto::file_level_metadata[48];
+  return protobuf_Commands_2eproto::file_level_metadata[50];
 }
 
 #if PROTOBUF_INLINE_NOT_IN_HEADERS
@@ -24152,45 +28401,46 @@ void CMD_PlayerContext::set_playerid(::google::protobuf::uint64 value) {
 
 // string playerName = 2;
 void CMD_PlayerContext::clear_playername() {
-  playername_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  playername_.ClearToEmpty(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 const ::std::string& CMD_PlayerContext::playername() const {
   // @@protoc_insertion_point(field_get:CMD_PlayerContext.playerName)
-  return playername_.GetNoArena();
+  return playername_.Get();
 }
 void CMD_PlayerContext::set_playername(const ::std::string& value) {
   
-  playername_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  playername_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value, GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set:CMD_PlayerContext.playerName)
 }
-#if LANG_CXX11
-void CMD_PlayerContext::set_playername(::std::string&& value) {
-  
-  playername_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:CMD_PlayerContext.playerName)
-}
-#endif
 void CMD_PlayerContext::set_playername(const char* value) {
   
-  playername_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  playername_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+              GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_char:CMD_PlayerContext.playerName)
 }
-void CMD_PlayerContext::set_playername(const char* value, size_t size) {
+void CMD_PlayerContext::set_playername(const char* value,
+    size_t size) {
   
-  playername_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
+  playername_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_pointer:CMD_PlayerContext.playerName)
 }
 ::std::string* CMD_PlayerContext::mutable_playername() {
   
   // @@protoc_insertion_point(field_mutable:CMD_PlayerContext.playerName)
-  return playername_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return playername_.Mutable(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 ::std::string* CMD_PlayerContext::release_playername() {
   // @@protoc_insertion_point(field_release:CMD_PlayerContext.playerName)
   
-  return playername_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return playername_.Release(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
+}
+::std::string* CMD_PlayerContext::unsafe_arena_release_playername() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:CMD_PlayerContext.playerName)
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  
+  return playername_.UnsafeArenaRelease(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      GetArenaNoVirtual());
 }
 void CMD_PlayerContext::set_allocated_playername(::std::string* playername) {
   if (playername != NULL) {
@@ -24198,9 +28448,22 @@ void CMD_PlayerContext::set_allocated_playername(::std::string* playername) {
   } else {
     
   }
-  playername_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), playername);
+  playername_.SetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), playername,
+      GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_allocated:CMD_PlayerContext.playerName)
 }
+void CMD_PlayerContext::unsafe_arena_set_allocated_playername(
+    ::std::string* playername) {
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  if (playername != NULL) {
+    
+  } else {
+    
+  }
+  playername_.UnsafeArenaSetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      playername, GetArenaNoVirtual());
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:CMD_PlayerContext.playerName)
+}
 
 // int32 playerModelID = 3;
 void CMD_PlayerContext::clear_playermodelid() {
@@ -24274,45 +28537,46 @@ void CMD_PlayerContext::set_gamemode(::google::protobuf::int32 value) {
 
 // string gameServerIP = 8;
 void CMD_PlayerContext::clear_gameserverip() {
-  gameserverip_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  gameserverip_.ClearToEmpty(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 const ::std::string& CMD_PlayerContext::gameserverip() const {
   // @@protoc_insertion_point(field_get:CMD_PlayerContext.gameServerIP)
-  return gameserverip_.GetNoArena();
+  return gameserverip_.Get();
 }
 void CMD_PlayerContext::set_gameserverip(const ::std::string& value) {
   
-  gameserverip_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  gameserverip_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value, GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set:CMD_PlayerContext.gameServerIP)
 }
-#if LANG_CXX11
-void CMD_PlayerContext::set_gameserverip(::std::string&& value) {
-  
-  gameserverip_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:CMD_PlayerContext.gameServerIP)
-}
-#endif
 void CMD_PlayerContext::set_gameserverip(const char* value) {
   
-  gameserverip_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  gameserverip_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+              GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_char:CMD_PlayerContext.gameServerIP)
 }
-void CMD_PlayerContext::set_gameserverip(const char* value, size_t size) {
+void CMD_PlayerContext::set_gameserverip(const char* value,
+    size_t size) {
   
-  gameserverip_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
+  gameserverip_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_pointer:CMD_PlayerContext.gameServerIP)
 }
 ::std::string* CMD_PlayerContext::mutable_gameserverip() {
   
   // @@protoc_insertion_point(field_mutable:CMD_PlayerContext.gameServerIP)
-  return gameserverip_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return gameserverip_.Mutable(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 ::std::string* CMD_PlayerContext::release_gameserverip() {
   // @@protoc_insertion_point(field_release:CMD_PlayerContext.gameServerIP)
   
-  return gameserverip_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return gameserverip_.Release(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
+}
+::std::string* CMD_PlayerContext::unsafe_arena_release_gameserverip() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:CMD_PlayerContext.gameServerIP)
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  
+  return gameserverip_.UnsafeArenaRelease(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      GetArenaNoVirtual());
 }
 void CMD_PlayerContext::set_allocated_gameserverip(::std::string* gameserverip) {
   if (gameserverip != NULL) {
@@ -24320,9 +28584,22 @@ void CMD_PlayerContext::set_allocated_gameserverip(::std::string* gameserverip)
   } else {
     
   }
-  gameserverip_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), gameserverip);
+  gameserverip_.SetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), gameserverip,
+      GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_allocated:CMD_PlayerContext.gameServerIP)
 }
+void CMD_PlayerContext::unsafe_arena_set_allocated_gameserverip(
+    ::std::string* gameserverip) {
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  if (gameserverip != NULL) {
+    
+  } else {
+    
+  }
+  gameserverip_.UnsafeArenaSetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      gameserverip, GetArenaNoVirtual());
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:CMD_PlayerContext.gameServerIP)
+}
 
 // int32 gameServerPort = 9;
 void CMD_PlayerContext::clear_gameserverport() {
@@ -24428,6 +28705,53 @@ CMD_PlayerContext::gameplayers() const {
 
 // ===================================================================
 
+void CMD_Client_UpdatePlayerContext::_slow_mutable_playercontext() {
+  playercontext_ = ::google::protobuf::Arena::CreateMessage< ::CMD_PlayerContext >(
+      GetArenaNoVirtual());
+}
+::CMD_PlayerContext* CMD_Client_UpdatePlayerContext::_slow_release_playercontext() {
+  if (playercontext_ == NULL) {
+    return NULL;
+  } else {
+    ::CMD_PlayerContext* temp = new ::CMD_PlayerContext(*playercontext_);
+    playercontext_ = NULL;
+    return temp;
+  }
+}
+::CMD_PlayerContext* CMD_Client_UpdatePlayerContext::unsafe_arena_release_playercontext() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:CMD_Client_UpdatePlayerContext.playerContext)
+  
+  ::CMD_PlayerContext* temp = playercontext_;
+  playercontext_ = NULL;
+  return temp;
+}
+void CMD_Client_UpdatePlayerContext::_slow_set_allocated_playercontext(
+    ::google::protobuf::Arena* message_arena, ::CMD_PlayerContext** playercontext) {
+    if (message_arena != NULL && 
+        ::google::protobuf::Arena::GetArena(*playercontext) == NULL) {
+      message_arena->Own(*playercontext);
+    } else if (message_arena !=
+               ::google::protobuf::Arena::GetArena(*playercontext)) {
+      ::CMD_PlayerContext* new_playercontext = 
+            ::google::protobuf::Arena::CreateMessage< ::CMD_PlayerContext >(
+            message_arena);
+      new_playercontext->CopyFrom(**playercontext);
+      *playercontext = new_playercontext;
+    }
+}
+void CMD_Client_UpdatePlayerContext::unsafe_arena_set_allocated_playercontext(
+    ::CMD_PlayerContext* playercontext) {
+  if (GetArenaNoVirtual() == NULL) {
+    delete playercontext_;
+  }
+  playercontext_ = playercontext;
+  if (playercontext) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:CMD_Client_UpdatePlayerContext.playerContext)
+}
 #if !defined(_MSC_VER) || _MSC_VER >= 1900
 const int CMD_Client_UpdatePlayerContext::kPlayerContextFieldNumber;
 #endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
@@ -24440,6 +28764,16 @@ CMD_Client_UpdatePlayerContext::CMD_Client_UpdatePlayerContext()
   SharedCtor();
   // @@protoc_insertion_point(constructor:CMD_Client_UpdatePlayerContext)
 }
+CMD_Client_UpdatePlayerContext::CMD_Client_UpdatePlayerContext(::google::protobuf::Arena* arena)
+  : ::google::protobuf::Message(),
+  _internal_metadata_(arena) {
+#ifdef GOOGLE_PROTOBUF_NO_STATIC_INITIALIZER
+  protobuf_Commands_2eproto::InitDefaults();
+#endif  // GOOGLE_PROTOBUF_NO_STATIC_INITIALIZER
+  SharedCtor();
+  RegisterArenaDtor(arena);
+  // @@protoc_insertion_point(arena_constructor:CMD_Client_UpdatePlayerContext)
+}
 CMD_Client_UpdatePlayerContext::CMD_Client_UpdatePlayerContext(const CMD_Client_UpdatePlayerContext& from)
   : ::google::protobuf::Message(),
       _internal_metadata_(NULL),
@@ -24464,11 +28798,22 @@ CMD_Client_UpdatePlayerContext::~CMD_Client_UpdatePlayerContext() {
 }
 
 void CMD_Client_UpdatePlayerContext::SharedDtor() {
+  ::google::protobuf::Arena* arena = GetArenaNoVirtual();
+  if (arena != NULL) {
+    return;
+  }
+
   if (this != internal_default_instance()) {
     delete playercontext_;
   }
 }
 
+void CMD_Client_UpdatePlayerContext::ArenaDtor(void* object) {
+  CMD_Client_UpdatePlayerContext* _this = reinterpret_cast< CMD_Client_UpdatePlayerContext* >(object);
+  (void)_this;
+}
+void CMD_Client_UpdatePlayerContext::RegisterArenaDtor(::google::protobuf::Arena* arena) {
+}
 void CMD_Client_UpdatePlayerContext::SetCachedSize(int size) const {
   GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
   _cached_size_ = size;
@@ -24476,7 +28821,7 @@ void CMD_Client_UpdatePlayerContext::SetCachedSize(int size) const {
 }
 const ::google::protobuf::Descriptor* CMD_Client_UpdatePlayerContext::descriptor() {
   protobuf_Commands_2eproto::protobuf_AssignDescriptorsOnce();
-  return protobuf_Commands_2eproto::file_level_metadata[49].descriptor;
+  return protobuf_Commands_2eproto::file_level_metadata[51].descriptor;
 }
 
 const CMD_Client_UpdatePlayerContext& CMD_Client_UpdatePlayerContext::default_instance() {
@@ -24485,11 +28830,7 @@ const CMD_Client_UpdatePlayerContext& CMD_Client_UpdatePlayerContext::default_in
 }
 
 CMD_Client_UpdatePlayerContext* CMD_Client_UpdatePlayerContext::New(::google::protobuf::Arena* arena) const {
-  CMD_Client_UpdatePlayerContext* n = new CMD_Client_UpdatePlayerContext;
-  if (arena != NULL) {
-    arena->Own(n);
-  }
-  return n;
+  return ::google::protobuf::Arena::CreateMessage<CMD_Client_UpdatePlayerContext>(arena);
 }
 
 void CMD_Client_UpdatePlayerContext::Clear() {
@@ -24631,6 +28972,21 @@ bool CMD_Client_UpdatePlayerContext::IsInitialized() const {
 
 void CMD_Client_UpdatePlayerContext::Swap(CMD_Client_UpdatePlayerContext* other) {
   if (other == this) return;
+  if (GetArenaNoVirtual() == other->GetArenaNoVirtual()) {
+    InternalSwap(other);
+  } else {
+    CMD_Client_UpdatePlayerContext* temp = New(GetArenaNoVirtual());
+    temp->MergeFrom(*other);
+    other->CopyFrom(*this);
+    InternalSwap(temp);
+    if (GetArenaNoVirtual() == NULL) {
+      delete temp;
+    }
+  }
+}
+void CMD_Client_UpdatePlayerContext::UnsafeArenaSwap(CMD_Client_UpdatePlayerContext* other) {
+  if (other == this) return;
+  GOOGLE_DCHECK(GetArenaNoVirtual() == other->GetArenaNoVirtual());
   InternalSwap(other);
 }
 void CMD_Client_UpdatePlayerContext::InternalSwap(CMD_Client_UpdatePlayerContext* other) {
@@ -24640,7 +28996,7 @@ void CMD_Client_UpdatePlayerContext::InternalSwap(CMD_Client_UpdatePlayerContext
 
 ::google::protobuf::Metadata CMD_Client_UpdatePlayerContext::GetMetadata() const {
   protobuf_Commands_2eproto::protobuf_AssignDescriptorsOnce();
-  return protobuf_Commands_2eproto::file_level_metadata[49];
+  return protobuf_Commands_2eproto::file_level_metadata[51];
 }
 
 #if PROTOBUF_INLINE_NOT_IN_HEADERS
@@ -24662,7 +29018,7 @@ const ::CMD_PlayerContext& CMD_Client_UpdatePlayerContext::playercontext() const
 ::CMD_PlayerContext* CMD_Client_UpdatePlayerContext::mutable_playercontext() {
   
   if (playercontext_ == NULL) {
-    playercontext_ = new ::CMD_PlayerContext;
+    _slow_mutable_playercontext();
   }
   // @@protoc_insertion_point(field_mutable:CMD_Client_UpdatePlayerContext.playerContext)
   return playercontext_;
@@ -24670,12 +29026,22 @@ const ::CMD_PlayerContext& CMD_Client_UpdatePlayerContext::playercontext() const
 ::CMD_PlayerContext* CMD_Client_UpdatePlayerContext::release_playercontext() {
   // @@protoc_insertion_point(field_release:CMD_Client_UpdatePlayerContext.playerContext)
   
-  ::CMD_PlayerContext* temp = playercontext_;
-  playercontext_ = NULL;
-  return temp;
+  if (GetArenaNoVirtual() != NULL) {
+    return _slow_release_playercontext();
+  } else {
+    ::CMD_PlayerContext* temp = playercontext_;
+    playercontext_ = NULL;
+    return temp;
+  }
 }
-void CMD_Client_UpdatePlayerContext::set_allocated_playercontext(::CMD_PlayerContext* playercontext) {
-  delete playercontext_;
+ void CMD_Client_UpdatePlayerContext::set_allocated_playercontext(::CMD_PlayerContext* playercontext) {
+  ::google::protobuf::Arena* message_arena = GetArenaNoVirtual();
+  if (message_arena == NULL) {
+    delete playercontext_;
+  }
+  if (playercontext != NULL) {
+    _slow_set_allocated_playercontext(message_arena, &playercontext);
+  }
   playercontext_ = playercontext;
   if (playercontext) {
     
@@ -24704,6 +29070,16 @@ CMD_GameModeInfos::CMD_GameModeInfos()
   SharedCtor();
   // @@protoc_insertion_point(constructor:CMD_GameModeInfos)
 }
+CMD_GameModeInfos::CMD_GameModeInfos(::google::protobuf::Arena* arena)
+  : ::google::protobuf::Message(),
+  _internal_metadata_(arena) {
+#ifdef GOOGLE_PROTOBUF_NO_STATIC_INITIALIZER
+  protobuf_Commands_2eproto::InitDefaults();
+#endif  // GOOGLE_PROTOBUF_NO_STATIC_INITIALIZER
+  SharedCtor();
+  RegisterArenaDtor(arena);
+  // @@protoc_insertion_point(arena_constructor:CMD_GameModeInfos)
+}
 CMD_GameModeInfos::CMD_GameModeInfos(const CMD_GameModeInfos& from)
   : ::google::protobuf::Message(),
       _internal_metadata_(NULL),
@@ -24711,7 +29087,8 @@ CMD_GameModeInfos::CMD_GameModeInfos(const CMD_GameModeInfos& from)
   _internal_metadata_.MergeFrom(from._internal_metadata_);
   gamemodename_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
   if (from.gamemodename().size() > 0) {
-    gamemodename_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.gamemodename_);
+    gamemodename_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.gamemodename(),
+      GetArenaNoVirtual());
   }
   ::memcpy(&gamemodeid_, &from.gamemodeid_,
     reinterpret_cast<char*>(&gametime_) -
@@ -24732,9 +29109,20 @@ CMD_GameModeInfos::~CMD_GameModeInfos() {
 }
 
 void CMD_GameModeInfos::SharedDtor() {
-  gamemodename_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  ::google::protobuf::Arena* arena = GetArenaNoVirtual();
+  if (arena != NULL) {
+    return;
+  }
+
+  gamemodename_.Destroy(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), arena);
 }
 
+void CMD_GameModeInfos::ArenaDtor(void* object) {
+  CMD_GameModeInfos* _this = reinterpret_cast< CMD_GameModeInfos* >(object);
+  (void)_this;
+}
+void CMD_GameModeInfos::RegisterArenaDtor(::google::protobuf::Arena* arena) {
+}
 void CMD_GameModeInfos::SetCachedSize(int size) const {
   GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
   _cached_size_ = size;
@@ -24742,7 +29130,7 @@ void CMD_GameModeInfos::SetCachedSize(int size) const {
 }
 const ::google::protobuf::Descriptor* CMD_GameModeInfos::descriptor() {
   protobuf_Commands_2eproto::protobuf_AssignDescriptorsOnce();
-  return protobuf_Commands_2eproto::file_level_metadata[50].descriptor;
+  return protobuf_Commands_2eproto::file_level_metadata[52].descriptor;
 }
 
 const CMD_GameModeInfos& CMD_GameModeInfos::default_instance() {
@@ -24751,16 +29139,12 @@ const CMD_GameModeInfos& CMD_GameModeInfos::default_instance() {
 }
 
 CMD_GameModeInfos* CMD_GameModeInfos::New(::google::protobuf::Arena* arena) const {
-  CMD_GameModeInfos* n = new CMD_GameModeInfos;
-  if (arena != NULL) {
-    arena->Own(n);
-  }
-  return n;
+  return ::google::protobuf::Arena::CreateMessage<CMD_GameModeInfos>(arena);
 }
 
 void CMD_GameModeInfos::Clear() {
 // @@protoc_insertion_point(message_clear_start:CMD_GameModeInfos)
-  gamemodename_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  gamemodename_.ClearToEmpty(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
   ::memset(&gamemodeid_, 0, reinterpret_cast<char*>(&gametime_) -
     reinterpret_cast<char*>(&gamemodeid_) + sizeof(gametime_));
 }
@@ -24974,8 +29358,7 @@ void CMD_GameModeInfos::MergeFrom(const CMD_GameModeInfos& from) {
   GOOGLE_DCHECK_NE(&from, this);
   _internal_metadata_.MergeFrom(from._internal_metadata_);
   if (from.gamemodename().size() > 0) {
-
-    gamemodename_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.gamemodename_);
+    set_gamemodename(from.gamemodename());
   }
   if (from.gamemodeid() != 0) {
     set_gamemodeid(from.gamemodeid());
@@ -25008,6 +29391,21 @@ bool CMD_GameModeInfos::IsInitialized() const {
 
 void CMD_GameModeInfos::Swap(CMD_GameModeInfos* other) {
   if (other == this) return;
+  if (GetArenaNoVirtual() == other->GetArenaNoVirtual()) {
+    InternalSwap(other);
+  } else {
+    CMD_GameModeInfos* temp = New(GetArenaNoVirtual());
+    temp->MergeFrom(*other);
+    other->CopyFrom(*this);
+    InternalSwap(temp);
+    if (GetArenaNoVirtual() == NULL) {
+      delete temp;
+    }
+  }
+}
+void CMD_GameModeInfos::UnsafeArenaSwap(CMD_GameModeInfos* other) {
+  if (other == this) return;
+  GOOGLE_DCHECK(GetArenaNoVirtual() == other->GetArenaNoVirtual());
   InternalSwap(other);
 }
 void CMD_GameModeInfos::InternalSwap(CMD_GameModeInfos* other) {
@@ -25020,7 +29418,7 @@ void CMD_GameModeInfos::InternalSwap(CMD_GameModeInfos* other) {
 
 ::google::protobuf::Metadata CMD_GameModeInfos::GetMetadata() const {
   protobuf_Commands_2eproto::protobuf_AssignDescriptorsOnce();
-  return protobuf_Commands_2eproto::file_level_metadata[50];
+  return protobuf_Commands_2eproto::file_level_metadata[52];
 }
 
 #if PROTOBUF_INLINE_NOT_IN_HEADERS
@@ -25042,45 +29440,46 @@ void CMD_GameModeInfos::set_gamemodeid(::google::protobuf::uint32 value) {
 
 // string gameModeName = 2;
 void CMD_GameModeInfos::clear_gamemodename() {
-  gamemodename_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  gamemodename_.ClearToEmpty(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 const ::std::string& CMD_GameModeInfos::gamemodename() const {
   // @@protoc_insertion_point(field_get:CMD_GameModeInfos.gameModeName)
-  return gamemodename_.GetNoArena();
+  return gamemodename_.Get();
 }
 void CMD_GameModeInfos::set_gamemodename(const ::std::string& value) {
   
-  gamemodename_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  gamemodename_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value, GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set:CMD_GameModeInfos.gameModeName)
 }
-#if LANG_CXX11
-void CMD_GameModeInfos::set_gamemodename(::std::string&& value) {
-  
-  gamemodename_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:CMD_GameModeInfos.gameModeName)
-}
-#endif
 void CMD_GameModeInfos::set_gamemodename(const char* value) {
   
-  gamemodename_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  gamemodename_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+              GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_char:CMD_GameModeInfos.gameModeName)
 }
-void CMD_GameModeInfos::set_gamemodename(const char* value, size_t size) {
+void CMD_GameModeInfos::set_gamemodename(const char* value,
+    size_t size) {
   
-  gamemodename_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
+  gamemodename_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_pointer:CMD_GameModeInfos.gameModeName)
 }
 ::std::string* CMD_GameModeInfos::mutable_gamemodename() {
   
   // @@protoc_insertion_point(field_mutable:CMD_GameModeInfos.gameModeName)
-  return gamemodename_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return gamemodename_.Mutable(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 ::std::string* CMD_GameModeInfos::release_gamemodename() {
   // @@protoc_insertion_point(field_release:CMD_GameModeInfos.gameModeName)
   
-  return gamemodename_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return gamemodename_.Release(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
+}
+::std::string* CMD_GameModeInfos::unsafe_arena_release_gamemodename() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:CMD_GameModeInfos.gameModeName)
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  
+  return gamemodename_.UnsafeArenaRelease(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      GetArenaNoVirtual());
 }
 void CMD_GameModeInfos::set_allocated_gamemodename(::std::string* gamemodename) {
   if (gamemodename != NULL) {
@@ -25088,9 +29487,22 @@ void CMD_GameModeInfos::set_allocated_gamemodename(::std::string* gamemodename)
   } else {
     
   }
-  gamemodename_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), gamemodename);
+  gamemodename_.SetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), gamemodename,
+      GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_allocated:CMD_GameModeInfos.gameModeName)
 }
+void CMD_GameModeInfos::unsafe_arena_set_allocated_gamemodename(
+    ::std::string* gamemodename) {
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  if (gamemodename != NULL) {
+    
+  } else {
+    
+  }
+  gamemodename_.UnsafeArenaSetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      gamemodename, GetArenaNoVirtual());
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:CMD_GameModeInfos.gameModeName)
+}
 
 // uint32 playerMax = 3;
 void CMD_GameModeInfos::clear_playermax() {
@@ -25142,6 +29554,17 @@ CMD_GameInfos::CMD_GameInfos()
   SharedCtor();
   // @@protoc_insertion_point(constructor:CMD_GameInfos)
 }
+CMD_GameInfos::CMD_GameInfos(::google::protobuf::Arena* arena)
+  : ::google::protobuf::Message(),
+  _internal_metadata_(arena),
+  gamemodes_(arena) {
+#ifdef GOOGLE_PROTOBUF_NO_STATIC_INITIALIZER
+  protobuf_Commands_2eproto::InitDefaults();
+#endif  // GOOGLE_PROTOBUF_NO_STATIC_INITIALIZER
+  SharedCtor();
+  RegisterArenaDtor(arena);
+  // @@protoc_insertion_point(arena_constructor:CMD_GameInfos)
+}
 CMD_GameInfos::CMD_GameInfos(const CMD_GameInfos& from)
   : ::google::protobuf::Message(),
       _internal_metadata_(NULL),
@@ -25150,15 +29573,18 @@ CMD_GameInfos::CMD_GameInfos(const CMD_GameInfos& from)
   _internal_metadata_.MergeFrom(from._internal_metadata_);
   gamename_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
   if (from.gamename().size() > 0) {
-    gamename_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.gamename_);
+    gamename_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.gamename(),
+      GetArenaNoVirtual());
   }
   url_icon_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
   if (from.url_icon().size() > 0) {
-    url_icon_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.url_icon_);
+    url_icon_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.url_icon(),
+      GetArenaNoVirtual());
   }
   url_apk_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
   if (from.url_apk().size() > 0) {
-    url_apk_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.url_apk_);
+    url_apk_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.url_apk(),
+      GetArenaNoVirtual());
   }
   ::memcpy(&gameid_, &from.gameid_,
     reinterpret_cast<char*>(&type_) -
@@ -25181,11 +29607,22 @@ CMD_GameInfos::~CMD_GameInfos() {
 }
 
 void CMD_GameInfos::SharedDtor() {
-  gamename_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  url_icon_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  url_apk_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  ::google::protobuf::Arena* arena = GetArenaNoVirtual();
+  if (arena != NULL) {
+    return;
+  }
+
+  gamename_.Destroy(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), arena);
+  url_icon_.Destroy(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), arena);
+  url_apk_.Destroy(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), arena);
 }
 
+void CMD_GameInfos::ArenaDtor(void* object) {
+  CMD_GameInfos* _this = reinterpret_cast< CMD_GameInfos* >(object);
+  (void)_this;
+}
+void CMD_GameInfos::RegisterArenaDtor(::google::protobuf::Arena* arena) {
+}
 void CMD_GameInfos::SetCachedSize(int size) const {
   GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
   _cached_size_ = size;
@@ -25193,7 +29630,7 @@ void CMD_GameInfos::SetCachedSize(int size) const {
 }
 const ::google::protobuf::Descriptor* CMD_GameInfos::descriptor() {
   protobuf_Commands_2eproto::protobuf_AssignDescriptorsOnce();
-  return protobuf_Commands_2eproto::file_level_metadata[51].descriptor;
+  return protobuf_Commands_2eproto::file_level_metadata[53].descriptor;
 }
 
 const CMD_GameInfos& CMD_GameInfos::default_instance() {
@@ -25202,19 +29639,15 @@ const CMD_GameInfos& CMD_GameInfos::default_instance() {
 }
 
 CMD_GameInfos* CMD_GameInfos::New(::google::protobuf::Arena* arena) const {
-  CMD_GameInfos* n = new CMD_GameInfos;
-  if (arena != NULL) {
-    arena->Own(n);
-  }
-  return n;
+  return ::google::protobuf::Arena::CreateMessage<CMD_GameInfos>(arena);
 }
 
 void CMD_GameInfos::Clear() {
 // @@protoc_insertion_point(message_clear_start:CMD_GameInfos)
   gamemodes_.Clear();
-  gamename_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  url_icon_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  url_apk_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  gamename_.ClearToEmpty(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
+  url_icon_.ClearToEmpty(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
+  url_apk_.ClearToEmpty(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
   ::memset(&gameid_, 0, reinterpret_cast<char*>(&type_) -
     reinterpret_cast<char*>(&gameid_) + sizeof(type_));
 }
@@ -25552,16 +29985,13 @@ void CMD_GameInfos::MergeFrom(const CMD_GameInfos& from) {
   _internal_metadata_.MergeFrom(from._internal_metadata_);
   gamemodes_.MergeFrom(from.gamemodes_);
   if (from.gamename().size() > 0) {
-
-    gamename_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.gamename_);
+    set_gamename(from.gamename());
   }
   if (from.url_icon().size() > 0) {
-
-    url_icon_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.url_icon_);
+    set_url_icon(from.url_icon());
   }
   if (from.url_apk().size() > 0) {
-
-    url_apk_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.url_apk_);
+    set_url_apk(from.url_apk());
   }
   if (from.gameid() != 0) {
     set_gameid(from.gameid());
@@ -25594,6 +30024,21 @@ bool CMD_GameInfos::IsInitialized() const {
 
 void CMD_GameInfos::Swap(CMD_GameInfos* other) {
   if (other == this) return;
+  if (GetArenaNoVirtual() == other->GetArenaNoVirtual()) {
+    InternalSwap(other);
+  } else {
+    CMD_GameInfos* temp = New(GetArenaNoVirtual());
+    temp->MergeFrom(*other);
+    other->CopyFrom(*this);
+    InternalSwap(temp);
+    if (GetArenaNoVirtual() == NULL) {
+      delete temp;
+    }
+  }
+}
+void CMD_GameInfos::UnsafeArenaSwap(CMD_GameInfos* other) {
+  if (other == this) return;
+  GOOGLE_DCHECK(GetArenaNoVirtual() == other->GetArenaNoVirtual());
   InternalSwap(other);
 }
 void CMD_GameInfos::InternalSwap(CMD_GameInfos* other) {
@@ -25609,7 +30054,7 @@ void CMD_GameInfos::InternalSwap(CMD_GameInfos* other) {
 
 ::google::protobuf::Metadata CMD_GameInfos::GetMetadata() const {
   protobuf_Commands_2eproto::protobuf_AssignDescriptorsOnce();
-  return protobuf_Commands_2eproto::file_level_metadata[51];
+  return protobuf_Commands_2eproto::file_level_metadata[53];
 }
 
 #if PROTOBUF_INLINE_NOT_IN_HEADERS
@@ -25659,45 +30104,46 @@ void CMD_GameInfos::set_type(::google::protobuf::uint32 value) {
 
 // string gameName = 4;
 void CMD_GameInfos::clear_gamename() {
-  gamename_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  gamename_.ClearToEmpty(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 const ::std::string& CMD_GameInfos::gamename() const {
   // @@protoc_insertion_point(field_get:CMD_GameInfos.gameName)
-  return gamename_.GetNoArena();
+  return gamename_.Get();
 }
 void CMD_GameInfos::set_gamename(const ::std::string& value) {
   
-  gamename_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  gamename_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value, GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set:CMD_GameInfos.gameName)
 }
-#if LANG_CXX11
-void CMD_GameInfos::set_gamename(::std::string&& value) {
-  
-  gamename_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:CMD_GameInfos.gameName)
-}
-#endif
 void CMD_GameInfos::set_gamename(const char* value) {
   
-  gamename_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  gamename_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+              GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_char:CMD_GameInfos.gameName)
 }
-void CMD_GameInfos::set_gamename(const char* value, size_t size) {
+void CMD_GameInfos::set_gamename(const char* value,
+    size_t size) {
   
-  gamename_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
+  gamename_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_pointer:CMD_GameInfos.gameName)
 }
 ::std::string* CMD_GameInfos::mutable_gamename() {
   
   // @@protoc_insertion_point(field_mutable:CMD_GameInfos.gameName)
-  return gamename_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return gamename_.Mutable(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 ::std::string* CMD_GameInfos::release_gamename() {
   // @@protoc_insertion_point(field_release:CMD_GameInfos.gameName)
   
-  return gamename_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return gamename_.Release(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
+}
+::std::string* CMD_GameInfos::unsafe_arena_release_gamename() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:CMD_GameInfos.gameName)
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  
+  return gamename_.UnsafeArenaRelease(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      GetArenaNoVirtual());
 }
 void CMD_GameInfos::set_allocated_gamename(::std::string* gamename) {
   if (gamename != NULL) {
@@ -25705,51 +30151,65 @@ void CMD_GameInfos::set_allocated_gamename(::std::string* gamename) {
   } else {
     
   }
-  gamename_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), gamename);
+  gamename_.SetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), gamename,
+      GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_allocated:CMD_GameInfos.gameName)
 }
+void CMD_GameInfos::unsafe_arena_set_allocated_gamename(
+    ::std::string* gamename) {
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  if (gamename != NULL) {
+    
+  } else {
+    
+  }
+  gamename_.UnsafeArenaSetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      gamename, GetArenaNoVirtual());
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:CMD_GameInfos.gameName)
+}
 
 // string url_icon = 5;
 void CMD_GameInfos::clear_url_icon() {
-  url_icon_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  url_icon_.ClearToEmpty(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 const ::std::string& CMD_GameInfos::url_icon() const {
   // @@protoc_insertion_point(field_get:CMD_GameInfos.url_icon)
-  return url_icon_.GetNoArena();
+  return url_icon_.Get();
 }
 void CMD_GameInfos::set_url_icon(const ::std::string& value) {
   
-  url_icon_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  url_icon_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value, GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set:CMD_GameInfos.url_icon)
 }
-#if LANG_CXX11
-void CMD_GameInfos::set_url_icon(::std::string&& value) {
-  
-  url_icon_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:CMD_GameInfos.url_icon)
-}
-#endif
 void CMD_GameInfos::set_url_icon(const char* value) {
   
-  url_icon_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  url_icon_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+              GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_char:CMD_GameInfos.url_icon)
 }
-void CMD_GameInfos::set_url_icon(const char* value, size_t size) {
+void CMD_GameInfos::set_url_icon(const char* value,
+    size_t size) {
   
-  url_icon_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
+  url_icon_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_pointer:CMD_GameInfos.url_icon)
 }
 ::std::string* CMD_GameInfos::mutable_url_icon() {
   
   // @@protoc_insertion_point(field_mutable:CMD_GameInfos.url_icon)
-  return url_icon_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return url_icon_.Mutable(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 ::std::string* CMD_GameInfos::release_url_icon() {
   // @@protoc_insertion_point(field_release:CMD_GameInfos.url_icon)
   
-  return url_icon_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return url_icon_.Release(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
+}
+::std::string* CMD_GameInfos::unsafe_arena_release_url_icon() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:CMD_GameInfos.url_icon)
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  
+  return url_icon_.UnsafeArenaRelease(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      GetArenaNoVirtual());
 }
 void CMD_GameInfos::set_allocated_url_icon(::std::string* url_icon) {
   if (url_icon != NULL) {
@@ -25757,51 +30217,65 @@ void CMD_GameInfos::set_allocated_url_icon(::std::string* url_icon) {
   } else {
     
   }
-  url_icon_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), url_icon);
+  url_icon_.SetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), url_icon,
+      GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_allocated:CMD_GameInfos.url_icon)
 }
+void CMD_GameInfos::unsafe_arena_set_allocated_url_icon(
+    ::std::string* url_icon) {
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  if (url_icon != NULL) {
+    
+  } else {
+    
+  }
+  url_icon_.UnsafeArenaSetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      url_icon, GetArenaNoVirtual());
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:CMD_GameInfos.url_icon)
+}
 
 // string url_apk = 6;
 void CMD_GameInfos::clear_url_apk() {
-  url_apk_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  url_apk_.ClearToEmpty(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 const ::std::string& CMD_GameInfos::url_apk() const {
   // @@protoc_insertion_point(field_get:CMD_GameInfos.url_apk)
-  return url_apk_.GetNoArena();
+  return url_apk_.Get();
 }
 void CMD_GameInfos::set_url_apk(const ::std::string& value) {
   
-  url_apk_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  url_apk_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value, GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set:CMD_GameInfos.url_apk)
 }
-#if LANG_CXX11
-void CMD_GameInfos::set_url_apk(::std::string&& value) {
-  
-  url_apk_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:CMD_GameInfos.url_apk)
-}
-#endif
 void CMD_GameInfos::set_url_apk(const char* value) {
   
-  url_apk_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  url_apk_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+              GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_char:CMD_GameInfos.url_apk)
 }
-void CMD_GameInfos::set_url_apk(const char* value, size_t size) {
+void CMD_GameInfos::set_url_apk(const char* value,
+    size_t size) {
   
-  url_apk_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
+  url_apk_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_pointer:CMD_GameInfos.url_apk)
 }
 ::std::string* CMD_GameInfos::mutable_url_apk() {
   
   // @@protoc_insertion_point(field_mutable:CMD_GameInfos.url_apk)
-  return url_apk_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return url_apk_.Mutable(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 ::std::string* CMD_GameInfos::release_url_apk() {
   // @@protoc_insertion_point(field_release:CMD_GameInfos.url_apk)
   
-  return url_apk_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return url_apk_.Release(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
+}
+::std::string* CMD_GameInfos::unsafe_arena_release_url_apk() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:CMD_GameInfos.url_apk)
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  
+  return url_apk_.UnsafeArenaRelease(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      GetArenaNoVirtual());
 }
 void CMD_GameInfos::set_allocated_url_apk(::std::string* url_apk) {
   if (url_apk != NULL) {
@@ -25809,9 +30283,22 @@ void CMD_GameInfos::set_allocated_url_apk(::std::string* url_apk) {
   } else {
     
   }
-  url_apk_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), url_apk);
+  url_apk_.SetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), url_apk,
+      GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_allocated:CMD_GameInfos.url_apk)
 }
+void CMD_GameInfos::unsafe_arena_set_allocated_url_apk(
+    ::std::string* url_apk) {
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  if (url_apk != NULL) {
+    
+  } else {
+    
+  }
+  url_apk_.UnsafeArenaSetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      url_apk, GetArenaNoVirtual());
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:CMD_GameInfos.url_apk)
+}
 
 // repeated .CMD_GameModeInfos gameModes = 7;
 int CMD_GameInfos::gamemodes_size() const {
@@ -25862,6 +30349,17 @@ CMD_Client_OnListGamesCB::CMD_Client_OnListGamesCB()
   SharedCtor();
   // @@protoc_insertion_point(constructor:CMD_Client_OnListGamesCB)
 }
+CMD_Client_OnListGamesCB::CMD_Client_OnListGamesCB(::google::protobuf::Arena* arena)
+  : ::google::protobuf::Message(),
+  _internal_metadata_(arena),
+  gameinfos_(arena) {
+#ifdef GOOGLE_PROTOBUF_NO_STATIC_INITIALIZER
+  protobuf_Commands_2eproto::InitDefaults();
+#endif  // GOOGLE_PROTOBUF_NO_STATIC_INITIALIZER
+  SharedCtor();
+  RegisterArenaDtor(arena);
+  // @@protoc_insertion_point(arena_constructor:CMD_Client_OnListGamesCB)
+}
 CMD_Client_OnListGamesCB::CMD_Client_OnListGamesCB(const CMD_Client_OnListGamesCB& from)
   : ::google::protobuf::Message(),
       _internal_metadata_(NULL),
@@ -25886,8 +30384,19 @@ CMD_Client_OnListGamesCB::~CMD_Client_OnListGamesCB() {
 }
 
 void CMD_Client_OnListGamesCB::SharedDtor() {
+  ::google::protobuf::Arena* arena = GetArenaNoVirtual();
+  if (arena != NULL) {
+    return;
+  }
+
 }
 
+void CMD_Client_OnListGamesCB::ArenaDtor(void* object) {
+  CMD_Client_OnListGamesCB* _this = reinterpret_cast< CMD_Client_OnListGamesCB* >(object);
+  (void)_this;
+}
+void CMD_Client_OnListGamesCB::RegisterArenaDtor(::google::protobuf::Arena* arena) {
+}
 void CMD_Client_OnListGamesCB::SetCachedSize(int size) const {
   GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
   _cached_size_ = size;
@@ -25895,7 +30404,7 @@ void CMD_Client_OnListGamesCB::SetCachedSize(int size) const {
 }
 const ::google::protobuf::Descriptor* CMD_Client_OnListGamesCB::descriptor() {
   protobuf_Commands_2eproto::protobuf_AssignDescriptorsOnce();
-  return protobuf_Commands_2eproto::file_level_metadata[52].descriptor;
+  return protobuf_Commands_2eproto::file_level_metadata[54].descriptor;
 }
 
 const CMD_Client_OnListGamesCB& CMD_Client_OnListGamesCB::default_instance() {
@@ -25904,11 +30413,7 @@ const CMD_Client_OnListGamesCB& CMD_Client_OnListGamesCB::default_instance() {
 }
 
 CMD_Client_OnListGamesCB* CMD_Client_OnListGamesCB::New(::google::protobuf::Arena* arena) const {
-  CMD_Client_OnListGamesCB* n = new CMD_Client_OnListGamesCB;
-  if (arena != NULL) {
-    arena->Own(n);
-  }
-  return n;
+  return ::google::protobuf::Arena::CreateMessage<CMD_Client_OnListGamesCB>(arena);
 }
 
 void CMD_Client_OnListGamesCB::Clear() {
@@ -26152,6 +30657,21 @@ bool CMD_Client_OnListGamesCB::IsInitialized() const {
 
 void CMD_Client_OnListGamesCB::Swap(CMD_Client_OnListGamesCB* other) {
   if (other == this) return;
+  if (GetArenaNoVirtual() == other->GetArenaNoVirtual()) {
+    InternalSwap(other);
+  } else {
+    CMD_Client_OnListGamesCB* temp = New(GetArenaNoVirtual());
+    temp->MergeFrom(*other);
+    other->CopyFrom(*this);
+    InternalSwap(temp);
+    if (GetArenaNoVirtual() == NULL) {
+      delete temp;
+    }
+  }
+}
+void CMD_Client_OnListGamesCB::UnsafeArenaSwap(CMD_Client_OnListGamesCB* other) {
+  if (other == this) return;
+  GOOGLE_DCHECK(GetArenaNoVirtual() == other->GetArenaNoVirtual());
   InternalSwap(other);
 }
 void CMD_Client_OnListGamesCB::InternalSwap(CMD_Client_OnListGamesCB* other) {
@@ -26164,7 +30684,7 @@ void CMD_Client_OnListGamesCB::InternalSwap(CMD_Client_OnListGamesCB* other) {
 
 ::google::protobuf::Metadata CMD_Client_OnListGamesCB::GetMetadata() const {
   protobuf_Commands_2eproto::protobuf_AssignDescriptorsOnce();
-  return protobuf_Commands_2eproto::file_level_metadata[52];
+  return protobuf_Commands_2eproto::file_level_metadata[54];
 }
 
 #if PROTOBUF_INLINE_NOT_IN_HEADERS
@@ -26246,11 +30766,57 @@ CMD_Client_OnListGamesCB::gameinfos() const {
 
 // ===================================================================
 
+void CMD_Client_OnLoginCB::_slow_mutable_playercontext() {
+  playercontext_ = ::google::protobuf::Arena::CreateMessage< ::CMD_PlayerContext >(
+      GetArenaNoVirtual());
+}
+::CMD_PlayerContext* CMD_Client_OnLoginCB::_slow_release_playercontext() {
+  if (playercontext_ == NULL) {
+    return NULL;
+  } else {
+    ::CMD_PlayerContext* temp = new ::CMD_PlayerContext(*playercontext_);
+    playercontext_ = NULL;
+    return temp;
+  }
+}
+::CMD_PlayerContext* CMD_Client_OnLoginCB::unsafe_arena_release_playercontext() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:CMD_Client_OnLoginCB.playerContext)
+  
+  ::CMD_PlayerContext* temp = playercontext_;
+  playercontext_ = NULL;
+  return temp;
+}
+void CMD_Client_OnLoginCB::_slow_set_allocated_playercontext(
+    ::google::protobuf::Arena* message_arena, ::CMD_PlayerContext** playercontext) {
+    if (message_arena != NULL && 
+        ::google::protobuf::Arena::GetArena(*playercontext) == NULL) {
+      message_arena->Own(*playercontext);
+    } else if (message_arena !=
+               ::google::protobuf::Arena::GetArena(*playercontext)) {
+      ::CMD_PlayerContext* new_playercontext = 
+            ::google::protobuf::Arena::CreateMessage< ::CMD_PlayerContext >(
+            message_arena);
+      new_playercontext->CopyFrom(**playercontext);
+      *playercontext = new_playercontext;
+    }
+}
+void CMD_Client_OnLoginCB::unsafe_arena_set_allocated_playercontext(
+    ::CMD_PlayerContext* playercontext) {
+  if (GetArenaNoVirtual() == NULL) {
+    delete playercontext_;
+  }
+  playercontext_ = playercontext;
+  if (playercontext) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:CMD_Client_OnLoginCB.playerContext)
+}
 #if !defined(_MSC_VER) || _MSC_VER >= 1900
 const int CMD_Client_OnLoginCB::kErrcodeFieldNumber;
 const int CMD_Client_OnLoginCB::kDatasFieldNumber;
 const int CMD_Client_OnLoginCB::kPlayerContextFieldNumber;
-const int CMD_Client_OnLoginCB::kHallsIDFieldNumber;
 #endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
 
 CMD_Client_OnLoginCB::CMD_Client_OnLoginCB()
@@ -26261,6 +30827,16 @@ CMD_Client_OnLoginCB::CMD_Client_OnLoginCB()
   SharedCtor();
   // @@protoc_insertion_point(constructor:CMD_Client_OnLoginCB)
 }
+CMD_Client_OnLoginCB::CMD_Client_OnLoginCB(::google::protobuf::Arena* arena)
+  : ::google::protobuf::Message(),
+  _internal_metadata_(arena) {
+#ifdef GOOGLE_PROTOBUF_NO_STATIC_INITIALIZER
+  protobuf_Commands_2eproto::InitDefaults();
+#endif  // GOOGLE_PROTOBUF_NO_STATIC_INITIALIZER
+  SharedCtor();
+  RegisterArenaDtor(arena);
+  // @@protoc_insertion_point(arena_constructor:CMD_Client_OnLoginCB)
+}
 CMD_Client_OnLoginCB::CMD_Client_OnLoginCB(const CMD_Client_OnLoginCB& from)
   : ::google::protobuf::Message(),
       _internal_metadata_(NULL),
@@ -26268,16 +30844,15 @@ CMD_Client_OnLoginCB::CMD_Client_OnLoginCB(const CMD_Client_OnLoginCB& from)
   _internal_metadata_.MergeFrom(from._internal_metadata_);
   datas_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
   if (from.datas().size() > 0) {
-    datas_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.datas_);
+    datas_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.datas(),
+      GetArenaNoVirtual());
   }
   if (from.has_playercontext()) {
     playercontext_ = new ::CMD_PlayerContext(*from.playercontext_);
   } else {
     playercontext_ = NULL;
   }
-  ::memcpy(&hallsid_, &from.hallsid_,
-    reinterpret_cast<char*>(&errcode_) -
-    reinterpret_cast<char*>(&hallsid_) + sizeof(errcode_));
+  errcode_ = from.errcode_;
   // @@protoc_insertion_point(copy_constructor:CMD_Client_OnLoginCB)
 }
 
@@ -26294,12 +30869,23 @@ CMD_Client_OnLoginCB::~CMD_Client_OnLoginCB() {
 }
 
 void CMD_Client_OnLoginCB::SharedDtor() {
-  datas_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  ::google::protobuf::Arena* arena = GetArenaNoVirtual();
+  if (arena != NULL) {
+    return;
+  }
+
+  datas_.Destroy(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), arena);
   if (this != internal_default_instance()) {
     delete playercontext_;
   }
 }
 
+void CMD_Client_OnLoginCB::ArenaDtor(void* object) {
+  CMD_Client_OnLoginCB* _this = reinterpret_cast< CMD_Client_OnLoginCB* >(object);
+  (void)_this;
+}
+void CMD_Client_OnLoginCB::RegisterArenaDtor(::google::protobuf::Arena* arena) {
+}
 void CMD_Client_OnLoginCB::SetCachedSize(int size) const {
   GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
   _cached_size_ = size;
@@ -26307,7 +30893,7 @@ void CMD_Client_OnLoginCB::SetCachedSize(int size) const {
 }
 const ::google::protobuf::Descriptor* CMD_Client_OnLoginCB::descriptor() {
   protobuf_Commands_2eproto::protobuf_AssignDescriptorsOnce();
-  return protobuf_Commands_2eproto::file_level_metadata[53].descriptor;
+  return protobuf_Commands_2eproto::file_level_metadata[55].descriptor;
 }
 
 const CMD_Client_OnLoginCB& CMD_Client_OnLoginCB::default_instance() {
@@ -26316,22 +30902,17 @@ const CMD_Client_OnLoginCB& CMD_Client_OnLoginCB::default_instance() {
 }
 
 CMD_Client_OnLoginCB* CMD_Client_OnLoginCB::New(::google::protobuf::Arena* arena) const {
-  CMD_Client_OnLoginCB* n = new CMD_Client_OnLoginCB;
-  if (arena != NULL) {
-    arena->Own(n);
-  }
-  return n;
+  return ::google::protobuf::Arena::CreateMessage<CMD_Client_OnLoginCB>(arena);
 }
 
 void CMD_Client_OnLoginCB::Clear() {
 // @@protoc_insertion_point(message_clear_start:CMD_Client_OnLoginCB)
-  datas_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  datas_.ClearToEmpty(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
   if (GetArenaNoVirtual() == NULL && playercontext_ != NULL) {
     delete playercontext_;
   }
   playercontext_ = NULL;
-  ::memset(&hallsid_, 0, reinterpret_cast<char*>(&errcode_) -
-    reinterpret_cast<char*>(&hallsid_) + sizeof(errcode_));
+  errcode_ = 0;
 }
 
 bool CMD_Client_OnLoginCB::MergePartialFromCodedStream(
@@ -26380,19 +30961,6 @@ bool CMD_Client_OnLoginCB::MergePartialFromCodedStream(
         break;
       }
 
-      // uint64 hallsID = 4;
-      case 4: {
-        if (tag == 32u) {
-
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
-                 input, &hallsid_)));
-        } else {
-          goto handle_unusual;
-        }
-        break;
-      }
-
       default: {
       handle_unusual:
         if (tag == 0 ||
@@ -26435,11 +31003,6 @@ void CMD_Client_OnLoginCB::SerializeWithCachedSizes(
       3, *this->playercontext_, output);
   }
 
-  // uint64 hallsID = 4;
-  if (this->hallsid() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteUInt64(4, this->hallsid(), output);
-  }
-
   // @@protoc_insertion_point(serialize_end:CMD_Client_OnLoginCB)
 }
 
@@ -26467,11 +31030,6 @@ void CMD_Client_OnLoginCB::SerializeWithCachedSizes(
         3, *this->playercontext_, false, target);
   }
 
-  // uint64 hallsID = 4;
-  if (this->hallsid() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteUInt64ToArray(4, this->hallsid(), target);
-  }
-
   // @@protoc_insertion_point(serialize_to_array_end:CMD_Client_OnLoginCB)
   return target;
 }
@@ -26494,13 +31052,6 @@ size_t CMD_Client_OnLoginCB::ByteSizeLong() const {
         *this->playercontext_);
   }
 
-  // uint64 hallsID = 4;
-  if (this->hallsid() != 0) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::UInt64Size(
-        this->hallsid());
-  }
-
   // .ServerError errcode = 1;
   if (this->errcode() != 0) {
     total_size += 1 +
@@ -26534,15 +31085,11 @@ void CMD_Client_OnLoginCB::MergeFrom(const CMD_Client_OnLoginCB& from) {
   GOOGLE_DCHECK_NE(&from, this);
   _internal_metadata_.MergeFrom(from._internal_metadata_);
   if (from.datas().size() > 0) {
-
-    datas_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.datas_);
+    set_datas(from.datas());
   }
   if (from.has_playercontext()) {
     mutable_playercontext()->::CMD_PlayerContext::MergeFrom(from.playercontext());
   }
-  if (from.hallsid() != 0) {
-    set_hallsid(from.hallsid());
-  }
   if (from.errcode() != 0) {
     set_errcode(from.errcode());
   }
@@ -26568,19 +31115,33 @@ bool CMD_Client_OnLoginCB::IsInitialized() const {
 
 void CMD_Client_OnLoginCB::Swap(CMD_Client_OnLoginCB* other) {
   if (other == this) return;
+  if (GetArenaNoVirtual() == other->GetArenaNoVirtual()) {
+    InternalSwap(other);
+  } else {
+    CMD_Client_OnLoginCB* temp = New(GetArenaNoVirtual());
+    temp->MergeFrom(*other);
+    other->CopyFrom(*this);
+    InternalSwap(temp);
+    if (GetArenaNoVirtual() == NULL) {
+      delete temp;
+    }
+  }
+}
+void CMD_Client_OnLoginCB::UnsafeArenaSwap(CMD_Client_OnLoginCB* other) {
+  if (other == this) return;
+  GOOGLE_DCHECK(GetArenaNoVirtual() == other->GetArenaNoVirtual());
   InternalSwap(other);
 }
 void CMD_Client_OnLoginCB::InternalSwap(CMD_Client_OnLoginCB* other) {
   datas_.Swap(&other->datas_);
   std::swap(playercontext_, other->playercontext_);
-  std::swap(hallsid_, other->hallsid_);
   std::swap(errcode_, other->errcode_);
   std::swap(_cached_size_, other->_cached_size_);
 }
 
 ::google::protobuf::Metadata CMD_Client_OnLoginCB::GetMetadata() const {
   protobuf_Commands_2eproto::protobuf_AssignDescriptorsOnce();
-  return protobuf_Commands_2eproto::file_level_metadata[53];
+  return protobuf_Commands_2eproto::file_level_metadata[55];
 }
 
 #if PROTOBUF_INLINE_NOT_IN_HEADERS
@@ -26602,45 +31163,46 @@ void CMD_Client_OnLoginCB::set_errcode(::ServerError value) {
 
 // bytes datas = 2;
 void CMD_Client_OnLoginCB::clear_datas() {
-  datas_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  datas_.ClearToEmpty(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 const ::std::string& CMD_Client_OnLoginCB::datas() const {
   // @@protoc_insertion_point(field_get:CMD_Client_OnLoginCB.datas)
-  return datas_.GetNoArena();
+  return datas_.Get();
 }
 void CMD_Client_OnLoginCB::set_datas(const ::std::string& value) {
   
-  datas_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  datas_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value, GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set:CMD_Client_OnLoginCB.datas)
 }
-#if LANG_CXX11
-void CMD_Client_OnLoginCB::set_datas(::std::string&& value) {
-  
-  datas_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:CMD_Client_OnLoginCB.datas)
-}
-#endif
 void CMD_Client_OnLoginCB::set_datas(const char* value) {
   
-  datas_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  datas_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+              GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_char:CMD_Client_OnLoginCB.datas)
 }
-void CMD_Client_OnLoginCB::set_datas(const void* value, size_t size) {
+void CMD_Client_OnLoginCB::set_datas(const void* value,
+    size_t size) {
   
-  datas_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
+  datas_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_pointer:CMD_Client_OnLoginCB.datas)
 }
 ::std::string* CMD_Client_OnLoginCB::mutable_datas() {
   
   // @@protoc_insertion_point(field_mutable:CMD_Client_OnLoginCB.datas)
-  return datas_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return datas_.Mutable(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 ::std::string* CMD_Client_OnLoginCB::release_datas() {
   // @@protoc_insertion_point(field_release:CMD_Client_OnLoginCB.datas)
   
-  return datas_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return datas_.Release(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
+}
+::std::string* CMD_Client_OnLoginCB::unsafe_arena_release_datas() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:CMD_Client_OnLoginCB.datas)
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  
+  return datas_.UnsafeArenaRelease(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      GetArenaNoVirtual());
 }
 void CMD_Client_OnLoginCB::set_allocated_datas(::std::string* datas) {
   if (datas != NULL) {
@@ -26648,9 +31210,22 @@ void CMD_Client_OnLoginCB::set_allocated_datas(::std::string* datas) {
   } else {
     
   }
-  datas_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), datas);
+  datas_.SetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), datas,
+      GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_allocated:CMD_Client_OnLoginCB.datas)
 }
+void CMD_Client_OnLoginCB::unsafe_arena_set_allocated_datas(
+    ::std::string* datas) {
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  if (datas != NULL) {
+    
+  } else {
+    
+  }
+  datas_.UnsafeArenaSetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      datas, GetArenaNoVirtual());
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:CMD_Client_OnLoginCB.datas)
+}
 
 // .CMD_PlayerContext playerContext = 3;
 bool CMD_Client_OnLoginCB::has_playercontext() const {
@@ -26668,7 +31243,7 @@ const ::CMD_PlayerContext& CMD_Client_OnLoginCB::playercontext() const {
 ::CMD_PlayerContext* CMD_Client_OnLoginCB::mutable_playercontext() {
   
   if (playercontext_ == NULL) {
-    playercontext_ = new ::CMD_PlayerContext;
+    _slow_mutable_playercontext();
   }
   // @@protoc_insertion_point(field_mutable:CMD_Client_OnLoginCB.playerContext)
   return playercontext_;
@@ -26676,12 +31251,22 @@ const ::CMD_PlayerContext& CMD_Client_OnLoginCB::playercontext() const {
 ::CMD_PlayerContext* CMD_Client_OnLoginCB::release_playercontext() {
   // @@protoc_insertion_point(field_release:CMD_Client_OnLoginCB.playerContext)
   
-  ::CMD_PlayerContext* temp = playercontext_;
-  playercontext_ = NULL;
-  return temp;
+  if (GetArenaNoVirtual() != NULL) {
+    return _slow_release_playercontext();
+  } else {
+    ::CMD_PlayerContext* temp = playercontext_;
+    playercontext_ = NULL;
+    return temp;
+  }
 }
-void CMD_Client_OnLoginCB::set_allocated_playercontext(::CMD_PlayerContext* playercontext) {
-  delete playercontext_;
+ void CMD_Client_OnLoginCB::set_allocated_playercontext(::CMD_PlayerContext* playercontext) {
+  ::google::protobuf::Arena* message_arena = GetArenaNoVirtual();
+  if (message_arena == NULL) {
+    delete playercontext_;
+  }
+  if (playercontext != NULL) {
+    _slow_set_allocated_playercontext(message_arena, &playercontext);
+  }
   playercontext_ = playercontext;
   if (playercontext) {
     
@@ -26691,20 +31276,6 @@ void CMD_Client_OnLoginCB::set_allocated_playercontext(::CMD_PlayerContext* play
   // @@protoc_insertion_point(field_set_allocated:CMD_Client_OnLoginCB.playerContext)
 }
 
-// uint64 hallsID = 4;
-void CMD_Client_OnLoginCB::clear_hallsid() {
-  hallsid_ = GOOGLE_ULONGLONG(0);
-}
-::google::protobuf::uint64 CMD_Client_OnLoginCB::hallsid() const {
-  // @@protoc_insertion_point(field_get:CMD_Client_OnLoginCB.hallsID)
-  return hallsid_;
-}
-void CMD_Client_OnLoginCB::set_hallsid(::google::protobuf::uint64 value) {
-  
-  hallsid_ = value;
-  // @@protoc_insertion_point(field_set:CMD_Client_OnLoginCB.hallsID)
-}
-
 #endif  // PROTOBUF_INLINE_NOT_IN_HEADERS
 
 // ===================================================================
@@ -26724,6 +31295,16 @@ CMD_Client_OnMatchingUpdate::CMD_Client_OnMatchingUpdate()
   SharedCtor();
   // @@protoc_insertion_point(constructor:CMD_Client_OnMatchingUpdate)
 }
+CMD_Client_OnMatchingUpdate::CMD_Client_OnMatchingUpdate(::google::protobuf::Arena* arena)
+  : ::google::protobuf::Message(),
+  _internal_metadata_(arena) {
+#ifdef GOOGLE_PROTOBUF_NO_STATIC_INITIALIZER
+  protobuf_Commands_2eproto::InitDefaults();
+#endif  // GOOGLE_PROTOBUF_NO_STATIC_INITIALIZER
+  SharedCtor();
+  RegisterArenaDtor(arena);
+  // @@protoc_insertion_point(arena_constructor:CMD_Client_OnMatchingUpdate)
+}
 CMD_Client_OnMatchingUpdate::CMD_Client_OnMatchingUpdate(const CMD_Client_OnMatchingUpdate& from)
   : ::google::protobuf::Message(),
       _internal_metadata_(NULL),
@@ -26731,7 +31312,8 @@ CMD_Client_OnMatchingUpdate::CMD_Client_OnMatchingUpdate(const CMD_Client_OnMatc
   _internal_metadata_.MergeFrom(from._internal_metadata_);
   name_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
   if (from.name().size() > 0) {
-    name_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.name_);
+    name_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.name(),
+      GetArenaNoVirtual());
   }
   ::memcpy(&id_, &from.id_,
     reinterpret_cast<char*>(&enter_) -
@@ -26752,9 +31334,20 @@ CMD_Client_OnMatchingUpdate::~CMD_Client_OnMatchingUpdate() {
 }
 
 void CMD_Client_OnMatchingUpdate::SharedDtor() {
-  name_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  ::google::protobuf::Arena* arena = GetArenaNoVirtual();
+  if (arena != NULL) {
+    return;
+  }
+
+  name_.Destroy(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), arena);
 }
 
+void CMD_Client_OnMatchingUpdate::ArenaDtor(void* object) {
+  CMD_Client_OnMatchingUpdate* _this = reinterpret_cast< CMD_Client_OnMatchingUpdate* >(object);
+  (void)_this;
+}
+void CMD_Client_OnMatchingUpdate::RegisterArenaDtor(::google::protobuf::Arena* arena) {
+}
 void CMD_Client_OnMatchingUpdate::SetCachedSize(int size) const {
   GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
   _cached_size_ = size;
@@ -26762,7 +31355,7 @@ void CMD_Client_OnMatchingUpdate::SetCachedSize(int size) const {
 }
 const ::google::protobuf::Descriptor* CMD_Client_OnMatchingUpdate::descriptor() {
   protobuf_Commands_2eproto::protobuf_AssignDescriptorsOnce();
-  return protobuf_Commands_2eproto::file_level_metadata[54].descriptor;
+  return protobuf_Commands_2eproto::file_level_metadata[56].descriptor;
 }
 
 const CMD_Client_OnMatchingUpdate& CMD_Client_OnMatchingUpdate::default_instance() {
@@ -26771,16 +31364,12 @@ const CMD_Client_OnMatchingUpdate& CMD_Client_OnMatchingUpdate::default_instance
 }
 
 CMD_Client_OnMatchingUpdate* CMD_Client_OnMatchingUpdate::New(::google::protobuf::Arena* arena) const {
-  CMD_Client_OnMatchingUpdate* n = new CMD_Client_OnMatchingUpdate;
-  if (arena != NULL) {
-    arena->Own(n);
-  }
-  return n;
+  return ::google::protobuf::Arena::CreateMessage<CMD_Client_OnMatchingUpdate>(arena);
 }
 
 void CMD_Client_OnMatchingUpdate::Clear() {
 // @@protoc_insertion_point(message_clear_start:CMD_Client_OnMatchingUpdate)
-  name_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  name_.ClearToEmpty(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
   ::memset(&id_, 0, reinterpret_cast<char*>(&enter_) -
     reinterpret_cast<char*>(&id_) + sizeof(enter_));
 }
@@ -26992,8 +31581,7 @@ void CMD_Client_OnMatchingUpdate::MergeFrom(const CMD_Client_OnMatchingUpdate& f
   GOOGLE_DCHECK_NE(&from, this);
   _internal_metadata_.MergeFrom(from._internal_metadata_);
   if (from.name().size() > 0) {
-
-    name_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.name_);
+    set_name(from.name());
   }
   if (from.id() != 0) {
     set_id(from.id());
@@ -27026,6 +31614,21 @@ bool CMD_Client_OnMatchingUpdate::IsInitialized() const {
 
 void CMD_Client_OnMatchingUpdate::Swap(CMD_Client_OnMatchingUpdate* other) {
   if (other == this) return;
+  if (GetArenaNoVirtual() == other->GetArenaNoVirtual()) {
+    InternalSwap(other);
+  } else {
+    CMD_Client_OnMatchingUpdate* temp = New(GetArenaNoVirtual());
+    temp->MergeFrom(*other);
+    other->CopyFrom(*this);
+    InternalSwap(temp);
+    if (GetArenaNoVirtual() == NULL) {
+      delete temp;
+    }
+  }
+}
+void CMD_Client_OnMatchingUpdate::UnsafeArenaSwap(CMD_Client_OnMatchingUpdate* other) {
+  if (other == this) return;
+  GOOGLE_DCHECK(GetArenaNoVirtual() == other->GetArenaNoVirtual());
   InternalSwap(other);
 }
 void CMD_Client_OnMatchingUpdate::InternalSwap(CMD_Client_OnMatchingUpdate* other) {
@@ -27038,7 +31641,7 @@ void CMD_Client_OnMatchingUpdate::InternalSwap(CMD_Client_OnMatchingUpdate* othe
 
 ::google::protobuf::Metadata CMD_Client_OnMatchingUpdate::GetMetadata() const {
   protobuf_Commands_2eproto::protobuf_AssignDescriptorsOnce();
-  return protobuf_Commands_2eproto::file_level_metadata[54];
+  return protobuf_Commands_2eproto::file_level_metadata[56];
 }
 
 #if PROTOBUF_INLINE_NOT_IN_HEADERS
@@ -27046,45 +31649,46 @@ void CMD_Client_OnMatchingUpdate::InternalSwap(CMD_Client_OnMatchingUpdate* othe
 
 // string name = 1;
 void CMD_Client_OnMatchingUpdate::clear_name() {
-  name_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  name_.ClearToEmpty(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 const ::std::string& CMD_Client_OnMatchingUpdate::name() const {
   // @@protoc_insertion_point(field_get:CMD_Client_OnMatchingUpdate.name)
-  return name_.GetNoArena();
+  return name_.Get();
 }
 void CMD_Client_OnMatchingUpdate::set_name(const ::std::string& value) {
   
-  name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  name_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value, GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set:CMD_Client_OnMatchingUpdate.name)
 }
-#if LANG_CXX11
-void CMD_Client_OnMatchingUpdate::set_name(::std::string&& value) {
-  
-  name_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:CMD_Client_OnMatchingUpdate.name)
-}
-#endif
 void CMD_Client_OnMatchingUpdate::set_name(const char* value) {
   
-  name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  name_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+              GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_char:CMD_Client_OnMatchingUpdate.name)
 }
-void CMD_Client_OnMatchingUpdate::set_name(const char* value, size_t size) {
+void CMD_Client_OnMatchingUpdate::set_name(const char* value,
+    size_t size) {
   
-  name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
+  name_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_pointer:CMD_Client_OnMatchingUpdate.name)
 }
 ::std::string* CMD_Client_OnMatchingUpdate::mutable_name() {
   
   // @@protoc_insertion_point(field_mutable:CMD_Client_OnMatchingUpdate.name)
-  return name_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return name_.Mutable(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 ::std::string* CMD_Client_OnMatchingUpdate::release_name() {
   // @@protoc_insertion_point(field_release:CMD_Client_OnMatchingUpdate.name)
   
-  return name_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return name_.Release(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
+}
+::std::string* CMD_Client_OnMatchingUpdate::unsafe_arena_release_name() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:CMD_Client_OnMatchingUpdate.name)
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  
+  return name_.UnsafeArenaRelease(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      GetArenaNoVirtual());
 }
 void CMD_Client_OnMatchingUpdate::set_allocated_name(::std::string* name) {
   if (name != NULL) {
@@ -27092,9 +31696,22 @@ void CMD_Client_OnMatchingUpdate::set_allocated_name(::std::string* name) {
   } else {
     
   }
-  name_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), name);
+  name_.SetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), name,
+      GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_allocated:CMD_Client_OnMatchingUpdate.name)
 }
+void CMD_Client_OnMatchingUpdate::unsafe_arena_set_allocated_name(
+    ::std::string* name) {
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  if (name != NULL) {
+    
+  } else {
+    
+  }
+  name_.UnsafeArenaSetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      name, GetArenaNoVirtual());
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:CMD_Client_OnMatchingUpdate.name)
+}
 
 // uint64 id = 2;
 void CMD_Client_OnMatchingUpdate::clear_id() {
@@ -27165,6 +31782,16 @@ CMD_Client_OnEndMatch::CMD_Client_OnEndMatch()
   SharedCtor();
   // @@protoc_insertion_point(constructor:CMD_Client_OnEndMatch)
 }
+CMD_Client_OnEndMatch::CMD_Client_OnEndMatch(::google::protobuf::Arena* arena)
+  : ::google::protobuf::Message(),
+  _internal_metadata_(arena) {
+#ifdef GOOGLE_PROTOBUF_NO_STATIC_INITIALIZER
+  protobuf_Commands_2eproto::InitDefaults();
+#endif  // GOOGLE_PROTOBUF_NO_STATIC_INITIALIZER
+  SharedCtor();
+  RegisterArenaDtor(arena);
+  // @@protoc_insertion_point(arena_constructor:CMD_Client_OnEndMatch)
+}
 CMD_Client_OnEndMatch::CMD_Client_OnEndMatch(const CMD_Client_OnEndMatch& from)
   : ::google::protobuf::Message(),
       _internal_metadata_(NULL),
@@ -27172,7 +31799,8 @@ CMD_Client_OnEndMatch::CMD_Client_OnEndMatch(const CMD_Client_OnEndMatch& from)
   _internal_metadata_.MergeFrom(from._internal_metadata_);
   gameserverip_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
   if (from.gameserverip().size() > 0) {
-    gameserverip_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.gameserverip_);
+    gameserverip_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.gameserverip(),
+      GetArenaNoVirtual());
   }
   ::memcpy(&errcode_, &from.errcode_,
     reinterpret_cast<char*>(&roomid_) -
@@ -27193,9 +31821,20 @@ CMD_Client_OnEndMatch::~CMD_Client_OnEndMatch() {
 }
 
 void CMD_Client_OnEndMatch::SharedDtor() {
-  gameserverip_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  ::google::protobuf::Arena* arena = GetArenaNoVirtual();
+  if (arena != NULL) {
+    return;
+  }
+
+  gameserverip_.Destroy(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), arena);
 }
 
+void CMD_Client_OnEndMatch::ArenaDtor(void* object) {
+  CMD_Client_OnEndMatch* _this = reinterpret_cast< CMD_Client_OnEndMatch* >(object);
+  (void)_this;
+}
+void CMD_Client_OnEndMatch::RegisterArenaDtor(::google::protobuf::Arena* arena) {
+}
 void CMD_Client_OnEndMatch::SetCachedSize(int size) const {
   GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
   _cached_size_ = size;
@@ -27203,7 +31842,7 @@ void CMD_Client_OnEndMatch::SetCachedSize(int size) const {
 }
 const ::google::protobuf::Descriptor* CMD_Client_OnEndMatch::descriptor() {
   protobuf_Commands_2eproto::protobuf_AssignDescriptorsOnce();
-  return protobuf_Commands_2eproto::file_level_metadata[55].descriptor;
+  return protobuf_Commands_2eproto::file_level_metadata[57].descriptor;
 }
 
 const CMD_Client_OnEndMatch& CMD_Client_OnEndMatch::default_instance() {
@@ -27212,16 +31851,12 @@ const CMD_Client_OnEndMatch& CMD_Client_OnEndMatch::default_instance() {
 }
 
 CMD_Client_OnEndMatch* CMD_Client_OnEndMatch::New(::google::protobuf::Arena* arena) const {
-  CMD_Client_OnEndMatch* n = new CMD_Client_OnEndMatch;
-  if (arena != NULL) {
-    arena->Own(n);
-  }
-  return n;
+  return ::google::protobuf::Arena::CreateMessage<CMD_Client_OnEndMatch>(arena);
 }
 
 void CMD_Client_OnEndMatch::Clear() {
 // @@protoc_insertion_point(message_clear_start:CMD_Client_OnEndMatch)
-  gameserverip_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  gameserverip_.ClearToEmpty(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
   ::memset(&errcode_, 0, reinterpret_cast<char*>(&roomid_) -
     reinterpret_cast<char*>(&errcode_) + sizeof(roomid_));
 }
@@ -27675,8 +32310,7 @@ void CMD_Client_OnEndMatch::MergeFrom(const CMD_Client_OnEndMatch& from) {
   GOOGLE_DCHECK_NE(&from, this);
   _internal_metadata_.MergeFrom(from._internal_metadata_);
   if (from.gameserverip().size() > 0) {
-
-    gameserverip_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.gameserverip_);
+    set_gameserverip(from.gameserverip());
   }
   if (from.errcode() != 0) {
     set_errcode(from.errcode());
@@ -27733,6 +32367,21 @@ bool CMD_Client_OnEndMatch::IsInitialized() const {
 
 void CMD_Client_OnEndMatch::Swap(CMD_Client_OnEndMatch* other) {
   if (other == this) return;
+  if (GetArenaNoVirtual() == other->GetArenaNoVirtual()) {
+    InternalSwap(other);
+  } else {
+    CMD_Client_OnEndMatch* temp = New(GetArenaNoVirtual());
+    temp->MergeFrom(*other);
+    other->CopyFrom(*this);
+    InternalSwap(temp);
+    if (GetArenaNoVirtual() == NULL) {
+      delete temp;
+    }
+  }
+}
+void CMD_Client_OnEndMatch::UnsafeArenaSwap(CMD_Client_OnEndMatch* other) {
+  if (other == this) return;
+  GOOGLE_DCHECK(GetArenaNoVirtual() == other->GetArenaNoVirtual());
   InternalSwap(other);
 }
 void CMD_Client_OnEndMatch::InternalSwap(CMD_Client_OnEndMatch* other) {
@@ -27753,7 +32402,7 @@ void CMD_Client_OnEndMatch::InternalSwap(CMD_Client_OnEndMatch* other) {
 
 ::google::protobuf::Metadata CMD_Client_OnEndMatch::GetMetadata() const {
   protobuf_Commands_2eproto::protobuf_AssignDescriptorsOnce();
-  return protobuf_Commands_2eproto::file_level_metadata[55];
+  return protobuf_Commands_2eproto::file_level_metadata[57];
 }
 
 #if PROTOBUF_INLINE_NOT_IN_HEADERS
@@ -27775,45 +32424,46 @@ void CMD_Client_OnEndMatch::set_errcode(::ServerError value) {
 
 // string gameServerIP = 2;
 void CMD_Client_OnEndMatch::clear_gameserverip() {
-  gameserverip_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  gameserverip_.ClearToEmpty(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 const ::std::string& CMD_Client_OnEndMatch::gameserverip() const {
   // @@protoc_insertion_point(field_get:CMD_Client_OnEndMatch.gameServerIP)
-  return gameserverip_.GetNoArena();
+  return gameserverip_.Get();
 }
 void CMD_Client_OnEndMatch::set_gameserverip(const ::std::string& value) {
   
-  gameserverip_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  gameserverip_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value, GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set:CMD_Client_OnEndMatch.gameServerIP)
 }
-#if LANG_CXX11
-void CMD_Client_OnEndMatch::set_gameserverip(::std::string&& value) {
-  
-  gameserverip_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:CMD_Client_OnEndMatch.gameServerIP)
-}
-#endif
 void CMD_Client_OnEndMatch::set_gameserverip(const char* value) {
   
-  gameserverip_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  gameserverip_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+              GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_char:CMD_Client_OnEndMatch.gameServerIP)
 }
-void CMD_Client_OnEndMatch::set_gameserverip(const char* value, size_t size) {
+void CMD_Client_OnEndMatch::set_gameserverip(const char* value,
+    size_t size) {
   
-  gameserverip_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
+  gameserverip_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_pointer:CMD_Client_OnEndMatch.gameServerIP)
 }
 ::std::string* CMD_Client_OnEndMatch::mutable_gameserverip() {
   
   // @@protoc_insertion_point(field_mutable:CMD_Client_OnEndMatch.gameServerIP)
-  return gameserverip_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return gameserverip_.Mutable(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 ::std::string* CMD_Client_OnEndMatch::release_gameserverip() {
   // @@protoc_insertion_point(field_release:CMD_Client_OnEndMatch.gameServerIP)
   
-  return gameserverip_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return gameserverip_.Release(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
+}
+::std::string* CMD_Client_OnEndMatch::unsafe_arena_release_gameserverip() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:CMD_Client_OnEndMatch.gameServerIP)
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  
+  return gameserverip_.UnsafeArenaRelease(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      GetArenaNoVirtual());
 }
 void CMD_Client_OnEndMatch::set_allocated_gameserverip(::std::string* gameserverip) {
   if (gameserverip != NULL) {
@@ -27821,9 +32471,22 @@ void CMD_Client_OnEndMatch::set_allocated_gameserverip(::std::string* gameserver
   } else {
     
   }
-  gameserverip_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), gameserverip);
+  gameserverip_.SetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), gameserverip,
+      GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_allocated:CMD_Client_OnEndMatch.gameServerIP)
 }
+void CMD_Client_OnEndMatch::unsafe_arena_set_allocated_gameserverip(
+    ::std::string* gameserverip) {
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  if (gameserverip != NULL) {
+    
+  } else {
+    
+  }
+  gameserverip_.UnsafeArenaSetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      gameserverip, GetArenaNoVirtual());
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:CMD_Client_OnEndMatch.gameServerIP)
+}
 
 // int32 gameServerPort = 3;
 void CMD_Client_OnEndMatch::clear_gameserverport() {
@@ -27984,6 +32647,16 @@ CMD_Client_OnGameOver::CMD_Client_OnGameOver()
   SharedCtor();
   // @@protoc_insertion_point(constructor:CMD_Client_OnGameOver)
 }
+CMD_Client_OnGameOver::CMD_Client_OnGameOver(::google::protobuf::Arena* arena)
+  : ::google::protobuf::Message(),
+  _internal_metadata_(arena) {
+#ifdef GOOGLE_PROTOBUF_NO_STATIC_INITIALIZER
+  protobuf_Commands_2eproto::InitDefaults();
+#endif  // GOOGLE_PROTOBUF_NO_STATIC_INITIALIZER
+  SharedCtor();
+  RegisterArenaDtor(arena);
+  // @@protoc_insertion_point(arena_constructor:CMD_Client_OnGameOver)
+}
 CMD_Client_OnGameOver::CMD_Client_OnGameOver(const CMD_Client_OnGameOver& from)
   : ::google::protobuf::Message(),
       _internal_metadata_(NULL),
@@ -28007,8 +32680,19 @@ CMD_Client_OnGameOver::~CMD_Client_OnGameOver() {
 }
 
 void CMD_Client_OnGameOver::SharedDtor() {
+  ::google::protobuf::Arena* arena = GetArenaNoVirtual();
+  if (arena != NULL) {
+    return;
+  }
+
 }
 
+void CMD_Client_OnGameOver::ArenaDtor(void* object) {
+  CMD_Client_OnGameOver* _this = reinterpret_cast< CMD_Client_OnGameOver* >(object);
+  (void)_this;
+}
+void CMD_Client_OnGameOver::RegisterArenaDtor(::google::protobuf::Arena* arena) {
+}
 void CMD_Client_OnGameOver::SetCachedSize(int size) const {
   GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
   _cached_size_ = size;
@@ -28016,7 +32700,7 @@ void CMD_Client_OnGameOver::SetCachedSize(int size) const {
 }
 const ::google::protobuf::Descriptor* CMD_Client_OnGameOver::descriptor() {
   protobuf_Commands_2eproto::protobuf_AssignDescriptorsOnce();
-  return protobuf_Commands_2eproto::file_level_metadata[56].descriptor;
+  return protobuf_Commands_2eproto::file_level_metadata[58].descriptor;
 }
 
 const CMD_Client_OnGameOver& CMD_Client_OnGameOver::default_instance() {
@@ -28025,11 +32709,7 @@ const CMD_Client_OnGameOver& CMD_Client_OnGameOver::default_instance() {
 }
 
 CMD_Client_OnGameOver* CMD_Client_OnGameOver::New(::google::protobuf::Arena* arena) const {
-  CMD_Client_OnGameOver* n = new CMD_Client_OnGameOver;
-  if (arena != NULL) {
-    arena->Own(n);
-  }
-  return n;
+  return ::google::protobuf::Arena::CreateMessage<CMD_Client_OnGameOver>(arena);
 }
 
 void CMD_Client_OnGameOver::Clear() {
@@ -28269,6 +32949,21 @@ bool CMD_Client_OnGameOver::IsInitialized() const {
 
 void CMD_Client_OnGameOver::Swap(CMD_Client_OnGameOver* other) {
   if (other == this) return;
+  if (GetArenaNoVirtual() == other->GetArenaNoVirtual()) {
+    InternalSwap(other);
+  } else {
+    CMD_Client_OnGameOver* temp = New(GetArenaNoVirtual());
+    temp->MergeFrom(*other);
+    other->CopyFrom(*this);
+    InternalSwap(temp);
+    if (GetArenaNoVirtual() == NULL) {
+      delete temp;
+    }
+  }
+}
+void CMD_Client_OnGameOver::UnsafeArenaSwap(CMD_Client_OnGameOver* other) {
+  if (other == this) return;
+  GOOGLE_DCHECK(GetArenaNoVirtual() == other->GetArenaNoVirtual());
   InternalSwap(other);
 }
 void CMD_Client_OnGameOver::InternalSwap(CMD_Client_OnGameOver* other) {
@@ -28281,7 +32976,7 @@ void CMD_Client_OnGameOver::InternalSwap(CMD_Client_OnGameOver* other) {
 
 ::google::protobuf::Metadata CMD_Client_OnGameOver::GetMetadata() const {
   protobuf_Commands_2eproto::protobuf_AssignDescriptorsOnce();
-  return protobuf_Commands_2eproto::file_level_metadata[56];
+  return protobuf_Commands_2eproto::file_level_metadata[58];
 }
 
 #if PROTOBUF_INLINE_NOT_IN_HEADERS
@@ -28359,6 +33054,16 @@ CMD_Client_OnCancelMatch::CMD_Client_OnCancelMatch()
   SharedCtor();
   // @@protoc_insertion_point(constructor:CMD_Client_OnCancelMatch)
 }
+CMD_Client_OnCancelMatch::CMD_Client_OnCancelMatch(::google::protobuf::Arena* arena)
+  : ::google::protobuf::Message(),
+  _internal_metadata_(arena) {
+#ifdef GOOGLE_PROTOBUF_NO_STATIC_INITIALIZER
+  protobuf_Commands_2eproto::InitDefaults();
+#endif  // GOOGLE_PROTOBUF_NO_STATIC_INITIALIZER
+  SharedCtor();
+  RegisterArenaDtor(arena);
+  // @@protoc_insertion_point(arena_constructor:CMD_Client_OnCancelMatch)
+}
 CMD_Client_OnCancelMatch::CMD_Client_OnCancelMatch(const CMD_Client_OnCancelMatch& from)
   : ::google::protobuf::Message(),
       _internal_metadata_(NULL),
@@ -28379,8 +33084,19 @@ CMD_Client_OnCancelMatch::~CMD_Client_OnCancelMatch() {
 }
 
 void CMD_Client_OnCancelMatch::SharedDtor() {
+  ::google::protobuf::Arena* arena = GetArenaNoVirtual();
+  if (arena != NULL) {
+    return;
+  }
+
 }
 
+void CMD_Client_OnCancelMatch::ArenaDtor(void* object) {
+  CMD_Client_OnCancelMatch* _this = reinterpret_cast< CMD_Client_OnCancelMatch* >(object);
+  (void)_this;
+}
+void CMD_Client_OnCancelMatch::RegisterArenaDtor(::google::protobuf::Arena* arena) {
+}
 void CMD_Client_OnCancelMatch::SetCachedSize(int size) const {
   GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
   _cached_size_ = size;
@@ -28388,7 +33104,7 @@ void CMD_Client_OnCancelMatch::SetCachedSize(int size) const {
 }
 const ::google::protobuf::Descriptor* CMD_Client_OnCancelMatch::descriptor() {
   protobuf_Commands_2eproto::protobuf_AssignDescriptorsOnce();
-  return protobuf_Commands_2eproto::file_level_metadata[57].descriptor;
+  return protobuf_Commands_2eproto::file_level_metadata[59].descriptor;
 }
 
 const CMD_Client_OnCancelMatch& CMD_Client_OnCancelMatch::default_instance() {
@@ -28397,11 +33113,7 @@ const CMD_Client_OnCancelMatch& CMD_Client_OnCancelMatch::default_instance() {
 }
 
 CMD_Client_OnCancelMatch* CMD_Client_OnCancelMatch::New(::google::protobuf::Arena* arena) const {
-  CMD_Client_OnCancelMatch* n = new CMD_Client_OnCancelMatch;
-  if (arena != NULL) {
-    arena->Own(n);
-  }
-  return n;
+  return ::google::protobuf::Arena::CreateMessage<CMD_Client_OnCancelMatch>(arena);
 }
 
 void CMD_Client_OnCancelMatch::Clear() {
@@ -28541,6 +33253,21 @@ bool CMD_Client_OnCancelMatch::IsInitialized() const {
 
 void CMD_Client_OnCancelMatch::Swap(CMD_Client_OnCancelMatch* other) {
   if (other == this) return;
+  if (GetArenaNoVirtual() == other->GetArenaNoVirtual()) {
+    InternalSwap(other);
+  } else {
+    CMD_Client_OnCancelMatch* temp = New(GetArenaNoVirtual());
+    temp->MergeFrom(*other);
+    other->CopyFrom(*this);
+    InternalSwap(temp);
+    if (GetArenaNoVirtual() == NULL) {
+      delete temp;
+    }
+  }
+}
+void CMD_Client_OnCancelMatch::UnsafeArenaSwap(CMD_Client_OnCancelMatch* other) {
+  if (other == this) return;
+  GOOGLE_DCHECK(GetArenaNoVirtual() == other->GetArenaNoVirtual());
   InternalSwap(other);
 }
 void CMD_Client_OnCancelMatch::InternalSwap(CMD_Client_OnCancelMatch* other) {
@@ -28550,7 +33277,7 @@ void CMD_Client_OnCancelMatch::InternalSwap(CMD_Client_OnCancelMatch* other) {
 
 ::google::protobuf::Metadata CMD_Client_OnCancelMatch::GetMetadata() const {
   protobuf_Commands_2eproto::protobuf_AssignDescriptorsOnce();
-  return protobuf_Commands_2eproto::file_level_metadata[57];
+  return protobuf_Commands_2eproto::file_level_metadata[59];
 }
 
 #if PROTOBUF_INLINE_NOT_IN_HEADERS
@@ -82,6 +82,9 @@ extern CMD_Directory_ListServersDefaultTypeInternal _CMD_Directory_ListServers_d
 class CMD_ForwardPacket;
 class CMD_ForwardPacketDefaultTypeInternal;
 extern CMD_ForwardPacketDefaultTypeInternal _CMD_ForwardPacket_default_instance_;
+class CMD_FrameUpgrade;
+class CMD_FrameUpgradeDefaultTypeInternal;
+extern CMD_FrameUpgradeDefaultTypeInternal _CMD_FrameUpgrade_default_instance_;
 class CMD_GameInfos;
 class CMD_GameInfosDefaultTypeInternal;
 extern CMD_GameInfosDefaultTypeInternal _CMD_GameInfos_default_instance_;
@@ -196,6 +199,9 @@ extern CMD_Roommgr_OnRoomSrvGameOverReportDefaultTypeInternal _CMD_Roommgr_OnRoo
 class CMD_Roommgr_RequestCreateRoom;
 class CMD_Roommgr_RequestCreateRoomDefaultTypeInternal;
 extern CMD_Roommgr_RequestCreateRoomDefaultTypeInternal _CMD_Roommgr_RequestCreateRoom_default_instance_;
+class CMD_ShmAttach;
+class CMD_ShmAttachDefaultTypeInternal;
+extern CMD_ShmAttachDefaultTypeInternal _CMD_ShmAttach_default_instance_;
 class CMD_Unkown;
 class CMD_UnkownDefaultTypeInternal;
 extern CMD_UnkownDefaultTypeInternal _CMD_Unkown_default_instance_;
@@ -231,6 +237,10 @@ enum CMD {
   Pong = 10,
   ForwardPacket = 11,
   RemoteDisconnected = 12,
+  FrameUpgrade = 13,
+  ForwardFrame = 14,
+  MulticastFrame = 15,
+  ShmAttach = 16,
   Directory_Begin = 101,
   Directory_ListServers = 102,
   Directory_End = 200,
@@ -320,6 +330,12 @@ class CMD_Unkown : public ::google::protobuf::Message /* @@protoc_insertion_poin
     return *this;
   }
 
+  inline ::google::protobuf::Arena* GetArena() const PROTOBUF_FINAL {
+    return GetArenaNoVirtual();
+  }
+  inline void* GetMaybeArenaPointer() const PROTOBUF_FINAL {
+    return MaybeArenaPtr();
+  }
   static const ::google::protobuf::Descriptor* descriptor();
   static const CMD_Unkown& default_instance();
 
@@ -328,6 +344,7 @@ class CMD_Unkown : public ::google::protobuf::Message /* @@protoc_insertion_poin
                &_CMD_Unkown_default_instance_);
   }
 
+  void UnsafeArenaSwap(CMD_Unkown* other);
   void Swap(CMD_Unkown* other);
 
   // implements Message ----------------------------------------------
@@ -360,12 +377,17 @@ class CMD_Unkown : public ::google::protobuf::Message /* @@protoc_insertion_poin
   void SharedDtor();
   void SetCachedSize(int size) const PROTOBUF_FINAL;
   void InternalSwap(CMD_Unkown* other);
+  protected:
+  explicit CMD_Unkown(::google::protobuf::Arena* arena);
+  private:
+  static void ArenaDtor(void* object);
+  inline void RegisterArenaDtor(::google::protobuf::Arena* arena);
   private:
   inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
+    return _internal_metadata_.arena();
   }
   inline void* MaybeArenaPtr() const {
-    return NULL;
+    return _internal_metadata_.raw_arena_ptr();
   }
   public:
 
@@ -379,6 +401,9 @@ class CMD_Unkown : public ::google::protobuf::Message /* @@protoc_insertion_poin
  private:
 
   ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
+  friend class ::google::protobuf::Arena;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
   mutable int _cached_size_;
   friend struct  protobuf_Commands_2eproto::TableStruct;
 };
@@ -396,6 +421,12 @@ class CMD_Hello : public ::google::protobuf::Message /* @@protoc_insertion_point
     return *this;
   }
 
+  inline ::google::protobuf::Arena* GetArena() const PROTOBUF_FINAL {
+    return GetArenaNoVirtual();
+  }
+  inline void* GetMaybeArenaPointer() const PROTOBUF_FINAL {
+    return MaybeArenaPtr();
+  }
   static const ::google::protobuf::Descriptor* descriptor();
   static const CMD_Hello& default_instance();
 
@@ -404,6 +435,7 @@ class CMD_Hello : public ::google::protobuf::Message /* @@protoc_insertion_point
                &_CMD_Hello_default_instance_);
   }
 
+  void UnsafeArenaSwap(CMD_Hello* other);
   void Swap(CMD_Hello* other);
 
   // implements Message ----------------------------------------------
@@ -436,12 +468,17 @@ class CMD_Hello : public ::google::protobuf::Message /* @@protoc_insertion_point
   void SharedDtor();
   void SetCachedSize(int size) const PROTOBUF_FINAL;
   void InternalSwap(CMD_Hello* other);
+  protected:
+  explicit CMD_Hello(::google::protobuf::Arena* arena);
+  private:
+  static void ArenaDtor(void* object);
+  inline void RegisterArenaDtor(::google::protobuf::Arena* arena);
   private:
   inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
+    return _internal_metadata_.arena();
   }
   inline void* MaybeArenaPtr() const {
-    return NULL;
+    return _internal_metadata_.raw_arena_ptr();
   }
   public:
 
@@ -456,14 +493,42 @@ class CMD_Hello : public ::google::protobuf::Message /* @@protoc_insertion_point
   static const int kNameFieldNumber = 5;
   const ::std::string& name() const;
   void set_name(const ::std::string& value);
-  #if LANG_CXX11
-  void set_name(::std::string&& value);
-  #endif
   void set_name(const char* value);
   void set_name(const char* value, size_t size);
   ::std::string* mutable_name();
   ::std::string* release_name();
   void set_allocated_name(::std::string* name);
+  ::std::string* unsafe_arena_release_name();
+  void unsafe_arena_set_allocated_name(
+      ::std::string* name);
+
+  // bytes cipherKey = 10;
+  void clear_cipherkey();
+  static const int kCipherKeyFieldNumber = 10;
+  const ::std::string& cipherkey() const;
+  void set_cipherkey(const ::std::string& value);
+  void set_cipherkey(const char* value);
+  void set_cipherkey(const void* value, size_t size);
+  ::std::string* mutable_cipherkey();
+  ::std::string* release_cipherkey();
+  void set_allocated_cipherkey(::std::string* cipherkey);
+  ::std::string* unsafe_arena_release_cipherkey();
+  void unsafe_arena_set_allocated_cipherkey(
+      ::std::string* cipherkey);
+
+  // string hostID = 12;
+  void clear_hostid();
+  static const int kHostIDFieldNumber = 12;
+  const ::std::string& hostid() const;
+  void set_hostid(const ::std::string& value);
+  void set_hostid(const char* value);
+  void set_hostid(const char* value, size_t size);
+  ::std::string* mutable_hostid();
+  ::std::string* release_hostid();
+  void set_allocated_hostid(::std::string* hostid);
+  ::std::string* unsafe_arena_release_hostid();
+  void unsafe_arena_set_allocated_hostid(
+      ::std::string* hostid);
 
   // uint64 appID = 2;
   void clear_appid();
@@ -489,15 +554,62 @@ class CMD_Hello : public ::google::protobuf::Message /* @@protoc_insertion_point
   ::google::protobuf::uint64 appgid() const;
   void set_appgid(::google::protobuf::uint64 value);
 
+  // uint32 frameVersion = 6;
+  void clear_frameversion();
+  static const int kFrameVersionFieldNumber = 6;
+  ::google::protobuf::uint32 frameversion() const;
+  void set_frameversion(::google::protobuf::uint32 value);
+
+  // uint32 compression = 7;
+  void clear_compression();
+  static const int kCompressionFieldNumber = 7;
+  ::google::protobuf::uint32 compression() const;
+  void set_compression(::google::protobuf::uint32 value);
+
+  // uint32 compressDict = 8;
+  void clear_compressdict();
+  static const int kCompressDictFieldNumber = 8;
+  ::google::protobuf::uint32 compressdict() const;
+  void set_compressdict(::google::protobuf::uint32 value);
+
+  // uint32 ciphers = 9;
+  void clear_ciphers();
+  static const int kCiphersFieldNumber = 9;
+  ::google::protobuf::uint32 ciphers() const;
+  void set_ciphers(::google::protobuf::uint32 value);
+
+  // bool batch = 11;
+  void clear_batch();
+  static const int kBatchFieldNumber = 11;
+  bool batch() const;
+  void set_batch(bool value);
+
+  // uint32 link = 13;
+  void clear_link();
+  static const int kLinkFieldNumber = 13;
+  ::google::protobuf::uint32 link() const;
+  void set_link(::google::protobuf::uint32 value);
+
   // @@protoc_insertion_point(class_scope:CMD_Hello)
  private:
 
   ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
+  friend class ::google::protobuf::Arena;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
   ::google::protobuf::internal::ArenaStringPtr name_;
+  ::google::protobuf::internal::ArenaStringPtr cipherkey_;
+  ::google::protobuf::internal::ArenaStringPtr hostid_;
   ::google::protobuf::uint64 appid_;
   ::google::protobuf::int32 version_;
   ::google::protobuf::int32 apptype_;
   ::google::protobuf::uint64 appgid_;
+  ::google::protobuf::uint32 frameversion_;
+  ::google::protobuf::uint32 compression_;
+  ::google::protobuf::uint32 compressdict_;
+  ::google::protobuf::uint32 ciphers_;
+  bool batch_;
+  ::google::protobuf::uint32 link_;
   mutable int _cached_size_;
   friend struct  protobuf_Commands_2eproto::TableStruct;
 };
@@ -515,6 +627,12 @@ class CMD_HelloCB : public ::google::protobuf::Message /* @@protoc_insertion_poi
     return *this;
   }
 
+  inline ::google::protobuf::Arena* GetArena() const PROTOBUF_FINAL {
+    return GetArenaNoVirtual();
+  }
+  inline void* GetMaybeArenaPointer() const PROTOBUF_FINAL {
+    return MaybeArenaPtr();
+  }
   static const ::google::protobuf::Descriptor* descriptor();
   static const CMD_HelloCB& default_instance();
 
@@ -523,6 +641,7 @@ class CMD_HelloCB : public ::google::protobuf::Message /* @@protoc_insertion_poi
                &_CMD_HelloCB_default_instance_);
   }
 
+  void UnsafeArenaSwap(CMD_HelloCB* other);
   void Swap(CMD_HelloCB* other);
 
   // implements Message ----------------------------------------------
@@ -555,12 +674,17 @@ class CMD_HelloCB : public ::google::protobuf::Message /* @@protoc_insertion_poi
   void SharedDtor();
   void SetCachedSize(int size) const PROTOBUF_FINAL;
   void InternalSwap(CMD_HelloCB* other);
+  protected:
+  explicit CMD_HelloCB(::google::protobuf::Arena* arena);
+  private:
+  static void ArenaDtor(void* object);
+  inline void RegisterArenaDtor(::google::protobuf::Arena* arena);
   private:
   inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
+    return _internal_metadata_.arena();
   }
   inline void* MaybeArenaPtr() const {
-    return NULL;
+    return _internal_metadata_.raw_arena_ptr();
   }
   public:
 
@@ -575,14 +699,42 @@ class CMD_HelloCB : public ::google::protobuf::Message /* @@protoc_insertion_poi
   static const int kNameFieldNumber = 5;
   const ::std::string& name() const;
   void set_name(const ::std::string& value);
-  #if LANG_CXX11
-  void set_name(::std::string&& value);
-  #endif
   void set_name(const char* value);
   void set_name(const char* value, size_t size);
   ::std::string* mutable_name();
   ::std::string* release_name();
   void set_allocated_name(::std::string* name);
+  ::std::string* unsafe_arena_release_name();
+  void unsafe_arena_set_allocated_name(
+      ::std::string* name);
+
+  // bytes cipherKey = 10;
+  void clear_cipherkey();
+  static const int kCipherKeyFieldNumber = 10;
+  const ::std::string& cipherkey() const;
+  void set_cipherkey(const ::std::string& value);
+  void set_cipherkey(const char* value);
+  void set_cipherkey(const void* value, size_t size);
+  ::std::string* mutable_cipherkey();
+  ::std::string* release_cipherkey();
+  void set_allocated_cipherkey(::std::string* cipherkey);
+  ::std::string* unsafe_arena_release_cipherkey();
+  void unsafe_arena_set_allocated_cipherkey(
+      ::std::string* cipherkey);
+
+  // string shmName = 12;
+  void clear_shmname();
+  static const int kShmNameFieldNumber = 12;
+  const ::std::string& shmname() const;
+  void set_shmname(const ::std::string& value);
+  void set_shmname(const char* value);
+  void set_shmname(const char* value, size_t size);
+  ::std::string* mutable_shmname();
+  ::std::string* release_shmname();
+  void set_allocated_shmname(::std::string* shmname);
+  ::std::string* unsafe_arena_release_shmname();
+  void unsafe_arena_set_allocated_shmname(
+      ::std::string* shmname);
 
   // uint64 appID = 2;
   void clear_appid();
@@ -608,15 +760,153 @@ class CMD_HelloCB : public ::google::protobuf::Message /* @@protoc_insertion_poi
   ::google::protobuf::uint64 appgid() const;
   void set_appgid(::google::protobuf::uint64 value);
 
+  // uint32 frameVersion = 6;
+  void clear_frameversion();
+  static const int kFrameVersionFieldNumber = 6;
+  ::google::protobuf::uint32 frameversion() const;
+  void set_frameversion(::google::protobuf::uint32 value);
+
+  // uint32 compression = 7;
+  void clear_compression();
+  static const int kCompressionFieldNumber = 7;
+  ::google::protobuf::uint32 compression() const;
+  void set_compression(::google::protobuf::uint32 value);
+
+  // uint32 compressDict = 8;
+  void clear_compressdict();
+  static const int kCompressDictFieldNumber = 8;
+  ::google::protobuf::uint32 compressdict() const;
+  void set_compressdict(::google::protobuf::uint32 value);
+
+  // uint32 cipher = 9;
+  void clear_cipher();
+  static const int kCipherFieldNumber = 9;
+  ::google::protobuf::uint32 cipher() const;
+  void set_cipher(::google::protobuf::uint32 value);
+
+  // bool batch = 11;
+  void clear_batch();
+  static const int kBatchFieldNumber = 11;
+  bool batch() const;
+  void set_batch(bool value);
+
   // @@protoc_insertion_point(class_scope:CMD_HelloCB)
  private:
 
   ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
+  friend class ::google::protobuf::Arena;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
   ::google::protobuf::internal::ArenaStringPtr name_;
+  ::google::protobuf::internal::ArenaStringPtr cipherkey_;
+  ::google::protobuf::internal::ArenaStringPtr shmname_;
   ::google::protobuf::uint64 appid_;
   ::google::protobuf::int32 version_;
   ::google::protobuf::int32 apptype_;
   ::google::protobuf::uint64 appgid_;
+  ::google::protobuf::uint32 frameversion_;
+  ::google::protobuf::uint32 compression_;
+  ::google::protobuf::uint32 compressdict_;
+  ::google::protobuf::uint32 cipher_;
+  bool batch_;
+  mutable int _cached_size_;
+  friend struct  protobuf_Commands_2eproto::TableStruct;
+};
+// -------------------------------------------------------------------
+
+class CMD_FrameUpgrade : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:CMD_FrameUpgrade) */ {
+ public:
+  CMD_FrameUpgrade();
+  virtual ~CMD_FrameUpgrade();
+
+  CMD_FrameUpgrade(const CMD_FrameUpgrade& from);
+
+  inline CMD_FrameUpgrade& operator=(const CMD_FrameUpgrade& from) {
+    CopyFrom(from);
+    return *this;
+  }
+
+  inline ::google::protobuf::Arena* GetArena() const PROTOBUF_FINAL {
+    return GetArenaNoVirtual();
+  }
+  inline void* GetMaybeArenaPointer() const PROTOBUF_FINAL {
+    return MaybeArenaPtr();
+  }
+  static const ::google::protobuf::Descriptor* descriptor();
+  static const CMD_FrameUpgrade& default_instance();
+
+  static inline const CMD_FrameUpgrade* internal_default_instance() {
+    return reinterpret_cast<const CMD_FrameUpgrade*>(
+               &_CMD_FrameUpgrade_default_instance_);
+  }
+
+  void UnsafeArenaSwap(CMD_FrameUpgrade* other);
+  void Swap(CMD_FrameUpgrade* other);
+
+  // implements Message ----------------------------------------------
+
+  inline CMD_FrameUpgrade* New() const PROTOBUF_FINAL { return New(NULL); }
+
+  CMD_FrameUpgrade* New(::google::protobuf::Arena* arena) const PROTOBUF_FINAL;
+  void CopyFrom(const ::google::protobuf::Message& from) PROTOBUF_FINAL;
+  void MergeFrom(const ::google::protobuf::Message& from) PROTOBUF_FINAL;
+  void CopyFrom(const CMD_FrameUpgrade& from);
+  void MergeFrom(const CMD_FrameUpgrade& from);
+  void Clear() PROTOBUF_FINAL;
+  bool IsInitialized() const PROTOBUF_FINAL;
+
+  size_t ByteSizeLong() const PROTOBUF_FINAL;
+  bool MergePartialFromCodedStream(
+      ::google::protobuf::io::CodedInputStream* input) PROTOBUF_FINAL;
+  void SerializeWithCachedSizes(
+      ::google::protobuf::io::CodedOutputStream* output) const PROTOBUF_FINAL;
+  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
+      bool deterministic, ::google::protobuf::uint8* target) const PROTOBUF_FINAL;
+  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output)
+      const PROTOBUF_FINAL {
+    return InternalSerializeWithCachedSizesToArray(
+        ::google::protobuf::io::CodedOutputStream::IsDefaultSerializationDeterministic(), output);
+  }
+  int GetCachedSize() const PROTOBUF_FINAL { return _cached_size_; }
+  private:
+  void SharedCtor();
+  void SharedDtor();
+  void SetCachedSize(int size) const PROTOBUF_FINAL;
+  void InternalSwap(CMD_FrameUpgrade* other);
+  protected:
+  explicit CMD_FrameUpgrade(::google::protobuf::Arena* arena);
+  private:
+  static void ArenaDtor(void* object);
+  inline void RegisterArenaDtor(::google::protobuf::Arena* arena);
+  private:
+  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
+    return _internal_metadata_.arena();
+  }
+  inline void* MaybeArenaPtr() const {
+    return _internal_metadata_.raw_arena_ptr();
+  }
+  public:
+
+  ::google::protobuf::Metadata GetMetadata() const PROTOBUF_FINAL;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  // uint32 version = 1;
+  void clear_version();
+  static const int kVersionFieldNumber = 1;
+  ::google::protobuf::uint32 version() const;
+  void set_version(::google::protobuf::uint32 value);
+
+  // @@protoc_insertion_point(class_scope:CMD_FrameUpgrade)
+ private:
+
+  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
+  friend class ::google::protobuf::Arena;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  ::google::protobuf::uint32 version_;
   mutable int _cached_size_;
   friend struct  protobuf_Commands_2eproto::TableStruct;
 };
@@ -634,6 +924,12 @@ class CMD_Heartbeat : public ::google::protobuf::Message /* @@protoc_insertion_p
     return *this;
   }
 
+  inline ::google::protobuf::Arena* GetArena() const PROTOBUF_FINAL {
+    return GetArenaNoVirtual();
+  }
+  inline void* GetMaybeArenaPointer() const PROTOBUF_FINAL {
+    return MaybeArenaPtr();
+  }
   static const ::google::protobuf::Descriptor* descriptor();
   static const CMD_Heartbeat& default_instance();
 
@@ -642,6 +938,7 @@ class CMD_Heartbeat : public ::google::protobuf::Message /* @@protoc_insertion_p
                &_CMD_Heartbeat_default_instance_);
   }
 
+  void UnsafeArenaSwap(CMD_Heartbeat* other);
   void Swap(CMD_Heartbeat* other);
 
   // implements Message ----------------------------------------------
@@ -674,12 +971,17 @@ class CMD_Heartbeat : public ::google::protobuf::Message /* @@protoc_insertion_p
   void SharedDtor();
   void SetCachedSize(int size) const PROTOBUF_FINAL;
   void InternalSwap(CMD_Heartbeat* other);
+  protected:
+  explicit CMD_Heartbeat(::google::protobuf::Arena* arena);
+  private:
+  static void ArenaDtor(void* object);
+  inline void RegisterArenaDtor(::google::protobuf::Arena* arena);
   private:
   inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
+    return _internal_metadata_.arena();
   }
   inline void* MaybeArenaPtr() const {
-    return NULL;
+    return _internal_metadata_.raw_arena_ptr();
   }
   public:
 
@@ -705,6 +1007,9 @@ class CMD_Heartbeat : public ::google::protobuf::Message /* @@protoc_insertion_p
  private:
 
   ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
+  friend class ::google::protobuf::Arena;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
   ::google::protobuf::uint64 appid_;
   ::google::protobuf::int32 apptype_;
   mutable int _cached_size_;
@@ -724,6 +1029,12 @@ class CMD_HeartbeatCB : public ::google::protobuf::Message /* @@protoc_insertion
     return *this;
   }
 
+  inline ::google::protobuf::Arena* GetArena() const PROTOBUF_FINAL {
+    return GetArenaNoVirtual();
+  }
+  inline void* GetMaybeArenaPointer() const PROTOBUF_FINAL {
+    return MaybeArenaPtr();
+  }
   static const ::google::protobuf::Descriptor* descriptor();
   static const CMD_HeartbeatCB& default_instance();
 
@@ -732,6 +1043,7 @@ class CMD_HeartbeatCB : public ::google::protobuf::Message /* @@protoc_insertion
                &_CMD_HeartbeatCB_default_instance_);
   }
 
+  void UnsafeArenaSwap(CMD_HeartbeatCB* other);
   void Swap(CMD_HeartbeatCB* other);
 
   // implements Message ----------------------------------------------
@@ -764,12 +1076,17 @@ class CMD_HeartbeatCB : public ::google::protobuf::Message /* @@protoc_insertion
   void SharedDtor();
   void SetCachedSize(int size) const PROTOBUF_FINAL;
   void InternalSwap(CMD_HeartbeatCB* other);
+  protected:
+  explicit CMD_HeartbeatCB(::google::protobuf::Arena* arena);
+  private:
+  static void ArenaDtor(void* object);
+  inline void RegisterArenaDtor(::google::protobuf::Arena* arena);
   private:
   inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
+    return _internal_metadata_.arena();
   }
   inline void* MaybeArenaPtr() const {
-    return NULL;
+    return _internal_metadata_.raw_arena_ptr();
   }
   public:
 
@@ -795,6 +1112,9 @@ class CMD_HeartbeatCB : public ::google::protobuf::Message /* @@protoc_insertion
  private:
 
   ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
+  friend class ::google::protobuf::Arena;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
   ::google::protobuf::uint64 appid_;
   ::google::protobuf::int32 apptype_;
   mutable int _cached_size_;
@@ -814,6 +1134,12 @@ class CMD_Version_Not_Match : public ::google::protobuf::Message /* @@protoc_ins
     return *this;
   }
 
+  inline ::google::protobuf::Arena* GetArena() const PROTOBUF_FINAL {
+    return GetArenaNoVirtual();
+  }
+  inline void* GetMaybeArenaPointer() const PROTOBUF_FINAL {
+    return MaybeArenaPtr();
+  }
   static const ::google::protobuf::Descriptor* descriptor();
   static const CMD_Version_Not_Match& default_instance();
 
@@ -822,6 +1148,7 @@ class CMD_Version_Not_Match : public ::google::protobuf::Message /* @@protoc_ins
                &_CMD_Version_Not_Match_default_instance_);
   }
 
+  void UnsafeArenaSwap(CMD_Version_Not_Match* other);
   void Swap(CMD_Version_Not_Match* other);
 
   // implements Message ----------------------------------------------
@@ -854,12 +1181,17 @@ class CMD_Version_Not_Match : public ::google::protobuf::Message /* @@protoc_ins
   void SharedDtor();
   void SetCachedSize(int size) const PROTOBUF_FINAL;
   void InternalSwap(CMD_Version_Not_Match* other);
+  protected:
+  explicit CMD_Version_Not_Match(::google::protobuf::Arena* arena);
+  private:
+  static void ArenaDtor(void* object);
+  inline void RegisterArenaDtor(::google::protobuf::Arena* arena);
   private:
   inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
+    return _internal_metadata_.arena();
   }
   inline void* MaybeArenaPtr() const {
-    return NULL;
+    return _internal_metadata_.raw_arena_ptr();
   }
   public:
 
@@ -891,6 +1223,9 @@ class CMD_Version_Not_Match : public ::google::protobuf::Message /* @@protoc_ins
  private:
 
   ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
+  friend class ::google::protobuf::Arena;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
   ::google::protobuf::uint64 appid_;
   ::google::protobuf::int32 version_;
   ::google::protobuf::int32 apptype_;
@@ -911,6 +1246,12 @@ class CMD_UpdateServerInfos : public ::google::protobuf::Message /* @@protoc_ins
     return *this;
   }
 
+  inline ::google::protobuf::Arena* GetArena() const PROTOBUF_FINAL {
+    return GetArenaNoVirtual();
+  }
+  inline void* GetMaybeArenaPointer() const PROTOBUF_FINAL {
+    return MaybeArenaPtr();
+  }
   static const ::google::protobuf::Descriptor* descriptor();
   static const CMD_UpdateServerInfos& default_instance();
 
@@ -919,6 +1260,7 @@ class CMD_UpdateServerInfos : public ::google::protobuf::Message /* @@protoc_ins
                &_CMD_UpdateServerInfos_default_instance_);
   }
 
+  void UnsafeArenaSwap(CMD_UpdateServerInfos* other);
   void Swap(CMD_UpdateServerInfos* other);
 
   // implements Message ----------------------------------------------
@@ -951,12 +1293,17 @@ class CMD_UpdateServerInfos : public ::google::protobuf::Message /* @@protoc_ins
   void SharedDtor();
   void SetCachedSize(int size) const PROTOBUF_FINAL;
   void InternalSwap(CMD_UpdateServerInfos* other);
+  protected:
+  explicit CMD_UpdateServerInfos(::google::protobuf::Arena* arena);
+  private:
+  static void ArenaDtor(void* object);
+  inline void RegisterArenaDtor(::google::protobuf::Arena* arena);
   private:
   inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
+    return _internal_metadata_.arena();
   }
   inline void* MaybeArenaPtr() const {
-    return NULL;
+    return _internal_metadata_.raw_arena_ptr();
   }
   public:
 
@@ -983,42 +1330,56 @@ class CMD_UpdateServerInfos : public ::google::protobuf::Message /* @@protoc_ins
   static const int kInternalIpFieldNumber = 3;
   const ::std::string& internal_ip() const;
   void set_internal_ip(const ::std::string& value);
-  #if LANG_CXX11
-  void set_internal_ip(::std::string&& value);
-  #endif
   void set_internal_ip(const char* value);
   void set_internal_ip(const char* value, size_t size);
   ::std::string* mutable_internal_ip();
   ::std::string* release_internal_ip();
   void set_allocated_internal_ip(::std::string* internal_ip);
+  ::std::string* unsafe_arena_release_internal_ip();
+  void unsafe_arena_set_allocated_internal_ip(
+      ::std::string* internal_ip);
 
   // string external_ip = 5;
   void clear_external_ip();
   static const int kExternalIpFieldNumber = 5;
   const ::std::string& external_ip() const;
   void set_external_ip(const ::std::string& value);
-  #if LANG_CXX11
-  void set_external_ip(::std::string&& value);
-  #endif
   void set_external_ip(const char* value);
   void set_external_ip(const char* value, size_t size);
   ::std::string* mutable_external_ip();
   ::std::string* release_external_ip();
   void set_allocated_external_ip(::std::string* external_ip);
+  ::std::string* unsafe_arena_release_external_ip();
+  void unsafe_arena_set_allocated_external_ip(
+      ::std::string* external_ip);
 
   // string name = 11;
   void clear_name();
   static const int kNameFieldNumber = 11;
   const ::std::string& name() const;
   void set_name(const ::std::string& value);
-  #if LANG_CXX11
-  void set_name(::std::string&& value);
-  #endif
   void set_name(const char* value);
   void set_name(const char* value, size_t size);
   ::std::string* mutable_name();
   ::std::string* release_name();
   void set_allocated_name(::std::string* name);
+  ::std::string* unsafe_arena_release_name();
+  void unsafe_arena_set_allocated_name(
+      ::std::string* name);
+
+  // string hostID = 13;
+  void clear_hostid();
+  static const int kHostIDFieldNumber = 13;
+  const ::std::string& hostid() const;
+  void set_hostid(const ::std::string& value);
+  void set_hostid(const char* value);
+  void set_hostid(const char* value, size_t size);
+  ::std::string* mutable_hostid();
+  ::std::string* release_hostid();
+  void set_allocated_hostid(::std::string* hostid);
+  ::std::string* unsafe_arena_release_hostid();
+  void unsafe_arena_set_allocated_hostid(
+      ::std::string* hostid);
 
   // uint64 appID = 1;
   void clear_appid();
@@ -1072,10 +1433,14 @@ class CMD_UpdateServerInfos : public ::google::protobuf::Message /* @@protoc_ins
  private:
 
   ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
+  friend class ::google::protobuf::Arena;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
   ::google::protobuf::RepeatedPtrField< ::CMD_UpdateServerInfos > child_srvs_;
   ::google::protobuf::internal::ArenaStringPtr internal_ip_;
   ::google::protobuf::internal::ArenaStringPtr external_ip_;
   ::google::protobuf::internal::ArenaStringPtr name_;
+  ::google::protobuf::internal::ArenaStringPtr hostid_;
   ::google::protobuf::uint64 appid_;
   ::google::protobuf::int32 apptype_;
   ::google::protobuf::uint32 internal_port_;
@@ -1101,6 +1466,12 @@ class CMD_QueryServerInfos : public ::google::protobuf::Message /* @@protoc_inse
     return *this;
   }
 
+  inline ::google::protobuf::Arena* GetArena() const PROTOBUF_FINAL {
+    return GetArenaNoVirtual();
+  }
+  inline void* GetMaybeArenaPointer() const PROTOBUF_FINAL {
+    return MaybeArenaPtr();
+  }
   static const ::google::protobuf::Descriptor* descriptor();
   static const CMD_QueryServerInfos& default_instance();
 
@@ -1109,6 +1480,7 @@ class CMD_QueryServerInfos : public ::google::protobuf::Message /* @@protoc_inse
                &_CMD_QueryServerInfos_default_instance_);
   }
 
+  void UnsafeArenaSwap(CMD_QueryServerInfos* other);
   void Swap(CMD_QueryServerInfos* other);
 
   // implements Message ----------------------------------------------
@@ -1141,12 +1513,17 @@ class CMD_QueryServerInfos : public ::google::protobuf::Message /* @@protoc_inse
   void SharedDtor();
   void SetCachedSize(int size) const PROTOBUF_FINAL;
   void InternalSwap(CMD_QueryServerInfos* other);
+  protected:
+  explicit CMD_QueryServerInfos(::google::protobuf::Arena* arena);
+  private:
+  static void ArenaDtor(void* object);
+  inline void RegisterArenaDtor(::google::protobuf::Arena* arena);
   private:
   inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
+    return _internal_metadata_.arena();
   }
   inline void* MaybeArenaPtr() const {
-    return NULL;
+    return _internal_metadata_.raw_arena_ptr();
   }
   public:
 
@@ -1184,6 +1561,9 @@ class CMD_QueryServerInfos : public ::google::protobuf::Message /* @@protoc_inse
  private:
 
   ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
+  friend class ::google::protobuf::Arena;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
   ::google::protobuf::uint64 appid_;
   ::google::protobuf::uint64 appgid_;
   ::google::protobuf::int32 apptype_;
@@ -1205,6 +1585,12 @@ class CMD_QueryServerInfosCB : public ::google::protobuf::Message /* @@protoc_in
     return *this;
   }
 
+  inline ::google::protobuf::Arena* GetArena() const PROTOBUF_FINAL {
+    return GetArenaNoVirtual();
+  }
+  inline void* GetMaybeArenaPointer() const PROTOBUF_FINAL {
+    return MaybeArenaPtr();
+  }
   static const ::google::protobuf::Descriptor* descriptor();
   static const CMD_QueryServerInfosCB& default_instance();
 
@@ -1213,6 +1599,7 @@ class CMD_QueryServerInfosCB : public ::google::protobuf::Message /* @@protoc_in
                &_CMD_QueryServerInfosCB_default_instance_);
   }
 
+  void UnsafeArenaSwap(CMD_QueryServerInfosCB* other);
   void Swap(CMD_QueryServerInfosCB* other);
 
   // implements Message ----------------------------------------------
@@ -1245,12 +1632,17 @@ class CMD_QueryServerInfosCB : public ::google::protobuf::Message /* @@protoc_in
   void SharedDtor();
   void SetCachedSize(int size) const PROTOBUF_FINAL;
   void InternalSwap(CMD_QueryServerInfosCB* other);
+  protected:
+  explicit CMD_QueryServerInfosCB(::google::protobuf::Arena* arena);
+  private:
+  static void ArenaDtor(void* object);
+  inline void RegisterArenaDtor(::google::protobuf::Arena* arena);
   private:
   inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
+    return _internal_metadata_.arena();
   }
   inline void* MaybeArenaPtr() const {
-    return NULL;
+    return _internal_metadata_.raw_arena_ptr();
   }
   public:
 
@@ -1276,12 +1668,113 @@ class CMD_QueryServerInfosCB : public ::google::protobuf::Message /* @@protoc_in
  private:
 
   ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
+  friend class ::google::protobuf::Arena;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
   ::google::protobuf::RepeatedPtrField< ::CMD_UpdateServerInfos > srvs_;
   mutable int _cached_size_;
   friend struct  protobuf_Commands_2eproto::TableStruct;
 };
 // -------------------------------------------------------------------
 
+class CMD_ShmAttach : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:CMD_ShmAttach) */ {
+ public:
+  CMD_ShmAttach();
+  virtual ~CMD_ShmAttach();
+
+  CMD_ShmAttach(const CMD_ShmAttach& from);
+
+  inline CMD_ShmAttach& operator=(const CMD_ShmAttach& from) {
+    CopyFrom(from);
+    return *this;
+  }
+
+  inline ::google::protobuf::Arena* GetArena() const PROTOBUF_FINAL {
+    return GetArenaNoVirtual();
+  }
+  inline void* GetMaybeArenaPointer() const PROTOBUF_FINAL {
+    return MaybeArenaPtr();
+  }
+  static const ::google::protobuf::Descriptor* descriptor();
+  static const CMD_ShmAttach& default_instance();
+
+  static inline const CMD_ShmAttach* internal_default_instance() {
+    return reinterpret_cast<const CMD_ShmAttach*>(
+               &_CMD_ShmAttach_default_instance_);
+  }
+
+  void UnsafeArenaSwap(CMD_ShmAttach* other);
+  void Swap(CMD_ShmAttach* other);
+
+  // implements Message ----------------------------------------------
+
+  inline CMD_ShmAttach* New() const PROTOBUF_FINAL { return New(NULL); }
+
+  CMD_ShmAttach* New(::google::protobuf::Arena* arena) const PROTOBUF_FINAL;
+  void CopyFrom(const ::google::protobuf::Message& from) PROTOBUF_FINAL;
+  void MergeFrom(const ::google::protobuf::Message& from) PROTOBUF_FINAL;
+  void CopyFrom(const CMD_ShmAttach& from);
+  void MergeFrom(const CMD_ShmAttach& from);
+  void Clear() PROTOBUF_FINAL;
+  bool IsInitialized() const PROTOBUF_FINAL;
+
+  size_t ByteSizeLong() const PROTOBUF_FINAL;
+  bool MergePartialFromCodedStream(
+      ::google::protobuf::io::CodedInputStream* input) PROTOBUF_FINAL;
+  void SerializeWithCachedSizes(
+      ::google::protobuf::io::CodedOutputStream* output) const PROTOBUF_FINAL;
+  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
+      bool deterministic, ::google::protobuf::uint8* target) const PROTOBUF_FINAL;
+  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output)
+      const PROTOBUF_FINAL {
+    return InternalSerializeWithCachedSizesToArray(
+        ::google::protobuf::io::CodedOutputStream::IsDefaultSerializationDeterministic(), output);
+  }
+  int GetCachedSize() const PROTOBUF_FINAL { return _cached_size_; }
+  private:
+  void SharedCtor();
+  void SharedDtor();
+  void SetCachedSize(int size) const PROTOBUF_FINAL;
+  void InternalSwap(CMD_ShmAttach* other);
+  protected:
+  explicit CMD_ShmAttach(::google::protobuf::Arena* arena);
+  private:
+  static void ArenaDtor(void* object);
+  inline void RegisterArenaDtor(::google::protobuf::Arena* arena);
+  private:
+  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
+    return _internal_metadata_.arena();
+  }
+  inline void* MaybeArenaPtr() const {
+    return _internal_metadata_.raw_arena_ptr();
+  }
+  public:
+
+  ::google::protobuf::Metadata GetMetadata() const PROTOBUF_FINAL;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  // bool ok = 1;
+  void clear_ok();
+  static const int kOkFieldNumber = 1;
+  bool ok() const;
+  void set_ok(bool value);
+
+  // @@protoc_insertion_point(class_scope:CMD_ShmAttach)
+ private:
+
+  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
+  friend class ::google::protobuf::Arena;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  bool ok_;
+  mutable int _cached_size_;
+  friend struct  protobuf_Commands_2eproto::TableStruct;
+};
+// -------------------------------------------------------------------
+
 class CMD_Ping : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:CMD_Ping) */ {
  public:
   CMD_Ping();
@@ -1294,6 +1787,12 @@ class CMD_Ping : public ::google::protobuf::Message /* @@protoc_insertion_point(
     return *this;
   }
 
+  inline ::google::protobuf::Arena* GetArena() const PROTOBUF_FINAL {
+    return GetArenaNoVirtual();
+  }
+  inline void* GetMaybeArenaPointer() const PROTOBUF_FINAL {
+    return MaybeArenaPtr();
+  }
   static const ::google::protobuf::Descriptor* descriptor();
   static const CMD_Ping& default_instance();
 
@@ -1302,6 +1801,7 @@ class CMD_Ping : public ::google::protobuf::Message /* @@protoc_insertion_point(
                &_CMD_Ping_default_instance_);
   }
 
+  void UnsafeArenaSwap(CMD_Ping* other);
   void Swap(CMD_Ping* other);
 
   // implements Message ----------------------------------------------
@@ -1334,12 +1834,17 @@ class CMD_Ping : public ::google::protobuf::Message /* @@protoc_insertion_point(
   void SharedDtor();
   void SetCachedSize(int size) const PROTOBUF_FINAL;
   void InternalSwap(CMD_Ping* other);
+  protected:
+  explicit CMD_Ping(::google::protobuf::Arena* arena);
+  private:
+  static void ArenaDtor(void* object);
+  inline void RegisterArenaDtor(::google::protobuf::Arena* arena);
   private:
   inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
+    return _internal_metadata_.arena();
   }
   inline void* MaybeArenaPtr() const {
-    return NULL;
+    return _internal_metadata_.raw_arena_ptr();
   }
   public:
 
@@ -1359,6 +1864,9 @@ class CMD_Ping : public ::google::protobuf::Message /* @@protoc_insertion_point(
  private:
 
   ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
+  friend class ::google::protobuf::Arena;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
   ::google::protobuf::uint64 time_;
   mutable int _cached_size_;
   friend struct  protobuf_Commands_2eproto::TableStruct;
@@ -1377,6 +1885,12 @@ class CMD_Pong : public ::google::protobuf::Message /* @@protoc_insertion_point(
     return *this;
   }
 
+  inline ::google::protobuf::Arena* GetArena() const PROTOBUF_FINAL {
+    return GetArenaNoVirtual();
+  }
+  inline void* GetMaybeArenaPointer() const PROTOBUF_FINAL {
+    return MaybeArenaPtr();
+  }
   static const ::google::protobuf::Descriptor* descriptor();
   static const CMD_Pong& default_instance();
 
@@ -1385,6 +1899,7 @@ class CMD_Pong : public ::google::protobuf::Message /* @@protoc_insertion_point(
                &_CMD_Pong_default_instance_);
   }
 
+  void UnsafeArenaSwap(CMD_Pong* other);
   void Swap(CMD_Pong* other);
 
   // implements Message ----------------------------------------------
@@ -1417,12 +1932,17 @@ class CMD_Pong : public ::google::protobuf::Message /* @@protoc_insertion_point(
   void SharedDtor();
   void SetCachedSize(int size) const PROTOBUF_FINAL;
   void InternalSwap(CMD_Pong* other);
+  protected:
+  explicit CMD_Pong(::google::protobuf::Arena* arena);
+  private:
+  static void ArenaDtor(void* object);
+  inline void RegisterArenaDtor(::google::protobuf::Arena* arena);
   private:
   inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
+    return _internal_metadata_.arena();
   }
   inline void* MaybeArenaPtr() const {
-    return NULL;
+    return _internal_metadata_.raw_arena_ptr();
   }
   public:
 
@@ -1442,6 +1962,9 @@ class CMD_Pong : public ::google::protobuf::Message /* @@protoc_insertion_point(
  private:
 
   ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
+  friend class ::google::protobuf::Arena;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
   ::google::protobuf::uint64 time_;
   mutable int _cached_size_;
   friend struct  protobuf_Commands_2eproto::TableStruct;
@@ -1460,6 +1983,12 @@ class CMD_ForwardPacket : public ::google::protobuf::Message /* @@protoc_inserti
     return *this;
   }
 
+  inline ::google::protobuf::Arena* GetArena() const PROTOBUF_FINAL {
+    return GetArenaNoVirtual();
+  }
+  inline void* GetMaybeArenaPointer() const PROTOBUF_FINAL {
+    return MaybeArenaPtr();
+  }
   static const ::google::protobuf::Descriptor* descriptor();
   static const CMD_ForwardPacket& default_instance();
 
@@ -1468,6 +1997,7 @@ class CMD_ForwardPacket : public ::google::protobuf::Message /* @@protoc_inserti
                &_CMD_ForwardPacket_default_instance_);
   }
 
+  void UnsafeArenaSwap(CMD_ForwardPacket* other);
   void Swap(CMD_ForwardPacket* other);
 
   // implements Message ----------------------------------------------
@@ -1500,12 +2030,17 @@ class CMD_ForwardPacket : public ::google::protobuf::Message /* @@protoc_inserti
   void SharedDtor();
   void SetCachedSize(int size) const PROTOBUF_FINAL;
   void InternalSwap(CMD_ForwardPacket* other);
+  protected:
+  explicit CMD_ForwardPacket(::google::protobuf::Arena* arena);
+  private:
+  static void ArenaDtor(void* object);
+  inline void RegisterArenaDtor(::google::protobuf::Arena* arena);
   private:
   inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
+    return _internal_metadata_.arena();
   }
   inline void* MaybeArenaPtr() const {
-    return NULL;
+    return _internal_metadata_.raw_arena_ptr();
   }
   public:
 
@@ -1520,14 +2055,14 @@ class CMD_ForwardPacket : public ::google::protobuf::Message /* @@protoc_inserti
   static const int kDatasFieldNumber = 2;
   const ::std::string& datas() const;
   void set_datas(const ::std::string& value);
-  #if LANG_CXX11
-  void set_datas(::std::string&& value);
-  #endif
   void set_datas(const char* value);
   void set_datas(const void* value, size_t size);
   ::std::string* mutable_datas();
   ::std::string* release_datas();
   void set_allocated_datas(::std::string* datas);
+  ::std::string* unsafe_arena_release_datas();
+  void unsafe_arena_set_allocated_datas(
+      ::std::string* datas);
 
   // uint64 requestorID = 1;
   void clear_requestorid();
@@ -1545,6 +2080,9 @@ class CMD_ForwardPacket : public ::google::protobuf::Message /* @@protoc_inserti
  private:
 
   ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
+  friend class ::google::protobuf::Arena;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
   ::google::protobuf::internal::ArenaStringPtr datas_;
   ::google::protobuf::uint64 requestorid_;
   ::google::protobuf::int32 msgcmd_;
@@ -1565,6 +2103,12 @@ class CMD_RemoteDisconnected : public ::google::protobuf::Message /* @@protoc_in
     return *this;
   }
 
+  inline ::google::protobuf::Arena* GetArena() const PROTOBUF_FINAL {
+    return GetArenaNoVirtual();
+  }
+  inline void* GetMaybeArenaPointer() const PROTOBUF_FINAL {
+    return MaybeArenaPtr();
+  }
   static const ::google::protobuf::Descriptor* descriptor();
   static const CMD_RemoteDisconnected& default_instance();
 
@@ -1573,6 +2117,7 @@ class CMD_RemoteDisconnected : public ::google::protobuf::Message /* @@protoc_in
                &_CMD_RemoteDisconnected_default_instance_);
   }
 
+  void UnsafeArenaSwap(CMD_RemoteDisconnected* other);
   void Swap(CMD_RemoteDisconnected* other);
 
   // implements Message ----------------------------------------------
@@ -1605,12 +2150,17 @@ class CMD_RemoteDisconnected : public ::google::protobuf::Message /* @@protoc_in
   void SharedDtor();
   void SetCachedSize(int size) const PROTOBUF_FINAL;
   void InternalSwap(CMD_RemoteDisconnected* other);
+  protected:
+  explicit CMD_RemoteDisconnected(::google::protobuf::Arena* arena);
+  private:
+  static void ArenaDtor(void* object);
+  inline void RegisterArenaDtor(::google::protobuf::Arena* arena);
   private:
   inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
+    return _internal_metadata_.arena();
   }
   inline void* MaybeArenaPtr() const {
-    return NULL;
+    return _internal_metadata_.raw_arena_ptr();
   }
   public:
 
@@ -1624,6 +2174,9 @@ class CMD_RemoteDisconnected : public ::google::protobuf::Message /* @@protoc_in
  private:
 
   ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
+  friend class ::google::protobuf::Arena;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
   mutable int _cached_size_;
   friend struct  protobuf_Commands_2eproto::TableStruct;
 };
@@ -1641,6 +2194,12 @@ class CMD_Directory_ListServers : public ::google::protobuf::Message /* @@protoc
     return *this;
   }
 
+  inline ::google::protobuf::Arena* GetArena() const PROTOBUF_FINAL {
+    return GetArenaNoVirtual();
+  }
+  inline void* GetMaybeArenaPointer() const PROTOBUF_FINAL {
+    return MaybeArenaPtr();
+  }
   static const ::google::protobuf::Descriptor* descriptor();
   static const CMD_Directory_ListServers& default_instance();
 
@@ -1649,6 +2208,7 @@ class CMD_Directory_ListServers : public ::google::protobuf::Message /* @@protoc
                &_CMD_Directory_ListServers_default_instance_);
   }
 
+  void UnsafeArenaSwap(CMD_Directory_ListServers* other);
   void Swap(CMD_Directory_ListServers* other);
 
   // implements Message ----------------------------------------------
@@ -1681,12 +2241,17 @@ class CMD_Directory_ListServers : public ::google::protobuf::Message /* @@protoc
   void SharedDtor();
   void SetCachedSize(int size) const PROTOBUF_FINAL;
   void InternalSwap(CMD_Directory_ListServers* other);
+  protected:
+  explicit CMD_Directory_ListServers(::google::protobuf::Arena* arena);
+  private:
+  static void ArenaDtor(void* object);
+  inline void RegisterArenaDtor(::google::protobuf::Arena* arena);
   private:
   inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
+    return _internal_metadata_.arena();
   }
   inline void* MaybeArenaPtr() const {
-    return NULL;
+    return _internal_metadata_.raw_arena_ptr();
   }
   public:
 
@@ -1700,6 +2265,9 @@ class CMD_Directory_ListServers : public ::google::protobuf::Message /* @@protoc
  private:
 
   ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
+  friend class ::google::protobuf::Arena;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
   mutable int _cached_size_;
   friend struct  protobuf_Commands_2eproto::TableStruct;
 };
@@ -1717,6 +2285,12 @@ class CMD_Login_Signup : public ::google::protobuf::Message /* @@protoc_insertio
     return *this;
   }
 
+  inline ::google::protobuf::Arena* GetArena() const PROTOBUF_FINAL {
+    return GetArenaNoVirtual();
+  }
+  inline void* GetMaybeArenaPointer() const PROTOBUF_FINAL {
+    return MaybeArenaPtr();
+  }
   static const ::google::protobuf::Descriptor* descriptor();
   static const CMD_Login_Signup& default_instance();
 
@@ -1725,6 +2299,7 @@ class CMD_Login_Signup : public ::google::protobuf::Message /* @@protoc_insertio
                &_CMD_Login_Signup_default_instance_);
   }
 
+  void UnsafeArenaSwap(CMD_Login_Signup* other);
   void Swap(CMD_Login_Signup* other);
 
   // implements Message ----------------------------------------------
@@ -1757,12 +2332,17 @@ class CMD_Login_Signup : public ::google::protobuf::Message /* @@protoc_insertio
   void SharedDtor();
   void SetCachedSize(int size) const PROTOBUF_FINAL;
   void InternalSwap(CMD_Login_Signup* other);
+  protected:
+  explicit CMD_Login_Signup(::google::protobuf::Arena* arena);
+  private:
+  static void ArenaDtor(void* object);
+  inline void RegisterArenaDtor(::google::protobuf::Arena* arena);
   private:
   inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
+    return _internal_metadata_.arena();
   }
   inline void* MaybeArenaPtr() const {
-    return NULL;
+    return _internal_metadata_.raw_arena_ptr();
   }
   public:
 
@@ -1777,47 +2357,50 @@ class CMD_Login_Signup : public ::google::protobuf::Message /* @@protoc_insertio
   static const int kCommitAccountNameFieldNumber = 1;
   const ::std::string& commitaccountname() const;
   void set_commitaccountname(const ::std::string& value);
-  #if LANG_CXX11
-  void set_commitaccountname(::std::string&& value);
-  #endif
   void set_commitaccountname(const char* value);
   void set_commitaccountname(const char* value, size_t size);
   ::std::string* mutable_commitaccountname();
   ::std::string* release_commitaccountname();
   void set_allocated_commitaccountname(::std::string* commitaccountname);
+  ::std::string* unsafe_arena_release_commitaccountname();
+  void unsafe_arena_set_allocated_commitaccountname(
+      ::std::string* commitaccountname);
 
   // string password = 2;
   void clear_password();
   static const int kPasswordFieldNumber = 2;
   const ::std::string& password() const;
   void set_password(const ::std::string& value);
-  #if LANG_CXX11
-  void set_password(::std::string&& value);
-  #endif
   void set_password(const char* value);
   void set_password(const char* value, size_t size);
   ::std::string* mutable_password();
   ::std::string* release_password();
   void set_allocated_password(::std::string* password);
+  ::std::string* unsafe_arena_release_password();
+  void unsafe_arena_set_allocated_password(
+      ::std::string* password);
 
   // bytes datas = 3;
   void clear_datas();
   static const int kDatasFieldNumber = 3;
   const ::std::string& datas() const;
   void set_datas(const ::std::string& value);
-  #if LANG_CXX11
-  void set_datas(::std::string&& value);
-  #endif
   void set_datas(const char* value);
   void set_datas(const void* value, size_t size);
   ::std::string* mutable_datas();
   ::std::string* release_datas();
   void set_allocated_datas(::std::string* datas);
+  ::std::string* unsafe_arena_release_datas();
+  void unsafe_arena_set_allocated_datas(
+      ::std::string* datas);
 
   // @@protoc_insertion_point(class_scope:CMD_Login_Signup)
  private:
 
   ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
+  friend class ::google::protobuf::Arena;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
   ::google::protobuf::internal::ArenaStringPtr commitaccountname_;
   ::google::protobuf::internal::ArenaStringPtr password_;
   ::google::protobuf::internal::ArenaStringPtr datas_;
@@ -1838,6 +2421,12 @@ class CMD_Login_OnSignupCB : public ::google::protobuf::Message /* @@protoc_inse
     return *this;
   }
 
+  inline ::google::protobuf::Arena* GetArena() const PROTOBUF_FINAL {
+    return GetArenaNoVirtual();
+  }
+  inline void* GetMaybeArenaPointer() const PROTOBUF_FINAL {
+    return MaybeArenaPtr();
+  }
   static const ::google::protobuf::Descriptor* descriptor();
   static const CMD_Login_OnSignupCB& default_instance();
 
@@ -1846,6 +2435,7 @@ class CMD_Login_OnSignupCB : public ::google::protobuf::Message /* @@protoc_inse
                &_CMD_Login_OnSignupCB_default_instance_);
   }
 
+  void UnsafeArenaSwap(CMD_Login_OnSignupCB* other);
   void Swap(CMD_Login_OnSignupCB* other);
 
   // implements Message ----------------------------------------------
@@ -1878,12 +2468,17 @@ class CMD_Login_OnSignupCB : public ::google::protobuf::Message /* @@protoc_inse
   void SharedDtor();
   void SetCachedSize(int size) const PROTOBUF_FINAL;
   void InternalSwap(CMD_Login_OnSignupCB* other);
+  protected:
+  explicit CMD_Login_OnSignupCB(::google::protobuf::Arena* arena);
+  private:
+  static void ArenaDtor(void* object);
+  inline void RegisterArenaDtor(::google::protobuf::Arena* arena);
   private:
   inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
+    return _internal_metadata_.arena();
   }
   inline void* MaybeArenaPtr() const {
-    return NULL;
+    return _internal_metadata_.raw_arena_ptr();
   }
   public:
 
@@ -1898,42 +2493,42 @@ class CMD_Login_OnSignupCB : public ::google::protobuf::Message /* @@protoc_inse
   static const int kCommitAccountNameFieldNumber = 2;
   const ::std::string& commitaccountname() const;
   void set_commitaccountname(const ::std::string& value);
-  #if LANG_CXX11
-  void set_commitaccountname(::std::string&& value);
-  #endif
   void set_commitaccountname(const char* value);
   void set_commitaccountname(const char* value, size_t size);
   ::std::string* mutable_commitaccountname();
   ::std::string* release_commitaccountname();
   void set_allocated_commitaccountname(::std::string* commitaccountname);
+  ::std::string* unsafe_arena_release_commitaccountname();
+  void unsafe_arena_set_allocated_commitaccountname(
+      ::std::string* commitaccountname);
 
   // string realAccountName = 3;
   void clear_realaccountname();
   static const int kRealAccountNameFieldNumber = 3;
   const ::std::string& realaccountname() const;
   void set_realaccountname(const ::std::string& value);
-  #if LANG_CXX11
-  void set_realaccountname(::std::string&& value);
-  #endif
   void set_realaccountname(const char* value);
   void set_realaccountname(const char* value, size_t size);
   ::std::string* mutable_realaccountname();
   ::std::string* release_realaccountname();
   void set_allocated_realaccountname(::std::string* realaccountname);
+  ::std::string* unsafe_arena_release_realaccountname();
+  void unsafe_arena_set_allocated_realaccountname(
+      ::std::string* realaccountname);
 
   // bytes datas = 4;
   void clear_datas();
   static const int kDatasFieldNumber = 4;
   const ::std::string& datas() const;
   void set_datas(const ::std::string& value);
-  #if LANG_CXX11
-  void set_datas(::std::string&& value);
-  #endif
   void set_datas(const char* value);
   void set_datas(const void* value, size_t size);
   ::std::string* mutable_datas();
   ::std::string* release_datas();
   void set_allocated_datas(::std::string* datas);
+  ::std::string* unsafe_arena_release_datas();
+  void unsafe_arena_set_allocated_datas(
+      ::std::string* datas);
 
   // .ServerError errcode = 1;
   void clear_errcode();
@@ -1945,6 +2540,9 @@ class CMD_Login_OnSignupCB : public ::google::protobuf::Message /* @@protoc_inse
  private:
 
   ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
+  friend class ::google::protobuf::Arena;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
   ::google::protobuf::internal::ArenaStringPtr commitaccountname_;
   ::google::protobuf::internal::ArenaStringPtr realaccountname_;
   ::google::protobuf::internal::ArenaStringPtr datas_;
@@ -1966,6 +2564,12 @@ class CMD_Login_Signin : public ::google::protobuf::Message /* @@protoc_insertio
     return *this;
   }
 
+  inline ::google::protobuf::Arena* GetArena() const PROTOBUF_FINAL {
+    return GetArenaNoVirtual();
+  }
+  inline void* GetMaybeArenaPointer() const PROTOBUF_FINAL {
+    return MaybeArenaPtr();
+  }
   static const ::google::protobuf::Descriptor* descriptor();
   static const CMD_Login_Signin& default_instance();
 
@@ -1974,6 +2578,7 @@ class CMD_Login_Signin : public ::google::protobuf::Message /* @@protoc_insertio
                &_CMD_Login_Signin_default_instance_);
   }
 
+  void UnsafeArenaSwap(CMD_Login_Signin* other);
   void Swap(CMD_Login_Signin* other);
 
   // implements Message ----------------------------------------------
@@ -2006,12 +2611,17 @@ class CMD_Login_Signin : public ::google::protobuf::Message /* @@protoc_insertio
   void SharedDtor();
   void SetCachedSize(int size) const PROTOBUF_FINAL;
   void InternalSwap(CMD_Login_Signin* other);
+  protected:
+  explicit CMD_Login_Signin(::google::protobuf::Arena* arena);
+  private:
+  static void ArenaDtor(void* object);
+  inline void RegisterArenaDtor(::google::protobuf::Arena* arena);
   private:
   inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
+    return _internal_metadata_.arena();
   }
   inline void* MaybeArenaPtr() const {
-    return NULL;
+    return _internal_metadata_.raw_arena_ptr();
   }
   public:
 
@@ -2026,47 +2636,50 @@ class CMD_Login_Signin : public ::google::protobuf::Message /* @@protoc_insertio
   static const int kCommitAccountNameFieldNumber = 1;
   const ::std::string& commitaccountname() const;
   void set_commitaccountname(const ::std::string& value);
-  #if LANG_CXX11
-  void set_commitaccountname(::std::string&& value);
-  #endif
   void set_commitaccountname(const char* value);
   void set_commitaccountname(const char* value, size_t size);
   ::std::string* mutable_commitaccountname();
   ::std::string* release_commitaccountname();
   void set_allocated_commitaccountname(::std::string* commitaccountname);
+  ::std::string* unsafe_arena_release_commitaccountname();
+  void unsafe_arena_set_allocated_commitaccountname(
+      ::std::string* commitaccountname);
 
   // string password = 2;
   void clear_password();
   static const int kPasswordFieldNumber = 2;
   const ::std::string& password() const;
   void set_password(const ::std::string& value);
-  #if LANG_CXX11
-  void set_password(::std::string&& value);
-  #endif
   void set_password(const char* value);
   void set_password(const char* value, size_t size);
   ::std::string* mutable_password();
   ::std::string* release_password();
   void set_allocated_password(::std::string* password);
+  ::std::string* unsafe_arena_release_password();
+  void unsafe_arena_set_allocated_password(
+      ::std::string* password);
 
   // bytes datas = 3;
   void clear_datas();
   static const int kDatasFieldNumber = 3;
   const ::std::string& datas() const;
   void set_datas(const ::std::string& value);
-  #if LANG_CXX11
-  void set_datas(::std::string&& value);
-  #endif
   void set_datas(const char* value);
   void set_datas(const void* value, size_t size);
   ::std::string* mutable_datas();
   ::std::string* release_datas();
   void set_allocated_datas(::std::string* datas);
+  ::std::string* unsafe_arena_release_datas();
+  void unsafe_arena_set_allocated_datas(
+      ::std::string* datas);
 
   // @@protoc_insertion_point(class_scope:CMD_Login_Signin)
  private:
 
   ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
+  friend class ::google::protobuf::Arena;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
   ::google::protobuf::internal::ArenaStringPtr commitaccountname_;
   ::google::protobuf::internal::ArenaStringPtr password_;
   ::google::protobuf::internal::ArenaStringPtr datas_;
@@ -2087,6 +2700,12 @@ class CMD_Login_OnSigninCB : public ::google::protobuf::Message /* @@protoc_inse
     return *this;
   }
 
+  inline ::google::protobuf::Arena* GetArena() const PROTOBUF_FINAL {
+    return GetArenaNoVirtual();
+  }
+  inline void* GetMaybeArenaPointer() const PROTOBUF_FINAL {
+    return MaybeArenaPtr();
+  }
   static const ::google::protobuf::Descriptor* descriptor();
   static const CMD_Login_OnSigninCB& default_instance();
 
@@ -2095,6 +2714,7 @@ class CMD_Login_OnSigninCB : public ::google::protobuf::Message /* @@protoc_inse
                &_CMD_Login_OnSigninCB_default_instance_);
   }
 
+  void UnsafeArenaSwap(CMD_Login_OnSigninCB* other);
   void Swap(CMD_Login_OnSigninCB* other);
 
   // implements Message ----------------------------------------------
@@ -2127,12 +2747,17 @@ class CMD_Login_OnSigninCB : public ::google::protobuf::Message /* @@protoc_inse
   void SharedDtor();
   void SetCachedSize(int size) const PROTOBUF_FINAL;
   void InternalSwap(CMD_Login_OnSigninCB* other);
+  protected:
+  explicit CMD_Login_OnSigninCB(::google::protobuf::Arena* arena);
+  private:
+  static void ArenaDtor(void* object);
+  inline void RegisterArenaDtor(::google::protobuf::Arena* arena);
   private:
   inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
+    return _internal_metadata_.arena();
   }
   inline void* MaybeArenaPtr() const {
-    return NULL;
+    return _internal_metadata_.raw_arena_ptr();
   }
   public:
 
@@ -2147,42 +2772,42 @@ class CMD_Login_OnSigninCB : public ::google::protobuf::Message /* @@protoc_inse
   static const int kCommitAccountNameFieldNumber = 2;
   const ::std::string& commitaccountname() const;
   void set_commitaccountname(const ::std::string& value);
-  #if LANG_CXX11
-  void set_commitaccountname(::std::string&& value);
-  #endif
   void set_commitaccountname(const char* value);
   void set_commitaccountname(const char* value, size_t size);
   ::std::string* mutable_commitaccountname();
   ::std::string* release_commitaccountname();
   void set_allocated_commitaccountname(::std::string* commitaccountname);
+  ::std::string* unsafe_arena_release_commitaccountname();
+  void unsafe_arena_set_allocated_commitaccountname(
+      ::std::string* commitaccountname);
 
   // string realAccountName = 3;
   void clear_realaccountname();
   static const int kRealAccountNameFieldNumber = 3;
   const ::std::string& realaccountname() const;
   void set_realaccountname(const ::std::string& value);
-  #if LANG_CXX11
-  void set_realaccountname(::std::string&& value);
-  #endif
   void set_realaccountname(const char* value);
   void set_realaccountname(const char* value, size_t size);
   ::std::string* mutable_realaccountname();
   ::std::string* release_realaccountname();
   void set_allocated_realaccountname(::std::string* realaccountname);
+  ::std::string* unsafe_arena_release_realaccountname();
+  void unsafe_arena_set_allocated_realaccountname(
+      ::std::string* realaccountname);
 
   // bytes datas = 4;
   void clear_datas();
   static const int kDatasFieldNumber = 4;
   const ::std::string& datas() const;
   void set_datas(const ::std::string& value);
-  #if LANG_CXX11
-  void set_datas(::std::string&& value);
-  #endif
   void set_datas(const char* value);
   void set_datas(const void* value, size_t size);
   ::std::string* mutable_datas();
   ::std::string* release_datas();
   void set_allocated_datas(::std::string* datas);
+  ::std::string* unsafe_arena_release_datas();
+  void unsafe_arena_set_allocated_datas(
+      ::std::string* datas);
 
   // uint64 foundObjectID = 5;
   void clear_foundobjectid();
@@ -2196,6 +2821,12 @@ class CMD_Login_OnSigninCB : public ::google::protobuf::Message /* @@protoc_inse
   ::google::protobuf::uint64 foundappid() const;
   void set_foundappid(::google::protobuf::uint64 value);
 
+  // uint64 hallsID = 7;
+  void clear_hallsid();
+  static const int kHallsIDFieldNumber = 7;
+  ::google::protobuf::uint64 hallsid() const;
+  void set_hallsid(::google::protobuf::uint64 value);
+
   // .ServerError errcode = 1;
   void clear_errcode();
   static const int kErrcodeFieldNumber = 1;
@@ -2206,11 +2837,15 @@ class CMD_Login_OnSigninCB : public ::google::protobuf::Message /* @@protoc_inse
  private:
 
   ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
+  friend class ::google::protobuf::Arena;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
   ::google::protobuf::internal::ArenaStringPtr commitaccountname_;
   ::google::protobuf::internal::ArenaStringPtr realaccountname_;
   ::google::protobuf::internal::ArenaStringPtr datas_;
   ::google::protobuf::uint64 foundobjectid_;
   ::google::protobuf::uint64 foundappid_;
+  ::google::protobuf::uint64 hallsid_;
   int errcode_;
   mutable int _cached_size_;
   friend struct  protobuf_Commands_2eproto::TableStruct;
@@ -2229,6 +2864,12 @@ class CMD_Login_OnRequestAllocClientCB : public ::google::protobuf::Message /* @
     return *this;
   }
 
+  inline ::google::protobuf::Arena* GetArena() const PROTOBUF_FINAL {
+    return GetArenaNoVirtual();
+  }
+  inline void* GetMaybeArenaPointer() const PROTOBUF_FINAL {
+    return MaybeArenaPtr();
+  }
   static const ::google::protobuf::Descriptor* descriptor();
   static const CMD_Login_OnRequestAllocClientCB& default_instance();
 
@@ -2237,6 +2878,7 @@ class CMD_Login_OnRequestAllocClientCB : public ::google::protobuf::Message /* @
                &_CMD_Login_OnRequestAllocClientCB_default_instance_);
   }
 
+  void UnsafeArenaSwap(CMD_Login_OnRequestAllocClientCB* other);
   void Swap(CMD_Login_OnRequestAllocClientCB* other);
 
   // implements Message ----------------------------------------------
@@ -2269,12 +2911,17 @@ class CMD_Login_OnRequestAllocClientCB : public ::google::protobuf::Message /* @
   void SharedDtor();
   void SetCachedSize(int size) const PROTOBUF_FINAL;
   void InternalSwap(CMD_Login_OnRequestAllocClientCB* other);
+  protected:
+  explicit CMD_Login_OnRequestAllocClientCB(::google::protobuf::Arena* arena);
+  private:
+  static void ArenaDtor(void* object);
+  inline void RegisterArenaDtor(::google::protobuf::Arena* arena);
   private:
   inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
+    return _internal_metadata_.arena();
   }
   inline void* MaybeArenaPtr() const {
-    return NULL;
+    return _internal_metadata_.raw_arena_ptr();
   }
   public:
 
@@ -2289,28 +2936,28 @@ class CMD_Login_OnRequestAllocClientCB : public ::google::protobuf::Message /* @
   static const int kIpFieldNumber = 1;
   const ::std::string& ip() const;
   void set_ip(const ::std::string& value);
-  #if LANG_CXX11
-  void set_ip(::std::string&& value);
-  #endif
   void set_ip(const char* value);
   void set_ip(const char* value, size_t size);
   ::std::string* mutable_ip();
   ::std::string* release_ip();
   void set_allocated_ip(::std::string* ip);
+  ::std::string* unsafe_arena_release_ip();
+  void unsafe_arena_set_allocated_ip(
+      ::std::string* ip);
 
   // string commitAccountName = 3;
   void clear_commitaccountname();
   static const int kCommitAccountNameFieldNumber = 3;
   const ::std::string& commitaccountname() const;
   void set_commitaccountname(const ::std::string& value);
-  #if LANG_CXX11
-  void set_commitaccountname(::std::string&& value);
-  #endif
   void set_commitaccountname(const char* value);
   void set_commitaccountname(const char* value, size_t size);
   ::std::string* mutable_commitaccountname();
   ::std::string* release_commitaccountname();
   void set_allocated_commitaccountname(::std::string* commitaccountname);
+  ::std::string* unsafe_arena_release_commitaccountname();
+  void unsafe_arena_set_allocated_commitaccountname(
+      ::std::string* commitaccountname);
 
   // int32 port = 2;
   void clear_port();
@@ -2330,15 +2977,25 @@ class CMD_Login_OnRequestAllocClientCB : public ::google::protobuf::Message /* @
   ::google::protobuf::uint64 tokenid() const;
   void set_tokenid(::google::protobuf::uint64 value);
 
+  // uint64 hallsID = 6;
+  void clear_hallsid();
+  static const int kHallsIDFieldNumber = 6;
+  ::google::protobuf::uint64 hallsid() const;
+  void set_hallsid(::google::protobuf::uint64 value);
+
   // @@protoc_insertion_point(class_scope:CMD_Login_OnRequestAllocClientCB)
  private:
 
   ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
+  friend class ::google::protobuf::Arena;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
   ::google::protobuf::internal::ArenaStringPtr ip_;
   ::google::protobuf::internal::ArenaStringPtr commitaccountname_;
   ::google::protobuf::int32 port_;
   int errcode_;
   ::google::protobuf::uint64 tokenid_;
+  ::google::protobuf::uint64 hallsid_;
   mutable int _cached_size_;
   friend struct  protobuf_Commands_2eproto::TableStruct;
 };
@@ -2356,6 +3013,12 @@ class CMD_Dbmgr_WriteAccount : public ::google::protobuf::Message /* @@protoc_in
     return *this;
   }
 
+  inline ::google::protobuf::Arena* GetArena() const PROTOBUF_FINAL {
+    return GetArenaNoVirtual();
+  }
+  inline void* GetMaybeArenaPointer() const PROTOBUF_FINAL {
+    return MaybeArenaPtr();
+  }
   static const ::google::protobuf::Descriptor* descriptor();
   static const CMD_Dbmgr_WriteAccount& default_instance();
 
@@ -2364,6 +3027,7 @@ class CMD_Dbmgr_WriteAccount : public ::google::protobuf::Message /* @@protoc_in
                &_CMD_Dbmgr_WriteAccount_default_instance_);
   }
 
+  void UnsafeArenaSwap(CMD_Dbmgr_WriteAccount* other);
   void Swap(CMD_Dbmgr_WriteAccount* other);
 
   // implements Message ----------------------------------------------
@@ -2396,12 +3060,17 @@ class CMD_Dbmgr_WriteAccount : public ::google::protobuf::Message /* @@protoc_in
   void SharedDtor();
   void SetCachedSize(int size) const PROTOBUF_FINAL;
   void InternalSwap(CMD_Dbmgr_WriteAccount* other);
+  protected:
+  explicit CMD_Dbmgr_WriteAccount(::google::protobuf::Arena* arena);
+  private:
+  static void ArenaDtor(void* object);
+  inline void RegisterArenaDtor(::google::protobuf::Arena* arena);
   private:
   inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
+    return _internal_metadata_.arena();
   }
   inline void* MaybeArenaPtr() const {
-    return NULL;
+    return _internal_metadata_.raw_arena_ptr();
   }
   public:
 
@@ -2416,56 +3085,56 @@ class CMD_Dbmgr_WriteAccount : public ::google::protobuf::Message /* @@protoc_in
   static const int kCommitAccountNameFieldNumber = 2;
   const ::std::string& commitaccountname() const;
   void set_commitaccountname(const ::std::string& value);
-  #if LANG_CXX11
-  void set_commitaccountname(::std::string&& value);
-  #endif
   void set_commitaccountname(const char* value);
   void set_commitaccountname(const char* value, size_t size);
   ::std::string* mutable_commitaccountname();
   ::std::string* release_commitaccountname();
   void set_allocated_commitaccountname(::std::string* commitaccountname);
+  ::std::string* unsafe_arena_release_commitaccountname();
+  void unsafe_arena_set_allocated_commitaccountname(
+      ::std::string* commitaccountname);
 
   // string password = 3;
   void clear_password();
   static const int kPasswordFieldNumber = 3;
   const ::std::string& password() const;
   void set_password(const ::std::string& value);
-  #if LANG_CXX11
-  void set_password(::std::string&& value);
-  #endif
   void set_password(const char* value);
   void set_password(const char* value, size_t size);
   ::std::string* mutable_password();
   ::std::string* release_password();
   void set_allocated_password(::std::string* password);
+  ::std::string* unsafe_arena_release_password();
+  void unsafe_arena_set_allocated_password(
+      ::std::string* password);
 
   // bytes datas = 4;
   void clear_datas();
   static const int kDatasFieldNumber = 4;
   const ::std::string& datas() const;
   void set_datas(const ::std::string& value);
-  #if LANG_CXX11
-  void set_datas(::std::string&& value);
-  #endif
   void set_datas(const char* value);
   void set_datas(const void* value, size_t size);
   ::std::string* mutable_datas();
   ::std::string* release_datas();
   void set_allocated_datas(::std::string* datas);
+  ::std::string* unsafe_arena_release_datas();
+  void unsafe_arena_set_allocated_datas(
+      ::std::string* datas);
 
   // string playerName = 5;
   void clear_playername();
   static const int kPlayerNameFieldNumber = 5;
   const ::std::string& playername() const;
   void set_playername(const ::std::string& value);
-  #if LANG_CXX11
-  void set_playername(::std::string&& value);
-  #endif
   void set_playername(const char* value);
   void set_playername(const char* value, size_t size);
   ::std::string* mutable_playername();
   ::std::string* release_playername();
   void set_allocated_playername(::std::string* playername);
+  ::std::string* unsafe_arena_release_playername();
+  void unsafe_arena_set_allocated_playername(
+      ::std::string* playername);
 
   // uint64 appID = 1;
   void clear_appid();
@@ -2495,6 +3164,9 @@ class CMD_Dbmgr_WriteAccount : public ::google::protobuf::Message /* @@protoc_in
  private:
 
   ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
+  friend class ::google::protobuf::Arena;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
   ::google::protobuf::internal::ArenaStringPtr commitaccountname_;
   ::google::protobuf::internal::ArenaStringPtr password_;
   ::google::protobuf::internal::ArenaStringPtr datas_;
@@ -2520,6 +3192,12 @@ class CMD_Dbmgr_QueryAccount : public ::google::protobuf::Message /* @@protoc_in
     return *this;
   }
 
+  inline ::google::protobuf::Arena* GetArena() const PROTOBUF_FINAL {
+    return GetArenaNoVirtual();
+  }
+  inline void* GetMaybeArenaPointer() const PROTOBUF_FINAL {
+    return MaybeArenaPtr();
+  }
   static const ::google::protobuf::Descriptor* descriptor();
   static const CMD_Dbmgr_QueryAccount& default_instance();
 
@@ -2528,6 +3206,7 @@ class CMD_Dbmgr_QueryAccount : public ::google::protobuf::Message /* @@protoc_in
                &_CMD_Dbmgr_QueryAccount_default_instance_);
   }
 
+  void UnsafeArenaSwap(CMD_Dbmgr_QueryAccount* other);
   void Swap(CMD_Dbmgr_QueryAccount* other);
 
   // implements Message ----------------------------------------------
@@ -2560,12 +3239,17 @@ class CMD_Dbmgr_QueryAccount : public ::google::protobuf::Message /* @@protoc_in
   void SharedDtor();
   void SetCachedSize(int size) const PROTOBUF_FINAL;
   void InternalSwap(CMD_Dbmgr_QueryAccount* other);
+  protected:
+  explicit CMD_Dbmgr_QueryAccount(::google::protobuf::Arena* arena);
+  private:
+  static void ArenaDtor(void* object);
+  inline void RegisterArenaDtor(::google::protobuf::Arena* arena);
   private:
   inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
+    return _internal_metadata_.arena();
   }
   inline void* MaybeArenaPtr() const {
-    return NULL;
+    return _internal_metadata_.raw_arena_ptr();
   }
   public:
 
@@ -2580,42 +3264,42 @@ class CMD_Dbmgr_QueryAccount : public ::google::protobuf::Message /* @@protoc_in
   static const int kCommitAccountNameFieldNumber = 1;
   const ::std::string& commitaccountname() const;
   void set_commitaccountname(const ::std::string& value);
-  #if LANG_CXX11
-  void set_commitaccountname(::std::string&& value);
-  #endif
   void set_commitaccountname(const char* value);
   void set_commitaccountname(const char* value, size_t size);
   ::std::string* mutable_commitaccountname();
   ::std::string* release_commitaccountname();
   void set_allocated_commitaccountname(::std::string* commitaccountname);
+  ::std::string* unsafe_arena_release_commitaccountname();
+  void unsafe_arena_set_allocated_commitaccountname(
+      ::std::string* commitaccountname);
 
   // string password = 2;
   void clear_password();
   static const int kPasswordFieldNumber = 2;
   const ::std::string& password() const;
   void set_password(const ::std::string& value);
-  #if LANG_CXX11
-  void set_password(::std::string&& value);
-  #endif
   void set_password(const char* value);
   void set_password(const char* value, size_t size);
   ::std::string* mutable_password();
   ::std::string* release_password();
   void set_allocated_password(::std::string* password);
+  ::std::string* unsafe_arena_release_password();
+  void unsafe_arena_set_allocated_password(
+      ::std::string* password);
 
   // string datas = 5;
   void clear_datas();
   static const int kDatasFieldNumber = 5;
   const ::std::string& datas() const;
   void set_datas(const ::std::string& value);
-  #if LANG_CXX11
-  void set_datas(::std::string&& value);
-  #endif
   void set_datas(const char* value);
   void set_datas(const char* value, size_t size);
   ::std::string* mutable_datas();
   ::std::string* release_datas();
   void set_allocated_datas(::std::string* datas);
+  ::std::string* unsafe_arena_release_datas();
+  void unsafe_arena_set_allocated_datas(
+      ::std::string* datas);
 
   // uint64 queryAppID = 3;
   void clear_queryappid();
@@ -2639,6 +3323,9 @@ class CMD_Dbmgr_QueryAccount : public ::google::protobuf::Message /* @@protoc_in
  private:
 
   ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
+  friend class ::google::protobuf::Arena;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
   ::google::protobuf::internal::ArenaStringPtr commitaccountname_;
   ::google::protobuf::internal::ArenaStringPtr password_;
   ::google::protobuf::internal::ArenaStringPtr datas_;
@@ -2662,6 +3349,12 @@ class CMD_Dbmgr_UpdateAccountData : public ::google::protobuf::Message /* @@prot
     return *this;
   }
 
+  inline ::google::protobuf::Arena* GetArena() const PROTOBUF_FINAL {
+    return GetArenaNoVirtual();
+  }
+  inline void* GetMaybeArenaPointer() const PROTOBUF_FINAL {
+    return MaybeArenaPtr();
+  }
   static const ::google::protobuf::Descriptor* descriptor();
   static const CMD_Dbmgr_UpdateAccountData& default_instance();
 
@@ -2670,6 +3363,7 @@ class CMD_Dbmgr_UpdateAccountData : public ::google::protobuf::Message /* @@prot
                &_CMD_Dbmgr_UpdateAccountData_default_instance_);
   }
 
+  void UnsafeArenaSwap(CMD_Dbmgr_UpdateAccountData* other);
   void Swap(CMD_Dbmgr_UpdateAccountData* other);
 
   // implements Message ----------------------------------------------
@@ -2702,12 +3396,17 @@ class CMD_Dbmgr_UpdateAccountData : public ::google::protobuf::Message /* @@prot
   void SharedDtor();
   void SetCachedSize(int size) const PROTOBUF_FINAL;
   void InternalSwap(CMD_Dbmgr_UpdateAccountData* other);
+  protected:
+  explicit CMD_Dbmgr_UpdateAccountData(::google::protobuf::Arena* arena);
+  private:
+  static void ArenaDtor(void* object);
+  inline void RegisterArenaDtor(::google::protobuf::Arena* arena);
   private:
   inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
+    return _internal_metadata_.arena();
   }
   inline void* MaybeArenaPtr() const {
-    return NULL;
+    return _internal_metadata_.raw_arena_ptr();
   }
   public:
 
@@ -2722,28 +3421,28 @@ class CMD_Dbmgr_UpdateAccountData : public ::google::protobuf::Message /* @@prot
   static const int kCommitAccountNameFieldNumber = 1;
   const ::std::string& commitaccountname() const;
   void set_commitaccountname(const ::std::string& value);
-  #if LANG_CXX11
-  void set_commitaccountname(::std::string&& value);
-  #endif
   void set_commitaccountname(const char* value);
   void set_commitaccountname(const char* value, size_t size);
   ::std::string* mutable_commitaccountname();
   ::std::string* release_commitaccountname();
   void set_allocated_commitaccountname(::std::string* commitaccountname);
+  ::std::string* unsafe_arena_release_commitaccountname();
+  void unsafe_arena_set_allocated_commitaccountname(
+      ::std::string* commitaccountname);
 
   // string playerName = 2;
   void clear_playername();
   static const int kPlayerNameFieldNumber = 2;
   const ::std::string& playername() const;
   void set_playername(const ::std::string& value);
-  #if LANG_CXX11
-  void set_playername(::std::string&& value);
-  #endif
   void set_playername(const char* value);
   void set_playername(const char* value, size_t size);
   ::std::string* mutable_playername();
   ::std::string* release_playername();
   void set_allocated_playername(::std::string* playername);
+  ::std::string* unsafe_arena_release_playername();
+  void unsafe_arena_set_allocated_playername(
+      ::std::string* playername);
 
   // int32 modelID = 3;
   void clear_modelid();
@@ -2767,6 +3466,9 @@ class CMD_Dbmgr_UpdateAccountData : public ::google::protobuf::Message /* @@prot
  private:
 
   ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
+  friend class ::google::protobuf::Arena;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
   ::google::protobuf::internal::ArenaStringPtr commitaccountname_;
   ::google::protobuf::internal::ArenaStringPtr playername_;
   ::google::protobuf::int32 modelid_;
@@ -2789,6 +3491,12 @@ class CMD_Dbmgr_WritePlayerGameData : public ::google::protobuf::Message /* @@pr
     return *this;
   }
 
+  inline ::google::protobuf::Arena* GetArena() const PROTOBUF_FINAL {
+    return GetArenaNoVirtual();
+  }
+  inline void* GetMaybeArenaPointer() const PROTOBUF_FINAL {
+    return MaybeArenaPtr();
+  }
   static const ::google::protobuf::Descriptor* descriptor();
   static const CMD_Dbmgr_WritePlayerGameData& default_instance();
 
@@ -2797,6 +3505,7 @@ class CMD_Dbmgr_WritePlayerGameData : public ::google::protobuf::Message /* @@pr
                &_CMD_Dbmgr_WritePlayerGameData_default_instance_);
   }
 
+  void UnsafeArenaSwap(CMD_Dbmgr_WritePlayerGameData* other);
   void Swap(CMD_Dbmgr_WritePlayerGameData* other);
 
   // implements Message ----------------------------------------------
@@ -2829,12 +3538,17 @@ class CMD_Dbmgr_WritePlayerGameData : public ::google::protobuf::Message /* @@pr
   void SharedDtor();
   void SetCachedSize(int size) const PROTOBUF_FINAL;
   void InternalSwap(CMD_Dbmgr_WritePlayerGameData* other);
+  protected:
+  explicit CMD_Dbmgr_WritePlayerGameData(::google::protobuf::Arena* arena);
+  private:
+  static void ArenaDtor(void* object);
+  inline void RegisterArenaDtor(::google::protobuf::Arena* arena);
   private:
   inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
+    return _internal_metadata_.arena();
   }
   inline void* MaybeArenaPtr() const {
-    return NULL;
+    return _internal_metadata_.raw_arena_ptr();
   }
   public:
 
@@ -2890,6 +3604,9 @@ class CMD_Dbmgr_WritePlayerGameData : public ::google::protobuf::Message /* @@pr
  private:
 
   ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
+  friend class ::google::protobuf::Arena;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
   ::google::protobuf::uint64 playerid_;
   ::google::protobuf::int32 score_;
   ::google::protobuf::int32 topscore_;
@@ -2914,6 +3631,12 @@ class CMD_Dbmgr_QueryPlayerGameData : public ::google::protobuf::Message /* @@pr
     return *this;
   }
 
+  inline ::google::protobuf::Arena* GetArena() const PROTOBUF_FINAL {
+    return GetArenaNoVirtual();
+  }
+  inline void* GetMaybeArenaPointer() const PROTOBUF_FINAL {
+    return MaybeArenaPtr();
+  }
   static const ::google::protobuf::Descriptor* descriptor();
   static const CMD_Dbmgr_QueryPlayerGameData& default_instance();
 
@@ -2922,6 +3645,7 @@ class CMD_Dbmgr_QueryPlayerGameData : public ::google::protobuf::Message /* @@pr
                &_CMD_Dbmgr_QueryPlayerGameData_default_instance_);
   }
 
+  void UnsafeArenaSwap(CMD_Dbmgr_QueryPlayerGameData* other);
   void Swap(CMD_Dbmgr_QueryPlayerGameData* other);
 
   // implements Message ----------------------------------------------
@@ -2954,12 +3678,17 @@ class CMD_Dbmgr_QueryPlayerGameData : public ::google::protobuf::Message /* @@pr
   void SharedDtor();
   void SetCachedSize(int size) const PROTOBUF_FINAL;
   void InternalSwap(CMD_Dbmgr_QueryPlayerGameData* other);
+  protected:
+  explicit CMD_Dbmgr_QueryPlayerGameData(::google::protobuf::Arena* arena);
+  private:
+  static void ArenaDtor(void* object);
+  inline void RegisterArenaDtor(::google::protobuf::Arena* arena);
   private:
   inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
+    return _internal_metadata_.arena();
   }
   inline void* MaybeArenaPtr() const {
-    return NULL;
+    return _internal_metadata_.raw_arena_ptr();
   }
   public:
 
@@ -2991,6 +3720,9 @@ class CMD_Dbmgr_QueryPlayerGameData : public ::google::protobuf::Message /* @@pr
  private:
 
   ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
+  friend class ::google::protobuf::Arena;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
   ::google::protobuf::uint64 playerid_;
   ::google::protobuf::uint64 gameid_;
   ::google::protobuf::uint32 gamemode_;
@@ -3011,6 +3743,12 @@ class CMD_Halls_PlayerGameData : public ::google::protobuf::Message /* @@protoc_
     return *this;
   }
 
+  inline ::google::protobuf::Arena* GetArena() const PROTOBUF_FINAL {
+    return GetArenaNoVirtual();
+  }
+  inline void* GetMaybeArenaPointer() const PROTOBUF_FINAL {
+    return MaybeArenaPtr();
+  }
   static const ::google::protobuf::Descriptor* descriptor();
   static const CMD_Halls_PlayerGameData& default_instance();
 
@@ -3019,6 +3757,7 @@ class CMD_Halls_PlayerGameData : public ::google::protobuf::Message /* @@protoc_
                &_CMD_Halls_PlayerGameData_default_instance_);
   }
 
+  void UnsafeArenaSwap(CMD_Halls_PlayerGameData* other);
   void Swap(CMD_Halls_PlayerGameData* other);
 
   // implements Message ----------------------------------------------
@@ -3051,12 +3790,17 @@ class CMD_Halls_PlayerGameData : public ::google::protobuf::Message /* @@protoc_
   void SharedDtor();
   void SetCachedSize(int size) const PROTOBUF_FINAL;
   void InternalSwap(CMD_Halls_PlayerGameData* other);
+  protected:
+  explicit CMD_Halls_PlayerGameData(::google::protobuf::Arena* arena);
+  private:
+  static void ArenaDtor(void* object);
+  inline void RegisterArenaDtor(::google::protobuf::Arena* arena);
   private:
   inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
+    return _internal_metadata_.arena();
   }
   inline void* MaybeArenaPtr() const {
-    return NULL;
+    return _internal_metadata_.raw_arena_ptr();
   }
   public:
 
@@ -3094,6 +3838,9 @@ class CMD_Halls_PlayerGameData : public ::google::protobuf::Message /* @@protoc_
  private:
 
   ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
+  friend class ::google::protobuf::Arena;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
   ::google::protobuf::int32 exp_;
   ::google::protobuf::int32 score_;
   ::google::protobuf::uint64 id_;
@@ -3115,6 +3862,12 @@ class CMD_Halls_Login : public ::google::protobuf::Message /* @@protoc_insertion
     return *this;
   }
 
+  inline ::google::protobuf::Arena* GetArena() const PROTOBUF_FINAL {
+    return GetArenaNoVirtual();
+  }
+  inline void* GetMaybeArenaPointer() const PROTOBUF_FINAL {
+    return MaybeArenaPtr();
+  }
   static const ::google::protobuf::Descriptor* descriptor();
   static const CMD_Halls_Login& default_instance();
 
@@ -3123,6 +3876,7 @@ class CMD_Halls_Login : public ::google::protobuf::Message /* @@protoc_insertion
                &_CMD_Halls_Login_default_instance_);
   }
 
+  void UnsafeArenaSwap(CMD_Halls_Login* other);
   void Swap(CMD_Halls_Login* other);
 
   // implements Message ----------------------------------------------
@@ -3155,12 +3909,17 @@ class CMD_Halls_Login : public ::google::protobuf::Message /* @@protoc_insertion
   void SharedDtor();
   void SetCachedSize(int size) const PROTOBUF_FINAL;
   void InternalSwap(CMD_Halls_Login* other);
+  protected:
+  explicit CMD_Halls_Login(::google::protobuf::Arena* arena);
+  private:
+  static void ArenaDtor(void* object);
+  inline void RegisterArenaDtor(::google::protobuf::Arena* arena);
   private:
   inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
+    return _internal_metadata_.arena();
   }
   inline void* MaybeArenaPtr() const {
-    return NULL;
+    return _internal_metadata_.raw_arena_ptr();
   }
   public:
 
@@ -3175,14 +3934,14 @@ class CMD_Halls_Login : public ::google::protobuf::Message /* @@protoc_insertion
   static const int kCommitAccountNameFieldNumber = 2;
   const ::std::string& commitaccountname() const;
   void set_commitaccountname(const ::std::string& value);
-  #if LANG_CXX11
-  void set_commitaccountname(::std::string&& value);
-  #endif
   void set_commitaccountname(const char* value);
   void set_commitaccountname(const char* value, size_t size);
   ::std::string* mutable_commitaccountname();
   ::std::string* release_commitaccountname();
   void set_allocated_commitaccountname(::std::string* commitaccountname);
+  ::std::string* unsafe_arena_release_commitaccountname();
+  void unsafe_arena_set_allocated_commitaccountname(
+      ::std::string* commitaccountname);
 
   // uint64 tokenID = 1;
   void clear_tokenid();
@@ -3206,6 +3965,9 @@ class CMD_Halls_Login : public ::google::protobuf::Message /* @@protoc_insertion
  private:
 
   ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
+  friend class ::google::protobuf::Arena;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
   ::google::protobuf::internal::ArenaStringPtr commitaccountname_;
   ::google::protobuf::uint64 tokenid_;
   ::google::protobuf::uint64 hallsid_;
@@ -3227,6 +3989,12 @@ class CMD_Halls_RequestAllocClient : public ::google::protobuf::Message /* @@pro
     return *this;
   }
 
+  inline ::google::protobuf::Arena* GetArena() const PROTOBUF_FINAL {
+    return GetArenaNoVirtual();
+  }
+  inline void* GetMaybeArenaPointer() const PROTOBUF_FINAL {
+    return MaybeArenaPtr();
+  }
   static const ::google::protobuf::Descriptor* descriptor();
   static const CMD_Halls_RequestAllocClient& default_instance();
 
@@ -3235,6 +4003,7 @@ class CMD_Halls_RequestAllocClient : public ::google::protobuf::Message /* @@pro
                &_CMD_Halls_RequestAllocClient_default_instance_);
   }
 
+  void UnsafeArenaSwap(CMD_Halls_RequestAllocClient* other);
   void Swap(CMD_Halls_RequestAllocClient* other);
 
   // implements Message ----------------------------------------------
@@ -3267,12 +4036,17 @@ class CMD_Halls_RequestAllocClient : public ::google::protobuf::Message /* @@pro
   void SharedDtor();
   void SetCachedSize(int size) const PROTOBUF_FINAL;
   void InternalSwap(CMD_Halls_RequestAllocClient* other);
+  protected:
+  explicit CMD_Halls_RequestAllocClient(::google::protobuf::Arena* arena);
+  private:
+  static void ArenaDtor(void* object);
+  inline void RegisterArenaDtor(::google::protobuf::Arena* arena);
   private:
   inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
+    return _internal_metadata_.arena();
   }
   inline void* MaybeArenaPtr() const {
-    return NULL;
+    return _internal_metadata_.raw_arena_ptr();
   }
   public:
 
@@ -3287,42 +4061,42 @@ class CMD_Halls_RequestAllocClient : public ::google::protobuf::Message /* @@pro
   static const int kCommitAccountNameFieldNumber = 1;
   const ::std::string& commitaccountname() const;
   void set_commitaccountname(const ::std::string& value);
-  #if LANG_CXX11
-  void set_commitaccountname(::std::string&& value);
-  #endif
   void set_commitaccountname(const char* value);
   void set_commitaccountname(const char* value, size_t size);
   ::std::string* mutable_commitaccountname();
   ::std::string* release_commitaccountname();
   void set_allocated_commitaccountname(::std::string* commitaccountname);
+  ::std::string* unsafe_arena_release_commitaccountname();
+  void unsafe_arena_set_allocated_commitaccountname(
+      ::std::string* commitaccountname);
 
   // string password = 2;
   void clear_password();
   static const int kPasswordFieldNumber = 2;
   const ::std::string& password() const;
   void set_password(const ::std::string& value);
-  #if LANG_CXX11
-  void set_password(::std::string&& value);
-  #endif
   void set_password(const char* value);
   void set_password(const char* value, size_t size);
   ::std::string* mutable_password();
   ::std::string* release_password();
   void set_allocated_password(::std::string* password);
+  ::std::string* unsafe_arena_release_password();
+  void unsafe_arena_set_allocated_password(
+      ::std::string* password);
 
   // bytes datas = 3;
   void clear_datas();
   static const int kDatasFieldNumber = 3;
   const ::std::string& datas() const;
   void set_datas(const ::std::string& value);
-  #if LANG_CXX11
-  void set_datas(::std::string&& value);
-  #endif
   void set_datas(const char* value);
   void set_datas(const void* value, size_t size);
   ::std::string* mutable_datas();
   ::std::string* release_datas();
   void set_allocated_datas(::std::string* datas);
+  ::std::string* unsafe_arena_release_datas();
+  void unsafe_arena_set_allocated_datas(
+      ::std::string* datas);
 
   // uint64 foundObjectID = 4;
   void clear_foundobjectid();
@@ -3340,6 +4114,9 @@ class CMD_Halls_RequestAllocClient : public ::google::protobuf::Message /* @@pro
  private:
 
   ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
+  friend class ::google::protobuf::Arena;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
   ::google::protobuf::internal::ArenaStringPtr commitaccountname_;
   ::google::protobuf::internal::ArenaStringPtr password_;
   ::google::protobuf::internal::ArenaStringPtr datas_;
@@ -3362,6 +4139,12 @@ class CMD_Halls_StartMatch : public ::google::protobuf::Message /* @@protoc_inse
     return *this;
   }
 
+  inline ::google::protobuf::Arena* GetArena() const PROTOBUF_FINAL {
+    return GetArenaNoVirtual();
+  }
+  inline void* GetMaybeArenaPointer() const PROTOBUF_FINAL {
+    return MaybeArenaPtr();
+  }
   static const ::google::protobuf::Descriptor* descriptor();
   static const CMD_Halls_StartMatch& default_instance();
 
@@ -3370,6 +4153,7 @@ class CMD_Halls_StartMatch : public ::google::protobuf::Message /* @@protoc_inse
                &_CMD_Halls_StartMatch_default_instance_);
   }
 
+  void UnsafeArenaSwap(CMD_Halls_StartMatch* other);
   void Swap(CMD_Halls_StartMatch* other);
 
   // implements Message ----------------------------------------------
@@ -3402,12 +4186,17 @@ class CMD_Halls_StartMatch : public ::google::protobuf::Message /* @@protoc_inse
   void SharedDtor();
   void SetCachedSize(int size) const PROTOBUF_FINAL;
   void InternalSwap(CMD_Halls_StartMatch* other);
+  protected:
+  explicit CMD_Halls_StartMatch(::google::protobuf::Arena* arena);
+  private:
+  static void ArenaDtor(void* object);
+  inline void RegisterArenaDtor(::google::protobuf::Arena* arena);
   private:
   inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
+    return _internal_metadata_.arena();
   }
   inline void* MaybeArenaPtr() const {
-    return NULL;
+    return _internal_metadata_.raw_arena_ptr();
   }
   public:
 
@@ -3433,6 +4222,9 @@ class CMD_Halls_StartMatch : public ::google::protobuf::Message /* @@protoc_inse
  private:
 
   ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
+  friend class ::google::protobuf::Arena;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
   ::google::protobuf::uint64 gameid_;
   ::google::protobuf::int32 gamemode_;
   mutable int _cached_size_;
@@ -3452,6 +4244,12 @@ class CMD_Halls_CancelMatch : public ::google::protobuf::Message /* @@protoc_ins
     return *this;
   }
 
+  inline ::google::protobuf::Arena* GetArena() const PROTOBUF_FINAL {
+    return GetArenaNoVirtual();
+  }
+  inline void* GetMaybeArenaPointer() const PROTOBUF_FINAL {
+    return MaybeArenaPtr();
+  }
   static const ::google::protobuf::Descriptor* descriptor();
   static const CMD_Halls_CancelMatch& default_instance();
 
@@ -3460,6 +4258,7 @@ class CMD_Halls_CancelMatch : public ::google::protobuf::Message /* @@protoc_ins
                &_CMD_Halls_CancelMatch_default_instance_);
   }
 
+  void UnsafeArenaSwap(CMD_Halls_CancelMatch* other);
   void Swap(CMD_Halls_CancelMatch* other);
 
   // implements Message ----------------------------------------------
@@ -3492,12 +4291,17 @@ class CMD_Halls_CancelMatch : public ::google::protobuf::Message /* @@protoc_ins
   void SharedDtor();
   void SetCachedSize(int size) const PROTOBUF_FINAL;
   void InternalSwap(CMD_Halls_CancelMatch* other);
+  protected:
+  explicit CMD_Halls_CancelMatch(::google::protobuf::Arena* arena);
+  private:
+  static void ArenaDtor(void* object);
+  inline void RegisterArenaDtor(::google::protobuf::Arena* arena);
   private:
   inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
+    return _internal_metadata_.arena();
   }
   inline void* MaybeArenaPtr() const {
-    return NULL;
+    return _internal_metadata_.raw_arena_ptr();
   }
   public:
 
@@ -3511,6 +4315,9 @@ class CMD_Halls_CancelMatch : public ::google::protobuf::Message /* @@protoc_ins
  private:
 
   ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
+  friend class ::google::protobuf::Arena;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
   mutable int _cached_size_;
   friend struct  protobuf_Commands_2eproto::TableStruct;
 };
@@ -3528,6 +4335,12 @@ class CMD_Halls_OnRequestCreateRoomCB : public ::google::protobuf::Message /* @@
     return *this;
   }
 
+  inline ::google::protobuf::Arena* GetArena() const PROTOBUF_FINAL {
+    return GetArenaNoVirtual();
+  }
+  inline void* GetMaybeArenaPointer() const PROTOBUF_FINAL {
+    return MaybeArenaPtr();
+  }
   static const ::google::protobuf::Descriptor* descriptor();
   static const CMD_Halls_OnRequestCreateRoomCB& default_instance();
 
@@ -3536,6 +4349,7 @@ class CMD_Halls_OnRequestCreateRoomCB : public ::google::protobuf::Message /* @@
                &_CMD_Halls_OnRequestCreateRoomCB_default_instance_);
   }
 
+  void UnsafeArenaSwap(CMD_Halls_OnRequestCreateRoomCB* other);
   void Swap(CMD_Halls_OnRequestCreateRoomCB* other);
 
   // implements Message ----------------------------------------------
@@ -3568,12 +4382,17 @@ class CMD_Halls_OnRequestCreateRoomCB : public ::google::protobuf::Message /* @@
   void SharedDtor();
   void SetCachedSize(int size) const PROTOBUF_FINAL;
   void InternalSwap(CMD_Halls_OnRequestCreateRoomCB* other);
+  protected:
+  explicit CMD_Halls_OnRequestCreateRoomCB(::google::protobuf::Arena* arena);
+  private:
+  static void ArenaDtor(void* object);
+  inline void RegisterArenaDtor(::google::protobuf::Arena* arena);
   private:
   inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
+    return _internal_metadata_.arena();
   }
   inline void* MaybeArenaPtr() const {
-    return NULL;
+    return _internal_metadata_.raw_arena_ptr();
   }
   public:
 
@@ -3588,14 +4407,14 @@ class CMD_Halls_OnRequestCreateRoomCB : public ::google::protobuf::Message /* @@
   static const int kIpFieldNumber = 2;
   const ::std::string& ip() const;
   void set_ip(const ::std::string& value);
-  #if LANG_CXX11
-  void set_ip(::std::string&& value);
-  #endif
   void set_ip(const char* value);
   void set_ip(const char* value, size_t size);
   ::std::string* mutable_ip();
   ::std::string* release_ip();
   void set_allocated_ip(::std::string* ip);
+  ::std::string* unsafe_arena_release_ip();
+  void unsafe_arena_set_allocated_ip(
+      ::std::string* ip);
 
   // uint64 roomID = 1;
   void clear_roomid();
@@ -3625,6 +4444,9 @@ class CMD_Halls_OnRequestCreateRoomCB : public ::google::protobuf::Message /* @@
  private:
 
   ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
+  friend class ::google::protobuf::Arena;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
   ::google::protobuf::internal::ArenaStringPtr ip_;
   ::google::protobuf::uint64 roomid_;
   ::google::protobuf::uint64 tokenid_;
@@ -3647,6 +4469,12 @@ class CMD_Halls_OnRoomSrvGameOverReport : public ::google::protobuf::Message /*
     return *this;
   }
 
+  inline ::google::protobuf::Arena* GetArena() const PROTOBUF_FINAL {
+    return GetArenaNoVirtual();
+  }
+  inline void* GetMaybeArenaPointer() const PROTOBUF_FINAL {
+    return MaybeArenaPtr();
+  }
   static const ::google::protobuf::Descriptor* descriptor();
   static const CMD_Halls_OnRoomSrvGameOverReport& default_instance();
 
@@ -3655,6 +4483,7 @@ class CMD_Halls_OnRoomSrvGameOverReport : public ::google::protobuf::Message /*
                &_CMD_Halls_OnRoomSrvGameOverReport_default_instance_);
   }
 
+  void UnsafeArenaSwap(CMD_Halls_OnRoomSrvGameOverReport* other);
   void Swap(CMD_Halls_OnRoomSrvGameOverReport* other);
 
   // implements Message ----------------------------------------------
@@ -3687,12 +4516,17 @@ class CMD_Halls_OnRoomSrvGameOverReport : public ::google::protobuf::Message /*
   void SharedDtor();
   void SetCachedSize(int size) const PROTOBUF_FINAL;
   void InternalSwap(CMD_Halls_OnRoomSrvGameOverReport* other);
+  protected:
+  explicit CMD_Halls_OnRoomSrvGameOverReport(::google::protobuf::Arena* arena);
+  private:
+  static void ArenaDtor(void* object);
+  inline void RegisterArenaDtor(::google::protobuf::Arena* arena);
   private:
   inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
+    return _internal_metadata_.arena();
   }
   inline void* MaybeArenaPtr() const {
-    return NULL;
+    return _internal_metadata_.raw_arena_ptr();
   }
   public:
 
@@ -3730,6 +4564,9 @@ class CMD_Halls_OnRoomSrvGameOverReport : public ::google::protobuf::Message /*
  private:
 
   ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
+  friend class ::google::protobuf::Arena;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
   ::google::protobuf::RepeatedPtrField< ::CMD_Halls_PlayerGameData > playerdatas_;
   ::google::protobuf::uint64 roomid_;
   int errcode_;
@@ -3750,6 +4587,12 @@ class CMD_Halls_OnQueryAccountCB : public ::google::protobuf::Message /* @@proto
     return *this;
   }
 
+  inline ::google::protobuf::Arena* GetArena() const PROTOBUF_FINAL {
+    return GetArenaNoVirtual();
+  }
+  inline void* GetMaybeArenaPointer() const PROTOBUF_FINAL {
+    return MaybeArenaPtr();
+  }
   static const ::google::protobuf::Descriptor* descriptor();
   static const CMD_Halls_OnQueryAccountCB& default_instance();
 
@@ -3758,6 +4601,7 @@ class CMD_Halls_OnQueryAccountCB : public ::google::protobuf::Message /* @@proto
                &_CMD_Halls_OnQueryAccountCB_default_instance_);
   }
 
+  void UnsafeArenaSwap(CMD_Halls_OnQueryAccountCB* other);
   void Swap(CMD_Halls_OnQueryAccountCB* other);
 
   // implements Message ----------------------------------------------
@@ -3790,12 +4634,17 @@ class CMD_Halls_OnQueryAccountCB : public ::google::protobuf::Message /* @@proto
   void SharedDtor();
   void SetCachedSize(int size) const PROTOBUF_FINAL;
   void InternalSwap(CMD_Halls_OnQueryAccountCB* other);
+  protected:
+  explicit CMD_Halls_OnQueryAccountCB(::google::protobuf::Arena* arena);
+  private:
+  static void ArenaDtor(void* object);
+  inline void RegisterArenaDtor(::google::protobuf::Arena* arena);
   private:
   inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
+    return _internal_metadata_.arena();
   }
   inline void* MaybeArenaPtr() const {
-    return NULL;
+    return _internal_metadata_.raw_arena_ptr();
   }
   public:
 
@@ -3810,42 +4659,42 @@ class CMD_Halls_OnQueryAccountCB : public ::google::protobuf::Message /* @@proto
   static const int kCommitAccountNameFieldNumber = 1;
   const ::std::string& commitaccountname() const;
   void set_commitaccountname(const ::std::string& value);
-  #if LANG_CXX11
-  void set_commitaccountname(::std::string&& value);
-  #endif
   void set_commitaccountname(const char* value);
   void set_commitaccountname(const char* value, size_t size);
   ::std::string* mutable_commitaccountname();
   ::std::string* release_commitaccountname();
   void set_allocated_commitaccountname(::std::string* commitaccountname);
+  ::std::string* unsafe_arena_release_commitaccountname();
+  void unsafe_arena_set_allocated_commitaccountname(
+      ::std::string* commitaccountname);
 
   // bytes datas = 2;
   void clear_datas();
   static const int kDatasFieldNumber = 2;
   const ::std::string& datas() const;
   void set_datas(const ::std::string& value);
-  #if LANG_CXX11
-  void set_datas(::std::string&& value);
-  #endif
   void set_datas(const char* value);
   void set_datas(const void* value, size_t size);
   ::std::string* mutable_datas();
   ::std::string* release_datas();
   void set_allocated_datas(::std::string* datas);
+  ::std::string* unsafe_arena_release_datas();
+  void unsafe_arena_set_allocated_datas(
+      ::std::string* datas);
 
   // string playerName = 4;
   void clear_playername();
   static const int kPlayerNameFieldNumber = 4;
   const ::std::string& playername() const;
   void set_playername(const ::std::string& value);
-  #if LANG_CXX11
-  void set_playername(::std::string&& value);
-  #endif
   void set_playername(const char* value);
   void set_playername(const char* value, size_t size);
   ::std::string* mutable_playername();
   ::std::string* release_playername();
   void set_allocated_playername(::std::string* playername);
+  ::std::string* unsafe_arena_release_playername();
+  void unsafe_arena_set_allocated_playername(
+      ::std::string* playername);
 
   // uint64 foundObjectID = 3;
   void clear_foundobjectid();
@@ -3887,6 +4736,9 @@ class CMD_Halls_OnQueryAccountCB : public ::google::protobuf::Message /* @@proto
  private:
 
   ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
+  friend class ::google::protobuf::Arena;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
   ::google::protobuf::internal::ArenaStringPtr commitaccountname_;
   ::google::protobuf::internal::ArenaStringPtr datas_;
   ::google::protobuf::internal::ArenaStringPtr playername_;
@@ -3913,6 +4765,12 @@ class CMD_Halls_OnQueryPlayerGameDataCB : public ::google::protobuf::Message /*
     return *this;
   }
 
+  inline ::google::protobuf::Arena* GetArena() const PROTOBUF_FINAL {
+    return GetArenaNoVirtual();
+  }
+  inline void* GetMaybeArenaPointer() const PROTOBUF_FINAL {
+    return MaybeArenaPtr();
+  }
   static const ::google::protobuf::Descriptor* descriptor();
   static const CMD_Halls_OnQueryPlayerGameDataCB& default_instance();
 
@@ -3921,6 +4779,7 @@ class CMD_Halls_OnQueryPlayerGameDataCB : public ::google::protobuf::Message /*
                &_CMD_Halls_OnQueryPlayerGameDataCB_default_instance_);
   }
 
+  void UnsafeArenaSwap(CMD_Halls_OnQueryPlayerGameDataCB* other);
   void Swap(CMD_Halls_OnQueryPlayerGameDataCB* other);
 
   // implements Message ----------------------------------------------
@@ -3953,12 +4812,17 @@ class CMD_Halls_OnQueryPlayerGameDataCB : public ::google::protobuf::Message /*
   void SharedDtor();
   void SetCachedSize(int size) const PROTOBUF_FINAL;
   void InternalSwap(CMD_Halls_OnQueryPlayerGameDataCB* other);
+  protected:
+  explicit CMD_Halls_OnQueryPlayerGameDataCB(::google::protobuf::Arena* arena);
+  private:
+  static void ArenaDtor(void* object);
+  inline void RegisterArenaDtor(::google::protobuf::Arena* arena);
   private:
   inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
+    return _internal_metadata_.arena();
   }
   inline void* MaybeArenaPtr() const {
-    return NULL;
+    return _internal_metadata_.raw_arena_ptr();
   }
   public:
 
@@ -4020,6 +4884,9 @@ class CMD_Halls_OnQueryPlayerGameDataCB : public ::google::protobuf::Message /*
  private:
 
   ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
+  friend class ::google::protobuf::Arena;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
   ::google::protobuf::uint64 playerid_;
   ::google::protobuf::int32 score_;
   ::google::protobuf::int32 topscore_;
@@ -4045,6 +4912,12 @@ class CMD_Halls_QueryPlayerGameData : public ::google::protobuf::Message /* @@pr
     return *this;
   }
 
+  inline ::google::protobuf::Arena* GetArena() const PROTOBUF_FINAL {
+    return GetArenaNoVirtual();
+  }
+  inline void* GetMaybeArenaPointer() const PROTOBUF_FINAL {
+    return MaybeArenaPtr();
+  }
   static const ::google::protobuf::Descriptor* descriptor();
   static const CMD_Halls_QueryPlayerGameData& default_instance();
 
@@ -4053,6 +4926,7 @@ class CMD_Halls_QueryPlayerGameData : public ::google::protobuf::Message /* @@pr
                &_CMD_Halls_QueryPlayerGameData_default_instance_);
   }
 
+  void UnsafeArenaSwap(CMD_Halls_QueryPlayerGameData* other);
   void Swap(CMD_Halls_QueryPlayerGameData* other);
 
   // implements Message ----------------------------------------------
@@ -4085,12 +4959,17 @@ class CMD_Halls_QueryPlayerGameData : public ::google::protobuf::Message /* @@pr
   void SharedDtor();
   void SetCachedSize(int size) const PROTOBUF_FINAL;
   void InternalSwap(CMD_Halls_QueryPlayerGameData* other);
+  protected:
+  explicit CMD_Halls_QueryPlayerGameData(::google::protobuf::Arena* arena);
+  private:
+  static void ArenaDtor(void* object);
+  inline void RegisterArenaDtor(::google::protobuf::Arena* arena);
   private:
   inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
+    return _internal_metadata_.arena();
   }
   inline void* MaybeArenaPtr() const {
-    return NULL;
+    return _internal_metadata_.raw_arena_ptr();
   }
   public:
 
@@ -4116,6 +4995,9 @@ class CMD_Halls_QueryPlayerGameData : public ::google::protobuf::Message /* @@pr
  private:
 
   ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
+  friend class ::google::protobuf::Arena;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
   ::google::protobuf::uint64 gameid_;
   ::google::protobuf::uint32 gamemode_;
   mutable int _cached_size_;
@@ -4135,6 +5017,12 @@ class CMD_Halls_ListGames : public ::google::protobuf::Message /* @@protoc_inser
     return *this;
   }
 
+  inline ::google::protobuf::Arena* GetArena() const PROTOBUF_FINAL {
+    return GetArenaNoVirtual();
+  }
+  inline void* GetMaybeArenaPointer() const PROTOBUF_FINAL {
+    return MaybeArenaPtr();
+  }
   static const ::google::protobuf::Descriptor* descriptor();
   static const CMD_Halls_ListGames& default_instance();
 
@@ -4143,6 +5031,7 @@ class CMD_Halls_ListGames : public ::google::protobuf::Message /* @@protoc_inser
                &_CMD_Halls_ListGames_default_instance_);
   }
 
+  void UnsafeArenaSwap(CMD_Halls_ListGames* other);
   void Swap(CMD_Halls_ListGames* other);
 
   // implements Message ----------------------------------------------
@@ -4175,12 +5064,17 @@ class CMD_Halls_ListGames : public ::google::protobuf::Message /* @@protoc_inser
   void SharedDtor();
   void SetCachedSize(int size) const PROTOBUF_FINAL;
   void InternalSwap(CMD_Halls_ListGames* other);
+  protected:
+  explicit CMD_Halls_ListGames(::google::protobuf::Arena* arena);
+  private:
+  static void ArenaDtor(void* object);
+  inline void RegisterArenaDtor(::google::protobuf::Arena* arena);
   private:
   inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
+    return _internal_metadata_.arena();
   }
   inline void* MaybeArenaPtr() const {
-    return NULL;
+    return _internal_metadata_.raw_arena_ptr();
   }
   public:
 
@@ -4212,6 +5106,9 @@ class CMD_Halls_ListGames : public ::google::protobuf::Message /* @@protoc_inser
  private:
 
   ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
+  friend class ::google::protobuf::Arena;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
   ::google::protobuf::uint32 page_;
   ::google::protobuf::uint32 type_;
   ::google::protobuf::uint32 maxnum_;
@@ -4232,6 +5129,12 @@ class CMD_Hallsmgr_RequestAllocClient : public ::google::protobuf::Message /* @@
     return *this;
   }
 
+  inline ::google::protobuf::Arena* GetArena() const PROTOBUF_FINAL {
+    return GetArenaNoVirtual();
+  }
+  inline void* GetMaybeArenaPointer() const PROTOBUF_FINAL {
+    return MaybeArenaPtr();
+  }
   static const ::google::protobuf::Descriptor* descriptor();
   static const CMD_Hallsmgr_RequestAllocClient& default_instance();
 
@@ -4240,6 +5143,7 @@ class CMD_Hallsmgr_RequestAllocClient : public ::google::protobuf::Message /* @@
                &_CMD_Hallsmgr_RequestAllocClient_default_instance_);
   }
 
+  void UnsafeArenaSwap(CMD_Hallsmgr_RequestAllocClient* other);
   void Swap(CMD_Hallsmgr_RequestAllocClient* other);
 
   // implements Message ----------------------------------------------
@@ -4272,12 +5176,17 @@ class CMD_Hallsmgr_RequestAllocClient : public ::google::protobuf::Message /* @@
   void SharedDtor();
   void SetCachedSize(int size) const PROTOBUF_FINAL;
   void InternalSwap(CMD_Hallsmgr_RequestAllocClient* other);
+  protected:
+  explicit CMD_Hallsmgr_RequestAllocClient(::google::protobuf::Arena* arena);
+  private:
+  static void ArenaDtor(void* object);
+  inline void RegisterArenaDtor(::google::protobuf::Arena* arena);
   private:
   inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
+    return _internal_metadata_.arena();
   }
   inline void* MaybeArenaPtr() const {
-    return NULL;
+    return _internal_metadata_.raw_arena_ptr();
   }
   public:
 
@@ -4292,42 +5201,42 @@ class CMD_Hallsmgr_RequestAllocClient : public ::google::protobuf::Message /* @@
   static const int kCommitAccountNameFieldNumber = 1;
   const ::std::string& commitaccountname() const;
   void set_commitaccountname(const ::std::string& value);
-  #if LANG_CXX11
-  void set_commitaccountname(::std::string&& value);
-  #endif
   void set_commitaccountname(const char* value);
   void set_commitaccountname(const char* value, size_t size);
   ::std::string* mutable_commitaccountname();
   ::std::string* release_commitaccountname();
   void set_allocated_commitaccountname(::std::string* commitaccountname);
+  ::std::string* unsafe_arena_release_commitaccountname();
+  void unsafe_arena_set_allocated_commitaccountname(
+      ::std::string* commitaccountname);
 
   // string password = 2;
   void clear_password();
   static const int kPasswordFieldNumber = 2;
   const ::std::string& password() const;
   void set_password(const ::std::string& value);
-  #if LANG_CXX11
-  void set_password(::std::string&& value);
-  #endif
   void set_password(const char* value);
   void set_password(const char* value, size_t size);
   ::std::string* mutable_password();
   ::std::string* release_password();
   void set_allocated_password(::std::string* password);
+  ::std::string* unsafe_arena_release_password();
+  void unsafe_arena_set_allocated_password(
+      ::std::string* password);
 
   // bytes datas = 3;
   void clear_datas();
   static const int kDatasFieldNumber = 3;
   const ::std::string& datas() const;
   void set_datas(const ::std::string& value);
-  #if LANG_CXX11
-  void set_datas(::std::string&& value);
-  #endif
   void set_datas(const char* value);
   void set_datas(const void* value, size_t size);
   ::std::string* mutable_datas();
   ::std::string* release_datas();
   void set_allocated_datas(::std::string* datas);
+  ::std::string* unsafe_arena_release_datas();
+  void unsafe_arena_set_allocated_datas(
+      ::std::string* datas);
 
   // uint64 foundObjectID = 4;
   void clear_foundobjectid();
@@ -4345,6 +5254,9 @@ class CMD_Hallsmgr_RequestAllocClient : public ::google::protobuf::Message /* @@
  private:
 
   ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
+  friend class ::google::protobuf::Arena;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
   ::google::protobuf::internal::ArenaStringPtr commitaccountname_;
   ::google::protobuf::internal::ArenaStringPtr password_;
   ::google::protobuf::internal::ArenaStringPtr datas_;
@@ -4367,6 +5279,12 @@ class CMD_Hallsmgr_OnRequestAllocClientCB : public ::google::protobuf::Message /
     return *this;
   }
 
+  inline ::google::protobuf::Arena* GetArena() const PROTOBUF_FINAL {
+    return GetArenaNoVirtual();
+  }
+  inline void* GetMaybeArenaPointer() const PROTOBUF_FINAL {
+    return MaybeArenaPtr();
+  }
   static const ::google::protobuf::Descriptor* descriptor();
   static const CMD_Hallsmgr_OnRequestAllocClientCB& default_instance();
 
@@ -4375,6 +5293,7 @@ class CMD_Hallsmgr_OnRequestAllocClientCB : public ::google::protobuf::Message /
                &_CMD_Hallsmgr_OnRequestAllocClientCB_default_instance_);
   }
 
+  void UnsafeArenaSwap(CMD_Hallsmgr_OnRequestAllocClientCB* other);
   void Swap(CMD_Hallsmgr_OnRequestAllocClientCB* other);
 
   // implements Message ----------------------------------------------
@@ -4407,12 +5326,17 @@ class CMD_Hallsmgr_OnRequestAllocClientCB : public ::google::protobuf::Message /
   void SharedDtor();
   void SetCachedSize(int size) const PROTOBUF_FINAL;
   void InternalSwap(CMD_Hallsmgr_OnRequestAllocClientCB* other);
+  protected:
+  explicit CMD_Hallsmgr_OnRequestAllocClientCB(::google::protobuf::Arena* arena);
+  private:
+  static void ArenaDtor(void* object);
+  inline void RegisterArenaDtor(::google::protobuf::Arena* arena);
   private:
   inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
+    return _internal_metadata_.arena();
   }
   inline void* MaybeArenaPtr() const {
-    return NULL;
+    return _internal_metadata_.raw_arena_ptr();
   }
   public:
 
@@ -4427,28 +5351,28 @@ class CMD_Hallsmgr_OnRequestAllocClientCB : public ::google::protobuf::Message /
   static const int kIpFieldNumber = 1;
   const ::std::string& ip() const;
   void set_ip(const ::std::string& value);
-  #if LANG_CXX11
-  void set_ip(::std::string&& value);
-  #endif
   void set_ip(const char* value);
   void set_ip(const char* value, size_t size);
   ::std::string* mutable_ip();
   ::std::string* release_ip();
   void set_allocated_ip(::std::string* ip);
+  ::std::string* unsafe_arena_release_ip();
+  void unsafe_arena_set_allocated_ip(
+      ::std::string* ip);
 
   // string commitAccountName = 3;
   void clear_commitaccountname();
   static const int kCommitAccountNameFieldNumber = 3;
   const ::std::string& commitaccountname() const;
   void set_commitaccountname(const ::std::string& value);
-  #if LANG_CXX11
-  void set_commitaccountname(::std::string&& value);
-  #endif
   void set_commitaccountname(const char* value);
   void set_commitaccountname(const char* value, size_t size);
   ::std::string* mutable_commitaccountname();
   ::std::string* release_commitaccountname();
   void set_allocated_commitaccountname(::std::string* commitaccountname);
+  ::std::string* unsafe_arena_release_commitaccountname();
+  void unsafe_arena_set_allocated_commitaccountname(
+      ::std::string* commitaccountname);
 
   // int32 port = 2;
   void clear_port();
@@ -4474,16 +5398,26 @@ class CMD_Hallsmgr_OnRequestAllocClientCB : public ::google::protobuf::Message /
   ::google::protobuf::uint64 tokenid() const;
   void set_tokenid(::google::protobuf::uint64 value);
 
+  // uint64 hallsID = 7;
+  void clear_hallsid();
+  static const int kHallsIDFieldNumber = 7;
+  ::google::protobuf::uint64 hallsid() const;
+  void set_hallsid(::google::protobuf::uint64 value);
+
   // @@protoc_insertion_point(class_scope:CMD_Hallsmgr_OnRequestAllocClientCB)
  private:
 
   ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
+  friend class ::google::protobuf::Arena;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
   ::google::protobuf::internal::ArenaStringPtr ip_;
   ::google::protobuf::internal::ArenaStringPtr commitaccountname_;
   ::google::protobuf::int32 port_;
   int errcode_;
   ::google::protobuf::uint64 loginsessionid_;
   ::google::protobuf::uint64 tokenid_;
+  ::google::protobuf::uint64 hallsid_;
   mutable int _cached_size_;
   friend struct  protobuf_Commands_2eproto::TableStruct;
 };
@@ -4501,6 +5435,12 @@ class CMD_RoomPlayerInfo : public ::google::protobuf::Message /* @@protoc_insert
     return *this;
   }
 
+  inline ::google::protobuf::Arena* GetArena() const PROTOBUF_FINAL {
+    return GetArenaNoVirtual();
+  }
+  inline void* GetMaybeArenaPointer() const PROTOBUF_FINAL {
+    return MaybeArenaPtr();
+  }
   static const ::google::protobuf::Descriptor* descriptor();
   static const CMD_RoomPlayerInfo& default_instance();
 
@@ -4509,6 +5449,7 @@ class CMD_RoomPlayerInfo : public ::google::protobuf::Message /* @@protoc_insert
                &_CMD_RoomPlayerInfo_default_instance_);
   }
 
+  void UnsafeArenaSwap(CMD_RoomPlayerInfo* other);
   void Swap(CMD_RoomPlayerInfo* other);
 
   // implements Message ----------------------------------------------
@@ -4541,12 +5482,17 @@ class CMD_RoomPlayerInfo : public ::google::protobuf::Message /* @@protoc_insert
   void SharedDtor();
   void SetCachedSize(int size) const PROTOBUF_FINAL;
   void InternalSwap(CMD_RoomPlayerInfo* other);
+  protected:
+  explicit CMD_RoomPlayerInfo(::google::protobuf::Arena* arena);
+  private:
+  static void ArenaDtor(void* object);
+  inline void RegisterArenaDtor(::google::protobuf::Arena* arena);
   private:
   inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
+    return _internal_metadata_.arena();
   }
   inline void* MaybeArenaPtr() const {
-    return NULL;
+    return _internal_metadata_.raw_arena_ptr();
   }
   public:
 
@@ -4561,28 +5507,28 @@ class CMD_RoomPlayerInfo : public ::google::protobuf::Message /* @@protoc_insert
   static const int kClientAddrFieldNumber = 2;
   const ::std::string& clientaddr() const;
   void set_clientaddr(const ::std::string& value);
-  #if LANG_CXX11
-  void set_clientaddr(::std::string&& value);
-  #endif
   void set_clientaddr(const char* value);
   void set_clientaddr(const char* value, size_t size);
   ::std::string* mutable_clientaddr();
   ::std::string* release_clientaddr();
   void set_allocated_clientaddr(::std::string* clientaddr);
+  ::std::string* unsafe_arena_release_clientaddr();
+  void unsafe_arena_set_allocated_clientaddr(
+      ::std::string* clientaddr);
 
   // string playerName = 8;
   void clear_playername();
   static const int kPlayerNameFieldNumber = 8;
   const ::std::string& playername() const;
   void set_playername(const ::std::string& value);
-  #if LANG_CXX11
-  void set_playername(::std::string&& value);
-  #endif
   void set_playername(const char* value);
   void set_playername(const char* value, size_t size);
   ::std::string* mutable_playername();
   ::std::string* release_playername();
   void set_allocated_playername(::std::string* playername);
+  ::std::string* unsafe_arena_release_playername();
+  void unsafe_arena_set_allocated_playername(
+      ::std::string* playername);
 
   // uint64 playerID = 1;
   void clear_playerid();
@@ -4630,6 +5576,9 @@ class CMD_RoomPlayerInfo : public ::google::protobuf::Message /* @@protoc_insert
  private:
 
   ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
+  friend class ::google::protobuf::Arena;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
   ::google::protobuf::internal::ArenaStringPtr clientaddr_;
   ::google::protobuf::internal::ArenaStringPtr playername_;
   ::google::protobuf::uint64 playerid_;
@@ -4656,6 +5605,12 @@ class CMD_Roommgr_RequestCreateRoom : public ::google::protobuf::Message /* @@pr
     return *this;
   }
 
+  inline ::google::protobuf::Arena* GetArena() const PROTOBUF_FINAL {
+    return GetArenaNoVirtual();
+  }
+  inline void* GetMaybeArenaPointer() const PROTOBUF_FINAL {
+    return MaybeArenaPtr();
+  }
   static const ::google::protobuf::Descriptor* descriptor();
   static const CMD_Roommgr_RequestCreateRoom& default_instance();
 
@@ -4664,6 +5619,7 @@ class CMD_Roommgr_RequestCreateRoom : public ::google::protobuf::Message /* @@pr
                &_CMD_Roommgr_RequestCreateRoom_default_instance_);
   }
 
+  void UnsafeArenaSwap(CMD_Roommgr_RequestCreateRoom* other);
   void Swap(CMD_Roommgr_RequestCreateRoom* other);
 
   // implements Message ----------------------------------------------
@@ -4696,12 +5652,17 @@ class CMD_Roommgr_RequestCreateRoom : public ::google::protobuf::Message /* @@pr
   void SharedDtor();
   void SetCachedSize(int size) const PROTOBUF_FINAL;
   void InternalSwap(CMD_Roommgr_RequestCreateRoom* other);
+  protected:
+  explicit CMD_Roommgr_RequestCreateRoom(::google::protobuf::Arena* arena);
+  private:
+  static void ArenaDtor(void* object);
+  inline void RegisterArenaDtor(::google::protobuf::Arena* arena);
   private:
   inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
+    return _internal_metadata_.arena();
   }
   inline void* MaybeArenaPtr() const {
-    return NULL;
+    return _internal_metadata_.raw_arena_ptr();
   }
   public:
 
@@ -4728,28 +5689,28 @@ class CMD_Roommgr_RequestCreateRoom : public ::google::protobuf::Message /* @@pr
   static const int kExeFileFieldNumber = 8;
   const ::std::string& exefile() const;
   void set_exefile(const ::std::string& value);
-  #if LANG_CXX11
-  void set_exefile(::std::string&& value);
-  #endif
   void set_exefile(const char* value);
   void set_exefile(const char* value, size_t size);
   ::std::string* mutable_exefile();
   ::std::string* release_exefile();
   void set_allocated_exefile(::std::string* exefile);
+  ::std::string* unsafe_arena_release_exefile();
+  void unsafe_arena_set_allocated_exefile(
+      ::std::string* exefile);
 
   // string exeOptions = 9;
   void clear_exeoptions();
   static const int kExeOptionsFieldNumber = 9;
   const ::std::string& exeoptions() const;
   void set_exeoptions(const ::std::string& value);
-  #if LANG_CXX11
-  void set_exeoptions(::std::string&& value);
-  #endif
   void set_exeoptions(const char* value);
   void set_exeoptions(const char* value, size_t size);
   ::std::string* mutable_exeoptions();
   ::std::string* release_exeoptions();
   void set_allocated_exeoptions(::std::string* exeoptions);
+  ::std::string* unsafe_arena_release_exeoptions();
+  void unsafe_arena_set_allocated_exeoptions(
+      ::std::string* exeoptions);
 
   // uint64 hallsID = 1;
   void clear_hallsid();
@@ -4791,6 +5752,9 @@ class CMD_Roommgr_RequestCreateRoom : public ::google::protobuf::Message /* @@pr
  private:
 
   ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
+  friend class ::google::protobuf::Arena;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
   ::google::protobuf::RepeatedPtrField< ::CMD_RoomPlayerInfo > players_;
   ::google::protobuf::internal::ArenaStringPtr exefile_;
   ::google::protobuf::internal::ArenaStringPtr exeoptions_;
@@ -4817,6 +5781,12 @@ class CMD_Roommgr_OnRequestCreateRoomCB : public ::google::protobuf::Message /*
     return *this;
   }
 
+  inline ::google::protobuf::Arena* GetArena() const PROTOBUF_FINAL {
+    return GetArenaNoVirtual();
+  }
+  inline void* GetMaybeArenaPointer() const PROTOBUF_FINAL {
+    return MaybeArenaPtr();
+  }
   static const ::google::protobuf::Descriptor* descriptor();
   static const CMD_Roommgr_OnRequestCreateRoomCB& default_instance();
 
@@ -4825,6 +5795,7 @@ class CMD_Roommgr_OnRequestCreateRoomCB : public ::google::protobuf::Message /*
                &_CMD_Roommgr_OnRequestCreateRoomCB_default_instance_);
   }
 
+  void UnsafeArenaSwap(CMD_Roommgr_OnRequestCreateRoomCB* other);
   void Swap(CMD_Roommgr_OnRequestCreateRoomCB* other);
 
   // implements Message ----------------------------------------------
@@ -4857,12 +5828,17 @@ class CMD_Roommgr_OnRequestCreateRoomCB : public ::google::protobuf::Message /*
   void SharedDtor();
   void SetCachedSize(int size) const PROTOBUF_FINAL;
   void InternalSwap(CMD_Roommgr_OnRequestCreateRoomCB* other);
+  protected:
+  explicit CMD_Roommgr_OnRequestCreateRoomCB(::google::protobuf::Arena* arena);
+  private:
+  static void ArenaDtor(void* object);
+  inline void RegisterArenaDtor(::google::protobuf::Arena* arena);
   private:
   inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
+    return _internal_metadata_.arena();
   }
   inline void* MaybeArenaPtr() const {
-    return NULL;
+    return _internal_metadata_.raw_arena_ptr();
   }
   public:
 
@@ -4877,14 +5853,14 @@ class CMD_Roommgr_OnRequestCreateRoomCB : public ::google::protobuf::Message /*
   static const int kIpFieldNumber = 3;
   const ::std::string& ip() const;
   void set_ip(const ::std::string& value);
-  #if LANG_CXX11
-  void set_ip(::std::string&& value);
-  #endif
   void set_ip(const char* value);
   void set_ip(const char* value, size_t size);
   ::std::string* mutable_ip();
   ::std::string* release_ip();
   void set_allocated_ip(::std::string* ip);
+  ::std::string* unsafe_arena_release_ip();
+  void unsafe_arena_set_allocated_ip(
+      ::std::string* ip);
 
   // uint64 hallsID = 1;
   void clear_hallsid();
@@ -4920,6 +5896,9 @@ class CMD_Roommgr_OnRequestCreateRoomCB : public ::google::protobuf::Message /*
  private:
 
   ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
+  friend class ::google::protobuf::Arena;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
   ::google::protobuf::internal::ArenaStringPtr ip_;
   ::google::protobuf::uint64 hallsid_;
   ::google::protobuf::uint64 roomid_;
@@ -4943,6 +5922,12 @@ class CMD_Roommgr_OnRoomSrvGameOverReport : public ::google::protobuf::Message /
     return *this;
   }
 
+  inline ::google::protobuf::Arena* GetArena() const PROTOBUF_FINAL {
+    return GetArenaNoVirtual();
+  }
+  inline void* GetMaybeArenaPointer() const PROTOBUF_FINAL {
+    return MaybeArenaPtr();
+  }
   static const ::google::protobuf::Descriptor* descriptor();
   static const CMD_Roommgr_OnRoomSrvGameOverReport& default_instance();
 
@@ -4951,6 +5936,7 @@ class CMD_Roommgr_OnRoomSrvGameOverReport : public ::google::protobuf::Message /
                &_CMD_Roommgr_OnRoomSrvGameOverReport_default_instance_);
   }
 
+  void UnsafeArenaSwap(CMD_Roommgr_OnRoomSrvGameOverReport* other);
   void Swap(CMD_Roommgr_OnRoomSrvGameOverReport* other);
 
   // implements Message ----------------------------------------------
@@ -4983,12 +5969,17 @@ class CMD_Roommgr_OnRoomSrvGameOverReport : public ::google::protobuf::Message /
   void SharedDtor();
   void SetCachedSize(int size) const PROTOBUF_FINAL;
   void InternalSwap(CMD_Roommgr_OnRoomSrvGameOverReport* other);
+  protected:
+  explicit CMD_Roommgr_OnRoomSrvGameOverReport(::google::protobuf::Arena* arena);
+  private:
+  static void ArenaDtor(void* object);
+  inline void RegisterArenaDtor(::google::protobuf::Arena* arena);
   private:
   inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
+    return _internal_metadata_.arena();
   }
   inline void* MaybeArenaPtr() const {
-    return NULL;
+    return _internal_metadata_.raw_arena_ptr();
   }
   public:
 
@@ -5032,6 +6023,9 @@ class CMD_Roommgr_OnRoomSrvGameOverReport : public ::google::protobuf::Message /
  private:
 
   ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
+  friend class ::google::protobuf::Arena;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
   ::google::protobuf::RepeatedPtrField< ::CMD_Halls_PlayerGameData > playerdatas_;
   ::google::protobuf::uint64 hallsid_;
   ::google::protobuf::uint64 roomid_;
@@ -5053,6 +6047,12 @@ class CMD_Machine_RequestCreateRoom : public ::google::protobuf::Message /* @@pr
     return *this;
   }
 
+  inline ::google::protobuf::Arena* GetArena() const PROTOBUF_FINAL {
+    return GetArenaNoVirtual();
+  }
+  inline void* GetMaybeArenaPointer() const PROTOBUF_FINAL {
+    return MaybeArenaPtr();
+  }
   static const ::google::protobuf::Descriptor* descriptor();
   static const CMD_Machine_RequestCreateRoom& default_instance();
 
@@ -5061,6 +6061,7 @@ class CMD_Machine_RequestCreateRoom : public ::google::protobuf::Message /* @@pr
                &_CMD_Machine_RequestCreateRoom_default_instance_);
   }
 
+  void UnsafeArenaSwap(CMD_Machine_RequestCreateRoom* other);
   void Swap(CMD_Machine_RequestCreateRoom* other);
 
   // implements Message ----------------------------------------------
@@ -5093,12 +6094,17 @@ class CMD_Machine_RequestCreateRoom : public ::google::protobuf::Message /* @@pr
   void SharedDtor();
   void SetCachedSize(int size) const PROTOBUF_FINAL;
   void InternalSwap(CMD_Machine_RequestCreateRoom* other);
+  protected:
+  explicit CMD_Machine_RequestCreateRoom(::google::protobuf::Arena* arena);
+  private:
+  static void ArenaDtor(void* object);
+  inline void RegisterArenaDtor(::google::protobuf::Arena* arena);
   private:
   inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
+    return _internal_metadata_.arena();
   }
   inline void* MaybeArenaPtr() const {
-    return NULL;
+    return _internal_metadata_.raw_arena_ptr();
   }
   public:
 
@@ -5125,42 +6131,42 @@ class CMD_Machine_RequestCreateRoom : public ::google::protobuf::Message /* @@pr
   static const int kExeFileFieldNumber = 8;
   const ::std::string& exefile() const;
   void set_exefile(const ::std::string& value);
-  #if LANG_CXX11
-  void set_exefile(::std::string&& value);
-  #endif
   void set_exefile(const char* value);
   void set_exefile(const char* value, size_t size);
   ::std::string* mutable_exefile();
   ::std::string* release_exefile();
   void set_allocated_exefile(::std::string* exefile);
+  ::std::string* unsafe_arena_release_exefile();
+  void unsafe_arena_set_allocated_exefile(
+      ::std::string* exefile);
 
   // string exeOptions = 9;
   void clear_exeoptions();
   static const int kExeOptionsFieldNumber = 9;
   const ::std::string& exeoptions() const;
   void set_exeoptions(const ::std::string& value);
-  #if LANG_CXX11
-  void set_exeoptions(::std::string&& value);
-  #endif
   void set_exeoptions(const char* value);
   void set_exeoptions(const char* value, size_t size);
   ::std::string* mutable_exeoptions();
   ::std::string* release_exeoptions();
   void set_allocated_exeoptions(::std::string* exeoptions);
+  ::std::string* unsafe_arena_release_exeoptions();
+  void unsafe_arena_set_allocated_exeoptions(
+      ::std::string* exeoptions);
 
   // string roommgrIP = 11;
   void clear_roommgrip();
   static const int kRoommgrIPFieldNumber = 11;
   const ::std::string& roommgrip() const;
   void set_roommgrip(const ::std::string& value);
-  #if LANG_CXX11
-  void set_roommgrip(::std::string&& value);
-  #endif
   void set_roommgrip(const char* value);
   void set_roommgrip(const char* value, size_t size);
   ::std::string* mutable_roommgrip();
   ::std::string* release_roommgrip();
   void set_allocated_roommgrip(::std::string* roommgrip);
+  ::std::string* unsafe_arena_release_roommgrip();
+  void unsafe_arena_set_allocated_roommgrip(
+      ::std::string* roommgrip);
 
   // uint64 hallsID = 1;
   void clear_hallsid();
@@ -5214,6 +6220,9 @@ class CMD_Machine_RequestCreateRoom : public ::google::protobuf::Message /* @@pr
  private:
 
   ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
+  friend class ::google::protobuf::Arena;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
   ::google::protobuf::RepeatedPtrField< ::CMD_RoomPlayerInfo > players_;
   ::google::protobuf::internal::ArenaStringPtr exefile_;
   ::google::protobuf::internal::ArenaStringPtr exeoptions_;
@@ -5243,6 +6252,12 @@ class CMD_Machine_RoomSrvReportAddr : public ::google::protobuf::Message /* @@pr
     return *this;
   }
 
+  inline ::google::protobuf::Arena* GetArena() const PROTOBUF_FINAL {
+    return GetArenaNoVirtual();
+  }
+  inline void* GetMaybeArenaPointer() const PROTOBUF_FINAL {
+    return MaybeArenaPtr();
+  }
   static const ::google::protobuf::Descriptor* descriptor();
   static const CMD_Machine_RoomSrvReportAddr& default_instance();
 
@@ -5251,6 +6266,7 @@ class CMD_Machine_RoomSrvReportAddr : public ::google::protobuf::Message /* @@pr
                &_CMD_Machine_RoomSrvReportAddr_default_instance_);
   }
 
+  void UnsafeArenaSwap(CMD_Machine_RoomSrvReportAddr* other);
   void Swap(CMD_Machine_RoomSrvReportAddr* other);
 
   // implements Message ----------------------------------------------
@@ -5283,12 +6299,17 @@ class CMD_Machine_RoomSrvReportAddr : public ::google::protobuf::Message /* @@pr
   void SharedDtor();
   void SetCachedSize(int size) const PROTOBUF_FINAL;
   void InternalSwap(CMD_Machine_RoomSrvReportAddr* other);
+  protected:
+  explicit CMD_Machine_RoomSrvReportAddr(::google::protobuf::Arena* arena);
+  private:
+  static void ArenaDtor(void* object);
+  inline void RegisterArenaDtor(::google::protobuf::Arena* arena);
   private:
   inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
+    return _internal_metadata_.arena();
   }
   inline void* MaybeArenaPtr() const {
-    return NULL;
+    return _internal_metadata_.raw_arena_ptr();
   }
   public:
 
@@ -5303,14 +6324,14 @@ class CMD_Machine_RoomSrvReportAddr : public ::google::protobuf::Message /* @@pr
   static const int kIpFieldNumber = 3;
   const ::std::string& ip() const;
   void set_ip(const ::std::string& value);
-  #if LANG_CXX11
-  void set_ip(::std::string&& value);
-  #endif
   void set_ip(const char* value);
   void set_ip(const char* value, size_t size);
   ::std::string* mutable_ip();
   ::std::string* release_ip();
   void set_allocated_ip(::std::string* ip);
+  ::std::string* unsafe_arena_release_ip();
+  void unsafe_arena_set_allocated_ip(
+      ::std::string* ip);
 
   // uint64 hallsID = 1;
   void clear_hallsid();
@@ -5340,6 +6361,9 @@ class CMD_Machine_RoomSrvReportAddr : public ::google::protobuf::Message /* @@pr
  private:
 
   ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
+  friend class ::google::protobuf::Arena;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
   ::google::protobuf::internal::ArenaStringPtr ip_;
   ::google::protobuf::uint64 hallsid_;
   ::google::protobuf::uint64 roomid_;
@@ -5362,6 +6386,12 @@ class CMD_Machine_OnRoomSrvGameOverReport : public ::google::protobuf::Message /
     return *this;
   }
 
+  inline ::google::protobuf::Arena* GetArena() const PROTOBUF_FINAL {
+    return GetArenaNoVirtual();
+  }
+  inline void* GetMaybeArenaPointer() const PROTOBUF_FINAL {
+    return MaybeArenaPtr();
+  }
   static const ::google::protobuf::Descriptor* descriptor();
   static const CMD_Machine_OnRoomSrvGameOverReport& default_instance();
 
@@ -5370,6 +6400,7 @@ class CMD_Machine_OnRoomSrvGameOverReport : public ::google::protobuf::Message /
                &_CMD_Machine_OnRoomSrvGameOverReport_default_instance_);
   }
 
+  void UnsafeArenaSwap(CMD_Machine_OnRoomSrvGameOverReport* other);
   void Swap(CMD_Machine_OnRoomSrvGameOverReport* other);
 
   // implements Message ----------------------------------------------
@@ -5402,12 +6433,17 @@ class CMD_Machine_OnRoomSrvGameOverReport : public ::google::protobuf::Message /
   void SharedDtor();
   void SetCachedSize(int size) const PROTOBUF_FINAL;
   void InternalSwap(CMD_Machine_OnRoomSrvGameOverReport* other);
+  protected:
+  explicit CMD_Machine_OnRoomSrvGameOverReport(::google::protobuf::Arena* arena);
+  private:
+  static void ArenaDtor(void* object);
+  inline void RegisterArenaDtor(::google::protobuf::Arena* arena);
   private:
   inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
+    return _internal_metadata_.arena();
   }
   inline void* MaybeArenaPtr() const {
-    return NULL;
+    return _internal_metadata_.raw_arena_ptr();
   }
   public:
 
@@ -5451,6 +6487,9 @@ class CMD_Machine_OnRoomSrvGameOverReport : public ::google::protobuf::Message /
  private:
 
   ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
+  friend class ::google::protobuf::Arena;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
   ::google::protobuf::RepeatedPtrField< ::CMD_Halls_PlayerGameData > playerdatas_;
   ::google::protobuf::uint64 hallsid_;
   ::google::protobuf::uint64 roomid_;
@@ -5472,6 +6511,12 @@ class CMD_ListServersInfo : public ::google::protobuf::Message /* @@protoc_inser
     return *this;
   }
 
+  inline ::google::protobuf::Arena* GetArena() const PROTOBUF_FINAL {
+    return GetArenaNoVirtual();
+  }
+  inline void* GetMaybeArenaPointer() const PROTOBUF_FINAL {
+    return MaybeArenaPtr();
+  }
   static const ::google::protobuf::Descriptor* descriptor();
   static const CMD_ListServersInfo& default_instance();
 
@@ -5480,6 +6525,7 @@ class CMD_ListServersInfo : public ::google::protobuf::Message /* @@protoc_inser
                &_CMD_ListServersInfo_default_instance_);
   }
 
+  void UnsafeArenaSwap(CMD_ListServersInfo* other);
   void Swap(CMD_ListServersInfo* other);
 
   // implements Message ----------------------------------------------
@@ -5512,12 +6558,17 @@ class CMD_ListServersInfo : public ::google::protobuf::Message /* @@protoc_inser
   void SharedDtor();
   void SetCachedSize(int size) const PROTOBUF_FINAL;
   void InternalSwap(CMD_ListServersInfo* other);
+  protected:
+  explicit CMD_ListServersInfo(::google::protobuf::Arena* arena);
+  private:
+  static void ArenaDtor(void* object);
+  inline void RegisterArenaDtor(::google::protobuf::Arena* arena);
   private:
   inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
+    return _internal_metadata_.arena();
   }
   inline void* MaybeArenaPtr() const {
-    return NULL;
+    return _internal_metadata_.raw_arena_ptr();
   }
   public:
 
@@ -5532,28 +6583,28 @@ class CMD_ListServersInfo : public ::google::protobuf::Message /* @@protoc_inser
   static const int kAddrFieldNumber = 1;
   const ::std::string& addr() const;
   void set_addr(const ::std::string& value);
-  #if LANG_CXX11
-  void set_addr(::std::string&& value);
-  #endif
   void set_addr(const char* value);
   void set_addr(const char* value, size_t size);
   ::std::string* mutable_addr();
   ::std::string* release_addr();
   void set_allocated_addr(::std::string* addr);
+  ::std::string* unsafe_arena_release_addr();
+  void unsafe_arena_set_allocated_addr(
+      ::std::string* addr);
 
   // string name = 4;
   void clear_name();
   static const int kNameFieldNumber = 4;
   const ::std::string& name() const;
   void set_name(const ::std::string& value);
-  #if LANG_CXX11
-  void set_name(::std::string&& value);
-  #endif
   void set_name(const char* value);
   void set_name(const char* value, size_t size);
   ::std::string* mutable_name();
   ::std::string* release_name();
   void set_allocated_name(::std::string* name);
+  ::std::string* unsafe_arena_release_name();
+  void unsafe_arena_set_allocated_name(
+      ::std::string* name);
 
   // uint64 groupid = 3;
   void clear_groupid();
@@ -5577,6 +6628,9 @@ class CMD_ListServersInfo : public ::google::protobuf::Message /* @@protoc_inser
  private:
 
   ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
+  friend class ::google::protobuf::Arena;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
   ::google::protobuf::internal::ArenaStringPtr addr_;
   ::google::protobuf::internal::ArenaStringPtr name_;
   ::google::protobuf::uint64 groupid_;
@@ -5599,6 +6653,12 @@ class CMD_Client_OnListServersCB : public ::google::protobuf::Message /* @@proto
     return *this;
   }
 
+  inline ::google::protobuf::Arena* GetArena() const PROTOBUF_FINAL {
+    return GetArenaNoVirtual();
+  }
+  inline void* GetMaybeArenaPointer() const PROTOBUF_FINAL {
+    return MaybeArenaPtr();
+  }
   static const ::google::protobuf::Descriptor* descriptor();
   static const CMD_Client_OnListServersCB& default_instance();
 
@@ -5607,6 +6667,7 @@ class CMD_Client_OnListServersCB : public ::google::protobuf::Message /* @@proto
                &_CMD_Client_OnListServersCB_default_instance_);
   }
 
+  void UnsafeArenaSwap(CMD_Client_OnListServersCB* other);
   void Swap(CMD_Client_OnListServersCB* other);
 
   // implements Message ----------------------------------------------
@@ -5639,12 +6700,17 @@ class CMD_Client_OnListServersCB : public ::google::protobuf::Message /* @@proto
   void SharedDtor();
   void SetCachedSize(int size) const PROTOBUF_FINAL;
   void InternalSwap(CMD_Client_OnListServersCB* other);
+  protected:
+  explicit CMD_Client_OnListServersCB(::google::protobuf::Arena* arena);
+  private:
+  static void ArenaDtor(void* object);
+  inline void RegisterArenaDtor(::google::protobuf::Arena* arena);
   private:
   inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
+    return _internal_metadata_.arena();
   }
   inline void* MaybeArenaPtr() const {
-    return NULL;
+    return _internal_metadata_.raw_arena_ptr();
   }
   public:
 
@@ -5676,6 +6742,9 @@ class CMD_Client_OnListServersCB : public ::google::protobuf::Message /* @@proto
  private:
 
   ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
+  friend class ::google::protobuf::Arena;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
   ::google::protobuf::RepeatedPtrField< ::CMD_ListServersInfo > srvs_;
   int errcode_;
   mutable int _cached_size_;
@@ -5695,6 +6764,12 @@ class CMD_Client_OnSignupCB : public ::google::protobuf::Message /* @@protoc_ins
     return *this;
   }
 
+  inline ::google::protobuf::Arena* GetArena() const PROTOBUF_FINAL {
+    return GetArenaNoVirtual();
+  }
+  inline void* GetMaybeArenaPointer() const PROTOBUF_FINAL {
+    return MaybeArenaPtr();
+  }
   static const ::google::protobuf::Descriptor* descriptor();
   static const CMD_Client_OnSignupCB& default_instance();
 
@@ -5703,6 +6778,7 @@ class CMD_Client_OnSignupCB : public ::google::protobuf::Message /* @@protoc_ins
                &_CMD_Client_OnSignupCB_default_instance_);
   }
 
+  void UnsafeArenaSwap(CMD_Client_OnSignupCB* other);
   void Swap(CMD_Client_OnSignupCB* other);
 
   // implements Message ----------------------------------------------
@@ -5735,12 +6811,17 @@ class CMD_Client_OnSignupCB : public ::google::protobuf::Message /* @@protoc_ins
   void SharedDtor();
   void SetCachedSize(int size) const PROTOBUF_FINAL;
   void InternalSwap(CMD_Client_OnSignupCB* other);
+  protected:
+  explicit CMD_Client_OnSignupCB(::google::protobuf::Arena* arena);
+  private:
+  static void ArenaDtor(void* object);
+  inline void RegisterArenaDtor(::google::protobuf::Arena* arena);
   private:
   inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
+    return _internal_metadata_.arena();
   }
   inline void* MaybeArenaPtr() const {
-    return NULL;
+    return _internal_metadata_.raw_arena_ptr();
   }
   public:
 
@@ -5755,14 +6836,14 @@ class CMD_Client_OnSignupCB : public ::google::protobuf::Message /* @@protoc_ins
   static const int kDatasFieldNumber = 2;
   const ::std::string& datas() const;
   void set_datas(const ::std::string& value);
-  #if LANG_CXX11
-  void set_datas(::std::string&& value);
-  #endif
   void set_datas(const char* value);
   void set_datas(const void* value, size_t size);
   ::std::string* mutable_datas();
   ::std::string* release_datas();
   void set_allocated_datas(::std::string* datas);
+  ::std::string* unsafe_arena_release_datas();
+  void unsafe_arena_set_allocated_datas(
+      ::std::string* datas);
 
   // .ServerError errcode = 1;
   void clear_errcode();
@@ -5774,6 +6855,9 @@ class CMD_Client_OnSignupCB : public ::google::protobuf::Message /* @@protoc_ins
  private:
 
   ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
+  friend class ::google::protobuf::Arena;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
   ::google::protobuf::internal::ArenaStringPtr datas_;
   int errcode_;
   mutable int _cached_size_;
@@ -5793,6 +6877,12 @@ class CMD_Client_OnSigninCB : public ::google::protobuf::Message /* @@protoc_ins
     return *this;
   }
 
+  inline ::google::protobuf::Arena* GetArena() const PROTOBUF_FINAL {
+    return GetArenaNoVirtual();
+  }
+  inline void* GetMaybeArenaPointer() const PROTOBUF_FINAL {
+    return MaybeArenaPtr();
+  }
   static const ::google::protobuf::Descriptor* descriptor();
   static const CMD_Client_OnSigninCB& default_instance();
 
@@ -5801,6 +6891,7 @@ class CMD_Client_OnSigninCB : public ::google::protobuf::Message /* @@protoc_ins
                &_CMD_Client_OnSigninCB_default_instance_);
   }
 
+  void UnsafeArenaSwap(CMD_Client_OnSigninCB* other);
   void Swap(CMD_Client_OnSigninCB* other);
 
   // implements Message ----------------------------------------------
@@ -5833,12 +6924,17 @@ class CMD_Client_OnSigninCB : public ::google::protobuf::Message /* @@protoc_ins
   void SharedDtor();
   void SetCachedSize(int size) const PROTOBUF_FINAL;
   void InternalSwap(CMD_Client_OnSigninCB* other);
+  protected:
+  explicit CMD_Client_OnSigninCB(::google::protobuf::Arena* arena);
+  private:
+  static void ArenaDtor(void* object);
+  inline void RegisterArenaDtor(::google::protobuf::Arena* arena);
   private:
   inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
+    return _internal_metadata_.arena();
   }
   inline void* MaybeArenaPtr() const {
-    return NULL;
+    return _internal_metadata_.raw_arena_ptr();
   }
   public:
 
@@ -5853,28 +6949,28 @@ class CMD_Client_OnSigninCB : public ::google::protobuf::Message /* @@protoc_ins
   static const int kDatasFieldNumber = 2;
   const ::std::string& datas() const;
   void set_datas(const ::std::string& value);
-  #if LANG_CXX11
-  void set_datas(::std::string&& value);
-  #endif
   void set_datas(const char* value);
   void set_datas(const void* value, size_t size);
   ::std::string* mutable_datas();
   ::std::string* release_datas();
   void set_allocated_datas(::std::string* datas);
+  ::std::string* unsafe_arena_release_datas();
+  void unsafe_arena_set_allocated_datas(
+      ::std::string* datas);
 
   // string addr = 3;
   void clear_addr();
   static const int kAddrFieldNumber = 3;
   const ::std::string& addr() const;
   void set_addr(const ::std::string& value);
-  #if LANG_CXX11
-  void set_addr(::std::string&& value);
-  #endif
   void set_addr(const char* value);
   void set_addr(const char* value, size_t size);
   ::std::string* mutable_addr();
   ::std::string* release_addr();
   void set_allocated_addr(::std::string* addr);
+  ::std::string* unsafe_arena_release_addr();
+  void unsafe_arena_set_allocated_addr(
+      ::std::string* addr);
 
   // .ServerError errcode = 1;
   void clear_errcode();
@@ -5894,15 +6990,25 @@ class CMD_Client_OnSigninCB : public ::google::protobuf::Message /* @@protoc_ins
   ::google::protobuf::uint64 tokenid() const;
   void set_tokenid(::google::protobuf::uint64 value);
 
+  // uint64 hallsID = 6;
+  void clear_hallsid();
+  static const int kHallsIDFieldNumber = 6;
+  ::google::protobuf::uint64 hallsid() const;
+  void set_hallsid(::google::protobuf::uint64 value);
+
   // @@protoc_insertion_point(class_scope:CMD_Client_OnSigninCB)
  private:
 
   ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
+  friend class ::google::protobuf::Arena;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
   ::google::protobuf::internal::ArenaStringPtr datas_;
   ::google::protobuf::internal::ArenaStringPtr addr_;
   int errcode_;
   ::google::protobuf::int32 port_;
   ::google::protobuf::uint64 tokenid_;
+  ::google::protobuf::uint64 hallsid_;
   mutable int _cached_size_;
   friend struct  protobuf_Commands_2eproto::TableStruct;
 };
@@ -5920,6 +7026,12 @@ class CMD_PlayerContext : public ::google::protobuf::Message /* @@protoc_inserti
     return *this;
   }
 
+  inline ::google::protobuf::Arena* GetArena() const PROTOBUF_FINAL {
+    return GetArenaNoVirtual();
+  }
+  inline void* GetMaybeArenaPointer() const PROTOBUF_FINAL {
+    return MaybeArenaPtr();
+  }
   static const ::google::protobuf::Descriptor* descriptor();
   static const CMD_PlayerContext& default_instance();
 
@@ -5928,6 +7040,7 @@ class CMD_PlayerContext : public ::google::protobuf::Message /* @@protoc_inserti
                &_CMD_PlayerContext_default_instance_);
   }
 
+  void UnsafeArenaSwap(CMD_PlayerContext* other);
   void Swap(CMD_PlayerContext* other);
 
   // implements Message ----------------------------------------------
@@ -5960,12 +7073,17 @@ class CMD_PlayerContext : public ::google::protobuf::Message /* @@protoc_inserti
   void SharedDtor();
   void SetCachedSize(int size) const PROTOBUF_FINAL;
   void InternalSwap(CMD_PlayerContext* other);
+  protected:
+  explicit CMD_PlayerContext(::google::protobuf::Arena* arena);
+  private:
+  static void ArenaDtor(void* object);
+  inline void RegisterArenaDtor(::google::protobuf::Arena* arena);
   private:
   inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
+    return _internal_metadata_.arena();
   }
   inline void* MaybeArenaPtr() const {
-    return NULL;
+    return _internal_metadata_.raw_arena_ptr();
   }
   public:
 
@@ -5992,28 +7110,28 @@ class CMD_PlayerContext : public ::google::protobuf::Message /* @@protoc_inserti
   static const int kPlayerNameFieldNumber = 2;
   const ::std::string& playername() const;
   void set_playername(const ::std::string& value);
-  #if LANG_CXX11
-  void set_playername(::std::string&& value);
-  #endif
   void set_playername(const char* value);
   void set_playername(const char* value, size_t size);
   ::std::string* mutable_playername();
   ::std::string* release_playername();
   void set_allocated_playername(::std::string* playername);
+  ::std::string* unsafe_arena_release_playername();
+  void unsafe_arena_set_allocated_playername(
+      ::std::string* playername);
 
   // string gameServerIP = 8;
   void clear_gameserverip();
   static const int kGameServerIPFieldNumber = 8;
   const ::std::string& gameserverip() const;
   void set_gameserverip(const ::std::string& value);
-  #if LANG_CXX11
-  void set_gameserverip(::std::string&& value);
-  #endif
   void set_gameserverip(const char* value);
   void set_gameserverip(const char* value, size_t size);
   ::std::string* mutable_gameserverip();
   ::std::string* release_gameserverip();
   void set_allocated_gameserverip(::std::string* gameserverip);
+  ::std::string* unsafe_arena_release_gameserverip();
+  void unsafe_arena_set_allocated_gameserverip(
+      ::std::string* gameserverip);
 
   // uint64 playerID = 1;
   void clear_playerid();
@@ -6085,6 +7203,9 @@ class CMD_PlayerContext : public ::google::protobuf::Message /* @@protoc_inserti
  private:
 
   ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
+  friend class ::google::protobuf::Arena;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
   ::google::protobuf::RepeatedPtrField< ::CMD_RoomPlayerInfo > gameplayers_;
   ::google::protobuf::internal::ArenaStringPtr playername_;
   ::google::protobuf::internal::ArenaStringPtr gameserverip_;
@@ -6116,6 +7237,12 @@ class CMD_Client_UpdatePlayerContext : public ::google::protobuf::Message /* @@p
     return *this;
   }
 
+  inline ::google::protobuf::Arena* GetArena() const PROTOBUF_FINAL {
+    return GetArenaNoVirtual();
+  }
+  inline void* GetMaybeArenaPointer() const PROTOBUF_FINAL {
+    return MaybeArenaPtr();
+  }
   static const ::google::protobuf::Descriptor* descriptor();
   static const CMD_Client_UpdatePlayerContext& default_instance();
 
@@ -6124,6 +7251,7 @@ class CMD_Client_UpdatePlayerContext : public ::google::protobuf::Message /* @@p
                &_CMD_Client_UpdatePlayerContext_default_instance_);
   }
 
+  void UnsafeArenaSwap(CMD_Client_UpdatePlayerContext* other);
   void Swap(CMD_Client_UpdatePlayerContext* other);
 
   // implements Message ----------------------------------------------
@@ -6156,12 +7284,17 @@ class CMD_Client_UpdatePlayerContext : public ::google::protobuf::Message /* @@p
   void SharedDtor();
   void SetCachedSize(int size) const PROTOBUF_FINAL;
   void InternalSwap(CMD_Client_UpdatePlayerContext* other);
+  protected:
+  explicit CMD_Client_UpdatePlayerContext(::google::protobuf::Arena* arena);
+  private:
+  static void ArenaDtor(void* object);
+  inline void RegisterArenaDtor(::google::protobuf::Arena* arena);
   private:
   inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
+    return _internal_metadata_.arena();
   }
   inline void* MaybeArenaPtr() const {
-    return NULL;
+    return _internal_metadata_.raw_arena_ptr();
   }
   public:
 
@@ -6175,15 +7308,27 @@ class CMD_Client_UpdatePlayerContext : public ::google::protobuf::Message /* @@p
   bool has_playercontext() const;
   void clear_playercontext();
   static const int kPlayerContextFieldNumber = 1;
+  private:
+  void _slow_mutable_playercontext();
+  void _slow_set_allocated_playercontext(
+      ::google::protobuf::Arena* message_arena, ::CMD_PlayerContext** playercontext);
+  ::CMD_PlayerContext* _slow_release_playercontext();
+  public:
   const ::CMD_PlayerContext& playercontext() const;
   ::CMD_PlayerContext* mutable_playercontext();
   ::CMD_PlayerContext* release_playercontext();
   void set_allocated_playercontext(::CMD_PlayerContext* playercontext);
+  ::CMD_PlayerContext* unsafe_arena_release_playercontext();
+  void unsafe_arena_set_allocated_playercontext(
+      ::CMD_PlayerContext* playercontext);
 
   // @@protoc_insertion_point(class_scope:CMD_Client_UpdatePlayerContext)
  private:
 
   ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
+  friend class ::google::protobuf::Arena;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
   ::CMD_PlayerContext* playercontext_;
   mutable int _cached_size_;
   friend struct  protobuf_Commands_2eproto::TableStruct;
@@ -6202,6 +7347,12 @@ class CMD_GameModeInfos : public ::google::protobuf::Message /* @@protoc_inserti
     return *this;
   }
 
+  inline ::google::protobuf::Arena* GetArena() const PROTOBUF_FINAL {
+    return GetArenaNoVirtual();
+  }
+  inline void* GetMaybeArenaPointer() const PROTOBUF_FINAL {
+    return MaybeArenaPtr();
+  }
   static const ::google::protobuf::Descriptor* descriptor();
   static const CMD_GameModeInfos& default_instance();
 
@@ -6210,6 +7361,7 @@ class CMD_GameModeInfos : public ::google::protobuf::Message /* @@protoc_inserti
                &_CMD_GameModeInfos_default_instance_);
   }
 
+  void UnsafeArenaSwap(CMD_GameModeInfos* other);
   void Swap(CMD_GameModeInfos* other);
 
   // implements Message ----------------------------------------------
@@ -6242,12 +7394,17 @@ class CMD_GameModeInfos : public ::google::protobuf::Message /* @@protoc_inserti
   void SharedDtor();
   void SetCachedSize(int size) const PROTOBUF_FINAL;
   void InternalSwap(CMD_GameModeInfos* other);
+  protected:
+  explicit CMD_GameModeInfos(::google::protobuf::Arena* arena);
+  private:
+  static void ArenaDtor(void* object);
+  inline void RegisterArenaDtor(::google::protobuf::Arena* arena);
   private:
   inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
+    return _internal_metadata_.arena();
   }
   inline void* MaybeArenaPtr() const {
-    return NULL;
+    return _internal_metadata_.raw_arena_ptr();
   }
   public:
 
@@ -6262,14 +7419,14 @@ class CMD_GameModeInfos : public ::google::protobuf::Message /* @@protoc_inserti
   static const int kGameModeNameFieldNumber = 2;
   const ::std::string& gamemodename() const;
   void set_gamemodename(const ::std::string& value);
-  #if LANG_CXX11
-  void set_gamemodename(::std::string&& value);
-  #endif
   void set_gamemodename(const char* value);
   void set_gamemodename(const char* value, size_t size);
   ::std::string* mutable_gamemodename();
   ::std::string* release_gamemodename();
   void set_allocated_gamemodename(::std::string* gamemodename);
+  ::std::string* unsafe_arena_release_gamemodename();
+  void unsafe_arena_set_allocated_gamemodename(
+      ::std::string* gamemodename);
 
   // uint32 gameModeID = 1;
   void clear_gamemodeid();
@@ -6293,6 +7450,9 @@ class CMD_GameModeInfos : public ::google::protobuf::Message /* @@protoc_inserti
  private:
 
   ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
+  friend class ::google::protobuf::Arena;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
   ::google::protobuf::internal::ArenaStringPtr gamemodename_;
   ::google::protobuf::uint32 gamemodeid_;
   ::google::protobuf::uint32 playermax_;
@@ -6314,6 +7474,12 @@ class CMD_GameInfos : public ::google::protobuf::Message /* @@protoc_insertion_p
     return *this;
   }
 
+  inline ::google::protobuf::Arena* GetArena() const PROTOBUF_FINAL {
+    return GetArenaNoVirtual();
+  }
+  inline void* GetMaybeArenaPointer() const PROTOBUF_FINAL {
+    return MaybeArenaPtr();
+  }
   static const ::google::protobuf::Descriptor* descriptor();
   static const CMD_GameInfos& default_instance();
 
@@ -6322,6 +7488,7 @@ class CMD_GameInfos : public ::google::protobuf::Message /* @@protoc_insertion_p
                &_CMD_GameInfos_default_instance_);
   }
 
+  void UnsafeArenaSwap(CMD_GameInfos* other);
   void Swap(CMD_GameInfos* other);
 
   // implements Message ----------------------------------------------
@@ -6354,12 +7521,17 @@ class CMD_GameInfos : public ::google::protobuf::Message /* @@protoc_insertion_p
   void SharedDtor();
   void SetCachedSize(int size) const PROTOBUF_FINAL;
   void InternalSwap(CMD_GameInfos* other);
+  protected:
+  explicit CMD_GameInfos(::google::protobuf::Arena* arena);
+  private:
+  static void ArenaDtor(void* object);
+  inline void RegisterArenaDtor(::google::protobuf::Arena* arena);
   private:
   inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
+    return _internal_metadata_.arena();
   }
   inline void* MaybeArenaPtr() const {
-    return NULL;
+    return _internal_metadata_.raw_arena_ptr();
   }
   public:
 
@@ -6386,42 +7558,42 @@ class CMD_GameInfos : public ::google::protobuf::Message /* @@protoc_insertion_p
   static const int kGameNameFieldNumber = 4;
   const ::std::string& gamename() const;
   void set_gamename(const ::std::string& value);
-  #if LANG_CXX11
-  void set_gamename(::std::string&& value);
-  #endif
   void set_gamename(const char* value);
   void set_gamename(const char* value, size_t size);
   ::std::string* mutable_gamename();
   ::std::string* release_gamename();
   void set_allocated_gamename(::std::string* gamename);
+  ::std::string* unsafe_arena_release_gamename();
+  void unsafe_arena_set_allocated_gamename(
+      ::std::string* gamename);
 
   // string url_icon = 5;
   void clear_url_icon();
   static const int kUrlIconFieldNumber = 5;
   const ::std::string& url_icon() const;
   void set_url_icon(const ::std::string& value);
-  #if LANG_CXX11
-  void set_url_icon(::std::string&& value);
-  #endif
   void set_url_icon(const char* value);
   void set_url_icon(const char* value, size_t size);
   ::std::string* mutable_url_icon();
   ::std::string* release_url_icon();
   void set_allocated_url_icon(::std::string* url_icon);
+  ::std::string* unsafe_arena_release_url_icon();
+  void unsafe_arena_set_allocated_url_icon(
+      ::std::string* url_icon);
 
   // string url_apk = 6;
   void clear_url_apk();
   static const int kUrlApkFieldNumber = 6;
   const ::std::string& url_apk() const;
   void set_url_apk(const ::std::string& value);
-  #if LANG_CXX11
-  void set_url_apk(::std::string&& value);
-  #endif
   void set_url_apk(const char* value);
   void set_url_apk(const char* value, size_t size);
   ::std::string* mutable_url_apk();
   ::std::string* release_url_apk();
   void set_allocated_url_apk(::std::string* url_apk);
+  ::std::string* unsafe_arena_release_url_apk();
+  void unsafe_arena_set_allocated_url_apk(
+      ::std::string* url_apk);
 
   // uint64 gameID = 1;
   void clear_gameid();
@@ -6445,6 +7617,9 @@ class CMD_GameInfos : public ::google::protobuf::Message /* @@protoc_insertion_p
  private:
 
   ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
+  friend class ::google::protobuf::Arena;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
   ::google::protobuf::RepeatedPtrField< ::CMD_GameModeInfos > gamemodes_;
   ::google::protobuf::internal::ArenaStringPtr gamename_;
   ::google::protobuf::internal::ArenaStringPtr url_icon_;
@@ -6469,6 +7644,12 @@ class CMD_Client_OnListGamesCB : public ::google::protobuf::Message /* @@protoc_
     return *this;
   }
 
+  inline ::google::protobuf::Arena* GetArena() const PROTOBUF_FINAL {
+    return GetArenaNoVirtual();
+  }
+  inline void* GetMaybeArenaPointer() const PROTOBUF_FINAL {
+    return MaybeArenaPtr();
+  }
   static const ::google::protobuf::Descriptor* descriptor();
   static const CMD_Client_OnListGamesCB& default_instance();
 
@@ -6477,6 +7658,7 @@ class CMD_Client_OnListGamesCB : public ::google::protobuf::Message /* @@protoc_
                &_CMD_Client_OnListGamesCB_default_instance_);
   }
 
+  void UnsafeArenaSwap(CMD_Client_OnListGamesCB* other);
   void Swap(CMD_Client_OnListGamesCB* other);
 
   // implements Message ----------------------------------------------
@@ -6509,12 +7691,17 @@ class CMD_Client_OnListGamesCB : public ::google::protobuf::Message /* @@protoc_
   void SharedDtor();
   void SetCachedSize(int size) const PROTOBUF_FINAL;
   void InternalSwap(CMD_Client_OnListGamesCB* other);
+  protected:
+  explicit CMD_Client_OnListGamesCB(::google::protobuf::Arena* arena);
+  private:
+  static void ArenaDtor(void* object);
+  inline void RegisterArenaDtor(::google::protobuf::Arena* arena);
   private:
   inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
+    return _internal_metadata_.arena();
   }
   inline void* MaybeArenaPtr() const {
-    return NULL;
+    return _internal_metadata_.raw_arena_ptr();
   }
   public:
 
@@ -6558,6 +7745,9 @@ class CMD_Client_OnListGamesCB : public ::google::protobuf::Message /* @@protoc_
  private:
 
   ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
+  friend class ::google::protobuf::Arena;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
   ::google::protobuf::RepeatedPtrField< ::CMD_GameInfos > gameinfos_;
   ::google::protobuf::uint32 page_;
   ::google::protobuf::uint32 type_;
@@ -6579,6 +7769,12 @@ class CMD_Client_OnLoginCB : public ::google::protobuf::Message /* @@protoc_inse
     return *this;
   }
 
+  inline ::google::protobuf::Arena* GetArena() const PROTOBUF_FINAL {
+    return GetArenaNoVirtual();
+  }
+  inline void* GetMaybeArenaPointer() const PROTOBUF_FINAL {
+    return MaybeArenaPtr();
+  }
   static const ::google::protobuf::Descriptor* descriptor();
   static const CMD_Client_OnLoginCB& default_instance();
 
@@ -6587,6 +7783,7 @@ class CMD_Client_OnLoginCB : public ::google::protobuf::Message /* @@protoc_inse
                &_CMD_Client_OnLoginCB_default_instance_);
   }
 
+  void UnsafeArenaSwap(CMD_Client_OnLoginCB* other);
   void Swap(CMD_Client_OnLoginCB* other);
 
   // implements Message ----------------------------------------------
@@ -6619,12 +7816,17 @@ class CMD_Client_OnLoginCB : public ::google::protobuf::Message /* @@protoc_inse
   void SharedDtor();
   void SetCachedSize(int size) const PROTOBUF_FINAL;
   void InternalSwap(CMD_Client_OnLoginCB* other);
+  protected:
+  explicit CMD_Client_OnLoginCB(::google::protobuf::Arena* arena);
+  private:
+  static void ArenaDtor(void* object);
+  inline void RegisterArenaDtor(::google::protobuf::Arena* arena);
   private:
   inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
+    return _internal_metadata_.arena();
   }
   inline void* MaybeArenaPtr() const {
-    return NULL;
+    return _internal_metadata_.raw_arena_ptr();
   }
   public:
 
@@ -6639,29 +7841,32 @@ class CMD_Client_OnLoginCB : public ::google::protobuf::Message /* @@protoc_inse
   static const int kDatasFieldNumber = 2;
   const ::std::string& datas() const;
   void set_datas(const ::std::string& value);
-  #if LANG_CXX11
-  void set_datas(::std::string&& value);
-  #endif
   void set_datas(const char* value);
   void set_datas(const void* value, size_t size);
   ::std::string* mutable_datas();
   ::std::string* release_datas();
   void set_allocated_datas(::std::string* datas);
+  ::std::string* unsafe_arena_release_datas();
+  void unsafe_arena_set_allocated_datas(
+      ::std::string* datas);
 
   // .CMD_PlayerContext playerContext = 3;
   bool has_playercontext() const;
   void clear_playercontext();
   static const int kPlayerContextFieldNumber = 3;
+  private:
+  void _slow_mutable_playercontext();
+  void _slow_set_allocated_playercontext(
+      ::google::protobuf::Arena* message_arena, ::CMD_PlayerContext** playercontext);
+  ::CMD_PlayerContext* _slow_release_playercontext();
+  public:
   const ::CMD_PlayerContext& playercontext() const;
   ::CMD_PlayerContext* mutable_playercontext();
   ::CMD_PlayerContext* release_playercontext();
   void set_allocated_playercontext(::CMD_PlayerContext* playercontext);
-
-  // uint64 hallsID = 4;
-  void clear_hallsid();
-  static const int kHallsIDFieldNumber = 4;
-  ::google::protobuf::uint64 hallsid() const;
-  void set_hallsid(::google::protobuf::uint64 value);
+  ::CMD_PlayerContext* unsafe_arena_release_playercontext();
+  void unsafe_arena_set_allocated_playercontext(
+      ::CMD_PlayerContext* playercontext);
 
   // .ServerError errcode = 1;
   void clear_errcode();
@@ -6673,9 +7878,11 @@ class CMD_Client_OnLoginCB : public ::google::protobuf::Message /* @@protoc_inse
  private:
 
   ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
+  friend class ::google::protobuf::Arena;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
   ::google::protobuf::internal::ArenaStringPtr datas_;
   ::CMD_PlayerContext* playercontext_;
-  ::google::protobuf::uint64 hallsid_;
   int errcode_;
   mutable int _cached_size_;
   friend struct  protobuf_Commands_2eproto::TableStruct;
@@ -6694,6 +7901,12 @@ class CMD_Client_OnMatchingUpdate : public ::google::protobuf::Message /* @@prot
     return *this;
   }
 
+  inline ::google::protobuf::Arena* GetArena() const PROTOBUF_FINAL {
+    return GetArenaNoVirtual();
+  }
+  inline void* GetMaybeArenaPointer() const PROTOBUF_FINAL {
+    return MaybeArenaPtr();
+  }
   static const ::google::protobuf::Descriptor* descriptor();
   static const CMD_Client_OnMatchingUpdate& default_instance();
 
@@ -6702,6 +7915,7 @@ class CMD_Client_OnMatchingUpdate : public ::google::protobuf::Message /* @@prot
                &_CMD_Client_OnMatchingUpdate_default_instance_);
   }
 
+  void UnsafeArenaSwap(CMD_Client_OnMatchingUpdate* other);
   void Swap(CMD_Client_OnMatchingUpdate* other);
 
   // implements Message ----------------------------------------------
@@ -6734,12 +7948,17 @@ class CMD_Client_OnMatchingUpdate : public ::google::protobuf::Message /* @@prot
   void SharedDtor();
   void SetCachedSize(int size) const PROTOBUF_FINAL;
   void InternalSwap(CMD_Client_OnMatchingUpdate* other);
+  protected:
+  explicit CMD_Client_OnMatchingUpdate(::google::protobuf::Arena* arena);
+  private:
+  static void ArenaDtor(void* object);
+  inline void RegisterArenaDtor(::google::protobuf::Arena* arena);
   private:
   inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
+    return _internal_metadata_.arena();
   }
   inline void* MaybeArenaPtr() const {
-    return NULL;
+    return _internal_metadata_.raw_arena_ptr();
   }
   public:
 
@@ -6754,14 +7973,14 @@ class CMD_Client_OnMatchingUpdate : public ::google::protobuf::Message /* @@prot
   static const int kNameFieldNumber = 1;
   const ::std::string& name() const;
   void set_name(const ::std::string& value);
-  #if LANG_CXX11
-  void set_name(::std::string&& value);
-  #endif
   void set_name(const char* value);
   void set_name(const char* value, size_t size);
   ::std::string* mutable_name();
   ::std::string* release_name();
   void set_allocated_name(::std::string* name);
+  ::std::string* unsafe_arena_release_name();
+  void unsafe_arena_set_allocated_name(
+      ::std::string* name);
 
   // uint64 id = 2;
   void clear_id();
@@ -6785,6 +8004,9 @@ class CMD_Client_OnMatchingUpdate : public ::google::protobuf::Message /* @@prot
  private:
 
   ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
+  friend class ::google::protobuf::Arena;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
   ::google::protobuf::internal::ArenaStringPtr name_;
   ::google::protobuf::uint64 id_;
   ::google::protobuf::int32 modelid_;
@@ -6806,6 +8028,12 @@ class CMD_Client_OnEndMatch : public ::google::protobuf::Message /* @@protoc_ins
     return *this;
   }
 
+  inline ::google::protobuf::Arena* GetArena() const PROTOBUF_FINAL {
+    return GetArenaNoVirtual();
+  }
+  inline void* GetMaybeArenaPointer() const PROTOBUF_FINAL {
+    return MaybeArenaPtr();
+  }
   static const ::google::protobuf::Descriptor* descriptor();
   static const CMD_Client_OnEndMatch& default_instance();
 
@@ -6814,6 +8042,7 @@ class CMD_Client_OnEndMatch : public ::google::protobuf::Message /* @@protoc_ins
                &_CMD_Client_OnEndMatch_default_instance_);
   }
 
+  void UnsafeArenaSwap(CMD_Client_OnEndMatch* other);
   void Swap(CMD_Client_OnEndMatch* other);
 
   // implements Message ----------------------------------------------
@@ -6846,12 +8075,17 @@ class CMD_Client_OnEndMatch : public ::google::protobuf::Message /* @@protoc_ins
   void SharedDtor();
   void SetCachedSize(int size) const PROTOBUF_FINAL;
   void InternalSwap(CMD_Client_OnEndMatch* other);
+  protected:
+  explicit CMD_Client_OnEndMatch(::google::protobuf::Arena* arena);
+  private:
+  static void ArenaDtor(void* object);
+  inline void RegisterArenaDtor(::google::protobuf::Arena* arena);
   private:
   inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
+    return _internal_metadata_.arena();
   }
   inline void* MaybeArenaPtr() const {
-    return NULL;
+    return _internal_metadata_.raw_arena_ptr();
   }
   public:
 
@@ -6866,14 +8100,14 @@ class CMD_Client_OnEndMatch : public ::google::protobuf::Message /* @@protoc_ins
   static const int kGameServerIPFieldNumber = 2;
   const ::std::string& gameserverip() const;
   void set_gameserverip(const ::std::string& value);
-  #if LANG_CXX11
-  void set_gameserverip(::std::string&& value);
-  #endif
   void set_gameserverip(const char* value);
   void set_gameserverip(const char* value, size_t size);
   ::std::string* mutable_gameserverip();
   ::std::string* release_gameserverip();
   void set_allocated_gameserverip(::std::string* gameserverip);
+  ::std::string* unsafe_arena_release_gameserverip();
+  void unsafe_arena_set_allocated_gameserverip(
+      ::std::string* gameserverip);
 
   // .ServerError errcode = 1;
   void clear_errcode();
@@ -6945,6 +8179,9 @@ class CMD_Client_OnEndMatch : public ::google::protobuf::Message /* @@protoc_ins
  private:
 
   ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
+  friend class ::google::protobuf::Arena;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
   ::google::protobuf::internal::ArenaStringPtr gameserverip_;
   int errcode_;
   ::google::protobuf::int32 gameserverport_;
@@ -6974,6 +8211,12 @@ class CMD_Client_OnGameOver : public ::google::protobuf::Message /* @@protoc_ins
     return *this;
   }
 
+  inline ::google::protobuf::Arena* GetArena() const PROTOBUF_FINAL {
+    return GetArenaNoVirtual();
+  }
+  inline void* GetMaybeArenaPointer() const PROTOBUF_FINAL {
+    return MaybeArenaPtr();
+  }
   static const ::google::protobuf::Descriptor* descriptor();
   static const CMD_Client_OnGameOver& default_instance();
 
@@ -6982,6 +8225,7 @@ class CMD_Client_OnGameOver : public ::google::protobuf::Message /* @@protoc_ins
                &_CMD_Client_OnGameOver_default_instance_);
   }
 
+  void UnsafeArenaSwap(CMD_Client_OnGameOver* other);
   void Swap(CMD_Client_OnGameOver* other);
 
   // implements Message ----------------------------------------------
@@ -7014,12 +8258,17 @@ class CMD_Client_OnGameOver : public ::google::protobuf::Message /* @@protoc_ins
   void SharedDtor();
   void SetCachedSize(int size) const PROTOBUF_FINAL;
   void InternalSwap(CMD_Client_OnGameOver* other);
+  protected:
+  explicit CMD_Client_OnGameOver(::google::protobuf::Arena* arena);
+  private:
+  static void ArenaDtor(void* object);
+  inline void RegisterArenaDtor(::google::protobuf::Arena* arena);
   private:
   inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
+    return _internal_metadata_.arena();
   }
   inline void* MaybeArenaPtr() const {
-    return NULL;
+    return _internal_metadata_.raw_arena_ptr();
   }
   public:
 
@@ -7057,6 +8306,9 @@ class CMD_Client_OnGameOver : public ::google::protobuf::Message /* @@protoc_ins
  private:
 
   ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
+  friend class ::google::protobuf::Arena;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
   ::google::protobuf::uint64 gameid_;
   int errcode_;
   ::google::protobuf::int32 gamemode_;
@@ -7078,6 +8330,12 @@ class CMD_Client_OnCancelMatch : public ::google::protobuf::Message /* @@protoc_
     return *this;
   }
 
+  inline ::google::protobuf::Arena* GetArena() const PROTOBUF_FINAL {
+    return GetArenaNoVirtual();
+  }
+  inline void* GetMaybeArenaPointer() const PROTOBUF_FINAL {
+    return MaybeArenaPtr();
+  }
   static const ::google::protobuf::Descriptor* descriptor();
   static const CMD_Client_OnCancelMatch& default_instance();
 
@@ -7086,6 +8344,7 @@ class CMD_Client_OnCancelMatch : public ::google::protobuf::Message /* @@protoc_
                &_CMD_Client_OnCancelMatch_default_instance_);
   }
 
+  void UnsafeArenaSwap(CMD_Client_OnCancelMatch* other);
   void Swap(CMD_Client_OnCancelMatch* other);
 
   // implements Message ----------------------------------------------
@@ -7118,12 +8377,17 @@ class CMD_Client_OnCancelMatch : public ::google::protobuf::Message /* @@protoc_
   void SharedDtor();
   void SetCachedSize(int size) const PROTOBUF_FINAL;
   void InternalSwap(CMD_Client_OnCancelMatch* other);
+  protected:
+  explicit CMD_Client_OnCancelMatch(::google::protobuf::Arena* arena);
+  private:
+  static void ArenaDtor(void* object);
+  inline void RegisterArenaDtor(::google::protobuf::Arena* arena);
   private:
   inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
+    return _internal_metadata_.arena();
   }
   inline void* MaybeArenaPtr() const {
-    return NULL;
+    return _internal_metadata_.raw_arena_ptr();
   }
   public:
 
@@ -7143,6 +8407,9 @@ class CMD_Client_OnCancelMatch : public ::google::protobuf::Message /* @@protoc_
  private:
 
   ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
+  friend class ::google::protobuf::Arena;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
   int errcode_;
   mutable int _cached_size_;
   friend struct  protobuf_Commands_2eproto::TableStruct;
@@ -7217,45 +8484,46 @@ inline void CMD_Hello::set_appgid(::google::protobuf::uint64 value) {
 
 // string name = 5;
 inline void CMD_Hello::clear_name() {
-  name_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  name_.ClearToEmpty(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 inline const ::std::string& CMD_Hello::name() const {
   // @@protoc_insertion_point(field_get:CMD_Hello.name)
-  return name_.GetNoArena();
+  return name_.Get();
 }
 inline void CMD_Hello::set_name(const ::std::string& value) {
   
-  name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  name_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value, GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set:CMD_Hello.name)
 }
-#if LANG_CXX11
-inline void CMD_Hello::set_name(::std::string&& value) {
-  
-  name_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:CMD_Hello.name)
-}
-#endif
 inline void CMD_Hello::set_name(const char* value) {
   
-  name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  name_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+              GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_char:CMD_Hello.name)
 }
-inline void CMD_Hello::set_name(const char* value, size_t size) {
+inline void CMD_Hello::set_name(const char* value,
+    size_t size) {
   
-  name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
+  name_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_pointer:CMD_Hello.name)
 }
 inline ::std::string* CMD_Hello::mutable_name() {
   
   // @@protoc_insertion_point(field_mutable:CMD_Hello.name)
-  return name_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return name_.Mutable(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 inline ::std::string* CMD_Hello::release_name() {
   // @@protoc_insertion_point(field_release:CMD_Hello.name)
   
-  return name_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return name_.Release(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
+}
+inline ::std::string* CMD_Hello::unsafe_arena_release_name() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:CMD_Hello.name)
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  
+  return name_.UnsafeArenaRelease(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      GetArenaNoVirtual());
 }
 inline void CMD_Hello::set_allocated_name(::std::string* name) {
   if (name != NULL) {
@@ -7263,9 +8531,238 @@ inline void CMD_Hello::set_allocated_name(::std::string* name) {
   } else {
     
   }
-  name_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), name);
+  name_.SetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), name,
+      GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_allocated:CMD_Hello.name)
 }
+inline void CMD_Hello::unsafe_arena_set_allocated_name(
+    ::std::string* name) {
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  if (name != NULL) {
+    
+  } else {
+    
+  }
+  name_.UnsafeArenaSetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      name, GetArenaNoVirtual());
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:CMD_Hello.name)
+}
+
+// uint32 frameVersion = 6;
+inline void CMD_Hello::clear_frameversion() {
+  frameversion_ = 0u;
+}
+inline ::google::protobuf::uint32 CMD_Hello::frameversion() const {
+  // @@protoc_insertion_point(field_get:CMD_Hello.frameVersion)
+  return frameversion_;
+}
+inline void CMD_Hello::set_frameversion(::google::protobuf::uint32 value) {
+  
+  frameversion_ = value;
+  // @@protoc_insertion_point(field_set:CMD_Hello.frameVersion)
+}
+
+// uint32 compression = 7;
+inline void CMD_Hello::clear_compression() {
+  compression_ = 0u;
+}
+inline ::google::protobuf::uint32 CMD_Hello::compression() const {
+  // @@protoc_insertion_point(field_get:CMD_Hello.compression)
+  return compression_;
+}
+inline void CMD_Hello::set_compression(::google::protobuf::uint32 value) {
+  
+  compression_ = value;
+  // @@protoc_insertion_point(field_set:CMD_Hello.compression)
+}
+
+// uint32 compressDict = 8;
+inline void CMD_Hello::clear_compressdict() {
+  compressdict_ = 0u;
+}
+inline ::google::protobuf::uint32 CMD_Hello::compressdict() const {
+  // @@protoc_insertion_point(field_get:CMD_Hello.compressDict)
+  return compressdict_;
+}
+inline void CMD_Hello::set_compressdict(::google::protobuf::uint32 value) {
+  
+  compressdict_ = value;
+  // @@protoc_insertion_point(field_set:CMD_Hello.compressDict)
+}
+
+// uint32 ciphers = 9;
+inline void CMD_Hello::clear_ciphers() {
+  ciphers_ = 0u;
+}
+inline ::google::protobuf::uint32 CMD_Hello::ciphers() const {
+  // @@protoc_insertion_point(field_get:CMD_Hello.ciphers)
+  return ciphers_;
+}
+inline void CMD_Hello::set_ciphers(::google::protobuf::uint32 value) {
+  
+  ciphers_ = value;
+  // @@protoc_insertion_point(field_set:CMD_Hello.ciphers)
+}
+
+// bytes cipherKey = 10;
+inline void CMD_Hello::clear_cipherkey() {
+  cipherkey_.ClearToEmpty(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
+}
+inline const ::std::string& CMD_Hello::cipherkey() const {
+  // @@protoc_insertion_point(field_get:CMD_Hello.cipherKey)
+  return cipherkey_.Get();
+}
+inline void CMD_Hello::set_cipherkey(const ::std::string& value) {
+  
+  cipherkey_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value, GetArenaNoVirtual());
+  // @@protoc_insertion_point(field_set:CMD_Hello.cipherKey)
+}
+inline void CMD_Hello::set_cipherkey(const char* value) {
+  
+  cipherkey_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+              GetArenaNoVirtual());
+  // @@protoc_insertion_point(field_set_char:CMD_Hello.cipherKey)
+}
+inline void CMD_Hello::set_cipherkey(const void* value,
+    size_t size) {
+  
+  cipherkey_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArenaNoVirtual());
+  // @@protoc_insertion_point(field_set_pointer:CMD_Hello.cipherKey)
+}
+inline ::std::string* CMD_Hello::mutable_cipherkey() {
+  
+  // @@protoc_insertion_point(field_mutable:CMD_Hello.cipherKey)
+  return cipherkey_.Mutable(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
+}
+inline ::std::string* CMD_Hello::release_cipherkey() {
+  // @@protoc_insertion_point(field_release:CMD_Hello.cipherKey)
+  
+  return cipherkey_.Release(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
+}
+inline ::std::string* CMD_Hello::unsafe_arena_release_cipherkey() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:CMD_Hello.cipherKey)
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  
+  return cipherkey_.UnsafeArenaRelease(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      GetArenaNoVirtual());
+}
+inline void CMD_Hello::set_allocated_cipherkey(::std::string* cipherkey) {
+  if (cipherkey != NULL) {
+    
+  } else {
+    
+  }
+  cipherkey_.SetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), cipherkey,
+      GetArenaNoVirtual());
+  // @@protoc_insertion_point(field_set_allocated:CMD_Hello.cipherKey)
+}
+inline void CMD_Hello::unsafe_arena_set_allocated_cipherkey(
+    ::std::string* cipherkey) {
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  if (cipherkey != NULL) {
+    
+  } else {
+    
+  }
+  cipherkey_.UnsafeArenaSetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      cipherkey, GetArenaNoVirtual());
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:CMD_Hello.cipherKey)
+}
+
+// bool batch = 11;
+inline void CMD_Hello::clear_batch() {
+  batch_ = false;
+}
+inline bool CMD_Hello::batch() const {
+  // @@protoc_insertion_point(field_get:CMD_Hello.batch)
+  return batch_;
+}
+inline void CMD_Hello::set_batch(bool value) {
+  
+  batch_ = value;
+  // @@protoc_insertion_point(field_set:CMD_Hello.batch)
+}
+
+// string hostID = 12;
+inline void CMD_Hello::clear_hostid() {
+  hostid_.ClearToEmpty(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
+}
+inline const ::std::string& CMD_Hello::hostid() const {
+  // @@protoc_insertion_point(field_get:CMD_Hello.hostID)
+  return hostid_.Get();
+}
+inline void CMD_Hello::set_hostid(const ::std::string& value) {
+  
+  hostid_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value, GetArenaNoVirtual());
+  // @@protoc_insertion_point(field_set:CMD_Hello.hostID)
+}
+inline void CMD_Hello::set_hostid(const char* value) {
+  
+  hostid_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+              GetArenaNoVirtual());
+  // @@protoc_insertion_point(field_set_char:CMD_Hello.hostID)
+}
+inline void CMD_Hello::set_hostid(const char* value,
+    size_t size) {
+  
+  hostid_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArenaNoVirtual());
+  // @@protoc_insertion_point(field_set_pointer:CMD_Hello.hostID)
+}
+inline ::std::string* CMD_Hello::mutable_hostid() {
+  
+  // @@protoc_insertion_point(field_mutable:CMD_Hello.hostID)
+  return hostid_.Mutable(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
+}
+inline ::std::string* CMD_Hello::release_hostid() {
+  // @@protoc_insertion_point(field_release:CMD_Hello.hostID)
+  
+  return hostid_.Release(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
+}
+inline ::std::string* CMD_Hello::unsafe_arena_release_hostid() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:CMD_Hello.hostID)
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  
+  return hostid_.UnsafeArenaRelease(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      GetArenaNoVirtual());
+}
+inline void CMD_Hello::set_allocated_hostid(::std::string* hostid) {
+  if (hostid != NULL) {
+    
+  } else {
+    
+  }
+  hostid_.SetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), hostid,
+      GetArenaNoVirtual());
+  // @@protoc_insertion_point(field_set_allocated:CMD_Hello.hostID)
+}
+inline void CMD_Hello::unsafe_arena_set_allocated_hostid(
+    ::std::string* hostid) {
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  if (hostid != NULL) {
+    
+  } else {
+    
+  }
+  hostid_.UnsafeArenaSetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      hostid, GetArenaNoVirtual());
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:CMD_Hello.hostID)
+}
+
+// uint32 link = 13;
+inline void CMD_Hello::clear_link() {
+  link_ = 0u;
+}
+inline ::google::protobuf::uint32 CMD_Hello::link() const {
+  // @@protoc_insertion_point(field_get:CMD_Hello.link)
+  return link_;
+}
+inline void CMD_Hello::set_link(::google::protobuf::uint32 value) {
+  
+  link_ = value;
+  // @@protoc_insertion_point(field_set:CMD_Hello.link)
+}
 
 // -------------------------------------------------------------------
 
@@ -7329,45 +8826,46 @@ inline void CMD_HelloCB::set_appgid(::google::protobuf::uint64 value) {
 
 // string name = 5;
 inline void CMD_HelloCB::clear_name() {
-  name_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  name_.ClearToEmpty(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 inline const ::std::string& CMD_HelloCB::name() const {
   // @@protoc_insertion_point(field_get:CMD_HelloCB.name)
-  return name_.GetNoArena();
+  return name_.Get();
 }
 inline void CMD_HelloCB::set_name(const ::std::string& value) {
   
-  name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  name_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value, GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set:CMD_HelloCB.name)
 }
-#if LANG_CXX11
-inline void CMD_HelloCB::set_name(::std::string&& value) {
-  
-  name_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:CMD_HelloCB.name)
-}
-#endif
 inline void CMD_HelloCB::set_name(const char* value) {
   
-  name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  name_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+              GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_char:CMD_HelloCB.name)
 }
-inline void CMD_HelloCB::set_name(const char* value, size_t size) {
+inline void CMD_HelloCB::set_name(const char* value,
+    size_t size) {
   
-  name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
+  name_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_pointer:CMD_HelloCB.name)
 }
 inline ::std::string* CMD_HelloCB::mutable_name() {
   
   // @@protoc_insertion_point(field_mutable:CMD_HelloCB.name)
-  return name_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return name_.Mutable(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 inline ::std::string* CMD_HelloCB::release_name() {
   // @@protoc_insertion_point(field_release:CMD_HelloCB.name)
   
-  return name_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return name_.Release(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
+}
+inline ::std::string* CMD_HelloCB::unsafe_arena_release_name() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:CMD_HelloCB.name)
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  
+  return name_.UnsafeArenaRelease(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      GetArenaNoVirtual());
 }
 inline void CMD_HelloCB::set_allocated_name(::std::string* name) {
   if (name != NULL) {
@@ -7375,115 +8873,348 @@ inline void CMD_HelloCB::set_allocated_name(::std::string* name) {
   } else {
     
   }
-  name_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), name);
+  name_.SetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), name,
+      GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_allocated:CMD_HelloCB.name)
 }
+inline void CMD_HelloCB::unsafe_arena_set_allocated_name(
+    ::std::string* name) {
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  if (name != NULL) {
+    
+  } else {
+    
+  }
+  name_.UnsafeArenaSetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      name, GetArenaNoVirtual());
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:CMD_HelloCB.name)
+}
 
-// -------------------------------------------------------------------
-
-// CMD_Heartbeat
-
-// uint64 appID = 1;
-inline void CMD_Heartbeat::clear_appid() {
-  appid_ = GOOGLE_ULONGLONG(0);
+// uint32 frameVersion = 6;
+inline void CMD_HelloCB::clear_frameversion() {
+  frameversion_ = 0u;
 }
-inline ::google::protobuf::uint64 CMD_Heartbeat::appid() const {
-  // @@protoc_insertion_point(field_get:CMD_Heartbeat.appID)
-  return appid_;
+inline ::google::protobuf::uint32 CMD_HelloCB::frameversion() const {
+  // @@protoc_insertion_point(field_get:CMD_HelloCB.frameVersion)
+  return frameversion_;
 }
-inline void CMD_Heartbeat::set_appid(::google::protobuf::uint64 value) {
+inline void CMD_HelloCB::set_frameversion(::google::protobuf::uint32 value) {
   
-  appid_ = value;
-  // @@protoc_insertion_point(field_set:CMD_Heartbeat.appID)
+  frameversion_ = value;
+  // @@protoc_insertion_point(field_set:CMD_HelloCB.frameVersion)
 }
 
-// int32 appType = 2;
-inline void CMD_Heartbeat::clear_apptype() {
-  apptype_ = 0;
+// uint32 compression = 7;
+inline void CMD_HelloCB::clear_compression() {
+  compression_ = 0u;
 }
-inline ::google::protobuf::int32 CMD_Heartbeat::apptype() const {
-  // @@protoc_insertion_point(field_get:CMD_Heartbeat.appType)
-  return apptype_;
+inline ::google::protobuf::uint32 CMD_HelloCB::compression() const {
+  // @@protoc_insertion_point(field_get:CMD_HelloCB.compression)
+  return compression_;
 }
-inline void CMD_Heartbeat::set_apptype(::google::protobuf::int32 value) {
+inline void CMD_HelloCB::set_compression(::google::protobuf::uint32 value) {
   
-  apptype_ = value;
-  // @@protoc_insertion_point(field_set:CMD_Heartbeat.appType)
+  compression_ = value;
+  // @@protoc_insertion_point(field_set:CMD_HelloCB.compression)
 }
 
-// -------------------------------------------------------------------
-
-// CMD_HeartbeatCB
-
-// uint64 appID = 1;
-inline void CMD_HeartbeatCB::clear_appid() {
-  appid_ = GOOGLE_ULONGLONG(0);
+// uint32 compressDict = 8;
+inline void CMD_HelloCB::clear_compressdict() {
+  compressdict_ = 0u;
 }
-inline ::google::protobuf::uint64 CMD_HeartbeatCB::appid() const {
-  // @@protoc_insertion_point(field_get:CMD_HeartbeatCB.appID)
-  return appid_;
+inline ::google::protobuf::uint32 CMD_HelloCB::compressdict() const {
+  // @@protoc_insertion_point(field_get:CMD_HelloCB.compressDict)
+  return compressdict_;
 }
-inline void CMD_HeartbeatCB::set_appid(::google::protobuf::uint64 value) {
+inline void CMD_HelloCB::set_compressdict(::google::protobuf::uint32 value) {
   
-  appid_ = value;
-  // @@protoc_insertion_point(field_set:CMD_HeartbeatCB.appID)
+  compressdict_ = value;
+  // @@protoc_insertion_point(field_set:CMD_HelloCB.compressDict)
 }
 
-// int32 appType = 2;
-inline void CMD_HeartbeatCB::clear_apptype() {
-  apptype_ = 0;
+// uint32 cipher = 9;
+inline void CMD_HelloCB::clear_cipher() {
+  cipher_ = 0u;
 }
-inline ::google::protobuf::int32 CMD_HeartbeatCB::apptype() const {
-  // @@protoc_insertion_point(field_get:CMD_HeartbeatCB.appType)
-  return apptype_;
+inline ::google::protobuf::uint32 CMD_HelloCB::cipher() const {
+  // @@protoc_insertion_point(field_get:CMD_HelloCB.cipher)
+  return cipher_;
 }
-inline void CMD_HeartbeatCB::set_apptype(::google::protobuf::int32 value) {
+inline void CMD_HelloCB::set_cipher(::google::protobuf::uint32 value) {
   
-  apptype_ = value;
-  // @@protoc_insertion_point(field_set:CMD_HeartbeatCB.appType)
+  cipher_ = value;
+  // @@protoc_insertion_point(field_set:CMD_HelloCB.cipher)
 }
 
-// -------------------------------------------------------------------
-
-// CMD_Version_Not_Match
-
-// int32 version = 1;
-inline void CMD_Version_Not_Match::clear_version() {
-  version_ = 0;
+// bytes cipherKey = 10;
+inline void CMD_HelloCB::clear_cipherkey() {
+  cipherkey_.ClearToEmpty(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
-inline ::google::protobuf::int32 CMD_Version_Not_Match::version() const {
-  // @@protoc_insertion_point(field_get:CMD_Version_Not_Match.version)
-  return version_;
+inline const ::std::string& CMD_HelloCB::cipherkey() const {
+  // @@protoc_insertion_point(field_get:CMD_HelloCB.cipherKey)
+  return cipherkey_.Get();
 }
-inline void CMD_Version_Not_Match::set_version(::google::protobuf::int32 value) {
+inline void CMD_HelloCB::set_cipherkey(const ::std::string& value) {
   
-  version_ = value;
-  // @@protoc_insertion_point(field_set:CMD_Version_Not_Match.version)
-}
-
-// uint64 appID = 2;
-inline void CMD_Version_Not_Match::clear_appid() {
-  appid_ = GOOGLE_ULONGLONG(0);
+  cipherkey_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value, GetArenaNoVirtual());
+  // @@protoc_insertion_point(field_set:CMD_HelloCB.cipherKey)
 }
-inline ::google::protobuf::uint64 CMD_Version_Not_Match::appid() const {
-  // @@protoc_insertion_point(field_get:CMD_Version_Not_Match.appID)
-  return appid_;
+inline void CMD_HelloCB::set_cipherkey(const char* value) {
+  
+  cipherkey_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+              GetArenaNoVirtual());
+  // @@protoc_insertion_point(field_set_char:CMD_HelloCB.cipherKey)
 }
-inline void CMD_Version_Not_Match::set_appid(::google::protobuf::uint64 value) {
+inline void CMD_HelloCB::set_cipherkey(const void* value,
+    size_t size) {
   
-  appid_ = value;
-  // @@protoc_insertion_point(field_set:CMD_Version_Not_Match.appID)
+  cipherkey_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArenaNoVirtual());
+  // @@protoc_insertion_point(field_set_pointer:CMD_HelloCB.cipherKey)
 }
-
-// int32 appType = 3;
-inline void CMD_Version_Not_Match::clear_apptype() {
-  apptype_ = 0;
+inline ::std::string* CMD_HelloCB::mutable_cipherkey() {
+  
+  // @@protoc_insertion_point(field_mutable:CMD_HelloCB.cipherKey)
+  return cipherkey_.Mutable(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
-inline ::google::protobuf::int32 CMD_Version_Not_Match::apptype() const {
-  // @@protoc_insertion_point(field_get:CMD_Version_Not_Match.appType)
-  return apptype_;
+inline ::std::string* CMD_HelloCB::release_cipherkey() {
+  // @@protoc_insertion_point(field_release:CMD_HelloCB.cipherKey)
+  
+  return cipherkey_.Release(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
-inline void CMD_Version_Not_Match::set_apptype(::google::protobuf::int32 value) {
+inline ::std::string* CMD_HelloCB::unsafe_arena_release_cipherkey() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:CMD_HelloCB.cipherKey)
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  
+  return cipherkey_.UnsafeArenaRelease(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      GetArenaNoVirtual());
+}
+inline void CMD_HelloCB::set_allocated_cipherkey(::std::string* cipherkey) {
+  if (cipherkey != NULL) {
+    
+  } else {
+    
+  }
+  cipherkey_.SetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), cipherkey,
+      GetArenaNoVirtual());
+  // @@protoc_insertion_point(field_set_allocated:CMD_HelloCB.cipherKey)
+}
+inline void CMD_HelloCB::unsafe_arena_set_allocated_cipherkey(
+    ::std::string* cipherkey) {
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  if (cipherkey != NULL) {
+    
+  } else {
+    
+  }
+  cipherkey_.UnsafeArenaSetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      cipherkey, GetArenaNoVirtual());
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:CMD_HelloCB.cipherKey)
+}
+
+// bool batch = 11;
+inline void CMD_HelloCB::clear_batch() {
+  batch_ = false;
+}
+inline bool CMD_HelloCB::batch() const {
+  // @@protoc_insertion_point(field_get:CMD_HelloCB.batch)
+  return batch_;
+}
+inline void CMD_HelloCB::set_batch(bool value) {
+  
+  batch_ = value;
+  // @@protoc_insertion_point(field_set:CMD_HelloCB.batch)
+}
+
+// string shmName = 12;
+inline void CMD_HelloCB::clear_shmname() {
+  shmname_.ClearToEmpty(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
+}
+inline const ::std::string& CMD_HelloCB::shmname() const {
+  // @@protoc_insertion_point(field_get:CMD_HelloCB.shmName)
+  return shmname_.Get();
+}
+inline void CMD_HelloCB::set_shmname(const ::std::string& value) {
+  
+  shmname_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value, GetArenaNoVirtual());
+  // @@protoc_insertion_point(field_set:CMD_HelloCB.shmName)
+}
+inline void CMD_HelloCB::set_shmname(const char* value) {
+  
+  shmname_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+              GetArenaNoVirtual());
+  // @@protoc_insertion_point(field_set_char:CMD_HelloCB.shmName)
+}
+inline void CMD_HelloCB::set_shmname(const char* value,
+    size_t size) {
+  
+  shmname_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArenaNoVirtual());
+  // @@protoc_insertion_point(field_set_pointer:CMD_HelloCB.shmName)
+}
+inline ::std::string* CMD_HelloCB::mutable_shmname() {
+  
+  // @@protoc_insertion_point(field_mutable:CMD_HelloCB.shmName)
+  return shmname_.Mutable(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
+}
+inline ::std::string* CMD_HelloCB::release_shmname() {
+  // @@protoc_insertion_point(field_release:CMD_HelloCB.shmName)
+  
+  return shmname_.Release(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
+}
+inline ::std::string* CMD_HelloCB::unsafe_arena_release_shmname() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:CMD_HelloCB.shmName)
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  
+  return shmname_.UnsafeArenaRelease(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      GetArenaNoVirtual());
+}
+inline void CMD_HelloCB::set_allocated_shmname(::std::string* shmname) {
+  if (shmname != NULL) {
+    
+  } else {
+    
+  }
+  shmname_.SetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), shmname,
+      GetArenaNoVirtual());
+  // @@protoc_insertion_point(field_set_allocated:CMD_HelloCB.shmName)
+}
+inline void CMD_HelloCB::unsafe_arena_set_allocated_shmname(
+    ::std::string* shmname) {
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  if (shmname != NULL) {
+    
+  } else {
+    
+  }
+  shmname_.UnsafeArenaSetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      shmname, GetArenaNoVirtual());
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:CMD_HelloCB.shmName)
+}
+
+// -------------------------------------------------------------------
+
+// CMD_FrameUpgrade
+
+// uint32 version = 1;
+inline void CMD_FrameUpgrade::clear_version() {
+  version_ = 0u;
+}
+inline ::google::protobuf::uint32 CMD_FrameUpgrade::version() const {
+  // @@protoc_insertion_point(field_get:CMD_FrameUpgrade.version)
+  return version_;
+}
+inline void CMD_FrameUpgrade::set_version(::google::protobuf::uint32 value) {
+  
+  version_ = value;
+  // @@protoc_insertion_point(field_set:CMD_FrameUpgrade.version)
+}
+
+// -------------------------------------------------------------------
+
+// CMD_Heartbeat
+
+// uint64 appID = 1;
+inline void CMD_Heartbeat::clear_appid() {
+  appid_ = GOOGLE_ULONGLONG(0);
+}
+inline ::google::protobuf::uint64 CMD_Heartbeat::appid() const {
+  // @@protoc_insertion_point(field_get:CMD_Heartbeat.appID)
+  return appid_;
+}
+inline void CMD_Heartbeat::set_appid(::google::protobuf::uint64 value) {
+  
+  appid_ = value;
+  // @@protoc_insertion_point(field_set:CMD_Heartbeat.appID)
+}
+
+// int32 appType = 2;
+inline void CMD_Heartbeat::clear_apptype() {
+  apptype_ = 0;
+}
+inline ::google::protobuf::int32 CMD_Heartbeat::apptype() const {
+  // @@protoc_insertion_point(field_get:CMD_Heartbeat.appType)
+  return apptype_;
+}
+inline void CMD_Heartbeat::set_apptype(::google::protobuf::int32 value) {
+  
+  apptype_ = value;
+  // @@protoc_insertion_point(field_set:CMD_Heartbeat.appType)
+}
+
+// -------------------------------------------------------------------
+
+// CMD_HeartbeatCB
+
+// uint64 appID = 1;
+inline void CMD_HeartbeatCB::clear_appid() {
+  appid_ = GOOGLE_ULONGLONG(0);
+}
+inline ::google::protobuf::uint64 CMD_HeartbeatCB::appid() const {
+  // @@protoc_insertion_point(field_get:CMD_HeartbeatCB.appID)
+  return appid_;
+}
+inline void CMD_HeartbeatCB::set_appid(::google::protobuf::uint64 value) {
+  
+  appid_ = value;
+  // @@protoc_insertion_point(field_set:CMD_HeartbeatCB.appID)
+}
+
+// int32 appType = 2;
+inline void CMD_HeartbeatCB::clear_apptype() {
+  apptype_ = 0;
+}
+inline ::google::protobuf::int32 CMD_HeartbeatCB::apptype() const {
+  // @@protoc_insertion_point(field_get:CMD_HeartbeatCB.appType)
+  return apptype_;
+}
+inline void CMD_HeartbeatCB::set_apptype(::google::protobuf::int32 value) {
+  
+  apptype_ = value;
+  // @@protoc_insertion_point(field_set:CMD_HeartbeatCB.appType)
+}
+
+// -------------------------------------------------------------------
+
+// CMD_Version_Not_Match
+
+// int32 version = 1;
+inline void CMD_Version_Not_Match::clear_version() {
+  version_ = 0;
+}
+inline ::google::protobuf::int32 CMD_Version_Not_Match::version() const {
+  // @@protoc_insertion_point(field_get:CMD_Version_Not_Match.version)
+  return version_;
+}
+inline void CMD_Version_Not_Match::set_version(::google::protobuf::int32 value) {
+  
+  version_ = value;
+  // @@protoc_insertion_point(field_set:CMD_Version_Not_Match.version)
+}
+
+// uint64 appID = 2;
+inline void CMD_Version_Not_Match::clear_appid() {
+  appid_ = GOOGLE_ULONGLONG(0);
+}
+inline ::google::protobuf::uint64 CMD_Version_Not_Match::appid() const {
+  // @@protoc_insertion_point(field_get:CMD_Version_Not_Match.appID)
+  return appid_;
+}
+inline void CMD_Version_Not_Match::set_appid(::google::protobuf::uint64 value) {
+  
+  appid_ = value;
+  // @@protoc_insertion_point(field_set:CMD_Version_Not_Match.appID)
+}
+
+// int32 appType = 3;
+inline void CMD_Version_Not_Match::clear_apptype() {
+  apptype_ = 0;
+}
+inline ::google::protobuf::int32 CMD_Version_Not_Match::apptype() const {
+  // @@protoc_insertion_point(field_get:CMD_Version_Not_Match.appType)
+  return apptype_;
+}
+inline void CMD_Version_Not_Match::set_apptype(::google::protobuf::int32 value) {
   
   apptype_ = value;
   // @@protoc_insertion_point(field_set:CMD_Version_Not_Match.appType)
@@ -7523,45 +9254,46 @@ inline void CMD_UpdateServerInfos::set_apptype(::google::protobuf::int32 value)
 
 // string internal_ip = 3;
 inline void CMD_UpdateServerInfos::clear_internal_ip() {
-  internal_ip_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  internal_ip_.ClearToEmpty(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 inline const ::std::string& CMD_UpdateServerInfos::internal_ip() const {
   // @@protoc_insertion_point(field_get:CMD_UpdateServerInfos.internal_ip)
-  return internal_ip_.GetNoArena();
+  return internal_ip_.Get();
 }
 inline void CMD_UpdateServerInfos::set_internal_ip(const ::std::string& value) {
   
-  internal_ip_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  internal_ip_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value, GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set:CMD_UpdateServerInfos.internal_ip)
 }
-#if LANG_CXX11
-inline void CMD_UpdateServerInfos::set_internal_ip(::std::string&& value) {
-  
-  internal_ip_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:CMD_UpdateServerInfos.internal_ip)
-}
-#endif
 inline void CMD_UpdateServerInfos::set_internal_ip(const char* value) {
   
-  internal_ip_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  internal_ip_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+              GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_char:CMD_UpdateServerInfos.internal_ip)
 }
-inline void CMD_UpdateServerInfos::set_internal_ip(const char* value, size_t size) {
+inline void CMD_UpdateServerInfos::set_internal_ip(const char* value,
+    size_t size) {
   
-  internal_ip_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
+  internal_ip_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_pointer:CMD_UpdateServerInfos.internal_ip)
 }
 inline ::std::string* CMD_UpdateServerInfos::mutable_internal_ip() {
   
   // @@protoc_insertion_point(field_mutable:CMD_UpdateServerInfos.internal_ip)
-  return internal_ip_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return internal_ip_.Mutable(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 inline ::std::string* CMD_UpdateServerInfos::release_internal_ip() {
   // @@protoc_insertion_point(field_release:CMD_UpdateServerInfos.internal_ip)
   
-  return internal_ip_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return internal_ip_.Release(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
+}
+inline ::std::string* CMD_UpdateServerInfos::unsafe_arena_release_internal_ip() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:CMD_UpdateServerInfos.internal_ip)
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  
+  return internal_ip_.UnsafeArenaRelease(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      GetArenaNoVirtual());
 }
 inline void CMD_UpdateServerInfos::set_allocated_internal_ip(::std::string* internal_ip) {
   if (internal_ip != NULL) {
@@ -7569,9 +9301,22 @@ inline void CMD_UpdateServerInfos::set_allocated_internal_ip(::std::string* inte
   } else {
     
   }
-  internal_ip_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), internal_ip);
+  internal_ip_.SetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), internal_ip,
+      GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_allocated:CMD_UpdateServerInfos.internal_ip)
 }
+inline void CMD_UpdateServerInfos::unsafe_arena_set_allocated_internal_ip(
+    ::std::string* internal_ip) {
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  if (internal_ip != NULL) {
+    
+  } else {
+    
+  }
+  internal_ip_.UnsafeArenaSetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      internal_ip, GetArenaNoVirtual());
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:CMD_UpdateServerInfos.internal_ip)
+}
 
 // uint32 internal_port = 4;
 inline void CMD_UpdateServerInfos::clear_internal_port() {
@@ -7589,45 +9334,46 @@ inline void CMD_UpdateServerInfos::set_internal_port(::google::protobuf::uint32
 
 // string external_ip = 5;
 inline void CMD_UpdateServerInfos::clear_external_ip() {
-  external_ip_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  external_ip_.ClearToEmpty(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 inline const ::std::string& CMD_UpdateServerInfos::external_ip() const {
   // @@protoc_insertion_point(field_get:CMD_UpdateServerInfos.external_ip)
-  return external_ip_.GetNoArena();
+  return external_ip_.Get();
 }
 inline void CMD_UpdateServerInfos::set_external_ip(const ::std::string& value) {
   
-  external_ip_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  external_ip_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value, GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set:CMD_UpdateServerInfos.external_ip)
 }
-#if LANG_CXX11
-inline void CMD_UpdateServerInfos::set_external_ip(::std::string&& value) {
-  
-  external_ip_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:CMD_UpdateServerInfos.external_ip)
-}
-#endif
 inline void CMD_UpdateServerInfos::set_external_ip(const char* value) {
   
-  external_ip_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  external_ip_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+              GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_char:CMD_UpdateServerInfos.external_ip)
 }
-inline void CMD_UpdateServerInfos::set_external_ip(const char* value, size_t size) {
+inline void CMD_UpdateServerInfos::set_external_ip(const char* value,
+    size_t size) {
   
-  external_ip_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
+  external_ip_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_pointer:CMD_UpdateServerInfos.external_ip)
 }
 inline ::std::string* CMD_UpdateServerInfos::mutable_external_ip() {
   
   // @@protoc_insertion_point(field_mutable:CMD_UpdateServerInfos.external_ip)
-  return external_ip_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return external_ip_.Mutable(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 inline ::std::string* CMD_UpdateServerInfos::release_external_ip() {
   // @@protoc_insertion_point(field_release:CMD_UpdateServerInfos.external_ip)
   
-  return external_ip_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return external_ip_.Release(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
+}
+inline ::std::string* CMD_UpdateServerInfos::unsafe_arena_release_external_ip() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:CMD_UpdateServerInfos.external_ip)
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  
+  return external_ip_.UnsafeArenaRelease(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      GetArenaNoVirtual());
 }
 inline void CMD_UpdateServerInfos::set_allocated_external_ip(::std::string* external_ip) {
   if (external_ip != NULL) {
@@ -7635,9 +9381,22 @@ inline void CMD_UpdateServerInfos::set_allocated_external_ip(::std::string* exte
   } else {
     
   }
-  external_ip_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), external_ip);
+  external_ip_.SetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), external_ip,
+      GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_allocated:CMD_UpdateServerInfos.external_ip)
 }
+inline void CMD_UpdateServerInfos::unsafe_arena_set_allocated_external_ip(
+    ::std::string* external_ip) {
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  if (external_ip != NULL) {
+    
+  } else {
+    
+  }
+  external_ip_.UnsafeArenaSetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      external_ip, GetArenaNoVirtual());
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:CMD_UpdateServerInfos.external_ip)
+}
 
 // uint32 external_port = 6;
 inline void CMD_UpdateServerInfos::clear_external_port() {
@@ -7711,45 +9470,46 @@ inline void CMD_UpdateServerInfos::set_appgid(::google::protobuf::uint64 value)
 
 // string name = 11;
 inline void CMD_UpdateServerInfos::clear_name() {
-  name_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  name_.ClearToEmpty(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 inline const ::std::string& CMD_UpdateServerInfos::name() const {
   // @@protoc_insertion_point(field_get:CMD_UpdateServerInfos.name)
-  return name_.GetNoArena();
+  return name_.Get();
 }
 inline void CMD_UpdateServerInfos::set_name(const ::std::string& value) {
   
-  name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  name_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value, GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set:CMD_UpdateServerInfos.name)
 }
-#if LANG_CXX11
-inline void CMD_UpdateServerInfos::set_name(::std::string&& value) {
-  
-  name_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:CMD_UpdateServerInfos.name)
-}
-#endif
 inline void CMD_UpdateServerInfos::set_name(const char* value) {
   
-  name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  name_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+              GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_char:CMD_UpdateServerInfos.name)
 }
-inline void CMD_UpdateServerInfos::set_name(const char* value, size_t size) {
+inline void CMD_UpdateServerInfos::set_name(const char* value,
+    size_t size) {
   
-  name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
+  name_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_pointer:CMD_UpdateServerInfos.name)
 }
 inline ::std::string* CMD_UpdateServerInfos::mutable_name() {
   
   // @@protoc_insertion_point(field_mutable:CMD_UpdateServerInfos.name)
-  return name_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return name_.Mutable(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 inline ::std::string* CMD_UpdateServerInfos::release_name() {
   // @@protoc_insertion_point(field_release:CMD_UpdateServerInfos.name)
   
-  return name_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return name_.Release(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
+}
+inline ::std::string* CMD_UpdateServerInfos::unsafe_arena_release_name() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:CMD_UpdateServerInfos.name)
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  
+  return name_.UnsafeArenaRelease(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      GetArenaNoVirtual());
 }
 inline void CMD_UpdateServerInfos::set_allocated_name(::std::string* name) {
   if (name != NULL) {
@@ -7757,9 +9517,22 @@ inline void CMD_UpdateServerInfos::set_allocated_name(::std::string* name) {
   } else {
     
   }
-  name_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), name);
+  name_.SetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), name,
+      GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_allocated:CMD_UpdateServerInfos.name)
 }
+inline void CMD_UpdateServerInfos::unsafe_arena_set_allocated_name(
+    ::std::string* name) {
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  if (name != NULL) {
+    
+  } else {
+    
+  }
+  name_.UnsafeArenaSetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      name, GetArenaNoVirtual());
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:CMD_UpdateServerInfos.name)
+}
 
 // repeated .CMD_UpdateServerInfos child_srvs = 12;
 inline int CMD_UpdateServerInfos::child_srvs_size() const {
@@ -7791,6 +9564,72 @@ CMD_UpdateServerInfos::child_srvs() const {
   return child_srvs_;
 }
 
+// string hostID = 13;
+inline void CMD_UpdateServerInfos::clear_hostid() {
+  hostid_.ClearToEmpty(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
+}
+inline const ::std::string& CMD_UpdateServerInfos::hostid() const {
+  // @@protoc_insertion_point(field_get:CMD_UpdateServerInfos.hostID)
+  return hostid_.Get();
+}
+inline void CMD_UpdateServerInfos::set_hostid(const ::std::string& value) {
+  
+  hostid_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value, GetArenaNoVirtual());
+  // @@protoc_insertion_point(field_set:CMD_UpdateServerInfos.hostID)
+}
+inline void CMD_UpdateServerInfos::set_hostid(const char* value) {
+  
+  hostid_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+              GetArenaNoVirtual());
+  // @@protoc_insertion_point(field_set_char:CMD_UpdateServerInfos.hostID)
+}
+inline void CMD_UpdateServerInfos::set_hostid(const char* value,
+    size_t size) {
+  
+  hostid_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArenaNoVirtual());
+  // @@protoc_insertion_point(field_set_pointer:CMD_UpdateServerInfos.hostID)
+}
+inline ::std::string* CMD_UpdateServerInfos::mutable_hostid() {
+  
+  // @@protoc_insertion_point(field_mutable:CMD_UpdateServerInfos.hostID)
+  return hostid_.Mutable(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
+}
+inline ::std::string* CMD_UpdateServerInfos::release_hostid() {
+  // @@protoc_insertion_point(field_release:CMD_UpdateServerInfos.hostID)
+  
+  return hostid_.Release(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
+}
+inline ::std::string* CMD_UpdateServerInfos::unsafe_arena_release_hostid() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:CMD_UpdateServerInfos.hostID)
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  
+  return hostid_.UnsafeArenaRelease(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      GetArenaNoVirtual());
+}
+inline void CMD_UpdateServerInfos::set_allocated_hostid(::std::string* hostid) {
+  if (hostid != NULL) {
+    
+  } else {
+    
+  }
+  hostid_.SetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), hostid,
+      GetArenaNoVirtual());
+  // @@protoc_insertion_point(field_set_allocated:CMD_UpdateServerInfos.hostID)
+}
+inline void CMD_UpdateServerInfos::unsafe_arena_set_allocated_hostid(
+    ::std::string* hostid) {
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  if (hostid != NULL) {
+    
+  } else {
+    
+  }
+  hostid_.UnsafeArenaSetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      hostid, GetArenaNoVirtual());
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:CMD_UpdateServerInfos.hostID)
+}
+
 // -------------------------------------------------------------------
 
 // CMD_QueryServerInfos
@@ -7887,6 +9726,24 @@ CMD_QueryServerInfosCB::srvs() const {
 
 // -------------------------------------------------------------------
 
+// CMD_ShmAttach
+
+// bool ok = 1;
+inline void CMD_ShmAttach::clear_ok() {
+  ok_ = false;
+}
+inline bool CMD_ShmAttach::ok() const {
+  // @@protoc_insertion_point(field_get:CMD_ShmAttach.ok)
+  return ok_;
+}
+inline void CMD_ShmAttach::set_ok(bool value) {
+  
+  ok_ = value;
+  // @@protoc_insertion_point(field_set:CMD_ShmAttach.ok)
+}
+
+// -------------------------------------------------------------------
+
 // CMD_Ping
 
 // uint64 time = 1;
@@ -7941,45 +9798,46 @@ inline void CMD_ForwardPacket::set_requestorid(::google::protobuf::uint64 value)
 
 // bytes datas = 2;
 inline void CMD_ForwardPacket::clear_datas() {
-  datas_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  datas_.ClearToEmpty(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 inline const ::std::string& CMD_ForwardPacket::datas() const {
   // @@protoc_insertion_point(field_get:CMD_ForwardPacket.datas)
-  return datas_.GetNoArena();
+  return datas_.Get();
 }
 inline void CMD_ForwardPacket::set_datas(const ::std::string& value) {
   
-  datas_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  datas_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value, GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set:CMD_ForwardPacket.datas)
 }
-#if LANG_CXX11
-inline void CMD_ForwardPacket::set_datas(::std::string&& value) {
-  
-  datas_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:CMD_ForwardPacket.datas)
-}
-#endif
 inline void CMD_ForwardPacket::set_datas(const char* value) {
   
-  datas_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  datas_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+              GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_char:CMD_ForwardPacket.datas)
 }
-inline void CMD_ForwardPacket::set_datas(const void* value, size_t size) {
+inline void CMD_ForwardPacket::set_datas(const void* value,
+    size_t size) {
   
-  datas_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
+  datas_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_pointer:CMD_ForwardPacket.datas)
 }
 inline ::std::string* CMD_ForwardPacket::mutable_datas() {
   
   // @@protoc_insertion_point(field_mutable:CMD_ForwardPacket.datas)
-  return datas_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return datas_.Mutable(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 inline ::std::string* CMD_ForwardPacket::release_datas() {
   // @@protoc_insertion_point(field_release:CMD_ForwardPacket.datas)
   
-  return datas_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return datas_.Release(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
+}
+inline ::std::string* CMD_ForwardPacket::unsafe_arena_release_datas() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:CMD_ForwardPacket.datas)
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  
+  return datas_.UnsafeArenaRelease(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      GetArenaNoVirtual());
 }
 inline void CMD_ForwardPacket::set_allocated_datas(::std::string* datas) {
   if (datas != NULL) {
@@ -7987,9 +9845,22 @@ inline void CMD_ForwardPacket::set_allocated_datas(::std::string* datas) {
   } else {
     
   }
-  datas_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), datas);
+  datas_.SetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), datas,
+      GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_allocated:CMD_ForwardPacket.datas)
 }
+inline void CMD_ForwardPacket::unsafe_arena_set_allocated_datas(
+    ::std::string* datas) {
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  if (datas != NULL) {
+    
+  } else {
+    
+  }
+  datas_.UnsafeArenaSetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      datas, GetArenaNoVirtual());
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:CMD_ForwardPacket.datas)
+}
 
 // int32 msgcmd = 3;
 inline void CMD_ForwardPacket::clear_msgcmd() {
@@ -8019,45 +9890,46 @@ inline void CMD_ForwardPacket::set_msgcmd(::google::protobuf::int32 value) {
 
 // string commitAccountName = 1;
 inline void CMD_Login_Signup::clear_commitaccountname() {
-  commitaccountname_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  commitaccountname_.ClearToEmpty(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 inline const ::std::string& CMD_Login_Signup::commitaccountname() const {
   // @@protoc_insertion_point(field_get:CMD_Login_Signup.commitAccountName)
-  return commitaccountname_.GetNoArena();
+  return commitaccountname_.Get();
 }
 inline void CMD_Login_Signup::set_commitaccountname(const ::std::string& value) {
   
-  commitaccountname_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  commitaccountname_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value, GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set:CMD_Login_Signup.commitAccountName)
 }
-#if LANG_CXX11
-inline void CMD_Login_Signup::set_commitaccountname(::std::string&& value) {
-  
-  commitaccountname_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:CMD_Login_Signup.commitAccountName)
-}
-#endif
 inline void CMD_Login_Signup::set_commitaccountname(const char* value) {
   
-  commitaccountname_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  commitaccountname_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+              GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_char:CMD_Login_Signup.commitAccountName)
 }
-inline void CMD_Login_Signup::set_commitaccountname(const char* value, size_t size) {
+inline void CMD_Login_Signup::set_commitaccountname(const char* value,
+    size_t size) {
   
-  commitaccountname_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
+  commitaccountname_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_pointer:CMD_Login_Signup.commitAccountName)
 }
 inline ::std::string* CMD_Login_Signup::mutable_commitaccountname() {
   
   // @@protoc_insertion_point(field_mutable:CMD_Login_Signup.commitAccountName)
-  return commitaccountname_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return commitaccountname_.Mutable(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 inline ::std::string* CMD_Login_Signup::release_commitaccountname() {
   // @@protoc_insertion_point(field_release:CMD_Login_Signup.commitAccountName)
   
-  return commitaccountname_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return commitaccountname_.Release(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
+}
+inline ::std::string* CMD_Login_Signup::unsafe_arena_release_commitaccountname() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:CMD_Login_Signup.commitAccountName)
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  
+  return commitaccountname_.UnsafeArenaRelease(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      GetArenaNoVirtual());
 }
 inline void CMD_Login_Signup::set_allocated_commitaccountname(::std::string* commitaccountname) {
   if (commitaccountname != NULL) {
@@ -8065,51 +9937,65 @@ inline void CMD_Login_Signup::set_allocated_commitaccountname(::std::string* com
   } else {
     
   }
-  commitaccountname_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), commitaccountname);
+  commitaccountname_.SetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), commitaccountname,
+      GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_allocated:CMD_Login_Signup.commitAccountName)
 }
+inline void CMD_Login_Signup::unsafe_arena_set_allocated_commitaccountname(
+    ::std::string* commitaccountname) {
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  if (commitaccountname != NULL) {
+    
+  } else {
+    
+  }
+  commitaccountname_.UnsafeArenaSetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      commitaccountname, GetArenaNoVirtual());
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:CMD_Login_Signup.commitAccountName)
+}
 
 // string password = 2;
 inline void CMD_Login_Signup::clear_password() {
-  password_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  password_.ClearToEmpty(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 inline const ::std::string& CMD_Login_Signup::password() const {
   // @@protoc_insertion_point(field_get:CMD_Login_Signup.password)
-  return password_.GetNoArena();
+  return password_.Get();
 }
 inline void CMD_Login_Signup::set_password(const ::std::string& value) {
   
-  password_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  password_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value, GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set:CMD_Login_Signup.password)
 }
-#if LANG_CXX11
-inline void CMD_Login_Signup::set_password(::std::string&& value) {
-  
-  password_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:CMD_Login_Signup.password)
-}
-#endif
 inline void CMD_Login_Signup::set_password(const char* value) {
   
-  password_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  password_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+              GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_char:CMD_Login_Signup.password)
 }
-inline void CMD_Login_Signup::set_password(const char* value, size_t size) {
+inline void CMD_Login_Signup::set_password(const char* value,
+    size_t size) {
   
-  password_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
+  password_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_pointer:CMD_Login_Signup.password)
 }
 inline ::std::string* CMD_Login_Signup::mutable_password() {
   
   // @@protoc_insertion_point(field_mutable:CMD_Login_Signup.password)
-  return password_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return password_.Mutable(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 inline ::std::string* CMD_Login_Signup::release_password() {
   // @@protoc_insertion_point(field_release:CMD_Login_Signup.password)
   
-  return password_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return password_.Release(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
+}
+inline ::std::string* CMD_Login_Signup::unsafe_arena_release_password() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:CMD_Login_Signup.password)
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  
+  return password_.UnsafeArenaRelease(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      GetArenaNoVirtual());
 }
 inline void CMD_Login_Signup::set_allocated_password(::std::string* password) {
   if (password != NULL) {
@@ -8117,51 +10003,65 @@ inline void CMD_Login_Signup::set_allocated_password(::std::string* password) {
   } else {
     
   }
-  password_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), password);
+  password_.SetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), password,
+      GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_allocated:CMD_Login_Signup.password)
 }
+inline void CMD_Login_Signup::unsafe_arena_set_allocated_password(
+    ::std::string* password) {
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  if (password != NULL) {
+    
+  } else {
+    
+  }
+  password_.UnsafeArenaSetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      password, GetArenaNoVirtual());
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:CMD_Login_Signup.password)
+}
 
 // bytes datas = 3;
 inline void CMD_Login_Signup::clear_datas() {
-  datas_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  datas_.ClearToEmpty(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 inline const ::std::string& CMD_Login_Signup::datas() const {
   // @@protoc_insertion_point(field_get:CMD_Login_Signup.datas)
-  return datas_.GetNoArena();
+  return datas_.Get();
 }
 inline void CMD_Login_Signup::set_datas(const ::std::string& value) {
   
-  datas_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  datas_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value, GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set:CMD_Login_Signup.datas)
 }
-#if LANG_CXX11
-inline void CMD_Login_Signup::set_datas(::std::string&& value) {
-  
-  datas_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:CMD_Login_Signup.datas)
-}
-#endif
 inline void CMD_Login_Signup::set_datas(const char* value) {
   
-  datas_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  datas_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+              GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_char:CMD_Login_Signup.datas)
 }
-inline void CMD_Login_Signup::set_datas(const void* value, size_t size) {
+inline void CMD_Login_Signup::set_datas(const void* value,
+    size_t size) {
   
-  datas_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
+  datas_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_pointer:CMD_Login_Signup.datas)
 }
 inline ::std::string* CMD_Login_Signup::mutable_datas() {
   
   // @@protoc_insertion_point(field_mutable:CMD_Login_Signup.datas)
-  return datas_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return datas_.Mutable(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 inline ::std::string* CMD_Login_Signup::release_datas() {
   // @@protoc_insertion_point(field_release:CMD_Login_Signup.datas)
   
-  return datas_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return datas_.Release(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
+}
+inline ::std::string* CMD_Login_Signup::unsafe_arena_release_datas() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:CMD_Login_Signup.datas)
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  
+  return datas_.UnsafeArenaRelease(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      GetArenaNoVirtual());
 }
 inline void CMD_Login_Signup::set_allocated_datas(::std::string* datas) {
   if (datas != NULL) {
@@ -8169,9 +10069,22 @@ inline void CMD_Login_Signup::set_allocated_datas(::std::string* datas) {
   } else {
     
   }
-  datas_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), datas);
+  datas_.SetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), datas,
+      GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_allocated:CMD_Login_Signup.datas)
 }
+inline void CMD_Login_Signup::unsafe_arena_set_allocated_datas(
+    ::std::string* datas) {
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  if (datas != NULL) {
+    
+  } else {
+    
+  }
+  datas_.UnsafeArenaSetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      datas, GetArenaNoVirtual());
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:CMD_Login_Signup.datas)
+}
 
 // -------------------------------------------------------------------
 
@@ -8193,45 +10106,46 @@ inline void CMD_Login_OnSignupCB::set_errcode(::ServerError value) {
 
 // string commitAccountName = 2;
 inline void CMD_Login_OnSignupCB::clear_commitaccountname() {
-  commitaccountname_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  commitaccountname_.ClearToEmpty(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 inline const ::std::string& CMD_Login_OnSignupCB::commitaccountname() const {
   // @@protoc_insertion_point(field_get:CMD_Login_OnSignupCB.commitAccountName)
-  return commitaccountname_.GetNoArena();
+  return commitaccountname_.Get();
 }
 inline void CMD_Login_OnSignupCB::set_commitaccountname(const ::std::string& value) {
   
-  commitaccountname_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  commitaccountname_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value, GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set:CMD_Login_OnSignupCB.commitAccountName)
 }
-#if LANG_CXX11
-inline void CMD_Login_OnSignupCB::set_commitaccountname(::std::string&& value) {
-  
-  commitaccountname_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:CMD_Login_OnSignupCB.commitAccountName)
-}
-#endif
 inline void CMD_Login_OnSignupCB::set_commitaccountname(const char* value) {
   
-  commitaccountname_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  commitaccountname_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+              GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_char:CMD_Login_OnSignupCB.commitAccountName)
 }
-inline void CMD_Login_OnSignupCB::set_commitaccountname(const char* value, size_t size) {
+inline void CMD_Login_OnSignupCB::set_commitaccountname(const char* value,
+    size_t size) {
   
-  commitaccountname_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
+  commitaccountname_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_pointer:CMD_Login_OnSignupCB.commitAccountName)
 }
 inline ::std::string* CMD_Login_OnSignupCB::mutable_commitaccountname() {
   
   // @@protoc_insertion_point(field_mutable:CMD_Login_OnSignupCB.commitAccountName)
-  return commitaccountname_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return commitaccountname_.Mutable(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 inline ::std::string* CMD_Login_OnSignupCB::release_commitaccountname() {
   // @@protoc_insertion_point(field_release:CMD_Login_OnSignupCB.commitAccountName)
   
-  return commitaccountname_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return commitaccountname_.Release(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
+}
+inline ::std::string* CMD_Login_OnSignupCB::unsafe_arena_release_commitaccountname() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:CMD_Login_OnSignupCB.commitAccountName)
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  
+  return commitaccountname_.UnsafeArenaRelease(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      GetArenaNoVirtual());
 }
 inline void CMD_Login_OnSignupCB::set_allocated_commitaccountname(::std::string* commitaccountname) {
   if (commitaccountname != NULL) {
@@ -8239,51 +10153,65 @@ inline void CMD_Login_OnSignupCB::set_allocated_commitaccountname(::std::string*
   } else {
     
   }
-  commitaccountname_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), commitaccountname);
+  commitaccountname_.SetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), commitaccountname,
+      GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_allocated:CMD_Login_OnSignupCB.commitAccountName)
 }
+inline void CMD_Login_OnSignupCB::unsafe_arena_set_allocated_commitaccountname(
+    ::std::string* commitaccountname) {
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  if (commitaccountname != NULL) {
+    
+  } else {
+    
+  }
+  commitaccountname_.UnsafeArenaSetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      commitaccountname, GetArenaNoVirtual());
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:CMD_Login_OnSignupCB.commitAccountName)
+}
 
 // string realAccountName = 3;
 inline void CMD_Login_OnSignupCB::clear_realaccountname() {
-  realaccountname_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  realaccountname_.ClearToEmpty(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 inline const ::std::string& CMD_Login_OnSignupCB::realaccountname() const {
   // @@protoc_insertion_point(field_get:CMD_Login_OnSignupCB.realAccountName)
-  return realaccountname_.GetNoArena();
+  return realaccountname_.Get();
 }
 inline void CMD_Login_OnSignupCB::set_realaccountname(const ::std::string& value) {
   
-  realaccountname_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  realaccountname_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value, GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set:CMD_Login_OnSignupCB.realAccountName)
 }
-#if LANG_CXX11
-inline void CMD_Login_OnSignupCB::set_realaccountname(::std::string&& value) {
-  
-  realaccountname_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:CMD_Login_OnSignupCB.realAccountName)
-}
-#endif
 inline void CMD_Login_OnSignupCB::set_realaccountname(const char* value) {
   
-  realaccountname_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  realaccountname_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+              GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_char:CMD_Login_OnSignupCB.realAccountName)
 }
-inline void CMD_Login_OnSignupCB::set_realaccountname(const char* value, size_t size) {
+inline void CMD_Login_OnSignupCB::set_realaccountname(const char* value,
+    size_t size) {
   
-  realaccountname_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
+  realaccountname_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_pointer:CMD_Login_OnSignupCB.realAccountName)
 }
 inline ::std::string* CMD_Login_OnSignupCB::mutable_realaccountname() {
   
   // @@protoc_insertion_point(field_mutable:CMD_Login_OnSignupCB.realAccountName)
-  return realaccountname_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return realaccountname_.Mutable(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 inline ::std::string* CMD_Login_OnSignupCB::release_realaccountname() {
   // @@protoc_insertion_point(field_release:CMD_Login_OnSignupCB.realAccountName)
   
-  return realaccountname_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return realaccountname_.Release(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
+}
+inline ::std::string* CMD_Login_OnSignupCB::unsafe_arena_release_realaccountname() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:CMD_Login_OnSignupCB.realAccountName)
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  
+  return realaccountname_.UnsafeArenaRelease(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      GetArenaNoVirtual());
 }
 inline void CMD_Login_OnSignupCB::set_allocated_realaccountname(::std::string* realaccountname) {
   if (realaccountname != NULL) {
@@ -8291,51 +10219,65 @@ inline void CMD_Login_OnSignupCB::set_allocated_realaccountname(::std::string* r
   } else {
     
   }
-  realaccountname_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), realaccountname);
+  realaccountname_.SetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), realaccountname,
+      GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_allocated:CMD_Login_OnSignupCB.realAccountName)
 }
+inline void CMD_Login_OnSignupCB::unsafe_arena_set_allocated_realaccountname(
+    ::std::string* realaccountname) {
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  if (realaccountname != NULL) {
+    
+  } else {
+    
+  }
+  realaccountname_.UnsafeArenaSetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      realaccountname, GetArenaNoVirtual());
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:CMD_Login_OnSignupCB.realAccountName)
+}
 
 // bytes datas = 4;
 inline void CMD_Login_OnSignupCB::clear_datas() {
-  datas_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  datas_.ClearToEmpty(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 inline const ::std::string& CMD_Login_OnSignupCB::datas() const {
   // @@protoc_insertion_point(field_get:CMD_Login_OnSignupCB.datas)
-  return datas_.GetNoArena();
+  return datas_.Get();
 }
 inline void CMD_Login_OnSignupCB::set_datas(const ::std::string& value) {
   
-  datas_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  datas_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value, GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set:CMD_Login_OnSignupCB.datas)
 }
-#if LANG_CXX11
-inline void CMD_Login_OnSignupCB::set_datas(::std::string&& value) {
-  
-  datas_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:CMD_Login_OnSignupCB.datas)
-}
-#endif
 inline void CMD_Login_OnSignupCB::set_datas(const char* value) {
   
-  datas_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  datas_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+              GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_char:CMD_Login_OnSignupCB.datas)
 }
-inline void CMD_Login_OnSignupCB::set_datas(const void* value, size_t size) {
+inline void CMD_Login_OnSignupCB::set_datas(const void* value,
+    size_t size) {
   
-  datas_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
+  datas_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_pointer:CMD_Login_OnSignupCB.datas)
 }
 inline ::std::string* CMD_Login_OnSignupCB::mutable_datas() {
   
   // @@protoc_insertion_point(field_mutable:CMD_Login_OnSignupCB.datas)
-  return datas_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return datas_.Mutable(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 inline ::std::string* CMD_Login_OnSignupCB::release_datas() {
   // @@protoc_insertion_point(field_release:CMD_Login_OnSignupCB.datas)
   
-  return datas_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return datas_.Release(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
+}
+inline ::std::string* CMD_Login_OnSignupCB::unsafe_arena_release_datas() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:CMD_Login_OnSignupCB.datas)
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  
+  return datas_.UnsafeArenaRelease(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      GetArenaNoVirtual());
 }
 inline void CMD_Login_OnSignupCB::set_allocated_datas(::std::string* datas) {
   if (datas != NULL) {
@@ -8343,9 +10285,22 @@ inline void CMD_Login_OnSignupCB::set_allocated_datas(::std::string* datas) {
   } else {
     
   }
-  datas_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), datas);
+  datas_.SetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), datas,
+      GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_allocated:CMD_Login_OnSignupCB.datas)
 }
+inline void CMD_Login_OnSignupCB::unsafe_arena_set_allocated_datas(
+    ::std::string* datas) {
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  if (datas != NULL) {
+    
+  } else {
+    
+  }
+  datas_.UnsafeArenaSetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      datas, GetArenaNoVirtual());
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:CMD_Login_OnSignupCB.datas)
+}
 
 // -------------------------------------------------------------------
 
@@ -8353,45 +10308,46 @@ inline void CMD_Login_OnSignupCB::set_allocated_datas(::std::string* datas) {
 
 // string commitAccountName = 1;
 inline void CMD_Login_Signin::clear_commitaccountname() {
-  commitaccountname_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  commitaccountname_.ClearToEmpty(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 inline const ::std::string& CMD_Login_Signin::commitaccountname() const {
   // @@protoc_insertion_point(field_get:CMD_Login_Signin.commitAccountName)
-  return commitaccountname_.GetNoArena();
+  return commitaccountname_.Get();
 }
 inline void CMD_Login_Signin::set_commitaccountname(const ::std::string& value) {
   
-  commitaccountname_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  commitaccountname_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value, GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set:CMD_Login_Signin.commitAccountName)
 }
-#if LANG_CXX11
-inline void CMD_Login_Signin::set_commitaccountname(::std::string&& value) {
-  
-  commitaccountname_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:CMD_Login_Signin.commitAccountName)
-}
-#endif
 inline void CMD_Login_Signin::set_commitaccountname(const char* value) {
   
-  commitaccountname_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  commitaccountname_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+              GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_char:CMD_Login_Signin.commitAccountName)
 }
-inline void CMD_Login_Signin::set_commitaccountname(const char* value, size_t size) {
+inline void CMD_Login_Signin::set_commitaccountname(const char* value,
+    size_t size) {
   
-  commitaccountname_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
+  commitaccountname_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_pointer:CMD_Login_Signin.commitAccountName)
 }
 inline ::std::string* CMD_Login_Signin::mutable_commitaccountname() {
   
   // @@protoc_insertion_point(field_mutable:CMD_Login_Signin.commitAccountName)
-  return commitaccountname_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return commitaccountname_.Mutable(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 inline ::std::string* CMD_Login_Signin::release_commitaccountname() {
   // @@protoc_insertion_point(field_release:CMD_Login_Signin.commitAccountName)
   
-  return commitaccountname_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return commitaccountname_.Release(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
+}
+inline ::std::string* CMD_Login_Signin::unsafe_arena_release_commitaccountname() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:CMD_Login_Signin.commitAccountName)
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  
+  return commitaccountname_.UnsafeArenaRelease(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      GetArenaNoVirtual());
 }
 inline void CMD_Login_Signin::set_allocated_commitaccountname(::std::string* commitaccountname) {
   if (commitaccountname != NULL) {
@@ -8399,51 +10355,65 @@ inline void CMD_Login_Signin::set_allocated_commitaccountname(::std::string* com
   } else {
     
   }
-  commitaccountname_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), commitaccountname);
+  commitaccountname_.SetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), commitaccountname,
+      GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_allocated:CMD_Login_Signin.commitAccountName)
 }
+inline void CMD_Login_Signin::unsafe_arena_set_allocated_commitaccountname(
+    ::std::string* commitaccountname) {
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  if (commitaccountname != NULL) {
+    
+  } else {
+    
+  }
+  commitaccountname_.UnsafeArenaSetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      commitaccountname, GetArenaNoVirtual());
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:CMD_Login_Signin.commitAccountName)
+}
 
 // string password = 2;
 inline void CMD_Login_Signin::clear_password() {
-  password_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  password_.ClearToEmpty(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 inline const ::std::string& CMD_Login_Signin::password() const {
   // @@protoc_insertion_point(field_get:CMD_Login_Signin.password)
-  return password_.GetNoArena();
+  return password_.Get();
 }
 inline void CMD_Login_Signin::set_password(const ::std::string& value) {
   
-  password_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  password_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value, GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set:CMD_Login_Signin.password)
 }
-#if LANG_CXX11
-inline void CMD_Login_Signin::set_password(::std::string&& value) {
-  
-  password_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:CMD_Login_Signin.password)
-}
-#endif
 inline void CMD_Login_Signin::set_password(const char* value) {
   
-  password_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  password_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+              GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_char:CMD_Login_Signin.password)
 }
-inline void CMD_Login_Signin::set_password(const char* value, size_t size) {
+inline void CMD_Login_Signin::set_password(const char* value,
+    size_t size) {
   
-  password_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
+  password_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_pointer:CMD_Login_Signin.password)
 }
 inline ::std::string* CMD_Login_Signin::mutable_password() {
   
   // @@protoc_insertion_point(field_mutable:CMD_Login_Signin.password)
-  return password_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return password_.Mutable(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 inline ::std::string* CMD_Login_Signin::release_password() {
   // @@protoc_insertion_point(field_release:CMD_Login_Signin.password)
   
-  return password_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return password_.Release(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
+}
+inline ::std::string* CMD_Login_Signin::unsafe_arena_release_password() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:CMD_Login_Signin.password)
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  
+  return password_.UnsafeArenaRelease(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      GetArenaNoVirtual());
 }
 inline void CMD_Login_Signin::set_allocated_password(::std::string* password) {
   if (password != NULL) {
@@ -8451,51 +10421,65 @@ inline void CMD_Login_Signin::set_allocated_password(::std::string* password) {
   } else {
     
   }
-  password_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), password);
+  password_.SetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), password,
+      GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_allocated:CMD_Login_Signin.password)
 }
+inline void CMD_Login_Signin::unsafe_arena_set_allocated_password(
+    ::std::string* password) {
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  if (password != NULL) {
+    
+  } else {
+    
+  }
+  password_.UnsafeArenaSetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      password, GetArenaNoVirtual());
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:CMD_Login_Signin.password)
+}
 
 // bytes datas = 3;
 inline void CMD_Login_Signin::clear_datas() {
-  datas_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  datas_.ClearToEmpty(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 inline const ::std::string& CMD_Login_Signin::datas() const {
   // @@protoc_insertion_point(field_get:CMD_Login_Signin.datas)
-  return datas_.GetNoArena();
+  return datas_.Get();
 }
 inline void CMD_Login_Signin::set_datas(const ::std::string& value) {
   
-  datas_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  datas_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value, GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set:CMD_Login_Signin.datas)
 }
-#if LANG_CXX11
-inline void CMD_Login_Signin::set_datas(::std::string&& value) {
-  
-  datas_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:CMD_Login_Signin.datas)
-}
-#endif
 inline void CMD_Login_Signin::set_datas(const char* value) {
   
-  datas_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  datas_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+              GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_char:CMD_Login_Signin.datas)
 }
-inline void CMD_Login_Signin::set_datas(const void* value, size_t size) {
+inline void CMD_Login_Signin::set_datas(const void* value,
+    size_t size) {
   
-  datas_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
+  datas_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_pointer:CMD_Login_Signin.datas)
 }
 inline ::std::string* CMD_Login_Signin::mutable_datas() {
   
   // @@protoc_insertion_point(field_mutable:CMD_Login_Signin.datas)
-  return datas_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return datas_.Mutable(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 inline ::std::string* CMD_Login_Signin::release_datas() {
   // @@protoc_insertion_point(field_release:CMD_Login_Signin.datas)
   
-  return datas_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return datas_.Release(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
+}
+inline ::std::string* CMD_Login_Signin::unsafe_arena_release_datas() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:CMD_Login_Signin.datas)
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  
+  return datas_.UnsafeArenaRelease(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      GetArenaNoVirtual());
 }
 inline void CMD_Login_Signin::set_allocated_datas(::std::string* datas) {
   if (datas != NULL) {
@@ -8503,9 +10487,22 @@ inline void CMD_Login_Signin::set_allocated_datas(::std::string* datas) {
   } else {
     
   }
-  datas_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), datas);
+  datas_.SetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), datas,
+      GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_allocated:CMD_Login_Signin.datas)
 }
+inline void CMD_Login_Signin::unsafe_arena_set_allocated_datas(
+    ::std::string* datas) {
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  if (datas != NULL) {
+    
+  } else {
+    
+  }
+  datas_.UnsafeArenaSetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      datas, GetArenaNoVirtual());
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:CMD_Login_Signin.datas)
+}
 
 // -------------------------------------------------------------------
 
@@ -8527,45 +10524,46 @@ inline void CMD_Login_OnSigninCB::set_errcode(::ServerError value) {
 
 // string commitAccountName = 2;
 inline void CMD_Login_OnSigninCB::clear_commitaccountname() {
-  commitaccountname_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  commitaccountname_.ClearToEmpty(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 inline const ::std::string& CMD_Login_OnSigninCB::commitaccountname() const {
   // @@protoc_insertion_point(field_get:CMD_Login_OnSigninCB.commitAccountName)
-  return commitaccountname_.GetNoArena();
+  return commitaccountname_.Get();
 }
 inline void CMD_Login_OnSigninCB::set_commitaccountname(const ::std::string& value) {
   
-  commitaccountname_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  commitaccountname_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value, GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set:CMD_Login_OnSigninCB.commitAccountName)
 }
-#if LANG_CXX11
-inline void CMD_Login_OnSigninCB::set_commitaccountname(::std::string&& value) {
-  
-  commitaccountname_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:CMD_Login_OnSigninCB.commitAccountName)
-}
-#endif
 inline void CMD_Login_OnSigninCB::set_commitaccountname(const char* value) {
   
-  commitaccountname_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  commitaccountname_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+              GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_char:CMD_Login_OnSigninCB.commitAccountName)
 }
-inline void CMD_Login_OnSigninCB::set_commitaccountname(const char* value, size_t size) {
+inline void CMD_Login_OnSigninCB::set_commitaccountname(const char* value,
+    size_t size) {
   
-  commitaccountname_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
+  commitaccountname_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_pointer:CMD_Login_OnSigninCB.commitAccountName)
 }
 inline ::std::string* CMD_Login_OnSigninCB::mutable_commitaccountname() {
   
   // @@protoc_insertion_point(field_mutable:CMD_Login_OnSigninCB.commitAccountName)
-  return commitaccountname_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return commitaccountname_.Mutable(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 inline ::std::string* CMD_Login_OnSigninCB::release_commitaccountname() {
   // @@protoc_insertion_point(field_release:CMD_Login_OnSigninCB.commitAccountName)
   
-  return commitaccountname_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return commitaccountname_.Release(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
+}
+inline ::std::string* CMD_Login_OnSigninCB::unsafe_arena_release_commitaccountname() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:CMD_Login_OnSigninCB.commitAccountName)
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  
+  return commitaccountname_.UnsafeArenaRelease(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      GetArenaNoVirtual());
 }
 inline void CMD_Login_OnSigninCB::set_allocated_commitaccountname(::std::string* commitaccountname) {
   if (commitaccountname != NULL) {
@@ -8573,51 +10571,65 @@ inline void CMD_Login_OnSigninCB::set_allocated_commitaccountname(::std::string*
   } else {
     
   }
-  commitaccountname_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), commitaccountname);
+  commitaccountname_.SetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), commitaccountname,
+      GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_allocated:CMD_Login_OnSigninCB.commitAccountName)
 }
+inline void CMD_Login_OnSigninCB::unsafe_arena_set_allocated_commitaccountname(
+    ::std::string* commitaccountname) {
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  if (commitaccountname != NULL) {
+    
+  } else {
+    
+  }
+  commitaccountname_.UnsafeArenaSetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      commitaccountname, GetArenaNoVirtual());
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:CMD_Login_OnSigninCB.commitAccountName)
+}
 
 // string realAccountName = 3;
 inline void CMD_Login_OnSigninCB::clear_realaccountname() {
-  realaccountname_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  realaccountname_.ClearToEmpty(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 inline const ::std::string& CMD_Login_OnSigninCB::realaccountname() const {
   // @@protoc_insertion_point(field_get:CMD_Login_OnSigninCB.realAccountName)
-  return realaccountname_.GetNoArena();
+  return realaccountname_.Get();
 }
 inline void CMD_Login_OnSigninCB::set_realaccountname(const ::std::string& value) {
   
-  realaccountname_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  realaccountname_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value, GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set:CMD_Login_OnSigninCB.realAccountName)
 }
-#if LANG_CXX11
-inline void CMD_Login_OnSigninCB::set_realaccountname(::std::string&& value) {
-  
-  realaccountname_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:CMD_Login_OnSigninCB.realAccountName)
-}
-#endif
 inline void CMD_Login_OnSigninCB::set_realaccountname(const char* value) {
   
-  realaccountname_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  realaccountname_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+              GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_char:CMD_Login_OnSigninCB.realAccountName)
 }
-inline void CMD_Login_OnSigninCB::set_realaccountname(const char* value, size_t size) {
+inline void CMD_Login_OnSigninCB::set_realaccountname(const char* value,
+    size_t size) {
   
-  realaccountname_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
+  realaccountname_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_pointer:CMD_Login_OnSigninCB.realAccountName)
 }
 inline ::std::string* CMD_Login_OnSigninCB::mutable_realaccountname() {
   
   // @@protoc_insertion_point(field_mutable:CMD_Login_OnSigninCB.realAccountName)
-  return realaccountname_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return realaccountname_.Mutable(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 inline ::std::string* CMD_Login_OnSigninCB::release_realaccountname() {
   // @@protoc_insertion_point(field_release:CMD_Login_OnSigninCB.realAccountName)
   
-  return realaccountname_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return realaccountname_.Release(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
+}
+inline ::std::string* CMD_Login_OnSigninCB::unsafe_arena_release_realaccountname() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:CMD_Login_OnSigninCB.realAccountName)
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  
+  return realaccountname_.UnsafeArenaRelease(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      GetArenaNoVirtual());
 }
 inline void CMD_Login_OnSigninCB::set_allocated_realaccountname(::std::string* realaccountname) {
   if (realaccountname != NULL) {
@@ -8625,51 +10637,65 @@ inline void CMD_Login_OnSigninCB::set_allocated_realaccountname(::std::string* r
   } else {
     
   }
-  realaccountname_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), realaccountname);
+  realaccountname_.SetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), realaccountname,
+      GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_allocated:CMD_Login_OnSigninCB.realAccountName)
 }
+inline void CMD_Login_OnSigninCB::unsafe_arena_set_allocated_realaccountname(
+    ::std::string* realaccountname) {
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  if (realaccountname != NULL) {
+    
+  } else {
+    
+  }
+  realaccountname_.UnsafeArenaSetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      realaccountname, GetArenaNoVirtual());
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:CMD_Login_OnSigninCB.realAccountName)
+}
 
 // bytes datas = 4;
 inline void CMD_Login_OnSigninCB::clear_datas() {
-  datas_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  datas_.ClearToEmpty(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 inline const ::std::string& CMD_Login_OnSigninCB::datas() const {
   // @@protoc_insertion_point(field_get:CMD_Login_OnSigninCB.datas)
-  return datas_.GetNoArena();
+  return datas_.Get();
 }
 inline void CMD_Login_OnSigninCB::set_datas(const ::std::string& value) {
   
-  datas_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  datas_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value, GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set:CMD_Login_OnSigninCB.datas)
 }
-#if LANG_CXX11
-inline void CMD_Login_OnSigninCB::set_datas(::std::string&& value) {
-  
-  datas_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:CMD_Login_OnSigninCB.datas)
-}
-#endif
 inline void CMD_Login_OnSigninCB::set_datas(const char* value) {
   
-  datas_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  datas_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+              GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_char:CMD_Login_OnSigninCB.datas)
 }
-inline void CMD_Login_OnSigninCB::set_datas(const void* value, size_t size) {
+inline void CMD_Login_OnSigninCB::set_datas(const void* value,
+    size_t size) {
   
-  datas_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
+  datas_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_pointer:CMD_Login_OnSigninCB.datas)
 }
 inline ::std::string* CMD_Login_OnSigninCB::mutable_datas() {
   
   // @@protoc_insertion_point(field_mutable:CMD_Login_OnSigninCB.datas)
-  return datas_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return datas_.Mutable(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 inline ::std::string* CMD_Login_OnSigninCB::release_datas() {
   // @@protoc_insertion_point(field_release:CMD_Login_OnSigninCB.datas)
   
-  return datas_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return datas_.Release(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
+}
+inline ::std::string* CMD_Login_OnSigninCB::unsafe_arena_release_datas() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:CMD_Login_OnSigninCB.datas)
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  
+  return datas_.UnsafeArenaRelease(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      GetArenaNoVirtual());
 }
 inline void CMD_Login_OnSigninCB::set_allocated_datas(::std::string* datas) {
   if (datas != NULL) {
@@ -8677,9 +10703,22 @@ inline void CMD_Login_OnSigninCB::set_allocated_datas(::std::string* datas) {
   } else {
     
   }
-  datas_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), datas);
+  datas_.SetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), datas,
+      GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_allocated:CMD_Login_OnSigninCB.datas)
 }
+inline void CMD_Login_OnSigninCB::unsafe_arena_set_allocated_datas(
+    ::std::string* datas) {
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  if (datas != NULL) {
+    
+  } else {
+    
+  }
+  datas_.UnsafeArenaSetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      datas, GetArenaNoVirtual());
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:CMD_Login_OnSigninCB.datas)
+}
 
 // uint64 foundObjectID = 5;
 inline void CMD_Login_OnSigninCB::clear_foundobjectid() {
@@ -8709,51 +10748,66 @@ inline void CMD_Login_OnSigninCB::set_foundappid(::google::protobuf::uint64 valu
   // @@protoc_insertion_point(field_set:CMD_Login_OnSigninCB.foundAppID)
 }
 
+// uint64 hallsID = 7;
+inline void CMD_Login_OnSigninCB::clear_hallsid() {
+  hallsid_ = GOOGLE_ULONGLONG(0);
+}
+inline ::google::protobuf::uint64 CMD_Login_OnSigninCB::hallsid() const {
+  // @@protoc_insertion_point(field_get:CMD_Login_OnSigninCB.hallsID)
+  return hallsid_;
+}
+inline void CMD_Login_OnSigninCB::set_hallsid(::google::protobuf::uint64 value) {
+  
+  hallsid_ = value;
+  // @@protoc_insertion_point(field_set:CMD_Login_OnSigninCB.hallsID)
+}
+
 // -------------------------------------------------------------------
 
 // CMD_Login_OnRequestAllocClientCB
 
 // string ip = 1;
 inline void CMD_Login_OnRequestAllocClientCB::clear_ip() {
-  ip_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  ip_.ClearToEmpty(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 inline const ::std::string& CMD_Login_OnRequestAllocClientCB::ip() const {
   // @@protoc_insertion_point(field_get:CMD_Login_OnRequestAllocClientCB.ip)
-  return ip_.GetNoArena();
+  return ip_.Get();
 }
 inline void CMD_Login_OnRequestAllocClientCB::set_ip(const ::std::string& value) {
   
-  ip_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  ip_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value, GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set:CMD_Login_OnRequestAllocClientCB.ip)
 }
-#if LANG_CXX11
-inline void CMD_Login_OnRequestAllocClientCB::set_ip(::std::string&& value) {
-  
-  ip_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:CMD_Login_OnRequestAllocClientCB.ip)
-}
-#endif
 inline void CMD_Login_OnRequestAllocClientCB::set_ip(const char* value) {
   
-  ip_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  ip_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+              GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_char:CMD_Login_OnRequestAllocClientCB.ip)
 }
-inline void CMD_Login_OnRequestAllocClientCB::set_ip(const char* value, size_t size) {
+inline void CMD_Login_OnRequestAllocClientCB::set_ip(const char* value,
+    size_t size) {
   
-  ip_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
+  ip_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_pointer:CMD_Login_OnRequestAllocClientCB.ip)
 }
 inline ::std::string* CMD_Login_OnRequestAllocClientCB::mutable_ip() {
   
   // @@protoc_insertion_point(field_mutable:CMD_Login_OnRequestAllocClientCB.ip)
-  return ip_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return ip_.Mutable(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 inline ::std::string* CMD_Login_OnRequestAllocClientCB::release_ip() {
   // @@protoc_insertion_point(field_release:CMD_Login_OnRequestAllocClientCB.ip)
   
-  return ip_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return ip_.Release(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
+}
+inline ::std::string* CMD_Login_OnRequestAllocClientCB::unsafe_arena_release_ip() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:CMD_Login_OnRequestAllocClientCB.ip)
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  
+  return ip_.UnsafeArenaRelease(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      GetArenaNoVirtual());
 }
 inline void CMD_Login_OnRequestAllocClientCB::set_allocated_ip(::std::string* ip) {
   if (ip != NULL) {
@@ -8761,9 +10815,22 @@ inline void CMD_Login_OnRequestAllocClientCB::set_allocated_ip(::std::string* ip
   } else {
     
   }
-  ip_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ip);
+  ip_.SetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ip,
+      GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_allocated:CMD_Login_OnRequestAllocClientCB.ip)
 }
+inline void CMD_Login_OnRequestAllocClientCB::unsafe_arena_set_allocated_ip(
+    ::std::string* ip) {
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  if (ip != NULL) {
+    
+  } else {
+    
+  }
+  ip_.UnsafeArenaSetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      ip, GetArenaNoVirtual());
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:CMD_Login_OnRequestAllocClientCB.ip)
+}
 
 // int32 port = 2;
 inline void CMD_Login_OnRequestAllocClientCB::clear_port() {
@@ -8781,45 +10848,46 @@ inline void CMD_Login_OnRequestAllocClientCB::set_port(::google::protobuf::int32
 
 // string commitAccountName = 3;
 inline void CMD_Login_OnRequestAllocClientCB::clear_commitaccountname() {
-  commitaccountname_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  commitaccountname_.ClearToEmpty(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 inline const ::std::string& CMD_Login_OnRequestAllocClientCB::commitaccountname() const {
   // @@protoc_insertion_point(field_get:CMD_Login_OnRequestAllocClientCB.commitAccountName)
-  return commitaccountname_.GetNoArena();
+  return commitaccountname_.Get();
 }
 inline void CMD_Login_OnRequestAllocClientCB::set_commitaccountname(const ::std::string& value) {
   
-  commitaccountname_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  commitaccountname_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value, GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set:CMD_Login_OnRequestAllocClientCB.commitAccountName)
 }
-#if LANG_CXX11
-inline void CMD_Login_OnRequestAllocClientCB::set_commitaccountname(::std::string&& value) {
-  
-  commitaccountname_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:CMD_Login_OnRequestAllocClientCB.commitAccountName)
-}
-#endif
 inline void CMD_Login_OnRequestAllocClientCB::set_commitaccountname(const char* value) {
   
-  commitaccountname_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  commitaccountname_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+              GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_char:CMD_Login_OnRequestAllocClientCB.commitAccountName)
 }
-inline void CMD_Login_OnRequestAllocClientCB::set_commitaccountname(const char* value, size_t size) {
+inline void CMD_Login_OnRequestAllocClientCB::set_commitaccountname(const char* value,
+    size_t size) {
   
-  commitaccountname_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
+  commitaccountname_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_pointer:CMD_Login_OnRequestAllocClientCB.commitAccountName)
 }
 inline ::std::string* CMD_Login_OnRequestAllocClientCB::mutable_commitaccountname() {
   
   // @@protoc_insertion_point(field_mutable:CMD_Login_OnRequestAllocClientCB.commitAccountName)
-  return commitaccountname_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return commitaccountname_.Mutable(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 inline ::std::string* CMD_Login_OnRequestAllocClientCB::release_commitaccountname() {
   // @@protoc_insertion_point(field_release:CMD_Login_OnRequestAllocClientCB.commitAccountName)
   
-  return commitaccountname_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return commitaccountname_.Release(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
+}
+inline ::std::string* CMD_Login_OnRequestAllocClientCB::unsafe_arena_release_commitaccountname() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:CMD_Login_OnRequestAllocClientCB.commitAccountName)
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  
+  return commitaccountname_.UnsafeArenaRelease(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      GetArenaNoVirtual());
 }
 inline void CMD_Login_OnRequestAllocClientCB::set_allocated_commitaccountname(::std::string* commitaccountname) {
   if (commitaccountname != NULL) {
@@ -8827,9 +10895,22 @@ inline void CMD_Login_OnRequestAllocClientCB::set_allocated_commitaccountname(::
   } else {
     
   }
-  commitaccountname_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), commitaccountname);
+  commitaccountname_.SetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), commitaccountname,
+      GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_allocated:CMD_Login_OnRequestAllocClientCB.commitAccountName)
 }
+inline void CMD_Login_OnRequestAllocClientCB::unsafe_arena_set_allocated_commitaccountname(
+    ::std::string* commitaccountname) {
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  if (commitaccountname != NULL) {
+    
+  } else {
+    
+  }
+  commitaccountname_.UnsafeArenaSetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      commitaccountname, GetArenaNoVirtual());
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:CMD_Login_OnRequestAllocClientCB.commitAccountName)
+}
 
 // .ServerError errcode = 4;
 inline void CMD_Login_OnRequestAllocClientCB::clear_errcode() {
@@ -8859,6 +10940,20 @@ inline void CMD_Login_OnRequestAllocClientCB::set_tokenid(::google::protobuf::ui
   // @@protoc_insertion_point(field_set:CMD_Login_OnRequestAllocClientCB.tokenID)
 }
 
+// uint64 hallsID = 6;
+inline void CMD_Login_OnRequestAllocClientCB::clear_hallsid() {
+  hallsid_ = GOOGLE_ULONGLONG(0);
+}
+inline ::google::protobuf::uint64 CMD_Login_OnRequestAllocClientCB::hallsid() const {
+  // @@protoc_insertion_point(field_get:CMD_Login_OnRequestAllocClientCB.hallsID)
+  return hallsid_;
+}
+inline void CMD_Login_OnRequestAllocClientCB::set_hallsid(::google::protobuf::uint64 value) {
+  
+  hallsid_ = value;
+  // @@protoc_insertion_point(field_set:CMD_Login_OnRequestAllocClientCB.hallsID)
+}
+
 // -------------------------------------------------------------------
 
 // CMD_Dbmgr_WriteAccount
@@ -8879,45 +10974,46 @@ inline void CMD_Dbmgr_WriteAccount::set_appid(::google::protobuf::uint64 value)
 
 // string commitAccountName = 2;
 inline void CMD_Dbmgr_WriteAccount::clear_commitaccountname() {
-  commitaccountname_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  commitaccountname_.ClearToEmpty(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 inline const ::std::string& CMD_Dbmgr_WriteAccount::commitaccountname() const {
   // @@protoc_insertion_point(field_get:CMD_Dbmgr_WriteAccount.commitAccountName)
-  return commitaccountname_.GetNoArena();
+  return commitaccountname_.Get();
 }
 inline void CMD_Dbmgr_WriteAccount::set_commitaccountname(const ::std::string& value) {
   
-  commitaccountname_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  commitaccountname_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value, GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set:CMD_Dbmgr_WriteAccount.commitAccountName)
 }
-#if LANG_CXX11
-inline void CMD_Dbmgr_WriteAccount::set_commitaccountname(::std::string&& value) {
-  
-  commitaccountname_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:CMD_Dbmgr_WriteAccount.commitAccountName)
-}
-#endif
 inline void CMD_Dbmgr_WriteAccount::set_commitaccountname(const char* value) {
   
-  commitaccountname_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  commitaccountname_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+              GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_char:CMD_Dbmgr_WriteAccount.commitAccountName)
 }
-inline void CMD_Dbmgr_WriteAccount::set_commitaccountname(const char* value, size_t size) {
+inline void CMD_Dbmgr_WriteAccount::set_commitaccountname(const char* value,
+    size_t size) {
   
-  commitaccountname_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
+  commitaccountname_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_pointer:CMD_Dbmgr_WriteAccount.commitAccountName)
 }
 inline ::std::string* CMD_Dbmgr_WriteAccount::mutable_commitaccountname() {
   
   // @@protoc_insertion_point(field_mutable:CMD_Dbmgr_WriteAccount.commitAccountName)
-  return commitaccountname_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return commitaccountname_.Mutable(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 inline ::std::string* CMD_Dbmgr_WriteAccount::release_commitaccountname() {
   // @@protoc_insertion_point(field_release:CMD_Dbmgr_WriteAccount.commitAccountName)
   
-  return commitaccountname_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return commitaccountname_.Release(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
+}
+inline ::std::string* CMD_Dbmgr_WriteAccount::unsafe_arena_release_commitaccountname() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:CMD_Dbmgr_WriteAccount.commitAccountName)
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  
+  return commitaccountname_.UnsafeArenaRelease(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      GetArenaNoVirtual());
 }
 inline void CMD_Dbmgr_WriteAccount::set_allocated_commitaccountname(::std::string* commitaccountname) {
   if (commitaccountname != NULL) {
@@ -8925,51 +11021,65 @@ inline void CMD_Dbmgr_WriteAccount::set_allocated_commitaccountname(::std::strin
   } else {
     
   }
-  commitaccountname_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), commitaccountname);
+  commitaccountname_.SetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), commitaccountname,
+      GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_allocated:CMD_Dbmgr_WriteAccount.commitAccountName)
 }
+inline void CMD_Dbmgr_WriteAccount::unsafe_arena_set_allocated_commitaccountname(
+    ::std::string* commitaccountname) {
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  if (commitaccountname != NULL) {
+    
+  } else {
+    
+  }
+  commitaccountname_.UnsafeArenaSetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      commitaccountname, GetArenaNoVirtual());
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:CMD_Dbmgr_WriteAccount.commitAccountName)
+}
 
 // string password = 3;
 inline void CMD_Dbmgr_WriteAccount::clear_password() {
-  password_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  password_.ClearToEmpty(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 inline const ::std::string& CMD_Dbmgr_WriteAccount::password() const {
   // @@protoc_insertion_point(field_get:CMD_Dbmgr_WriteAccount.password)
-  return password_.GetNoArena();
+  return password_.Get();
 }
 inline void CMD_Dbmgr_WriteAccount::set_password(const ::std::string& value) {
   
-  password_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  password_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value, GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set:CMD_Dbmgr_WriteAccount.password)
 }
-#if LANG_CXX11
-inline void CMD_Dbmgr_WriteAccount::set_password(::std::string&& value) {
-  
-  password_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:CMD_Dbmgr_WriteAccount.password)
-}
-#endif
 inline void CMD_Dbmgr_WriteAccount::set_password(const char* value) {
   
-  password_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  password_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+              GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_char:CMD_Dbmgr_WriteAccount.password)
 }
-inline void CMD_Dbmgr_WriteAccount::set_password(const char* value, size_t size) {
+inline void CMD_Dbmgr_WriteAccount::set_password(const char* value,
+    size_t size) {
   
-  password_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
+  password_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_pointer:CMD_Dbmgr_WriteAccount.password)
 }
 inline ::std::string* CMD_Dbmgr_WriteAccount::mutable_password() {
   
   // @@protoc_insertion_point(field_mutable:CMD_Dbmgr_WriteAccount.password)
-  return password_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return password_.Mutable(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 inline ::std::string* CMD_Dbmgr_WriteAccount::release_password() {
   // @@protoc_insertion_point(field_release:CMD_Dbmgr_WriteAccount.password)
   
-  return password_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return password_.Release(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
+}
+inline ::std::string* CMD_Dbmgr_WriteAccount::unsafe_arena_release_password() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:CMD_Dbmgr_WriteAccount.password)
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  
+  return password_.UnsafeArenaRelease(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      GetArenaNoVirtual());
 }
 inline void CMD_Dbmgr_WriteAccount::set_allocated_password(::std::string* password) {
   if (password != NULL) {
@@ -8977,51 +11087,65 @@ inline void CMD_Dbmgr_WriteAccount::set_allocated_password(::std::string* passwo
   } else {
     
   }
-  password_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), password);
-  // @@protoc_insertion_point(field_set_allocated:CMD_Dbmgr_WriteAccount.password)
+  password_.SetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), password,
+      GetArenaNoVirtual());
+  // @@protoc_insertion_point(field_set_allocated:CMD_Dbmgr_WriteAccount.password)
+}
+inline void CMD_Dbmgr_WriteAccount::unsafe_arena_set_allocated_password(
+    ::std::string* password) {
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  if (password != NULL) {
+    
+  } else {
+    
+  }
+  password_.UnsafeArenaSetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      password, GetArenaNoVirtual());
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:CMD_Dbmgr_WriteAccount.password)
 }
 
 // bytes datas = 4;
 inline void CMD_Dbmgr_WriteAccount::clear_datas() {
-  datas_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  datas_.ClearToEmpty(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 inline const ::std::string& CMD_Dbmgr_WriteAccount::datas() const {
   // @@protoc_insertion_point(field_get:CMD_Dbmgr_WriteAccount.datas)
-  return datas_.GetNoArena();
+  return datas_.Get();
 }
 inline void CMD_Dbmgr_WriteAccount::set_datas(const ::std::string& value) {
   
-  datas_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  datas_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value, GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set:CMD_Dbmgr_WriteAccount.datas)
 }
-#if LANG_CXX11
-inline void CMD_Dbmgr_WriteAccount::set_datas(::std::string&& value) {
-  
-  datas_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:CMD_Dbmgr_WriteAccount.datas)
-}
-#endif
 inline void CMD_Dbmgr_WriteAccount::set_datas(const char* value) {
   
-  datas_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  datas_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+              GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_char:CMD_Dbmgr_WriteAccount.datas)
 }
-inline void CMD_Dbmgr_WriteAccount::set_datas(const void* value, size_t size) {
+inline void CMD_Dbmgr_WriteAccount::set_datas(const void* value,
+    size_t size) {
   
-  datas_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
+  datas_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_pointer:CMD_Dbmgr_WriteAccount.datas)
 }
 inline ::std::string* CMD_Dbmgr_WriteAccount::mutable_datas() {
   
   // @@protoc_insertion_point(field_mutable:CMD_Dbmgr_WriteAccount.datas)
-  return datas_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return datas_.Mutable(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 inline ::std::string* CMD_Dbmgr_WriteAccount::release_datas() {
   // @@protoc_insertion_point(field_release:CMD_Dbmgr_WriteAccount.datas)
   
-  return datas_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return datas_.Release(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
+}
+inline ::std::string* CMD_Dbmgr_WriteAccount::unsafe_arena_release_datas() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:CMD_Dbmgr_WriteAccount.datas)
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  
+  return datas_.UnsafeArenaRelease(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      GetArenaNoVirtual());
 }
 inline void CMD_Dbmgr_WriteAccount::set_allocated_datas(::std::string* datas) {
   if (datas != NULL) {
@@ -9029,51 +11153,65 @@ inline void CMD_Dbmgr_WriteAccount::set_allocated_datas(::std::string* datas) {
   } else {
     
   }
-  datas_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), datas);
+  datas_.SetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), datas,
+      GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_allocated:CMD_Dbmgr_WriteAccount.datas)
 }
+inline void CMD_Dbmgr_WriteAccount::unsafe_arena_set_allocated_datas(
+    ::std::string* datas) {
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  if (datas != NULL) {
+    
+  } else {
+    
+  }
+  datas_.UnsafeArenaSetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      datas, GetArenaNoVirtual());
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:CMD_Dbmgr_WriteAccount.datas)
+}
 
 // string playerName = 5;
 inline void CMD_Dbmgr_WriteAccount::clear_playername() {
-  playername_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  playername_.ClearToEmpty(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 inline const ::std::string& CMD_Dbmgr_WriteAccount::playername() const {
   // @@protoc_insertion_point(field_get:CMD_Dbmgr_WriteAccount.playerName)
-  return playername_.GetNoArena();
+  return playername_.Get();
 }
 inline void CMD_Dbmgr_WriteAccount::set_playername(const ::std::string& value) {
   
-  playername_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  playername_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value, GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set:CMD_Dbmgr_WriteAccount.playerName)
 }
-#if LANG_CXX11
-inline void CMD_Dbmgr_WriteAccount::set_playername(::std::string&& value) {
-  
-  playername_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:CMD_Dbmgr_WriteAccount.playerName)
-}
-#endif
 inline void CMD_Dbmgr_WriteAccount::set_playername(const char* value) {
   
-  playername_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  playername_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+              GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_char:CMD_Dbmgr_WriteAccount.playerName)
 }
-inline void CMD_Dbmgr_WriteAccount::set_playername(const char* value, size_t size) {
+inline void CMD_Dbmgr_WriteAccount::set_playername(const char* value,
+    size_t size) {
   
-  playername_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
+  playername_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_pointer:CMD_Dbmgr_WriteAccount.playerName)
 }
 inline ::std::string* CMD_Dbmgr_WriteAccount::mutable_playername() {
   
   // @@protoc_insertion_point(field_mutable:CMD_Dbmgr_WriteAccount.playerName)
-  return playername_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return playername_.Mutable(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 inline ::std::string* CMD_Dbmgr_WriteAccount::release_playername() {
   // @@protoc_insertion_point(field_release:CMD_Dbmgr_WriteAccount.playerName)
   
-  return playername_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return playername_.Release(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
+}
+inline ::std::string* CMD_Dbmgr_WriteAccount::unsafe_arena_release_playername() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:CMD_Dbmgr_WriteAccount.playerName)
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  
+  return playername_.UnsafeArenaRelease(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      GetArenaNoVirtual());
 }
 inline void CMD_Dbmgr_WriteAccount::set_allocated_playername(::std::string* playername) {
   if (playername != NULL) {
@@ -9081,9 +11219,22 @@ inline void CMD_Dbmgr_WriteAccount::set_allocated_playername(::std::string* play
   } else {
     
   }
-  playername_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), playername);
+  playername_.SetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), playername,
+      GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_allocated:CMD_Dbmgr_WriteAccount.playerName)
 }
+inline void CMD_Dbmgr_WriteAccount::unsafe_arena_set_allocated_playername(
+    ::std::string* playername) {
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  if (playername != NULL) {
+    
+  } else {
+    
+  }
+  playername_.UnsafeArenaSetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      playername, GetArenaNoVirtual());
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:CMD_Dbmgr_WriteAccount.playerName)
+}
 
 // int32 modelID = 6;
 inline void CMD_Dbmgr_WriteAccount::clear_modelid() {
@@ -9133,45 +11284,46 @@ inline void CMD_Dbmgr_WriteAccount::set_gold(::google::protobuf::int32 value) {
 
 // string commitAccountName = 1;
 inline void CMD_Dbmgr_QueryAccount::clear_commitaccountname() {
-  commitaccountname_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  commitaccountname_.ClearToEmpty(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 inline const ::std::string& CMD_Dbmgr_QueryAccount::commitaccountname() const {
   // @@protoc_insertion_point(field_get:CMD_Dbmgr_QueryAccount.commitAccountName)
-  return commitaccountname_.GetNoArena();
+  return commitaccountname_.Get();
 }
 inline void CMD_Dbmgr_QueryAccount::set_commitaccountname(const ::std::string& value) {
   
-  commitaccountname_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  commitaccountname_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value, GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set:CMD_Dbmgr_QueryAccount.commitAccountName)
 }
-#if LANG_CXX11
-inline void CMD_Dbmgr_QueryAccount::set_commitaccountname(::std::string&& value) {
-  
-  commitaccountname_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:CMD_Dbmgr_QueryAccount.commitAccountName)
-}
-#endif
 inline void CMD_Dbmgr_QueryAccount::set_commitaccountname(const char* value) {
   
-  commitaccountname_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  commitaccountname_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+              GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_char:CMD_Dbmgr_QueryAccount.commitAccountName)
 }
-inline void CMD_Dbmgr_QueryAccount::set_commitaccountname(const char* value, size_t size) {
+inline void CMD_Dbmgr_QueryAccount::set_commitaccountname(const char* value,
+    size_t size) {
   
-  commitaccountname_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
+  commitaccountname_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_pointer:CMD_Dbmgr_QueryAccount.commitAccountName)
 }
 inline ::std::string* CMD_Dbmgr_QueryAccount::mutable_commitaccountname() {
   
   // @@protoc_insertion_point(field_mutable:CMD_Dbmgr_QueryAccount.commitAccountName)
-  return commitaccountname_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return commitaccountname_.Mutable(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 inline ::std::string* CMD_Dbmgr_QueryAccount::release_commitaccountname() {
   // @@protoc_insertion_point(field_release:CMD_Dbmgr_QueryAccount.commitAccountName)
   
-  return commitaccountname_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return commitaccountname_.Release(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
+}
+inline ::std::string* CMD_Dbmgr_QueryAccount::unsafe_arena_release_commitaccountname() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:CMD_Dbmgr_QueryAccount.commitAccountName)
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  
+  return commitaccountname_.UnsafeArenaRelease(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      GetArenaNoVirtual());
 }
 inline void CMD_Dbmgr_QueryAccount::set_allocated_commitaccountname(::std::string* commitaccountname) {
   if (commitaccountname != NULL) {
@@ -9179,51 +11331,65 @@ inline void CMD_Dbmgr_QueryAccount::set_allocated_commitaccountname(::std::strin
   } else {
     
   }
-  commitaccountname_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), commitaccountname);
+  commitaccountname_.SetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), commitaccountname,
+      GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_allocated:CMD_Dbmgr_QueryAccount.commitAccountName)
 }
+inline void CMD_Dbmgr_QueryAccount::unsafe_arena_set_allocated_commitaccountname(
+    ::std::string* commitaccountname) {
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  if (commitaccountname != NULL) {
+    
+  } else {
+    
+  }
+  commitaccountname_.UnsafeArenaSetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      commitaccountname, GetArenaNoVirtual());
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:CMD_Dbmgr_QueryAccount.commitAccountName)
+}
 
 // string password = 2;
 inline void CMD_Dbmgr_QueryAccount::clear_password() {
-  password_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  password_.ClearToEmpty(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 inline const ::std::string& CMD_Dbmgr_QueryAccount::password() const {
   // @@protoc_insertion_point(field_get:CMD_Dbmgr_QueryAccount.password)
-  return password_.GetNoArena();
+  return password_.Get();
 }
 inline void CMD_Dbmgr_QueryAccount::set_password(const ::std::string& value) {
   
-  password_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  password_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value, GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set:CMD_Dbmgr_QueryAccount.password)
 }
-#if LANG_CXX11
-inline void CMD_Dbmgr_QueryAccount::set_password(::std::string&& value) {
-  
-  password_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:CMD_Dbmgr_QueryAccount.password)
-}
-#endif
 inline void CMD_Dbmgr_QueryAccount::set_password(const char* value) {
   
-  password_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  password_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+              GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_char:CMD_Dbmgr_QueryAccount.password)
 }
-inline void CMD_Dbmgr_QueryAccount::set_password(const char* value, size_t size) {
+inline void CMD_Dbmgr_QueryAccount::set_password(const char* value,
+    size_t size) {
   
-  password_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
+  password_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_pointer:CMD_Dbmgr_QueryAccount.password)
 }
 inline ::std::string* CMD_Dbmgr_QueryAccount::mutable_password() {
   
   // @@protoc_insertion_point(field_mutable:CMD_Dbmgr_QueryAccount.password)
-  return password_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return password_.Mutable(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 inline ::std::string* CMD_Dbmgr_QueryAccount::release_password() {
   // @@protoc_insertion_point(field_release:CMD_Dbmgr_QueryAccount.password)
   
-  return password_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return password_.Release(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
+}
+inline ::std::string* CMD_Dbmgr_QueryAccount::unsafe_arena_release_password() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:CMD_Dbmgr_QueryAccount.password)
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  
+  return password_.UnsafeArenaRelease(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      GetArenaNoVirtual());
 }
 inline void CMD_Dbmgr_QueryAccount::set_allocated_password(::std::string* password) {
   if (password != NULL) {
@@ -9231,9 +11397,22 @@ inline void CMD_Dbmgr_QueryAccount::set_allocated_password(::std::string* passwo
   } else {
     
   }
-  password_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), password);
+  password_.SetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), password,
+      GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_allocated:CMD_Dbmgr_QueryAccount.password)
 }
+inline void CMD_Dbmgr_QueryAccount::unsafe_arena_set_allocated_password(
+    ::std::string* password) {
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  if (password != NULL) {
+    
+  } else {
+    
+  }
+  password_.UnsafeArenaSetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      password, GetArenaNoVirtual());
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:CMD_Dbmgr_QueryAccount.password)
+}
 
 // uint64 queryAppID = 3;
 inline void CMD_Dbmgr_QueryAccount::clear_queryappid() {
@@ -9265,45 +11444,46 @@ inline void CMD_Dbmgr_QueryAccount::set_querytype(::google::protobuf::int32 valu
 
 // string datas = 5;
 inline void CMD_Dbmgr_QueryAccount::clear_datas() {
-  datas_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  datas_.ClearToEmpty(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 inline const ::std::string& CMD_Dbmgr_QueryAccount::datas() const {
   // @@protoc_insertion_point(field_get:CMD_Dbmgr_QueryAccount.datas)
-  return datas_.GetNoArena();
+  return datas_.Get();
 }
 inline void CMD_Dbmgr_QueryAccount::set_datas(const ::std::string& value) {
   
-  datas_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  datas_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value, GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set:CMD_Dbmgr_QueryAccount.datas)
 }
-#if LANG_CXX11
-inline void CMD_Dbmgr_QueryAccount::set_datas(::std::string&& value) {
-  
-  datas_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:CMD_Dbmgr_QueryAccount.datas)
-}
-#endif
 inline void CMD_Dbmgr_QueryAccount::set_datas(const char* value) {
   
-  datas_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  datas_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+              GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_char:CMD_Dbmgr_QueryAccount.datas)
 }
-inline void CMD_Dbmgr_QueryAccount::set_datas(const char* value, size_t size) {
+inline void CMD_Dbmgr_QueryAccount::set_datas(const char* value,
+    size_t size) {
   
-  datas_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
+  datas_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_pointer:CMD_Dbmgr_QueryAccount.datas)
 }
 inline ::std::string* CMD_Dbmgr_QueryAccount::mutable_datas() {
   
   // @@protoc_insertion_point(field_mutable:CMD_Dbmgr_QueryAccount.datas)
-  return datas_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return datas_.Mutable(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 inline ::std::string* CMD_Dbmgr_QueryAccount::release_datas() {
   // @@protoc_insertion_point(field_release:CMD_Dbmgr_QueryAccount.datas)
   
-  return datas_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return datas_.Release(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
+}
+inline ::std::string* CMD_Dbmgr_QueryAccount::unsafe_arena_release_datas() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:CMD_Dbmgr_QueryAccount.datas)
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  
+  return datas_.UnsafeArenaRelease(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      GetArenaNoVirtual());
 }
 inline void CMD_Dbmgr_QueryAccount::set_allocated_datas(::std::string* datas) {
   if (datas != NULL) {
@@ -9311,9 +11491,22 @@ inline void CMD_Dbmgr_QueryAccount::set_allocated_datas(::std::string* datas) {
   } else {
     
   }
-  datas_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), datas);
+  datas_.SetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), datas,
+      GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_allocated:CMD_Dbmgr_QueryAccount.datas)
 }
+inline void CMD_Dbmgr_QueryAccount::unsafe_arena_set_allocated_datas(
+    ::std::string* datas) {
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  if (datas != NULL) {
+    
+  } else {
+    
+  }
+  datas_.UnsafeArenaSetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      datas, GetArenaNoVirtual());
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:CMD_Dbmgr_QueryAccount.datas)
+}
 
 // uint64 accountID = 6;
 inline void CMD_Dbmgr_QueryAccount::clear_accountid() {
@@ -9335,45 +11528,46 @@ inline void CMD_Dbmgr_QueryAccount::set_accountid(::google::protobuf::uint64 val
 
 // string commitAccountName = 1;
 inline void CMD_Dbmgr_UpdateAccountData::clear_commitaccountname() {
-  commitaccountname_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  commitaccountname_.ClearToEmpty(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 inline const ::std::string& CMD_Dbmgr_UpdateAccountData::commitaccountname() const {
   // @@protoc_insertion_point(field_get:CMD_Dbmgr_UpdateAccountData.commitAccountName)
-  return commitaccountname_.GetNoArena();
+  return commitaccountname_.Get();
 }
 inline void CMD_Dbmgr_UpdateAccountData::set_commitaccountname(const ::std::string& value) {
   
-  commitaccountname_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  commitaccountname_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value, GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set:CMD_Dbmgr_UpdateAccountData.commitAccountName)
 }
-#if LANG_CXX11
-inline void CMD_Dbmgr_UpdateAccountData::set_commitaccountname(::std::string&& value) {
-  
-  commitaccountname_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:CMD_Dbmgr_UpdateAccountData.commitAccountName)
-}
-#endif
 inline void CMD_Dbmgr_UpdateAccountData::set_commitaccountname(const char* value) {
   
-  commitaccountname_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  commitaccountname_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+              GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_char:CMD_Dbmgr_UpdateAccountData.commitAccountName)
 }
-inline void CMD_Dbmgr_UpdateAccountData::set_commitaccountname(const char* value, size_t size) {
+inline void CMD_Dbmgr_UpdateAccountData::set_commitaccountname(const char* value,
+    size_t size) {
   
-  commitaccountname_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
+  commitaccountname_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_pointer:CMD_Dbmgr_UpdateAccountData.commitAccountName)
 }
 inline ::std::string* CMD_Dbmgr_UpdateAccountData::mutable_commitaccountname() {
   
   // @@protoc_insertion_point(field_mutable:CMD_Dbmgr_UpdateAccountData.commitAccountName)
-  return commitaccountname_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return commitaccountname_.Mutable(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 inline ::std::string* CMD_Dbmgr_UpdateAccountData::release_commitaccountname() {
   // @@protoc_insertion_point(field_release:CMD_Dbmgr_UpdateAccountData.commitAccountName)
   
-  return commitaccountname_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return commitaccountname_.Release(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
+}
+inline ::std::string* CMD_Dbmgr_UpdateAccountData::unsafe_arena_release_commitaccountname() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:CMD_Dbmgr_UpdateAccountData.commitAccountName)
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  
+  return commitaccountname_.UnsafeArenaRelease(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      GetArenaNoVirtual());
 }
 inline void CMD_Dbmgr_UpdateAccountData::set_allocated_commitaccountname(::std::string* commitaccountname) {
   if (commitaccountname != NULL) {
@@ -9381,51 +11575,65 @@ inline void CMD_Dbmgr_UpdateAccountData::set_allocated_commitaccountname(::std::
   } else {
     
   }
-  commitaccountname_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), commitaccountname);
+  commitaccountname_.SetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), commitaccountname,
+      GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_allocated:CMD_Dbmgr_UpdateAccountData.commitAccountName)
 }
+inline void CMD_Dbmgr_UpdateAccountData::unsafe_arena_set_allocated_commitaccountname(
+    ::std::string* commitaccountname) {
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  if (commitaccountname != NULL) {
+    
+  } else {
+    
+  }
+  commitaccountname_.UnsafeArenaSetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      commitaccountname, GetArenaNoVirtual());
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:CMD_Dbmgr_UpdateAccountData.commitAccountName)
+}
 
 // string playerName = 2;
 inline void CMD_Dbmgr_UpdateAccountData::clear_playername() {
-  playername_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  playername_.ClearToEmpty(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 inline const ::std::string& CMD_Dbmgr_UpdateAccountData::playername() const {
   // @@protoc_insertion_point(field_get:CMD_Dbmgr_UpdateAccountData.playerName)
-  return playername_.GetNoArena();
+  return playername_.Get();
 }
 inline void CMD_Dbmgr_UpdateAccountData::set_playername(const ::std::string& value) {
   
-  playername_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  playername_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value, GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set:CMD_Dbmgr_UpdateAccountData.playerName)
 }
-#if LANG_CXX11
-inline void CMD_Dbmgr_UpdateAccountData::set_playername(::std::string&& value) {
-  
-  playername_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:CMD_Dbmgr_UpdateAccountData.playerName)
-}
-#endif
 inline void CMD_Dbmgr_UpdateAccountData::set_playername(const char* value) {
   
-  playername_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  playername_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+              GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_char:CMD_Dbmgr_UpdateAccountData.playerName)
 }
-inline void CMD_Dbmgr_UpdateAccountData::set_playername(const char* value, size_t size) {
+inline void CMD_Dbmgr_UpdateAccountData::set_playername(const char* value,
+    size_t size) {
   
-  playername_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
+  playername_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_pointer:CMD_Dbmgr_UpdateAccountData.playerName)
 }
 inline ::std::string* CMD_Dbmgr_UpdateAccountData::mutable_playername() {
   
   // @@protoc_insertion_point(field_mutable:CMD_Dbmgr_UpdateAccountData.playerName)
-  return playername_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return playername_.Mutable(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 inline ::std::string* CMD_Dbmgr_UpdateAccountData::release_playername() {
   // @@protoc_insertion_point(field_release:CMD_Dbmgr_UpdateAccountData.playerName)
   
-  return playername_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return playername_.Release(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
+}
+inline ::std::string* CMD_Dbmgr_UpdateAccountData::unsafe_arena_release_playername() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:CMD_Dbmgr_UpdateAccountData.playerName)
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  
+  return playername_.UnsafeArenaRelease(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      GetArenaNoVirtual());
 }
 inline void CMD_Dbmgr_UpdateAccountData::set_allocated_playername(::std::string* playername) {
   if (playername != NULL) {
@@ -9433,9 +11641,22 @@ inline void CMD_Dbmgr_UpdateAccountData::set_allocated_playername(::std::string*
   } else {
     
   }
-  playername_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), playername);
+  playername_.SetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), playername,
+      GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_allocated:CMD_Dbmgr_UpdateAccountData.playerName)
 }
+inline void CMD_Dbmgr_UpdateAccountData::unsafe_arena_set_allocated_playername(
+    ::std::string* playername) {
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  if (playername != NULL) {
+    
+  } else {
+    
+  }
+  playername_.UnsafeArenaSetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      playername, GetArenaNoVirtual());
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:CMD_Dbmgr_UpdateAccountData.playerName)
+}
 
 // int32 modelID = 3;
 inline void CMD_Dbmgr_UpdateAccountData::clear_modelid() {
@@ -9707,45 +11928,46 @@ inline void CMD_Halls_Login::set_tokenid(::google::protobuf::uint64 value) {
 
 // string commitAccountName = 2;
 inline void CMD_Halls_Login::clear_commitaccountname() {
-  commitaccountname_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  commitaccountname_.ClearToEmpty(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 inline const ::std::string& CMD_Halls_Login::commitaccountname() const {
   // @@protoc_insertion_point(field_get:CMD_Halls_Login.commitAccountName)
-  return commitaccountname_.GetNoArena();
+  return commitaccountname_.Get();
 }
 inline void CMD_Halls_Login::set_commitaccountname(const ::std::string& value) {
   
-  commitaccountname_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  commitaccountname_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value, GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set:CMD_Halls_Login.commitAccountName)
 }
-#if LANG_CXX11
-inline void CMD_Halls_Login::set_commitaccountname(::std::string&& value) {
-  
-  commitaccountname_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:CMD_Halls_Login.commitAccountName)
-}
-#endif
 inline void CMD_Halls_Login::set_commitaccountname(const char* value) {
   
-  commitaccountname_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  commitaccountname_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+              GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_char:CMD_Halls_Login.commitAccountName)
 }
-inline void CMD_Halls_Login::set_commitaccountname(const char* value, size_t size) {
+inline void CMD_Halls_Login::set_commitaccountname(const char* value,
+    size_t size) {
   
-  commitaccountname_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
+  commitaccountname_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_pointer:CMD_Halls_Login.commitAccountName)
 }
 inline ::std::string* CMD_Halls_Login::mutable_commitaccountname() {
   
   // @@protoc_insertion_point(field_mutable:CMD_Halls_Login.commitAccountName)
-  return commitaccountname_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return commitaccountname_.Mutable(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 inline ::std::string* CMD_Halls_Login::release_commitaccountname() {
   // @@protoc_insertion_point(field_release:CMD_Halls_Login.commitAccountName)
   
-  return commitaccountname_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return commitaccountname_.Release(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
+}
+inline ::std::string* CMD_Halls_Login::unsafe_arena_release_commitaccountname() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:CMD_Halls_Login.commitAccountName)
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  
+  return commitaccountname_.UnsafeArenaRelease(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      GetArenaNoVirtual());
 }
 inline void CMD_Halls_Login::set_allocated_commitaccountname(::std::string* commitaccountname) {
   if (commitaccountname != NULL) {
@@ -9753,9 +11975,22 @@ inline void CMD_Halls_Login::set_allocated_commitaccountname(::std::string* comm
   } else {
     
   }
-  commitaccountname_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), commitaccountname);
+  commitaccountname_.SetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), commitaccountname,
+      GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_allocated:CMD_Halls_Login.commitAccountName)
 }
+inline void CMD_Halls_Login::unsafe_arena_set_allocated_commitaccountname(
+    ::std::string* commitaccountname) {
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  if (commitaccountname != NULL) {
+    
+  } else {
+    
+  }
+  commitaccountname_.UnsafeArenaSetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      commitaccountname, GetArenaNoVirtual());
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:CMD_Halls_Login.commitAccountName)
+}
 
 // uint64 hallsID = 3;
 inline void CMD_Halls_Login::clear_hallsid() {
@@ -9791,45 +12026,46 @@ inline void CMD_Halls_Login::set_playerid(::google::protobuf::uint64 value) {
 
 // string commitAccountName = 1;
 inline void CMD_Halls_RequestAllocClient::clear_commitaccountname() {
-  commitaccountname_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  commitaccountname_.ClearToEmpty(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 inline const ::std::string& CMD_Halls_RequestAllocClient::commitaccountname() const {
   // @@protoc_insertion_point(field_get:CMD_Halls_RequestAllocClient.commitAccountName)
-  return commitaccountname_.GetNoArena();
+  return commitaccountname_.Get();
 }
 inline void CMD_Halls_RequestAllocClient::set_commitaccountname(const ::std::string& value) {
   
-  commitaccountname_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  commitaccountname_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value, GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set:CMD_Halls_RequestAllocClient.commitAccountName)
 }
-#if LANG_CXX11
-inline void CMD_Halls_RequestAllocClient::set_commitaccountname(::std::string&& value) {
-  
-  commitaccountname_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:CMD_Halls_RequestAllocClient.commitAccountName)
-}
-#endif
 inline void CMD_Halls_RequestAllocClient::set_commitaccountname(const char* value) {
   
-  commitaccountname_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  commitaccountname_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+              GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_char:CMD_Halls_RequestAllocClient.commitAccountName)
 }
-inline void CMD_Halls_RequestAllocClient::set_commitaccountname(const char* value, size_t size) {
+inline void CMD_Halls_RequestAllocClient::set_commitaccountname(const char* value,
+    size_t size) {
   
-  commitaccountname_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
+  commitaccountname_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_pointer:CMD_Halls_RequestAllocClient.commitAccountName)
 }
 inline ::std::string* CMD_Halls_RequestAllocClient::mutable_commitaccountname() {
   
   // @@protoc_insertion_point(field_mutable:CMD_Halls_RequestAllocClient.commitAccountName)
-  return commitaccountname_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return commitaccountname_.Mutable(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 inline ::std::string* CMD_Halls_RequestAllocClient::release_commitaccountname() {
   // @@protoc_insertion_point(field_release:CMD_Halls_RequestAllocClient.commitAccountName)
   
-  return commitaccountname_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return commitaccountname_.Release(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
+}
+inline ::std::string* CMD_Halls_RequestAllocClient::unsafe_arena_release_commitaccountname() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:CMD_Halls_RequestAllocClient.commitAccountName)
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  
+  return commitaccountname_.UnsafeArenaRelease(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      GetArenaNoVirtual());
 }
 inline void CMD_Halls_RequestAllocClient::set_allocated_commitaccountname(::std::string* commitaccountname) {
   if (commitaccountname != NULL) {
@@ -9837,51 +12073,65 @@ inline void CMD_Halls_RequestAllocClient::set_allocated_commitaccountname(::std:
   } else {
     
   }
-  commitaccountname_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), commitaccountname);
+  commitaccountname_.SetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), commitaccountname,
+      GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_allocated:CMD_Halls_RequestAllocClient.commitAccountName)
 }
+inline void CMD_Halls_RequestAllocClient::unsafe_arena_set_allocated_commitaccountname(
+    ::std::string* commitaccountname) {
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  if (commitaccountname != NULL) {
+    
+  } else {
+    
+  }
+  commitaccountname_.UnsafeArenaSetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      commitaccountname, GetArenaNoVirtual());
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:CMD_Halls_RequestAllocClient.commitAccountName)
+}
 
 // string password = 2;
 inline void CMD_Halls_RequestAllocClient::clear_password() {
-  password_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  password_.ClearToEmpty(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 inline const ::std::string& CMD_Halls_RequestAllocClient::password() const {
   // @@protoc_insertion_point(field_get:CMD_Halls_RequestAllocClient.password)
-  return password_.GetNoArena();
+  return password_.Get();
 }
 inline void CMD_Halls_RequestAllocClient::set_password(const ::std::string& value) {
   
-  password_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  password_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value, GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set:CMD_Halls_RequestAllocClient.password)
 }
-#if LANG_CXX11
-inline void CMD_Halls_RequestAllocClient::set_password(::std::string&& value) {
-  
-  password_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:CMD_Halls_RequestAllocClient.password)
-}
-#endif
 inline void CMD_Halls_RequestAllocClient::set_password(const char* value) {
   
-  password_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  password_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+              GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_char:CMD_Halls_RequestAllocClient.password)
 }
-inline void CMD_Halls_RequestAllocClient::set_password(const char* value, size_t size) {
+inline void CMD_Halls_RequestAllocClient::set_password(const char* value,
+    size_t size) {
   
-  password_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
+  password_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_pointer:CMD_Halls_RequestAllocClient.password)
 }
 inline ::std::string* CMD_Halls_RequestAllocClient::mutable_password() {
   
   // @@protoc_insertion_point(field_mutable:CMD_Halls_RequestAllocClient.password)
-  return password_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return password_.Mutable(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 inline ::std::string* CMD_Halls_RequestAllocClient::release_password() {
   // @@protoc_insertion_point(field_release:CMD_Halls_RequestAllocClient.password)
   
-  return password_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return password_.Release(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
+}
+inline ::std::string* CMD_Halls_RequestAllocClient::unsafe_arena_release_password() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:CMD_Halls_RequestAllocClient.password)
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  
+  return password_.UnsafeArenaRelease(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      GetArenaNoVirtual());
 }
 inline void CMD_Halls_RequestAllocClient::set_allocated_password(::std::string* password) {
   if (password != NULL) {
@@ -9889,51 +12139,65 @@ inline void CMD_Halls_RequestAllocClient::set_allocated_password(::std::string*
   } else {
     
   }
-  password_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), password);
+  password_.SetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), password,
+      GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_allocated:CMD_Halls_RequestAllocClient.password)
 }
+inline void CMD_Halls_RequestAllocClient::unsafe_arena_set_allocated_password(
+    ::std::string* password) {
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  if (password != NULL) {
+    
+  } else {
+    
+  }
+  password_.UnsafeArenaSetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      password, GetArenaNoVirtual());
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:CMD_Halls_RequestAllocClient.password)
+}
 
 // bytes datas = 3;
 inline void CMD_Halls_RequestAllocClient::clear_datas() {
-  datas_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  datas_.ClearToEmpty(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 inline const ::std::string& CMD_Halls_RequestAllocClient::datas() const {
   // @@protoc_insertion_point(field_get:CMD_Halls_RequestAllocClient.datas)
-  return datas_.GetNoArena();
+  return datas_.Get();
 }
 inline void CMD_Halls_RequestAllocClient::set_datas(const ::std::string& value) {
   
-  datas_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  datas_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value, GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set:CMD_Halls_RequestAllocClient.datas)
 }
-#if LANG_CXX11
-inline void CMD_Halls_RequestAllocClient::set_datas(::std::string&& value) {
-  
-  datas_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:CMD_Halls_RequestAllocClient.datas)
-}
-#endif
 inline void CMD_Halls_RequestAllocClient::set_datas(const char* value) {
   
-  datas_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  datas_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+              GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_char:CMD_Halls_RequestAllocClient.datas)
 }
-inline void CMD_Halls_RequestAllocClient::set_datas(const void* value, size_t size) {
+inline void CMD_Halls_RequestAllocClient::set_datas(const void* value,
+    size_t size) {
   
-  datas_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
+  datas_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_pointer:CMD_Halls_RequestAllocClient.datas)
 }
 inline ::std::string* CMD_Halls_RequestAllocClient::mutable_datas() {
   
   // @@protoc_insertion_point(field_mutable:CMD_Halls_RequestAllocClient.datas)
-  return datas_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return datas_.Mutable(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 inline ::std::string* CMD_Halls_RequestAllocClient::release_datas() {
   // @@protoc_insertion_point(field_release:CMD_Halls_RequestAllocClient.datas)
   
-  return datas_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return datas_.Release(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
+}
+inline ::std::string* CMD_Halls_RequestAllocClient::unsafe_arena_release_datas() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:CMD_Halls_RequestAllocClient.datas)
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  
+  return datas_.UnsafeArenaRelease(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      GetArenaNoVirtual());
 }
 inline void CMD_Halls_RequestAllocClient::set_allocated_datas(::std::string* datas) {
   if (datas != NULL) {
@@ -9941,9 +12205,22 @@ inline void CMD_Halls_RequestAllocClient::set_allocated_datas(::std::string* dat
   } else {
     
   }
-  datas_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), datas);
+  datas_.SetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), datas,
+      GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_allocated:CMD_Halls_RequestAllocClient.datas)
 }
+inline void CMD_Halls_RequestAllocClient::unsafe_arena_set_allocated_datas(
+    ::std::string* datas) {
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  if (datas != NULL) {
+    
+  } else {
+    
+  }
+  datas_.UnsafeArenaSetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      datas, GetArenaNoVirtual());
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:CMD_Halls_RequestAllocClient.datas)
+}
 
 // uint64 foundObjectID = 4;
 inline void CMD_Halls_RequestAllocClient::clear_foundobjectid() {
@@ -10029,45 +12306,46 @@ inline void CMD_Halls_OnRequestCreateRoomCB::set_roomid(::google::protobuf::uint
 
 // string ip = 2;
 inline void CMD_Halls_OnRequestCreateRoomCB::clear_ip() {
-  ip_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  ip_.ClearToEmpty(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 inline const ::std::string& CMD_Halls_OnRequestCreateRoomCB::ip() const {
   // @@protoc_insertion_point(field_get:CMD_Halls_OnRequestCreateRoomCB.ip)
-  return ip_.GetNoArena();
+  return ip_.Get();
 }
 inline void CMD_Halls_OnRequestCreateRoomCB::set_ip(const ::std::string& value) {
   
-  ip_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  ip_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value, GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set:CMD_Halls_OnRequestCreateRoomCB.ip)
 }
-#if LANG_CXX11
-inline void CMD_Halls_OnRequestCreateRoomCB::set_ip(::std::string&& value) {
-  
-  ip_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:CMD_Halls_OnRequestCreateRoomCB.ip)
-}
-#endif
 inline void CMD_Halls_OnRequestCreateRoomCB::set_ip(const char* value) {
   
-  ip_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  ip_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+              GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_char:CMD_Halls_OnRequestCreateRoomCB.ip)
 }
-inline void CMD_Halls_OnRequestCreateRoomCB::set_ip(const char* value, size_t size) {
+inline void CMD_Halls_OnRequestCreateRoomCB::set_ip(const char* value,
+    size_t size) {
   
-  ip_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
+  ip_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_pointer:CMD_Halls_OnRequestCreateRoomCB.ip)
 }
 inline ::std::string* CMD_Halls_OnRequestCreateRoomCB::mutable_ip() {
   
   // @@protoc_insertion_point(field_mutable:CMD_Halls_OnRequestCreateRoomCB.ip)
-  return ip_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return ip_.Mutable(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 inline ::std::string* CMD_Halls_OnRequestCreateRoomCB::release_ip() {
   // @@protoc_insertion_point(field_release:CMD_Halls_OnRequestCreateRoomCB.ip)
   
-  return ip_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return ip_.Release(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
+}
+inline ::std::string* CMD_Halls_OnRequestCreateRoomCB::unsafe_arena_release_ip() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:CMD_Halls_OnRequestCreateRoomCB.ip)
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  
+  return ip_.UnsafeArenaRelease(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      GetArenaNoVirtual());
 }
 inline void CMD_Halls_OnRequestCreateRoomCB::set_allocated_ip(::std::string* ip) {
   if (ip != NULL) {
@@ -10075,9 +12353,22 @@ inline void CMD_Halls_OnRequestCreateRoomCB::set_allocated_ip(::std::string* ip)
   } else {
     
   }
-  ip_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ip);
+  ip_.SetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ip,
+      GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_allocated:CMD_Halls_OnRequestCreateRoomCB.ip)
 }
+inline void CMD_Halls_OnRequestCreateRoomCB::unsafe_arena_set_allocated_ip(
+    ::std::string* ip) {
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  if (ip != NULL) {
+    
+  } else {
+    
+  }
+  ip_.UnsafeArenaSetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      ip, GetArenaNoVirtual());
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:CMD_Halls_OnRequestCreateRoomCB.ip)
+}
 
 // int32 port = 3;
 inline void CMD_Halls_OnRequestCreateRoomCB::clear_port() {
@@ -10189,45 +12480,46 @@ CMD_Halls_OnRoomSrvGameOverReport::playerdatas() const {
 
 // string commitAccountName = 1;
 inline void CMD_Halls_OnQueryAccountCB::clear_commitaccountname() {
-  commitaccountname_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  commitaccountname_.ClearToEmpty(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 inline const ::std::string& CMD_Halls_OnQueryAccountCB::commitaccountname() const {
   // @@protoc_insertion_point(field_get:CMD_Halls_OnQueryAccountCB.commitAccountName)
-  return commitaccountname_.GetNoArena();
+  return commitaccountname_.Get();
 }
 inline void CMD_Halls_OnQueryAccountCB::set_commitaccountname(const ::std::string& value) {
   
-  commitaccountname_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  commitaccountname_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value, GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set:CMD_Halls_OnQueryAccountCB.commitAccountName)
 }
-#if LANG_CXX11
-inline void CMD_Halls_OnQueryAccountCB::set_commitaccountname(::std::string&& value) {
-  
-  commitaccountname_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:CMD_Halls_OnQueryAccountCB.commitAccountName)
-}
-#endif
 inline void CMD_Halls_OnQueryAccountCB::set_commitaccountname(const char* value) {
   
-  commitaccountname_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  commitaccountname_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+              GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_char:CMD_Halls_OnQueryAccountCB.commitAccountName)
 }
-inline void CMD_Halls_OnQueryAccountCB::set_commitaccountname(const char* value, size_t size) {
+inline void CMD_Halls_OnQueryAccountCB::set_commitaccountname(const char* value,
+    size_t size) {
   
-  commitaccountname_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
+  commitaccountname_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_pointer:CMD_Halls_OnQueryAccountCB.commitAccountName)
 }
 inline ::std::string* CMD_Halls_OnQueryAccountCB::mutable_commitaccountname() {
   
   // @@protoc_insertion_point(field_mutable:CMD_Halls_OnQueryAccountCB.commitAccountName)
-  return commitaccountname_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return commitaccountname_.Mutable(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 inline ::std::string* CMD_Halls_OnQueryAccountCB::release_commitaccountname() {
   // @@protoc_insertion_point(field_release:CMD_Halls_OnQueryAccountCB.commitAccountName)
   
-  return commitaccountname_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return commitaccountname_.Release(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
+}
+inline ::std::string* CMD_Halls_OnQueryAccountCB::unsafe_arena_release_commitaccountname() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:CMD_Halls_OnQueryAccountCB.commitAccountName)
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  
+  return commitaccountname_.UnsafeArenaRelease(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      GetArenaNoVirtual());
 }
 inline void CMD_Halls_OnQueryAccountCB::set_allocated_commitaccountname(::std::string* commitaccountname) {
   if (commitaccountname != NULL) {
@@ -10235,51 +12527,65 @@ inline void CMD_Halls_OnQueryAccountCB::set_allocated_commitaccountname(::std::s
   } else {
     
   }
-  commitaccountname_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), commitaccountname);
+  commitaccountname_.SetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), commitaccountname,
+      GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_allocated:CMD_Halls_OnQueryAccountCB.commitAccountName)
 }
+inline void CMD_Halls_OnQueryAccountCB::unsafe_arena_set_allocated_commitaccountname(
+    ::std::string* commitaccountname) {
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  if (commitaccountname != NULL) {
+    
+  } else {
+    
+  }
+  commitaccountname_.UnsafeArenaSetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      commitaccountname, GetArenaNoVirtual());
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:CMD_Halls_OnQueryAccountCB.commitAccountName)
+}
 
 // bytes datas = 2;
 inline void CMD_Halls_OnQueryAccountCB::clear_datas() {
-  datas_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  datas_.ClearToEmpty(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 inline const ::std::string& CMD_Halls_OnQueryAccountCB::datas() const {
   // @@protoc_insertion_point(field_get:CMD_Halls_OnQueryAccountCB.datas)
-  return datas_.GetNoArena();
+  return datas_.Get();
 }
 inline void CMD_Halls_OnQueryAccountCB::set_datas(const ::std::string& value) {
   
-  datas_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  datas_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value, GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set:CMD_Halls_OnQueryAccountCB.datas)
 }
-#if LANG_CXX11
-inline void CMD_Halls_OnQueryAccountCB::set_datas(::std::string&& value) {
-  
-  datas_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:CMD_Halls_OnQueryAccountCB.datas)
-}
-#endif
 inline void CMD_Halls_OnQueryAccountCB::set_datas(const char* value) {
   
-  datas_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  datas_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+              GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_char:CMD_Halls_OnQueryAccountCB.datas)
 }
-inline void CMD_Halls_OnQueryAccountCB::set_datas(const void* value, size_t size) {
+inline void CMD_Halls_OnQueryAccountCB::set_datas(const void* value,
+    size_t size) {
   
-  datas_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
+  datas_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_pointer:CMD_Halls_OnQueryAccountCB.datas)
 }
 inline ::std::string* CMD_Halls_OnQueryAccountCB::mutable_datas() {
   
   // @@protoc_insertion_point(field_mutable:CMD_Halls_OnQueryAccountCB.datas)
-  return datas_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return datas_.Mutable(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 inline ::std::string* CMD_Halls_OnQueryAccountCB::release_datas() {
   // @@protoc_insertion_point(field_release:CMD_Halls_OnQueryAccountCB.datas)
   
-  return datas_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return datas_.Release(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
+}
+inline ::std::string* CMD_Halls_OnQueryAccountCB::unsafe_arena_release_datas() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:CMD_Halls_OnQueryAccountCB.datas)
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  
+  return datas_.UnsafeArenaRelease(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      GetArenaNoVirtual());
 }
 inline void CMD_Halls_OnQueryAccountCB::set_allocated_datas(::std::string* datas) {
   if (datas != NULL) {
@@ -10287,9 +12593,22 @@ inline void CMD_Halls_OnQueryAccountCB::set_allocated_datas(::std::string* datas
   } else {
     
   }
-  datas_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), datas);
+  datas_.SetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), datas,
+      GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_allocated:CMD_Halls_OnQueryAccountCB.datas)
 }
+inline void CMD_Halls_OnQueryAccountCB::unsafe_arena_set_allocated_datas(
+    ::std::string* datas) {
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  if (datas != NULL) {
+    
+  } else {
+    
+  }
+  datas_.UnsafeArenaSetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      datas, GetArenaNoVirtual());
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:CMD_Halls_OnQueryAccountCB.datas)
+}
 
 // uint64 foundObjectID = 3;
 inline void CMD_Halls_OnQueryAccountCB::clear_foundobjectid() {
@@ -10307,45 +12626,46 @@ inline void CMD_Halls_OnQueryAccountCB::set_foundobjectid(::google::protobuf::ui
 
 // string playerName = 4;
 inline void CMD_Halls_OnQueryAccountCB::clear_playername() {
-  playername_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  playername_.ClearToEmpty(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 inline const ::std::string& CMD_Halls_OnQueryAccountCB::playername() const {
   // @@protoc_insertion_point(field_get:CMD_Halls_OnQueryAccountCB.playerName)
-  return playername_.GetNoArena();
+  return playername_.Get();
 }
 inline void CMD_Halls_OnQueryAccountCB::set_playername(const ::std::string& value) {
   
-  playername_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  playername_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value, GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set:CMD_Halls_OnQueryAccountCB.playerName)
 }
-#if LANG_CXX11
-inline void CMD_Halls_OnQueryAccountCB::set_playername(::std::string&& value) {
-  
-  playername_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:CMD_Halls_OnQueryAccountCB.playerName)
-}
-#endif
 inline void CMD_Halls_OnQueryAccountCB::set_playername(const char* value) {
   
-  playername_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  playername_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+              GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_char:CMD_Halls_OnQueryAccountCB.playerName)
 }
-inline void CMD_Halls_OnQueryAccountCB::set_playername(const char* value, size_t size) {
+inline void CMD_Halls_OnQueryAccountCB::set_playername(const char* value,
+    size_t size) {
   
-  playername_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
+  playername_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_pointer:CMD_Halls_OnQueryAccountCB.playerName)
 }
 inline ::std::string* CMD_Halls_OnQueryAccountCB::mutable_playername() {
   
   // @@protoc_insertion_point(field_mutable:CMD_Halls_OnQueryAccountCB.playerName)
-  return playername_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return playername_.Mutable(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 inline ::std::string* CMD_Halls_OnQueryAccountCB::release_playername() {
   // @@protoc_insertion_point(field_release:CMD_Halls_OnQueryAccountCB.playerName)
   
-  return playername_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return playername_.Release(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
+}
+inline ::std::string* CMD_Halls_OnQueryAccountCB::unsafe_arena_release_playername() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:CMD_Halls_OnQueryAccountCB.playerName)
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  
+  return playername_.UnsafeArenaRelease(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      GetArenaNoVirtual());
 }
 inline void CMD_Halls_OnQueryAccountCB::set_allocated_playername(::std::string* playername) {
   if (playername != NULL) {
@@ -10353,9 +12673,22 @@ inline void CMD_Halls_OnQueryAccountCB::set_allocated_playername(::std::string*
   } else {
     
   }
-  playername_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), playername);
+  playername_.SetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), playername,
+      GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_allocated:CMD_Halls_OnQueryAccountCB.playerName)
 }
+inline void CMD_Halls_OnQueryAccountCB::unsafe_arena_set_allocated_playername(
+    ::std::string* playername) {
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  if (playername != NULL) {
+    
+  } else {
+    
+  }
+  playername_.UnsafeArenaSetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      playername, GetArenaNoVirtual());
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:CMD_Halls_OnQueryAccountCB.playerName)
+}
 
 // int32 modelID = 5;
 inline void CMD_Halls_OnQueryAccountCB::clear_modelid() {
@@ -10627,45 +12960,46 @@ inline void CMD_Halls_ListGames::set_maxnum(::google::protobuf::uint32 value) {
 
 // string commitAccountName = 1;
 inline void CMD_Hallsmgr_RequestAllocClient::clear_commitaccountname() {
-  commitaccountname_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  commitaccountname_.ClearToEmpty(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 inline const ::std::string& CMD_Hallsmgr_RequestAllocClient::commitaccountname() const {
   // @@protoc_insertion_point(field_get:CMD_Hallsmgr_RequestAllocClient.commitAccountName)
-  return commitaccountname_.GetNoArena();
+  return commitaccountname_.Get();
 }
 inline void CMD_Hallsmgr_RequestAllocClient::set_commitaccountname(const ::std::string& value) {
   
-  commitaccountname_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  commitaccountname_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value, GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set:CMD_Hallsmgr_RequestAllocClient.commitAccountName)
 }
-#if LANG_CXX11
-inline void CMD_Hallsmgr_RequestAllocClient::set_commitaccountname(::std::string&& value) {
-  
-  commitaccountname_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:CMD_Hallsmgr_RequestAllocClient.commitAccountName)
-}
-#endif
 inline void CMD_Hallsmgr_RequestAllocClient::set_commitaccountname(const char* value) {
   
-  commitaccountname_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  commitaccountname_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+              GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_char:CMD_Hallsmgr_RequestAllocClient.commitAccountName)
 }
-inline void CMD_Hallsmgr_RequestAllocClient::set_commitaccountname(const char* value, size_t size) {
+inline void CMD_Hallsmgr_RequestAllocClient::set_commitaccountname(const char* value,
+    size_t size) {
   
-  commitaccountname_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
+  commitaccountname_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_pointer:CMD_Hallsmgr_RequestAllocClient.commitAccountName)
 }
 inline ::std::string* CMD_Hallsmgr_RequestAllocClient::mutable_commitaccountname() {
   
   // @@protoc_insertion_point(field_mutable:CMD_Hallsmgr_RequestAllocClient.commitAccountName)
-  return commitaccountname_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return commitaccountname_.Mutable(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 inline ::std::string* CMD_Hallsmgr_RequestAllocClient::release_commitaccountname() {
   // @@protoc_insertion_point(field_release:CMD_Hallsmgr_RequestAllocClient.commitAccountName)
   
-  return commitaccountname_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return commitaccountname_.Release(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
+}
+inline ::std::string* CMD_Hallsmgr_RequestAllocClient::unsafe_arena_release_commitaccountname() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:CMD_Hallsmgr_RequestAllocClient.commitAccountName)
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  
+  return commitaccountname_.UnsafeArenaRelease(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      GetArenaNoVirtual());
 }
 inline void CMD_Hallsmgr_RequestAllocClient::set_allocated_commitaccountname(::std::string* commitaccountname) {
   if (commitaccountname != NULL) {
@@ -10673,51 +13007,65 @@ inline void CMD_Hallsmgr_RequestAllocClient::set_allocated_commitaccountname(::s
   } else {
     
   }
-  commitaccountname_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), commitaccountname);
+  commitaccountname_.SetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), commitaccountname,
+      GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_allocated:CMD_Hallsmgr_RequestAllocClient.commitAccountName)
 }
+inline void CMD_Hallsmgr_RequestAllocClient::unsafe_arena_set_allocated_commitaccountname(
+    ::std::string* commitaccountname) {
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  if (commitaccountname != NULL) {
+    
+  } else {
+    
+  }
+  commitaccountname_.UnsafeArenaSetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      commitaccountname, GetArenaNoVirtual());
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:CMD_Hallsmgr_RequestAllocClient.commitAccountName)
+}
 
 // string password = 2;
 inline void CMD_Hallsmgr_RequestAllocClient::clear_password() {
-  password_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  password_.ClearToEmpty(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 inline const ::std::string& CMD_Hallsmgr_RequestAllocClient::password() const {
   // @@protoc_insertion_point(field_get:CMD_Hallsmgr_RequestAllocClient.password)
-  return password_.GetNoArena();
+  return password_.Get();
 }
 inline void CMD_Hallsmgr_RequestAllocClient::set_password(const ::std::string& value) {
   
-  password_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  password_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value, GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set:CMD_Hallsmgr_RequestAllocClient.password)
 }
-#if LANG_CXX11
-inline void CMD_Hallsmgr_RequestAllocClient::set_password(::std::string&& value) {
-  
-  password_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:CMD_Hallsmgr_RequestAllocClient.password)
-}
-#endif
 inline void CMD_Hallsmgr_RequestAllocClient::set_password(const char* value) {
   
-  password_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  password_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+              GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_char:CMD_Hallsmgr_RequestAllocClient.password)
 }
-inline void CMD_Hallsmgr_RequestAllocClient::set_password(const char* value, size_t size) {
+inline void CMD_Hallsmgr_RequestAllocClient::set_password(const char* value,
+    size_t size) {
   
-  password_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
+  password_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_pointer:CMD_Hallsmgr_RequestAllocClient.password)
 }
 inline ::std::string* CMD_Hallsmgr_RequestAllocClient::mutable_password() {
   
   // @@protoc_insertion_point(field_mutable:CMD_Hallsmgr_RequestAllocClient.password)
-  return password_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return password_.Mutable(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 inline ::std::string* CMD_Hallsmgr_RequestAllocClient::release_password() {
   // @@protoc_insertion_point(field_release:CMD_Hallsmgr_RequestAllocClient.password)
   
-  return password_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return password_.Release(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
+}
+inline ::std::string* CMD_Hallsmgr_RequestAllocClient::unsafe_arena_release_password() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:CMD_Hallsmgr_RequestAllocClient.password)
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  
+  return password_.UnsafeArenaRelease(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      GetArenaNoVirtual());
 }
 inline void CMD_Hallsmgr_RequestAllocClient::set_allocated_password(::std::string* password) {
   if (password != NULL) {
@@ -10725,51 +13073,65 @@ inline void CMD_Hallsmgr_RequestAllocClient::set_allocated_password(::std::strin
   } else {
     
   }
-  password_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), password);
+  password_.SetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), password,
+      GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_allocated:CMD_Hallsmgr_RequestAllocClient.password)
 }
+inline void CMD_Hallsmgr_RequestAllocClient::unsafe_arena_set_allocated_password(
+    ::std::string* password) {
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  if (password != NULL) {
+    
+  } else {
+    
+  }
+  password_.UnsafeArenaSetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      password, GetArenaNoVirtual());
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:CMD_Hallsmgr_RequestAllocClient.password)
+}
 
 // bytes datas = 3;
 inline void CMD_Hallsmgr_RequestAllocClient::clear_datas() {
-  datas_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  datas_.ClearToEmpty(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 inline const ::std::string& CMD_Hallsmgr_RequestAllocClient::datas() const {
   // @@protoc_insertion_point(field_get:CMD_Hallsmgr_RequestAllocClient.datas)
-  return datas_.GetNoArena();
+  return datas_.Get();
 }
 inline void CMD_Hallsmgr_RequestAllocClient::set_datas(const ::std::string& value) {
   
-  datas_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  datas_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value, GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set:CMD_Hallsmgr_RequestAllocClient.datas)
 }
-#if LANG_CXX11
-inline void CMD_Hallsmgr_RequestAllocClient::set_datas(::std::string&& value) {
-  
-  datas_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:CMD_Hallsmgr_RequestAllocClient.datas)
-}
-#endif
 inline void CMD_Hallsmgr_RequestAllocClient::set_datas(const char* value) {
   
-  datas_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  datas_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+              GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_char:CMD_Hallsmgr_RequestAllocClient.datas)
 }
-inline void CMD_Hallsmgr_RequestAllocClient::set_datas(const void* value, size_t size) {
+inline void CMD_Hallsmgr_RequestAllocClient::set_datas(const void* value,
+    size_t size) {
   
-  datas_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
+  datas_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_pointer:CMD_Hallsmgr_RequestAllocClient.datas)
 }
 inline ::std::string* CMD_Hallsmgr_RequestAllocClient::mutable_datas() {
   
   // @@protoc_insertion_point(field_mutable:CMD_Hallsmgr_RequestAllocClient.datas)
-  return datas_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return datas_.Mutable(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 inline ::std::string* CMD_Hallsmgr_RequestAllocClient::release_datas() {
   // @@protoc_insertion_point(field_release:CMD_Hallsmgr_RequestAllocClient.datas)
   
-  return datas_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return datas_.Release(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
+}
+inline ::std::string* CMD_Hallsmgr_RequestAllocClient::unsafe_arena_release_datas() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:CMD_Hallsmgr_RequestAllocClient.datas)
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  
+  return datas_.UnsafeArenaRelease(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      GetArenaNoVirtual());
 }
 inline void CMD_Hallsmgr_RequestAllocClient::set_allocated_datas(::std::string* datas) {
   if (datas != NULL) {
@@ -10777,9 +13139,22 @@ inline void CMD_Hallsmgr_RequestAllocClient::set_allocated_datas(::std::string*
   } else {
     
   }
-  datas_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), datas);
+  datas_.SetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), datas,
+      GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_allocated:CMD_Hallsmgr_RequestAllocClient.datas)
 }
+inline void CMD_Hallsmgr_RequestAllocClient::unsafe_arena_set_allocated_datas(
+    ::std::string* datas) {
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  if (datas != NULL) {
+    
+  } else {
+    
+  }
+  datas_.UnsafeArenaSetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      datas, GetArenaNoVirtual());
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:CMD_Hallsmgr_RequestAllocClient.datas)
+}
 
 // uint64 foundObjectID = 4;
 inline void CMD_Hallsmgr_RequestAllocClient::clear_foundobjectid() {
@@ -10815,45 +13190,46 @@ inline void CMD_Hallsmgr_RequestAllocClient::set_foundappid(::google::protobuf::
 
 // string ip = 1;
 inline void CMD_Hallsmgr_OnRequestAllocClientCB::clear_ip() {
-  ip_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  ip_.ClearToEmpty(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 inline const ::std::string& CMD_Hallsmgr_OnRequestAllocClientCB::ip() const {
   // @@protoc_insertion_point(field_get:CMD_Hallsmgr_OnRequestAllocClientCB.ip)
-  return ip_.GetNoArena();
+  return ip_.Get();
 }
 inline void CMD_Hallsmgr_OnRequestAllocClientCB::set_ip(const ::std::string& value) {
   
-  ip_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  ip_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value, GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set:CMD_Hallsmgr_OnRequestAllocClientCB.ip)
 }
-#if LANG_CXX11
-inline void CMD_Hallsmgr_OnRequestAllocClientCB::set_ip(::std::string&& value) {
-  
-  ip_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:CMD_Hallsmgr_OnRequestAllocClientCB.ip)
-}
-#endif
 inline void CMD_Hallsmgr_OnRequestAllocClientCB::set_ip(const char* value) {
   
-  ip_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  ip_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+              GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_char:CMD_Hallsmgr_OnRequestAllocClientCB.ip)
 }
-inline void CMD_Hallsmgr_OnRequestAllocClientCB::set_ip(const char* value, size_t size) {
+inline void CMD_Hallsmgr_OnRequestAllocClientCB::set_ip(const char* value,
+    size_t size) {
   
-  ip_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
+  ip_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_pointer:CMD_Hallsmgr_OnRequestAllocClientCB.ip)
 }
 inline ::std::string* CMD_Hallsmgr_OnRequestAllocClientCB::mutable_ip() {
   
   // @@protoc_insertion_point(field_mutable:CMD_Hallsmgr_OnRequestAllocClientCB.ip)
-  return ip_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return ip_.Mutable(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 inline ::std::string* CMD_Hallsmgr_OnRequestAllocClientCB::release_ip() {
   // @@protoc_insertion_point(field_release:CMD_Hallsmgr_OnRequestAllocClientCB.ip)
   
-  return ip_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return ip_.Release(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
+}
+inline ::std::string* CMD_Hallsmgr_OnRequestAllocClientCB::unsafe_arena_release_ip() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:CMD_Hallsmgr_OnRequestAllocClientCB.ip)
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  
+  return ip_.UnsafeArenaRelease(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      GetArenaNoVirtual());
 }
 inline void CMD_Hallsmgr_OnRequestAllocClientCB::set_allocated_ip(::std::string* ip) {
   if (ip != NULL) {
@@ -10861,9 +13237,22 @@ inline void CMD_Hallsmgr_OnRequestAllocClientCB::set_allocated_ip(::std::string*
   } else {
     
   }
-  ip_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ip);
+  ip_.SetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ip,
+      GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_allocated:CMD_Hallsmgr_OnRequestAllocClientCB.ip)
 }
+inline void CMD_Hallsmgr_OnRequestAllocClientCB::unsafe_arena_set_allocated_ip(
+    ::std::string* ip) {
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  if (ip != NULL) {
+    
+  } else {
+    
+  }
+  ip_.UnsafeArenaSetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      ip, GetArenaNoVirtual());
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:CMD_Hallsmgr_OnRequestAllocClientCB.ip)
+}
 
 // int32 port = 2;
 inline void CMD_Hallsmgr_OnRequestAllocClientCB::clear_port() {
@@ -10881,45 +13270,46 @@ inline void CMD_Hallsmgr_OnRequestAllocClientCB::set_port(::google::protobuf::in
 
 // string commitAccountName = 3;
 inline void CMD_Hallsmgr_OnRequestAllocClientCB::clear_commitaccountname() {
-  commitaccountname_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  commitaccountname_.ClearToEmpty(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 inline const ::std::string& CMD_Hallsmgr_OnRequestAllocClientCB::commitaccountname() const {
   // @@protoc_insertion_point(field_get:CMD_Hallsmgr_OnRequestAllocClientCB.commitAccountName)
-  return commitaccountname_.GetNoArena();
+  return commitaccountname_.Get();
 }
 inline void CMD_Hallsmgr_OnRequestAllocClientCB::set_commitaccountname(const ::std::string& value) {
   
-  commitaccountname_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  commitaccountname_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value, GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set:CMD_Hallsmgr_OnRequestAllocClientCB.commitAccountName)
 }
-#if LANG_CXX11
-inline void CMD_Hallsmgr_OnRequestAllocClientCB::set_commitaccountname(::std::string&& value) {
-  
-  commitaccountname_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:CMD_Hallsmgr_OnRequestAllocClientCB.commitAccountName)
-}
-#endif
 inline void CMD_Hallsmgr_OnRequestAllocClientCB::set_commitaccountname(const char* value) {
   
-  commitaccountname_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  commitaccountname_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+              GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_char:CMD_Hallsmgr_OnRequestAllocClientCB.commitAccountName)
 }
-inline void CMD_Hallsmgr_OnRequestAllocClientCB::set_commitaccountname(const char* value, size_t size) {
+inline void CMD_Hallsmgr_OnRequestAllocClientCB::set_commitaccountname(const char* value,
+    size_t size) {
   
-  commitaccountname_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
+  commitaccountname_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_pointer:CMD_Hallsmgr_OnRequestAllocClientCB.commitAccountName)
 }
 inline ::std::string* CMD_Hallsmgr_OnRequestAllocClientCB::mutable_commitaccountname() {
   
   // @@protoc_insertion_point(field_mutable:CMD_Hallsmgr_OnRequestAllocClientCB.commitAccountName)
-  return commitaccountname_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return commitaccountname_.Mutable(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 inline ::std::string* CMD_Hallsmgr_OnRequestAllocClientCB::release_commitaccountname() {
   // @@protoc_insertion_point(field_release:CMD_Hallsmgr_OnRequestAllocClientCB.commitAccountName)
   
-  return commitaccountname_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return commitaccountname_.Release(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
+}
+inline ::std::string* CMD_Hallsmgr_OnRequestAllocClientCB::unsafe_arena_release_commitaccountname() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:CMD_Hallsmgr_OnRequestAllocClientCB.commitAccountName)
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  
+  return commitaccountname_.UnsafeArenaRelease(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      GetArenaNoVirtual());
 }
 inline void CMD_Hallsmgr_OnRequestAllocClientCB::set_allocated_commitaccountname(::std::string* commitaccountname) {
   if (commitaccountname != NULL) {
@@ -10927,9 +13317,22 @@ inline void CMD_Hallsmgr_OnRequestAllocClientCB::set_allocated_commitaccountname
   } else {
     
   }
-  commitaccountname_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), commitaccountname);
+  commitaccountname_.SetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), commitaccountname,
+      GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_allocated:CMD_Hallsmgr_OnRequestAllocClientCB.commitAccountName)
 }
+inline void CMD_Hallsmgr_OnRequestAllocClientCB::unsafe_arena_set_allocated_commitaccountname(
+    ::std::string* commitaccountname) {
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  if (commitaccountname != NULL) {
+    
+  } else {
+    
+  }
+  commitaccountname_.UnsafeArenaSetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      commitaccountname, GetArenaNoVirtual());
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:CMD_Hallsmgr_OnRequestAllocClientCB.commitAccountName)
+}
 
 // .ServerError errcode = 4;
 inline void CMD_Hallsmgr_OnRequestAllocClientCB::clear_errcode() {
@@ -10973,6 +13376,20 @@ inline void CMD_Hallsmgr_OnRequestAllocClientCB::set_tokenid(::google::protobuf:
   // @@protoc_insertion_point(field_set:CMD_Hallsmgr_OnRequestAllocClientCB.tokenID)
 }
 
+// uint64 hallsID = 7;
+inline void CMD_Hallsmgr_OnRequestAllocClientCB::clear_hallsid() {
+  hallsid_ = GOOGLE_ULONGLONG(0);
+}
+inline ::google::protobuf::uint64 CMD_Hallsmgr_OnRequestAllocClientCB::hallsid() const {
+  // @@protoc_insertion_point(field_get:CMD_Hallsmgr_OnRequestAllocClientCB.hallsID)
+  return hallsid_;
+}
+inline void CMD_Hallsmgr_OnRequestAllocClientCB::set_hallsid(::google::protobuf::uint64 value) {
+  
+  hallsid_ = value;
+  // @@protoc_insertion_point(field_set:CMD_Hallsmgr_OnRequestAllocClientCB.hallsID)
+}
+
 // -------------------------------------------------------------------
 
 // CMD_RoomPlayerInfo
@@ -10993,45 +13410,46 @@ inline void CMD_RoomPlayerInfo::set_playerid(::google::protobuf::uint64 value) {
 
 // string clientAddr = 2;
 inline void CMD_RoomPlayerInfo::clear_clientaddr() {
-  clientaddr_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  clientaddr_.ClearToEmpty(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 inline const ::std::string& CMD_RoomPlayerInfo::clientaddr() const {
   // @@protoc_insertion_point(field_get:CMD_RoomPlayerInfo.clientAddr)
-  return clientaddr_.GetNoArena();
+  return clientaddr_.Get();
 }
 inline void CMD_RoomPlayerInfo::set_clientaddr(const ::std::string& value) {
   
-  clientaddr_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  clientaddr_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value, GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set:CMD_RoomPlayerInfo.clientAddr)
 }
-#if LANG_CXX11
-inline void CMD_RoomPlayerInfo::set_clientaddr(::std::string&& value) {
-  
-  clientaddr_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:CMD_RoomPlayerInfo.clientAddr)
-}
-#endif
 inline void CMD_RoomPlayerInfo::set_clientaddr(const char* value) {
   
-  clientaddr_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  clientaddr_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+              GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_char:CMD_RoomPlayerInfo.clientAddr)
 }
-inline void CMD_RoomPlayerInfo::set_clientaddr(const char* value, size_t size) {
+inline void CMD_RoomPlayerInfo::set_clientaddr(const char* value,
+    size_t size) {
   
-  clientaddr_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
+  clientaddr_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_pointer:CMD_RoomPlayerInfo.clientAddr)
 }
 inline ::std::string* CMD_RoomPlayerInfo::mutable_clientaddr() {
   
   // @@protoc_insertion_point(field_mutable:CMD_RoomPlayerInfo.clientAddr)
-  return clientaddr_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return clientaddr_.Mutable(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 inline ::std::string* CMD_RoomPlayerInfo::release_clientaddr() {
   // @@protoc_insertion_point(field_release:CMD_RoomPlayerInfo.clientAddr)
   
-  return clientaddr_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return clientaddr_.Release(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
+}
+inline ::std::string* CMD_RoomPlayerInfo::unsafe_arena_release_clientaddr() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:CMD_RoomPlayerInfo.clientAddr)
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  
+  return clientaddr_.UnsafeArenaRelease(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      GetArenaNoVirtual());
 }
 inline void CMD_RoomPlayerInfo::set_allocated_clientaddr(::std::string* clientaddr) {
   if (clientaddr != NULL) {
@@ -11039,9 +13457,22 @@ inline void CMD_RoomPlayerInfo::set_allocated_clientaddr(::std::string* clientad
   } else {
     
   }
-  clientaddr_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), clientaddr);
+  clientaddr_.SetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), clientaddr,
+      GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_allocated:CMD_RoomPlayerInfo.clientAddr)
 }
+inline void CMD_RoomPlayerInfo::unsafe_arena_set_allocated_clientaddr(
+    ::std::string* clientaddr) {
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  if (clientaddr != NULL) {
+    
+  } else {
+    
+  }
+  clientaddr_.UnsafeArenaSetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      clientaddr, GetArenaNoVirtual());
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:CMD_RoomPlayerInfo.clientAddr)
+}
 
 // int32 exp = 3;
 inline void CMD_RoomPlayerInfo::clear_exp() {
@@ -11115,45 +13546,46 @@ inline void CMD_RoomPlayerInfo::set_defeat(::google::protobuf::int32 value) {
 
 // string playerName = 8;
 inline void CMD_RoomPlayerInfo::clear_playername() {
-  playername_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  playername_.ClearToEmpty(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 inline const ::std::string& CMD_RoomPlayerInfo::playername() const {
   // @@protoc_insertion_point(field_get:CMD_RoomPlayerInfo.playerName)
-  return playername_.GetNoArena();
+  return playername_.Get();
 }
 inline void CMD_RoomPlayerInfo::set_playername(const ::std::string& value) {
   
-  playername_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  playername_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value, GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set:CMD_RoomPlayerInfo.playerName)
 }
-#if LANG_CXX11
-inline void CMD_RoomPlayerInfo::set_playername(::std::string&& value) {
-  
-  playername_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:CMD_RoomPlayerInfo.playerName)
-}
-#endif
 inline void CMD_RoomPlayerInfo::set_playername(const char* value) {
   
-  playername_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  playername_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+              GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_char:CMD_RoomPlayerInfo.playerName)
 }
-inline void CMD_RoomPlayerInfo::set_playername(const char* value, size_t size) {
+inline void CMD_RoomPlayerInfo::set_playername(const char* value,
+    size_t size) {
   
-  playername_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
+  playername_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_pointer:CMD_RoomPlayerInfo.playerName)
 }
 inline ::std::string* CMD_RoomPlayerInfo::mutable_playername() {
   
   // @@protoc_insertion_point(field_mutable:CMD_RoomPlayerInfo.playerName)
-  return playername_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return playername_.Mutable(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 inline ::std::string* CMD_RoomPlayerInfo::release_playername() {
   // @@protoc_insertion_point(field_release:CMD_RoomPlayerInfo.playerName)
   
-  return playername_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return playername_.Release(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
+}
+inline ::std::string* CMD_RoomPlayerInfo::unsafe_arena_release_playername() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:CMD_RoomPlayerInfo.playerName)
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  
+  return playername_.UnsafeArenaRelease(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      GetArenaNoVirtual());
 }
 inline void CMD_RoomPlayerInfo::set_allocated_playername(::std::string* playername) {
   if (playername != NULL) {
@@ -11161,9 +13593,22 @@ inline void CMD_RoomPlayerInfo::set_allocated_playername(::std::string* playerna
   } else {
     
   }
-  playername_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), playername);
+  playername_.SetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), playername,
+      GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_allocated:CMD_RoomPlayerInfo.playerName)
 }
+inline void CMD_RoomPlayerInfo::unsafe_arena_set_allocated_playername(
+    ::std::string* playername) {
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  if (playername != NULL) {
+    
+  } else {
+    
+  }
+  playername_.UnsafeArenaSetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      playername, GetArenaNoVirtual());
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:CMD_RoomPlayerInfo.playerName)
+}
 
 // int32 playerModelID = 9;
 inline void CMD_RoomPlayerInfo::clear_playermodelid() {
@@ -11299,45 +13744,46 @@ CMD_Roommgr_RequestCreateRoom::players() const {
 
 // string exeFile = 8;
 inline void CMD_Roommgr_RequestCreateRoom::clear_exefile() {
-  exefile_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  exefile_.ClearToEmpty(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 inline const ::std::string& CMD_Roommgr_RequestCreateRoom::exefile() const {
   // @@protoc_insertion_point(field_get:CMD_Roommgr_RequestCreateRoom.exeFile)
-  return exefile_.GetNoArena();
+  return exefile_.Get();
 }
 inline void CMD_Roommgr_RequestCreateRoom::set_exefile(const ::std::string& value) {
   
-  exefile_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  exefile_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value, GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set:CMD_Roommgr_RequestCreateRoom.exeFile)
 }
-#if LANG_CXX11
-inline void CMD_Roommgr_RequestCreateRoom::set_exefile(::std::string&& value) {
-  
-  exefile_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:CMD_Roommgr_RequestCreateRoom.exeFile)
-}
-#endif
 inline void CMD_Roommgr_RequestCreateRoom::set_exefile(const char* value) {
   
-  exefile_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  exefile_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+              GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_char:CMD_Roommgr_RequestCreateRoom.exeFile)
 }
-inline void CMD_Roommgr_RequestCreateRoom::set_exefile(const char* value, size_t size) {
+inline void CMD_Roommgr_RequestCreateRoom::set_exefile(const char* value,
+    size_t size) {
   
-  exefile_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
+  exefile_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_pointer:CMD_Roommgr_RequestCreateRoom.exeFile)
 }
 inline ::std::string* CMD_Roommgr_RequestCreateRoom::mutable_exefile() {
   
   // @@protoc_insertion_point(field_mutable:CMD_Roommgr_RequestCreateRoom.exeFile)
-  return exefile_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return exefile_.Mutable(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 inline ::std::string* CMD_Roommgr_RequestCreateRoom::release_exefile() {
   // @@protoc_insertion_point(field_release:CMD_Roommgr_RequestCreateRoom.exeFile)
   
-  return exefile_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return exefile_.Release(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
+}
+inline ::std::string* CMD_Roommgr_RequestCreateRoom::unsafe_arena_release_exefile() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:CMD_Roommgr_RequestCreateRoom.exeFile)
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  
+  return exefile_.UnsafeArenaRelease(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      GetArenaNoVirtual());
 }
 inline void CMD_Roommgr_RequestCreateRoom::set_allocated_exefile(::std::string* exefile) {
   if (exefile != NULL) {
@@ -11345,51 +13791,65 @@ inline void CMD_Roommgr_RequestCreateRoom::set_allocated_exefile(::std::string*
   } else {
     
   }
-  exefile_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), exefile);
+  exefile_.SetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), exefile,
+      GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_allocated:CMD_Roommgr_RequestCreateRoom.exeFile)
 }
+inline void CMD_Roommgr_RequestCreateRoom::unsafe_arena_set_allocated_exefile(
+    ::std::string* exefile) {
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  if (exefile != NULL) {
+    
+  } else {
+    
+  }
+  exefile_.UnsafeArenaSetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      exefile, GetArenaNoVirtual());
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:CMD_Roommgr_RequestCreateRoom.exeFile)
+}
 
 // string exeOptions = 9;
 inline void CMD_Roommgr_RequestCreateRoom::clear_exeoptions() {
-  exeoptions_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  exeoptions_.ClearToEmpty(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 inline const ::std::string& CMD_Roommgr_RequestCreateRoom::exeoptions() const {
   // @@protoc_insertion_point(field_get:CMD_Roommgr_RequestCreateRoom.exeOptions)
-  return exeoptions_.GetNoArena();
+  return exeoptions_.Get();
 }
 inline void CMD_Roommgr_RequestCreateRoom::set_exeoptions(const ::std::string& value) {
   
-  exeoptions_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  exeoptions_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value, GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set:CMD_Roommgr_RequestCreateRoom.exeOptions)
 }
-#if LANG_CXX11
-inline void CMD_Roommgr_RequestCreateRoom::set_exeoptions(::std::string&& value) {
-  
-  exeoptions_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:CMD_Roommgr_RequestCreateRoom.exeOptions)
-}
-#endif
 inline void CMD_Roommgr_RequestCreateRoom::set_exeoptions(const char* value) {
   
-  exeoptions_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  exeoptions_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+              GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_char:CMD_Roommgr_RequestCreateRoom.exeOptions)
 }
-inline void CMD_Roommgr_RequestCreateRoom::set_exeoptions(const char* value, size_t size) {
+inline void CMD_Roommgr_RequestCreateRoom::set_exeoptions(const char* value,
+    size_t size) {
   
-  exeoptions_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
+  exeoptions_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_pointer:CMD_Roommgr_RequestCreateRoom.exeOptions)
 }
 inline ::std::string* CMD_Roommgr_RequestCreateRoom::mutable_exeoptions() {
   
   // @@protoc_insertion_point(field_mutable:CMD_Roommgr_RequestCreateRoom.exeOptions)
-  return exeoptions_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return exeoptions_.Mutable(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 inline ::std::string* CMD_Roommgr_RequestCreateRoom::release_exeoptions() {
   // @@protoc_insertion_point(field_release:CMD_Roommgr_RequestCreateRoom.exeOptions)
   
-  return exeoptions_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return exeoptions_.Release(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
+}
+inline ::std::string* CMD_Roommgr_RequestCreateRoom::unsafe_arena_release_exeoptions() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:CMD_Roommgr_RequestCreateRoom.exeOptions)
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  
+  return exeoptions_.UnsafeArenaRelease(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      GetArenaNoVirtual());
 }
 inline void CMD_Roommgr_RequestCreateRoom::set_allocated_exeoptions(::std::string* exeoptions) {
   if (exeoptions != NULL) {
@@ -11397,9 +13857,22 @@ inline void CMD_Roommgr_RequestCreateRoom::set_allocated_exeoptions(::std::strin
   } else {
     
   }
-  exeoptions_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), exeoptions);
+  exeoptions_.SetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), exeoptions,
+      GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_allocated:CMD_Roommgr_RequestCreateRoom.exeOptions)
 }
+inline void CMD_Roommgr_RequestCreateRoom::unsafe_arena_set_allocated_exeoptions(
+    ::std::string* exeoptions) {
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  if (exeoptions != NULL) {
+    
+  } else {
+    
+  }
+  exeoptions_.UnsafeArenaSetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      exeoptions, GetArenaNoVirtual());
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:CMD_Roommgr_RequestCreateRoom.exeOptions)
+}
 
 // -------------------------------------------------------------------
 
@@ -11435,45 +13908,46 @@ inline void CMD_Roommgr_OnRequestCreateRoomCB::set_roomid(::google::protobuf::ui
 
 // string ip = 3;
 inline void CMD_Roommgr_OnRequestCreateRoomCB::clear_ip() {
-  ip_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  ip_.ClearToEmpty(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 inline const ::std::string& CMD_Roommgr_OnRequestCreateRoomCB::ip() const {
   // @@protoc_insertion_point(field_get:CMD_Roommgr_OnRequestCreateRoomCB.ip)
-  return ip_.GetNoArena();
+  return ip_.Get();
 }
 inline void CMD_Roommgr_OnRequestCreateRoomCB::set_ip(const ::std::string& value) {
   
-  ip_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  ip_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value, GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set:CMD_Roommgr_OnRequestCreateRoomCB.ip)
 }
-#if LANG_CXX11
-inline void CMD_Roommgr_OnRequestCreateRoomCB::set_ip(::std::string&& value) {
-  
-  ip_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:CMD_Roommgr_OnRequestCreateRoomCB.ip)
-}
-#endif
 inline void CMD_Roommgr_OnRequestCreateRoomCB::set_ip(const char* value) {
   
-  ip_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  ip_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+              GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_char:CMD_Roommgr_OnRequestCreateRoomCB.ip)
 }
-inline void CMD_Roommgr_OnRequestCreateRoomCB::set_ip(const char* value, size_t size) {
+inline void CMD_Roommgr_OnRequestCreateRoomCB::set_ip(const char* value,
+    size_t size) {
   
-  ip_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
+  ip_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_pointer:CMD_Roommgr_OnRequestCreateRoomCB.ip)
 }
 inline ::std::string* CMD_Roommgr_OnRequestCreateRoomCB::mutable_ip() {
   
   // @@protoc_insertion_point(field_mutable:CMD_Roommgr_OnRequestCreateRoomCB.ip)
-  return ip_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return ip_.Mutable(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 inline ::std::string* CMD_Roommgr_OnRequestCreateRoomCB::release_ip() {
   // @@protoc_insertion_point(field_release:CMD_Roommgr_OnRequestCreateRoomCB.ip)
   
-  return ip_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return ip_.Release(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
+}
+inline ::std::string* CMD_Roommgr_OnRequestCreateRoomCB::unsafe_arena_release_ip() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:CMD_Roommgr_OnRequestCreateRoomCB.ip)
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  
+  return ip_.UnsafeArenaRelease(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      GetArenaNoVirtual());
 }
 inline void CMD_Roommgr_OnRequestCreateRoomCB::set_allocated_ip(::std::string* ip) {
   if (ip != NULL) {
@@ -11481,9 +13955,22 @@ inline void CMD_Roommgr_OnRequestCreateRoomCB::set_allocated_ip(::std::string* i
   } else {
     
   }
-  ip_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ip);
+  ip_.SetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ip,
+      GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_allocated:CMD_Roommgr_OnRequestCreateRoomCB.ip)
 }
+inline void CMD_Roommgr_OnRequestCreateRoomCB::unsafe_arena_set_allocated_ip(
+    ::std::string* ip) {
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  if (ip != NULL) {
+    
+  } else {
+    
+  }
+  ip_.UnsafeArenaSetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      ip, GetArenaNoVirtual());
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:CMD_Roommgr_OnRequestCreateRoomCB.ip)
+}
 
 // int32 port = 4;
 inline void CMD_Roommgr_OnRequestCreateRoomCB::clear_port() {
@@ -11723,45 +14210,46 @@ CMD_Machine_RequestCreateRoom::players() const {
 
 // string exeFile = 8;
 inline void CMD_Machine_RequestCreateRoom::clear_exefile() {
-  exefile_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  exefile_.ClearToEmpty(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 inline const ::std::string& CMD_Machine_RequestCreateRoom::exefile() const {
   // @@protoc_insertion_point(field_get:CMD_Machine_RequestCreateRoom.exeFile)
-  return exefile_.GetNoArena();
+  return exefile_.Get();
 }
 inline void CMD_Machine_RequestCreateRoom::set_exefile(const ::std::string& value) {
   
-  exefile_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  exefile_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value, GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set:CMD_Machine_RequestCreateRoom.exeFile)
 }
-#if LANG_CXX11
-inline void CMD_Machine_RequestCreateRoom::set_exefile(::std::string&& value) {
-  
-  exefile_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:CMD_Machine_RequestCreateRoom.exeFile)
-}
-#endif
 inline void CMD_Machine_RequestCreateRoom::set_exefile(const char* value) {
   
-  exefile_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  exefile_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+              GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_char:CMD_Machine_RequestCreateRoom.exeFile)
 }
-inline void CMD_Machine_RequestCreateRoom::set_exefile(const char* value, size_t size) {
+inline void CMD_Machine_RequestCreateRoom::set_exefile(const char* value,
+    size_t size) {
   
-  exefile_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
+  exefile_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_pointer:CMD_Machine_RequestCreateRoom.exeFile)
 }
 inline ::std::string* CMD_Machine_RequestCreateRoom::mutable_exefile() {
   
   // @@protoc_insertion_point(field_mutable:CMD_Machine_RequestCreateRoom.exeFile)
-  return exefile_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return exefile_.Mutable(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 inline ::std::string* CMD_Machine_RequestCreateRoom::release_exefile() {
   // @@protoc_insertion_point(field_release:CMD_Machine_RequestCreateRoom.exeFile)
   
-  return exefile_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return exefile_.Release(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
+}
+inline ::std::string* CMD_Machine_RequestCreateRoom::unsafe_arena_release_exefile() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:CMD_Machine_RequestCreateRoom.exeFile)
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  
+  return exefile_.UnsafeArenaRelease(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      GetArenaNoVirtual());
 }
 inline void CMD_Machine_RequestCreateRoom::set_allocated_exefile(::std::string* exefile) {
   if (exefile != NULL) {
@@ -11769,51 +14257,65 @@ inline void CMD_Machine_RequestCreateRoom::set_allocated_exefile(::std::string*
   } else {
     
   }
-  exefile_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), exefile);
+  exefile_.SetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), exefile,
+      GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_allocated:CMD_Machine_RequestCreateRoom.exeFile)
 }
+inline void CMD_Machine_RequestCreateRoom::unsafe_arena_set_allocated_exefile(
+    ::std::string* exefile) {
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  if (exefile != NULL) {
+    
+  } else {
+    
+  }
+  exefile_.UnsafeArenaSetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      exefile, GetArenaNoVirtual());
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:CMD_Machine_RequestCreateRoom.exeFile)
+}
 
 // string exeOptions = 9;
 inline void CMD_Machine_RequestCreateRoom::clear_exeoptions() {
-  exeoptions_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  exeoptions_.ClearToEmpty(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 inline const ::std::string& CMD_Machine_RequestCreateRoom::exeoptions() const {
   // @@protoc_insertion_point(field_get:CMD_Machine_RequestCreateRoom.exeOptions)
-  return exeoptions_.GetNoArena();
+  return exeoptions_.Get();
 }
 inline void CMD_Machine_RequestCreateRoom::set_exeoptions(const ::std::string& value) {
   
-  exeoptions_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  exeoptions_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value, GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set:CMD_Machine_RequestCreateRoom.exeOptions)
 }
-#if LANG_CXX11
-inline void CMD_Machine_RequestCreateRoom::set_exeoptions(::std::string&& value) {
-  
-  exeoptions_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:CMD_Machine_RequestCreateRoom.exeOptions)
-}
-#endif
 inline void CMD_Machine_RequestCreateRoom::set_exeoptions(const char* value) {
   
-  exeoptions_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  exeoptions_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+              GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_char:CMD_Machine_RequestCreateRoom.exeOptions)
 }
-inline void CMD_Machine_RequestCreateRoom::set_exeoptions(const char* value, size_t size) {
+inline void CMD_Machine_RequestCreateRoom::set_exeoptions(const char* value,
+    size_t size) {
   
-  exeoptions_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
+  exeoptions_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_pointer:CMD_Machine_RequestCreateRoom.exeOptions)
 }
 inline ::std::string* CMD_Machine_RequestCreateRoom::mutable_exeoptions() {
   
   // @@protoc_insertion_point(field_mutable:CMD_Machine_RequestCreateRoom.exeOptions)
-  return exeoptions_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return exeoptions_.Mutable(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 inline ::std::string* CMD_Machine_RequestCreateRoom::release_exeoptions() {
   // @@protoc_insertion_point(field_release:CMD_Machine_RequestCreateRoom.exeOptions)
   
-  return exeoptions_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return exeoptions_.Release(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
+}
+inline ::std::string* CMD_Machine_RequestCreateRoom::unsafe_arena_release_exeoptions() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:CMD_Machine_RequestCreateRoom.exeOptions)
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  
+  return exeoptions_.UnsafeArenaRelease(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      GetArenaNoVirtual());
 }
 inline void CMD_Machine_RequestCreateRoom::set_allocated_exeoptions(::std::string* exeoptions) {
   if (exeoptions != NULL) {
@@ -11821,9 +14323,22 @@ inline void CMD_Machine_RequestCreateRoom::set_allocated_exeoptions(::std::strin
   } else {
     
   }
-  exeoptions_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), exeoptions);
+  exeoptions_.SetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), exeoptions,
+      GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_allocated:CMD_Machine_RequestCreateRoom.exeOptions)
 }
+inline void CMD_Machine_RequestCreateRoom::unsafe_arena_set_allocated_exeoptions(
+    ::std::string* exeoptions) {
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  if (exeoptions != NULL) {
+    
+  } else {
+    
+  }
+  exeoptions_.UnsafeArenaSetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      exeoptions, GetArenaNoVirtual());
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:CMD_Machine_RequestCreateRoom.exeOptions)
+}
 
 // uint64 tokenID = 10;
 inline void CMD_Machine_RequestCreateRoom::clear_tokenid() {
@@ -11841,45 +14356,46 @@ inline void CMD_Machine_RequestCreateRoom::set_tokenid(::google::protobuf::uint6
 
 // string roommgrIP = 11;
 inline void CMD_Machine_RequestCreateRoom::clear_roommgrip() {
-  roommgrip_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  roommgrip_.ClearToEmpty(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 inline const ::std::string& CMD_Machine_RequestCreateRoom::roommgrip() const {
   // @@protoc_insertion_point(field_get:CMD_Machine_RequestCreateRoom.roommgrIP)
-  return roommgrip_.GetNoArena();
+  return roommgrip_.Get();
 }
 inline void CMD_Machine_RequestCreateRoom::set_roommgrip(const ::std::string& value) {
   
-  roommgrip_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  roommgrip_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value, GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set:CMD_Machine_RequestCreateRoom.roommgrIP)
 }
-#if LANG_CXX11
-inline void CMD_Machine_RequestCreateRoom::set_roommgrip(::std::string&& value) {
-  
-  roommgrip_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:CMD_Machine_RequestCreateRoom.roommgrIP)
-}
-#endif
 inline void CMD_Machine_RequestCreateRoom::set_roommgrip(const char* value) {
   
-  roommgrip_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  roommgrip_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+              GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_char:CMD_Machine_RequestCreateRoom.roommgrIP)
 }
-inline void CMD_Machine_RequestCreateRoom::set_roommgrip(const char* value, size_t size) {
+inline void CMD_Machine_RequestCreateRoom::set_roommgrip(const char* value,
+    size_t size) {
   
-  roommgrip_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
+  roommgrip_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_pointer:CMD_Machine_RequestCreateRoom.roommgrIP)
 }
 inline ::std::string* CMD_Machine_RequestCreateRoom::mutable_roommgrip() {
   
   // @@protoc_insertion_point(field_mutable:CMD_Machine_RequestCreateRoom.roommgrIP)
-  return roommgrip_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return roommgrip_.Mutable(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 inline ::std::string* CMD_Machine_RequestCreateRoom::release_roommgrip() {
   // @@protoc_insertion_point(field_release:CMD_Machine_RequestCreateRoom.roommgrIP)
   
-  return roommgrip_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return roommgrip_.Release(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
+}
+inline ::std::string* CMD_Machine_RequestCreateRoom::unsafe_arena_release_roommgrip() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:CMD_Machine_RequestCreateRoom.roommgrIP)
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  
+  return roommgrip_.UnsafeArenaRelease(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      GetArenaNoVirtual());
 }
 inline void CMD_Machine_RequestCreateRoom::set_allocated_roommgrip(::std::string* roommgrip) {
   if (roommgrip != NULL) {
@@ -11887,9 +14403,22 @@ inline void CMD_Machine_RequestCreateRoom::set_allocated_roommgrip(::std::string
   } else {
     
   }
-  roommgrip_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), roommgrip);
+  roommgrip_.SetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), roommgrip,
+      GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_allocated:CMD_Machine_RequestCreateRoom.roommgrIP)
 }
+inline void CMD_Machine_RequestCreateRoom::unsafe_arena_set_allocated_roommgrip(
+    ::std::string* roommgrip) {
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  if (roommgrip != NULL) {
+    
+  } else {
+    
+  }
+  roommgrip_.UnsafeArenaSetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      roommgrip, GetArenaNoVirtual());
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:CMD_Machine_RequestCreateRoom.roommgrIP)
+}
 
 // int32 roommgrPort = 12;
 inline void CMD_Machine_RequestCreateRoom::clear_roommgrport() {
@@ -11939,45 +14468,46 @@ inline void CMD_Machine_RoomSrvReportAddr::set_roomid(::google::protobuf::uint64
 
 // string ip = 3;
 inline void CMD_Machine_RoomSrvReportAddr::clear_ip() {
-  ip_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  ip_.ClearToEmpty(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 inline const ::std::string& CMD_Machine_RoomSrvReportAddr::ip() const {
   // @@protoc_insertion_point(field_get:CMD_Machine_RoomSrvReportAddr.ip)
-  return ip_.GetNoArena();
+  return ip_.Get();
 }
 inline void CMD_Machine_RoomSrvReportAddr::set_ip(const ::std::string& value) {
   
-  ip_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  ip_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value, GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set:CMD_Machine_RoomSrvReportAddr.ip)
 }
-#if LANG_CXX11
-inline void CMD_Machine_RoomSrvReportAddr::set_ip(::std::string&& value) {
-  
-  ip_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:CMD_Machine_RoomSrvReportAddr.ip)
-}
-#endif
 inline void CMD_Machine_RoomSrvReportAddr::set_ip(const char* value) {
   
-  ip_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  ip_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+              GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_char:CMD_Machine_RoomSrvReportAddr.ip)
 }
-inline void CMD_Machine_RoomSrvReportAddr::set_ip(const char* value, size_t size) {
+inline void CMD_Machine_RoomSrvReportAddr::set_ip(const char* value,
+    size_t size) {
   
-  ip_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
+  ip_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_pointer:CMD_Machine_RoomSrvReportAddr.ip)
 }
 inline ::std::string* CMD_Machine_RoomSrvReportAddr::mutable_ip() {
   
   // @@protoc_insertion_point(field_mutable:CMD_Machine_RoomSrvReportAddr.ip)
-  return ip_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return ip_.Mutable(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 inline ::std::string* CMD_Machine_RoomSrvReportAddr::release_ip() {
   // @@protoc_insertion_point(field_release:CMD_Machine_RoomSrvReportAddr.ip)
   
-  return ip_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return ip_.Release(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
+}
+inline ::std::string* CMD_Machine_RoomSrvReportAddr::unsafe_arena_release_ip() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:CMD_Machine_RoomSrvReportAddr.ip)
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  
+  return ip_.UnsafeArenaRelease(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      GetArenaNoVirtual());
 }
 inline void CMD_Machine_RoomSrvReportAddr::set_allocated_ip(::std::string* ip) {
   if (ip != NULL) {
@@ -11985,9 +14515,22 @@ inline void CMD_Machine_RoomSrvReportAddr::set_allocated_ip(::std::string* ip) {
   } else {
     
   }
-  ip_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ip);
+  ip_.SetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ip,
+      GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_allocated:CMD_Machine_RoomSrvReportAddr.ip)
 }
+inline void CMD_Machine_RoomSrvReportAddr::unsafe_arena_set_allocated_ip(
+    ::std::string* ip) {
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  if (ip != NULL) {
+    
+  } else {
+    
+  }
+  ip_.UnsafeArenaSetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      ip, GetArenaNoVirtual());
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:CMD_Machine_RoomSrvReportAddr.ip)
+}
 
 // int32 port = 4;
 inline void CMD_Machine_RoomSrvReportAddr::clear_port() {
@@ -12099,45 +14642,46 @@ CMD_Machine_OnRoomSrvGameOverReport::playerdatas() const {
 
 // string addr = 1;
 inline void CMD_ListServersInfo::clear_addr() {
-  addr_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  addr_.ClearToEmpty(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 inline const ::std::string& CMD_ListServersInfo::addr() const {
   // @@protoc_insertion_point(field_get:CMD_ListServersInfo.addr)
-  return addr_.GetNoArena();
+  return addr_.Get();
 }
 inline void CMD_ListServersInfo::set_addr(const ::std::string& value) {
   
-  addr_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  addr_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value, GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set:CMD_ListServersInfo.addr)
 }
-#if LANG_CXX11
-inline void CMD_ListServersInfo::set_addr(::std::string&& value) {
-  
-  addr_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:CMD_ListServersInfo.addr)
-}
-#endif
 inline void CMD_ListServersInfo::set_addr(const char* value) {
   
-  addr_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  addr_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+              GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_char:CMD_ListServersInfo.addr)
 }
-inline void CMD_ListServersInfo::set_addr(const char* value, size_t size) {
+inline void CMD_ListServersInfo::set_addr(const char* value,
+    size_t size) {
   
-  addr_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
+  addr_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_pointer:CMD_ListServersInfo.addr)
 }
 inline ::std::string* CMD_ListServersInfo::mutable_addr() {
   
   // @@protoc_insertion_point(field_mutable:CMD_ListServersInfo.addr)
-  return addr_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return addr_.Mutable(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 inline ::std::string* CMD_ListServersInfo::release_addr() {
   // @@protoc_insertion_point(field_release:CMD_ListServersInfo.addr)
   
-  return addr_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return addr_.Release(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
+}
+inline ::std::string* CMD_ListServersInfo::unsafe_arena_release_addr() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:CMD_ListServersInfo.addr)
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  
+  return addr_.UnsafeArenaRelease(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      GetArenaNoVirtual());
 }
 inline void CMD_ListServersInfo::set_allocated_addr(::std::string* addr) {
   if (addr != NULL) {
@@ -12145,9 +14689,22 @@ inline void CMD_ListServersInfo::set_allocated_addr(::std::string* addr) {
   } else {
     
   }
-  addr_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), addr);
+  addr_.SetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), addr,
+      GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_allocated:CMD_ListServersInfo.addr)
 }
+inline void CMD_ListServersInfo::unsafe_arena_set_allocated_addr(
+    ::std::string* addr) {
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  if (addr != NULL) {
+    
+  } else {
+    
+  }
+  addr_.UnsafeArenaSetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      addr, GetArenaNoVirtual());
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:CMD_ListServersInfo.addr)
+}
 
 // int32 port = 2;
 inline void CMD_ListServersInfo::clear_port() {
@@ -12179,45 +14736,46 @@ inline void CMD_ListServersInfo::set_groupid(::google::protobuf::uint64 value) {
 
 // string name = 4;
 inline void CMD_ListServersInfo::clear_name() {
-  name_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  name_.ClearToEmpty(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 inline const ::std::string& CMD_ListServersInfo::name() const {
   // @@protoc_insertion_point(field_get:CMD_ListServersInfo.name)
-  return name_.GetNoArena();
+  return name_.Get();
 }
 inline void CMD_ListServersInfo::set_name(const ::std::string& value) {
   
-  name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  name_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value, GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set:CMD_ListServersInfo.name)
 }
-#if LANG_CXX11
-inline void CMD_ListServersInfo::set_name(::std::string&& value) {
-  
-  name_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:CMD_ListServersInfo.name)
-}
-#endif
 inline void CMD_ListServersInfo::set_name(const char* value) {
   
-  name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  name_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+              GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_char:CMD_ListServersInfo.name)
 }
-inline void CMD_ListServersInfo::set_name(const char* value, size_t size) {
+inline void CMD_ListServersInfo::set_name(const char* value,
+    size_t size) {
   
-  name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
+  name_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_pointer:CMD_ListServersInfo.name)
 }
 inline ::std::string* CMD_ListServersInfo::mutable_name() {
   
   // @@protoc_insertion_point(field_mutable:CMD_ListServersInfo.name)
-  return name_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return name_.Mutable(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 inline ::std::string* CMD_ListServersInfo::release_name() {
   // @@protoc_insertion_point(field_release:CMD_ListServersInfo.name)
   
-  return name_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return name_.Release(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
+}
+inline ::std::string* CMD_ListServersInfo::unsafe_arena_release_name() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:CMD_ListServersInfo.name)
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  
+  return name_.UnsafeArenaRelease(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      GetArenaNoVirtual());
 }
 inline void CMD_ListServersInfo::set_allocated_name(::std::string* name) {
   if (name != NULL) {
@@ -12225,9 +14783,22 @@ inline void CMD_ListServersInfo::set_allocated_name(::std::string* name) {
   } else {
     
   }
-  name_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), name);
+  name_.SetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), name,
+      GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_allocated:CMD_ListServersInfo.name)
 }
+inline void CMD_ListServersInfo::unsafe_arena_set_allocated_name(
+    ::std::string* name) {
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  if (name != NULL) {
+    
+  } else {
+    
+  }
+  name_.UnsafeArenaSetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      name, GetArenaNoVirtual());
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:CMD_ListServersInfo.name)
+}
 
 // uint64 id = 5;
 inline void CMD_ListServersInfo::clear_id() {
@@ -12311,45 +14882,46 @@ inline void CMD_Client_OnSignupCB::set_errcode(::ServerError value) {
 
 // bytes datas = 2;
 inline void CMD_Client_OnSignupCB::clear_datas() {
-  datas_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  datas_.ClearToEmpty(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 inline const ::std::string& CMD_Client_OnSignupCB::datas() const {
   // @@protoc_insertion_point(field_get:CMD_Client_OnSignupCB.datas)
-  return datas_.GetNoArena();
+  return datas_.Get();
 }
 inline void CMD_Client_OnSignupCB::set_datas(const ::std::string& value) {
   
-  datas_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  datas_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value, GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set:CMD_Client_OnSignupCB.datas)
 }
-#if LANG_CXX11
-inline void CMD_Client_OnSignupCB::set_datas(::std::string&& value) {
-  
-  datas_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:CMD_Client_OnSignupCB.datas)
-}
-#endif
 inline void CMD_Client_OnSignupCB::set_datas(const char* value) {
   
-  datas_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  datas_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+              GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_char:CMD_Client_OnSignupCB.datas)
 }
-inline void CMD_Client_OnSignupCB::set_datas(const void* value, size_t size) {
+inline void CMD_Client_OnSignupCB::set_datas(const void* value,
+    size_t size) {
   
-  datas_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
+  datas_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_pointer:CMD_Client_OnSignupCB.datas)
 }
 inline ::std::string* CMD_Client_OnSignupCB::mutable_datas() {
   
   // @@protoc_insertion_point(field_mutable:CMD_Client_OnSignupCB.datas)
-  return datas_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return datas_.Mutable(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 inline ::std::string* CMD_Client_OnSignupCB::release_datas() {
   // @@protoc_insertion_point(field_release:CMD_Client_OnSignupCB.datas)
   
-  return datas_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return datas_.Release(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
+}
+inline ::std::string* CMD_Client_OnSignupCB::unsafe_arena_release_datas() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:CMD_Client_OnSignupCB.datas)
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  
+  return datas_.UnsafeArenaRelease(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      GetArenaNoVirtual());
 }
 inline void CMD_Client_OnSignupCB::set_allocated_datas(::std::string* datas) {
   if (datas != NULL) {
@@ -12357,9 +14929,22 @@ inline void CMD_Client_OnSignupCB::set_allocated_datas(::std::string* datas) {
   } else {
     
   }
-  datas_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), datas);
+  datas_.SetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), datas,
+      GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_allocated:CMD_Client_OnSignupCB.datas)
 }
+inline void CMD_Client_OnSignupCB::unsafe_arena_set_allocated_datas(
+    ::std::string* datas) {
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  if (datas != NULL) {
+    
+  } else {
+    
+  }
+  datas_.UnsafeArenaSetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      datas, GetArenaNoVirtual());
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:CMD_Client_OnSignupCB.datas)
+}
 
 // -------------------------------------------------------------------
 
@@ -12381,45 +14966,46 @@ inline void CMD_Client_OnSigninCB::set_errcode(::ServerError value) {
 
 // bytes datas = 2;
 inline void CMD_Client_OnSigninCB::clear_datas() {
-  datas_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  datas_.ClearToEmpty(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 inline const ::std::string& CMD_Client_OnSigninCB::datas() const {
   // @@protoc_insertion_point(field_get:CMD_Client_OnSigninCB.datas)
-  return datas_.GetNoArena();
+  return datas_.Get();
 }
 inline void CMD_Client_OnSigninCB::set_datas(const ::std::string& value) {
   
-  datas_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  datas_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value, GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set:CMD_Client_OnSigninCB.datas)
 }
-#if LANG_CXX11
-inline void CMD_Client_OnSigninCB::set_datas(::std::string&& value) {
-  
-  datas_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:CMD_Client_OnSigninCB.datas)
-}
-#endif
 inline void CMD_Client_OnSigninCB::set_datas(const char* value) {
   
-  datas_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  datas_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+              GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_char:CMD_Client_OnSigninCB.datas)
 }
-inline void CMD_Client_OnSigninCB::set_datas(const void* value, size_t size) {
+inline void CMD_Client_OnSigninCB::set_datas(const void* value,
+    size_t size) {
   
-  datas_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
+  datas_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_pointer:CMD_Client_OnSigninCB.datas)
 }
 inline ::std::string* CMD_Client_OnSigninCB::mutable_datas() {
   
   // @@protoc_insertion_point(field_mutable:CMD_Client_OnSigninCB.datas)
-  return datas_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return datas_.Mutable(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 inline ::std::string* CMD_Client_OnSigninCB::release_datas() {
   // @@protoc_insertion_point(field_release:CMD_Client_OnSigninCB.datas)
   
-  return datas_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return datas_.Release(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
+}
+inline ::std::string* CMD_Client_OnSigninCB::unsafe_arena_release_datas() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:CMD_Client_OnSigninCB.datas)
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  
+  return datas_.UnsafeArenaRelease(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      GetArenaNoVirtual());
 }
 inline void CMD_Client_OnSigninCB::set_allocated_datas(::std::string* datas) {
   if (datas != NULL) {
@@ -12427,51 +15013,65 @@ inline void CMD_Client_OnSigninCB::set_allocated_datas(::std::string* datas) {
   } else {
     
   }
-  datas_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), datas);
+  datas_.SetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), datas,
+      GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_allocated:CMD_Client_OnSigninCB.datas)
 }
+inline void CMD_Client_OnSigninCB::unsafe_arena_set_allocated_datas(
+    ::std::string* datas) {
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  if (datas != NULL) {
+    
+  } else {
+    
+  }
+  datas_.UnsafeArenaSetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      datas, GetArenaNoVirtual());
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:CMD_Client_OnSigninCB.datas)
+}
 
 // string addr = 3;
 inline void CMD_Client_OnSigninCB::clear_addr() {
-  addr_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  addr_.ClearToEmpty(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 inline const ::std::string& CMD_Client_OnSigninCB::addr() const {
   // @@protoc_insertion_point(field_get:CMD_Client_OnSigninCB.addr)
-  return addr_.GetNoArena();
+  return addr_.Get();
 }
 inline void CMD_Client_OnSigninCB::set_addr(const ::std::string& value) {
   
-  addr_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  addr_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value, GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set:CMD_Client_OnSigninCB.addr)
 }
-#if LANG_CXX11
-inline void CMD_Client_OnSigninCB::set_addr(::std::string&& value) {
-  
-  addr_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:CMD_Client_OnSigninCB.addr)
-}
-#endif
 inline void CMD_Client_OnSigninCB::set_addr(const char* value) {
   
-  addr_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  addr_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+              GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_char:CMD_Client_OnSigninCB.addr)
 }
-inline void CMD_Client_OnSigninCB::set_addr(const char* value, size_t size) {
+inline void CMD_Client_OnSigninCB::set_addr(const char* value,
+    size_t size) {
   
-  addr_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
+  addr_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_pointer:CMD_Client_OnSigninCB.addr)
 }
 inline ::std::string* CMD_Client_OnSigninCB::mutable_addr() {
   
   // @@protoc_insertion_point(field_mutable:CMD_Client_OnSigninCB.addr)
-  return addr_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return addr_.Mutable(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 inline ::std::string* CMD_Client_OnSigninCB::release_addr() {
   // @@protoc_insertion_point(field_release:CMD_Client_OnSigninCB.addr)
   
-  return addr_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return addr_.Release(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
+}
+inline ::std::string* CMD_Client_OnSigninCB::unsafe_arena_release_addr() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:CMD_Client_OnSigninCB.addr)
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  
+  return addr_.UnsafeArenaRelease(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      GetArenaNoVirtual());
 }
 inline void CMD_Client_OnSigninCB::set_allocated_addr(::std::string* addr) {
   if (addr != NULL) {
@@ -12479,9 +15079,22 @@ inline void CMD_Client_OnSigninCB::set_allocated_addr(::std::string* addr) {
   } else {
     
   }
-  addr_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), addr);
+  addr_.SetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), addr,
+      GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_allocated:CMD_Client_OnSigninCB.addr)
 }
+inline void CMD_Client_OnSigninCB::unsafe_arena_set_allocated_addr(
+    ::std::string* addr) {
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  if (addr != NULL) {
+    
+  } else {
+    
+  }
+  addr_.UnsafeArenaSetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      addr, GetArenaNoVirtual());
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:CMD_Client_OnSigninCB.addr)
+}
 
 // int32 port = 4;
 inline void CMD_Client_OnSigninCB::clear_port() {
@@ -12511,6 +15124,20 @@ inline void CMD_Client_OnSigninCB::set_tokenid(::google::protobuf::uint64 value)
   // @@protoc_insertion_point(field_set:CMD_Client_OnSigninCB.tokenID)
 }
 
+// uint64 hallsID = 6;
+inline void CMD_Client_OnSigninCB::clear_hallsid() {
+  hallsid_ = GOOGLE_ULONGLONG(0);
+}
+inline ::google::protobuf::uint64 CMD_Client_OnSigninCB::hallsid() const {
+  // @@protoc_insertion_point(field_get:CMD_Client_OnSigninCB.hallsID)
+  return hallsid_;
+}
+inline void CMD_Client_OnSigninCB::set_hallsid(::google::protobuf::uint64 value) {
+  
+  hallsid_ = value;
+  // @@protoc_insertion_point(field_set:CMD_Client_OnSigninCB.hallsID)
+}
+
 // -------------------------------------------------------------------
 
 // CMD_PlayerContext
@@ -12531,45 +15158,46 @@ inline void CMD_PlayerContext::set_playerid(::google::protobuf::uint64 value) {
 
 // string playerName = 2;
 inline void CMD_PlayerContext::clear_playername() {
-  playername_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  playername_.ClearToEmpty(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 inline const ::std::string& CMD_PlayerContext::playername() const {
   // @@protoc_insertion_point(field_get:CMD_PlayerContext.playerName)
-  return playername_.GetNoArena();
+  return playername_.Get();
 }
 inline void CMD_PlayerContext::set_playername(const ::std::string& value) {
   
-  playername_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  playername_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value, GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set:CMD_PlayerContext.playerName)
 }
-#if LANG_CXX11
-inline void CMD_PlayerContext::set_playername(::std::string&& value) {
-  
-  playername_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:CMD_PlayerContext.playerName)
-}
-#endif
 inline void CMD_PlayerContext::set_playername(const char* value) {
   
-  playername_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  playername_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+              GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_char:CMD_PlayerContext.playerName)
 }
-inline void CMD_PlayerContext::set_playername(const char* value, size_t size) {
+inline void CMD_PlayerContext::set_playername(const char* value,
+    size_t size) {
   
-  playername_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
+  playername_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_pointer:CMD_PlayerContext.playerName)
 }
 inline ::std::string* CMD_PlayerContext::mutable_playername() {
   
   // @@protoc_insertion_point(field_mutable:CMD_PlayerContext.playerName)
-  return playername_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return playername_.Mutable(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 inline ::std::string* CMD_PlayerContext::release_playername() {
   // @@protoc_insertion_point(field_release:CMD_PlayerContext.playerName)
   
-  return playername_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return playername_.Release(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
+}
+inline ::std::string* CMD_PlayerContext::unsafe_arena_release_playername() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:CMD_PlayerContext.playerName)
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  
+  return playername_.UnsafeArenaRelease(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      GetArenaNoVirtual());
 }
 inline void CMD_PlayerContext::set_allocated_playername(::std::string* playername) {
   if (playername != NULL) {
@@ -12577,9 +15205,22 @@ inline void CMD_PlayerContext::set_allocated_playername(::std::string* playernam
   } else {
     
   }
-  playername_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), playername);
+  playername_.SetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), playername,
+      GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_allocated:CMD_PlayerContext.playerName)
 }
+inline void CMD_PlayerContext::unsafe_arena_set_allocated_playername(
+    ::std::string* playername) {
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  if (playername != NULL) {
+    
+  } else {
+    
+  }
+  playername_.UnsafeArenaSetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      playername, GetArenaNoVirtual());
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:CMD_PlayerContext.playerName)
+}
 
 // int32 playerModelID = 3;
 inline void CMD_PlayerContext::clear_playermodelid() {
@@ -12653,45 +15294,46 @@ inline void CMD_PlayerContext::set_gamemode(::google::protobuf::int32 value) {
 
 // string gameServerIP = 8;
 inline void CMD_PlayerContext::clear_gameserverip() {
-  gameserverip_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  gameserverip_.ClearToEmpty(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 inline const ::std::string& CMD_PlayerContext::gameserverip() const {
   // @@protoc_insertion_point(field_get:CMD_PlayerContext.gameServerIP)
-  return gameserverip_.GetNoArena();
+  return gameserverip_.Get();
 }
 inline void CMD_PlayerContext::set_gameserverip(const ::std::string& value) {
   
-  gameserverip_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  gameserverip_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value, GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set:CMD_PlayerContext.gameServerIP)
 }
-#if LANG_CXX11
-inline void CMD_PlayerContext::set_gameserverip(::std::string&& value) {
-  
-  gameserverip_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:CMD_PlayerContext.gameServerIP)
-}
-#endif
 inline void CMD_PlayerContext::set_gameserverip(const char* value) {
   
-  gameserverip_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  gameserverip_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+              GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_char:CMD_PlayerContext.gameServerIP)
 }
-inline void CMD_PlayerContext::set_gameserverip(const char* value, size_t size) {
+inline void CMD_PlayerContext::set_gameserverip(const char* value,
+    size_t size) {
   
-  gameserverip_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
+  gameserverip_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_pointer:CMD_PlayerContext.gameServerIP)
 }
 inline ::std::string* CMD_PlayerContext::mutable_gameserverip() {
   
   // @@protoc_insertion_point(field_mutable:CMD_PlayerContext.gameServerIP)
-  return gameserverip_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return gameserverip_.Mutable(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 inline ::std::string* CMD_PlayerContext::release_gameserverip() {
   // @@protoc_insertion_point(field_release:CMD_PlayerContext.gameServerIP)
   
-  return gameserverip_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return gameserverip_.Release(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
+}
+inline ::std::string* CMD_PlayerContext::unsafe_arena_release_gameserverip() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:CMD_PlayerContext.gameServerIP)
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  
+  return gameserverip_.UnsafeArenaRelease(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      GetArenaNoVirtual());
 }
 inline void CMD_PlayerContext::set_allocated_gameserverip(::std::string* gameserverip) {
   if (gameserverip != NULL) {
@@ -12699,9 +15341,22 @@ inline void CMD_PlayerContext::set_allocated_gameserverip(::std::string* gameser
   } else {
     
   }
-  gameserverip_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), gameserverip);
+  gameserverip_.SetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), gameserverip,
+      GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_allocated:CMD_PlayerContext.gameServerIP)
 }
+inline void CMD_PlayerContext::unsafe_arena_set_allocated_gameserverip(
+    ::std::string* gameserverip) {
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  if (gameserverip != NULL) {
+    
+  } else {
+    
+  }
+  gameserverip_.UnsafeArenaSetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      gameserverip, GetArenaNoVirtual());
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:CMD_PlayerContext.gameServerIP)
+}
 
 // int32 gameServerPort = 9;
 inline void CMD_PlayerContext::clear_gameserverport() {
@@ -12823,7 +15478,7 @@ inline const ::CMD_PlayerContext& CMD_Client_UpdatePlayerContext::playercontext(
 inline ::CMD_PlayerContext* CMD_Client_UpdatePlayerContext::mutable_playercontext() {
   
   if (playercontext_ == NULL) {
-    playercontext_ = new ::CMD_PlayerContext;
+    _slow_mutable_playercontext();
   }
   // @@protoc_insertion_point(field_mutable:CMD_Client_UpdatePlayerContext.playerContext)
   return playercontext_;
@@ -12831,12 +15486,22 @@ inline ::CMD_PlayerContext* CMD_Client_UpdatePlayerContext::mutable_playercontex
 inline ::CMD_PlayerContext* CMD_Client_UpdatePlayerContext::release_playercontext() {
   // @@protoc_insertion_point(field_release:CMD_Client_UpdatePlayerContext.playerContext)
   
-  ::CMD_PlayerContext* temp = playercontext_;
-  playercontext_ = NULL;
-  return temp;
+  if (GetArenaNoVirtual() != NULL) {
+    return _slow_release_playercontext();
+  } else {
+    ::CMD_PlayerContext* temp = playercontext_;
+    playercontext_ = NULL;
+    return temp;
+  }
 }
-inline void CMD_Client_UpdatePlayerContext::set_allocated_playercontext(::CMD_PlayerContext* playercontext) {
-  delete playercontext_;
+inline  void CMD_Client_UpdatePlayerContext::set_allocated_playercontext(::CMD_PlayerContext* playercontext) {
+  ::google::protobuf::Arena* message_arena = GetArenaNoVirtual();
+  if (message_arena == NULL) {
+    delete playercontext_;
+  }
+  if (playercontext != NULL) {
+    _slow_set_allocated_playercontext(message_arena, &playercontext);
+  }
   playercontext_ = playercontext;
   if (playercontext) {
     
@@ -12866,45 +15531,46 @@ inline void CMD_GameModeInfos::set_gamemodeid(::google::protobuf::uint32 value)
 
 // string gameModeName = 2;
 inline void CMD_GameModeInfos::clear_gamemodename() {
-  gamemodename_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  gamemodename_.ClearToEmpty(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 inline const ::std::string& CMD_GameModeInfos::gamemodename() const {
   // @@protoc_insertion_point(field_get:CMD_GameModeInfos.gameModeName)
-  return gamemodename_.GetNoArena();
+  return gamemodename_.Get();
 }
 inline void CMD_GameModeInfos::set_gamemodename(const ::std::string& value) {
   
-  gamemodename_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  gamemodename_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value, GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set:CMD_GameModeInfos.gameModeName)
 }
-#if LANG_CXX11
-inline void CMD_GameModeInfos::set_gamemodename(::std::string&& value) {
-  
-  gamemodename_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:CMD_GameModeInfos.gameModeName)
-}
-#endif
 inline void CMD_GameModeInfos::set_gamemodename(const char* value) {
   
-  gamemodename_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  gamemodename_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+              GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_char:CMD_GameModeInfos.gameModeName)
 }
-inline void CMD_GameModeInfos::set_gamemodename(const char* value, size_t size) {
+inline void CMD_GameModeInfos::set_gamemodename(const char* value,
+    size_t size) {
   
-  gamemodename_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
+  gamemodename_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_pointer:CMD_GameModeInfos.gameModeName)
 }
 inline ::std::string* CMD_GameModeInfos::mutable_gamemodename() {
   
   // @@protoc_insertion_point(field_mutable:CMD_GameModeInfos.gameModeName)
-  return gamemodename_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return gamemodename_.Mutable(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 inline ::std::string* CMD_GameModeInfos::release_gamemodename() {
   // @@protoc_insertion_point(field_release:CMD_GameModeInfos.gameModeName)
   
-  return gamemodename_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return gamemodename_.Release(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
+}
+inline ::std::string* CMD_GameModeInfos::unsafe_arena_release_gamemodename() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:CMD_GameModeInfos.gameModeName)
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  
+  return gamemodename_.UnsafeArenaRelease(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      GetArenaNoVirtual());
 }
 inline void CMD_GameModeInfos::set_allocated_gamemodename(::std::string* gamemodename) {
   if (gamemodename != NULL) {
@@ -12912,9 +15578,22 @@ inline void CMD_GameModeInfos::set_allocated_gamemodename(::std::string* gamemod
   } else {
     
   }
-  gamemodename_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), gamemodename);
+  gamemodename_.SetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), gamemodename,
+      GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_allocated:CMD_GameModeInfos.gameModeName)
 }
+inline void CMD_GameModeInfos::unsafe_arena_set_allocated_gamemodename(
+    ::std::string* gamemodename) {
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  if (gamemodename != NULL) {
+    
+  } else {
+    
+  }
+  gamemodename_.UnsafeArenaSetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      gamemodename, GetArenaNoVirtual());
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:CMD_GameModeInfos.gameModeName)
+}
 
 // uint32 playerMax = 3;
 inline void CMD_GameModeInfos::clear_playermax() {
@@ -12992,45 +15671,46 @@ inline void CMD_GameInfos::set_type(::google::protobuf::uint32 value) {
 
 // string gameName = 4;
 inline void CMD_GameInfos::clear_gamename() {
-  gamename_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  gamename_.ClearToEmpty(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 inline const ::std::string& CMD_GameInfos::gamename() const {
   // @@protoc_insertion_point(field_get:CMD_GameInfos.gameName)
-  return gamename_.GetNoArena();
+  return gamename_.Get();
 }
 inline void CMD_GameInfos::set_gamename(const ::std::string& value) {
   
-  gamename_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  gamename_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value, GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set:CMD_GameInfos.gameName)
 }
-#if LANG_CXX11
-inline void CMD_GameInfos::set_gamename(::std::string&& value) {
-  
-  gamename_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:CMD_GameInfos.gameName)
-}
-#endif
 inline void CMD_GameInfos::set_gamename(const char* value) {
   
-  gamename_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  gamename_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+              GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_char:CMD_GameInfos.gameName)
 }
-inline void CMD_GameInfos::set_gamename(const char* value, size_t size) {
+inline void CMD_GameInfos::set_gamename(const char* value,
+    size_t size) {
   
-  gamename_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
+  gamename_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_pointer:CMD_GameInfos.gameName)
 }
 inline ::std::string* CMD_GameInfos::mutable_gamename() {
   
   // @@protoc_insertion_point(field_mutable:CMD_GameInfos.gameName)
-  return gamename_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return gamename_.Mutable(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 inline ::std::string* CMD_GameInfos::release_gamename() {
   // @@protoc_insertion_point(field_release:CMD_GameInfos.gameName)
   
-  return gamename_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return gamename_.Release(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
+}
+inline ::std::string* CMD_GameInfos::unsafe_arena_release_gamename() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:CMD_GameInfos.gameName)
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  
+  return gamename_.UnsafeArenaRelease(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      GetArenaNoVirtual());
 }
 inline void CMD_GameInfos::set_allocated_gamename(::std::string* gamename) {
   if (gamename != NULL) {
@@ -13038,51 +15718,65 @@ inline void CMD_GameInfos::set_allocated_gamename(::std::string* gamename) {
   } else {
     
   }
-  gamename_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), gamename);
+  gamename_.SetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), gamename,
+      GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_allocated:CMD_GameInfos.gameName)
 }
+inline void CMD_GameInfos::unsafe_arena_set_allocated_gamename(
+    ::std::string* gamename) {
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  if (gamename != NULL) {
+    
+  } else {
+    
+  }
+  gamename_.UnsafeArenaSetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      gamename, GetArenaNoVirtual());
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:CMD_GameInfos.gameName)
+}
 
 // string url_icon = 5;
 inline void CMD_GameInfos::clear_url_icon() {
-  url_icon_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  url_icon_.ClearToEmpty(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 inline const ::std::string& CMD_GameInfos::url_icon() const {
   // @@protoc_insertion_point(field_get:CMD_GameInfos.url_icon)
-  return url_icon_.GetNoArena();
+  return url_icon_.Get();
 }
 inline void CMD_GameInfos::set_url_icon(const ::std::string& value) {
   
-  url_icon_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  url_icon_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value, GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set:CMD_GameInfos.url_icon)
 }
-#if LANG_CXX11
-inline void CMD_GameInfos::set_url_icon(::std::string&& value) {
-  
-  url_icon_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:CMD_GameInfos.url_icon)
-}
-#endif
 inline void CMD_GameInfos::set_url_icon(const char* value) {
   
-  url_icon_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  url_icon_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+              GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_char:CMD_GameInfos.url_icon)
 }
-inline void CMD_GameInfos::set_url_icon(const char* value, size_t size) {
+inline void CMD_GameInfos::set_url_icon(const char* value,
+    size_t size) {
   
-  url_icon_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
+  url_icon_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_pointer:CMD_GameInfos.url_icon)
 }
 inline ::std::string* CMD_GameInfos::mutable_url_icon() {
   
   // @@protoc_insertion_point(field_mutable:CMD_GameInfos.url_icon)
-  return url_icon_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return url_icon_.Mutable(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 inline ::std::string* CMD_GameInfos::release_url_icon() {
   // @@protoc_insertion_point(field_release:CMD_GameInfos.url_icon)
   
-  return url_icon_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return url_icon_.Release(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
+}
+inline ::std::string* CMD_GameInfos::unsafe_arena_release_url_icon() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:CMD_GameInfos.url_icon)
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  
+  return url_icon_.UnsafeArenaRelease(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      GetArenaNoVirtual());
 }
 inline void CMD_GameInfos::set_allocated_url_icon(::std::string* url_icon) {
   if (url_icon != NULL) {
@@ -13090,51 +15784,65 @@ inline void CMD_GameInfos::set_allocated_url_icon(::std::string* url_icon) {
   } else {
     
   }
-  url_icon_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), url_icon);
+  url_icon_.SetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), url_icon,
+      GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_allocated:CMD_GameInfos.url_icon)
 }
+inline void CMD_GameInfos::unsafe_arena_set_allocated_url_icon(
+    ::std::string* url_icon) {
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  if (url_icon != NULL) {
+    
+  } else {
+    
+  }
+  url_icon_.UnsafeArenaSetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      url_icon, GetArenaNoVirtual());
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:CMD_GameInfos.url_icon)
+}
 
 // string url_apk = 6;
 inline void CMD_GameInfos::clear_url_apk() {
-  url_apk_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  url_apk_.ClearToEmpty(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 inline const ::std::string& CMD_GameInfos::url_apk() const {
   // @@protoc_insertion_point(field_get:CMD_GameInfos.url_apk)
-  return url_apk_.GetNoArena();
+  return url_apk_.Get();
 }
 inline void CMD_GameInfos::set_url_apk(const ::std::string& value) {
   
-  url_apk_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  url_apk_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value, GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set:CMD_GameInfos.url_apk)
 }
-#if LANG_CXX11
-inline void CMD_GameInfos::set_url_apk(::std::string&& value) {
-  
-  url_apk_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:CMD_GameInfos.url_apk)
-}
-#endif
 inline void CMD_GameInfos::set_url_apk(const char* value) {
   
-  url_apk_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  url_apk_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+              GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_char:CMD_GameInfos.url_apk)
 }
-inline void CMD_GameInfos::set_url_apk(const char* value, size_t size) {
+inline void CMD_GameInfos::set_url_apk(const char* value,
+    size_t size) {
   
-  url_apk_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
+  url_apk_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_pointer:CMD_GameInfos.url_apk)
 }
 inline ::std::string* CMD_GameInfos::mutable_url_apk() {
   
   // @@protoc_insertion_point(field_mutable:CMD_GameInfos.url_apk)
-  return url_apk_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return url_apk_.Mutable(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 inline ::std::string* CMD_GameInfos::release_url_apk() {
   // @@protoc_insertion_point(field_release:CMD_GameInfos.url_apk)
   
-  return url_apk_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return url_apk_.Release(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
+}
+inline ::std::string* CMD_GameInfos::unsafe_arena_release_url_apk() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:CMD_GameInfos.url_apk)
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  
+  return url_apk_.UnsafeArenaRelease(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      GetArenaNoVirtual());
 }
 inline void CMD_GameInfos::set_allocated_url_apk(::std::string* url_apk) {
   if (url_apk != NULL) {
@@ -13142,9 +15850,22 @@ inline void CMD_GameInfos::set_allocated_url_apk(::std::string* url_apk) {
   } else {
     
   }
-  url_apk_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), url_apk);
+  url_apk_.SetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), url_apk,
+      GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_allocated:CMD_GameInfos.url_apk)
 }
+inline void CMD_GameInfos::unsafe_arena_set_allocated_url_apk(
+    ::std::string* url_apk) {
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  if (url_apk != NULL) {
+    
+  } else {
+    
+  }
+  url_apk_.UnsafeArenaSetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      url_apk, GetArenaNoVirtual());
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:CMD_GameInfos.url_apk)
+}
 
 // repeated .CMD_GameModeInfos gameModes = 7;
 inline int CMD_GameInfos::gamemodes_size() const {
@@ -13272,45 +15993,46 @@ inline void CMD_Client_OnLoginCB::set_errcode(::ServerError value) {
 
 // bytes datas = 2;
 inline void CMD_Client_OnLoginCB::clear_datas() {
-  datas_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  datas_.ClearToEmpty(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 inline const ::std::string& CMD_Client_OnLoginCB::datas() const {
   // @@protoc_insertion_point(field_get:CMD_Client_OnLoginCB.datas)
-  return datas_.GetNoArena();
+  return datas_.Get();
 }
 inline void CMD_Client_OnLoginCB::set_datas(const ::std::string& value) {
   
-  datas_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  datas_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value, GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set:CMD_Client_OnLoginCB.datas)
 }
-#if LANG_CXX11
-inline void CMD_Client_OnLoginCB::set_datas(::std::string&& value) {
-  
-  datas_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:CMD_Client_OnLoginCB.datas)
-}
-#endif
 inline void CMD_Client_OnLoginCB::set_datas(const char* value) {
   
-  datas_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  datas_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+              GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_char:CMD_Client_OnLoginCB.datas)
 }
-inline void CMD_Client_OnLoginCB::set_datas(const void* value, size_t size) {
+inline void CMD_Client_OnLoginCB::set_datas(const void* value,
+    size_t size) {
   
-  datas_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
+  datas_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_pointer:CMD_Client_OnLoginCB.datas)
 }
 inline ::std::string* CMD_Client_OnLoginCB::mutable_datas() {
   
   // @@protoc_insertion_point(field_mutable:CMD_Client_OnLoginCB.datas)
-  return datas_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return datas_.Mutable(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 inline ::std::string* CMD_Client_OnLoginCB::release_datas() {
   // @@protoc_insertion_point(field_release:CMD_Client_OnLoginCB.datas)
   
-  return datas_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return datas_.Release(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
+}
+inline ::std::string* CMD_Client_OnLoginCB::unsafe_arena_release_datas() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:CMD_Client_OnLoginCB.datas)
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  
+  return datas_.UnsafeArenaRelease(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      GetArenaNoVirtual());
 }
 inline void CMD_Client_OnLoginCB::set_allocated_datas(::std::string* datas) {
   if (datas != NULL) {
@@ -13318,9 +16040,22 @@ inline void CMD_Client_OnLoginCB::set_allocated_datas(::std::string* datas) {
   } else {
     
   }
-  datas_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), datas);
+  datas_.SetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), datas,
+      GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_allocated:CMD_Client_OnLoginCB.datas)
 }
+inline void CMD_Client_OnLoginCB::unsafe_arena_set_allocated_datas(
+    ::std::string* datas) {
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  if (datas != NULL) {
+    
+  } else {
+    
+  }
+  datas_.UnsafeArenaSetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      datas, GetArenaNoVirtual());
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:CMD_Client_OnLoginCB.datas)
+}
 
 // .CMD_PlayerContext playerContext = 3;
 inline bool CMD_Client_OnLoginCB::has_playercontext() const {
@@ -13338,7 +16073,7 @@ inline const ::CMD_PlayerContext& CMD_Client_OnLoginCB::playercontext() const {
 inline ::CMD_PlayerContext* CMD_Client_OnLoginCB::mutable_playercontext() {
   
   if (playercontext_ == NULL) {
-    playercontext_ = new ::CMD_PlayerContext;
+    _slow_mutable_playercontext();
   }
   // @@protoc_insertion_point(field_mutable:CMD_Client_OnLoginCB.playerContext)
   return playercontext_;
@@ -13346,12 +16081,22 @@ inline ::CMD_PlayerContext* CMD_Client_OnLoginCB::mutable_playercontext() {
 inline ::CMD_PlayerContext* CMD_Client_OnLoginCB::release_playercontext() {
   // @@protoc_insertion_point(field_release:CMD_Client_OnLoginCB.playerContext)
   
-  ::CMD_PlayerContext* temp = playercontext_;
-  playercontext_ = NULL;
-  return temp;
+  if (GetArenaNoVirtual() != NULL) {
+    return _slow_release_playercontext();
+  } else {
+    ::CMD_PlayerContext* temp = playercontext_;
+    playercontext_ = NULL;
+    return temp;
+  }
 }
-inline void CMD_Client_OnLoginCB::set_allocated_playercontext(::CMD_PlayerContext* playercontext) {
-  delete playercontext_;
+inline  void CMD_Client_OnLoginCB::set_allocated_playercontext(::CMD_PlayerContext* playercontext) {
+  ::google::protobuf::Arena* message_arena = GetArenaNoVirtual();
+  if (message_arena == NULL) {
+    delete playercontext_;
+  }
+  if (playercontext != NULL) {
+    _slow_set_allocated_playercontext(message_arena, &playercontext);
+  }
   playercontext_ = playercontext;
   if (playercontext) {
     
@@ -13361,65 +16106,52 @@ inline void CMD_Client_OnLoginCB::set_allocated_playercontext(::CMD_PlayerContex
   // @@protoc_insertion_point(field_set_allocated:CMD_Client_OnLoginCB.playerContext)
 }
 
-// uint64 hallsID = 4;
-inline void CMD_Client_OnLoginCB::clear_hallsid() {
-  hallsid_ = GOOGLE_ULONGLONG(0);
-}
-inline ::google::protobuf::uint64 CMD_Client_OnLoginCB::hallsid() const {
-  // @@protoc_insertion_point(field_get:CMD_Client_OnLoginCB.hallsID)
-  return hallsid_;
-}
-inline void CMD_Client_OnLoginCB::set_hallsid(::google::protobuf::uint64 value) {
-  
-  hallsid_ = value;
-  // @@protoc_insertion_point(field_set:CMD_Client_OnLoginCB.hallsID)
-}
-
 // -------------------------------------------------------------------
 
 // CMD_Client_OnMatchingUpdate
 
 // string name = 1;
 inline void CMD_Client_OnMatchingUpdate::clear_name() {
-  name_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  name_.ClearToEmpty(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 inline const ::std::string& CMD_Client_OnMatchingUpdate::name() const {
   // @@protoc_insertion_point(field_get:CMD_Client_OnMatchingUpdate.name)
-  return name_.GetNoArena();
+  return name_.Get();
 }
 inline void CMD_Client_OnMatchingUpdate::set_name(const ::std::string& value) {
   
-  name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  name_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value, GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set:CMD_Client_OnMatchingUpdate.name)
 }
-#if LANG_CXX11
-inline void CMD_Client_OnMatchingUpdate::set_name(::std::string&& value) {
-  
-  name_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:CMD_Client_OnMatchingUpdate.name)
-}
-#endif
 inline void CMD_Client_OnMatchingUpdate::set_name(const char* value) {
   
-  name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  name_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+              GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_char:CMD_Client_OnMatchingUpdate.name)
 }
-inline void CMD_Client_OnMatchingUpdate::set_name(const char* value, size_t size) {
+inline void CMD_Client_OnMatchingUpdate::set_name(const char* value,
+    size_t size) {
   
-  name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
+  name_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_pointer:CMD_Client_OnMatchingUpdate.name)
 }
 inline ::std::string* CMD_Client_OnMatchingUpdate::mutable_name() {
   
   // @@protoc_insertion_point(field_mutable:CMD_Client_OnMatchingUpdate.name)
-  return name_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return name_.Mutable(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 inline ::std::string* CMD_Client_OnMatchingUpdate::release_name() {
   // @@protoc_insertion_point(field_release:CMD_Client_OnMatchingUpdate.name)
   
-  return name_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return name_.Release(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
+}
+inline ::std::string* CMD_Client_OnMatchingUpdate::unsafe_arena_release_name() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:CMD_Client_OnMatchingUpdate.name)
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  
+  return name_.UnsafeArenaRelease(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      GetArenaNoVirtual());
 }
 inline void CMD_Client_OnMatchingUpdate::set_allocated_name(::std::string* name) {
   if (name != NULL) {
@@ -13427,9 +16159,22 @@ inline void CMD_Client_OnMatchingUpdate::set_allocated_name(::std::string* name)
   } else {
     
   }
-  name_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), name);
+  name_.SetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), name,
+      GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_allocated:CMD_Client_OnMatchingUpdate.name)
 }
+inline void CMD_Client_OnMatchingUpdate::unsafe_arena_set_allocated_name(
+    ::std::string* name) {
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  if (name != NULL) {
+    
+  } else {
+    
+  }
+  name_.UnsafeArenaSetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      name, GetArenaNoVirtual());
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:CMD_Client_OnMatchingUpdate.name)
+}
 
 // uint64 id = 2;
 inline void CMD_Client_OnMatchingUpdate::clear_id() {
@@ -13493,45 +16238,46 @@ inline void CMD_Client_OnEndMatch::set_errcode(::ServerError value) {
 
 // string gameServerIP = 2;
 inline void CMD_Client_OnEndMatch::clear_gameserverip() {
-  gameserverip_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  gameserverip_.ClearToEmpty(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 inline const ::std::string& CMD_Client_OnEndMatch::gameserverip() const {
   // @@protoc_insertion_point(field_get:CMD_Client_OnEndMatch.gameServerIP)
-  return gameserverip_.GetNoArena();
+  return gameserverip_.Get();
 }
 inline void CMD_Client_OnEndMatch::set_gameserverip(const ::std::string& value) {
   
-  gameserverip_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  gameserverip_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value, GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set:CMD_Client_OnEndMatch.gameServerIP)
 }
-#if LANG_CXX11
-inline void CMD_Client_OnEndMatch::set_gameserverip(::std::string&& value) {
-  
-  gameserverip_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:CMD_Client_OnEndMatch.gameServerIP)
-}
-#endif
 inline void CMD_Client_OnEndMatch::set_gameserverip(const char* value) {
   
-  gameserverip_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  gameserverip_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+              GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_char:CMD_Client_OnEndMatch.gameServerIP)
 }
-inline void CMD_Client_OnEndMatch::set_gameserverip(const char* value, size_t size) {
+inline void CMD_Client_OnEndMatch::set_gameserverip(const char* value,
+    size_t size) {
   
-  gameserverip_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
+  gameserverip_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_pointer:CMD_Client_OnEndMatch.gameServerIP)
 }
 inline ::std::string* CMD_Client_OnEndMatch::mutable_gameserverip() {
   
   // @@protoc_insertion_point(field_mutable:CMD_Client_OnEndMatch.gameServerIP)
-  return gameserverip_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return gameserverip_.Mutable(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 inline ::std::string* CMD_Client_OnEndMatch::release_gameserverip() {
   // @@protoc_insertion_point(field_release:CMD_Client_OnEndMatch.gameServerIP)
   
-  return gameserverip_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return gameserverip_.Release(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
+}
+inline ::std::string* CMD_Client_OnEndMatch::unsafe_arena_release_gameserverip() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:CMD_Client_OnEndMatch.gameServerIP)
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  
+  return gameserverip_.UnsafeArenaRelease(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      GetArenaNoVirtual());
 }
 inline void CMD_Client_OnEndMatch::set_allocated_gameserverip(::std::string* gameserverip) {
   if (gameserverip != NULL) {
@@ -13539,9 +16285,22 @@ inline void CMD_Client_OnEndMatch::set_allocated_gameserverip(::std::string* gam
   } else {
     
   }
-  gameserverip_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), gameserverip);
+  gameserverip_.SetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), gameserverip,
+      GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_allocated:CMD_Client_OnEndMatch.gameServerIP)
 }
+inline void CMD_Client_OnEndMatch::unsafe_arena_set_allocated_gameserverip(
+    ::std::string* gameserverip) {
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  if (gameserverip != NULL) {
+    
+  } else {
+    
+  }
+  gameserverip_.UnsafeArenaSetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      gameserverip, GetArenaNoVirtual());
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:CMD_Client_OnEndMatch.gameServerIP)
+}
 
 // int32 gameServerPort = 3;
 inline void CMD_Client_OnEndMatch::clear_gameserverport() {
@@ -13876,6 +16635,10 @@ inline void CMD_Client_OnCancelMatch::set_errcode(::ServerError value) {
 
 // -------------------------------------------------------------------
 
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
 
 // @@protoc_insertion_point(namespace_scope)
 
@@ -75,10 +75,10 @@ void AddDescriptorsImpl() {
       "PLAYING\020\010\022\020\n\014MATCH_FAILED\020\t\022\036\n\032CREATE_RO"
       "OM_PROCESS_FAILED\020\n\022\013\n\007TIMEOUT\020\013\022\021\n\rCONN"
       "ECT_ERROR\020\014\022\020\n\014DISCONNECTED\020\r\022\020\n\014CREATE_"
-      "ERROR\020\016\022\017\n\013AUTH_FAILED\020\017b\006proto3"
+      "ERROR\020\016\022\017\n\013AUTH_FAILED\020\017B\003\370\001\001b\006proto3"
   };
   ::google::protobuf::DescriptorPool::InternalAddGeneratedFile(
-      descriptor, 352);
+      descriptor, 357);
   ::google::protobuf::MessageFactory::InternalRegisterGeneratedFile(
     "ServerCommon.proto", &protobuf_RegisterTypes);
   ::google::protobuf::internal::OnShutdown(&TableStruct::Shutdown);
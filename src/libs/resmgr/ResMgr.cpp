@@ -288,6 +288,110 @@ bool ResMgr::loadConfigs(const std::string& srvName)
 		if (-1 != external_RCVBUF)
 			srvcfg.external_RCVBUF = external_RCVBUF;
 
+		int internal_NODELAY = iniparser_getint(ini, "common:internal_NODELAY", -1);
+		if (-1 != internal_NODELAY)
+			srvcfg.internal_NODELAY = internal_NODELAY;
+
+		int internal_NOTSENT_LOWAT = iniparser_getint(ini, "common:internal_NOTSENT_LOWAT", -1);
+		if (-1 != internal_NOTSENT_LOWAT)
+			srvcfg.internal_NOTSENT_LOWAT = internal_NOTSENT_LOWAT;
+
+		int internal_KEEPALIVE = iniparser_getint(ini, "common:internal_KEEPALIVE", -1);
+		if (-1 != internal_KEEPALIVE)
+			srvcfg.internal_KEEPALIVE = internal_KEEPALIVE;
+
+		int internal_DEFER_ACCEPT = iniparser_getint(ini, "common:internal_DEFER_ACCEPT", -1);
+		if (-1 != internal_DEFER_ACCEPT)
+			srvcfg.internal_DEFER_ACCEPT = internal_DEFER_ACCEPT;
+
+		int internal_FASTOPEN = iniparser_getint(ini, "common:internal_FASTOPEN", -1);
+		if (-1 != internal_FASTOPEN)
+			srvcfg.internal_FASTOPEN = internal_FASTOPEN;
+
+		int external_NODELAY = iniparser_getint(ini, "common:external_NODELAY", -1);
+		if (-1 != external_NODELAY)
+			srvcfg.external_NODELAY = external_NODELAY;
+
+		int external_NOTSENT_LOWAT = iniparser_getint(ini, "common:external_NOTSENT_LOWAT", -1);
+		if (-1 != external_NOTSENT_LOWAT)
+			srvcfg.external_NOTSENT_LOWAT = external_NOTSENT_LOWAT;
+
+		int external_KEEPALIVE = iniparser_getint(ini, "common:external_KEEPALIVE", -1);
+		if (-1 != external_KEEPALIVE)
+			srvcfg.external_KEEPALIVE = external_KEEPALIVE;
+
+		int external_DEFER_ACCEPT = iniparser_getint(ini, "common:external_DEFER_ACCEPT", -1);
+		if (-1 != external_DEFER_ACCEPT)
+			srvcfg.external_DEFER_ACCEPT = external_DEFER_ACCEPT;
+
+		int external_FASTOPEN = iniparser_getint(ini, "common:external_FASTOPEN", -1);
+		if (-1 != external_FASTOPEN)
+			srvcfg.external_FASTOPEN = external_FASTOPEN;
+
+		int internal_SNDQUEUE_MAX = iniparser_getint(ini, "common:internal_SNDQUEUE_MAX", -1);
+		if (-1 != internal_SNDQUEUE_MAX)
+			srvcfg.internal_SNDQUEUE_MAX = internal_SNDQUEUE_MAX;
+
+		int internal_SNDQUEUE_POLICY = iniparser_getint(ini, "common:internal_SNDQUEUE_POLICY", -1);
+		if (-1 != internal_SNDQUEUE_POLICY)
+			srvcfg.internal_SNDQUEUE_POLICY = internal_SNDQUEUE_POLICY;
+
+		int external_SNDQUEUE_MAX = iniparser_getint(ini, "common:external_SNDQUEUE_MAX", -1);
+		if (-1 != external_SNDQUEUE_MAX)
+			srvcfg.external_SNDQUEUE_MAX = external_SNDQUEUE_MAX;
+
+		int external_SNDQUEUE_POLICY = iniparser_getint(ini, "common:external_SNDQUEUE_POLICY", -1);
+		if (-1 != external_SNDQUEUE_POLICY)
+			srvcfg.external_SNDQUEUE_POLICY = external_SNDQUEUE_POLICY;
+
+		int internal_ACCEPT_RATE = iniparser_getint(ini, "common:internal_ACCEPT_RATE", -1);
+		if (-1 != internal_ACCEPT_RATE)
+			srvcfg.internal_ACCEPT_RATE = internal_ACCEPT_RATE;
+
+		int internal_ACCEPT_BURST = iniparser_getint(ini, "common:internal_ACCEPT_BURST", -1);
+		if (-1 != internal_ACCEPT_BURST)
+			srvcfg.internal_ACCEPT_BURST = internal_ACCEPT_BURST;
+
+		int external_ACCEPT_RATE = iniparser_getint(ini, "common:external_ACCEPT_RATE", -1);
+		if (-1 != external_ACCEPT_RATE)
+			srvcfg.external_ACCEPT_RATE = external_ACCEPT_RATE;
+
+		int external_ACCEPT_BURST = iniparser_getint(ini, "common:external_ACCEPT_BURST", -1);
+		if (-1 != external_ACCEPT_BURST)
+			srvcfg.external_ACCEPT_BURST = external_ACCEPT_BURST;
+
+		int acceptPrefixV4 = iniparser_getint(ini, "common:acceptPrefixV4", -1);
+		if (-1 != acceptPrefixV4)
+			srvcfg.acceptPrefixV4 = acceptPrefixV4;
+
+		int acceptPrefixV6 = iniparser_getint(ini, "common:acceptPrefixV6", -1);
+		if (-1 != acceptPrefixV6)
+			srvcfg.acceptPrefixV6 = acceptPrefixV6;
+
+		int internal_PRIORITY_LOWAT = iniparser_getint(ini, "common:internal_PRIORITY_LOWAT", -1);
+		if (-1 != internal_PRIORITY_LOWAT)
+			srvcfg.internal_PRIORITY_LOWAT = internal_PRIORITY_LOWAT;
+
+		int external_PRIORITY_LOWAT = iniparser_getint(ini, "common:external_PRIORITY_LOWAT", -1);
+		if (-1 != external_PRIORITY_LOWAT)
+			srvcfg.external_PRIORITY_LOWAT = external_PRIORITY_LOWAT;
+
+		int internal_RECV_BUDGET = iniparser_getint(ini, "common:internal_RECV_BUDGET", -1);
+		if (-1 != internal_RECV_BUDGET)
+			srvcfg.internal_RECV_BUDGET = internal_RECV_BUDGET;
+
+		int internal_RECV_BUDGET_BYTES = iniparser_getint(ini, "common:internal_RECV_BUDGET_BYTES", -1);
+		if (-1 != internal_RECV_BUDGET_BYTES)
+			srvcfg.internal_RECV_BUDGET_BYTES = internal_RECV_BUDGET_BYTES;
+
+		int external_RECV_BUDGET = iniparser_getint(ini, "common:external_RECV_BUDGET", -1);
+		if (-1 != external_RECV_BUDGET)
+			srvcfg.external_RECV_BUDGET = external_RECV_BUDGET;
+
+		int external_RECV_BUDGET_BYTES = iniparser_getint(ini, "common:external_RECV_BUDGET_BYTES", -1);
+		if (-1 != external_RECV_BUDGET_BYTES)
+			srvcfg.external_RECV_BUDGET_BYTES = external_RECV_BUDGET_BYTES;
+
 		std::string internal_ip = iniparser_getstring(ini, "common:internal_ip", "");
 		if (internal_ip.size() > 0)
 			srvcfg.internal_ip = internal_ip;
@@ -332,6 +436,114 @@ bool ResMgr::loadConfigs(const std::string& srvName)
 		if (-1 != threads)
 			srvcfg.threads = threads;
 
+		int external_loops = iniparser_getint(ini, "common:external_loops", -1);
+		if (-1 != external_loops)
+			srvcfg.external_loops = external_loops;
+
+		int internal_corking = iniparser_getint(ini, "common:internal_corking", -1);
+		if (-1 != internal_corking)
+			srvcfg.internal_corking = internal_corking > 0;
+
+		int external_corking = iniparser_getint(ini, "common:external_corking", -1);
+		if (-1 != external_corking)
+			srvcfg.external_corking = external_corking > 0;
+
+		int internal_COMPRESS = iniparser_getint(ini, "common:internal_COMPRESS", -1);
+		if (-1 != internal_COMPRESS)
+			srvcfg.internal_COMPRESS = internal_COMPRESS;
+
+		int external_COMPRESS = iniparser_getint(ini, "common:external_COMPRESS", -1);
+		if (-1 != external_COMPRESS)
+			srvcfg.external_COMPRESS = external_COMPRESS;
+
+		int compressThreshold = iniparser_getint(ini, "common:compressThreshold", -1);
+		if (-1 != compressThreshold)
+			srvcfg.compressThreshold = compressThreshold;
+
+		std::string compressDict = iniparser_getstring(ini, "common:compressDict", "");
+		if (compressDict.size() > 0)
+			srvcfg.compressDict = compressDict;
+
+		int compressDictTrain = iniparser_getint(ini, "common:compressDictTrain", -1);
+		if (-1 != compressDictTrain)
+			srvcfg.compressDictTrain = compressDictTrain > 0;
+
+		int internal_BATCH_MAX = iniparser_getint(ini, "common:internal_BATCH_MAX", -1);
+		if (-1 != internal_BATCH_MAX)
+			srvcfg.internal_BATCH_MAX = internal_BATCH_MAX;
+
+		int external_BATCH_MAX = iniparser_getint(ini, "common:external_BATCH_MAX", -1);
+		if (-1 != external_BATCH_MAX)
+			srvcfg.external_BATCH_MAX = external_BATCH_MAX;
+
+		int internal_ENCRYPT = iniparser_getint(ini, "common:internal_ENCRYPT", -1);
+		if (-1 != internal_ENCRYPT)
+			srvcfg.internal_ENCRYPT = internal_ENCRYPT;
+
+		int external_ENCRYPT = iniparser_getint(ini, "common:external_ENCRYPT", -1);
+		if (-1 != external_ENCRYPT)
+			srvcfg.external_ENCRYPT = external_ENCRYPT;
+
+		int internal_SHM_RING = iniparser_getint(ini, "common:internal_SHM_RING", -1);
+		if (-1 != internal_SHM_RING)
+			srvcfg.internal_SHM_RING = internal_SHM_RING;
+
+		int internal_LINKS = iniparser_getint(ini, "common:internal_LINKS", -1);
+		if (-1 != internal_LINKS)
+			srvcfg.internal_LINKS = internal_LINKS;
+
+		int ioBackend = iniparser_getint(ini, "common:ioBackend", -1);
+		if (-1 != ioBackend)
+			srvcfg.ioBackend = ioBackend;
+
+		int uringEntries = iniparser_getint(ini, "common:uringEntries", -1);
+		if (-1 != uringEntries)
+			srvcfg.uringEntries = uringEntries;
+
+		int uringBuffers = iniparser_getint(ini, "common:uringBuffers", -1);
+		if (-1 != uringBuffers)
+			srvcfg.uringBuffers = uringBuffers;
+
+		int uringBufferSize = iniparser_getint(ini, "common:uringBufferSize", -1);
+		if (-1 != uringBufferSize)
+			srvcfg.uringBufferSize = uringBufferSize;
+
+		int ioChunkSize = iniparser_getint(ini, "common:ioChunkSize", -1);
+		if (-1 != ioChunkSize)
+			srvcfg.ioChunkSize = ioChunkSize;
+
+		int ioChunkMax = iniparser_getint(ini, "common:ioChunkMax", -1);
+		if (-1 != ioChunkMax)
+			srvcfg.ioChunkMax = ioChunkMax;
+
+		std::string eventBackend = iniparser_getstring(ini, "common:eventBackend", "");
+		if (eventBackend.size() > 0)
+			srvcfg.eventBackend = eventBackend;
+
+		int eventEdgeTriggered = iniparser_getint(ini, "common:eventEdgeTriggered", -1);
+		if (-1 != eventEdgeTriggered)
+			srvcfg.eventEdgeTriggered = eventEdgeTriggered;
+
+		int eventChangelist = iniparser_getint(ini, "common:eventChangelist", -1);
+		if (-1 != eventChangelist)
+			srvcfg.eventChangelist = eventChangelist;
+
+		int eventNoLock = iniparser_getint(ini, "common:eventNoLock", -1);
+		if (-1 != eventNoLock)
+			srvcfg.eventNoLock = eventNoLock;
+
+		int eventPreciseTimer = iniparser_getint(ini, "common:eventPreciseTimer", -1);
+		if (-1 != eventPreciseTimer)
+			srvcfg.eventPreciseTimer = eventPreciseTimer;
+
+		int eventMaxDispatch = iniparser_getint(ini, "common:eventMaxDispatch", -1);
+		if (-1 != eventMaxDispatch)
+			srvcfg.eventMaxDispatch = eventMaxDispatch;
+
+		int eventDispatchIntervalUs = iniparser_getint(ini, "common:eventDispatchIntervalUs", -1);
+		if (-1 != eventDispatchIntervalUs)
+			srvcfg.eventDispatchIntervalUs = eventDispatchIntervalUs;
+
 		// app configuration
 		tickInterval = iniparser_getint(ini, fmt::format("{}:tickInterval", currSrvName).c_str(), -1);
 		if (-1 != tickInterval)
@@ -357,6 +569,110 @@ bool ResMgr::loadConfigs(const std::string& srvName)
 		if (-1 != external_RCVBUF)
 			srvcfg.external_RCVBUF = external_RCVBUF;
 
+		internal_NODELAY = iniparser_getint(ini, fmt::format("{}:internal_NODELAY", currSrvName).c_str(), -1);
+		if (-1 != internal_NODELAY)
+			srvcfg.internal_NODELAY = internal_NODELAY;
+
+		internal_NOTSENT_LOWAT = iniparser_getint(ini, fmt::format("{}:internal_NOTSENT_LOWAT", currSrvName).c_str(), -1);
+		if (-1 != internal_NOTSENT_LOWAT)
+			srvcfg.internal_NOTSENT_LOWAT = internal_NOTSENT_LOWAT;
+
+		internal_KEEPALIVE = iniparser_getint(ini, fmt::format("{}:internal_KEEPALIVE", currSrvName).c_str(), -1);
+		if (-1 != internal_KEEPALIVE)
+			srvcfg.internal_KEEPALIVE = internal_KEEPALIVE;
+
+		internal_DEFER_ACCEPT = iniparser_getint(ini, fmt::format("{}:internal_DEFER_ACCEPT", currSrvName).c_str(), -1);
+		if (-1 != internal_DEFER_ACCEPT)
+			srvcfg.internal_DEFER_ACCEPT = internal_DEFER_ACCEPT;
+
+		internal_FASTOPEN = iniparser_getint(ini, fmt::format("{}:internal_FASTOPEN", currSrvName).c_str(), -1);
+		if (-1 != internal_FASTOPEN)
+			srvcfg.internal_FASTOPEN = internal_FASTOPEN;
+
+		external_NODELAY = iniparser_getint(ini, fmt::format("{}:external_NODELAY", currSrvName).c_str(), -1);
+		if (-1 != external_NODELAY)
+			srvcfg.external_NODELAY = external_NODELAY;
+
+		external_NOTSENT_LOWAT = iniparser_getint(ini, fmt::format("{}:external_NOTSENT_LOWAT", currSrvName).c_str(), -1);
+		if (-1 != external_NOTSENT_LOWAT)
+			srvcfg.external_NOTSENT_LOWAT = external_NOTSENT_LOWAT;
+
+		external_KEEPALIVE = iniparser_getint(ini, fmt::format("{}:external_KEEPALIVE", currSrvName).c_str(), -1);
+		if (-1 != external_KEEPALIVE)
+			srvcfg.external_KEEPALIVE = external_KEEPALIVE;
+
+		external_DEFER_ACCEPT = iniparser_getint(ini, fmt::format("{}:external_DEFER_ACCEPT", currSrvName).c_str(), -1);
+		if (-1 != external_DEFER_ACCEPT)
+			srvcfg.external_DEFER_ACCEPT = external_DEFER_ACCEPT;
+
+		external_FASTOPEN = iniparser_getint(ini, fmt::format("{}:external_FASTOPEN", currSrvName).c_str(), -1);
+		if (-1 != external_FASTOPEN)
+			srvcfg.external_FASTOPEN = external_FASTOPEN;
+
+		internal_SNDQUEUE_MAX = iniparser_getint(ini, fmt::format("{}:internal_SNDQUEUE_MAX", currSrvName).c_str(), -1);
+		if (-1 != internal_SNDQUEUE_MAX)
+			srvcfg.internal_SNDQUEUE_MAX = internal_SNDQUEUE_MAX;
+
+		internal_SNDQUEUE_POLICY = iniparser_getint(ini, fmt::format("{}:internal_SNDQUEUE_POLICY", currSrvName).c_str(), -1);
+		if (-1 != internal_SNDQUEUE_POLICY)
+			srvcfg.internal_SNDQUEUE_POLICY = internal_SNDQUEUE_POLICY;
+
+		external_SNDQUEUE_MAX = iniparser_getint(ini, fmt::format("{}:external_SNDQUEUE_MAX", currSrvName).c_str(), -1);
+		if (-1 != external_SNDQUEUE_MAX)
+			srvcfg.external_SNDQUEUE_MAX = external_SNDQUEUE_MAX;
+
+		external_SNDQUEUE_POLICY = iniparser_getint(ini, fmt::format("{}:external_SNDQUEUE_POLICY", currSrvName).c_str(), -1);
+		if (-1 != external_SNDQUEUE_POLICY)
+			srvcfg.external_SNDQUEUE_POLICY = external_SNDQUEUE_POLICY;
+
+		internal_ACCEPT_RATE = iniparser_getint(ini, fmt::format("{}:internal_ACCEPT_RATE", currSrvName).c_str(), -1);
+		if (-1 != internal_ACCEPT_RATE)
+			srvcfg.internal_ACCEPT_RATE = internal_ACCEPT_RATE;
+
+		internal_ACCEPT_BURST = iniparser_getint(ini, fmt::format("{}:internal_ACCEPT_BURST", currSrvName).c_str(), -1);
+		if (-1 != internal_ACCEPT_BURST)
+			srvcfg.internal_ACCEPT_BURST = internal_ACCEPT_BURST;
+
+		external_ACCEPT_RATE = iniparser_getint(ini, fmt::format("{}:external_ACCEPT_RATE", currSrvName).c_str(), -1);
+		if (-1 != external_ACCEPT_RATE)
+			srvcfg.external_ACCEPT_RATE = external_ACCEPT_RATE;
+
+		external_ACCEPT_BURST = iniparser_getint(ini, fmt::format("{}:external_ACCEPT_BURST", currSrvName).c_str(), -1);
+		if (-1 != external_ACCEPT_BURST)
+			srvcfg.external_ACCEPT_BURST = external_ACCEPT_BURST;
+
+		acceptPrefixV4 = iniparser_getint(ini, fmt::format("{}:acceptPrefixV4", currSrvName).c_str(), -1);
+		if (-1 != acceptPrefixV4)
+			srvcfg.acceptPrefixV4 = acceptPrefixV4;
+
+		acceptPrefixV6 = iniparser_getint(ini, fmt::format("{}:acceptPrefixV6", currSrvName).c_str(), -1);
+		if (-1 != acceptPrefixV6)
+			srvcfg.acceptPrefixV6 = acceptPrefixV6;
+
+		internal_PRIORITY_LOWAT = iniparser_getint(ini, fmt::format("{}:internal_PRIORITY_LOWAT", currSrvName).c_str(), -1);
+		if (-1 != internal_PRIORITY_LOWAT)
+			srvcfg.internal_PRIORITY_LOWAT = internal_PRIORITY_LOWAT;
+
+		external_PRIORITY_LOWAT = iniparser_getint(ini, fmt::format("{}:external_PRIORITY_LOWAT", currSrvName).c_str(), -1);
+		if (-1 != external_PRIORITY_LOWAT)
+			srvcfg.external_PRIORITY_LOWAT = external_PRIORITY_LOWAT;
+
+		internal_RECV_BUDGET = iniparser_getint(ini, fmt::format("{}:internal_RECV_BUDGET", currSrvName).c_str(), -1);
+		if (-1 != internal_RECV_BUDGET)
+			srvcfg.internal_RECV_BUDGET = internal_RECV_BUDGET;
+
+		internal_RECV_BUDGET_BYTES = iniparser_getint(ini, fmt::format("{}:internal_RECV_BUDGET_BYTES", currSrvName).c_str(), -1);
+		if (-1 != internal_RECV_BUDGET_BYTES)
+			srvcfg.internal_RECV_BUDGET_BYTES = internal_RECV_BUDGET_BYTES;
+
+		external_RECV_BUDGET = iniparser_getint(ini, fmt::format("{}:external_RECV_BUDGET", currSrvName).c_str(), -1);
+		if (-1 != external_RECV_BUDGET)
+			srvcfg.external_RECV_BUDGET = external_RECV_BUDGET;
+
+		external_RECV_BUDGET_BYTES = iniparser_getint(ini, fmt::format("{}:external_RECV_BUDGET_BYTES", currSrvName).c_str(), -1);
+		if (-1 != external_RECV_BUDGET_BYTES)
+			srvcfg.external_RECV_BUDGET_BYTES = external_RECV_BUDGET_BYTES;
+
 		internal_ip = iniparser_getstring(ini, fmt::format("{}:internal_ip", currSrvName).c_str(), "");
 		if (internal_ip.size() > 0)
 			srvcfg.internal_ip = internal_ip;
@@ -401,6 +717,114 @@ bool ResMgr::loadConfigs(const std::string& srvName)
 		if (-1 != threads)
 			srvcfg.threads = threads;
 
+		external_loops = iniparser_getint(ini, fmt::format("{}:external_loops", currSrvName).c_str(), -1);
+		if (-1 != external_loops)
+			srvcfg.external_loops = external_loops;
+
+		internal_corking = iniparser_getint(ini, fmt::format("{}:internal_corking", currSrvName).c_str(), -1);
+		if (-1 != internal_corking)
+			srvcfg.internal_corking = internal_corking > 0;
+
+		external_corking = iniparser_getint(ini, fmt::format("{}:external_corking", currSrvName).c_str(), -1);
+		if (-1 != external_corking)
+			srvcfg.external_corking = external_corking > 0;
+
+		internal_COMPRESS = iniparser_getint(ini, fmt::format("{}:internal_COMPRESS", currSrvName).c_str(), -1);
+		if (-1 != internal_COMPRESS)
+			srvcfg.internal_COMPRESS = internal_COMPRESS;
+
+		external_COMPRESS = iniparser_getint(ini, fmt::format("{}:external_COMPRESS", currSrvName).c_str(), -1);
+		if (-1 != external_COMPRESS)
+			srvcfg.external_COMPRESS = external_COMPRESS;
+
+		compressThreshold = iniparser_getint(ini, fmt::format("{}:compressThreshold", currSrvName).c_str(), -1);
+		if (-1 != compressThreshold)
+			srvcfg.compressThreshold = compressThreshold;
+
+		compressDict = iniparser_getstring(ini, fmt::format("{}:compressDict", currSrvName).c_str(), "");
+		if (compressDict.size() > 0)
+			srvcfg.compressDict = compressDict;
+
+		compressDictTrain = iniparser_getint(ini, fmt::format("{}:compressDictTrain", currSrvName).c_str(), -1);
+		if (-1 != compressDictTrain)
+			srvcfg.compressDictTrain = compressDictTrain > 0;
+
+		internal_BATCH_MAX = iniparser_getint(ini, fmt::format("{}:internal_BATCH_MAX", currSrvName).c_str(), -1);
+		if (-1 != internal_BATCH_MAX)
+			srvcfg.internal_BATCH_MAX = internal_BATCH_MAX;
+
+		external_BATCH_MAX = iniparser_getint(ini, fmt::format("{}:external_BATCH_MAX", currSrvName).c_str(), -1);
+		if (-1 != external_BATCH_MAX)
+			srvcfg.external_BATCH_MAX = external_BATCH_MAX;
+
+		internal_ENCRYPT = iniparser_getint(ini, fmt::format("{}:internal_ENCRYPT", currSrvName).c_str(), -1);
+		if (-1 != internal_ENCRYPT)
+			srvcfg.internal_ENCRYPT = internal_ENCRYPT;
+
+		external_ENCRYPT = iniparser_getint(ini, fmt::format("{}:external_ENCRYPT", currSrvName).c_str(), -1);
+		if (-1 != external_ENCRYPT)
+			srvcfg.external_ENCRYPT = external_ENCRYPT;
+
+		internal_SHM_RING = iniparser_getint(ini, fmt::format("{}:internal_SHM_RING", currSrvName).c_str(), -1);
+		if (-1 != internal_SHM_RING)
+			srvcfg.internal_SHM_RING = internal_SHM_RING;
+
+		internal_LINKS = iniparser_getint(ini, fmt::format("{}:internal_LINKS", currSrvName).c_str(), -1);
+		if (-1 != internal_LINKS)
+			srvcfg.internal_LINKS = internal_LINKS;
+
+		ioBackend = iniparser_getint(ini, fmt::format("{}:ioBackend", currSrvName).c_str(), -1);
+		if (-1 != ioBackend)
+			srvcfg.ioBackend = ioBackend;
+
+		uringEntries = iniparser_getint(ini, fmt::format("{}:uringEntries", currSrvName).c_str(), -1);
+		if (-1 != uringEntries)
+			srvcfg.uringEntries = uringEntries;
+
+		uringBuffers = iniparser_getint(ini, fmt::format("{}:uringBuffers", currSrvName).c_str(), -1);
+		if (-1 != uringBuffers)
+			srvcfg.uringBuffers = uringBuffers;
+
+		uringBufferSize = iniparser_getint(ini, fmt::format("{}:uringBufferSize", currSrvName).c_str(), -1);
+		if (-1 != uringBufferSize)
+			srvcfg.uringBufferSize = uringBufferSize;
+
+		ioChunkSize = iniparser_getint(ini, fmt::format("{}:ioChunkSize", currSrvName).c_str(), -1);
+		if (-1 != ioChunkSize)
+			srvcfg.ioChunkSize = ioChunkSize;
+
+		ioChunkMax = iniparser_getint(ini, fmt::format("{}:ioChunkMax", currSrvName).c_str(), -1);
+		if (-1 != ioChunkMax)
+			srvcfg.ioChunkMax = ioChunkMax;
+
+		eventBackend = iniparser_getstring(ini, fmt::format("{}:eventBackend", currSrvName).c_str(), "");
+		if (eventBackend.size() > 0)
+			srvcfg.eventBackend = eventBackend;
+
+		eventEdgeTriggered = iniparser_getint(ini, fmt::format("{}:eventEdgeTriggered", currSrvName).c_str(), -1);
+		if (-1 != eventEdgeTriggered)
+			srvcfg.eventEdgeTriggered = eventEdgeTriggered;
+
+		eventChangelist = iniparser_getint(ini, fmt::format("{}:eventChangelist", currSrvName).c_str(), -1);
+		if (-1 != eventChangelist)
+			srvcfg.eventChangelist = eventChangelist;
+
+		eventNoLock = iniparser_getint(ini, fmt::format("{}:eventNoLock", currSrvName).c_str(), -1);
+		if (-1 != eventNoLock)
+			srvcfg.eventNoLock = eventNoLock;
+
+		eventPreciseTimer = iniparser_getint(ini, fmt::format("{}:eventPreciseTimer", currSrvName).c_str(), -1);
+		if (-1 != eventPreciseTimer)
+			srvcfg.eventPreciseTimer = eventPreciseTimer;
+
+		eventMaxDispatch = iniparser_getint(ini, fmt::format("{}:eventMaxDispatch", currSrvName).c_str(), -1);
+		if (-1 != eventMaxDispatch)
+			srvcfg.eventMaxDispatch = eventMaxDispatch;
+
+		eventDispatchIntervalUs = iniparser_getint(ini, fmt::format("{}:eventDispatchIntervalUs", currSrvName).c_str(), -1);
+		if (-1 != eventDispatchIntervalUs)
+			srvcfg.eventDispatchIntervalUs = eventDispatchIntervalUs;
+
 		if ((ServerType)srvType == ServerType::SERVER_TYPE_HALLS)
 		{
 			int player_disconnected_lifetime = iniparser_getint(ini, fmt::format("{}:player_disconnected_lifetime", currSrvName).c_str(), -1);
@@ -441,7 +865,7 @@ bool ResMgr::loadConfigs(const std::string& srvName)
 
 	pSrvcfg_ = &srvcfgs_[srvName];
 
-	// ȡַ
+	// 读取地址池
 	int n = iniparser_getsecnkeys(ini, "server_addresses");
 	const char* keys[1024];
 	iniparser_getseckeys(ini, "server_addresses", keys);
@@ -453,6 +877,21 @@ bool ResMgr::loadConfigs(const std::string& srvName)
 		pSrvcfg_->server_addresses.push_back(addr);
 	}
 
+	// 读取协议的发送优先级
+	n = iniparser_getsecnkeys(ini, "send_priority");
+	iniparser_getseckeys(ini, "send_priority", keys);
+
+	for (int i = 0; i < n; ++i)
+	{
+		int priority = iniparser_getint(ini, keys[i], -1);
+		if (priority < 0)
+			continue;
+
+		std::string name = keys[i];
+		x_replace(name, "send_priority:", "");
+		pSrvcfg_->send_priority[name] = priority;
+	}
+
 	iniparser_freedict(ini);
 
 	return loadGameConfigs();
@@ -31,7 +31,7 @@ namespace XServer {
 	class ResMgr : public Singleton<ResMgr>
 	{
 	public:
-		// 
+		// 环境变量
 		struct Env
 		{
 			std::string root_path;
@@ -39,7 +39,7 @@ namespace XServer {
 			std::string bin_path;
 		};
 
-		// 
+		// 服务器配置
 		struct ServerConfig
 		{
 			ServerConfig()
@@ -52,6 +52,43 @@ namespace XServer {
 				external_SNDBUF = 0;
 				external_RCVBUF = 0;
 
+				// 服务器之间： 低延迟， 尽快发现断线
+				internal_NODELAY = 1;
+				internal_NOTSENT_LOWAT = 0;
+				internal_KEEPALIVE = 60;
+				internal_DEFER_ACCEPT = 0;
+				internal_FASTOPEN = 0;
+
+				// 客户端： 未发送数据尽量留在用户态， 连接后没有数据不唤醒accept
+				external_NODELAY = 1;
+				external_NOTSENT_LOWAT = 16384;
+				external_KEEPALIVE = 120;
+				external_DEFER_ACCEPT = 5;
+				external_FASTOPEN = 256;
+
+				internal_SNDQUEUE_MAX = 0;
+				internal_SNDQUEUE_POLICY = 0;
+				external_SNDQUEUE_MAX = 0;
+				external_SNDQUEUE_POLICY = 0;
+
+				// 服务器之间的连接已经有地址白名单
+				internal_ACCEPT_RATE = 0;
+				internal_ACCEPT_BURST = 0;
+				external_ACCEPT_RATE = 50;
+				external_ACCEPT_BURST = 200;
+				acceptPrefixV4 = 24;
+				acceptPrefixV6 = 64;
+
+				// 链路上积压不多时就按优先级补充， 控制包最多排在这么多字节之后
+				internal_PRIORITY_LOWAT = 65536;
+				external_PRIORITY_LOWAT = 16384;
+
+				// 服务器之间的连接不限， 客户端每次最多处理64个包或64K
+				internal_RECV_BUDGET = 0;
+				internal_RECV_BUDGET_BYTES = 0;
+				external_RECV_BUDGET = 64;
+				external_RECV_BUDGET_BYTES = 65536;
+
 				internal_ip = "localhost";
 				internal_exposedIP = internal_ip;
 				external_ip = "";
@@ -67,6 +104,46 @@ namespace XServer {
 
 				threads = 1;
 
+				external_loops = 0;
+
+				internal_corking = false;
+				external_corking = false;
+
+				// 客户端流量按字节计费， 服务器之间更在意延迟
+				internal_COMPRESS = 0;
+				external_COMPRESS = 1;
+				compressThreshold = 256;
+				compressDict = "";
+				compressDictTrain = false;
+
+				// 只合并服务器之间转发的包
+				internal_BATCH_MAX = 16384;
+				external_BATCH_MAX = 0;
+
+				// 只加密外部网络， 服务器之间在内网
+				internal_ENCRYPT = 0;
+				external_ENCRYPT = 1;
+
+				// 客户端不会和服务器在同一台机器上
+				internal_SHM_RING = 4 * 1024 * 1024;
+				internal_LINKS = 1;
+
+				ioBackend = 0;
+				uringEntries = 4096;
+				uringBuffers = 2048;
+				uringBufferSize = 4096;
+
+				ioChunkSize = 4096;
+				ioChunkMax = 16384;
+
+				eventBackend = "";
+				eventEdgeTriggered = false;
+				eventChangelist = false;
+				eventNoLock = false;
+				eventPreciseTimer = false;
+				eventMaxDispatch = 0;
+				eventDispatchIntervalUs = 0;
+
 				player_disconnected_lifetime = 1;
 
 				db_name = "";
@@ -93,6 +170,48 @@ namespace XServer {
 			uint32 external_SNDBUF;
 			uint32 external_RCVBUF;
 
+			// socket参数， 见SocketProfile
+			int internal_NODELAY;
+			int internal_NOTSENT_LOWAT;
+			int internal_KEEPALIVE;
+			int internal_DEFER_ACCEPT;
+			int internal_FASTOPEN;
+
+			int external_NODELAY;
+			int external_NOTSENT_LOWAT;
+			int external_KEEPALIVE;
+			int external_DEFER_ACCEPT;
+			int external_FASTOPEN;
+
+			// 发送队列上限(字节)， 0为不限制； 超过后按SendQueuePolicy处理
+			uint32 internal_SNDQUEUE_MAX;
+			int internal_SNDQUEUE_POLICY;
+
+			uint32 external_SNDQUEUE_MAX;
+			int external_SNDQUEUE_POLICY;
+
+			// 每个来源前缀每秒接受的连接数和允许的突发数， 0表示不限制； 前缀长度见acceptPrefixV4/V6
+			uint32 internal_ACCEPT_RATE;
+			uint32 internal_ACCEPT_BURST;
+			uint32 external_ACCEPT_RATE;
+			uint32 external_ACCEPT_BURST;
+			uint32 acceptPrefixV4;
+			uint32 acceptPrefixV6;
+
+			// socket中未发送的数据少于该值时才从优先级队列补充， 0表示不分优先级
+			uint32 internal_PRIORITY_LOWAT;
+			uint32 external_PRIORITY_LOWAT;
+
+			// 每次读事件最多处理的包数和字节数， 剩下的排到接收队列， 0表示不限
+			uint32 internal_RECV_BUDGET;
+			uint32 internal_RECV_BUDGET_BYTES;
+			uint32 external_RECV_BUDGET;
+			uint32 external_RECV_BUDGET_BYTES;
+
+			// 按协议名指定发送优先级(SendPriority)， 键为小写的协议名
+			std::map<std::string, int> send_priority;
+
+			// 服务器地址白名单， 支持CIDR(10.0.0.0/8、fd00::/8)、主机名和旧的192.168.1.*写法
 			std::vector<std::string> server_addresses;
 
 			bool debugPacket;
@@ -103,6 +222,57 @@ namespace XServer {
 
 			int threads;
 
+			// 外部网络额外的事件循环线程数， 0表示所有socket都在主循环上
+			int external_loops;
+
+			// 合并同一轮事件循环中的写入， 每轮末尾每个socket只写一次
+			bool internal_corking;
+			bool external_corking;
+
+			// 本端支持的包体压缩算法(PacketCompression)， 与对端在Hello中协商
+			int internal_COMPRESS;
+			int external_COMPRESS;
+
+			// 包体达到此长度才尝试压缩
+			uint32 compressThreshold;
+
+			// 压缩字典文件(相对于资源目录)， compressDictTrain开启时退出前重新生成
+			std::string compressDict;
+			bool compressDictTrain;
+
+			// 转发的包合并成一帧， 达到此长度或本轮事件循环结束时发出， 0表示不合并
+			uint32 internal_BATCH_MAX;
+			uint32 external_BATCH_MAX;
+
+			// netEncrypted开启时本端选择的加密算法(CipherType)， 对端不支持时按明文通信
+			int internal_ENCRYPT;
+			int external_ENCRYPT;
+
+			// 同一台机器上的服务器之间改用共享内存， 每个方向环形缓冲区的长度， 0表示只用TCP
+			uint32 internal_SHM_RING;
+
+			// 主动连接其他服务器时每个对端建立的并行连接数， 玩家按请求者ID分到其中一条
+			int internal_LINKS;
+
+			// socket收发的后端(IOBackend)， io_uring时每个事件循环的提交队列长度和接收缓冲区个数、大小
+			int ioBackend;
+			uint32 uringEntries;
+			uint32 uringBuffers;
+			uint32 uringBufferSize;
+
+			// socket收发缓冲区内存池的块大小和最多申请的块数， 块大小为0时不使用内存池
+			uint32 ioChunkSize;
+			uint32 ioChunkMax;
+
+			// 创建event_base的参数(LoopConfig)， 默认和event_base_new()相同
+			std::string eventBackend;
+			bool eventEdgeTriggered;
+			bool eventChangelist;
+			bool eventNoLock;
+			bool eventPreciseTimer;
+			int eventMaxDispatch;
+			int eventDispatchIntervalUs;
+
 			int player_disconnected_lifetime;
 
 			std::string db_name;
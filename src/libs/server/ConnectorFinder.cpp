@@ -17,7 +17,7 @@ namespace XServer {
 //-------------------------------------------------------------------------------------
 ConnectorFinder::ConnectorFinder(XServerBase* pServer):
 pXServer_(pServer),
-timerEvent_(NULL),
+timerEvent_(TIMER_HANDLE_INVALID),
 connectorInfos_(),
 found_(NULL),
 attempt_(0)
@@ -31,7 +31,7 @@ ConnectorFinder::~ConnectorFinder()
 	if (timerEvent_)
 	{
 		pXServer_->pTimer()->delTimer(timerEvent_);
-		timerEvent_ = NULL;
+		timerEvent_ = TIMER_HANDLE_INVALID;
 	}
 
 	if (!found_)
@@ -39,7 +39,7 @@ ConnectorFinder::~ConnectorFinder()
 		ERROR_MSG(fmt::format("ConnectorFinder::~ConnectorFinder(): timeout! not found connector!\n"));
 
 		if (pXServer_)
-			pXServer_->shutDown(FINDER_TICK_TIME * 2/*timerEvent_*/);
+			pXServer_->shutDown(FINDER_TICK_TIME * 2/*必须大于timerEvent_*/);
 	}
 	else
 	{
@@ -102,9 +102,9 @@ void ConnectorFinder::onFindingTick(void* userargs)
 	if (!pServerInfo || !pServerInfo->pSession || !pServerInfo->pSession->connected())
 		return;
 
-	// ٲѯ2Σ һκͱβѯõconnectorһconnectorѾϣʱԿʼѡ
+	// 最少查询2次， 如果上一次和本次查询获得的connector数量一致则假设所有connector已经启动完毕，此时可以开始计算最优选择了
 	CMD_QueryServerInfos req_packet;
-	// Ϊ0ʾƲѯ
+	// 设置为0表示不限制查询
 	req_packet.set_appid(0);
 	req_packet.set_appgid(pXServer_->gid());
 	req_packet.set_apptype((int32)ServerType::SERVER_TYPE_CONNECTOR);
@@ -155,11 +155,11 @@ void ConnectorFinder::onTestingTick(void* userargs)
 		}
 	}
 
-	// ûеõеpingֵôȴһβ
+	// 如果没有得到所有的ping值，那么继续等待下一次测试
 	if (!alltested)
 		return;
 
-	// õpingֵ֮ Сģۺжѡ󶨵
+	// 得到ping值之后， 获得最小的，并且综合判断他的连接数量再选择绑定到哪里
 	found_ = calcBestServer();
 	if (!found_)
 		return;
@@ -203,7 +203,7 @@ ServerInfo* ConnectorFinder::calcBestServer()
 
 	ServerInfo* pServerInfo = NULL;
 	
-	// ȽСĲҳ
+	// 先将最小的查找出来
 	for (auto& item : connectorInfos_)
 	{
 		if (!pServerInfo || item->pSession->getRoundTripTime() < pServerInfo->pSession->getRoundTripTime())
@@ -214,7 +214,7 @@ ServerInfo* ConnectorFinder::calcBestServer()
 
 	std::vector<ServerInfo*> groups_;
 
-	// ȻrttΧֵƵγһ
+	// 然后获得rtt范围值相似的形成一组
 	for (auto& item : connectorInfos_)
 	{
 		if (item->pSession->getRoundTripTime() - pServerInfo->pSession->getRoundTripTime() <= ResMgr::getSingleton().serverConfig().tickInterval)
@@ -223,7 +223,7 @@ ServerInfo* ConnectorFinder::calcBestServer()
 		}
 	}
 
-	// ٴһаsessionNum϶һС
+	// 再从一组中按照sessionNum来断定一个最小的
 	for (auto& item : connectorInfos_)
 	{
 		if (item->sessionNum < pServerInfo->sessionNum)
@@ -2,6 +2,7 @@
 #define X_CONNECTOR_FINDER_H
 
 #include "common/common.h"
+#include "event/Timer.h"
 #include "protos/Commands.pb.h"
 
 namespace XServer {
@@ -29,7 +30,7 @@ public:
 protected:
 	XServerBase* pXServer_;
 
-	struct event * timerEvent_;
+	TimerHandle timerEvent_;
 
 	std::vector<ServerInfo*> connectorInfos_;
 
@@ -11,13 +11,79 @@
 
 namespace XServer {
 
+//-------------------------------------------------------------------------------------
+Session* ServerInfo::link(uint64 requestorID) const
+{
+	if (links.empty())
+		return pSession;
+
+	// session ID的低位是循环和槽位， 先打散再取模
+	size_t num = links.size() + 1;
+	size_t home = (size_t)((requestorID * 11400714819323198485ull) >> 32) % num;
+
+	for (size_t i = 0; i < num; ++i)
+	{
+		size_t index = (home + i) % num;
+
+		if (index == 0)
+		{
+			if (pSession && pSession->connected())
+				return pSession;
+
+			continue;
+		}
+
+		const ServerLink& item = links[index - 1];
+		if (item.pSession && item.ready && item.pSession->connected())
+			return item.pSession;
+	}
+
+	return pSession;
+}
+
+//-------------------------------------------------------------------------------------
+int ServerInfo::linksUp() const
+{
+	int num = (pSession && pSession->connected()) ? 1 : 0;
+
+	for (auto& item : links)
+	{
+		if (item.pSession && item.ready && item.pSession->connected())
+			++num;
+	}
+
+	return num;
+}
+
+//-------------------------------------------------------------------------------------
+std::string ServerInfo::linksInfo() const
+{
+	std::string info = fmt::format("links={}/{}", linksUp(), links.size() + 1);
+
+	for (size_t i = 0; i <= links.size(); ++i)
+	{
+		Session* pLink = (i == 0) ? pSession : links[i - 1].pSession;
+
+		if (!pLink || !pLink->connected() || (i > 0 && !links[i - 1].ready))
+		{
+			info += fmt::format(", {}(down)", i);
+			continue;
+		}
+
+		info += fmt::format(", {}(queue={}, rtt={}{})", i, pLink->sendQueueLength(), pLink->getRoundTripTime(),
+			pLink->isSendQueueFull() ? ", stalled" : "");
+	}
+
+	return info;
+}
+
 //-------------------------------------------------------------------------------------
 ServerMgr::ServerMgr(XServerBase* pServer):
 srv_infos_(),
 interestedServerTypes_(),
 interestedServerIDs_(),
 pXServer_(pServer),
-timerEvent_(NULL)
+timerEvent_(TIMER_HANDLE_INVALID)
 {
 	timerEvent_ = pXServer_->pTimer()->addTimer(TIME_SECONDS, -1, std::bind(&ServerMgr::onTick, this, std::placeholders::_1), NULL);
 }
@@ -28,7 +94,7 @@ srv_infos_(),
 interestedServerTypes_(srvTypes),
 interestedServerIDs_(),
 pXServer_(pServer),
-timerEvent_(NULL)
+timerEvent_(TIMER_HANDLE_INVALID)
 {
 	timerEvent_ = pXServer_->pTimer()->addTimer(TIME_SECONDS, -1, std::bind(&ServerMgr::onTick, this, std::placeholders::_1), NULL);
 }
@@ -85,6 +151,12 @@ ServerInfo* ServerMgr::findServer(Session* pSession)
 		{
 			return &info;
 		}
+
+		for (auto& link : info.links)
+		{
+			if (link.pSession == pSession)
+				return &info;
+		}
 	}
 
 	return NULL;
@@ -172,25 +244,44 @@ Session* ServerMgr::connectServer(std::string ip, uint16 port, ServerType type)
 		return NULL;
 	}
 
-	socket_t sock = -1;
+	// 自己创建socket， 以便在connect之前设置好缓冲区等参数
+	socket_t sock = ::socket(AF_INET, SOCK_STREAM, 0);
+	if (sock != SOCKET_T_INVALID)
+	{
+		evutil_make_socket_nonblocking(sock);
+		pNetworkInterface->socketProfile().apply(sock);
+		pNetworkInterface->reportSocketProfile(sock);
+	}
+
 	Session* pSession = pNetworkInterface->createSession(sock);
+	if (!pSession)
+	{
+		ERROR_MSG(fmt::format("ServerMgr::connectServer(): create session failed!\n"));
+
+		if (sock != SOCKET_T_INVALID)
+			evutil_closesocket(sock);
+
+		return NULL;
+	}
 
 	pSession->appType(type);
 	
 	if (!pSession->pTcpSocket()->isGood())
 	{
 		ERROR_MSG(fmt::format("ServerMgr::connectServer(): socket create error!\n"));
-		delete pSession;
+
+		if (sock != SOCKET_T_INVALID)
+			evutil_closesocket(sock);
+
+		pNetworkInterface->removeSession(pSession->id());
 		return NULL;
 	}
 
 	pSession->isServer(true);
-	pNetworkInterface->addSession(pSession->id(), pSession);
 
 	if (!pSession->initialize())
 	{
 		pNetworkInterface->removeSession(pSession->id());
-		delete pSession;
 		return NULL;
 	}
 
@@ -202,19 +293,17 @@ Session* ServerMgr::connectServer(std::string ip, uint16 port, ServerType type)
 	serverAddr.sin_addr = *((struct in_addr *)host->h_addr);
 	serverAddr.sin_port = htons(port);
 
-	int err = bufferevent_socket_connect(pSession->pTcpSocket()->getBufEvt(), (sockaddr *)&serverAddr, sizeof(serverAddr));
-	if (err != 0)
+	if (!pSession->pTcpSocket()->connect((sockaddr *)&serverAddr, sizeof(serverAddr)))
 	{
 		ERROR_MSG(fmt::format("ServerMgr::connectServer(): connect error! type={}, addr={}:{}\n", 
 			ServerType2Name[(int)type], ip, port));
 
-		// ˴Ӧ٣ Ϊbufferevent_socket_connectᴥ¼Sessionڲ
+		// 此处不应该销毁， 因为bufferevent_socket_connect会触发事件，Session内部会销毁
 		//delete pSession;
 
 		return NULL;
 	}
 
-	pNetworkInterface->addSession(pSession->id(), pSession);
 	return pSession;
 }
 
@@ -245,20 +334,13 @@ void ServerMgr::onTick(void* userargs)
 		}
 		else
 		{
-			// ȴȡԷϢ
+			// 等待获取对方进程信息
 			if (srvInfos->id == 0)
 			{
 				if (srvInfos->pSession && srvInfos->pSession->connected() && !srvInfos->sent_hello)
 				{
 					srvInfos->sent_hello = true;
-
-					CMD_Hello req_packet;
-					req_packet.set_version(XPLATFORMSERVER_VERSION);
-					req_packet.set_appid(pXServer_->id());
-					req_packet.set_apptype((int32)pXServer_->type());
-					req_packet.set_appgid((int32)pXServer_->gid());
-					req_packet.set_name(pXServer_->name());
-					srvInfos->pSession->sendPacket(CMD::Hello, req_packet);
+					sendHello(srvInfos->pSession, 0);
 				}
 
 				return;
@@ -283,15 +365,10 @@ void ServerMgr::onTick(void* userargs)
 			if (srvInfos->pSession->connected() && !srvInfos->sent_hello)
 			{
 				srvInfos->sent_hello = true;
-
-				CMD_Hello req_packet;
-				req_packet.set_version(XPLATFORMSERVER_VERSION);
-				req_packet.set_appid(pXServer_->id());
-				req_packet.set_apptype((int32)pXServer_->type());
-				req_packet.set_appgid((int32)pXServer_->gid());
-				req_packet.set_name(pXServer_->name());
-				srvInfos->pSession->sendPacket(CMD::Hello, req_packet);
+				sendHello(srvInfos->pSession, 0);
 			}
+
+			updateLinks(srvInfos);
 		}
 		else
 		{
@@ -328,12 +405,48 @@ void ServerMgr::onHeartbeatTick()
 		CMD_Heartbeat req_packet;
 		req_packet.set_appid(pXServer_->id());
 		info.pSession->sendPacket(CMD::Heartbeat, req_packet);
+
+		if (info.links.empty())
+			continue;
+
+		// 并行连接也定时ping， 各自的rtt和发送队列一起组成整体状态
+		bool stalled = info.pSession->isSendQueueFull();
+		info.pSession->ping();
+
+		for (auto& link : info.links)
+		{
+			if (!link.pSession || !link.ready || !link.pSession->connected())
+				continue;
+
+			link.pSession->sendPacket(CMD::Heartbeat, req_packet);
+			link.pSession->ping();
+			stalled = stalled || link.pSession->isSendQueueFull();
+		}
+
+		if (stalled || info.linksUp() < (int)info.links.size() + 1)
+		{
+			WARNING_MSG(fmt::format("ServerMgr::onHeartbeatTick(): {}, appID={}, {}\n",
+				ServerType2Name[(int)info.type], info.id, info.linksInfo()));
+		}
 	}
 }
 
 //-------------------------------------------------------------------------------------
 void ServerMgr::onSessionConnected(Session* pSession)
 {
+	for (auto& item : srv_infos_)
+	{
+		ServerInfo& info = item.second;
+
+		for (size_t i = 0; i < info.links.size(); ++i)
+		{
+			if (info.links[i].pSession == pSession)
+			{
+				sendHello(pSession, (uint32)i + 1);
+				return;
+			}
+		}
+	}
 }
 
 //-------------------------------------------------------------------------------------
@@ -348,8 +461,35 @@ void ServerMgr::onSessionDisconnected(Session* pSession)
 
 		if (info.pSession && info.pSession == pSession)
 		{
+			// 主连接断开视为服务器退出， 并行连接随之关闭
+			std::vector<ServerLink> links;
+			links.swap(info.links);
+
 			pXServer_->onServerExit(&info);
 			srv_infos_.erase(info.id);
+
+			for (auto& link : links)
+			{
+				if (link.pSession)
+					link.pSession->destroy();
+			}
+
+			return;
+		}
+
+		for (auto& link : info.links)
+		{
+			if (link.pSession != pSession)
+				continue;
+
+			// 只有分到这条连接上的玩家需要换到其他连接， 下一次onTick重新连接
+			link.pSession = NULL;
+			link.ready = false;
+
+			WARNING_MSG(fmt::format("ServerMgr::onSessionDisconnected(): lost a link to {}, appID={}, {}\n",
+				ServerType2Name[(int)info.type], info.id, info.linksInfo()));
+
+			pXServer_->onServerLinkLost(&info, pSession);
 			return;
 		}
 	}
@@ -358,6 +498,14 @@ void ServerMgr::onSessionDisconnected(Session* pSession)
 //-------------------------------------------------------------------------------------
 void ServerMgr::onSessionHello(Session* pSession, const CMD_Hello& packet)
 {
+	if (packet.link() > 0)
+	{
+		if (!attachLink(pSession, packet))
+			pSession->destroy();
+
+		return;
+	}
+
 	ServerInfo info;
 	info.internal_ip = pSession->getIP();
 	info.internal_port = pSession->getPort();
@@ -365,6 +513,7 @@ void ServerMgr::onSessionHello(Session* pSession, const CMD_Hello& packet)
 	info.gid = packet.appgid();
 	info.name = packet.name();
 	info.type = (ServerType)packet.apptype();
+	info.hostID = packet.hostid();
 	info.pSession = pSession;
 
 	if (info.pSession)
@@ -376,12 +525,29 @@ void ServerMgr::onSessionHello(Session* pSession, const CMD_Hello& packet)
 //-------------------------------------------------------------------------------------
 void ServerMgr::onSessionHelloCB(Session* pSession, const CMD_HelloCB& packet)
 {
+	for (auto& item : srv_infos_)
+	{
+		for (auto& link : item.second.links)
+		{
+			if (link.pSession != pSession)
+				continue;
+
+			link.ready = true;
+
+			INFO_MSG(fmt::format("ServerMgr::onSessionHelloCB(): link to {} is ready, appID={}, {}\n",
+				ServerType2Name[(int)item.second.type], item.second.id, item.second.linksInfo()));
+
+			return;
+		}
+	}
+
 	for (auto& item : srv_infos_)
 	{
 		ServerInfo info = item.second;
 
 		if (info.pSession && info.pSession == pSession)
 		{
+			info.recv_hellocb = true;
 			info.id = packet.appid();
 			info.gid = packet.appgid();
 			info.name = packet.name();
@@ -407,6 +573,100 @@ void ServerMgr::onSessionHelloCB(Session* pSession, const CMD_HelloCB& packet)
 	}
 }
 
+//-------------------------------------------------------------------------------------
+void ServerMgr::sendHello(Session* pSession, uint32 link)
+{
+	CMD_Hello req_packet;
+	req_packet.set_version(XPLATFORMSERVER_VERSION);
+	req_packet.set_appid(pXServer_->id());
+	req_packet.set_apptype((int32)pXServer_->type());
+	req_packet.set_appgid((int32)pXServer_->gid());
+	req_packet.set_name(pXServer_->name());
+	pSession->prepareHello(req_packet);
+
+	// 并行连接只为分散TCP的队头阻塞， 不再使用共享内存
+	if (link > 0)
+	{
+		req_packet.set_link(link);
+		req_packet.clear_hostid();
+	}
+
+	pSession->sendPacket(CMD::Hello, req_packet);
+}
+
+//-------------------------------------------------------------------------------------
+void ServerMgr::updateLinks(ServerInfo* pServerInfo)
+{
+	int num = ResMgr::getSingleton().serverConfig().internal_LINKS;
+	if (num <= 1 || !pServerInfo->pSession || !pServerInfo->sent_hello || !pServerInfo->recv_hellocb)
+		return;
+
+	// 主连接已经走共享内存时没有队头阻塞
+	if (!pServerInfo->pSession->connected() || pServerInfo->pSession->pTcpSocket()->hasShm())
+		return;
+
+	if (pServerInfo->links.size() != (size_t)num - 1)
+		pServerInfo->links.resize(num - 1);
+
+	for (auto& link : pServerInfo->links)
+	{
+		if (link.pSession)
+			continue;
+
+		// 连接成功后在onSessionConnected中发送Hello
+		link.ready = false;
+		link.pSession = connectServer(pServerInfo->internal_ip, pServerInfo->internal_port, pServerInfo->type);
+		if (link.pSession)
+			link.pSession->appID(pServerInfo->id);
+	}
+}
+
+//-------------------------------------------------------------------------------------
+bool ServerMgr::attachLink(Session* pSession, const CMD_Hello& packet)
+{
+	// 主连接的Hello一定先处理完， 对端收到HelloCB之后才建立并行连接
+	ServerInfo* pServerInfo = findServer(packet.appid());
+	if (!pServerInfo || !pServerInfo->pSession || pServerInfo->type != (ServerType)packet.apptype())
+	{
+		ERROR_MSG(fmt::format("ServerMgr::attachLink(): not found the main link of appID={}, link={}, addr={}!\n",
+			packet.appid(), packet.link(), pSession->addr()));
+
+		return false;
+	}
+
+	if (packet.link() > 64)
+	{
+		ERROR_MSG(fmt::format("ServerMgr::attachLink(): too many links! appID={}, link={}, addr={}!\n",
+			packet.appid(), packet.link(), pSession->addr()));
+
+		return false;
+	}
+
+	if (pServerInfo->links.size() < packet.link())
+		pServerInfo->links.resize(packet.link());
+
+	// 对端重连时旧的连接可能还没有检测到断开
+	ServerLink& link = pServerInfo->links[packet.link() - 1];
+	if (link.pSession && link.pSession != pSession)
+	{
+		Session* pOldLink = link.pSession;
+		link.pSession = NULL;
+		link.ready = false;
+
+		pXServer_->onServerLinkLost(pServerInfo, pOldLink);
+		pOldLink->destroy();
+	}
+
+	pSession->appID(pServerInfo->id);
+	link.pSession = pSession;
+	link.ready = true;
+
+	INFO_MSG(fmt::format("ServerMgr::attachLink(): {}, appID={}, {}\n",
+		ServerType2Name[(int)pServerInfo->type], pServerInfo->id, pServerInfo->linksInfo()));
+
+	return true;
+}
+
 //-------------------------------------------------------------------------------------
 void ServerMgr::dumpToProtobuf(CMD_UpdateServerInfos& infos)
 {
@@ -426,6 +686,7 @@ void ServerMgr::dumpToProtobuf(CMD_UpdateServerInfos& infos)
 		pCMD_UpdateServerInfos->set_internal_port(info.internal_port);
 		pCMD_UpdateServerInfos->set_external_ip(info.external_ip);
 		pCMD_UpdateServerInfos->set_external_port(info.external_port);
+		pCMD_UpdateServerInfos->set_hostid(info.hostID);
 	}
 }
 
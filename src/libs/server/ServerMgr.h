@@ -2,6 +2,7 @@
 #define X_SERVER_MGR_H
 
 #include "common/common.h"
+#include "event/Timer.h"
 #include "protos/Commands.pb.h"
 
 namespace XServer {
@@ -9,6 +10,21 @@ namespace XServer {
 class XServerBase;
 class Session;
 
+// 主连接之外到同一个服务器的一条并行连接
+struct ServerLink
+{
+	ServerLink():
+	pSession(NULL),
+	ready(false)
+	{
+	}
+
+	Session* pSession;
+
+	// 握手完成之后才分配玩家
+	bool ready;
+};
+
 struct ServerInfo
 {
 	ServerInfo()
@@ -21,14 +37,25 @@ struct ServerInfo
 		internal_port = 0;
 		external_ip = "";
 		external_port = 0;
+		hostID = "";
 		type = ServerType::SERVER_TYPE_UNKNOWN;
 		load = 0.f;
 		playerNum = 0;
 		sessionNum = 0;
 		sent_hello = false;
+		recv_hellocb = false;
 		reconnectionNum = 0;
 	}
 
+	// 请求者所在的连接， 按ID固定分到其中一条， 那条不可用时顺延到下一条
+	Session* link(uint64 requestorID) const;
+
+	// 可用的连接数， 包括主连接
+	int linksUp() const;
+
+	// 所有连接合并后的状态
+	std::string linksInfo() const;
+
 	ServerAppID id;
 	ServerGroupID gid;
 	ServerType type;
@@ -39,11 +66,19 @@ struct ServerInfo
 	std::string external_ip;
 	uint16 internal_port;
 	uint16 external_port;
+
+	// 所在机器的标识， 与本机相同时链路可以使用共享内存
+	std::string hostID;
+
 	float load;
 	int playerNum;
 	int sessionNum;
 	bool sent_hello;
+	bool recv_hellocb;
 	int reconnectionNum;
+
+	// 主连接之外的并行连接， 下标加1为Hello中的link序号， 断开的位置保留为空
+	std::vector<ServerLink> links;
 	std::map<ServerAppID, ServerInfo> child_srvs;
 };
 
@@ -84,8 +119,15 @@ public:
 	void onSessionHello(Session* pSession, const CMD_Hello& packet);
 	void onSessionHelloCB(Session* pSession, const CMD_HelloCB& packet);
 
+	// 主动连接的一方补齐到按ID关注的服务器(例如connector)的并行连接
+	void updateLinks(ServerInfo* pServerInfo);
+
 	void dumpToProtobuf(CMD_UpdateServerInfos& infos);
 
+protected:
+	void sendHello(Session* pSession, uint32 link);
+	bool attachLink(Session* pSession, const CMD_Hello& packet);
+
 protected:
 	std::map<ServerAppID, ServerInfo> srv_infos_;
 
@@ -94,7 +136,7 @@ protected:
 
 	XServerBase* pXServer_;
 
-	struct event * timerEvent_;
+	TimerHandle timerEvent_;
 };
 
 }
@@ -4,6 +4,10 @@
 #include "event/EventDispatcher.h"
 #include "event/NetworkInterface.h"
 #include "event/Session.h"
+#include "event/PacketHandlers.h"
+#include "event/PacketCompressor.h"
+#include "event/BufferPool.h"
+#include "event/ShmChannel.h"
 #include "event/Timer.h"
 #include "resmgr/ResMgr.h"
 #include "common/threadpool.h"
@@ -26,10 +30,10 @@ XServerBase::XServerBase():
 	state_(SERVER_STATE_INIT),
 	pServerMgr_(NULL),
 	pTimer_(NULL),
-	shuttingdownTimerEvent_(NULL),
-	shutdownExpiredTimerEvent_(NULL),
-	tickTimerEvent_(NULL),
-	heartbeatTickTimerEvent_(NULL),
+	shuttingdownTimerEvent_(TIMER_HANDLE_INVALID),
+	shutdownExpiredTimerEvent_(TIMER_HANDLE_INVALID),
+	tickTimerEvent_(TIMER_HANDLE_INVALID),
+	heartbeatTickTimerEvent_(TIMER_HANDLE_INVALID),
 	pThreadPool_(NULL)
 {
 	GOOGLE_PROTOBUF_VERIFY_VERSION;
@@ -219,14 +223,31 @@ bool XServerBase::initialize(ServerAppID appID, ServerType appType, ServerGroupI
 	assert(!pThreadPool_);
 	pThreadPool_ = new ThreadPool(ResMgr::getSingleton().serverConfig().threads);
 
+	// 外部网络使用多个事件循环时， 循环之间需要跨线程投递任务
+	if (ResMgr::getSingleton().serverConfig().external_loops > 0 && ResMgr::getSingleton().serverConfig().external_ip.size() > 0)
+	{
+		if (!EventDispatcher::enableThreads())
+			return false;
+	}
+
+	// socket在创建时决定是否读到池中的块里
+	BufferPool::setup(ResMgr::getSingleton().serverConfig().ioChunkSize, ResMgr::getSingleton().serverConfig().ioChunkMax);
+
 	pEventDispatcher_ = new EventDispatcher();
-	if (!pEventDispatcher_->initialize())
+	if (!pEventDispatcher_->initialize(LoopConfig::fromConfig()))
 	{
 		ERROR_MSG(fmt::format("XServerBase::initialize(): pEventDispatcher initialization error!\n"));
 		return false;
 	}
 
+	INFO_MSG(fmt::format("XServerBase::initialize(): event loop: {}, config({})\n",
+		pEventDispatcher_->backendInfo(), LoopConfig::fromConfig().info()));
+
+	if (!PacketCompressor::initialize())
+		return false;
+
 	pInternalNetworkInterface_ = createNetworkInterface(pEventDispatcher_, true);
+	pInternalNetworkInterface_->corking(ResMgr::getSingleton().serverConfig().internal_corking);
 	if (!pInternalNetworkInterface_->initialize(ResMgr::getSingleton().serverConfig().internal_ip, ResMgr::getSingleton().serverConfig().internal_port))
 	{
 		ERROR_MSG(fmt::format("XServerBase::initialize(): InternalNetworkInterface initialization error!\n"));
@@ -236,14 +257,17 @@ bool XServerBase::initialize(ServerAppID appID, ServerType appType, ServerGroupI
 	if (ResMgr::getSingleton().serverConfig().external_ip.size() > 0)
 	{
 		pExternalNetworkInterface_ = createNetworkInterface(pEventDispatcher_, false);
-		if (!pExternalNetworkInterface_->initialize(ResMgr::getSingleton().serverConfig().external_ip, ResMgr::getSingleton().serverConfig().external_port))
+		pExternalNetworkInterface_->corking(ResMgr::getSingleton().serverConfig().external_corking);
+		if (!pExternalNetworkInterface_->initialize(ResMgr::getSingleton().serverConfig().external_ip, ResMgr::getSingleton().serverConfig().external_port,
+			ResMgr::getSingleton().serverConfig().external_loops))
 		{
 			ERROR_MSG(fmt::format("XServerBase::initialize(): ExternalNetworkInterface initialization error!\n"));
 			return false;
 		}
 	}
 
-	pTimer_ = new Timer(pEventDispatcher_);
+	// 逻辑定时器排在服务器之间的连接之后、 客户端之前
+	pTimer_ = new Timer(pEventDispatcher_, 10, EVENT_PRIORITY_TIMER);
 	tickTimerEvent_ = pTimer_->addTimer(std::max<uint64>(1, ResMgr::getSingleton().serverConfig().tickInterval), -1, std::bind(&XServerBase::onTick, this, std::placeholders::_1), NULL);
 	heartbeatTickTimerEvent_ = pTimer_->addTimer(std::max<uint64>(TIME_SECONDS, ResMgr::getSingleton().serverConfig().heartbeatInterval), -1, std::bind(&XServerBase::onHeartbeatTick, this, std::placeholders::_1), NULL);
 
@@ -280,6 +304,15 @@ void XServerBase::finalise(void)
 	if (pInternalNetworkInterface_)
 		pInternalNetworkInterface_->finalise();
 
+	PacketHandlers::dumpStats();
+	PacketCompressor::finalise();
+
+	if (pEventDispatcher_)
+		INFO_MSG(fmt::format("XServerBase::finalise(): event priority wait: {}\n", pEventDispatcher_->priorityWaitInfo()));
+
+	if (BufferPool::enabled())
+		INFO_MSG(fmt::format("XServerBase::finalise(): buffer pool: {}\n", BufferPool::info()));
+
 	for (auto& item : signals_)
 	{
 		pEventDispatcher_->del_watch_signal(item);
@@ -294,13 +327,13 @@ void XServerBase::finalise(void)
 	if (tickTimerEvent_)
 	{
 		pTimer()->delTimer(tickTimerEvent_);
-		tickTimerEvent_ = NULL;
+		tickTimerEvent_ = TIMER_HANDLE_INVALID;
 	}
 
 	if (heartbeatTickTimerEvent_)
 	{
 		pTimer()->delTimer(heartbeatTickTimerEvent_);
-		heartbeatTickTimerEvent_ = NULL;
+		heartbeatTickTimerEvent_ = TIMER_HANDLE_INVALID;
 	}
 
 	SAFE_RELEASE(pTimer_);
@@ -353,12 +386,6 @@ void XServerBase::onHeartbeatTick(void* userargs)
 {
 	//INFO_MSG(fmt::format("XServerBase::onHeartbeatTick()\n"));
 
-	if(pExternalNetworkInterface_)
-		pExternalNetworkInterface_->checkSessions();
-
-	if (pInternalNetworkInterface_)
-		pInternalNetworkInterface_->checkSessions();
-
 	if(pServerMgr_)
 		pServerMgr_->onHeartbeatTick();
 }
@@ -419,6 +446,17 @@ void XServerBase::onServerExit(ServerInfo* pServerInfo)
 		pServerInfo->name, pServerInfo->pSession->addr()));
 }
 
+//-------------------------------------------------------------------------------------
+void XServerBase::onServerLinkLost(ServerInfo* pServerInfo, Session* pLink)
+{
+}
+
+//-------------------------------------------------------------------------------------
+bool XServerBase::onSessionSendQueueFull(Session* pSession, bool full)
+{
+	return false;
+}
+
 //-------------------------------------------------------------------------------------
 void XServerBase::updateServerInfoToSession(Session* pSession)
 {
@@ -434,6 +472,7 @@ void XServerBase::updateServerInfoToSession(Session* pSession)
 	req_packet.set_internal_port(pInternalNetworkInterface_->getListenerPort());
 	req_packet.set_external_ip(ResMgr::getSingleton().serverConfig().external_exposedIP);
 	req_packet.set_external_port(pExternalNetworkInterface_->getListenerPort());
+	req_packet.set_hostid(ShmChannel::hostID());
 
 	pServerMgr_->dumpToProtobuf(req_packet);
 
@@ -465,6 +504,7 @@ void XServerBase::onSessionUpdateServerInfos(Session* pSession, const CMD_Update
 	pServerInfo->internal_port = packet.internal_port();
 	pServerInfo->external_ip = packet.external_ip();
 	pServerInfo->external_port = packet.external_port();
+	pServerInfo->hostID = packet.hostid();
 	pServerInfo->load = packet.load();
 	pServerInfo->playerNum = packet.playernum();
 	pServerInfo->sessionNum = packet.sessionnum();
@@ -490,6 +530,7 @@ void XServerBase::onSessionUpdateServerInfos(Session* pSession, const CMD_Update
 		serverInfo.internal_port = infos.internal_port();
 		serverInfo.external_ip = infos.external_ip();
 		serverInfo.external_port = infos.external_port();
+		serverInfo.hostID = infos.hostid();
 		serverInfo.load = infos.load();
 		serverInfo.playerNum = infos.playernum();
 		serverInfo.sessionNum = infos.sessionnum();
@@ -532,6 +573,7 @@ void XServerBase::onSessionQueryServerInfos(Session* pSession, const CMD_QuerySe
 		pUpdateServerInfos->set_internal_port(item->internal_port);
 		pUpdateServerInfos->set_external_ip(item->external_ip);
 		pUpdateServerInfos->set_external_port(item->external_port);
+		pUpdateServerInfos->set_hostid(item->hostID);
 		pUpdateServerInfos->set_load(item->load);
 		pUpdateServerInfos->set_playernum(item->playerNum);
 		pUpdateServerInfos->set_sessionnum(item->sessionNum);
@@ -566,6 +608,7 @@ void XServerBase::onSessionQueryServerInfosCB(Session* pSession, const CMD_Query
 		pServerInfo->external_port = infos.external_port();
 		pServerInfo->internal_ip = infos.internal_ip();
 		pServerInfo->internal_port = infos.internal_port();
+		pServerInfo->hostID = infos.hostid();
 		pServerInfo->load = infos.load();
 		pServerInfo->playerNum = infos.playernum();
 		pServerInfo->sessionNum = infos.sessionnum();
@@ -2,6 +2,7 @@
 #define X_SERVER_BASE_H
 
 #include "common/common.h"
+#include "event/Timer.h"
 #include "common/singleton.h"
 #include "protos/ServerCommon.pb.h"
 #include "protos/Commands.pb.h"
@@ -11,7 +12,6 @@ namespace XServer {
 class EventDispatcher;
 class NetworkInterface;
 class ServerMgr;
-class Timer;
 class Session;
 struct ServerInfo;
 class ThreadPool;
@@ -130,6 +130,13 @@ public:
 	virtual void onServerJoined(ServerInfo* pServerInfo);
 	virtual void onServerExit(ServerInfo* pServerInfo);
 
+	// 到该服务器的一条并行连接断开， 服务器本身仍然在线， 绑定在这条连接上的玩家需要换到pServerInfo->link()
+	virtual void onServerLinkLost(ServerInfo* pServerInfo, Session* pLink);
+
+	// PAUSE_UPSTREAM策略下session的发送队列满了/降回低水位， 在session所属的循环中调用
+	// 返回true表示已经暂停/恢复了往它写数据的session， 返回false时session暂停/恢复读取对端
+	virtual bool onSessionSendQueueFull(Session* pSession, bool full);
+
 	virtual void onSessionUpdateServerInfos(Session* pSession, const CMD_UpdateServerInfos& packet);
 	virtual void onSessionQueryServerInfos(Session* pSession, const CMD_QueryServerInfos& packet);
 	virtual void onSessionQueryServerInfosCB(Session* pSession, const CMD_QueryServerInfosCB& packet);
@@ -141,7 +148,7 @@ protected:
 
 	std::vector<struct event *> signals_;
 
-	// ΨһID
+	// 服务器唯一ID
 	ServerAppID id_;
 	ServerGroupID gid_;
 	ServerType type_;
@@ -149,16 +156,16 @@ protected:
 
 	ServerState state_;
 
-	// 
+	// 其他服务器
 	ServerMgr* pServerMgr_;
 
 	Timer* pTimer_;
 
-	struct event * shuttingdownTimerEvent_;
-	struct event * shutdownExpiredTimerEvent_;
+	TimerHandle shuttingdownTimerEvent_;
+	TimerHandle shutdownExpiredTimerEvent_;
 
-	struct event * tickTimerEvent_;
-	struct event * heartbeatTickTimerEvent_;
+	TimerHandle tickTimerEvent_;
+	TimerHandle heartbeatTickTimerEvent_;
 
 	ThreadPool* pThreadPool_;
 };
@@ -4,12 +4,17 @@
 #include "server/ServerMgr.h"
 #include "protos/Commands.pb.h"
 #include "event/Session.h"
+#include "event/NetworkInterface.h"
+#include "event/EventDispatcher.h"
+#include "log/XLog.h"
 
 namespace XServer {
 
 //-------------------------------------------------------------------------------------
 XServerApp::XServerApp():
-mapBackendSessionNums_()
+mapBackendSessionNums_(),
+clientBackends_(),
+pausedClients_()
 {
 }
 
@@ -51,13 +56,13 @@ void XServerApp::onServerJoined(ServerInfo* pServerInfo)
 	if (!pServerMgr_)
 		return;
 
-	// ҵĿ¼
+	// 找到目录服
 	ServerInfo* pDirServerInfo = pServerMgr_->findDirectory();
 	if (!pDirServerInfo || !pDirServerInfo->pSession || !pDirServerInfo->pSession->connected() 
 		|| !pServerInfo || !pServerInfo->pSession || !pServerInfo->pSession->connected())
 		return;
 
-	// ֻз뵽ỵ́ͽµ״̬¹ȥ
+	// 只有有服务器加入到该进程，就将最新的状态更新过去
 	updateServerInfoToSession(pDirServerInfo->pSession);
 }
 
@@ -68,52 +73,136 @@ void XServerApp::onSessionConnected(Session* pSession)
 }
 
 //-------------------------------------------------------------------------------------
-void XServerApp::onServerExit(ServerInfo* pServerInfo)
+bool XServerApp::onSessionSendQueueFull(Session* pSession, bool full)
 {
-	XServerBase::onServerExit(pServerInfo);
+	// 客户端的队列满时暂停读取它自己的请求， 后端推送的包由两倍上限限制；
+	// 暂停整条后端连接会拖住绑定在上面的所有其他客户端
+	if (!pSession->isServer())
+		return XServerBase::onSessionSendQueueFull(pSession, full);
 
-	if (this->pInternalNetworkInterface())
+	// 后端连接都在主循环上， 自己继续读取后端发来的数据， 不会和后端互相等待
+	if (!full)
 	{
-		NetworkInterface::SessionMap& sessions = pInternalNetworkInterface()->sessions();
-		for (auto& item : sessions)
-		{
-			if (((XSession*)item.second)->pBackendSession() == pServerInfo->pSession)
-			{
-				((XSession*)item.second)->onLoseBackendSession();
-			}
-		}
+		resumeClients(pSession);
+		return true;
+	}
+
+	int num = 0;
+
+	for (auto& item : clientBackends_)
+	{
+		if (item.second.pSession != pSession || !pausedClients_.insert(item.first).second)
+			continue;
+
+		pauseClient(item.first, true);
+		++num;
 	}
 
-	if (this->pExternalNetworkInterface())
+	WARNING_MSG(fmt::format("XServerApp::onSessionSendQueueFull(): paused {} clients, backend={}, {}\n",
+		num, pSession->typeName(), pSession->addr()));
+
+	return true;
+}
+
+//-------------------------------------------------------------------------------------
+void XServerApp::pauseClient(SessionID clientID, bool pause)
+{
+	if (!pExternalNetworkInterface())
+		return;
+
+	pExternalNetworkInterface()->runInSessionLoop(clientID, [pause](Session* pSession) {
+		if (pSession)
+			pSession->pauseRecv(pause);
+	});
+}
+
+//-------------------------------------------------------------------------------------
+void XServerApp::resumeClients(Session* pLink)
+{
+	for (auto iter = pausedClients_.begin(); iter != pausedClients_.end(); )
 	{
-		NetworkInterface::SessionMap& sessions = pExternalNetworkInterface()->sessions();
-		for (auto& item : sessions)
+		auto backend = clientBackends_.find(*iter);
+		Session* pSession = (backend != clientBackends_.end()) ? backend->second.pSession : NULL;
+
+		if (pSession != pLink)
 		{
-			if (((XSession*)item.second)->pBackendSession() == pServerInfo->pSession)
-			{
-				((XSession*)item.second)->onLoseBackendSession();
-			}
+			++iter;
+			continue;
 		}
+
+		pauseClient(*iter, false);
+		iter = pausedClients_.erase(iter);
+	}
+}
+
+//-------------------------------------------------------------------------------------
+void XServerApp::onServerExit(ServerInfo* pServerInfo)
+{
+	XServerBase::onServerExit(pServerInfo);
+
+	std::vector<SessionID> clients;
+	for (auto& item : clientBackends_)
+	{
+		if (item.second.pServerInfo == pServerInfo)
+			clients.push_back(item.first);
+	}
+
+	for (auto& item : clients)
+	{
+		clientBackends_.erase(item);
+		pausedClients_.erase(item);
+
+		if (!this->pExternalNetworkInterface())
+			continue;
+
+		pExternalNetworkInterface()->runInSessionLoop(item, [](Session* pSession) {
+			if (pSession)
+				((XSession*)pSession)->onLoseBackendSession();
+		});
 	}
 
 	if (!pServerMgr_)
 		return;
 
-	// ҵĿ¼
+	// 找到目录服
 	ServerInfo* pDirServerInfo = pServerMgr_->findDirectory();
 	if (!pServerInfo || !pServerInfo->pSession || !pServerInfo->pSession->connected())
 		return;
 
-	// ֻз뵽ỵ́ͽµ״̬¹ȥ
+	// 只有有服务器加入到该进程，就将最新的状态更新过去
 	updateServerInfoToSession(pServerInfo->pSession);
 }
 
 //-------------------------------------------------------------------------------------
-void XServerApp::onSessionBindBackendSession(ServerType type, Session* pSession, uint64 hallsID)
+void XServerApp::onServerLinkLost(ServerInfo* pServerInfo, Session* pLink)
+{
+	XServerBase::onServerLinkLost(pServerInfo, pLink);
+
+	// 换到的连接没有写满时不需要继续暂停， 写满的话下一个包会重新暂停
+	resumeClients(pLink);
+
+	// 只有这条连接上的客户端换到其他连接， 其余客户端不受影响
+	int num = 0;
+
+	for (auto& item : clientBackends_)
+	{
+		if (item.second.pSession != pLink)
+			continue;
+
+		item.second.pSession = pServerInfo->link(item.first);
+		++num;
+	}
+
+	INFO_MSG(fmt::format("XServerApp::onServerLinkLost(): {}, appID={}, moved {} clients, {}\n",
+		ServerType2Name[(int)pServerInfo->type], pServerInfo->id, num, pServerInfo->linksInfo()));
+}
+
+//-------------------------------------------------------------------------------------
+Session* XServerApp::onSessionBindBackendSession(ServerType type, SessionID clientID, uint64 hallsID)
 {
-	// Ự󶨵AppỰ
+	// 将会话绑定到后端App会话
 	if (!pServerMgr_)
-		return;
+		return NULL;
 
 	ServerInfo* bestInfo = NULL;
 
@@ -130,7 +219,7 @@ void XServerApp::onSessionBindBackendSession(ServerType type, Session* pSession,
 
 		std::vector<ServerInfo*> founds;
 
-		// ɲһĶ̬㷨󶨵ĽСapp
+		// 可采用一定的动态均衡算法绑定到消耗较小的app上
 		for (auto& item : infos)
 		{
 			auto iter = mapBackendSessionNums_.find(item->id);
@@ -155,11 +244,138 @@ void XServerApp::onSessionBindBackendSession(ServerType type, Session* pSession,
 	}
 
 	if (!bestInfo)
-		return;
+		return NULL;
+
+	// 因为原来的连接写满而暂停的客户端， 换绑之后由新的连接决定是否暂停
+	if (pausedClients_.erase(clientID) > 0)
+		pauseClient(clientID, false);
 
 	mapBackendSessionNums_[bestInfo->id] += 1;
 
-	((XSession*)pSession)->pBackendSession(bestInfo->pSession);
+	ClientBackend& backend = clientBackends_[clientID];
+	backend.pServerInfo = bestInfo;
+	backend.pSession = bestInfo->link(clientID);
+	return backend.pSession;
+}
+
+//-------------------------------------------------------------------------------------
+Session* XServerApp::findBackendSession(SessionID clientID)
+{
+	auto iter = clientBackends_.find(clientID);
+	if (iter == clientBackends_.end())
+		return NULL;
+
+	return iter->second.pSession;
+}
+
+//-------------------------------------------------------------------------------------
+bool XServerApp::onClientPacket(SessionID clientID, ServerType type, ServerAppID hallsID, int32 cmd, struct evbuffer* pBody, uint32 size)
+{
+	Session* pBackendSession = findBackendSession(clientID);
+
+	// 第一次非公共协议通讯就直接绑定到具体app上
+	if (!pBackendSession || pBackendSession->appType() != type)
+		pBackendSession = onSessionBindBackendSession(type, clientID, hallsID);
+
+	if (!pBackendSession)
+	{
+		ERROR_MSG(fmt::format("XServerApp::onClientPacket(): not found backendSession({})!, id={}, datasize={}\n",
+			ServerType2Name[(int)type], clientID, size));
+
+		return false;
+	}
+
+	// 连接写满之后才发包的客户端同样暂停， 已经投递过来的包仍然转发， 由两倍上限兜底
+	if (pBackendSession->isSendQueueFull() && pBackendSession->sendQueuePolicy() == SENDQUEUE_POLICY_PAUSE_UPSTREAM &&
+		pausedClients_.insert(clientID).second)
+	{
+		pauseClient(clientID, true);
+	}
+
+	if (pBackendSession->connected())
+		pBackendSession->forwardPacket(clientID, cmd, pBody, size);
+
+	return true;
+}
+
+//-------------------------------------------------------------------------------------
+void XServerApp::onBackendMulticast(Session* pBackendSession, uint64 groupID, const std::vector<SessionID>& requestors, int32 cmd, const SharedPacketData& pData)
+{
+	NetworkInterface* pNetworkInterface = pExternalNetworkInterface();
+	if (!pNetworkInterface)
+		return;
+
+	// 显式列出的客户端也可能绑定在该后端上， 去重后每个客户端只发一次
+	std::set<SessionID> targets(requestors.begin(), requestors.end());
+
+	if (groupID == MULTICAST_GROUP_ALL)
+	{
+		// 组播帧可能从任意一条并行连接到达， 按后端app找出所有客户端
+		ServerInfo* pServerInfo = pServerMgr_ ? pServerMgr_->findServer(pBackendSession) : NULL;
+
+		for (auto& item : clientBackends_)
+		{
+			if (item.second.pSession == pBackendSession || (pServerInfo && item.second.pServerInfo == pServerInfo))
+				targets.insert(item.first);
+		}
+	}
+	else if (groupID != MULTICAST_GROUP_NONE)
+	{
+		WARNING_MSG(fmt::format("XServerApp::onBackendMulticast(): unknown groupID({}), cmd={}, from {}!\n",
+			groupID, cmd, pBackendSession->addr()));
+	}
+
+	std::map<EventDispatcher*, std::vector<SessionID>> loopClients;
+
+	for (SessionID clientID : targets)
+		loopClients[pNetworkInterface->pEventDispatcher(clientID)].push_back(clientID);
+
+	for (auto& item : loopClients)
+	{
+		if (item.first->isInLoopThread())
+		{
+			XSession::sendToClients(pNetworkInterface, item.second, cmd, pData);
+			continue;
+		}
+
+		std::vector<SessionID> clients;
+		clients.swap(item.second);
+
+		item.first->post([clients, cmd, pData]() {
+			NetworkInterface* pNetworkInterface = ((XServerApp&)XServerApp::getSingleton()).pExternalNetworkInterface();
+			if (pNetworkInterface)
+				XSession::sendToClients(pNetworkInterface, clients, cmd, pData);
+		});
+	}
+}
+
+//-------------------------------------------------------------------------------------
+void XServerApp::onClientDisconnected(SessionID clientID)
+{
+	auto iter = clientBackends_.find(clientID);
+	if (iter == clientBackends_.end())
+		return;
+
+	Session* pBackendSession = iter->second.pSession;
+	clientBackends_.erase(iter);
+	pausedClients_.erase(clientID);
+
+	DEBUG_MSG(fmt::format("XServerApp::onClientDisconnected(): client disconnected! {}\n", clientID));
+
+	CMD_RemoteDisconnected packet;
+	pBackendSession->forwardPacket(clientID, CMD::RemoteDisconnected, packet);
+}
+
+//-------------------------------------------------------------------------------------
+void XServerApp::destroyClientSession(SessionID clientID)
+{
+	if (!pExternalNetworkInterface())
+		return;
+
+	pExternalNetworkInterface()->runInSessionLoop(clientID, [](Session* pSession) {
+		if (pSession)
+			pSession->destroy();
+	});
 }
 
 //-------------------------------------------------------------------------------------
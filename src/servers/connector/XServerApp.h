@@ -4,6 +4,7 @@
 #include "common/common.h"
 #include "common/singleton.h"
 #include "server/XServerBase.h"
+#include "event/Session.h"
 
 namespace XServer {
 
@@ -21,13 +22,49 @@ public:
 
 	virtual void onServerJoined(ServerInfo* pServerInfo) override;
 	virtual void onServerExit(ServerInfo* pServerInfo) override;
+	virtual void onServerLinkLost(ServerInfo* pServerInfo, Session* pLink) override;
 
 	virtual void onSessionConnected(Session* pSession) override;
 
-	void onSessionBindBackendSession(ServerType type, Session* pSession, uint64 hallsID);
+	// 到后端的连接写满时暂停转发到这条连接的客户端， 降回低水位时恢复
+	virtual bool onSessionSendQueueFull(Session* pSession, bool full) override;
+
+	// 绑定到后端app， 返回客户端的包走的那条连接
+	Session* onSessionBindBackendSession(ServerType type, SessionID clientID, uint64 hallsID);
+
+	// 以下接口只能在主循环中调用， 工作循环中的客户端session通过投递来访问
+	Session* findBackendSession(SessionID clientID);
+
+	// 包体从pBody中移动到后端session的发送缓冲区
+	bool onClientPacket(SessionID clientID, ServerType type, ServerAppID hallsID, int32 cmd, struct evbuffer* pBody, uint32 size);
+	void onClientDisconnected(SessionID clientID);
+
+	// 后端的组播帧， 按客户端所在的循环分组后每个循环投递一次
+	void onBackendMulticast(Session* pBackendSession, uint64 groupID, const std::vector<SessionID>& requestors, int32 cmd, const SharedPacketData& pData);
+
+	void destroyClientSession(SessionID clientID);
 
 protected:
+	// 投递到客户端所在的循环暂停/恢复读取
+	void pauseClient(SessionID clientID, bool pause);
+
+	// 恢复因为pLink写满而暂停的客户端
+	void resumeClients(Session* pLink);
+
 	std::map<ServerAppID, int> mapBackendSessionNums_;
+
+	// 客户端绑定的后端应用， 例如：login、halls
+	// 到后端有多条并行连接时固定走其中一条， 那条断开之前不会换， 保证同一个客户端的包不乱序
+	struct ClientBackend
+	{
+		ServerInfo* pServerInfo;
+		Session* pSession;
+	};
+
+	std::map<SessionID, ClientBackend> clientBackends_;
+
+	// 因为绑定的后端连接写满而暂停读取的客户端
+	std::set<SessionID> pausedClients_;
 };
 
 }
@@ -2,6 +2,7 @@
 #include "XServerApp.h"
 #include "event/TcpSocket.h"
 #include "event/NetworkInterface.h"
+#include "event/EventDispatcher.h"
 #include "log/XLog.h"
 #include "protos/Commands.pb.h"
 #include "server/XServerBase.h"
@@ -11,8 +12,7 @@ namespace XServer {
 
 //-------------------------------------------------------------------------------------
 XSession::XSession(SessionID sessionID, socket_t sock, NetworkInterface* pNetworkInterface, EventDispatcher* pEventDispatcher):
-Session(sessionID, sock, pNetworkInterface, pEventDispatcher),
-pBackendSession_(NULL)
+Session(sessionID, sock, pNetworkInterface, pEventDispatcher)
 {
 }
 
@@ -36,74 +36,28 @@ bool XSession::onProcessPacket(SessionID requestorSessionID, const uint8* data,
 	{
 		if (header_.msgcmd >= Login_Begin && header_.msgcmd <= Login_End)
 		{
-			// һηǹЭͨѶֱӰ󶨵app
-			if (!pBackendSession_ || pBackendSession_->appType() != ServerType::SERVER_TYPE_LOGIN)
-			{
-				onBindBackendServer(ServerType::SERVER_TYPE_LOGIN);
-			}
-
-			if (!pBackendSession_)
-			{
-				ERROR_MSG(fmt::format("XSession::onProcessPacket(): not found pBackendSession(login)!, id={}, {}, datasize={}\n",
-					id(), addr(), header_.msglen));
-
-				return false;
-			}
-
-			if (pBackendSession_->connected())
-			{
-				CMD_ForwardPacket packet;
-				packet.set_requestorid(id());
-				packet.set_datas(data, size);
-				packet.set_msgcmd(header_.msgcmd);
-				pBackendSession_->sendPacket(CMD::ForwardPacket, packet);
-			}
-
-			return true;
+			return forwardToBackend(ServerType::SERVER_TYPE_LOGIN, 0, header_.msgcmd, data, size);
 		}
 		else if (header_.msgcmd >= Halls_Begin && header_.msgcmd <= Halls_End)
 		{
-			// һηǹЭͨѶֱӰ󶨵app
-			if (!pBackendSession_ || pBackendSession_->appType() != ServerType::SERVER_TYPE_HALLS)
-			{
-				ServerAppID hallsID = 0;
-
-				// ڵ½Э飬 аhallsIDôҪ󶨵ָhallsID
-				if (header_.msgcmd == CMD::Halls_Login)
-				{
-					CMD_Halls_Login packet;
-					if (!packet.ParseFromArray(data, header_.msglen))
-					{ 
-						ERROR_MSG(fmt::format("XSession::onProcessPacket(): loginPacket parsing error! {}, size={}, sessionID={}, {}\n",
-							CMD_Name((CMD)header_.msgcmd), header_.msglen, id(), pTcpSocket()->addr()));
+			ServerAppID hallsID = 0;
 
-						return false; 
-					}
-
-					hallsID = packet.hallsid();
-				}
-				
-				onBindBackendServer(ServerType::SERVER_TYPE_HALLS, hallsID);
-			}
-
-			if (!pBackendSession_)
+			// 对于登陆协议， 如果其中包含了hallsID那么需要绑定到指定hallsID上
+			if (header_.msgcmd == CMD::Halls_Login)
 			{
-				ERROR_MSG(fmt::format("XSession::onProcessPacket(): not found pBackendSession(halls)!, id={}, {}, datasize={}\n",
-					id(), addr(), header_.msglen));
+				CMD_Halls_Login packet;
+				if (!packet.ParseFromArray(data, header_.msglen))
+				{ 
+					ERROR_MSG(fmt::format("XSession::onProcessPacket(): loginPacket parsing error! {}, size={}, sessionID={}, {}\n",
+						CMD_Name((CMD)header_.msgcmd), header_.msglen, id(), pTcpSocket()->addr()));
 
-				return false;
-			}
+					return false; 
+				}
 
-			if (pBackendSession_->connected())
-			{
-				CMD_ForwardPacket packet;
-				packet.set_requestorid(id());
-				packet.set_datas(data, size);
-				packet.set_msgcmd(header_.msgcmd);
-				pBackendSession_->sendPacket(CMD::ForwardPacket, packet);
+				hallsID = packet.hallsid();
 			}
 
-			return true;
+			return forwardToBackend(ServerType::SERVER_TYPE_HALLS, hallsID, header_.msgcmd, data, size);
 		}
 	}
 
@@ -121,56 +75,128 @@ bool XSession::onProcessPacket(SessionID requestorSessionID, const uint8* data,
 }
 
 //-------------------------------------------------------------------------------------
-bool XSession::onForwardPacket(const CMD_ForwardPacket& packet)
+bool XSession::forwardToBackend(ServerType type, ServerAppID hallsID, int32 cmd, const uint8* data, uint32 size)
 {
-	if (!isServer())
-	{
-		if (this->pBackendSession())
-		{
-			this->pBackendSession()->sendPacket(CMD::ForwardPacket, packet);
-			return true;
-		}
+	XServerApp& app = (XServerApp&)XServerApp::getSingleton();
 
-		ERROR_MSG(fmt::format("XSession::onProcessForwardPacket(): not found pBackendSession!, id={}, {}, datasize={}\n",
-			id(), addr(), header_.msglen));
+	// 包体还在接收缓冲区中时直接从这里移走， 不解析也不拷贝成字符串
+	struct evbuffer* pRecvBody = packetBodyBuffer();
 
+	// 后端session都在主循环上
+	if (pRecvBody && app.pEventDispatcher()->isInLoopThread())
+		return app.onClientPacket(id(), type, hallsID, cmd, pRecvBody, size);
+
+	std::shared_ptr<struct evbuffer> pBody(evbuffer_new(), evbuffer_free);
+	if (!pBody)
 		return false;
-	}
 
-	// Ƿڲsession˵Ҫתͻ
-	SessionID sessionID = packet.requestorid();
-	std::string datas = packet.datas();
+	if (pRecvBody ? evbuffer_remove_buffer(pRecvBody, pBody.get(), size) != (int)size : evbuffer_add(pBody.get(), data, size) != 0)
+		return false;
 
-	// ҵߵsession Ͷݸ
-	Session* pSession = ((XServerApp&)XServerApp::getSingleton()).pExternalNetworkInterface()->findSession(sessionID);
-	if (!pSession)
-	{
-		ERROR_MSG(fmt::format("Session::onForwardPacket(): not found requester({}), drop packet!", sessionID));
+	if (app.pEventDispatcher()->isInLoopThread())
+		return app.onClientPacket(id(), type, hallsID, cmd, pBody.get(), size);
+
+	// 工作循环上的客户端把包体的内存块投递过去
+	SessionID clientID = id();
+
+	app.pEventDispatcher()->post([clientID, type, hallsID, cmd, pBody, size]() {
+		XServerApp& app = (XServerApp&)XServerApp::getSingleton();
+
+		if (!app.onClientPacket(clientID, type, hallsID, cmd, pBody.get(), size))
+			app.destroyClientSession(clientID);
+	});
+
+	return true;
+}
+
+//-------------------------------------------------------------------------------------
+bool XSession::onForwardFrame(SessionID requestorSessionID, int32 cmd, const uint8* data, uint32 size)
+{
+	// 后端发来的包， 需要原样转发给客户端
+	XServerApp& app = (XServerApp&)XServerApp::getSingleton();
 
+	NetworkInterface* pNetworkInterface = app.pExternalNetworkInterface();
+	if (!pNetworkInterface)
+		return true;
+
+	struct evbuffer* pRecvBody = packetBodyBuffer();
+
+	// 请求者在同一个循环上时， 包体直接从接收缓冲区移动到客户端的发送缓冲区
+	if (pRecvBody && pNetworkInterface->pEventDispatcher(requestorSessionID)->isInLoopThread())
+		return sendToClient(pNetworkInterface->findSession(requestorSessionID), requestorSessionID, cmd, pRecvBody, size);
+
+	std::shared_ptr<struct evbuffer> pBody(evbuffer_new(), evbuffer_free);
+	if (!pBody)
+		return false;
+
+	if (pRecvBody ? evbuffer_remove_buffer(pRecvBody, pBody.get(), size) != (int)size : evbuffer_add(pBody.get(), data, size) != 0)
+		return false;
+
+	// 找到请求者的session， 将包体投递给他所在的循环发送
+	pNetworkInterface->runInSessionLoop(requestorSessionID, [requestorSessionID, cmd, pBody, size](Session* pSession) {
+		sendToClient(pSession, requestorSessionID, cmd, pBody.get(), size);
+	});
+
+	return true;
+}
+
+//-------------------------------------------------------------------------------------
+bool XSession::onMulticastFrame(uint64 groupID, const std::vector<SessionID>& requestors, int32 cmd, const uint8* data, uint32 size)
+{
+	XServerApp& app = (XServerApp&)XServerApp::getSingleton();
+
+	// 包体只拷贝这一次， 之后所有客户端的发送缓冲区都引用它
+	SharedPacketData pData = std::make_shared<std::string>((const char*)data, size);
+
+	// 绑定关系由主循环维护
+	if (app.pEventDispatcher()->isInLoopThread())
+	{
+		app.onBackendMulticast(this, groupID, requestors, cmd, pData);
 		return true;
 	}
 
-	assert(!pSession->isServer());
+	Session* pBackendSession = this;
+	std::vector<SessionID> clients(requestors);
+
+	app.pEventDispatcher()->runInLoop([pBackendSession, groupID, clients, cmd, pData]() {
+		((XServerApp&)XServerApp::getSingleton()).onBackendMulticast(pBackendSession, groupID, clients, cmd, pData);
+	});
 
-	PacketHeader& header = pSession->packetHeader();
-	header.msgcmd = packet.msgcmd();
-	header.msglen = datas.size();
+	return true;
+}
+
+//-------------------------------------------------------------------------------------
+void XSession::sendToClients(NetworkInterface* pNetworkInterface, const std::vector<SessionID>& clients, int32 cmd, const SharedPacketData& pData)
+{
+	for (SessionID clientID : clients)
+	{
+		// 组播时客户端可能已经断开， 直接跳过
+		Session* pSession = pNetworkInterface->findSession(clientID);
+		if (!pSession || pSession->isServer())
+			continue;
 
-	return pSession->sendPacket(header.msgcmd, (uint8*)(datas.data()), datas.size());
+		pSession->sendSharedPacket(cmd, pData);
+	}
 }
 
 //-------------------------------------------------------------------------------------
-void XSession::onBindBackendServer(ServerType type, uint64 hallsID)
+bool XSession::sendToClient(Session* pSession, SessionID sessionID, int32 cmd, struct evbuffer* pBody, uint32 size)
 {
-	// Ự󶨵AppỰ
-	((XServerApp&)XServerApp::getSingleton()).onSessionBindBackendSession(type, this, hallsID);
+	if (!pSession)
+	{
+		ERROR_MSG(fmt::format("XSession::sendToClient(): not found requester({}), drop packet!\n", sessionID));
+
+		return true;
+	}
+
+	assert(!pSession->isServer());
+
+	return pSession->sendPacket(cmd, pBody, size);
 }
 
 //-------------------------------------------------------------------------------------
 void XSession::onLoseBackendSession()
 {
-	pBackendSession(NULL);
-
 	ERROR_MSG(fmt::format("XSession::onLoseBackendSession(): {}, addr={}!\n",
 		id(), addr()));
 
@@ -180,15 +206,15 @@ void XSession::onLoseBackendSession()
 //-------------------------------------------------------------------------------------
 void XSession::onDisconnected()
 {
-	// client disconnect
-	if (this->pBackendSession())
-	{
-		DEBUG_MSG(fmt::format("XSession::onDisconnected(): client disconnected! {}, addr={}\n",
-			id(), addr()));
+	if (isServer())
+		return;
 
-		CMD_RemoteDisconnected packet;
-		pBackendSession_->forwardPacket(id(), CMD::RemoteDisconnected, packet);
-	}
+	// client disconnect， 绑定关系由主循环维护
+	SessionID clientID = id();
+
+	((XServerApp&)XServerApp::getSingleton()).pEventDispatcher()->runInLoop([clientID]() {
+		((XServerApp&)XServerApp::getSingleton()).onClientDisconnected(clientID);
+	});
 }
 
 //-------------------------------------------------------------------------------------
@@ -11,27 +11,23 @@ public:
 	XSession(SessionID sessionID, socket_t sock, NetworkInterface* pNetworkInterface, EventDispatcher* pEventDispatcher);
 	virtual ~XSession();
 
-	Session* pBackendSession() {
-		return pBackendSession_;
-	}
-
-	void pBackendSession(Session* pSession) {
-		pBackendSession_ = pSession;
-	}
-
 	void onLoseBackendSession();
 
 protected:
 	virtual bool onProcessPacket(SessionID requestorSessionID, const uint8* data, int32 size) override;
-	virtual bool onForwardPacket(const CMD_ForwardPacket& packet) override;
+	virtual bool onForwardFrame(SessionID requestorSessionID, int32 cmd, const uint8* data, uint32 size) override;
+	virtual bool onMulticastFrame(uint64 groupID, const std::vector<SessionID>& requestors, int32 cmd, const uint8* data, uint32 size) override;
 
 	virtual void onDisconnected() override;
 
-	void onBindBackendServer(ServerType type, uint64 hallsID = 0);
+	// 客户端的包交给主循环转发到后端app(login、halls)
+	bool forwardToBackend(ServerType type, ServerAppID hallsID, int32 cmd, const uint8* data, uint32 size);
 
-	// 󶨵ĺӦsession 磺loginhalls
-	Session* pBackendSession_;
+	static bool sendToClient(Session* pSession, SessionID sessionID, int32 cmd, struct evbuffer* pBody, uint32 size);
 
+public:
+	// 在客户端所在的循环中调用， 所有客户端引用同一份包体
+	static void sendToClients(NetworkInterface* pNetworkInterface, const std::vector<SessionID>& clients, int32 cmd, const SharedPacketData& pData);
 };
 
 }
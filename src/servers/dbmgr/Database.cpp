@@ -51,7 +51,7 @@ bool Database::initialize(std::string db_host, int db_port, std::string db_usern
 		db_password_, db_host_,
 		(db_port_ > 0 ? fmt::format(":{}", db_port_): "")).c_str();
 
-	// mongodbӣuristrʾmongodbURIַ磺mongodb://127.0.0.1:8888/
+	// 建立与mongodb的连接，uristr表示mongodb的URI地址，例如：mongodb://127.0.0.1:8888/
 	pMongoClient_ = mongoc_client_new(urlstr.c_str());
 
 	if (!pMongoClient_)
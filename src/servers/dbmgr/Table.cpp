@@ -26,14 +26,14 @@ bool Table::initialize()
 {
 	bson_error_t  error;
 
-	//뿪
+	//如果存在则离开返回
 	if (mongoc_database_has_collection(pDatabase_->pDatabase(), db_tableName_.c_str(), &error))
 	{
 		collection_ = mongoc_client_get_collection(pDatabase_->pMongoClient(), pDatabase_->db_name().c_str(), db_tableName_.c_str());
 		return collection_ != NULL;
 	}
 
-	//򴴽
+	//不存在则创建
 	return syncTable();
 }
 
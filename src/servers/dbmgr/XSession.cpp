@@ -21,69 +21,23 @@ XSession::~XSession()
 }
 
 //-------------------------------------------------------------------------------------
-bool XSession::onProcessPacket(SessionID requestorSessionID, const uint8* data, int32 size)
+PacketHandlers& XSession::packetHandlers() const
 {
-	if (header_.msgcmd >= CMD_MAX)
-	{
-		ERROR_MSG(fmt::format("XSession::onProcessPacket(): invalid packet cmd: {}, msgcmd={}, sessionID={}, {}\n",
-			packetHeader().msglen, packetHeader().msgcmd, id(), pTcpSocket()->addr()));
-
-		return true;
-	}
-
-	switch (header_.msgcmd)
-	{
-	case CMD::Dbmgr_WriteAccount:
-	{
-		CMD_Dbmgr_WriteAccount packet;
-		PARSE_PACKET();
-
-		onWriteAccount(packet);
-		break;
-	}
-	case CMD::Dbmgr_QueryAccount:
-	{
-		CMD_Dbmgr_QueryAccount packet;
-		PARSE_PACKET();
-
-		onQueryAccount(packet);
-		break;
-	}
-	case CMD::Dbmgr_UpdateAccountData:
-	{
-		CMD_Dbmgr_UpdateAccountData packet;
-		PARSE_PACKET();
-
-		onUpdateAccountData(packet);
-		break;
-	}
-	case CMD::Dbmgr_WritePlayerGameData:
-	{
-		CMD_Dbmgr_WritePlayerGameData packet;
-		PARSE_PACKET();
-
-		onWritePlayerGameData(packet);
-		break;
-	}
-	case CMD::Dbmgr_QueryPlayerGameData:
-	{
-		CMD_Dbmgr_QueryPlayerGameData packet;
-		PARSE_PACKET();
-
-		onQueryPlayerGameData(packet);
-		break;
-	}
-	default:
-	{
-		ERROR_MSG(fmt::format("XSession::onProcessPacket(): unknown packet cmd: {}, msglen={}, sessionID={}, {}\n",
-			CMD_Name((CMD)packetHeader().msgcmd), packetHeader().msglen, id(), pTcpSocket()->addr()));
-
-		return false;
-		break;
-	}
-	};
+	static PacketHandlers handlers("dbmgr", &XSession::registerHandlers);
+	return handlers;
+}
 
-	return true;
+//-------------------------------------------------------------------------------------
+void XSession::registerHandlers(PacketHandlers& handlers)
+{
+	Session::registerHandlers(handlers);
+
+	// 客户端的协议由connector转发， 都来自服务器之间的连接
+	handlers.registerHandler<CMD::Dbmgr_WriteAccount, CMD_Dbmgr_WriteAccount>(&XSession::onWriteAccount, SESSION_KIND_SERVER);
+	handlers.registerHandler<CMD::Dbmgr_QueryAccount, CMD_Dbmgr_QueryAccount>(&XSession::onQueryAccount, SESSION_KIND_SERVER);
+	handlers.registerHandler<CMD::Dbmgr_UpdateAccountData, CMD_Dbmgr_UpdateAccountData>(&XSession::onUpdateAccountData, SESSION_KIND_SERVER);
+	handlers.registerHandler<CMD::Dbmgr_WritePlayerGameData, CMD_Dbmgr_WritePlayerGameData>(&XSession::onWritePlayerGameData, SESSION_KIND_SERVER);
+	handlers.registerHandler<CMD::Dbmgr_QueryPlayerGameData, CMD_Dbmgr_QueryPlayerGameData>(&XSession::onQueryPlayerGameData, SESSION_KIND_SERVER);
 }
 
 //-------------------------------------------------------------------------------------
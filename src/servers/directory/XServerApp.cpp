@@ -71,7 +71,7 @@ void XServerApp::onSessionListServers(Session* pSession, const CMD_Directory_Lis
 		}
 	}
 
-	// ˴ͨ, ͬһεĵַ̬ķconnector
+	// 此处可以通过计算, 同一网段的地址，将连接数动态均衡的分配给connector
 	for (auto& item : foundConnectorInfos)
 	{
 		CMD_ListServersInfo* pCMD_ListServersInfo = res_packet.add_srvs();
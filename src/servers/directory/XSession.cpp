@@ -19,37 +19,19 @@ XSession::~XSession()
 }
 
 //-------------------------------------------------------------------------------------
-bool XSession::onProcessPacket(SessionID requestorSessionID, const uint8* data, int32 size)
+PacketHandlers& XSession::packetHandlers() const
 {
-	if (header_.msgcmd <= Directory_Begin || header_.msgcmd >= Directory_End)
-	{
-		ERROR_MSG(fmt::format("XSession::onProcessPacket(): invalid packet cmd: {}, msgcmd={}, sessionID={}, {}\n",
-			packetHeader().msglen, CMD_Name((CMD)packetHeader().msgcmd), id(), pTcpSocket()->addr()));
-
-		return true;
-	}
-
-	switch (header_.msgcmd)
-	{
-	case CMD::Directory_ListServers:
-		{
-			CMD_Directory_ListServers packet;
-			PARSE_PACKET();
-
-			onListServers(packet);
-			break;
-		}
-	default:
-		{
-			ERROR_MSG(fmt::format("XSession::onProcessPacket(): unknown packet cmd: {}, msglen={}, sessionID={}, {}\n",
-				CMD_Name((CMD)packetHeader().msgcmd), packetHeader().msglen, id(), pTcpSocket()->addr()));
-
-			return false;
-			break;
-		}
-	};
-
-	return true;
+	static PacketHandlers handlers("directory", &XSession::registerHandlers);
+	return handlers;
+}
+
+//-------------------------------------------------------------------------------------
+void XSession::registerHandlers(PacketHandlers& handlers)
+{
+	Session::registerHandlers(handlers);
+
+	// 客户端可以直接连接directory
+	handlers.registerHandler<CMD::Directory_ListServers, CMD_Directory_ListServers>(&XSession::onListServers);
 }
 
 //-------------------------------------------------------------------------------------
@@ -14,7 +14,8 @@ public:
 	void onListServers(const CMD_Directory_ListServers& packet);
 
 protected:
-	virtual bool onProcessPacket(SessionID requestorSessionID, const uint8* data, int32 size) override;
+	virtual PacketHandlers& packetHandlers() const override;
+	static void registerHandlers(PacketHandlers& handlers);
 };
 
 }
@@ -24,7 +24,7 @@ players_(),
 roomsPool_(roomsPool),
 isDestroyed_(false),
 roomCreateTime_(getTimeStamp()),
-tickTimerEvent_(NULL),
+tickTimerEvent_(TIMER_HANDLE_INVALID),
 roomServerIP_(),
 roomServerPort_(),
 roomServerTokenID_(0)
@@ -193,7 +193,8 @@ void Room::enter(XObjectPtr pObj)
 
 	pPlayer->roomID(id());
 	
-	CMD_Client_OnMatchingUpdate res_packet;
+	// 频繁发送的包复用同一个实例， 字段的内存不需要每次重新分配
+	static thread_local CMD_Client_OnMatchingUpdate res_packet;
 	res_packet.set_name(pPlayer->playerName());
 	res_packet.set_id(pPlayer->id());
 	res_packet.set_modelid(pPlayer->modelID());
@@ -207,7 +208,6 @@ void Room::enter(XObjectPtr pObj)
 		if (pPlayer == pOtherPlayer)
 			continue;
 
-		CMD_Client_OnMatchingUpdate res_packet;
 		res_packet.set_name(pOtherPlayer->playerName());
 		res_packet.set_id(pOtherPlayer->id());
 		res_packet.set_modelid(pOtherPlayer->modelID());
@@ -281,12 +281,24 @@ void Room::startGame()
 //-------------------------------------------------------------------------------------
 void Room::broadcastPlayerMessages(int32 cmd, const ::google::protobuf::Message& packet)
 {
+	// 只序列化一次， 同一个connector上的玩家合成一个组播帧
+	std::map<Session*, std::vector<SessionID>> connectorPlayers;
+
 	for (auto& item : players_)
 	{
 		Session* pSession = item.second->pSession();
 		if (pSession)
-			pSession->forwardPacket(((XPlayer*)item.second.get())->requestorSessionID(), cmd, packet);
+			connectorPlayers[pSession].push_back(((XPlayer*)item.second.get())->requestorSessionID());
 	}
+
+	if (connectorPlayers.empty())
+		return;
+
+	std::string datas;
+	packet.SerializeToString(&datas);
+
+	for (auto& item : connectorPlayers)
+		item.first->multicastPacket(MULTICAST_GROUP_NONE, item.second, cmd, (const uint8*)datas.data(), (uint32)datas.size());
 }
 
 //-------------------------------------------------------------------------------------
@@ -2,6 +2,7 @@
 #define X_ROOM_H
 
 #include "common/common.h"
+#include "event/Timer.h"
 #include "protos/Commands.pb.h"
 
 namespace XServer {
@@ -132,7 +133,7 @@ protected:
 
 	time_t roomCreateTime_;
 
-	struct event * tickTimerEvent_;
+	TimerHandle tickTimerEvent_;
 
 	std::string roomServerIP_;
 	uint16 roomServerPort_;
@@ -19,7 +19,7 @@ XObject(oid, pSession),
 state_(WaitStart),
 roomID_(OBJECT_ID_INVALID),
 requestorSessionID_(requestorSessionID),
-destroyTimerEvent_(NULL),
+destroyTimerEvent_(TIMER_HANDLE_INVALID),
 playerName_(accountName),
 accountName_(accountName),
 modelID_(0),
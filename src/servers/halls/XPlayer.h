@@ -2,6 +2,7 @@
 #define X_XPLAYER_H
 
 #include "XObject.h"
+#include "event/Timer.h"
 
 namespace XServer {
 
@@ -312,7 +313,7 @@ protected:
 
 	SessionID requestorSessionID_;
 
-	struct event * destroyTimerEvent_;
+	TimerHandle destroyTimerEvent_;
 
 	std::string playerName_;
 	std::string accountName_;
@@ -144,6 +144,20 @@ void XServerApp::onSessionDisconnected(Session* pSession)
 	}
 }
 
+//-------------------------------------------------------------------------------------
+void XServerApp::onServerLinkLost(ServerInfo* pServerInfo, Session* pLink)
+{
+	XServerBase::onServerLinkLost(pServerInfo, pLink);
+
+	// connector仍然在线， 这条连接上的玩家换到connector为他们选的同一条连接
+	for (auto& item : session2PlayerMapping_)
+	{
+		XPlayer* pPlayer = (XPlayer*)item.second.get();
+		if (pPlayer->pSession() == pLink)
+			pPlayer->onClientConnected(pServerInfo->link(pPlayer->requestorSessionID()));
+	}
+}
+
 //-------------------------------------------------------------------------------------
 void XServerApp::onSessionRemoteDisconnected(SessionID requestorSessionID, Session* pSession, const CMD_RemoteDisconnected& packet)
 {
@@ -887,5 +901,45 @@ void XServerApp::onSessionListGames(SessionID requestorSessionID, Session* pSess
 	pSession->forwardPacket(requestorSessionID, CMD::Client_OnListGamesCB, res_packet);
 }
 
+//-------------------------------------------------------------------------------------
+void XServerApp::broadcastAnnouncement(int32 cmd, const ::google::protobuf::Message& packet)
+{
+	// 玩家分散在到同一个connector的多条并行连接上， 每个connector只发一次
+	std::set<Session*> connectors;
+	std::set<ServerInfo*> found;
+
+	for (auto& item : session2PlayerMapping_)
+	{
+		Session* pSession = item.second->pSession();
+		if (!pSession)
+			continue;
+
+		ServerInfo* pServerInfo = pServerMgr_ ? pServerMgr_->findServer(pSession) : NULL;
+		if (!pServerInfo)
+		{
+			connectors.insert(pSession);
+			continue;
+		}
+
+		if (!found.insert(pServerInfo).second)
+			continue;
+
+		// 优先走主连接， 主连接不可用时用玩家所在的连接
+		connectors.insert((pServerInfo->pSession && pServerInfo->pSession->connected()) ? pServerInfo->pSession : pSession);
+	}
+
+	if (connectors.empty())
+		return;
+
+	std::string datas;
+	packet.SerializeToString(&datas);
+
+	// connector按绑定关系找出本halls的所有客户端
+	std::vector<SessionID> requestors;
+
+	for (Session* pSession : connectors)
+		pSession->multicastPacket(MULTICAST_GROUP_ALL, requestors, cmd, (const uint8*)datas.data(), (uint32)datas.size());
+}
+
 //-------------------------------------------------------------------------------------
 }
@@ -59,7 +59,7 @@ public:
 		std::string backDatas;
 		time_t lastTime;
 
-		// дڵID != OBJECT_ID_INVALIDöѾڵǰ̴
+		// 如果有存在的ID != OBJECT_ID_INVALID则表明该对象已经在当前进程创建
 		ObjectID foundObjectID;
 	};
 
@@ -114,6 +114,7 @@ public:
 	bool delPendingMatch(ObjectID oid);
 
 	virtual void onSessionDisconnected(Session* pSession) override;
+	virtual void onServerLinkLost(ServerInfo* pServerInfo, Session* pLink) override;
 	void onSessionRemoteDisconnected(SessionID requestorSessionID, Session* pSession, const CMD_RemoteDisconnected& packet);
 
 	void onSessionRequestAllocClient(Session* pSession, const CMD_Halls_RequestAllocClient& packet);
@@ -152,6 +153,9 @@ public:
 		return iter->second;
 	}
 
+	// 全服公告， 每个connector只收到一个组播帧
+	void broadcastAnnouncement(int32 cmd, const ::google::protobuf::Message& packet);
+
 	void debugRooms();
 
 	void destroyRoom(ObjectID roomID);
@@ -23,123 +23,35 @@ XSession::~XSession()
 }
 
 //-------------------------------------------------------------------------------------
-bool XSession::onProcessPacket(SessionID requestorSessionID, const uint8* data, int32 size)
+PacketHandlers& XSession::packetHandlers() const
 {
-	if (header_.msgcmd >= CMD_MAX)
-	{
-		ERROR_MSG(fmt::format("XSession::onProcessPacket(): invalid packet cmd: {}, msgcmd={}, sessionID={}, {}\n",
-			packetHeader().msglen, packetHeader().msgcmd, id(), pTcpSocket()->addr()));
-
-		return true;
-	}
-
-	switch (header_.msgcmd)
-	{
-	case CMD::Halls_RequestAllocClient:
-	{
-		CMD_Halls_RequestAllocClient packet;
-		PARSE_PACKET();
-
-		onRequestAllocClient(packet);
-		break;
-	}
-	case CMD::Halls_Login:
-	{
-		CMD_Halls_Login packet;
-		PARSE_PACKET();
-
-		onLogin(requestorSessionID, packet);
-		break;
-	}
-	case CMD::Halls_StartMatch:
-	{
-		CMD_Halls_StartMatch packet;
-		PARSE_PACKET();
-
-		onStartMatch(requestorSessionID, packet);
-		break;
-	}
-	case CMD::RemoteDisconnected:
-	{
-		CMD_RemoteDisconnected packet;
-		PARSE_PACKET();
-
-		onRemoteDisconnected(requestorSessionID, packet);
-		break;
-	}
-	case CMD::Halls_OnRequestCreateRoomCB:
-	{
-		CMD_Halls_OnRequestCreateRoomCB packet;
-		PARSE_PACKET();
-
-		onRequestCreateRoomCB(packet);
-		break;
-	}
-	case CMD::Halls_OnRoomSrvGameOverReport:
-	{
-		CMD_Halls_OnRoomSrvGameOverReport packet;
-		PARSE_PACKET();
-
-		onRoomSrvGameOverReport(packet);
-		break;
-	}
-	case CMD::Halls_OnQueryAccountCB:
-	{
-		CMD_Halls_OnQueryAccountCB packet;
-		PARSE_PACKET();
-
-		onQueryAccountCB(packet);
-		break;
-	}
-	case CMD::Halls_OnQueryPlayerGameDataCB:
-	{
-		CMD_Halls_OnQueryPlayerGameDataCB packet;
-		PARSE_PACKET();
-
-		onQueryPlayerGameDataCB(packet);
-		break;
-	}
-	case CMD::Halls_QueryPlayerGameData:
-	{
-		CMD_Halls_QueryPlayerGameData packet;
-		PARSE_PACKET();
-
-		onQueryPlayerGameData(requestorSessionID, packet);
-		break;
-	}
-	case CMD::Halls_ListGames:
-	{
-		CMD_Halls_ListGames packet;
-		PARSE_PACKET();
-
-		onListGames(requestorSessionID, packet);
-		break;
-	}
-	default:
-	{
-		ERROR_MSG(fmt::format("XSession::onProcessPacket(): unknown packet cmd: {}, msglen={}, sessionID={}, {}\n",
-			CMD_Name((CMD)packetHeader().msgcmd), packetHeader().msglen, id(), pTcpSocket()->addr()));
-
-		return false;
-		break;
-	}
-	};
-
-	return true;
-}
-
-//-------------------------------------------------------------------------------------
-bool XSession::onForwardPacket(const CMD_ForwardPacket& packet)
-{
-	SessionID sessionID = packet.requestorid();
-	std::string datas = packet.datas();
+	static PacketHandlers handlers("halls", &XSession::registerHandlers);
+	return handlers;
+}
 
-	PacketHeader& header = packetHeader();
-	header.msgcmd = packet.msgcmd();
-	header.msglen = datas.size();
+//-------------------------------------------------------------------------------------
+void XSession::registerHandlers(PacketHandlers& handlers)
+{
+	Session::registerHandlers(handlers);
+
+	// 客户端的协议由connector转发， 都来自服务器之间的连接
+	handlers.registerHandler<CMD::Halls_RequestAllocClient, CMD_Halls_RequestAllocClient>(&XSession::onRequestAllocClient, SESSION_KIND_SERVER);
+	handlers.registerHandler<CMD::Halls_Login, CMD_Halls_Login>(&XSession::onLogin, SESSION_KIND_SERVER);
+	handlers.registerHandler<CMD::Halls_StartMatch, CMD_Halls_StartMatch>(&XSession::onStartMatch, SESSION_KIND_SERVER);
+	handlers.registerHandler<CMD::RemoteDisconnected, CMD_RemoteDisconnected>(&XSession::onRemoteDisconnected, SESSION_KIND_SERVER);
+	handlers.registerHandler<CMD::Halls_OnRequestCreateRoomCB, CMD_Halls_OnRequestCreateRoomCB>(&XSession::onRequestCreateRoomCB, SESSION_KIND_SERVER);
+	handlers.registerHandler<CMD::Halls_OnRoomSrvGameOverReport, CMD_Halls_OnRoomSrvGameOverReport>(&XSession::onRoomSrvGameOverReport, SESSION_KIND_SERVER);
+	handlers.registerHandler<CMD::Halls_OnQueryAccountCB, CMD_Halls_OnQueryAccountCB>(&XSession::onQueryAccountCB, SESSION_KIND_SERVER);
+	handlers.registerHandler<CMD::Halls_OnQueryPlayerGameDataCB, CMD_Halls_OnQueryPlayerGameDataCB>(&XSession::onQueryPlayerGameDataCB, SESSION_KIND_SERVER);
+	handlers.registerHandler<CMD::Halls_QueryPlayerGameData, CMD_Halls_QueryPlayerGameData>(&XSession::onQueryPlayerGameData, SESSION_KIND_SERVER);
+	handlers.registerHandler<CMD::Halls_ListGames, CMD_Halls_ListGames>(&XSession::onListGames, SESSION_KIND_SERVER);
+}
 
-	pPlayer = ((XServerApp&)XServerApp::getSingleton()).findSessionPlayer(sessionID);
-	bool ret = onProcessPacket_(sessionID, (uint8*)(datas.data()), datas.size());
+//-------------------------------------------------------------------------------------
+bool XSession::onForwardFrame(SessionID requestorSessionID, int32 cmd, const uint8* data, uint32 size)
+{
+	pPlayer = ((XServerApp&)XServerApp::getSingleton()).findSessionPlayer(requestorSessionID);
+	bool ret = Session::onForwardFrame(requestorSessionID, cmd, data, size);
 	pPlayer.reset();
 
 	return ret;
@@ -15,8 +15,10 @@ public:
 	virtual ~XSession();
 
 protected:
-	virtual bool onProcessPacket(SessionID requestorSessionID, const uint8* data, int32 size) override;
-	virtual bool onForwardPacket(const CMD_ForwardPacket& packet) override;
+	virtual PacketHandlers& packetHandlers() const override;
+	static void registerHandlers(PacketHandlers& handlers);
+
+	virtual bool onForwardFrame(SessionID requestorSessionID, int32 cmd, const uint8* data, uint32 size) override;
 
 	virtual void onRemoteDisconnected(SessionID requestorSessionID, const CMD_RemoteDisconnected& packet);
 
@@ -11,7 +11,7 @@ public:
 	XNetworkInterface(EventDispatcher* pEventDispatcher, bool isInternalNetwork);
 	virtual ~XNetworkInterface();
 
-	virtual Session* createSession_(SessionID sessionID, evutil_socket_t sock) override;
+	virtual Session* createSession_(SessionID sessionID, evutil_socket_t sock, EventDispatcher* pEventDispatcher) override;
 
 protected:
 };
@@ -48,8 +48,8 @@ bool XServerApp::initializeEnd()
 //-------------------------------------------------------------------------------------
 ServerInfo* XServerApp::findBestServer()
 {
-	// ݿͻӵconnectoripѰͬһµĹhallsconnectoripΪipǾͻɸѡӦĵַ
-	// Ҳõĵַѡһ
+	// 根据客户端连接的connector的ip搜寻同一局域网下的挂载有halls的connector的ip（因为这个ip是经过客户端筛选出响应最快的地址）
+	// 如果找不到可用的地址，则随机选一个
 
 	std::vector<ServerInfo*> founds = ((XServerApp&)XServerApp::getSingleton()).pServerMgr()->findServer(ServerType::SERVER_TYPE_HALLS);
 	if (founds.size() == 0)
@@ -21,45 +21,20 @@ XSession::~XSession()
 }
 
 //-------------------------------------------------------------------------------------
-bool XSession::onProcessPacket(SessionID requestorSessionID, const uint8* data, int32 size)
+PacketHandlers& XSession::packetHandlers() const
 {
-	if (header_.msgcmd >= CMD_MAX)
-	{
-		ERROR_MSG(fmt::format("XSession::onProcessPacket(): invalid packet cmd: {}, msgcmd={}, sessionID={}, {}\n",
-			packetHeader().msglen, packetHeader().msgcmd, id(), pTcpSocket()->addr()));
-
-		return true;
-	}
-
-	switch (header_.msgcmd)
-	{
-	case CMD::Hallsmgr_RequestAllocClient:
-	{
-		CMD_Hallsmgr_RequestAllocClient packet;
-		PARSE_PACKET();
-
-		onRequestAllocClient(packet);
-		break;
-	}
-	case CMD::Hallsmgr_OnRequestAllocClientCB:
-	{
-		CMD_Hallsmgr_OnRequestAllocClientCB packet;
-		PARSE_PACKET();
-
-		onRequestAllocClientCB(packet);
-		break;
-	}
-	default:
-	{
-		ERROR_MSG(fmt::format("XSession::onProcessPacket(): unknown packet cmd: {}, msglen={}, sessionID={}, {}\n",
-			CMD_Name((CMD)packetHeader().msgcmd), packetHeader().msglen, id(), pTcpSocket()->addr()));
+	static PacketHandlers handlers("hallsmgr", &XSession::registerHandlers);
+	return handlers;
+}
 
-		return false;
-		break;
-	}
-	};
+//-------------------------------------------------------------------------------------
+void XSession::registerHandlers(PacketHandlers& handlers)
+{
+	Session::registerHandlers(handlers);
 
-	return true;
+	// 客户端的协议由connector转发， 都来自服务器之间的连接
+	handlers.registerHandler<CMD::Hallsmgr_RequestAllocClient, CMD_Hallsmgr_RequestAllocClient>(&XSession::onRequestAllocClient, SESSION_KIND_SERVER);
+	handlers.registerHandler<CMD::Hallsmgr_OnRequestAllocClientCB, CMD_Hallsmgr_OnRequestAllocClientCB>(&XSession::onRequestAllocClientCB, SESSION_KIND_SERVER);
 }
 
 //-------------------------------------------------------------------------------------
@@ -12,7 +12,9 @@ public:
 	virtual ~XSession();
 
 protected:
-	virtual bool onProcessPacket(SessionID requestorSessionID, const uint8* data, int32 size) override;
+	virtual PacketHandlers& packetHandlers() const override;
+	static void registerHandlers(PacketHandlers& handlers);
+
 	virtual void onRequestAllocClient(const CMD_Hallsmgr_RequestAllocClient& packet);
 	virtual void onRequestAllocClientCB(const CMD_Hallsmgr_OnRequestAllocClientCB& packet);
 };
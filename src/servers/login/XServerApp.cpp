@@ -297,7 +297,7 @@ void XServerApp::onSessionSigninCB(Session* pSession, const CMD_Login_OnSigninCB
 	pendingAccount->updateTime();
 	pendingAccount->backDatas = packet.datas();
 
-	// ȥhallsmgrһʵhalls
+	// 去请求hallsmgr分配一个合适的halls
 	ServerInfo* pServerInfo = pServerMgr_->findHallsmgr();
 	if (!pServerInfo || !pServerInfo->pSession)
 	{
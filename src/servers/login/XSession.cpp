@@ -21,90 +21,24 @@ XSession::~XSession()
 }
 
 //-------------------------------------------------------------------------------------
-bool XSession::onProcessPacket(SessionID requestorSessionID, const uint8* data, int32 size)
+PacketHandlers& XSession::packetHandlers() const
 {
-	if (header_.msgcmd >= CMD_MAX)
-	{
-		ERROR_MSG(fmt::format("XSession::onProcessPacket(): invalid packet cmd: {}, msgcmd={}, sessionID={}, {}\n",
-			packetHeader().msglen, packetHeader().msgcmd, id(), pTcpSocket()->addr()));
-
-		return true;
-	}
-
-	switch (header_.msgcmd)
-	{
-	case CMD::Login_Signup:
-	{
-		CMD_Login_Signup packet;
-		PARSE_PACKET();
-
-		onSignup(requestorSessionID, packet);
-		break;
-	}
-	case CMD::Login_OnSignupCB:
-	{
-		CMD_Login_OnSignupCB packet;
-		PARSE_PACKET();
-
-		onSignupCB(packet);
-		break;
-	}
-	case CMD::Login_Signin:
-	{
-		CMD_Login_Signin packet;
-		PARSE_PACKET();
-
-		onSignin(requestorSessionID, packet);
-		break;
-	}
-	case CMD::Login_OnSigninCB:
-	{
-		CMD_Login_OnSigninCB packet;
-		PARSE_PACKET();
-
-		onSigninCB(packet);
-		break;
-	}
-	case CMD::Login_OnRequestAllocClientCB:
-	{
-		CMD_Login_OnRequestAllocClientCB packet;
-		PARSE_PACKET();
-
-		onRequestAllocClientCB(packet);
-		break;
-	}
-	case CMD::RemoteDisconnected:
-	{
-		CMD_RemoteDisconnected packet;
-		PARSE_PACKET();
-
-		onRemoteDisconnected(requestorSessionID, packet);
-		break;
-	}
-	default:
-	{
-		ERROR_MSG(fmt::format("XSession::onProcessPacket(): unknown packet cmd: {}, msglen={}, sessionID={}, {}\n",
-			CMD_Name((CMD)packetHeader().msgcmd), packetHeader().msglen, id(), pTcpSocket()->addr()));
-
-		return false;
-		break;
-	}
-	};
-
-	return true;
+	static PacketHandlers handlers("login", &XSession::registerHandlers);
+	return handlers;
 }
 
 //-------------------------------------------------------------------------------------
-bool XSession::onForwardPacket(const CMD_ForwardPacket& packet)
+void XSession::registerHandlers(PacketHandlers& handlers)
 {
-	SessionID sessionID = packet.requestorid();
-	std::string datas = packet.datas();
-
-	PacketHeader& header = packetHeader();
-	header.msgcmd = packet.msgcmd();
-	header.msglen = datas.size();
-
-	return onProcessPacket_(sessionID, (uint8*)(datas.data()), datas.size());
+	Session::registerHandlers(handlers);
+
+	// 客户端的协议由connector转发， 都来自服务器之间的连接
+	handlers.registerHandler<CMD::Login_Signup, CMD_Login_Signup>(&XSession::onSignup, SESSION_KIND_SERVER);
+	handlers.registerHandler<CMD::Login_OnSignupCB, CMD_Login_OnSignupCB>(&XSession::onSignupCB, SESSION_KIND_SERVER);
+	handlers.registerHandler<CMD::Login_Signin, CMD_Login_Signin>(&XSession::onSignin, SESSION_KIND_SERVER);
+	handlers.registerHandler<CMD::Login_OnSigninCB, CMD_Login_OnSigninCB>(&XSession::onSigninCB, SESSION_KIND_SERVER);
+	handlers.registerHandler<CMD::Login_OnRequestAllocClientCB, CMD_Login_OnRequestAllocClientCB>(&XSession::onRequestAllocClientCB, SESSION_KIND_SERVER);
+	handlers.registerHandler<CMD::RemoteDisconnected, CMD_RemoteDisconnected>(&XSession::onRemoteDisconnected, SESSION_KIND_SERVER);
 }
 
 //-------------------------------------------------------------------------------------
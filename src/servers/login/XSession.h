@@ -12,8 +12,8 @@ public:
 	virtual ~XSession();
 
 protected:
-	virtual bool onProcessPacket(SessionID requestorSessionID, const uint8* data, int32 size) override;
-	virtual bool onForwardPacket(const CMD_ForwardPacket& packet) override;
+	virtual PacketHandlers& packetHandlers() const override;
+	static void registerHandlers(PacketHandlers& handlers);
 
 	virtual void onSignup(SessionID requestorSessionID, const CMD_Login_Signup& packet);
 	virtual void onSignin(SessionID requestorSessionID, const CMD_Login_Signin& packet);
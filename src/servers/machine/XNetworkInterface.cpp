@@ -16,9 +16,9 @@ XNetworkInterface::~XNetworkInterface()
 }
 
 //-------------------------------------------------------------------------------------
-Session* XNetworkInterface::createSession_(SessionID sessionID, evutil_socket_t sock)
+Session* XNetworkInterface::createSession_(SessionID sessionID, evutil_socket_t sock, EventDispatcher* pEventDispatcher)
 {
-	return new XSession(sessionID, sock, this, this->pEventDispatcher());
+	return new XSession(sessionID, sock, this, pEventDispatcher);
 }
 
 //-------------------------------------------------------------------------------------
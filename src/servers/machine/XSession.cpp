@@ -21,53 +21,21 @@ XSession::~XSession()
 }
 
 //-------------------------------------------------------------------------------------
-bool XSession::onProcessPacket(SessionID requestorSessionID, const uint8* data, int32 size)
+PacketHandlers& XSession::packetHandlers() const
 {
-	if (header_.msgcmd >= CMD_MAX)
-	{
-		ERROR_MSG(fmt::format("XSession::onProcessPacket(): invalid packet cmd: {}, msgcmd={}, sessionID={}, {}\n",
-			packetHeader().msglen, packetHeader().msgcmd, id(), pTcpSocket()->addr()));
-
-		return true;
-	}
-
-	switch (header_.msgcmd)
-	{
-	case CMD::Machine_RequestCreateRoom:
-	{
-		CMD_Machine_RequestCreateRoom packet;
-		PARSE_PACKET();
-
-		onRequestCreateRoom(packet);
-		break;
-	}
-	case CMD::Machine_RoomSrvReportAddr:
-	{
-		CMD_Machine_RoomSrvReportAddr packet;
-		PARSE_PACKET();
-
-		onRoomSrvReportAddr(packet);
-		break;
-	}
-	case CMD::Machine_OnRoomSrvGameOverReport:
-	{
-		CMD_Machine_OnRoomSrvGameOverReport packet;
-		PARSE_PACKET();
-
-		onRoomSrvGameOverReport(packet);
-		break;
-	}
-	default:
-	{
-		ERROR_MSG(fmt::format("XSession::onProcessPacket(): unknown packet cmd: {}, msglen={}, sessionID={}, {}\n",
-			CMD_Name((CMD)packetHeader().msgcmd), packetHeader().msglen, id(), pTcpSocket()->addr()));
+	static PacketHandlers handlers("machine", &XSession::registerHandlers);
+	return handlers;
+}
 
-		return false;
-		break;
-	}
-	};
+//-------------------------------------------------------------------------------------
+void XSession::registerHandlers(PacketHandlers& handlers)
+{
+	Session::registerHandlers(handlers);
 
-	return true;
+	// 客户端的协议由connector转发， 都来自服务器之间的连接
+	handlers.registerHandler<CMD::Machine_RequestCreateRoom, CMD_Machine_RequestCreateRoom>(&XSession::onRequestCreateRoom, SESSION_KIND_SERVER);
+	handlers.registerHandler<CMD::Machine_RoomSrvReportAddr, CMD_Machine_RoomSrvReportAddr>(&XSession::onRoomSrvReportAddr, SESSION_KIND_SERVER);
+	handlers.registerHandler<CMD::Machine_OnRoomSrvGameOverReport, CMD_Machine_OnRoomSrvGameOverReport>(&XSession::onRoomSrvGameOverReport, SESSION_KIND_SERVER);
 }
 
 //-------------------------------------------------------------------------------------
@@ -12,7 +12,8 @@ public:
 	virtual ~XSession();
 
 protected:
-	virtual bool onProcessPacket(SessionID requestorSessionID, const uint8* data, int32 size) override;
+	virtual PacketHandlers& packetHandlers() const override;
+	static void registerHandlers(PacketHandlers& handlers);
 
 	virtual void onRequestCreateRoom(const CMD_Machine_RequestCreateRoom& packet);
 	virtual void onRoomSrvReportAddr(const CMD_Machine_RoomSrvReportAddr& packet);
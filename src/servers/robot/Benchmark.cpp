@@ -0,0 +1,1249 @@
+#include "Benchmark.h"
+#include "event/common.h"
+#include "event/SessionCipher.h"
+#include "event/ShmChannel.h"
+#include "event/EventDispatcher.h"
+#include "event/IoUring.h"
+#include "event/TcpSocket.h"
+#include "event/AcceptFilter.h"
+#include "event/BufferPool.h"
+#include <event2/buffer.h>
+#include <malloc.h>
+#include <poll.h>
+#include <sys/epoll.h>
+
+namespace XServer {
+
+namespace {
+
+	typedef std::chrono::steady_clock Clock;
+
+	const uint32 FRAME_SIZES[] = { 128, 1024, 16384, 65536 };
+
+	// 每种大小处理的总字节数
+	const uint64 BENCH_BYTES = 256ULL * 1024 * 1024;
+
+	// 和Session::reservePacket/commitPacket/decryptFrame相同的路径:
+	// 在发送缓冲区中预留整帧， 写入包体后原地加密， 接收端在缓冲区中原地解密后取走
+	bool cipherRound(SessionCipher* pSender, SessionCipher* pReceiver, struct evbuffer* pBuffer, uint32 size)
+	{
+		uint32 headerSize = PacketHeader::size(FRAME_VERSION_2);
+		uint32 trailerSize = pSender ? (uint32)SessionCipher::TAG_SIZE : 0;
+		uint32 frameLength = headerSize + size + trailerSize;
+
+		struct evbuffer_iovec vec;
+		if (evbuffer_reserve_space(pBuffer, frameLength, &vec, 1) != 1)
+			return false;
+
+		uint8* pHeader = (uint8*)vec.iov_base;
+
+		PacketHeader header;
+		header.msglen = size + trailerSize;
+		header.msgcmd = 1;
+		header.flags = 0;
+		header.encode(FRAME_VERSION_2, pHeader);
+
+		// 模拟序列化写入包体
+		memset(pHeader + headerSize, (int)(size & 0xff), size);
+
+		if (pSender && !pSender->seal(pHeader, headerSize, pHeader + headerSize, size, pHeader + headerSize + size))
+			return false;
+
+		vec.iov_len = frameLength;
+		if (evbuffer_commit_space(pBuffer, &vec, 1) != 0)
+			return false;
+
+		if (pReceiver)
+		{
+			uint8 headerData[PACKET_HEADER_SIZE_MAX];
+			uint8 tag[SessionCipher::TAG_SIZE];
+			struct evbuffer_ptr ptr;
+
+			if (evbuffer_copyout(pBuffer, headerData, headerSize) != (ev_ssize_t)headerSize ||
+				evbuffer_ptr_set(pBuffer, &ptr, headerSize + size, EVBUFFER_PTR_SET) != 0 ||
+				evbuffer_copyout_from(pBuffer, &ptr, tag, sizeof(tag)) != (ev_ssize_t)sizeof(tag) ||
+				!pReceiver->open(headerData, headerSize, pBuffer, headerSize, size, tag))
+			{
+				return false;
+			}
+		}
+
+		return evbuffer_drain(pBuffer, frameLength) == 0;
+	}
+
+	int benchmarkCipher()
+	{
+		printf("%s", fmt::format("{:<20} {:>8} {:>12} {:>10}\n", "cipher", "size", "MB/s", "vs plain").c_str());
+
+		for (uint32 size : FRAME_SIZES)
+		{
+			double plainRate = 0.0;
+
+			for (int type = CIPHER_NONE; type <= CIPHER_MAX; ++type)
+			{
+				SessionCipher sender, receiver;
+
+				if (type != CIPHER_NONE)
+				{
+					std::string senderKey, receiverKey;
+					if (!sender.generateKey(senderKey) || !receiver.generateKey(receiverKey) ||
+						!sender.deriveKeys((CipherType)type, receiverKey, true) ||
+						!receiver.deriveKeys((CipherType)type, senderKey, false))
+					{
+						printf("%s", fmt::format("{}: key exchange failed!\n", SessionCipher::typeName((CipherType)type)).c_str());
+						return 1;
+					}
+				}
+
+				struct evbuffer* pBuffer = evbuffer_new();
+				uint64 rounds = BENCH_BYTES / size;
+
+				Clock::time_point start = Clock::now();
+
+				for (uint64 i = 0; i < rounds; ++i)
+				{
+					if (!cipherRound(type != CIPHER_NONE ? &sender : NULL, type != CIPHER_NONE ? &receiver : NULL, pBuffer, size))
+					{
+						printf("%s", fmt::format("{}: round {} failed!\n", SessionCipher::typeName((CipherType)type), i).c_str());
+						evbuffer_free(pBuffer);
+						return 1;
+					}
+				}
+
+				double seconds = std::chrono::duration<double>(Clock::now() - start).count();
+				evbuffer_free(pBuffer);
+
+				double rate = (double)(rounds * size) / (1024.0 * 1024.0) / seconds;
+				if (type == CIPHER_NONE)
+					plainRate = rate;
+
+				printf("%s", fmt::format("{:<20} {:>8} {:>12.1f} {:>9.1f}%\n",
+					SessionCipher::typeName((CipherType)type), size, rate, rate * 100.0 / plainRate).c_str());
+			}
+		}
+
+		return 0;
+	}
+
+	const uint32 PINGPONG_SIZE = 64;
+	const uint32 PINGPONG_ROUNDS = 100000;
+	const uint32 STREAM_SIZES[] = { 64, 1024, 16384 };
+
+	// 连接的一端， 阻塞收发
+	class Endpoint
+	{
+	public:
+		virtual ~Endpoint() {}
+
+		virtual bool send(const uint8* data, uint32 size) = 0;
+		virtual bool recv(uint8* dest, uint32 size) = 0;
+	};
+
+	class TcpEndpoint : public Endpoint
+	{
+	public:
+		explicit TcpEndpoint(int fd) : fd_(fd) {}
+
+		virtual ~TcpEndpoint() {
+			if (fd_ >= 0)
+				::close(fd_);
+		}
+
+		virtual bool send(const uint8* data, uint32 size) override {
+			while (size > 0)
+			{
+				ssize_t n = ::send(fd_, data, size, MSG_NOSIGNAL);
+				if (n <= 0)
+					return false;
+
+				data += n;
+				size -= (uint32)n;
+			}
+
+			return true;
+		}
+
+		virtual bool recv(uint8* dest, uint32 size) override {
+			return ::recv(fd_, dest, size, MSG_WAITALL) == (ssize_t)size;
+		}
+
+	private:
+		int fd_;
+	};
+
+	class ShmEndpoint : public Endpoint
+	{
+	public:
+		explicit ShmEndpoint(ShmChannel& channel) : channel_(channel) {}
+
+		// 写满或读空时ShmChannel已经登记等待， 在eventfd上睡眠直到对端唤醒
+		virtual bool send(const uint8* data, uint32 size) override {
+			uint32 written = 0;
+			while (written < size)
+			{
+				uint32 n = channel_.write(data + written, size - written);
+				written += n;
+
+				if (written < size && n == 0 && !wait())
+					return false;
+			}
+
+			return true;
+		}
+
+		virtual bool recv(uint8* dest, uint32 size) override {
+			uint32 got = 0;
+			while (got < size)
+			{
+				uint32 n = channel_.read(dest + got, size - got);
+				got += n;
+
+				if (got < size && n == 0 && !wait())
+					return false;
+			}
+
+			return true;
+		}
+
+	private:
+		bool wait() {
+			struct pollfd pfd;
+			pfd.fd = channel_.wakeupFd();
+			pfd.events = POLLIN;
+			pfd.revents = 0;
+
+			if (poll(&pfd, 1, 1000) <= 0)
+				return false;
+
+			channel_.clearWakeup();
+			return true;
+		}
+
+		ShmChannel& channel_;
+	};
+
+	// 回环上的一对已连接的TCP socket， 和服务器之间的连接一样关闭Nagle
+	bool tcpPair(int& client, int& server)
+	{
+		int listener = ::socket(AF_INET, SOCK_STREAM, 0);
+
+		struct sockaddr_in addr;
+		memset(&addr, 0, sizeof(addr));
+		addr.sin_family = AF_INET;
+		addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+		socklen_t len = sizeof(addr);
+
+		client = server = -1;
+
+		if (listener >= 0 && ::bind(listener, (struct sockaddr*)&addr, len) == 0 && ::listen(listener, 1) == 0 &&
+			getsockname(listener, (struct sockaddr*)&addr, &len) == 0)
+		{
+			client = ::socket(AF_INET, SOCK_STREAM, 0);
+			if (client >= 0 && ::connect(client, (struct sockaddr*)&addr, len) == 0)
+				server = ::accept(listener, NULL, NULL);
+		}
+
+		if (listener >= 0)
+			::close(listener);
+
+		if (server < 0)
+		{
+			if (client >= 0)
+				::close(client);
+
+			return false;
+		}
+
+		int nodelay = 1;
+		setsockopt(client, IPPROTO_TCP, TCP_NODELAY, &nodelay, sizeof(nodelay));
+		setsockopt(server, IPPROTO_TCP, TCP_NODELAY, &nodelay, sizeof(nodelay));
+		return true;
+	}
+
+	// 一端发出后等待对端原样返回， 统计往返时间
+	bool pingpong(const char* transport, Endpoint& client, Endpoint& server)
+	{
+		std::thread echo([&server]() {
+			uint8 data[PINGPONG_SIZE];
+			for (uint32 i = 0; i < PINGPONG_ROUNDS; ++i)
+			{
+				if (!server.recv(data, sizeof(data)) || !server.send(data, sizeof(data)))
+					return;
+			}
+		});
+
+		std::vector<double> rtts;
+		rtts.reserve(PINGPONG_ROUNDS);
+
+		uint8 data[PINGPONG_SIZE];
+		memset(data, 0x5a, sizeof(data));
+
+		bool ret = true;
+		for (uint32 i = 0; i < PINGPONG_ROUNDS && ret; ++i)
+		{
+			Clock::time_point start = Clock::now();
+			ret = client.send(data, sizeof(data)) && client.recv(data, sizeof(data));
+			rtts.push_back(std::chrono::duration<double, std::micro>(Clock::now() - start).count());
+		}
+
+		echo.join();
+
+		if (!ret)
+		{
+			printf("%s", fmt::format("{}: pingpong failed!\n", transport).c_str());
+			return false;
+		}
+
+		double total = 0.0;
+		for (double rtt : rtts)
+			total += rtt;
+
+		std::sort(rtts.begin(), rtts.end());
+
+		printf("%s", fmt::format("{:<8} {:<10} {:>8} {:>12.2f}us {:>10.2f}us(p99)\n", transport, "pingpong", PINGPONG_SIZE,
+			total / rtts.size(), rtts[rtts.size() * 99 / 100]).c_str());
+
+		return true;
+	}
+
+	// 单向连续发送， 对端全部收到为止
+	bool stream(const char* transport, Endpoint& client, Endpoint& server, uint32 size, const ShmChannel* pChannel)
+	{
+		uint64 rounds = BENCH_BYTES / size;
+		bool received = false;
+
+		std::thread reader([&server, &received, size, rounds]() {
+			std::vector<uint8> data(size);
+			for (uint64 i = 0; i < rounds; ++i)
+			{
+				if (!server.recv(&data[0], size))
+					return;
+			}
+
+			received = true;
+		});
+
+		std::vector<uint8> data(size, 0x5a);
+		uint64 notifications = pChannel ? pChannel->notifications() : 0;
+
+		Clock::time_point start = Clock::now();
+
+		bool ret = true;
+		for (uint64 i = 0; i < rounds && ret; ++i)
+			ret = client.send(&data[0], size);
+
+		reader.join();
+
+		double seconds = std::chrono::duration<double>(Clock::now() - start).count();
+
+		if (!ret || !received)
+		{
+			printf("%s", fmt::format("{}: stream {} failed!\n", transport, size).c_str());
+			return false;
+		}
+
+		std::string extra;
+		if (pChannel)
+			extra = fmt::format("  eventfd {:.4f}/msg", (double)(pChannel->notifications() - notifications) / rounds);
+
+		printf("%s", fmt::format("{:<8} {:<10} {:>8} {:>12.1f}MB/s {:>10.2f}M msg/s{}\n", transport, "stream", size,
+			(double)(rounds * size) / (1024.0 * 1024.0) / seconds, (double)rounds / seconds / 1000000.0, extra).c_str());
+
+		return true;
+	}
+
+	int benchmarkShm()
+	{
+		int clientFd, serverFd;
+		if (!tcpPair(clientFd, serverFd))
+		{
+			printf("tcp: create loopback connection failed!\n");
+			return 1;
+		}
+
+		ShmChannel serverChannel, clientChannel;
+		if (!serverChannel.create(4 * 1024 * 1024) || !clientChannel.attach(serverChannel))
+		{
+			printf("shm: create channel failed!\n");
+			::close(clientFd);
+			::close(serverFd);
+			return 1;
+		}
+
+		TcpEndpoint tcpClient(clientFd), tcpServer(serverFd);
+		ShmEndpoint shmClient(clientChannel), shmServer(serverChannel);
+
+		printf("%s", fmt::format("{:<8} {:<10} {:>8} {:>14} {:>12}\n", "link", "test", "size", "result", "").c_str());
+
+		if (!pingpong("tcp", tcpClient, tcpServer) || !pingpong("shm", shmClient, shmServer))
+			return 1;
+
+		for (uint32 size : STREAM_SIZES)
+		{
+			if (!stream("tcp", tcpClient, tcpServer, size, NULL) || !stream("shm", shmClient, shmServer, size, &clientChannel))
+				return 1;
+		}
+
+		return 0;
+	}
+
+	// 连接器的负载： 大量客户端连接各自不停发来小包， 服务器在同一个循环中转发出去(这里原样写回)
+	const uint32 FORWARD_CONNECTIONS = 256;
+	const uint32 FORWARD_WINDOW = 8;
+	const uint32 FORWARD_SIZES[] = { 64, 512 };
+	const uint64 FORWARD_MESSAGES = 2000000;
+	const uint32 ACCEPT_ROUNDS = 20000;
+	const uint32 ACCEPT_BATCH = 64;
+
+	const uint32 URING_ENTRIES = 4096;
+	const uint32 URING_BUFFERS = 2048;
+	const uint32 URING_BUFFER_SIZE = 4096;
+
+	// 当前线程用掉的CPU时间(秒)
+	double threadCPU()
+	{
+		struct timespec ts;
+		clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts);
+		return ts.tv_sec + ts.tv_nsec / 1e9;
+	}
+
+	// 在独立线程中运行服务器一侧的事件循环， 结束时统计该线程的开销
+	class ServerLoop
+	{
+	public:
+		ServerLoop() : dispatcher_(), pThread_(NULL), cpu_(0.0) {}
+
+		~ServerLoop() {
+			stop();
+		}
+
+		bool initialize(bool uring, const LoopConfig& config = LoopConfig()) {
+			if (!dispatcher_.initialize(config))
+				return false;
+
+			return !uring || dispatcher_.enableIoUring(URING_ENTRIES, URING_BUFFERS, URING_BUFFER_SIZE);
+		}
+
+		EventDispatcher& dispatcher() {
+			return dispatcher_;
+		}
+
+		double cpu() const {
+			return cpu_;
+		}
+
+		uint64 enters() {
+			return dispatcher_.pIoUring() ? dispatcher_.pIoUring()->stats().enters : 0;
+		}
+
+		void start() {
+			pThread_ = new std::thread([this]() {
+				double start = threadCPU();
+				dispatcher_.dispatch(EVLOOP_NO_EXIT_ON_EMPTY);
+				cpu_ = threadCPU() - start;
+			});
+		}
+
+		void stop() {
+			if (!pThread_)
+				return;
+
+			EventDispatcher* pEventDispatcher = &dispatcher_;
+			dispatcher_.post([pEventDispatcher]() { pEventDispatcher->breakDispatch(); });
+			pThread_->join();
+			SAFE_RELEASE(pThread_);
+		}
+
+	private:
+		EventDispatcher dispatcher_;
+		std::thread* pThread_;
+		double cpu_;
+	};
+
+	void forwardCallback(struct bufferevent* bev, void* arg)
+	{
+		TcpSocket* pTcpSocket = (TcpSocket*)arg;
+		evbuffer_add_buffer(pTcpSocket->getSendEvbuffer(), pTcpSocket->getRecvEvbuffer());
+	}
+
+	bool sendAll(int fd, const uint8* data, size_t size)
+	{
+		while (size > 0)
+		{
+			ssize_t n = ::send(fd, data, size, MSG_NOSIGNAL);
+			if (n < 0 && errno == EAGAIN)
+			{
+				struct pollfd pfd;
+				pfd.fd = fd;
+				pfd.events = POLLOUT;
+				pfd.revents = 0;
+
+				if (poll(&pfd, 1, 1000) <= 0)
+					return false;
+
+				continue;
+			}
+
+			if (n <= 0)
+				return false;
+
+			data += n;
+			size -= (size_t)n;
+		}
+
+		return true;
+	}
+
+	// 每个连接保持FORWARD_WINDOW个包在路上， 收到多少就再发多少
+	bool forward(const char* backend, bool uring, uint32 size, const LoopConfig& config = LoopConfig())
+	{
+		ServerLoop server;
+		if (!server.initialize(uring, config))
+		{
+			printf("%s", fmt::format("{}: create event loop failed!\n", backend).c_str());
+			return false;
+		}
+
+		std::vector<int> clients;
+		std::vector<TcpSocket*> sockets;
+		bool ret = true;
+
+		int epfd = epoll_create1(EPOLL_CLOEXEC);
+		std::vector<uint8> data(size * FORWARD_WINDOW, 0x5a);
+
+		for (uint32 i = 0; i < FORWARD_CONNECTIONS && ret; ++i)
+		{
+			int clientFd, serverFd;
+			if (!tcpPair(clientFd, serverFd))
+			{
+				ret = false;
+				break;
+			}
+
+			evutil_make_socket_nonblocking(serverFd);
+			evutil_make_socket_nonblocking(clientFd);
+			clients.push_back(clientFd);
+
+			TcpSocket* pTcpSocket = new TcpSocket(&server.dispatcher(), serverFd);
+			sockets.push_back(pTcpSocket);
+			ret = pTcpSocket->setcb(forwardCallback, NULL, NULL, pTcpSocket);
+
+			struct epoll_event ev;
+			ev.events = EPOLLIN;
+			ev.data.u32 = i;
+			ret = ret && epoll_ctl(epfd, EPOLL_CTL_ADD, clientFd, &ev) == 0;
+		}
+
+		server.start();
+
+		uint64 sent = 0, received = 0;
+		std::vector<uint32> partial(clients.size(), 0);
+		std::vector<uint8> buffer(65536);
+
+		Clock::time_point start = Clock::now();
+
+		for (size_t i = 0; i < clients.size() && ret; ++i)
+		{
+			ret = sendAll(clients[i], &data[0], data.size());
+			sent += FORWARD_WINDOW;
+		}
+
+		while (ret && received < FORWARD_MESSAGES)
+		{
+			struct epoll_event events[64];
+			int n = epoll_wait(epfd, events, 64, 1000);
+			if (n <= 0)
+			{
+				ret = false;
+				break;
+			}
+
+			for (int i = 0; i < n && ret; ++i)
+			{
+				uint32 index = events[i].data.u32;
+				uint64 bytes = partial[index];
+
+				ssize_t len;
+				while ((len = ::recv(clients[index], &buffer[0], buffer.size(), 0)) > 0)
+					bytes += (uint64)len;
+
+				uint64 messages = bytes / size;
+				partial[index] = (uint32)(bytes % size);
+				received += messages;
+
+				uint64 more = std::min<uint64>(messages, FORWARD_MESSAGES > sent ? FORWARD_MESSAGES - sent : 0);
+				if (more > 0)
+				{
+					ret = sendAll(clients[index], &data[0], (size_t)more * size);
+					sent += more;
+				}
+			}
+		}
+
+		double seconds = std::chrono::duration<double>(Clock::now() - start).count();
+		server.stop();
+
+		for (auto& item : sockets)
+			delete item;
+
+		for (auto& item : clients)
+			::close(item);
+
+		::close(epfd);
+
+		if (!ret)
+		{
+			printf("%s", fmt::format("{}: forward {} failed! received={}\n", backend, size, received).c_str());
+			return false;
+		}
+
+		std::string extra;
+		if (uring)
+			extra = fmt::format("  enter {:.3f}/msg", (double)server.enters() / received);
+
+		printf("%s", fmt::format("{:<10} {:<8} {:>6} {:>10.2f}M msg/s {:>10.0f}ns cpu/msg{}\n",
+			backend, "forward", size, (double)received / seconds / 1000000.0, server.cpu() * 1e9 / received, extra).c_str());
+
+		return true;
+	}
+
+	void acceptCallback(evutil_socket_t fd, std::atomic<uint32>* pAccepted)
+	{
+		evutil_closesocket(fd);
+		++(*pAccepted);
+	}
+
+	void listenerCallback(struct evconnlistener* listener, evutil_socket_t fd, struct sockaddr* addr, int len, void* arg)
+	{
+		acceptCallback(fd, (std::atomic<uint32>*)arg);
+	}
+
+	void uringAcceptCallback(IoUring::Op* pOp, int res, uint32 flags)
+	{
+		if (res >= 0)
+			acceptCallback(res, (std::atomic<uint32>*)pOp->arg);
+	}
+
+	// 短连接风暴： 客户端连上立即以RST断开， 服务器accept后关闭
+	bool acceptStorm(const char* backend, bool uring)
+	{
+		ServerLoop server;
+		if (!server.initialize(uring))
+		{
+			printf("%s", fmt::format("{}: create event loop failed!\n", backend).c_str());
+			return false;
+		}
+
+		int listener = ::socket(AF_INET, SOCK_STREAM, 0);
+
+		struct sockaddr_in addr;
+		memset(&addr, 0, sizeof(addr));
+		addr.sin_family = AF_INET;
+		addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+		socklen_t len = sizeof(addr);
+
+		if (listener < 0 || ::bind(listener, (struct sockaddr*)&addr, len) != 0 || ::listen(listener, 1024) != 0 ||
+			getsockname(listener, (struct sockaddr*)&addr, &len) != 0)
+		{
+			printf("%s", fmt::format("{}: listen failed!\n", backend).c_str());
+			if (listener >= 0)
+				::close(listener);
+
+			return false;
+		}
+
+		evutil_make_socket_nonblocking(listener);
+
+		std::atomic<uint32> accepted(0);
+		struct evconnlistener* pEventListener = NULL;
+		IoUring::Op* pAcceptOp = NULL;
+
+		if (uring)
+		{
+			pAcceptOp = new IoUring::Op(uringAcceptCallback, &accepted);
+			server.dispatcher().pIoUring()->accept(pAcceptOp, listener);
+		}
+		else
+		{
+			pEventListener = evconnlistener_new(server.dispatcher().base(), listenerCallback, &accepted, 0, -1, listener);
+		}
+
+		server.start();
+
+		Clock::time_point start = Clock::now();
+
+		struct linger lingerOpt;
+		lingerOpt.l_onoff = 1;
+		lingerOpt.l_linger = 0;
+
+		bool ret = true;
+		for (uint32 i = 0; i < ACCEPT_ROUNDS && ret; ++i)
+		{
+			int fd = ::socket(AF_INET, SOCK_STREAM, 0);
+			ret = fd >= 0 && ::connect(fd, (struct sockaddr*)&addr, len) == 0;
+
+			if (fd >= 0)
+			{
+				setsockopt(fd, SOL_SOCKET, SO_LINGER, &lingerOpt, sizeof(lingerOpt));
+				::close(fd);
+			}
+
+			// 每批等服务器接收完， 不让监听队列溢出后等SYN重传
+			if ((i + 1) % ACCEPT_BATCH == 0)
+			{
+				Clock::time_point wait = Clock::now();
+				while (accepted < i + 1 && Clock::now() - wait < std::chrono::seconds(1))
+					std::this_thread::yield();
+			}
+		}
+
+		// 监听队列满时丢掉的连接不会再到达， 等到不再增加为止
+		uint32 last = 0;
+		Clock::time_point end = Clock::now();
+		while (ret && accepted < ACCEPT_ROUNDS && Clock::now() - end < std::chrono::milliseconds(200))
+		{
+			std::this_thread::sleep_for(std::chrono::milliseconds(1));
+
+			if (accepted != last)
+			{
+				last = accepted;
+				end = Clock::now();
+			}
+		}
+
+		double seconds = std::chrono::duration<double>(end - start).count();
+		uint32 count = accepted;
+		server.stop();
+
+		if (pAcceptOp)
+			server.dispatcher().pIoUring()->release(pAcceptOp);
+
+		if (pEventListener)
+			evconnlistener_free(pEventListener);
+
+		::close(listener);
+
+		if (!ret || count < ACCEPT_ROUNDS * 9 / 10)
+		{
+			printf("%s", fmt::format("{}: accept failed! accepted={}\n", backend, count).c_str());
+			return false;
+		}
+
+		std::string extra;
+		if (uring)
+			extra = fmt::format("  enter {:.3f}/conn", (double)server.enters() / count);
+
+		printf("%s", fmt::format("{:<10} {:<8} {:>6} {:>10.2f}K conn/s {:>9.0f}ns cpu/conn{}\n",
+			backend, "accept", "", count / seconds / 1000.0, server.cpu() * 1e9 / count, extra).c_str());
+
+		return true;
+	}
+
+	int benchmarkUring()
+	{
+		// 结束时从主线程投递任务给服务器循环
+		EventDispatcher::enableThreads();
+
+		{
+			ServerLoop probe;
+			if (!probe.initialize(true))
+			{
+				printf("io_uring is not available on this kernel!\n");
+				return 1;
+			}
+		}
+
+		printf("%s", fmt::format("{:<10} {:<8} {:>6} {:>17} {:>18}\n", "backend", "test", "size", "throughput", "server cpu").c_str());
+
+		for (uint32 size : FORWARD_SIZES)
+		{
+			if (!forward("libevent", false, size) || !forward("io_uring", true, size))
+				return 1;
+		}
+
+		if (!acceptStorm("libevent", false) || !acceptStorm("io_uring", true))
+			return 1;
+
+		return 0;
+	}
+
+	const uint32 ACL_SIZES[] = { 8, 256, 4096 };
+
+	// 每种白名单长度查询的次数
+	const uint32 ACL_LOOKUPS = 1000000;
+
+	// 原来onAccepted中的做法： 转成字符串后逐个比较
+	bool stringMatch(const std::vector<std::string>& addresses, const struct sockaddr_in& addr)
+	{
+		std::string sockIP = inet_ntoa(addr.sin_addr);
+
+		for (auto& item : addresses)
+		{
+			if (item == sockIP)
+				return true;
+		}
+
+		return false;
+	}
+
+	int benchmarkAcl()
+	{
+		printf("%s", fmt::format("{:<10} {:>8} {:>14} {:>14}\n", "allowlist", "entries", "strings", "trie").c_str());
+
+		std::mt19937 random(1);
+
+		for (uint32 entries : ACL_SIZES)
+		{
+			std::vector<std::string> addresses;
+			AddressTrie trie;
+
+			for (uint32 i = 0; i < entries; ++i)
+			{
+				std::string addr = fmt::format("10.{}.{}.{}", (i >> 16) & 0xff, (i >> 8) & 0xff, i & 0xff);
+				addresses.push_back(addr);
+				trie.add(addr);
+			}
+
+			// 一半命中白名单
+			std::vector<struct sockaddr_in> queries(4096);
+			for (auto& query : queries)
+			{
+				memset(&query, 0, sizeof(query));
+				query.sin_family = AF_INET;
+
+				uint32 v = random();
+				uint32 ip = (v & 1) ? ((10u << 24) | ((v >> 1) % entries)) : (v | 0x80000000u);
+				query.sin_addr.s_addr = htonl(ip);
+			}
+
+			double ns[2] = { 0, 0 };
+			uint64 hits[2] = { 0, 0 };
+
+			for (int method = 0; method < 2; ++method)
+			{
+				Clock::time_point start = Clock::now();
+
+				for (uint32 i = 0; i < ACL_LOOKUPS; ++i)
+				{
+					const struct sockaddr_in& query = queries[i & (queries.size() - 1)];
+
+					if (method == 0)
+					{
+						hits[method] += stringMatch(addresses, query);
+					}
+					else
+					{
+						IPPrefix addr;
+						IPPrefix::fromSockaddr((const struct sockaddr*)&query, addr);
+						hits[method] += trie.match(addr);
+					}
+				}
+
+				ns[method] = std::chrono::duration<double, std::nano>(Clock::now() - start).count() / ACL_LOOKUPS;
+			}
+
+			if (hits[0] != hits[1])
+			{
+				printf("%s", fmt::format("allowlist: results differ! strings={}, trie={}\n", hits[0], hits[1]).c_str());
+				return 1;
+			}
+
+			printf("%s", fmt::format("{:<10} {:>8} {:>11.1f}ns {:>11.1f}ns\n", "lookup", entries, ns[0], ns[1]).c_str());
+		}
+
+		// 4096个来源前缀轮流连接， 每个前缀超过突发数之后被限流
+		AcceptLimiter limiter;
+		limiter.setup("benchmark", 100, 200, 24, 64);
+
+		uint64 nowMS = 1000000;
+		uint64 accepted = 0;
+		Clock::time_point start = Clock::now();
+
+		for (uint32 i = 0; i < ACL_LOOKUPS; ++i)
+		{
+			IPPrefix addr;
+			addr.len = 32;
+			addr.addr[0] = 100;
+			addr.addr[1] = (uint8)(i >> 4);
+			addr.addr[2] = (uint8)(i & 0x0f);
+
+			if ((i & 0xffff) == 0)
+				++nowMS;
+
+			accepted += limiter.acquire(addr, nowMS);
+		}
+
+		double ns = std::chrono::duration<double, std::nano>(Clock::now() - start).count() / ACL_LOOKUPS;
+		printf("%s", fmt::format("{:<10} {:>8} {:>11.1f}ns   accepted={}, throttled prefixes={}\n",
+			"limiter", 4096, ns, accepted, limiter.throttled()).c_str());
+
+		return 0;
+	}
+
+	// 客户端连接一直有数据可读， 每次读取处理FLOOD_WORK_US
+	const uint32 FLOOD_SOCKETS = 64;
+	const uint32 FLOOD_WORK_US = 20;
+
+	// 服务器连接每隔PING_INTERVAL_US收到一个带发送时间的包
+	const uint32 PING_INTERVAL_US = 1000;
+	const uint32 PRIORITY_SECONDS = 2;
+
+	uint64 benchNowUs()
+	{
+		return (uint64)std::chrono::duration_cast<std::chrono::microseconds>(Clock::now().time_since_epoch()).count();
+	}
+
+	struct PriorityBench
+	{
+		uint64 floodReads;
+		std::vector<uint64> latencies;
+	};
+
+	void floodCallback(evutil_socket_t fd, short events, void *ctx)
+	{
+		char data[4096];
+		while (::recv(fd, data, sizeof(data), 0) > 0)
+			;
+
+		uint64 end = benchNowUs() + FLOOD_WORK_US;
+		while (benchNowUs() < end)
+			;
+
+		++((PriorityBench*)ctx)->floodReads;
+	}
+
+	void pingCallback(evutil_socket_t fd, short events, void *ctx)
+	{
+		PriorityBench* pBench = (PriorityBench*)ctx;
+
+		uint64 stamps[64];
+		ev_ssize_t n = 0;
+		while ((n = ::recv(fd, (char*)stamps, sizeof(stamps), 0)) > 0)
+		{
+			uint64 now = benchNowUs();
+			for (ev_ssize_t i = 0; i < n / (ev_ssize_t)sizeof(uint64); ++i)
+				pBench->latencies.push_back(now - stamps[i]);
+		}
+	}
+
+	// 客户端连接被灌满时服务器连接上的包等多久才被处理， prioritized为false时两者同级
+	bool priorityFlood(bool prioritized)
+	{
+		const char* mode = prioritized ? "prioritized" : "flat";
+
+		EventDispatcher dispatcher;
+		if (!dispatcher.initialize())
+		{
+			printf("%s", fmt::format("{}: create event loop failed!\n", mode).c_str());
+			return false;
+		}
+
+		PriorityBench bench;
+		bench.floodReads = 0;
+
+		std::vector<int> fds;
+		std::vector<struct event*> events;
+		bool ret = true;
+
+		for (uint32 i = 0; i <= FLOOD_SOCKETS && ret; ++i)
+		{
+			int pair[2];
+			if (::socketpair(AF_UNIX, SOCK_STREAM, 0, pair) != 0)
+			{
+				ret = false;
+				break;
+			}
+
+			evutil_make_socket_nonblocking(pair[0]);
+			evutil_make_socket_nonblocking(pair[1]);
+			fds.push_back(pair[0]);
+			fds.push_back(pair[1]);
+
+			// 最后一对是服务器连接
+			bool ping = i == FLOOD_SOCKETS;
+			struct event* ev = event_new(dispatcher.base(), pair[1], EV_READ | EV_PERSIST,
+				ping ? pingCallback : floodCallback, &bench);
+
+			events.push_back(ev);
+			ret = ev && dispatcher.setPriority(ev, (ping && prioritized) ? EVENT_PRIORITY_INTERNAL : EVENT_PRIORITY_EXTERNAL) &&
+				event_add(ev, NULL) == 0;
+		}
+
+		std::atomic<bool> running(ret);
+
+		std::thread flooder([&fds, &running]() {
+			char data = 0;
+			while (running)
+			{
+				for (uint32 i = 0; i < FLOOD_SOCKETS; ++i)
+					::send(fds[i * 2], &data, 1, 0);
+
+				std::this_thread::sleep_for(std::chrono::microseconds(50));
+			}
+		});
+
+		std::thread pinger([&fds, &running]() {
+			while (running)
+			{
+				uint64 stamp = benchNowUs();
+				::send(fds[FLOOD_SOCKETS * 2], (const char*)&stamp, sizeof(stamp), 0);
+				std::this_thread::sleep_for(std::chrono::microseconds(PING_INTERVAL_US));
+			}
+		});
+
+		if (ret)
+		{
+			dispatcher.exitDispatch((float)PRIORITY_SECONDS);
+			ret = dispatcher.dispatch();
+		}
+
+		running = false;
+		flooder.join();
+		pinger.join();
+
+		std::string waits = dispatcher.priorityWaitInfo();
+
+		for (auto& ev : events)
+		{
+			if (ev)
+				event_free(ev);
+		}
+
+		for (auto& fd : fds)
+			evutil_closesocket(fd);
+
+		dispatcher.finalise();
+
+		std::vector<uint64>& latencies = bench.latencies;
+		if (!ret || latencies.size() == 0)
+		{
+			printf("%s", fmt::format("{}: benchmark failed!\n", mode).c_str());
+			return false;
+		}
+
+		uint64 total = 0;
+		for (uint64 latency : latencies)
+			total += latency;
+
+		std::sort(latencies.begin(), latencies.end());
+
+		printf("%s", fmt::format("{:<12} {:>8} {:>10} {:>10} {:>10} {:>12}\n", mode, latencies.size(),
+			total / latencies.size(), latencies[latencies.size() * 99 / 100], latencies.back(), bench.floodReads).c_str());
+
+		printf("%s", fmt::format("{:<12} {}\n", "", waits).c_str());
+		return true;
+	}
+
+	int benchmarkPriority()
+	{
+		printf("%s", fmt::format("{} flooded client sockets, {}us of work per read, one server ping every {}us\n",
+			FLOOD_SOCKETS, FLOOD_WORK_US, PING_INTERVAL_US).c_str());
+
+		printf("%s", fmt::format("{:<12} {:>8} {:>10} {:>10} {:>10} {:>12}\n",
+			"mode", "pings", "avg(us)", "p99(us)", "max(us)", "floodReads").c_str());
+
+		if (!priorityFlood(false) || !priorityFlood(true))
+			return 1;
+
+		return 0;
+	}
+
+	// 每个连接收到一批完整的包和半个包， 完整的包被取走， 剩下的半个包留在接收缓冲区中等后续数据
+	const uint32 IDLE_CONNECTIONS = 2000;
+	const uint32 IDLE_FRAME_SIZE = 1000;
+	const uint32 IDLE_FRAMES = 12;
+	const uint32 IDLE_PARTIAL = 100;
+
+	const uint32 POOL_CHUNK_SIZE = 4096;
+	const uint32 POOL_CHUNK_MAX = 65536;
+	const uint32 POOL_FORWARD_SIZES[] = { 64, 2048 };
+
+	struct IdleConnection
+	{
+		TcpSocket* pTcpSocket;
+		uint32 drained;
+		bool settled;
+		std::atomic<uint32>* pSettled;
+	};
+
+	void idleCallback(struct bufferevent* bev, void* arg)
+	{
+		IdleConnection* pConn = (IdleConnection*)arg;
+
+		uint32 length = pConn->pTcpSocket->getRecvBufferLength();
+		uint32 frames = length - length % IDLE_FRAME_SIZE;
+		pConn->pTcpSocket->drain(frames);
+		pConn->pTcpSocket->compactRecvBuffer();
+		pConn->drained += frames;
+
+		if (!pConn->settled && pConn->drained == IDLE_FRAMES * IDLE_FRAME_SIZE && length - frames == IDLE_PARTIAL)
+		{
+			pConn->settled = true;
+			++(*pConn->pSettled);
+		}
+	}
+
+	// 所有连接都只剩半个包时， 堆上为这些连接多占用的内存
+	bool idleMemory(const char* mode)
+	{
+		EventDispatcher dispatcher;
+		if (!dispatcher.initialize())
+		{
+			printf("%s", fmt::format("{}: create event loop failed!\n", mode).c_str());
+			return false;
+		}
+
+		std::vector<int> clients;
+		std::vector<IdleConnection> conns(IDLE_CONNECTIONS);
+		std::vector<uint8> data(IDLE_FRAMES * IDLE_FRAME_SIZE + IDLE_PARTIAL, 0x5a);
+		std::atomic<uint32> settled(0);
+		bool ret = true;
+
+		malloc_trim(0);
+		size_t heapBefore = mallinfo2().uordblks;
+		uint64 chunksBefore = BufferPool::inUse();
+
+		for (uint32 i = 0; i < IDLE_CONNECTIONS && ret; ++i)
+		{
+			int clientFd, serverFd;
+			if (!tcpPair(clientFd, serverFd))
+			{
+				ret = false;
+				break;
+			}
+
+			evutil_make_socket_nonblocking(serverFd);
+			clients.push_back(clientFd);
+
+			conns[i].pTcpSocket = new TcpSocket(&dispatcher, serverFd);
+			conns[i].drained = 0;
+			conns[i].settled = false;
+			conns[i].pSettled = &settled;
+
+			ret = conns[i].pTcpSocket->setcb(idleCallback, NULL, NULL, &conns[i]) && sendAll(clientFd, &data[0], data.size());
+		}
+
+		Clock::time_point deadline = Clock::now() + std::chrono::seconds(10);
+		while (ret && settled < clients.size() && Clock::now() < deadline)
+			dispatcher.dispatch(EVLOOP_ONCE | EVLOOP_NONBLOCK);
+
+		size_t heap = mallinfo2().uordblks - heapBefore;
+		uint64 chunks = BufferPool::inUse() - chunksBefore;
+		uint32 count = (uint32)clients.size();
+
+		for (auto& item : conns)
+			delete item.pTcpSocket;
+
+		for (auto& item : clients)
+			::close(item);
+
+		if (!ret || settled < count)
+		{
+			printf("%s", fmt::format("{}: idle connections failed! settled={}/{}\n", mode, (uint32)settled, count).c_str());
+			return false;
+		}
+
+		printf("%s", fmt::format("{:<10} {:<8} {:>6} {:>10.0f}B heap/conn {:>8} chunks\n",
+			mode, "idle", IDLE_PARTIAL, (double)heap / count, chunks).c_str());
+
+		return true;
+	}
+
+	// 内存池关闭和开启时分别测试转发的开销和空闲连接的内存， 只使用libevent
+	int benchmarkBufferPool()
+	{
+		EventDispatcher::enableThreads();
+
+		printf("%s", fmt::format("{:<10} {:<8} {:>6} {:>17} {:>18}\n", "buffers", "test", "size", "result", "").c_str());
+
+		for (int pooled = 0; pooled < 2; ++pooled)
+		{
+			const char* mode = pooled ? "pooled" : "evbuffer";
+			BufferPool::setup(pooled ? POOL_CHUNK_SIZE : 0, POOL_CHUNK_MAX);
+
+			for (uint32 size : POOL_FORWARD_SIZES)
+			{
+				if (!forward(mode, false, size))
+					return 1;
+			}
+
+			if (!idleMemory(mode))
+				return 1;
+		}
+
+		printf("%s", fmt::format("pool: {}\n", BufferPool::info()).c_str());
+		return 0;
+	}
+
+	// 内存池开启时用不同的event_base参数转发， 边缘触发只作用于读到池中的socket
+	int benchmarkLoopConfig()
+	{
+		EventDispatcher::enableThreads();
+		BufferPool::setup(POOL_CHUNK_SIZE, POOL_CHUNK_MAX);
+
+		std::vector<std::pair<const char*, LoopConfig> > configs(5);
+		configs[0].first = "default";
+		configs[1].first = "changelist";
+		configs[1].second.changelist = true;
+		configs[2].first = "et";
+		configs[2].second.edgeTriggered = true;
+		configs[3].first = "et+cl";
+		configs[3].second.edgeTriggered = true;
+		configs[3].second.changelist = true;
+		configs[4].first = "et+cl+max";
+		configs[4].second = configs[3].second;
+		configs[4].second.maxDispatch = 64;
+		configs[4].second.dispatchIntervalUs = 2000;
+
+		{
+			EventDispatcher probe;
+			if (probe.initialize(configs[3].second))
+				printf("%s", fmt::format("event loop: {}\n", probe.backendInfo()).c_str());
+		}
+
+		printf("%s", fmt::format("{:<10} {:<8} {:>6} {:>17} {:>18}\n", "config", "test", "size", "throughput", "server cpu").c_str());
+
+		for (auto& item : configs)
+		{
+			for (uint32 size : POOL_FORWARD_SIZES)
+			{
+				if (!forward(item.first, false, size, item.second))
+					return 1;
+			}
+		}
+
+		return 0;
+	}
+
+}
+
+//-------------------------------------------------------------------------------------
+int runBenchmark(const std::string& name)
+{
+	if (name == "cipher")
+		return benchmarkCipher();
+
+	if (name == "shm")
+		return benchmarkShm();
+
+	if (name == "uring")
+		return benchmarkUring();
+
+	if (name == "acl")
+		return benchmarkAcl();
+
+	if (name == "priority")
+		return benchmarkPriority();
+
+	if (name == "bufpool")
+		return benchmarkBufferPool();
+
+	if (name == "loop")
+		return benchmarkLoopConfig();
+
+	printf("%s", fmt::format("unknown benchmark: {}, available: cipher, shm, uring, acl, priority, bufpool, loop\n", name).c_str());
+	return 1;
+}
+
+//-------------------------------------------------------------------------------------
+}
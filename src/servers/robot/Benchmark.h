@@ -0,0 +1,22 @@
+#ifndef X_BENCHMARK_H
+#define X_BENCHMARK_H
+
+#include "common/common.h"
+
+namespace XServer {
+
+/*
+	网络层的微基准测试， 不连接任何服务器， 结果直接输出到控制台
+	robot --benchmark=cipher
+	robot --benchmark=shm
+	robot --benchmark=uring
+	robot --benchmark=acl
+	robot --benchmark=priority
+	robot --benchmark=bufpool
+	robot --benchmark=loop
+*/
+int runBenchmark(const std::string& name);
+
+}
+
+#endif // X_BENCHMARK_H
@@ -13,8 +13,8 @@ namespace XServer {
 
 //-------------------------------------------------------------------------------------
 XRobot::XRobot():
-tickTimerEvent_(NULL),
-heartbeatTickTimerEvent_(NULL),
+tickTimerEvent_(TIMER_HANDLE_INVALID),
+heartbeatTickTimerEvent_(TIMER_HANDLE_INVALID),
 pXServer_(NULL),
 botState_(directory_connect),
 botDoneState_(playing),
@@ -38,103 +38,10 @@ XRobot::~XRobot()
 	finalise();
 }
 
-//-------------------------------------------------------------------------------------
-void XRobot::onProcessPacket(Session* pSession, const uint8* data, int32 size)
-{
-	const PacketHeader& header = pSession->packetHeader();
-	if (header.msgcmd <= Client_Begin || header.msgcmd >= Client_End)
-		assert(false);
-	
-	switch (header.msgcmd)
-	{
-	case CMD::Client_OnSignupCB:
-	{
-		CMD_Client_OnSignupCB packet;
-		packet.ParseFromArray(data, header.msglen);
-
-		onSignupCB(packet);
-		break;
-	}
-	case CMD::Client_OnSigninCB:
-	{
-		CMD_Client_OnSigninCB packet;
-		packet.ParseFromArray(data, header.msglen);
-
-		onSigninCB(packet);
-		break;
-	}
-	case CMD::Client_OnLoginCB:
-	{
-		CMD_Client_OnLoginCB packet;
-		packet.ParseFromArray(data, header.msglen);
-
-		onLoginCB(packet);
-		break;
-	}
-	case CMD::Client_OnListServersCB:
-	{
-		CMD_Client_OnListServersCB packet;
-		packet.ParseFromArray(data, header.msglen);
-
-		onListServersCB(packet);
-		break;
-	}
-	case CMD::Client_OnMatchingUpdate:
-	{
-		CMD_Client_OnMatchingUpdate packet;
-		packet.ParseFromArray(data, header.msglen);
-
-		onMatchingUpdate(packet);
-		break;
-	}
-	case CMD::Client_OnEndMatch:
-	{
-		CMD_Client_OnEndMatch packet;
-		packet.ParseFromArray(data, header.msglen);
-
-		onEndMatch(packet);
-		break;
-	}
-	case CMD::Client_OnGameOver:
-	{
-		CMD_Client_OnGameOver packet;
-		packet.ParseFromArray(data, header.msglen);
-
-		onGameOver(packet);
-		break;
-	}
-	case CMD::Client_UpdatePlayerContext:
-	{
-		CMD_Client_UpdatePlayerContext packet;
-		packet.ParseFromArray(data, header.msglen);
-
-		onUpdatePlayerContext(packet);
-		break;
-	}
-	case CMD::Client_OnListGamesCB:
-	{
-		CMD_Client_OnListGamesCB packet;
-		packet.ParseFromArray(data, header.msglen);
-
-		onListGamesCB(packet);
-		break;
-	}
-	default:
-	{
-		ERROR_MSG(fmt::format("XSession::onProcessPacket(): unknown packet cmd: {}, msglen={}, sessionID={}, {}\n",
-			CMD_Name((CMD)header.msgcmd), header.msglen, pSession->id(), pSession->pTcpSocket()->addr()));
-
-		pSession->destroy();
-		return;
-		break;
-	}
-	};
-}
-
 //-------------------------------------------------------------------------------------
 bool XRobot::initialize(XServerBase* pXServer)
 {
-	assert(tickTimerEvent_ == NULL);
+	assert(tickTimerEvent_ == TIMER_HANDLE_INVALID);
 
 	pXServer_ = pXServer;
 
@@ -147,7 +54,7 @@ bool XRobot::initialize(XServerBase* pXServer)
 
 	tickTimerEvent_ = pXServer_->pTimer()->addTimer(TIME_SECONDS, -1, std::bind(&XRobot::onTick, this, std::placeholders::_1), NULL);
 	heartbeatTickTimerEvent_ = pXServer_->pTimer()->addTimer(std::max<uint64>(TIME_SECONDS, ResMgr::getSingleton().serverConfig().heartbeatInterval), -1, std::bind(&XRobot::onHeartbeatTick, this, std::placeholders::_1), NULL);
-	return tickTimerEvent_ != NULL && heartbeatTickTimerEvent_ != NULL;
+	return tickTimerEvent_ != TIMER_HANDLE_INVALID && heartbeatTickTimerEvent_ != TIMER_HANDLE_INVALID;
 }
 
 //-------------------------------------------------------------------------------------
@@ -159,25 +66,19 @@ void XRobot::finalise()
 	if (tickTimerEvent_ && pXServer_->pTimer())
 	{
 		pXServer_->pTimer()->delTimer(tickTimerEvent_);
-		tickTimerEvent_ = NULL;
+		tickTimerEvent_ = TIMER_HANDLE_INVALID;
 	}
 
 	if (heartbeatTickTimerEvent_ && pXServer_->pTimer())
 	{
 		pXServer_->pTimer()->delTimer(heartbeatTickTimerEvent_);
-		heartbeatTickTimerEvent_ = NULL;
+		heartbeatTickTimerEvent_ = TIMER_HANDLE_INVALID;
 	}
 }
 
 //-------------------------------------------------------------------------------------
 void XRobot::onHeartbeatTick(void* userargs)
 {
-	if (XServerBase::getSingleton().pExternalNetworkInterface())
-		XServerBase::getSingleton().pExternalNetworkInterface()->checkSessions();
-
-	if (XServerBase::getSingleton().pInternalNetworkInterface())
-		XServerBase::getSingleton().pInternalNetworkInterface()->checkSessions();
-
 	if (!pSession_ || !pSession_->connected())
 		return;
 
@@ -304,6 +205,7 @@ void XRobot::onStateDirectoryHello()
 	req_packet.set_version(XPLATFORMSERVER_VERSION);
 	req_packet.set_appid(0);
 	req_packet.set_apptype((int32)ServerType::SERVER_TYPE_ROBOT);
+	pSession_->prepareHello(req_packet);
 	pSession_->sendPacket(CMD::Hello, req_packet);
 }
 
@@ -362,6 +264,7 @@ void XRobot::onStateLoginConnectorHello()
 	req_packet.set_version(XPLATFORMSERVER_VERSION);
 	req_packet.set_appid(0);
 	req_packet.set_apptype((int32)ServerType::SERVER_TYPE_ROBOT);
+	pSession_->prepareHello(req_packet);
 	pSession_->sendPacket(CMD::Hello, req_packet);
 }
 
@@ -390,6 +293,7 @@ void XRobot::onStateHallsConnectorHello()
 	req_packet.set_version(XPLATFORMSERVER_VERSION);
 	req_packet.set_appid(0);
 	req_packet.set_apptype((int32)ServerType::SERVER_TYPE_ROBOT);
+	pSession_->prepareHello(req_packet);
 	pSession_->sendPacket(CMD::Hello, req_packet);
 }
 
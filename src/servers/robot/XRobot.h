@@ -35,8 +35,6 @@ public:
 	bool initialize(XServerBase* pXServer);
 	void finalise();
 
-	virtual void onProcessPacket(Session* pSession, const uint8* data, int32 size);
-	
 	virtual void onTick(void* userargs);
 	virtual void onHeartbeatTick(void* userargs);
 
@@ -79,8 +77,8 @@ public:
 	virtual void onDisconnected(Session* pSession);
 
 protected:
-	struct event * tickTimerEvent_;
-	struct event * heartbeatTickTimerEvent_;
+	TimerHandle tickTimerEvent_;
+	TimerHandle heartbeatTickTimerEvent_;
 
 	XServerBase* pXServer_;
 
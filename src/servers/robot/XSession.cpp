@@ -21,11 +21,35 @@ XSession::~XSession()
 bool XSession::onProcessPacket(SessionID requestorSessionID, const uint8* data, int32 size)
 {
 	Session::onProcessPacket(requestorSessionID, data, size);
-	pXRobot_->onProcessPacket(this, data, size);
 
+	destroy();
 	return true;
 }
 
+//-------------------------------------------------------------------------------------
+PacketHandlers& XSession::packetHandlers() const
+{
+	static PacketHandlers handlers("robot", &XSession::registerHandlers);
+	return handlers;
+}
+
+//-------------------------------------------------------------------------------------
+void XSession::registerHandlers(PacketHandlers& handlers)
+{
+	Session::registerHandlers(handlers);
+
+	// 机器人连接的服务器都由ServerMgr::connectServer创建， 视为服务器之间的连接
+	handlers.registerHandler<CMD::Client_OnSignupCB, CMD_Client_OnSignupCB>(&XSession::onSignupCB, SESSION_KIND_SERVER);
+	handlers.registerHandler<CMD::Client_OnSigninCB, CMD_Client_OnSigninCB>(&XSession::onSigninCB, SESSION_KIND_SERVER);
+	handlers.registerHandler<CMD::Client_OnLoginCB, CMD_Client_OnLoginCB>(&XSession::onLoginCB, SESSION_KIND_SERVER);
+	handlers.registerHandler<CMD::Client_OnListServersCB, CMD_Client_OnListServersCB>(&XSession::onListServersCB, SESSION_KIND_SERVER);
+	handlers.registerHandler<CMD::Client_OnMatchingUpdate, CMD_Client_OnMatchingUpdate>(&XSession::onMatchingUpdate, SESSION_KIND_SERVER);
+	handlers.registerHandler<CMD::Client_OnEndMatch, CMD_Client_OnEndMatch>(&XSession::onEndMatch, SESSION_KIND_SERVER);
+	handlers.registerHandler<CMD::Client_OnGameOver, CMD_Client_OnGameOver>(&XSession::onGameOver, SESSION_KIND_SERVER);
+	handlers.registerHandler<CMD::Client_UpdatePlayerContext, CMD_Client_UpdatePlayerContext>(&XSession::onUpdatePlayerContext, SESSION_KIND_SERVER);
+	handlers.registerHandler<CMD::Client_OnListGamesCB, CMD_Client_OnListGamesCB>(&XSession::onListGamesCB, SESSION_KIND_SERVER);
+}
+
 //-------------------------------------------------------------------------------------
 void XSession::onHelloCB(const CMD_HelloCB& packet)
 {
@@ -34,6 +58,60 @@ void XSession::onHelloCB(const CMD_HelloCB& packet)
 	pXRobot_->onHelloCB(packet);
 }
 
+//-------------------------------------------------------------------------------------
+void XSession::onSignupCB(const CMD_Client_OnSignupCB& packet)
+{
+	pXRobot_->onSignupCB(packet);
+}
+
+//-------------------------------------------------------------------------------------
+void XSession::onSigninCB(const CMD_Client_OnSigninCB& packet)
+{
+	pXRobot_->onSigninCB(packet);
+}
+
+//-------------------------------------------------------------------------------------
+void XSession::onLoginCB(const CMD_Client_OnLoginCB& packet)
+{
+	pXRobot_->onLoginCB(packet);
+}
+
+//-------------------------------------------------------------------------------------
+void XSession::onListServersCB(const CMD_Client_OnListServersCB& packet)
+{
+	pXRobot_->onListServersCB(packet);
+}
+
+//-------------------------------------------------------------------------------------
+void XSession::onMatchingUpdate(const CMD_Client_OnMatchingUpdate& packet)
+{
+	pXRobot_->onMatchingUpdate(packet);
+}
+
+//-------------------------------------------------------------------------------------
+void XSession::onEndMatch(const CMD_Client_OnEndMatch& packet)
+{
+	pXRobot_->onEndMatch(packet);
+}
+
+//-------------------------------------------------------------------------------------
+void XSession::onGameOver(const CMD_Client_OnGameOver& packet)
+{
+	pXRobot_->onGameOver(packet);
+}
+
+//-------------------------------------------------------------------------------------
+void XSession::onUpdatePlayerContext(const CMD_Client_UpdatePlayerContext& packet)
+{
+	pXRobot_->onUpdatePlayerContext(packet);
+}
+
+//-------------------------------------------------------------------------------------
+void XSession::onListGamesCB(const CMD_Client_OnListGamesCB& packet)
+{
+	pXRobot_->onListGamesCB(packet);
+}
+
 //-------------------------------------------------------------------------------------
 void XSession::onConnected()
 {
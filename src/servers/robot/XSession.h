@@ -19,8 +19,22 @@ public:
 
 protected:
 	virtual bool onProcessPacket(SessionID requestorSessionID, const uint8* data, int32 size) override;
+	virtual PacketHandlers& packetHandlers() const override;
+	static void registerHandlers(PacketHandlers& handlers);
+
 	virtual void onHelloCB(const CMD_HelloCB& packet) override;
 
+	// 服务器发给客户端的协议， 交给机器人处理
+	virtual void onSignupCB(const CMD_Client_OnSignupCB& packet);
+	virtual void onSigninCB(const CMD_Client_OnSigninCB& packet);
+	virtual void onLoginCB(const CMD_Client_OnLoginCB& packet);
+	virtual void onListServersCB(const CMD_Client_OnListServersCB& packet);
+	virtual void onMatchingUpdate(const CMD_Client_OnMatchingUpdate& packet);
+	virtual void onEndMatch(const CMD_Client_OnEndMatch& packet);
+	virtual void onGameOver(const CMD_Client_OnGameOver& packet);
+	virtual void onUpdatePlayerContext(const CMD_Client_UpdatePlayerContext& packet);
+	virtual void onListGamesCB(const CMD_Client_OnListGamesCB& packet);
+
 	virtual void onConnected() override;
 	virtual void onDisconnected() override;
 
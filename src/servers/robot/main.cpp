@@ -1,5 +1,6 @@
 #include "common/common.h"
 #include "XServerApp.h"
+#include "Benchmark.h"
 #include "log/XLog.h"
 #include <gflags/gflags.h>
 
@@ -8,11 +9,15 @@ DEFINE_uint64(groupid, 0, "the server groupID");
 DEFINE_string(name, "unknown", "the server name");
 DEFINE_int32(botsNum, 100, "maximum number of robots");
 DEFINE_int32(perNum, 1, "create number per time");
+DEFINE_string(benchmark, "", "run a network benchmark instead of robots: cipher, shm, uring, acl");
 
 int main(int argc, char *argv[])
 {
 	gflags::ParseCommandLineFlags(&argc, &argv, true);
 
+	if (!FLAGS_benchmark.empty())
+		return XServer::runBenchmark(FLAGS_benchmark);
+
 	XServer::int32 botsNum = FLAGS_botsNum;
 	XServer::int32 perNum = FLAGS_perNum;
 
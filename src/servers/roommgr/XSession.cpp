@@ -21,53 +21,21 @@ XSession::~XSession()
 }
 
 //-------------------------------------------------------------------------------------
-bool XSession::onProcessPacket(SessionID requestorSessionID, const uint8* data, int32 size)
+PacketHandlers& XSession::packetHandlers() const
 {
-	if (header_.msgcmd >= CMD_MAX)
-	{
-		ERROR_MSG(fmt::format("XSession::onProcessPacket(): invalid packet cmd: {}, msgcmd={}, sessionID={}, {}\n",
-			packetHeader().msglen, packetHeader().msgcmd, id(), pTcpSocket()->addr()));
-
-		return true;
-	}
-
-	switch (header_.msgcmd)
-	{
-	case CMD::Roommgr_RequestCreateRoom:
-	{
-		CMD_Roommgr_RequestCreateRoom packet;
-		PARSE_PACKET();
-
-		onRequestCreateRoom(packet);
-		break;
-	}
-	case CMD::Roommgr_OnRequestCreateRoomCB:
-	{
-		CMD_Roommgr_OnRequestCreateRoomCB packet;
-		PARSE_PACKET();
-
-		onRequestCreateRoomCB(packet);
-		break;
-	}
-	case CMD::Roommgr_OnRoomSrvGameOverReport:
-	{
-		CMD_Roommgr_OnRoomSrvGameOverReport packet;
-		PARSE_PACKET();
-
-		onRoomSrvGameOverReport(packet);
-		break;
-	}
-	default:
-	{
-		ERROR_MSG(fmt::format("XSession::onProcessPacket(): unknown packet cmd: {}, msglen={}, sessionID={}, {}\n",
-			CMD_Name((CMD)packetHeader().msgcmd), packetHeader().msglen, id(), pTcpSocket()->addr()));
+	static PacketHandlers handlers("roommgr", &XSession::registerHandlers);
+	return handlers;
+}
 
-		return false;
-		break;
-	}
-	};
+//-------------------------------------------------------------------------------------
+void XSession::registerHandlers(PacketHandlers& handlers)
+{
+	Session::registerHandlers(handlers);
 
-	return true;
+	// 客户端的协议由connector转发， 都来自服务器之间的连接
+	handlers.registerHandler<CMD::Roommgr_RequestCreateRoom, CMD_Roommgr_RequestCreateRoom>(&XSession::onRequestCreateRoom, SESSION_KIND_SERVER);
+	handlers.registerHandler<CMD::Roommgr_OnRequestCreateRoomCB, CMD_Roommgr_OnRequestCreateRoomCB>(&XSession::onRequestCreateRoomCB, SESSION_KIND_SERVER);
+	handlers.registerHandler<CMD::Roommgr_OnRoomSrvGameOverReport, CMD_Roommgr_OnRoomSrvGameOverReport>(&XSession::onRoomSrvGameOverReport, SESSION_KIND_SERVER);
 }
 
 //-------------------------------------------------------------------------------------